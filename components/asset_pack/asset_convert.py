@@ -0,0 +1,383 @@
+#!/usr/bin/env python
+#
+# SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Convert a directory of assets to the formats the firmware uses as they are, and index them in a manifest.
+#
+#   *.png  LVGL true color image, RGB565 or RGB565 followed by an alpha byte per pixel, optionally run-length encoded
+#   *.wav  raw 16 bit PCM at the sample rate and channel count of the codec
+#
+# Other files, and the ones which can not be converted, are kept unchanged. The output is either a directory tree for
+# a file system, indexed by assets.idx, or with --flat a single image for a partition which is memory mapped as it is:
+# the same header and entries, followed by the data of each asset at an aligned offset. The entries are sorted by name,
+# see asset_pack.c for the layout. Everything is little endian.
+
+import argparse
+import array
+import os
+import shutil
+import struct
+import sys
+import wave
+import zlib
+
+MANIFEST_NAME = 'assets.idx'
+MANIFEST_MAGIC = 0x4b505341     # "ASPK"
+FLAT_MAGIC = 0x46505341         # "ASPF"
+MANIFEST_VERSION = 2
+HEADER_FORMAT = '<IHHII'
+ENTRY_FORMAT = '<32s32sBBBBHHIIII'
+FLASH_PAGE = 4096               # Alignment a partition keeps once mapped
+NAME_MAX = 32                   # SPIFFS object name length, terminating zero included
+
+TYPE_IMAGE = 1
+TYPE_PCM = 2
+TYPE_FILE = 3
+ENCODING_RAW = 0
+ENCODING_RLE = 1
+
+LV_IMG_CF_TRUE_COLOR = 4
+LV_IMG_CF_TRUE_COLOR_ALPHA = 5
+
+RLE_MAX = 128
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+PNG_CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+
+class ConvertError(Exception):
+    pass
+
+
+def png_unfilter(data, width, height, bpp):
+    """Undo the per row filters, bpp is the filter unit in bytes"""
+    stride = (len(data) // height) - 1
+    out = bytearray(stride * height)
+    prev = bytearray(stride)
+    pos = 0
+    for y in range(height):
+        kind = data[pos]
+        row = bytearray(data[pos + 1:pos + 1 + stride])
+        pos += stride + 1
+        if kind == 1:
+            for i in range(bpp, stride):
+                row[i] = (row[i] + row[i - bpp]) & 0xff
+        elif kind == 2:
+            for i in range(stride):
+                row[i] = (row[i] + prev[i]) & 0xff
+        elif kind == 3:
+            for i in range(stride):
+                left = row[i - bpp] if i >= bpp else 0
+                row[i] = (row[i] + ((left + prev[i]) >> 1)) & 0xff
+        elif kind == 4:
+            for i in range(stride):
+                a = row[i - bpp] if i >= bpp else 0
+                b = prev[i]
+                c = prev[i - bpp] if i >= bpp else 0
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                predictor = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                row[i] = (row[i] + predictor) & 0xff
+        elif kind != 0:
+            raise ConvertError('bad PNG filter {}'.format(kind))
+        out[y * stride:(y + 1) * stride] = row
+        prev = row
+    return out, stride
+
+
+def png_decode(data):
+    """Decode a non interlaced PNG to a list of (r, g, b, a) pixels"""
+    if data[:8] != PNG_SIGNATURE:
+        raise ConvertError('not a PNG file')
+    pos = 8
+    idat = bytearray()
+    palette = []
+    trns = b''
+    header = None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            header = struct.unpack('>IIBBBBB', body)
+        elif kind == b'PLTE':
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b'tRNS':
+            trns = body
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+    if not header:
+        raise ConvertError('no PNG header')
+    width, height, depth, color, _, _, interlace = header
+    if interlace or color not in PNG_CHANNELS or (depth != 8 and not (depth < 8 and color in (0, 3))):
+        raise ConvertError('unsupported PNG, depth {} color type {} interlace {}'.format(depth, color, interlace))
+
+    channels = PNG_CHANNELS[color]
+    raw, stride = png_unfilter(zlib.decompress(bytes(idat)), width, height, max(1, channels * depth // 8))
+
+    pixels = []
+    for y in range(height):
+        row = raw[y * stride:(y + 1) * stride]
+        if depth < 8:
+            mask = (1 << depth) - 1
+            samples = [(row[i * depth // 8] >> (8 - depth - (i * depth) % 8)) & mask for i in range(width)]
+        else:
+            samples = row
+        for x in range(width):
+            if color == 0:
+                v = samples[x] * 255 // ((1 << depth) - 1)
+                transparent = len(trns) >= 2 and samples[x] == struct.unpack('>H', trns[:2])[0]
+                pixels.append((v, v, v, 0 if transparent else 255))
+            elif color == 2:
+                r, g, b = samples[x * 3:x * 3 + 3]
+                transparent = len(trns) >= 6 and (r, g, b) == struct.unpack('>HHH', trns[:6])
+                pixels.append((r, g, b, 0 if transparent else 255))
+            elif color == 3:
+                index = samples[x]
+                r, g, b = palette[index]
+                pixels.append((r, g, b, trns[index] if index < len(trns) else 255))
+            elif color == 4:
+                v, a = samples[x * 2:x * 2 + 2]
+                pixels.append((v, v, v, a))
+            else:
+                pixels.append(tuple(samples[x * 4:x * 4 + 4]))
+    return width, height, pixels
+
+
+def rle_encode(data, unit):
+    """Runs of identical pixels and literal pixel strings, behind a control byte each"""
+    px = [bytes(data[i:i + unit]) for i in range(0, len(data), unit)]
+    out = bytearray()
+    i = 0
+    literal = []
+
+    def flush():
+        for k in range(0, len(literal), RLE_MAX):
+            chunk = literal[k:k + RLE_MAX]
+            out.append(len(chunk) - 1)
+            out.extend(b''.join(chunk))
+        del literal[:]
+
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < RLE_MAX and px[i + run] == px[i]:
+            run += 1
+        if run >= 2:
+            flush()
+            out.append(0x80 | (run - 1))
+            out.extend(px[i])
+            i += run
+        else:
+            literal.append(px[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def convert_image(data, args):
+    width, height, pixels = png_decode(data)
+    if width >= 2048 or height >= 2048:
+        raise ConvertError('{}x{} is too large for an LVGL image'.format(width, height))
+
+    alpha = any(p[3] != 255 for p in pixels)
+    unit = 3 if alpha else 2
+    out = bytearray()
+    for r, g, b, a in pixels:
+        color = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        out += struct.pack('>H' if args.swap else '<H', color)
+        if alpha:
+            out.append(a)
+
+    encoding = ENCODING_RAW
+    stored = bytes(out)
+    if args.rle:
+        packed = rle_encode(out, unit)
+        if len(packed) < len(stored):
+            encoding = ENCODING_RLE
+            stored = packed
+    cf = LV_IMG_CF_TRUE_COLOR_ALPHA if alpha else LV_IMG_CF_TRUE_COLOR
+    entry = dict(type=TYPE_IMAGE, encoding=encoding, format=cf, channels=0, width=width, height=height, rate=0,
+                 size=len(out))
+    return stored, entry
+
+
+def convert_pcm(path, args):
+    try:
+        with wave.open(path, 'rb') as w:
+            rate, channels, width = w.getframerate(), w.getnchannels(), w.getsampwidth()
+            frames = w.readframes(w.getnframes())
+    except (wave.Error, EOFError) as e:
+        raise ConvertError(str(e))
+    if width == 1:
+        samples = array.array('h', ((v - 128) << 8 for v in frames))
+    elif width == 2:
+        samples = array.array('h', frames)
+        if sys.byteorder != 'little':
+            samples.byteswap()
+    else:
+        raise ConvertError('{} bit samples'.format(width * 8))
+    if channels not in (1, 2):
+        raise ConvertError('{} channels'.format(channels))
+
+    # Channels first, so resampling works on the output layout
+    if channels != args.pcm_channels:
+        if channels == 1:
+            samples = array.array('h', (v for v in samples for _ in range(2)))
+        else:
+            samples = array.array('h', ((samples[i] + samples[i + 1]) // 2 for i in range(0, len(samples), 2)))
+    ch = args.pcm_channels
+
+    if rate != args.pcm_rate:
+        count = len(samples) // ch
+        out_count = count * args.pcm_rate // rate
+        out = array.array('h', bytes(out_count * ch * 2))
+        for i in range(out_count):
+            pos = i * rate / args.pcm_rate
+            k = int(pos)
+            frac = pos - k
+            k1 = min(k + 1, count - 1)
+            for c in range(ch):
+                a = samples[k * ch + c]
+                b = samples[k1 * ch + c]
+                out[i * ch + c] = int(round(a + (b - a) * frac))
+        samples = out
+
+    if sys.byteorder != 'little':
+        samples.byteswap()
+    stored = samples.tobytes()
+    entry = dict(type=TYPE_PCM, encoding=ENCODING_RAW, format=16, channels=ch, width=0, height=0, rate=args.pcm_rate,
+                 size=len(stored))
+    return stored, entry
+
+
+CONVERTERS = {
+    '.png': ('.lvi', lambda path, args: convert_image(open(path, 'rb').read(), args)),
+    '.wav': ('.pcm', convert_pcm),
+}
+
+
+def pack_name(name, path):
+    encoded = name.encode('utf-8')
+    if len(encoded) >= NAME_MAX:
+        raise SystemExit('{}: name longer than {} bytes'.format(path, NAME_MAX - 1))
+    return encoded
+
+
+def pack_entry(e, offset):
+    return struct.pack(ENTRY_FORMAT, e['name'], e['file'], e['type'], e['encoding'], e['format'], e['channels'],
+                       e['width'], e['height'], e['rate'], e['size'], e['stored_size'], offset)
+
+
+def write_tree(output, entries):
+    for e in entries:
+        out_path = os.path.join(output, e['file'].decode('utf-8'))
+        os.makedirs(os.path.dirname(out_path), exist_ok=True)
+        if e['data'] is None:
+            shutil.copyfile(e['path'], out_path)
+        else:
+            with open(out_path, 'wb') as f:
+                f.write(e['data'])
+    with open(os.path.join(output, MANIFEST_NAME), 'wb') as f:
+        f.write(struct.pack(HEADER_FORMAT, MANIFEST_MAGIC, MANIFEST_VERSION, len(entries), 0, 0))
+        for e in entries:
+            f.write(pack_entry(e, 0))
+
+
+def write_flat(output, entries, align):
+    def aligned(n):
+        return (n + align - 1) & ~(align - 1)
+
+    offset = aligned(struct.calcsize(HEADER_FORMAT) + len(entries) * struct.calcsize(ENTRY_FORMAT))
+    offsets = []
+    for e in entries:
+        offsets.append(offset)
+        offset = aligned(offset + e['stored_size'])
+
+    with open(output, 'wb') as f:
+        f.write(struct.pack(HEADER_FORMAT, FLAT_MAGIC, MANIFEST_VERSION, len(entries), align, offset))
+        for e, o in zip(entries, offsets):
+            f.write(pack_entry(e, o))
+        for e, o in zip(entries, offsets):
+            f.write(bytes(o - f.tell()))
+            if e['data'] is None:
+                with open(e['path'], 'rb') as src:
+                    shutil.copyfileobj(src, f)
+            else:
+                f.write(e['data'])
+        f.write(bytes(offset - f.tell()))
+    return offset
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert assets to the formats used by the firmware')
+    parser.add_argument('input', help='source directory')
+    parser.add_argument('output', help='directory to create the converted tree in, image file with --flat')
+    parser.add_argument('--flat', action='store_true', help='write a single image to memory map, not a tree')
+    parser.add_argument('--align', type=int, default=64, help='alignment of the data of each asset in a flat image')
+    parser.add_argument('--partition-size', type=lambda v: int(v, 0), help='fail if the flat image is larger')
+    parser.add_argument('--swap', action='store_true', help='swap the bytes of RGB565 colors, LV_COLOR_16_SWAP')
+    parser.add_argument('--rle', action='store_true', help='run-length encode the images when it makes them smaller')
+    parser.add_argument('--pcm-rate', type=int, default=16000, help='sample rate of the converted prompts')
+    parser.add_argument('--pcm-channels', type=int, choices=(1, 2), default=2, help='channels of the converted prompts')
+    args = parser.parse_args()
+
+    if args.align < 4 or args.align > FLASH_PAGE or args.align & (args.align - 1):
+        raise SystemExit('--align must be a power of two from 4 to {}'.format(FLASH_PAGE))
+
+    entries = []
+    files = set()
+    converted = 0
+    source = 0
+    for root, dirs, names in os.walk(args.input):
+        dirs.sort()
+        for name in sorted(names):
+            path = os.path.join(root, name)
+            rel = os.path.relpath(path, args.input).replace(os.sep, '/')
+            base, ext = os.path.splitext(rel)
+            out_rel = rel
+            stored = None
+            entry = dict(type=TYPE_FILE, encoding=ENCODING_RAW, format=0, channels=0, width=0, height=0, rate=0,
+                         size=os.path.getsize(path))
+            if ext.lower() in CONVERTERS:
+                suffix, convert = CONVERTERS[ext.lower()]
+                try:
+                    stored, entry = convert(path, args)
+                    out_rel = base + suffix
+                    converted += 1
+                    source += os.path.getsize(path)
+                except ConvertError as e:
+                    print('{}: {}, copied'.format(rel, e))
+
+            if out_rel in files or out_rel == MANIFEST_NAME:
+                raise SystemExit('{}: {} already exists'.format(rel, out_rel))
+            files.add(out_rel)
+            entry.update(name=pack_name(rel, path), file=pack_name(out_rel, path), path=path, data=stored,
+                         stored_size=entry['size'] if stored is None else len(stored))
+            entries.append(entry)
+    if len(entries) > 0xffff:
+        raise SystemExit('{} assets, at most 65535'.format(len(entries)))
+
+    # The firmware looks the names up with a binary search
+    entries.sort(key=lambda e: e['name'])
+    if args.flat:
+        size = write_flat(args.output, entries, args.align)
+        if args.partition_size is not None and size > args.partition_size:
+            os.remove(args.output)
+            raise SystemExit('{} bytes image, partition of {} bytes'.format(size, args.partition_size))
+        print('{} assets, {} converted from {} bytes, {} bytes image'.format(len(entries), converted, source, size))
+        return
+
+    if os.path.isdir(args.output):
+        shutil.rmtree(args.output)
+    os.makedirs(args.output)
+    write_tree(args.output, entries)
+    print('{} assets converted, {} -> {} bytes'.format(converted, source, sum(e['stored_size'] for e in entries
+                                                                             if e['type'] != TYPE_FILE)))
+
+
+if __name__ == '__main__':
+    main()
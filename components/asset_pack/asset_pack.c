@@ -0,0 +1,401 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+
+#include "asset_pack.h"
+
+#define ASSET_PACK_MANIFEST         "assets.idx"
+#define ASSET_PACK_MAGIC            (0x4b505341)    /* "ASPK" */
+#define ASSET_PACK_FLAT_MAGIC       (0x46505341)    /* "ASPF" */
+#define ASSET_PACK_VERSION          (2)
+#define ASSET_PACK_FLAT_ALIGN_MAX   (4096)          /* Partitions start on a flash sector, which mapping keeps */
+#define ASSET_PACK_PATH_MAX         (64)
+#define ASSET_PACK_RLE_RUN          (0x80)          /* Control byte of a run, otherwise n + 1 literal pixels follow */
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t align;                 /* Alignment of the asset data, flat image only */
+    uint32_t size;                  /* Bytes of the image, flat image only */
+} asset_pack_header_t;
+
+_Static_assert(sizeof(asset_pack_entry_t) == 88, "asset_pack_entry_t must match asset_convert.py");
+
+static struct {
+    char base_path[ASSET_PACK_PATH_MAX / 2];
+    const asset_pack_entry_t *entries;
+    size_t count;
+    const uint8_t *image;           /* Mapped flat image, NULL when reading files */
+    size_t image_size;
+    esp_partition_mmap_handle_t mmap;
+} s_pack;
+
+static const char *TAG = "asset_pack";
+
+static void *asset_alloc(size_t size)
+{
+    return heap_caps_malloc_prefer(size, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, MALLOC_CAP_DEFAULT);
+}
+
+/* Data of an asset in the mapped image, NULL when reading files */
+static const uint8_t *asset_data(const asset_pack_entry_t *entry)
+{
+    return s_pack.image ? s_pack.image + entry->offset : NULL;
+}
+
+static FILE *asset_open(const asset_pack_entry_t *entry)
+{
+    char path[ASSET_PACK_PATH_MAX];
+
+    if (s_pack.image) {
+        /* Read only, fmemopen() does not write through a "rb" stream */
+        FILE *fp = fmemopen((void *)asset_data(entry), entry->stored_size, "rb");
+        ESP_RETURN_ON_FALSE(fp, NULL, TAG, "open %s failed", entry->name);
+        return fp;
+    }
+    snprintf(path, sizeof(path), "%s/%s", s_pack.base_path, entry->file);
+    FILE *fp = fopen(path, "rb");
+    ESP_RETURN_ON_FALSE(fp, NULL, TAG, "open %s failed", path);
+    return fp;
+}
+
+/* Expand runs of `unit` byte pixels, false if the data does not fill the output exactly */
+static bool rle_decode(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t unit)
+{
+    const uint8_t *src_end = src + src_len;
+    uint8_t *dst_end = dst + dst_len;
+
+    while (src < src_end) {
+        uint8_t ctrl = *src++;
+        size_t count = (ctrl & (ASSET_PACK_RLE_RUN - 1)) + 1;
+        size_t len = count * unit;
+
+        if ((size_t)(dst_end - dst) < len) {
+            return false;
+        }
+        if (ctrl & ASSET_PACK_RLE_RUN) {
+            if ((size_t)(src_end - src) < unit) {
+                return false;
+            }
+            for (size_t i = 0; i < count; i++) {
+                memcpy(dst, src, unit);
+                dst += unit;
+            }
+            src += unit;
+        } else {
+            if ((size_t)(src_end - src) < len) {
+                return false;
+            }
+            memcpy(dst, src, len);
+            dst += len;
+            src += len;
+        }
+    }
+    return dst == dst_end;
+}
+
+/* Names terminated and sorted for the binary search, flat image data within the image and aligned */
+static bool manifest_check(const asset_pack_entry_t *entries, size_t count, const asset_pack_header_t *flat)
+{
+    for (size_t i = 0; i < count; i++) {
+        const asset_pack_entry_t *entry = &entries[i];
+
+        if (!memchr(entry->name, '\0', sizeof(entry->name)) || !memchr(entry->file, '\0', sizeof(entry->file))) {
+            ESP_LOGE(TAG, "entry %u: name not terminated", (unsigned)i);
+            return false;
+        }
+        if (i && (strcmp(entries[i - 1].name, entry->name) >= 0)) {
+            ESP_LOGE(TAG, "%s: names not sorted", entry->name);
+            return false;
+        }
+        if (flat && ((entry->offset % flat->align) || (entry->offset > flat->size) ||
+                     (entry->stored_size > flat->size - entry->offset))) {
+            ESP_LOGE(TAG, "%s: data out of the image", entry->name);
+            return false;
+        }
+    }
+    return true;
+}
+
+esp_err_t asset_pack_init(const char *base_path)
+{
+    esp_err_t ret = ESP_OK;
+    char path[ASSET_PACK_PATH_MAX];
+    asset_pack_header_t header;
+    asset_pack_entry_t *entries = NULL;
+
+    ESP_RETURN_ON_FALSE(base_path && (strlen(base_path) < sizeof(s_pack.base_path)), ESP_ERR_INVALID_ARG, TAG,
+                        "invalid base path");
+    ESP_RETURN_ON_FALSE(!s_pack.entries && !s_pack.image, ESP_ERR_INVALID_STATE, TAG, "already initialized");
+
+    snprintf(path, sizeof(path), "%s/%s", base_path, ASSET_PACK_MANIFEST);
+    FILE *fp = fopen(path, "rb");
+    ESP_RETURN_ON_FALSE(fp, ESP_ERR_NOT_FOUND, TAG, "no manifest %s", path);
+
+    ESP_GOTO_ON_FALSE(1 == fread(&header, sizeof(header), 1, fp) && (ASSET_PACK_MAGIC == header.magic),
+                      ESP_ERR_NOT_FOUND, err, TAG, "%s is not a manifest", path);
+    ESP_GOTO_ON_FALSE(ASSET_PACK_VERSION == header.version, ESP_ERR_INVALID_VERSION, err, TAG,
+                      "manifest version %u, expected %u", header.version, ASSET_PACK_VERSION);
+    if (header.count) {
+        entries = malloc(header.count * sizeof(asset_pack_entry_t));
+        ESP_GOTO_ON_FALSE(entries, ESP_ERR_NO_MEM, err, TAG, "no mem for manifest");
+        ESP_GOTO_ON_FALSE(header.count == fread(entries, sizeof(asset_pack_entry_t), header.count, fp),
+                          ESP_ERR_INVALID_SIZE, err, TAG, "manifest truncated");
+        ESP_GOTO_ON_FALSE(manifest_check(entries, header.count, NULL), ESP_ERR_INVALID_SIZE, err, TAG,
+                          "%s is corrupted", path);
+    }
+    fclose(fp);
+
+    strlcpy(s_pack.base_path, base_path, sizeof(s_pack.base_path));
+    s_pack.entries = entries;
+    s_pack.count = header.count;
+    ESP_LOGI(TAG, "%u assets in %s", (unsigned)s_pack.count, base_path);
+    return ESP_OK;
+
+err:
+    free(entries);
+    fclose(fp);
+    return ret;
+}
+
+esp_err_t asset_pack_init_partition(const char *label)
+{
+    esp_err_t ret = ESP_OK;
+    const void *image = NULL;
+    esp_partition_mmap_handle_t mmap;
+
+    ESP_RETURN_ON_FALSE(label, ESP_ERR_INVALID_ARG, TAG, "invalid label");
+    ESP_RETURN_ON_FALSE(!s_pack.entries && !s_pack.image, ESP_ERR_INVALID_STATE, TAG, "already initialized");
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                                label);
+    ESP_RETURN_ON_FALSE(partition, ESP_ERR_NOT_FOUND, TAG, "no partition %s", label);
+    ESP_RETURN_ON_FALSE(partition->size >= sizeof(asset_pack_header_t), ESP_ERR_INVALID_SIZE, TAG,
+                        "partition %s too small", label);
+
+    /* The whole partition, so the assets are plain pointers into the flash cache */
+    ESP_RETURN_ON_ERROR(esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &image, &mmap),
+                        TAG, "map %s failed", label);
+    const asset_pack_header_t *header = image;
+    ESP_GOTO_ON_FALSE(ASSET_PACK_FLAT_MAGIC == header->magic, ESP_ERR_NOT_FOUND, err, TAG,
+                      "partition %s has no asset image", label);
+    ESP_GOTO_ON_FALSE(ASSET_PACK_VERSION == header->version, ESP_ERR_INVALID_VERSION, err, TAG,
+                      "image version %u, expected %u", header->version, ASSET_PACK_VERSION);
+    ESP_GOTO_ON_FALSE((header->size <= partition->size) &&
+                      (sizeof(*header) + header->count * sizeof(asset_pack_entry_t) <= header->size),
+                      ESP_ERR_INVALID_SIZE, err, TAG, "image of %" PRIu32 " bytes, partition %s of %" PRIu32,
+                      header->size, label, (uint32_t)partition->size);
+    ESP_GOTO_ON_FALSE(header->align && !(header->align & (header->align - 1)) &&
+                      (header->align <= ASSET_PACK_FLAT_ALIGN_MAX) && !((uintptr_t)image % header->align),
+                      ESP_ERR_INVALID_SIZE, err, TAG, "image aligned on %" PRIu32 " bytes, mapped at %p",
+                      header->align, image);
+    const asset_pack_entry_t *entries = (const asset_pack_entry_t *)(header + 1);
+    ESP_GOTO_ON_FALSE(manifest_check(entries, header->count, header), ESP_ERR_INVALID_SIZE, err, TAG,
+                      "partition %s is corrupted", label);
+
+    s_pack.image = image;
+    s_pack.image_size = header->size;
+    s_pack.mmap = mmap;
+    s_pack.entries = entries;
+    s_pack.count = header->count;
+    ESP_LOGI(TAG, "%u assets mapped from %s, aligned on %" PRIu32 " bytes", (unsigned)s_pack.count, label,
+             header->align);
+    return ESP_OK;
+
+err:
+    esp_partition_munmap(mmap);
+    return ret;
+}
+
+const void *asset_pack_map(const char *name, const asset_pack_entry_t **entry)
+{
+    const asset_pack_entry_t *found = asset_pack_find(name);
+
+    if (!found || !s_pack.image || (ASSET_PACK_ENCODING_RAW != found->encoding)) {
+        return NULL;
+    }
+    if (entry) {
+        *entry = found;
+    }
+    return asset_data(found);
+}
+
+FILE *asset_pack_open(const char *name, const asset_pack_entry_t **entry)
+{
+    const asset_pack_entry_t *found = asset_pack_find(name);
+
+    ESP_RETURN_ON_FALSE(found, NULL, TAG, "no asset %s", name ? name : "");
+    if (entry) {
+        *entry = found;
+    }
+    return asset_open(found);
+}
+
+size_t asset_pack_count(void)
+{
+    return s_pack.count;
+}
+
+const asset_pack_entry_t *asset_pack_get(size_t index)
+{
+    return (index < s_pack.count) ? &s_pack.entries[index] : NULL;
+}
+
+static int entry_compare(const void *name, const void *entry)
+{
+    return strcmp(name, ((const asset_pack_entry_t *)entry)->name);
+}
+
+const asset_pack_entry_t *asset_pack_find(const char *name)
+{
+    if (!name || !s_pack.count) {
+        return NULL;
+    }
+    return bsearch(name, s_pack.entries, s_pack.count, sizeof(asset_pack_entry_t), entry_compare);
+}
+
+esp_err_t asset_pack_image_load(const char *name, lv_img_dsc_t *img)
+{
+    esp_err_t ret = ESP_OK;
+    uint8_t *data = NULL;
+    uint8_t *stored = NULL;
+    FILE *fp = NULL;
+    size_t unit;
+
+    ESP_RETURN_ON_FALSE(name && img, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    const asset_pack_entry_t *entry = asset_pack_find(name);
+    ESP_RETURN_ON_FALSE(entry && (ASSET_PACK_TYPE_IMAGE == entry->type), ESP_ERR_NOT_FOUND, TAG, "no image %s", name);
+    ESP_RETURN_ON_FALSE(16 == LV_COLOR_DEPTH, ESP_ERR_NOT_SUPPORTED, TAG, "images are converted to RGB565");
+
+    switch (entry->format) {
+    case LV_IMG_CF_TRUE_COLOR:
+        unit = sizeof(lv_color_t);
+        break;
+    case LV_IMG_CF_TRUE_COLOR_ALPHA:
+        unit = LV_IMG_PX_SIZE_ALPHA_BYTE;
+        break;
+    default:
+        ESP_LOGE(TAG, "%s: unknown color format %u", name, entry->format);
+        return ESP_FAIL;
+    }
+    ESP_RETURN_ON_FALSE((size_t)entry->width * entry->height * unit == entry->size, ESP_FAIL, TAG,
+                        "%s: size does not match %ux%u", name, entry->width, entry->height);
+
+    const uint8_t *mapped = asset_data(entry);
+    if (mapped && (ASSET_PACK_ENCODING_RAW == entry->encoding)) {
+        /* Drawn straight from flash */
+        data = (uint8_t *)mapped;
+        goto done;
+    }
+
+    data = asset_alloc(entry->size);
+    ESP_RETURN_ON_FALSE(data, ESP_ERR_NO_MEM, TAG, "no mem for %s, %" PRIu32 " bytes", name, entry->size);
+    if (mapped) {
+        ESP_GOTO_ON_FALSE(rle_decode(mapped, entry->stored_size, data, entry->size, unit), ESP_FAIL, err, TAG,
+                          "%s is corrupted", name);
+        goto done;
+    }
+
+    fp = asset_open(entry);
+    ESP_GOTO_ON_FALSE(fp, ESP_ERR_NOT_FOUND, err, TAG, "no file for %s", name);
+    if (ASSET_PACK_ENCODING_RLE == entry->encoding) {
+        stored = asset_alloc(entry->stored_size);
+        ESP_GOTO_ON_FALSE(stored, ESP_ERR_NO_MEM, err, TAG, "no mem for %s", name);
+        ESP_GOTO_ON_FALSE(entry->stored_size == fread(stored, 1, entry->stored_size, fp), ESP_FAIL, err, TAG,
+                          "read %s failed", entry->file);
+        ESP_GOTO_ON_FALSE(rle_decode(stored, entry->stored_size, data, entry->size, unit), ESP_FAIL, err, TAG,
+                          "%s is corrupted", entry->file);
+        heap_caps_free(stored);
+        stored = NULL;
+    } else {
+        ESP_GOTO_ON_FALSE(entry->size == fread(data, 1, entry->size, fp), ESP_FAIL, err, TAG, "read %s failed",
+                          entry->file);
+    }
+    fclose(fp);
+
+done:
+    memset(img, 0, sizeof(lv_img_dsc_t));
+    img->header.cf = entry->format;
+    img->header.w = entry->width;
+    img->header.h = entry->height;
+    img->data_size = entry->size;
+    img->data = data;
+    return ESP_OK;
+
+err:
+    heap_caps_free(stored);
+    heap_caps_free(data);
+    if (fp) {
+        fclose(fp);
+    }
+    return ret;
+}
+
+esp_err_t asset_pack_pcm_load(const char *name, const uint8_t **data, const asset_pack_entry_t **entry)
+{
+    const asset_pack_entry_t *pcm = asset_pack_find(name);
+
+    ESP_RETURN_ON_FALSE(data, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(pcm && (ASSET_PACK_TYPE_PCM == pcm->type), ESP_ERR_NOT_FOUND, TAG, "no prompt %s",
+                        name ? name : "");
+    if (entry) {
+        *entry = pcm;
+    }
+    if (s_pack.image) {
+        *data = asset_data(pcm);
+        return ESP_OK;
+    }
+
+    FILE *fp = asset_open(pcm);
+    ESP_RETURN_ON_FALSE(fp, ESP_ERR_NOT_FOUND, TAG, "no file for %s", name);
+    uint8_t *buf = asset_alloc(pcm->size ? pcm->size : 1);
+    if (!buf) {
+        fclose(fp);
+        ESP_LOGE(TAG, "no mem for %s, %" PRIu32 " bytes", name, pcm->size);
+        return ESP_ERR_NO_MEM;
+    }
+    size_t len = fread(buf, 1, pcm->size, fp);
+    fclose(fp);
+    if (len != pcm->size) {
+        heap_caps_free(buf);
+        ESP_LOGE(TAG, "read %s failed", pcm->file);
+        return ESP_FAIL;
+    }
+
+    *data = buf;
+    return ESP_OK;
+}
+
+FILE *asset_pack_pcm_open(const char *name, const asset_pack_entry_t **entry)
+{
+    const asset_pack_entry_t *pcm = asset_pack_find(name);
+
+    ESP_RETURN_ON_FALSE(pcm && (ASSET_PACK_TYPE_PCM == pcm->type), NULL, TAG, "no prompt %s", name ? name : "");
+    if (entry) {
+        *entry = pcm;
+    }
+    return asset_open(pcm);
+}
+
+void asset_pack_free(const void *data)
+{
+    const uint8_t *p = data;
+
+    /* Mapped assets are not copies */
+    if (s_pack.image && (p >= s_pack.image) && (p < s_pack.image + s_pack.image_size)) {
+        return;
+    }
+    heap_caps_free((void *)data);
+}
@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Assets converted at build time
+ *
+ * `asset_pack_create_partition_image()` in CMake, used instead of `spiffs_create_partition_image()`, converts the
+ * PNG images of the partition to LVGL true color images and the WAV prompts to raw PCM in the codec format, then
+ * indexes them in a manifest. At runtime the images are read straight into their final layout and the prompts are
+ * written to the codec as they are: neither needs a decoder nor a header parser.
+ *
+ * `asset_pack_create_flat_image()` converts the same way into a single read-only image instead, for a data partition
+ * which is memory mapped by `asset_pack_init_partition()`. The assets are then served from the flash cache without
+ * any copy, each one aligned as configured by CONFIG_ASSET_PACK_FLAT_ALIGN.
+ *
+ * Assets are looked up by their source name, e.g. "echo_en_wake.wav".
+ */
+
+typedef enum {
+    ASSET_PACK_TYPE_IMAGE = 1,      /*!< LV_IMG_CF_TRUE_COLOR or LV_IMG_CF_TRUE_COLOR_ALPHA pixels */
+    ASSET_PACK_TYPE_PCM = 2,        /*!< Interleaved little endian samples */
+    ASSET_PACK_TYPE_FILE = 3,       /*!< Any other file, kept as it is */
+} asset_pack_type_t;
+
+typedef enum {
+    ASSET_PACK_ENCODING_RAW = 0,
+    ASSET_PACK_ENCODING_RLE = 1,    /*!< Runs of identical pixels, see asset_convert.py */
+} asset_pack_encoding_t;
+
+/**
+ * @brief Manifest entry, as stored in the partition
+ */
+typedef struct __attribute__((packed)) {
+    char name[32];                  /*!< Source name, relative to the partition root */
+    char file[32];                  /*!< Converted file, relative to the partition root */
+    uint8_t type;                   /*!< asset_pack_type_t */
+    uint8_t encoding;               /*!< asset_pack_encoding_t */
+    uint8_t format;                 /*!< Color format of an image, bits per sample of a prompt */
+    uint8_t channels;               /*!< Channels of a prompt */
+    uint16_t width;                 /*!< Width of an image */
+    uint16_t height;                /*!< Height of an image */
+    uint32_t sample_rate;           /*!< Sample rate of a prompt */
+    uint32_t size;                  /*!< Bytes once decoded */
+    uint32_t stored_size;           /*!< Bytes of the converted file */
+    uint32_t offset;                /*!< Offset of the data in a flat image, 0 in a file system */
+} asset_pack_entry_t;
+
+/**
+ * @brief Read the manifest of a mounted partition
+ *
+ * @param base_path: Mount point of the partition, e.g. BSP_SPIFFS_MOUNT_POINT
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Already initialized
+ *    - ESP_ERR_NOT_FOUND: No manifest, the partition was not created by asset_pack_create_partition_image()
+ *    - ESP_ERR_INVALID_VERSION: Manifest of another version
+ *    - ESP_ERR_INVALID_SIZE: Truncated or corrupted manifest
+ *    - ESP_ERR_NO_MEM: No memory for the manifest
+ */
+esp_err_t asset_pack_init(const char *base_path);
+
+/**
+ * @brief Map a flat image partition created by asset_pack_create_flat_image()
+ *
+ * @note Use either this or `asset_pack_init()`. The partition stays mapped.
+ *
+ * @param label: Label of the data partition, e.g. "assets"
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Already initialized
+ *    - ESP_ERR_NOT_FOUND: No such partition, or it holds no flat image
+ *    - ESP_ERR_INVALID_VERSION: Image of another version
+ *    - ESP_ERR_INVALID_SIZE: Image larger than the partition, or corrupted
+ *    - Others: Mapping failed
+ */
+esp_err_t asset_pack_init_partition(const char *label);
+
+/**
+ * @brief Number of assets, converted or not
+ */
+size_t asset_pack_count(void);
+
+/**
+ * @brief Converted asset by index, in the order of the names
+ *
+ * @return Entry, NULL if out of range
+ */
+const asset_pack_entry_t *asset_pack_get(size_t index);
+
+/**
+ * @brief Converted asset by source name
+ *
+ * @return Entry, NULL if there is no such asset
+ */
+const asset_pack_entry_t *asset_pack_find(const char *name);
+
+/**
+ * @brief Data of an asset in a mapped flat image
+ *
+ * @note The data stays valid while the partition is mapped, aligned on CONFIG_ASSET_PACK_FLAT_ALIGN bytes. DMA can
+ *       not read it from the flash cache: copy it to internal RAM for that.
+ *
+ * @param name: Source name, e.g. "ok.mp3"
+ * @param entry: Output entry, with the size and format, may be NULL
+ *
+ * @return Data as stored, NULL if there is no such asset, it is run-length encoded or the assets are files
+ */
+const void *asset_pack_map(const char *name, const asset_pack_entry_t **entry);
+
+/**
+ * @brief Open any asset to read its data as stored
+ *
+ * @note Works on both a file system and a mapped flat image, where the stream reads the flash cache.
+ *
+ * @param name: Source name, e.g. "ok.mp3"
+ * @param entry: Output entry, may be NULL
+ *
+ * @return File positioned on the data, NULL if there is no such asset
+ */
+FILE *asset_pack_open(const char *name, const asset_pack_entry_t **entry);
+
+/**
+ * @brief Load an image, ready to be drawn by LVGL
+ *
+ * @note The pixels go to PSRAM when available, or are used in place from a mapped flat image when they are not
+ *       run-length encoded. Free them with `asset_pack_free(img->data)` in both cases.
+ *
+ * @param name: Source name, e.g. "logo.png"
+ * @param img: Output image descriptor
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NOT_FOUND: No such image
+ *    - ESP_ERR_NOT_SUPPORTED: The display does not use 16 bit colors
+ *    - ESP_ERR_NO_MEM: No memory for the pixels
+ *    - ESP_FAIL: Read failed or corrupted file
+ */
+esp_err_t asset_pack_image_load(const char *name, lv_img_dsc_t *img);
+
+/**
+ * @brief Load a whole prompt
+ *
+ * @note The samples go to PSRAM when available, or are used in place from a mapped flat image. Free them with
+ *       `asset_pack_free()` in both cases.
+ *
+ * @param name: Source name, e.g. "echo_en_wake.wav"
+ * @param data: Output samples
+ * @param entry: Output entry, with the sample format and size, may be NULL
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NOT_FOUND: No such prompt
+ *    - ESP_ERR_NO_MEM: No memory for the samples
+ *    - ESP_FAIL: Read failed
+ */
+esp_err_t asset_pack_pcm_load(const char *name, const uint8_t **data, const asset_pack_entry_t **entry);
+
+/**
+ * @brief Open a prompt to stream its samples
+ *
+ * @param name: Source name, e.g. "echo_en_wake.wav"
+ * @param entry: Output entry, with the sample format and size, may be NULL
+ *
+ * @return File positioned on the first sample, NULL if there is no such prompt
+ */
+FILE *asset_pack_pcm_open(const char *name, const asset_pack_entry_t **entry);
+
+/**
+ * @brief Free the data of a loaded asset, nothing to do for data in a mapped flat image
+ */
+void asset_pack_free(const void *data);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,94 @@
+# __asset_pack_convert_args
+#
+# Conversion options of asset_convert.py from the configuration
+function(__asset_pack_convert_args var)
+    set(convert_args)
+    if(CONFIG_LV_COLOR_16_SWAP)
+        list(APPEND convert_args --swap)
+    endif()
+    if(CONFIG_ASSET_PACK_IMAGE_RLE)
+        list(APPEND convert_args --rle)
+    endif()
+    if(CONFIG_ASSET_PACK_PCM_MONO)
+        list(APPEND convert_args --pcm-channels 1)
+    else()
+        list(APPEND convert_args --pcm-channels 2)
+    endif()
+    list(APPEND convert_args --pcm-rate ${CONFIG_ASSET_PACK_PCM_SAMPLE_RATE})
+
+    set(${var} ${convert_args} PARENT_SCOPE)
+endfunction()
+
+# asset_pack_create_partition_image
+#
+# Create a SPIFFS image like spiffs_create_partition_image(), from base_dir with its images and prompts converted
+# by asset_convert.py. The conversion runs at build time into the build directory, the sources stay untouched.
+function(asset_pack_create_partition_image partition base_dir)
+    set(options FLASH_IN_PROJECT)
+    set(multi DEPENDS)
+    cmake_parse_arguments(arg "${options}" "" "${multi}" "${ARGN}")
+
+    idf_build_get_property(python PYTHON)
+    idf_build_get_property(build_dir BUILD_DIR)
+    idf_build_get_property(asset_pack_dir __ASSET_PACK_DIR)
+    get_filename_component(base_dir_full_path ${base_dir} ABSOLUTE)
+    set(converted_dir ${build_dir}/asset_pack/${partition})
+
+    __asset_pack_convert_args(convert_args)
+    add_custom_target(asset_pack_${partition}
+        COMMAND ${python} ${asset_pack_dir}/asset_convert.py ${base_dir_full_path} ${converted_dir} ${convert_args}
+        COMMENT "Converting the assets of ${partition}"
+        VERBATIM)
+    if(arg_DEPENDS)
+        add_dependencies(asset_pack_${partition} ${arg_DEPENDS})
+    endif()
+
+    if(arg_FLASH_IN_PROJECT)
+        spiffs_create_partition_image(${partition} ${converted_dir} FLASH_IN_PROJECT DEPENDS asset_pack_${partition})
+    else()
+        spiffs_create_partition_image(${partition} ${converted_dir} DEPENDS asset_pack_${partition})
+    endif()
+endfunction()
+
+# asset_pack_create_flat_image
+#
+# Create a read-only image of base_dir, converted like asset_pack_create_partition_image(), for a data partition
+# mapped at runtime by asset_pack_init_partition(). The build fails if the image does not fit in the partition.
+function(asset_pack_create_flat_image partition base_dir)
+    set(options FLASH_IN_PROJECT)
+    set(multi DEPENDS)
+    cmake_parse_arguments(arg "${options}" "" "${multi}" "${ARGN}")
+
+    idf_build_get_property(python PYTHON)
+    idf_build_get_property(build_dir BUILD_DIR)
+    idf_build_get_property(asset_pack_dir __ASSET_PACK_DIR)
+    get_filename_component(base_dir_full_path ${base_dir} ABSOLUTE)
+    set(image_file ${build_dir}/${partition}.bin)
+
+    partition_table_get_partition_info(size "--partition-name ${partition}" "size")
+    partition_table_get_partition_info(offset "--partition-name ${partition}" "offset")
+    if(NOT "${size}" OR NOT "${offset}")
+        fail_at_build_time(asset_pack_${partition}_bin "Failed to create the asset image of partition '${partition}'. "
+                           "Check that the partition table has it.")
+        return()
+    endif()
+
+    __asset_pack_convert_args(convert_args)
+    list(APPEND convert_args --flat --align ${CONFIG_ASSET_PACK_FLAT_ALIGN} --partition-size ${size})
+
+    # Always rebuilt, like the SPIFFS images, as the sources are not tracked
+    add_custom_target(asset_pack_${partition}_bin ALL
+        COMMAND ${python} ${asset_pack_dir}/asset_convert.py ${base_dir_full_path} ${image_file} ${convert_args}
+        COMMENT "Creating the asset image of ${partition}"
+        VERBATIM)
+    set_property(DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}" APPEND PROPERTY ADDITIONAL_CLEAN_FILES ${image_file})
+    if(arg_DEPENDS)
+        add_dependencies(asset_pack_${partition}_bin ${arg_DEPENDS})
+    endif()
+
+    if(arg_FLASH_IN_PROJECT)
+        esptool_py_flash_to_partition(flash "${partition}" "${image_file}")
+    endif()
+endfunction()
+
+idf_build_set_property(__ASSET_PACK_DIR ${CMAKE_CURRENT_LIST_DIR})
@@ -0,0 +1,473 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define _GNU_SOURCE     /* fopencookie */
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+
+#include "mp3_info.h"
+#include "audio_playlist.h"
+
+#define PLAYLIST_PATH_MAX           (256)
+#define PLAYLIST_PRELOAD_SIZE       (4 * 1024)      /*!< First bytes of the next track, the switch reads no file */
+#define PLAYLIST_SWITCH_WAIT_MS     (100)           /*!< Wait at the end of a track for the next one being prepared */
+#define PLAYLIST_GAP_WINDOW_MS      (1000)          /*!< Output checked for starvation this long after a track change */
+#define PLAYLIST_TASK_STACK_SIZE    (4 * 1024)
+
+typedef enum {
+    NEXT_NONE,
+    NEXT_PREPARING,
+    NEXT_READY,
+    NEXT_DECLINED,                  /*!< No next track, or one which can not be chained */
+} next_state_t;
+
+typedef struct {
+    FILE *fp;
+    char path[PLAYLIST_PATH_MAX];
+    mp3_audio_range_t range;
+    uint32_t end;                   /*!< Stream data ends here, file offset */
+    uint32_t fpos;                  /*!< Position of fp */
+    uint8_t *preload;               /*!< Bytes from range.start on, read in advance */
+    size_t preload_len;
+} track_t;
+
+typedef struct {
+    track_t cur;
+    track_t next;
+    next_state_t next_state;
+    bool chain;                     /*!< The current track is an MP3, others may follow it */
+    off_t base;                     /*!< Stream offset of cur_file_base */
+    uint32_t cur_file_base;         /*!< File offset where the current track joined the stream */
+    off_t pos;                      /*!< Stream position */
+    FILE *retired;                  /*!< Finished track, closed by the playlist task */
+    bool closed;
+    bool ended;                     /*!< The reader reached the end of the last track */
+    int refs;
+} playlist_stream_t;
+
+typedef struct {
+    uint32_t rate;
+    uint32_t bits_cfg;
+    i2s_slot_mode_t ch;
+    uint32_t frame_bytes;
+    bool running;                   /*!< Playing continuously since the clock was set */
+    int64_t play_end_us;            /*!< When the written samples run out */
+    bool window;                    /*!< Measuring the gap of a track change */
+    uint32_t window_samples;        /*!< Samples left to write in the window */
+    int64_t starve_us;
+} playlist_output_t;
+
+static struct {
+    audio_playlist_config_t config;
+    SemaphoreHandle_t lock;
+    SemaphoreHandle_t ready_sem;    /*!< Given when a next track was prepared or declined */
+    TaskHandle_t task;
+    playlist_stream_t *active;
+    bool ended_at_eof;              /*!< The last stream played to its end, the next one is an automatic change */
+    playlist_output_t out;
+    audio_playlist_stats_t stats;
+} s_playlist;
+
+static const char *TAG = "audio_playlist";
+
+static void track_close(track_t *track)
+{
+    if (track->fp) {
+        fclose(track->fp);
+        track->fp = NULL;
+    }
+    free(track->preload);
+    track->preload = NULL;
+    track->preload_len = 0;
+}
+
+static void stream_free(playlist_stream_t *stream)
+{
+    track_close(&stream->cur);
+    track_close(&stream->next);
+    if (stream->retired) {
+        fclose(stream->retired);
+    }
+    free(stream);
+}
+
+static esp_err_t track_open(track_t *track, const char *path)
+{
+    struct stat st;
+
+    strlcpy(track->path, path, sizeof(track->path));
+    ESP_RETURN_ON_FALSE(0 == stat(path, &st), ESP_ERR_NOT_FOUND, TAG, "stat %s failed", path);
+    track->fp = s_playlist.config.open_fn ? s_playlist.config.open_fn(path) : fopen(path, "rb");
+    ESP_RETURN_ON_FALSE(track->fp, ESP_ERR_NOT_FOUND, TAG, "open %s failed", path);
+
+    esp_err_t ret = mp3_info_find_audio(track->fp, st.st_size, &track->range);
+    track->end = (ESP_OK == ret) ? track->range.end : st.st_size;
+    track->fpos = UINT32_MAX;
+    return ret;
+}
+
+static bool track_compatible(const mp3_audio_range_t *a, const mp3_audio_range_t *b)
+{
+    return (a->sample_rate_hz == b->sample_rate_hz) && (a->channels == b->channels) && (a->layer == b->layer) &&
+           (a->version == b->version);
+}
+
+/* Open the next track, find its frames and read their first bytes */
+static void playlist_prepare(playlist_stream_t *stream, const char *current, mp3_audio_range_t range)
+{
+    track_t next = {0};
+    char path[PLAYLIST_PATH_MAX];
+    bool ready = false;
+
+    if (s_playlist.config.next_cb && s_playlist.config.next_cb(current, path, sizeof(path), s_playlist.config.user_ctx)) {
+        if ((ESP_OK == track_open(&next, path)) && track_compatible(&range, &next.range)) {
+            next.preload = malloc(PLAYLIST_PRELOAD_SIZE);
+            if (next.preload && (0 == fseek(next.fp, next.range.start, SEEK_SET))) {
+                next.preload_len = fread(next.preload, 1, PLAYLIST_PRELOAD_SIZE, next.fp);
+                next.fpos = next.range.start + next.preload_len;
+                ready = (next.preload_len > 0);
+            }
+        } else if (next.fp) {
+            ESP_LOGI(TAG, "%s can not follow %s without a stop", path, current);
+        }
+    }
+
+    xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+    if (ready && !stream->closed) {
+        stream->next = next;
+        stream->next_state = NEXT_READY;
+    } else {
+        track_close(&next);
+        stream->next_state = NEXT_DECLINED;
+    }
+    xSemaphoreGive(s_playlist.ready_sem);
+    xSemaphoreGive(s_playlist.lock);
+}
+
+static void playlist_task(void *arg)
+{
+    char current[PLAYLIST_PATH_MAX];
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+        playlist_stream_t *stream = s_playlist.active;
+        if (!stream) {
+            xSemaphoreGive(s_playlist.lock);
+            continue;
+        }
+        stream->refs++;
+        FILE *retired = stream->retired;
+        stream->retired = NULL;
+        bool prepare = stream->chain && (NEXT_NONE == stream->next_state);
+        mp3_audio_range_t range = stream->cur.range;
+        if (prepare) {
+            stream->next_state = NEXT_PREPARING;
+            strlcpy(current, stream->cur.path, sizeof(current));
+        }
+        xSemaphoreGive(s_playlist.lock);
+
+        /* Closing a read stream waits for its block being read, not on the player task */
+        if (retired) {
+            fclose(retired);
+        }
+        if (prepare) {
+            playlist_prepare(stream, current, range);
+        }
+
+        xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+        bool last = (0 == --stream->refs);
+        xSemaphoreGive(s_playlist.lock);
+        if (last) {
+            stream_free(stream);
+        }
+    }
+}
+
+static void playlist_gap_window_open(void)
+{
+    /* Called with the lock held */
+    s_playlist.out.window = true;
+    s_playlist.out.window_samples = s_playlist.out.rate * PLAYLIST_GAP_WINDOW_MS / 1000;
+    s_playlist.out.starve_us = 0;
+}
+
+/* Move on to the next track at the end of the current one, on the player task */
+static bool playlist_switch(playlist_stream_t *stream)
+{
+    xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+    int64_t deadline = esp_timer_get_time() + PLAYLIST_SWITCH_WAIT_MS * 1000;
+    /* Not started yet only with a track shorter than the preparation */
+    while ((NEXT_NONE == stream->next_state) || (NEXT_PREPARING == stream->next_state)) {
+        int64_t left_us = deadline - esp_timer_get_time();
+        if (left_us <= 0) {
+            ESP_LOGW(TAG, "Next track not ready in time");
+            break;
+        }
+        xSemaphoreGive(s_playlist.lock);
+        xSemaphoreTake(s_playlist.ready_sem, pdMS_TO_TICKS(left_us / 1000) + 1);
+        xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+    }
+    if (NEXT_READY != stream->next_state) {
+        stream->ended = true;
+        xSemaphoreGive(s_playlist.lock);
+        return false;
+    }
+
+    if (stream->retired) {
+        /* Previous track not closed yet, only with tracks shorter than the preparation */
+        fclose(stream->retired);
+    }
+    stream->retired = stream->cur.fp;
+    stream->cur.fp = NULL;
+    track_close(&stream->cur);
+    stream->cur = stream->next;
+    memset(&stream->next, 0, sizeof(track_t));
+    stream->next_state = NEXT_NONE;
+    stream->base = stream->pos;
+    stream->cur_file_base = stream->cur.range.start;
+    s_playlist.stats.tracks++;
+    s_playlist.stats.gapless++;
+    playlist_gap_window_open();
+    xSemaphoreGive(s_playlist.lock);
+
+    ESP_LOGI(TAG, "Gapless into %s", stream->cur.path);
+    if (s_playlist.config.track_cb) {
+        s_playlist.config.track_cb(stream->cur.path, s_playlist.config.user_ctx);
+    }
+    /* After the callback, which usually moves the iterator used by next_cb */
+    xTaskNotifyGive(s_playlist.task);
+    return true;
+}
+
+static size_t track_read(track_t *track, uint32_t offset, char *buf, size_t size)
+{
+    if (track->preload && (offset >= track->range.start) && (offset < track->range.start + track->preload_len)) {
+        size_t n = track->range.start + track->preload_len - offset;
+        n = (n < size) ? n : size;
+        memcpy(buf, track->preload + (offset - track->range.start), n);
+        return n;
+    }
+    if ((offset != track->fpos) && (0 != fseek(track->fp, offset, SEEK_SET))) {
+        return 0;
+    }
+    size_t n = fread(buf, 1, size, track->fp);
+    track->fpos = offset + n;
+    return n;
+}
+
+static ssize_t playlist_cookie_read(void *cookie, char *buf, size_t size)
+{
+    playlist_stream_t *stream = (playlist_stream_t *)cookie;
+    size_t done = 0;
+
+    /* Only the player task reads and seeks, the current track is not shared */
+    while (done < size) {
+        uint32_t offset = stream->cur_file_base + (stream->pos - stream->base);
+        if (offset < stream->cur.end) {
+            size_t want = size - done;
+            want = (want < stream->cur.end - offset) ? want : stream->cur.end - offset;
+            size_t n = track_read(&stream->cur, offset, buf + done, want);
+            if (!n) {
+                break;
+            }
+            done += n;
+            stream->pos += n;
+            continue;
+        }
+        if (!stream->chain || !playlist_switch(stream)) {
+            break;
+        }
+    }
+    return done;
+}
+
+static int playlist_cookie_seek(void *cookie, off_t *offset, int whence)
+{
+    playlist_stream_t *stream = (playlist_stream_t *)cookie;
+    off_t pos = *offset;
+
+    if (SEEK_CUR == whence) {
+        pos += stream->pos;
+    } else if (SEEK_SET != whence) {
+        return -1;
+    }
+    /* Only inside the current track */
+    if ((pos < stream->base) || (stream->cur_file_base + (pos - stream->base) > stream->cur.end)) {
+        return -1;
+    }
+    stream->pos = pos;
+    *offset = pos;
+    return 0;
+}
+
+static int playlist_cookie_close(void *cookie)
+{
+    playlist_stream_t *stream = (playlist_stream_t *)cookie;
+
+    xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+    stream->closed = true;
+    if (s_playlist.active == stream) {
+        s_playlist.active = NULL;
+        s_playlist.ended_at_eof = stream->ended;
+    }
+    bool last = (0 == --stream->refs);
+    xSemaphoreGive(s_playlist.lock);
+    if (last) {
+        stream_free(stream);
+    }
+    return 0;
+}
+
+esp_err_t audio_playlist_init(const audio_playlist_config_t *config)
+{
+    esp_err_t ret = ESP_OK;
+
+    ESP_RETURN_ON_FALSE(config && config->write_fn && config->clk_set_fn, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!s_playlist.lock, ESP_ERR_INVALID_STATE, TAG, "already initialized");
+
+    s_playlist.config = *config;
+    s_playlist.lock = xSemaphoreCreateMutex();
+    s_playlist.ready_sem = xSemaphoreCreateBinary();
+    ESP_GOTO_ON_FALSE(s_playlist.lock && s_playlist.ready_sem, ESP_ERR_NO_MEM, err, TAG, "no mem for playlist");
+    ESP_GOTO_ON_FALSE(pdPASS == xTaskCreatePinnedToCore(playlist_task, "Playlist", PLAYLIST_TASK_STACK_SIZE, NULL,
+                                                        config->task_priority, &s_playlist.task, config->task_core),
+                      ESP_ERR_NO_MEM, err, TAG, "create playlist task failed");
+    return ESP_OK;
+
+err:
+    if (s_playlist.ready_sem) {
+        vSemaphoreDelete(s_playlist.ready_sem);
+        s_playlist.ready_sem = NULL;
+    }
+    if (s_playlist.lock) {
+        vSemaphoreDelete(s_playlist.lock);
+        s_playlist.lock = NULL;
+    }
+    return ret;
+}
+
+FILE *audio_playlist_open(const char *path)
+{
+    const cookie_io_functions_t functions = {
+        .read = playlist_cookie_read,
+        .write = NULL,
+        .seek = playlist_cookie_seek,
+        .close = playlist_cookie_close,
+    };
+
+    ESP_RETURN_ON_FALSE(path && s_playlist.lock, NULL, TAG, "invalid state or argument");
+    playlist_stream_t *stream = calloc(1, sizeof(playlist_stream_t));
+    ESP_RETURN_ON_FALSE(stream, NULL, TAG, "no mem for stream");
+
+    esp_err_t ret = track_open(&stream->cur, path);
+    if (!stream->cur.fp) {
+        free(stream);
+        return NULL;
+    }
+    /* The first track is played whole, the player reads its tags */
+    stream->chain = (ESP_OK == ret);
+    stream->refs = 1;
+    FILE *fp = fopencookie(stream, "rb", functions);
+    if (!fp) {
+        ESP_LOGE(TAG, "fopencookie failed");
+        track_close(&stream->cur);
+        free(stream);
+        return NULL;
+    }
+
+    xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+    s_playlist.active = stream;
+    s_playlist.stats.tracks++;
+    if (s_playlist.ended_at_eof) {
+        /* Started from the idle event of the previous track */
+        playlist_gap_window_open();
+    } else {
+        s_playlist.out.running = false;
+        s_playlist.out.window = false;
+    }
+    s_playlist.ended_at_eof = false;
+    xSemaphoreGive(s_playlist.lock);
+    xTaskNotifyGive(s_playlist.task);
+    return fp;
+}
+
+esp_err_t audio_playlist_write(void *audio_buffer, size_t len, size_t *bytes_written, uint32_t timeout_ms)
+{
+    playlist_output_t *out = &s_playlist.out;
+    int64_t now = esp_timer_get_time();
+
+    /* The output plays continuously, it starves if a write starts after the previous data ran out */
+    if (out->frame_bytes && out->rate) {
+        uint32_t samples = len / out->frame_bytes;
+        xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+        if (out->window && out->running && (now > out->play_end_us)) {
+            out->starve_us += now - out->play_end_us;
+        }
+        out->play_end_us = ((out->play_end_us > now) ? out->play_end_us : now) + (int64_t)samples * 1000000 / out->rate;
+        out->running = true;
+        if (out->window) {
+            out->window_samples = (out->window_samples > samples) ? out->window_samples - samples : 0;
+            if (!out->window_samples) {
+                out->window = false;
+                s_playlist.stats.last_gap_samples = out->starve_us * out->rate / 1000000;
+                if (s_playlist.stats.last_gap_samples > s_playlist.stats.max_gap_samples) {
+                    s_playlist.stats.max_gap_samples = s_playlist.stats.last_gap_samples;
+                }
+                ESP_LOGI(TAG, "Track change gap %"PRIu32" samples", s_playlist.stats.last_gap_samples);
+            }
+        }
+        xSemaphoreGive(s_playlist.lock);
+    }
+    return s_playlist.config.write_fn(audio_buffer, len, bytes_written, timeout_ms);
+}
+
+esp_err_t audio_playlist_clk_set(uint32_t rate, uint32_t bits_cfg, i2s_slot_mode_t ch)
+{
+    playlist_output_t *out = &s_playlist.out;
+    int64_t now = esp_timer_get_time();
+
+    xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+    bool same = out->running && (rate == out->rate) && (bits_cfg == out->bits_cfg) && (ch == out->ch);
+    if (same) {
+        s_playlist.stats.skipped_reclocks++;
+    } else {
+        s_playlist.stats.reclocks++;
+        out->rate = rate;
+        out->bits_cfg = bits_cfg;
+        out->ch = ch;
+        out->frame_bytes = bits_cfg / 8 * ((I2S_SLOT_MODE_STEREO == ch) ? 2 : 1);
+        /* Reconfiguring the output drops what it buffered, it is silent from now on */
+        if (out->window && out->running && (now > out->play_end_us)) {
+            out->starve_us += now - out->play_end_us;
+        }
+        out->play_end_us = now;
+    }
+    xSemaphoreGive(s_playlist.lock);
+
+    return same ? ESP_OK : s_playlist.config.clk_set_fn(rate, bits_cfg, ch);
+}
+
+esp_err_t audio_playlist_get_stats(audio_playlist_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(s_playlist.lock, ESP_ERR_INVALID_STATE, TAG, "not initialized");
+
+    xSemaphoreTake(s_playlist.lock, portMAX_DELAY);
+    *stats = s_playlist.stats;
+    xSemaphoreGive(s_playlist.lock);
+    return ESP_OK;
+}
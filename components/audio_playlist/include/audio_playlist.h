@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "esp_err.h"
+#include "driver/i2s_std.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gapless playlist for `audio_player`
+ *
+ * `audio_playlist_open` returns a FILE for `audio_player_play` which continues into the next track at the end of the
+ * current one. While a track plays, a background task asks for the next one, opens it, finds its audio frames and
+ * reads their first bytes. If its format matches (MP3 with the same sample rate and channels), the stream goes on with
+ * the frames of the next track: the player keeps decoding, the output is neither stopped nor re-clocked. Otherwise the
+ * stream ends as before, the player goes idle and the application starts the next track itself.
+ *
+ * The write and clock functions of the player go through the playlist, which measures the output starvation at each
+ * automatic track change.
+ */
+
+/**
+ * @brief Write function of the output, same as `audio_player_write_fn`
+ */
+typedef esp_err_t (*audio_playlist_write_fn_t)(void *audio_buffer, size_t len, size_t *bytes_written, uint32_t timeout_ms);
+
+/**
+ * @brief Clock function of the output, same as `audio_reconfig_std_clock`
+ */
+typedef esp_err_t (*audio_playlist_clk_set_fn_t)(uint32_t rate, uint32_t bits_cfg, i2s_slot_mode_t ch);
+
+/**
+ * @brief Get the track after the current one, called from the playlist task
+ *
+ * @param current: Path of the current track
+ * @param next: Output path of the next track
+ * @param size: Size of next
+ * @param user_ctx: User context
+ *
+ * @return true if there is a next track
+ */
+typedef bool (*audio_playlist_next_cb_t)(const char *current, char *next, size_t size, void *user_ctx);
+
+/**
+ * @brief The stream moved on to the next track, called from the player task
+ *
+ * @param path: Path of the new track
+ * @param user_ctx: User context
+ */
+typedef void (*audio_playlist_track_cb_t)(const char *path, void *user_ctx);
+
+typedef struct {
+    audio_playlist_write_fn_t write_fn;         /*!< Output write, e.g. `bsp_i2s_write` */
+    audio_playlist_clk_set_fn_t clk_set_fn;     /*!< Output clock, e.g. `bsp_codec_set_fs` */
+    FILE *(*open_fn)(const char *path);         /*!< Open a track for reading, NULL for fopen */
+    audio_playlist_next_cb_t next_cb;           /*!< Next track, NULL to play single tracks */
+    audio_playlist_track_cb_t track_cb;         /*!< Track changed inside the stream, may be NULL */
+    void *user_ctx;                             /*!< User context of the callbacks */
+    int task_priority;                          /*!< Priority of the task preparing the next track */
+    int task_core;                              /*!< Core of the task, tskNO_AFFINITY for any */
+} audio_playlist_config_t;
+
+typedef struct {
+    uint32_t tracks;                /*!< Tracks started */
+    uint32_t gapless;               /*!< Tracks chained inside the stream */
+    uint32_t reclocks;              /*!< Output clock changes passed to clk_set_fn */
+    uint32_t skipped_reclocks;      /*!< Clock requests with the current format while the output was running */
+    uint32_t last_gap_samples;      /*!< Output starvation around the last automatic track change, in samples */
+    uint32_t max_gap_samples;       /*!< Largest gap so far */
+} audio_playlist_stats_t;
+
+/**
+ * @brief Initialize the playlist and start its task
+ *
+ * Pass `audio_playlist_write` and `audio_playlist_clk_set` to `audio_player_new` as write_fn and clk_set_fn.
+ *
+ * @param config: Playlist configuration
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Already initialized
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t audio_playlist_init(const audio_playlist_config_t *config);
+
+/**
+ * @brief Open a track as a stream which continues into the next ones, for `audio_player_play`
+ *
+ * The stream is closed by the player with fclose.
+ *
+ * @param path: Path of the first track
+ *
+ * @return FILE pointer, NULL on failure
+ */
+FILE *audio_playlist_open(const char *path);
+
+/**
+ * @brief write_fn of `audio_player_config_t`
+ */
+esp_err_t audio_playlist_write(void *audio_buffer, size_t len, size_t *bytes_written, uint32_t timeout_ms);
+
+/**
+ * @brief clk_set_fn of `audio_player_config_t`, keeps the clock if the format did not change during playback
+ */
+esp_err_t audio_playlist_clk_set(uint32_t rate, uint32_t bits_cfg, i2s_slot_mode_t ch);
+
+/**
+ * @brief Get the playlist statistics
+ *
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Not initialized
+ */
+esp_err_t audio_playlist_get_stats(audio_playlist_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
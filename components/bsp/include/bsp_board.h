@@ -7,13 +7,19 @@
 #pragma once
 
 #include <stdbool.h>
+#include "sdkconfig.h"
 #include "esp_err.h"
+#if CONFIG_IDF_TARGET_LINUX
+#include "bsp_linux.h"
+#else
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "driver/i2s_std.h"
 
 #include "bsp/esp-bsp.h"
 #include "iot_button.h"
+#endif
+#include "bsp_i2c_service.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -135,6 +141,28 @@ typedef bottom_id_t (*bsp_sys_get_bottom_id)();
  */
 typedef esp_err_t (*bsp_bottom_get_humiture)(float *temperature, float *humidity);
 
+/**
+ * @brief Sensor bottom monitor statistics, collected over one hour
+ */
+typedef struct {
+    uint32_t wakeups;           /*!< Number of times the monitor task woke up */
+    uint32_t radar_events;      /*!< Number of radar output level changes */
+    uint32_t i2c_transactions;  /*!< Number of transactions on the expand I2C bus */
+    uint32_t i2c_busy_us;       /*!< Time spent in transactions on the expand I2C bus, in microseconds */
+} bsp_bottom_monitor_stats_t;
+
+/**
+ * @brief Get monitor statistics of the last complete hour
+ *
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_NOT_FOUND: no complete hour yet
+ *    - ESP_ERR_NOT_SUPPORTED: no sensor bottom
+ */
+typedef esp_err_t (*bsp_bottom_get_monitor_stats)(bsp_bottom_monitor_stats_t *stats);
+
 /**
  * @brief Player set mute.
  *
@@ -224,6 +252,7 @@ typedef struct {
     bsp_bottom_set_radar_enable set_radar_enable;
     bsp_bottom_get_radar_status get_radar_status;
     bsp_bottom_get_humiture get_humiture;
+    bsp_bottom_get_monitor_stats get_monitor_stats;
 } bsp_bottom_property_t;
 
 typedef struct {
@@ -261,6 +290,15 @@ const board_res_desc_t *bsp_board_get_description(void);
  */
 bsp_bottom_property_t *bsp_board_get_sensor_handle(void);
 
+/**
+ * @brief Get the transaction service of the sensor bottom I2C bus
+ *
+ * @return
+ *    - service handle: sensor bottom connected at power on
+ *    - NULL: no sensor bottom
+ */
+bsp_i2c_service_handle_t bsp_i2c_expand_get_service(void);
+
 /**
  * @brief Call default button init code
  *
@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "bsp/esp-bsp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    BSP_DISPLAY_PROFILE_SINGLE_DMA,     /*!< One internal DMA buffer, LVGL waits for every flush */
+    BSP_DISPLAY_PROFILE_DOUBLE_DMA,     /*!< Two internal DMA buffers, the next stripe is rendered during the flush */
+    BSP_DISPLAY_PROFILE_PSRAM_FULL,     /*!< One full frame buffer in PSRAM, only the dirty areas are flushed */
+    BSP_DISPLAY_PROFILE_MAX,
+} bsp_display_profile_t;
+
+typedef struct {
+    bsp_display_profile_t profile;      /*!< Buffer layout */
+    uint16_t buf_lines;                 /*!< Lines of each DMA buffer, ignored by BSP_DISPLAY_PROFILE_PSRAM_FULL */
+} bsp_display_profile_config_t;
+
+/**
+ * @brief Profile selected in menuconfig
+ */
+#if CONFIG_BSP_DISPLAY_PROFILE_DOUBLE_DMA
+#define BSP_DISPLAY_PROFILE_CONFIG_DEFAULT() {          \
+        .profile = BSP_DISPLAY_PROFILE_DOUBLE_DMA,      \
+        .buf_lines = CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,    \
+    }
+#elif CONFIG_BSP_DISPLAY_PROFILE_PSRAM_FULL
+#define BSP_DISPLAY_PROFILE_CONFIG_DEFAULT() {          \
+        .profile = BSP_DISPLAY_PROFILE_PSRAM_FULL,      \
+        .buf_lines = BSP_LCD_V_RES,                     \
+    }
+#else
+#define BSP_DISPLAY_PROFILE_CONFIG_DEFAULT() {          \
+        .profile = BSP_DISPLAY_PROFILE_SINGLE_DMA,      \
+        .buf_lines = CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,    \
+    }
+#endif
+
+typedef struct {
+    uint32_t frames;            /*!< Refreshes completed */
+    uint32_t flushes;           /*!< Areas sent to the panel */
+    uint64_t pixels;            /*!< Pixels sent to the panel */
+    uint64_t refresh_us;        /*!< Time spent rendering and flushing, summed over the refreshes */
+    uint64_t stall_us;          /*!< Time LVGL waited for a previous flush to complete */
+    uint64_t elapsed_us;        /*!< Time since the statistics were attached or reset */
+} bsp_display_stats_t;
+
+/**
+ * @brief Fill the draw buffer fields of a display configuration from a profile
+ *
+ * @note The other fields of the configuration, such as lvgl_port_cfg, are left untouched.
+ *
+ * @param profile: Profile to apply, NULL for the one selected in menuconfig
+ * @param cfg: Display configuration passed to bsp_display_start_with_config()
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NOT_SUPPORTED: PSRAM profile without PSRAM
+ */
+esp_err_t bsp_display_profile_apply(const bsp_display_profile_config_t *profile, bsp_display_cfg_t *cfg);
+
+/**
+ * @brief Name of a profile, for logs
+ */
+const char *bsp_display_profile_name(bsp_display_profile_t profile);
+
+/**
+ * @brief Start collecting refresh and flush statistics of a display
+ *
+ * @note Only one display can be measured at a time. Monitor and wait callbacks already set on the display keep being
+ *       called. Call with the display lock held.
+ *
+ * @param disp: Display returned by bsp_display_start_with_config()
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Another display is measured
+ */
+esp_err_t bsp_display_stats_attach(lv_disp_t *disp);
+
+/**
+ * @brief Get the statistics of the measured display, and optionally start over
+ *
+ * @note Call with the display lock held.
+ *
+ * @param stats: Output statistics
+ * @param reset: Clear the statistics once read
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: No display is measured
+ */
+esp_err_t bsp_display_stats_get(bsp_display_stats_t *stats, bool reset);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,208 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Use as `addr` of `bsp_i2c_service_get_stats` to get the statistics of the whole bus
+ */
+#define BSP_I2C_SERVICE_ALL_DEVICES     (0xFF)
+
+/**
+ * @brief Maximum number of devices with their own bus occupancy statistics
+ */
+#define BSP_I2C_SERVICE_MAX_DEVICES     (8)
+
+typedef struct bsp_i2c_service *bsp_i2c_service_handle_t;
+
+typedef enum {
+    BSP_I2C_PRIO_LOW,   /*!< Background transactions, e.g. periodic sensor sampling */
+    BSP_I2C_PRIO_HIGH,  /*!< Served before any queued low priority transaction */
+    BSP_I2C_PRIO_MAX,
+} bsp_i2c_priority_t;
+
+/**
+ * @brief Transaction completion callback
+ *
+ * @note Called from the service task. It must not block and must not wait for another transaction.
+ *
+ * @param err: ESP_OK on success, ESP_ERR_TIMEOUT if the deadline passed, others on bus error or NACK
+ * @param busy_us: Time the bus was occupied by this transaction
+ * @param user_ctx: User context of the transaction
+ */
+typedef void (*bsp_i2c_done_cb_t)(esp_err_t err, uint32_t busy_us, void *user_ctx);
+
+/**
+ * @brief Function run by the service task with the bus to itself
+ *
+ * For drivers which only talk to the bus through their own calls, e.g. a vendor driver configuring its sensor.
+ *
+ * @param bus_ctx: Backend context from `bsp_i2c_service_config_t`
+ * @param user_ctx: User context of the transaction
+ *
+ * @return Result passed to the completion callback
+ */
+typedef esp_err_t (*bsp_i2c_exec_cb_t)(void *bus_ctx, void *user_ctx);
+
+/**
+ * @brief I2C transaction
+ *
+ * Depending on the fields set, the transaction is:
+ * - a probe: no data, only checks the device acknowledges its address
+ * - a write: `write_buf` only
+ * - a read: `read_buf` only
+ * - a write then read with repeated start, e.g. register read: `write_buf` and `read_buf`
+ * - a batched register read: `regs`, then `read_buf[i]` receives register `regs[i]`. All registers are read in
+ *   one bus transaction using repeated starts.
+ * - a driver call: `exec`, run in turn with the other transactions. Its bus time is the time it runs.
+ *
+ * @note The buffers are not copied, they must stay valid until the completion callback is called.
+ */
+typedef struct {
+    uint8_t addr;                   /*!< Device address, already shifted left with the R/W bit clear */
+    const uint8_t *write_buf;       /*!< Data to write */
+    size_t write_size;              /*!< Size of write_buf */
+    uint8_t *read_buf;              /*!< Buffer for the data read */
+    size_t read_size;               /*!< Size of read_buf, must be `reg_count` for batched register reads */
+    const uint8_t *regs;            /*!< Registers of a batched register read, NULL otherwise */
+    size_t reg_count;               /*!< Number of registers in `regs` */
+    bsp_i2c_exec_cb_t exec;         /*!< Driver call instead of a transfer, NULL otherwise */
+    bsp_i2c_priority_t priority;    /*!< Transaction priority */
+    uint32_t timeout_ms;            /*!< Time from submit to completion, 0 for the service default */
+    bsp_i2c_done_cb_t done_cb;      /*!< Completion callback, may be NULL */
+    void *user_ctx;                 /*!< User context passed to done_cb */
+} bsp_i2c_trans_t;
+
+/**
+ * @brief Bus backend of the service
+ */
+typedef struct {
+    /**
+     * @brief Execute one transaction on the bus
+     *
+     * @param bus_ctx: Backend context from `bsp_i2c_service_config_t`
+     * @param trans: Transaction to execute
+     * @param timeout: Maximum time for the transfer
+     * @param busy_us: Output time the bus was occupied
+     *
+     * @return
+     *    - ESP_OK: Success
+     *    - Others: Bus error, NACK or timeout
+     */
+    esp_err_t (*transfer)(void *bus_ctx, const bsp_i2c_trans_t *trans, TickType_t timeout, uint32_t *busy_us);
+} bsp_i2c_bus_ops_t;
+
+typedef struct {
+    const bsp_i2c_bus_ops_t *ops;   /*!< Bus backend */
+    void *bus_ctx;                  /*!< Backend context */
+    const char *name;               /*!< Name of the service task */
+    size_t queue_depth;             /*!< Number of queued transactions per priority */
+    uint32_t default_timeout_ms;    /*!< Timeout of transactions without their own */
+    UBaseType_t task_priority;      /*!< Priority of the service task */
+    BaseType_t task_core_id;        /*!< Core of the service task */
+} bsp_i2c_service_config_t;
+
+typedef struct {
+    uint8_t addr;               /*!< Device address, BSP_I2C_SERVICE_ALL_DEVICES for the whole bus */
+    uint32_t transactions;      /*!< Number of executed transactions */
+    uint32_t errors;            /*!< Number of transactions which failed on the bus */
+    uint32_t timeouts;          /*!< Number of transactions which expired in the queue */
+    uint64_t busy_us;           /*!< Time the bus was occupied */
+    uint64_t elapsed_us;        /*!< Time since the service was created */
+} bsp_i2c_device_stats_t;
+
+/**
+ * @brief Legacy I2C driver backend, bus_ctx is the i2c_port_t cast to a pointer
+ */
+extern const bsp_i2c_bus_ops_t bsp_i2c_legacy_bus_ops;
+
+/**
+ * @brief Create an I2C service for one bus
+ *
+ * @param config: Service configuration
+ * @param ret_handle: Output service handle
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid configuration
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t bsp_i2c_service_new(const bsp_i2c_service_config_t *config, bsp_i2c_service_handle_t *ret_handle);
+
+/**
+ * @brief Delete an I2C service
+ *
+ * @note Queued transactions complete with ESP_ERR_INVALID_STATE.
+ *
+ * @param handle: Service handle
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid handle
+ */
+esp_err_t bsp_i2c_service_del(bsp_i2c_service_handle_t handle);
+
+/**
+ * @brief Queue a transaction without waiting for it
+ *
+ * @param handle: Service handle
+ * @param trans: Transaction, copied into the queue
+ *
+ * @return
+ *    - ESP_OK: Queued, done_cb will be called
+ *    - ESP_ERR_INVALID_ARG: Invalid transaction
+ *    - ESP_ERR_NO_MEM: Queue of this priority is full
+ */
+esp_err_t bsp_i2c_service_submit(bsp_i2c_service_handle_t handle, const bsp_i2c_trans_t *trans);
+
+/**
+ * @brief Queue a transaction and wait for its completion
+ *
+ * @note done_cb and user_ctx of the transaction are ignored.
+ *
+ * @param handle: Service handle
+ * @param trans: Transaction
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_TIMEOUT: Deadline passed
+ *    - Others: Fail
+ */
+esp_err_t bsp_i2c_service_transfer(bsp_i2c_service_handle_t handle, const bsp_i2c_trans_t *trans);
+
+/**
+ * @brief Get bus occupancy statistics of a device
+ *
+ * @param handle: Service handle
+ * @param addr: Device address, or BSP_I2C_SERVICE_ALL_DEVICES
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NOT_FOUND: No transaction to this device yet
+ */
+esp_err_t bsp_i2c_service_get_stats(bsp_i2c_service_handle_t handle, uint8_t addr, bsp_i2c_device_stats_t *stats);
+
+/**
+ * @brief Log bus occupancy of every device
+ *
+ * @param handle: Service handle
+ */
+void bsp_i2c_service_print_stats(bsp_i2c_service_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
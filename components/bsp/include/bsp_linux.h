@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Linux host backend of the BSP
+ *
+ * Microphones read a WAV file or raw PCM from a file or a named pipe, the speaker writes a WAV file or raw PCM, both
+ * paced at the sample rate. Buttons and the sensor bottom follow a script, and the SD card is a directory. Paths come
+ * from the "Linux Host Configuration" menu, or the environment variables of the same name: BSP_LINUX_MIC,
+ * BSP_LINUX_SPEAKER, BSP_LINUX_SCRIPT, BSP_LINUX_SDCARD and BSP_LINUX_REALTIME.
+ *
+ * Script lines are "<ms since bsp_board_init> <event> <arguments>", in time order:
+ *     500 button main click            press_down, press_up, single_click, double_click, long_press_start,
+ *                                      long_press_up, or click for press_down, press_up and single_click
+ *     800 radar 1                      radar output level
+ *     800 humiture 25.5 40             temperature and humidity
+ *     900 sleep 1                      sleep mode
+ *     900 bottom lost                  sensor, unknown or lost
+ *     5000 exit 0                      close the audio files and exit the process
+ */
+
+typedef int gpio_num_t;
+
+#define GPIO_NUM_NC             (-1)
+#define GPIO_NUM_21             (21)
+#define GPIO_NUM_38             (38)
+#define GPIO_NUM_39             (39)
+#define GPIO_NUM_40             (40)
+#define GPIO_NUM_41             (41)
+#define GPIO_NUM_44             (44)
+
+typedef enum {
+    I2S_SLOT_MODE_MONO = 1,
+    I2S_SLOT_MODE_STEREO = 2,
+} i2s_slot_mode_t;
+
+typedef enum {
+    BSP_BUTTON_CONFIG = 0,
+    BSP_BUTTON_MUTE,
+    BSP_BUTTON_MAIN,
+    BSP_BUTTON_NUM,
+} bsp_button_t;
+
+typedef enum {
+    BUTTON_PRESS_DOWN = 0,
+    BUTTON_PRESS_UP,
+    BUTTON_PRESS_REPEAT,
+    BUTTON_PRESS_REPEAT_DONE,
+    BUTTON_SINGLE_CLICK,
+    BUTTON_DOUBLE_CLICK,
+    BUTTON_MULTIPLE_CLICK,
+    BUTTON_LONG_PRESS_START,
+    BUTTON_LONG_PRESS_HOLD,
+    BUTTON_LONG_PRESS_UP,
+    BUTTON_EVENT_MAX,
+    BUTTON_NONE_PRESS,
+} button_event_t;
+
+typedef void (*button_cb_t)(void *button_handle, void *usr_data);
+
+typedef struct {
+    uint64_t bytes;             /*!< Bytes transferred */
+    uint32_t calls;             /*!< Calls of bsp_i2s_read or bsp_i2s_write */
+    uint32_t overruns;          /*!< Calls late enough that the device would have lost mic samples or left a gap in the speaker */
+    uint32_t max_late_us;       /*!< Latest call compared to the sample clock */
+    bool eof;                   /*!< The microphone input ended, silence follows */
+} bsp_linux_audio_stats_t;
+
+/**
+ * @brief Get the statistics of the microphone or the speaker stream
+ *
+ * @param speaker: Speaker stream, else the microphone one
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ */
+esp_err_t bsp_linux_get_audio_stats(bool speaker, bsp_linux_audio_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of dependencies of one hook
+ */
+#define BSP_POWER_MAX_DEPS      (4)
+
+typedef struct bsp_power_hook *bsp_power_hook_handle_t;
+
+/**
+ * @brief Suspend or resume callback of a subsystem
+ *
+ * @param user_ctx: User context of the hook
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - Others: Fail
+ */
+typedef esp_err_t (*bsp_power_cb_t)(void *user_ctx);
+
+typedef enum {
+    BSP_POWER_MILESTONE_NONE,           /*!< Resuming this hook is not a user visible milestone */
+    BSP_POWER_MILESTONE_FIRST_FRAME,    /*!< The screen shows a frame once this hook resumed */
+    BSP_POWER_MILESTONE_AUDIO_READY,    /*!< Audio can be played and recorded once this hook resumed */
+    BSP_POWER_MILESTONE_MAX,
+} bsp_power_milestone_t;
+
+typedef struct {
+    const char *name;                                   /*!< Hook name, for logs */
+    bsp_power_cb_t suspend;                             /*!< Suspend callback, may be NULL */
+    bsp_power_cb_t resume;                              /*!< Resume callback, may be NULL */
+    void *user_ctx;                                     /*!< User context passed to the callbacks */
+    bsp_power_hook_handle_t depends_on[BSP_POWER_MAX_DEPS]; /*!< Hooks resumed before and suspended after this one */
+    bsp_power_milestone_t milestone;                    /*!< Milestone reached when this hook resumed */
+} bsp_power_hook_config_t;
+
+typedef struct {
+    uint32_t wakes;                                     /*!< Number of resumes */
+    uint32_t last_us[BSP_POWER_MILESTONE_MAX];          /*!< Latency of each milestone of the last resume */
+    uint32_t max_us[BSP_POWER_MILESTONE_MAX];           /*!< Worst latency of each milestone */
+    uint32_t last_total_us;                             /*!< Time until every hook resumed in the last resume */
+} bsp_power_wake_stats_t;
+
+/**
+ * @brief Register the suspend and resume hooks of a subsystem
+ *
+ * @note Dependencies must be registered first, so registration order is always a valid resume order.
+ *
+ * @param config: Hook configuration
+ * @param ret_hook: Output hook handle, may be NULL
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument or dependency not registered
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t bsp_power_register_hook(const bsp_power_hook_config_t *config, bsp_power_hook_handle_t *ret_hook);
+
+/**
+ * @brief Suspend every subsystem, dependents before their dependencies
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - Others: First error returned by a hook, the remaining hooks are still suspended
+ */
+esp_err_t bsp_power_suspend(void);
+
+/**
+ * @brief Resume every subsystem
+ *
+ * Hooks whose dependencies have resumed run in parallel on the power worker tasks. Returns once every hook resumed.
+ *
+ * @param wake_time_us: esp_timer time of the wake up event, milestone latencies are measured from it.
+ *                      0 to measure from the call.
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - Others: First error returned by a hook, the remaining hooks are still resumed
+ */
+esp_err_t bsp_power_resume(int64_t wake_time_us);
+
+/**
+ * @brief Get wake latency statistics
+ *
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: No hook registered
+ */
+esp_err_t bsp_power_get_wake_stats(bsp_power_wake_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
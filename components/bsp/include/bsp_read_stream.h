@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Read-ahead file stream
+ *
+ * One storage task prefetches large blocks of every open stream into a ring of buffers, by default in PSRAM.
+ * Each turn it reads a single block for the stream with the fewest buffered blocks, so a long sequential reader can
+ * not starve the others, and other file system users (e.g. a recorder writing) get the card between two blocks.
+ */
+typedef struct bsp_read_stream *bsp_read_stream_handle_t;
+
+typedef struct {
+    size_t block_size;          /*!< Size of each read, a multiple of 512. Larger blocks mean fewer card commands */
+    size_t block_num;           /*!< Number of blocks buffered ahead, at least 2 */
+    uint32_t caps;              /*!< Heap capabilities of the blocks */
+} bsp_read_stream_config_t;
+
+typedef struct {
+    uint64_t bytes_read;        /*!< Bytes returned to the reader */
+    uint32_t blocks_fetched;    /*!< Blocks read from the file system */
+    uint32_t blocks_dropped;    /*!< Prefetched blocks discarded by a seek */
+    uint32_t fetch_us;          /*!< Time spent reading blocks */
+    uint32_t stall_us;          /*!< Time the reader waited for data */
+} bsp_read_stream_stats_t;
+
+/**
+ * @brief Default read stream configuration, 3 blocks of 32 KB in PSRAM
+ */
+#define BSP_READ_STREAM_CONFIG_DEFAULT()        \
+    {                                           \
+        .block_size = 32 * 1024,                \
+        .block_num = 3,                         \
+        .caps = MALLOC_CAP_SPIRAM,              \
+    }
+
+/**
+ * @brief Open a file for reading through a read-ahead stream
+ *
+ * @param path File path
+ * @param config Stream configuration, NULL for `BSP_READ_STREAM_CONFIG_DEFAULT`
+ * @param ret_stream Output stream handle
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NOT_FOUND: File can not be opened
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t bsp_read_stream_open(const char *path, const bsp_read_stream_config_t *config,
+                               bsp_read_stream_handle_t *ret_stream);
+
+/**
+ * @brief Read from a stream, blocks until the data was prefetched
+ *
+ * @param stream Stream handle
+ * @param buf Output buffer
+ * @param size Number of bytes to read
+ * @return Number of bytes read, less than size at the end of the file or on a read error
+ */
+size_t bsp_read_stream_read(bsp_read_stream_handle_t stream, void *buf, size_t size);
+
+/**
+ * @brief Move the read position, prefetched blocks are kept if the position stays inside them
+ *
+ * @param stream Stream handle
+ * @param offset Offset
+ * @param whence SEEK_SET, SEEK_CUR or SEEK_END
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument or position
+ */
+esp_err_t bsp_read_stream_seek(bsp_read_stream_handle_t stream, off_t offset, int whence);
+
+/**
+ * @brief Get the read position
+ *
+ * @param stream Stream handle
+ * @return Read position
+ */
+off_t bsp_read_stream_tell(bsp_read_stream_handle_t stream);
+
+/**
+ * @brief Get the statistics of a stream
+ *
+ * @param stream Stream handle
+ * @param stats Output statistics
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ */
+esp_err_t bsp_read_stream_get_stats(bsp_read_stream_handle_t stream, bsp_read_stream_stats_t *stats);
+
+/**
+ * @brief Close a stream, waits for its block being read if any
+ *
+ * @param stream Stream handle
+ */
+void bsp_read_stream_close(bsp_read_stream_handle_t stream);
+
+/**
+ * @brief Open a read stream as a stdio FILE, e.g. for `audio_player_play`
+ *
+ * The stream is closed by `fclose`.
+ *
+ * @param path File path
+ * @param config Stream configuration, NULL for `BSP_READ_STREAM_CONFIG_DEFAULT`
+ * @return FILE pointer, NULL on failure
+ */
+FILE *bsp_read_stream_fopen(const char *path, const bsp_read_stream_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "esp_err.h"
 
@@ -13,6 +15,46 @@
 extern "C" {
 #endif
 
+typedef enum {
+    BSP_SDCARD_SPEED_DEFAULT,       /*!< Default speed, 20 MHz */
+    BSP_SDCARD_SPEED_HIGH,          /*!< High speed, 40 MHz SDR. SDMMC only, SDSPI stays at default speed */
+    BSP_SDCARD_SPEED_DDR,           /*!< High speed, and DDR if the card supports it (eMMC). SD cards run high speed SDR */
+} bsp_sdcard_speed_t;
+
+typedef struct {
+    const char *mount_point;        /*!< Path where partition should be registered (e.g. "/sdcard") */
+    size_t max_files;               /*!< Maximum number of files which can be open at the same time */
+    size_t allocation_unit_size;    /*!< Cluster size used if the card is formatted */
+    bsp_sdcard_speed_t speed;       /*!< Bus speed */
+    bool format_if_mount_failed;    /*!< Format the card if it can not be mounted */
+} bsp_sdcard_config_t;
+
+/**
+ * @brief Default SD card configuration, room for playback, recording and a read stream at the same time
+ */
+#define BSP_SDCARD_CONFIG_DEFAULT()             \
+    {                                           \
+        .mount_point = "/sdcard",               \
+        .max_files = 5,                         \
+        .allocation_unit_size = 16 * 1024,      \
+        .speed = BSP_SDCARD_SPEED_DEFAULT,      \
+        .format_if_mount_failed = false,        \
+    }
+
+/**
+ * @brief Init SD card
+ *
+ * @param config SD card configuration
+ * @return
+ *    - ESP_OK                  Success
+ *    - ESP_ERR_INVALID_ARG     Invalid configuration
+ *    - ESP_ERR_INVALID_STATE   If esp_vfs_fat_register was already called
+ *    - ESP_ERR_NOT_SUPPORTED   If dev board not has SDMMC/SDSPI
+ *    - ESP_ERR_NO_MEM          If not enough memory or too many VFSes already registered
+ *    - Others                  Fail
+ */
+esp_err_t bsp_sdcard_init_with_config(const bsp_sdcard_config_t *config);
+
 /**
  * @brief Init SD crad
  *
@@ -58,6 +100,32 @@ esp_err_t bsp_sdcard_deinit(char *mount_point);
  */
 esp_err_t bsp_sdcard_deinit_default(void);
 
+/**
+ * @brief Run the storage throughput benchmark in a directory
+ *
+ * Writes a test file, then measures sequential reads with stdio, sequential reads through a read stream, and random
+ * 4 KB reads. The test file is deleted afterwards.
+ *
+ * @param dir Directory on the file system to test (e.g. "/sdcard")
+ * @param file_size Size of the test file in bytes
+ * @param block_size Size of each sequential read and write
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NO_MEM: Out of memory
+ *    - ESP_FAIL: File system error
+ */
+esp_err_t bsp_storage_bench_run(const char *dir, size_t file_size, size_t block_size);
+
+/**
+ * @brief Register the `sdbench` console command, which runs `bsp_storage_bench_run`
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - Others: Fail
+ */
+esp_err_t bsp_storage_bench_register_cmd(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,6 +16,23 @@ extern "C" {
  */
 esp_err_t bsp_sensor_init(bsp_bottom_property_t *handle);
 
+#if CONFIG_IDF_TARGET_LINUX
+/**
+ * @brief Option of the Linux host backend, its environment variable or else its configured value
+ */
+const char *bsp_linux_get_option(const char *name, const char *config_value);
+
+/**
+ * @brief Open the microphone and speaker streams of the Linux host backend
+ */
+esp_err_t bsp_linux_audio_init(void);
+
+/**
+ * @brief Complete and close the audio files of the Linux host backend
+ */
+void bsp_linux_audio_close(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
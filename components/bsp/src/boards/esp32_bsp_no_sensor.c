@@ -35,6 +35,16 @@ static esp_err_t bsp_sensor_get_humiture(float *temperature, float *humidity)
     return ESP_FAIL;
 }
 
+static esp_err_t bsp_sensor_get_monitor_stats(bsp_bottom_monitor_stats_t *stats)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+bsp_i2c_service_handle_t bsp_i2c_expand_get_service(void)
+{
+    return NULL;
+}
+
 esp_err_t bsp_sensor_init(bsp_bottom_property_t *handle)
 {
     ESP_LOGW(TAG, "This example don't support Sensor!!");
@@ -44,6 +54,7 @@ esp_err_t bsp_sensor_init(bsp_bottom_property_t *handle)
     handle->get_radar_status = bsp_sensor_get_radar_status;
     handle->set_radar_enable = bsp_sensor_set_radar_enable;
     handle->get_humiture = bsp_sensor_get_humiture;
+    handle->get_monitor_stats = bsp_sensor_get_monitor_stats;
 
     return ESP_ERR_NOT_SUPPORTED;
 }
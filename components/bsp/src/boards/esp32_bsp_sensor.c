@@ -4,28 +4,89 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <inttypes.h>
+#include <string.h>
 #include "esp_log.h"
 #include "esp_check.h"
 #include "esp_pm.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
 
 #include "bsp_board.h"
-#include "aht20.h"
+#include "bsp_i2c_service.h"
+#include "bsp_power.h"
 #include "at581x.h"
 
 #define BSP_I2C_EXPAND_NUM              ((1 == BSP_I2C_NUM) ? (0):(1))
 #define BSP_I2C_EXPAND_CLK_SPEED_HZ     CONFIG_BSP_I2C_CLK_SPEED_HZ
+#define BSP_I2C_EXPAND_TIMEOUT_MS       (100)
+#define BSP_I2C_EXPAND_QUEUE_DEPTH      (8)
 
 #define RADAE_POWER_DELAY               (60 * 2) // 2min
-#define RADAE_FUNC_STOP                 (RADAE_POWER_DELAY + 1)
+
+#define BOTTOM_PROBE_PERIOD_MS          (5 * 1000)
+#define HUMITURE_PERIOD_MS              (2 * 1000)
+#define HUMITURE_SLEEP_PERIOD_MS        (30 * 1000)
+#define HUMITURE_CONVERSION_MS          (80)
+#define HUMITURE_CALIBRATION_MS         (10)
+#define HUMITURE_BUSY_RETRY_MS          (10)
+#define HUMITURE_BUSY_RETRY_MAX         (3)
+#define MONITOR_STATS_PERIOD            (60 * 60 * configTICK_RATE_HZ) // 1h
+
+#define AHT20_ADDR                      (0x38 << 1)
+#define AHT20_CMD_CALIBRATE             (0xBE)
+#define AHT20_CMD_MEASURE               (0xAC)
+#define AHT20_STATUS_BUSY               (0x80)
+#define AHT20_STATUS_CALIBRATED         (0x08)
+
+#define MONITOR_EVENT_RADAR             BIT(0)
+#define MONITOR_EVENT_CONFIG            BIT(1)
+#define MONITOR_EVENT_HUMITURE          BIT(2)
+#define MONITOR_EVENT_PROBE             BIT(3)
+
+typedef enum {
+    HUMITURE_CHECK,         /*!< status to be read, to calibrate the sensor if it is not */
+    HUMITURE_CALIBRATE,     /*!< calibration to be sent */
+    HUMITURE_IDLE,          /*!< waiting for the next measurement */
+    HUMITURE_CONVERTING,    /*!< measurement triggered, waiting for the conversion to finish */
+} humiture_state_t;
+
+typedef struct {
+    uint32_t event;         /*!< Monitor event set on completion */
+    bool pending;           /*!< Submitted and not completed yet */
+    esp_err_t err;          /*!< Result of the last completed transaction */
+} monitor_request_t;
 
 static bool sys_sleep_entered = false;
 static bottom_id_t sys_bottom_id;
 
 static float sys_temp_result;
 static float sys_RH_result;
-static uint16_t power_off_delay;
-
-static aht20_dev_handle_t aht20 = NULL;
+static bool sys_humiture_valid;
+
+static bool radar_enabled = true;
+static bool radar_presence_valid;
+static TickType_t radar_presence_tick;
+static int radar_level;
+static volatile int64_t radar_isr_time_us;
+
+static humiture_state_t humiture_state = HUMITURE_CHECK;
+static TickType_t humiture_deadline;
+static uint8_t humiture_busy_retry;
+static uint8_t humiture_data[6];
+static TickType_t bottom_seen_tick;
+
+static monitor_request_t humiture_request = {.event = MONITOR_EVENT_HUMITURE};
+static monitor_request_t probe_request = {.event = MONITOR_EVENT_PROBE};
+
+static bsp_bottom_monitor_stats_t monitor_stats;
+static bsp_bottom_monitor_stats_t monitor_stats_last;
+static bool monitor_stats_last_valid;
+static bsp_i2c_device_stats_t monitor_i2c_prev;
+static portMUX_TYPE monitor_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static TaskHandle_t monitor_task_handle = NULL;
+static bsp_i2c_service_handle_t i2c_expand_service = NULL;
 static esp_pm_lock_handle_t g_pm_apb_lock = NULL;
 static esp_pm_lock_handle_t g_pm_light_lock = NULL;
 static esp_pm_lock_handle_t g_pm_cpu_lock = NULL;
@@ -36,7 +97,17 @@ static esp_err_t bsp_pm_init();
 static esp_err_t bsp_pm_exit_sleep();
 static esp_err_t bsp_pm_enter_sleep();
 
-static bool bsp_i2c_device_probe(i2c_port_t i2c_num, uint8_t addr);
+static bool bsp_i2c_device_probe(uint8_t addr);
+
+static bool bsp_tick_reached(TickType_t now, TickType_t deadline)
+{
+    return (int32_t)(now - deadline) >= 0;
+}
+
+static TickType_t bsp_tick_min(TickType_t a, TickType_t b)
+{
+    return ((int32_t)(a - b) < 0) ? a : b;
+}
 
 static bool bsp_get_sleep_mode()
 {
@@ -50,8 +121,8 @@ static bottom_id_t bsp_get_bottom_id()
 
 static bool bsp_sensor_get_radar_status()
 {
-    if (BOTTOM_ID_SENSOR == sys_bottom_id) {
-        return ((power_off_delay > RADAE_POWER_DELAY / 2) ? (true) : (false));
+    if ((BOTTOM_ID_SENSOR == sys_bottom_id) && radar_enabled && radar_presence_valid) {
+        return (xTaskGetTickCount() - radar_presence_tick) < pdMS_TO_TICKS(RADAE_POWER_DELAY * 1000 / 2);
     } else {
         return false;
     }
@@ -59,16 +130,18 @@ static bool bsp_sensor_get_radar_status()
 
 static void bsp_sensor_set_radar_onoff(bool enable)
 {
-    if (enable) {
-        power_off_delay = RADAE_POWER_DELAY;
-    } else {
-        power_off_delay = RADAE_FUNC_STOP;
+    radar_presence_tick = xTaskGetTickCount();
+    radar_presence_valid = enable;
+    radar_enabled = enable;
+
+    if (monitor_task_handle) {
+        xTaskNotify(monitor_task_handle, MONITOR_EVENT_CONFIG, eSetBits);
     }
 }
 
 static esp_err_t bsp_sensor_get_humiture(float *temperature, float *humidity)
 {
-    if (BOTTOM_ID_SENSOR == sys_bottom_id) {
+    if ((BOTTOM_ID_SENSOR == sys_bottom_id) && sys_humiture_valid) {
         *temperature = sys_temp_result;
         *humidity = sys_RH_result;
         return ESP_OK;
@@ -77,102 +150,483 @@ static esp_err_t bsp_sensor_get_humiture(float *temperature, float *humidity)
     }
 }
 
-static void low_power_monitor_task(void *arg)
+static esp_err_t bsp_sensor_get_monitor_stats(bsp_bottom_monitor_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    portENTER_CRITICAL(&monitor_stats_lock);
+    if (monitor_stats_last_valid) {
+        *stats = monitor_stats_last;
+        ret = ESP_OK;
+    }
+    portEXIT_CRITICAL(&monitor_stats_lock);
+    return ret;
+}
+
+static void bsp_sensor_stats_publish(void)
+{
+    bsp_i2c_device_stats_t i2c_stats;
+
+    if (ESP_OK == bsp_i2c_service_get_stats(i2c_expand_service, BSP_I2C_SERVICE_ALL_DEVICES, &i2c_stats)) {
+        monitor_stats.i2c_transactions = i2c_stats.transactions - monitor_i2c_prev.transactions;
+        monitor_stats.i2c_busy_us = (uint32_t)(i2c_stats.busy_us - monitor_i2c_prev.busy_us);
+        monitor_i2c_prev = i2c_stats;
+    }
+
+    portENTER_CRITICAL(&monitor_stats_lock);
+    monitor_stats_last = monitor_stats;
+    monitor_stats_last_valid = true;
+    portEXIT_CRITICAL(&monitor_stats_lock);
+
+    ESP_LOGI(TAG, "Last hour: %"PRIu32" wakeups, %"PRIu32" radar events, %"PRIu32" I2C transactions, I2C busy %"PRIu32" us",
+             monitor_stats_last.wakeups, monitor_stats_last.radar_events,
+             monitor_stats_last.i2c_transactions, monitor_stats_last.i2c_busy_us);
+    memset(&monitor_stats, 0, sizeof(monitor_stats));
+    bsp_i2c_service_print_stats(i2c_expand_service);
+}
+
+static void bsp_radar_isr_handler(void *arg)
 {
-    static uint8_t gpio_level_prev = 1;
-    uint32_t temp_raw, RH_raw;
-    uint8_t gpio_level;
+    BaseType_t task_woken = pdFALSE;
+
+    /* Level triggered, the monitor task re-arms it for the opposite level */
+    gpio_intr_disable(BSP_RADAR_OUT_IO);
+    radar_isr_time_us = esp_timer_get_time();
+    xTaskNotifyFromISR(monitor_task_handle, MONITOR_EVENT_RADAR, eSetBits, &task_woken);
+    if (task_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
 
+static void bsp_radar_arm(int level)
+{
+    /* The level interrupt is also a light sleep wakeup source */
+    gpio_wakeup_enable(BSP_RADAR_OUT_IO, level ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+    gpio_intr_enable(BSP_RADAR_OUT_IO);
+}
+
+static esp_err_t bsp_radar_intr_init(void)
+{
     gpio_config_t io_conf = {};
-    io_conf.intr_type = GPIO_INTR_POSEDGE;
+    io_conf.intr_type = GPIO_INTR_DISABLE;
     io_conf.pin_bit_mask = (1ULL << BSP_RADAR_OUT_IO);
     io_conf.mode = GPIO_MODE_INPUT;
     io_conf.pull_up_en = 1;
-    gpio_config(&io_conf);
-    vTaskDelay(pdMS_TO_TICKS(1500));
+    ESP_RETURN_ON_ERROR(gpio_config(&io_conf), TAG, "config radar gpio failed");
 
-    while (1) {
-        vTaskDelay(pdMS_TO_TICKS(1000));
+    /* The ISR service may already be installed by another driver */
+    esp_err_t ret = gpio_install_isr_service(0);
+    ESP_RETURN_ON_FALSE((ESP_OK == ret) || (ESP_ERR_INVALID_STATE == ret), ret, TAG, "install gpio isr service failed");
+    ESP_RETURN_ON_ERROR(gpio_isr_handler_add(BSP_RADAR_OUT_IO, bsp_radar_isr_handler, NULL),
+                        TAG, "add radar isr failed");
+    ESP_RETURN_ON_ERROR(esp_sleep_enable_gpio_wakeup(), TAG, "enable gpio wakeup failed");
 
-        if (sys_bottom_id != BOTTOM_ID_UNKNOW) {
-            sys_bottom_id = (bsp_i2c_device_probe(BSP_I2C_EXPAND_NUM, AT581X_ADDRRES_0)) ? BOTTOM_ID_SENSOR : BOTTOM_ID_LOST;
-        }
+    radar_level = gpio_get_level(BSP_RADAR_OUT_IO);
+    bsp_radar_arm(radar_level);
+    return ESP_OK;
+}
 
-        if (BOTTOM_ID_SENSOR == sys_bottom_id) {
-            gpio_level = gpio_get_level(BSP_RADAR_OUT_IO);
-            if ((RADAE_FUNC_STOP != power_off_delay) && power_off_delay) {
-                power_off_delay--;
-            }
-            aht20_read_temperature_humidity(aht20, &temp_raw, &sys_temp_result, &RH_raw, &sys_RH_result);
-        } else {
-            gpio_level = 1;
-        }
+static esp_err_t bsp_sensor_pm_suspend(void *user_ctx)
+{
+    return bsp_pm_enter_sleep();
+}
 
-        if (gpio_level_prev ^ gpio_level) {
-            gpio_level_prev = gpio_level;
-            if (gpio_level && (RADAE_FUNC_STOP != power_off_delay)) {
-                power_off_delay = RADAE_POWER_DELAY;
-                ESP_LOGD(TAG, "Radar: %s", "active");
-            }
-        }
+static esp_err_t bsp_sensor_pm_resume(void *user_ctx)
+{
+    return bsp_pm_exit_sleep();
+}
 
-        if ((gpio_level) && (true == sys_sleep_entered)) {
-            bsp_pm_exit_sleep();
-
-            ESP_LOGD(TAG, "power on");
-            bsp_display_exit_sleep();
-
-            lvgl_port_resume();
-            iot_button_resume();
-            bsp_codec_dev_resume();
-            sys_sleep_entered = false;
-        } else if ((1 == power_off_delay) && (BOTTOM_ID_SENSOR == sys_bottom_id)) {
-            ESP_LOGD(TAG, "power off");
-            sys_sleep_entered = true;
-            bsp_display_enter_sleep();
-
-            lvgl_port_stop();
-            iot_button_stop();
-            bsp_codec_dev_stop();
-            bsp_pm_enter_sleep();
-        }
+static esp_err_t bsp_sensor_display_suspend(void *user_ctx)
+{
+    return bsp_display_enter_sleep();
+}
+
+static esp_err_t bsp_sensor_display_resume(void *user_ctx)
+{
+    return bsp_display_exit_sleep();
+}
+
+static esp_err_t bsp_sensor_lvgl_suspend(void *user_ctx)
+{
+    return lvgl_port_stop();
+}
+
+static esp_err_t bsp_sensor_lvgl_resume(void *user_ctx)
+{
+    ESP_RETURN_ON_ERROR(lvgl_port_resume(), TAG, "resume lvgl failed");
+
+    /* Render what changed during sleep now instead of at the next LVGL timer period */
+    if (lvgl_port_lock(0)) {
+        lv_refr_now(NULL);
+        lvgl_port_unlock();
     }
+    return ESP_OK;
 }
 
-static esp_err_t bsp_init_temp_humudity()
+static esp_err_t bsp_sensor_button_suspend(void *user_ctx)
 {
-    esp_err_t ret = ESP_OK;
+    return iot_button_stop();
+}
+
+static esp_err_t bsp_sensor_button_resume(void *user_ctx)
+{
+    return iot_button_resume();
+}
 
-    aht20_i2c_config_t i2c_conf = {
-        .i2c_port = BSP_I2C_EXPAND_NUM,
-        .i2c_addr = AHT20_ADDRRES_0,
+static esp_err_t bsp_sensor_codec_suspend(void *user_ctx)
+{
+    return bsp_codec_dev_stop();
+}
+
+static esp_err_t bsp_sensor_codec_resume(void *user_ctx)
+{
+    return bsp_codec_dev_resume();
+}
+
+static esp_err_t bsp_sensor_power_init(void)
+{
+    bsp_power_hook_handle_t pm_hook = NULL;
+    bsp_power_hook_handle_t display_hook = NULL;
+
+    const bsp_power_hook_config_t pm_conf = {
+        .name = "pm",
+        .suspend = bsp_sensor_pm_suspend,
+        .resume = bsp_sensor_pm_resume,
+    };
+    ESP_RETURN_ON_ERROR(bsp_power_register_hook(&pm_conf, &pm_hook), TAG, "register pm hook failed");
+
+    const bsp_power_hook_config_t display_conf = {
+        .name = "display",
+        .suspend = bsp_sensor_display_suspend,
+        .resume = bsp_sensor_display_resume,
+        .depends_on = {pm_hook},
     };
+    ESP_RETURN_ON_ERROR(bsp_power_register_hook(&display_conf, &display_hook), TAG, "register display hook failed");
+
+    const bsp_power_hook_config_t lvgl_conf = {
+        .name = "lvgl",
+        .suspend = bsp_sensor_lvgl_suspend,
+        .resume = bsp_sensor_lvgl_resume,
+        .depends_on = {display_hook},
+        .milestone = BSP_POWER_MILESTONE_FIRST_FRAME,
+    };
+    ESP_RETURN_ON_ERROR(bsp_power_register_hook(&lvgl_conf, NULL), TAG, "register lvgl hook failed");
 
-    ret |= aht20_new_sensor(&i2c_conf, &aht20);
-    if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "Temp & humidity init ok");
+    const bsp_power_hook_config_t button_conf = {
+        .name = "button",
+        .suspend = bsp_sensor_button_suspend,
+        .resume = bsp_sensor_button_resume,
+        .depends_on = {pm_hook},
+    };
+    ESP_RETURN_ON_ERROR(bsp_power_register_hook(&button_conf, NULL), TAG, "register button hook failed");
+
+    const bsp_power_hook_config_t codec_conf = {
+        .name = "codec",
+        .suspend = bsp_sensor_codec_suspend,
+        .resume = bsp_sensor_codec_resume,
+        .depends_on = {pm_hook},
+        .milestone = BSP_POWER_MILESTONE_AUDIO_READY,
+    };
+    ESP_RETURN_ON_ERROR(bsp_power_register_hook(&codec_conf, NULL), TAG, "register codec hook failed");
+
+    return ESP_OK;
+}
+
+static void bsp_sensor_enter_sleep(void)
+{
+    ESP_LOGD(TAG, "power off");
+    sys_sleep_entered = true;
+    bsp_power_suspend();
+}
+
+static void bsp_sensor_exit_sleep(void)
+{
+    ESP_LOGD(TAG, "power on");
+
+    /* Measure from the radar interrupt when it is what woke us up */
+    bsp_power_resume(radar_level ? radar_isr_time_us : 0);
+    sys_sleep_entered = false;
+}
+
+static void bsp_bottom_mark_seen(TickType_t now)
+{
+    bottom_seen_tick = now;
+    if (BOTTOM_ID_SENSOR != sys_bottom_id) {
+        ESP_LOGW(TAG, "Sensor bottom connected");
+        sys_bottom_id = BOTTOM_ID_SENSOR;
+        humiture_state = HUMITURE_CHECK;
+        humiture_deadline = now;
+    }
+}
+
+static void bsp_bottom_mark_lost(void)
+{
+    if (BOTTOM_ID_SENSOR == sys_bottom_id) {
+        ESP_LOGW(TAG, "Sensor bottom lost");
+        sys_bottom_id = BOTTOM_ID_LOST;
+        sys_humiture_valid = false;
     }
+}
+
+static void bsp_monitor_i2c_done(esp_err_t err, uint32_t busy_us, void *user_ctx)
+{
+    monitor_request_t *request = (monitor_request_t *)user_ctx;
+
+    request->err = err;
+    xTaskNotify(monitor_task_handle, request->event, eSetBits);
+}
+
+static esp_err_t bsp_monitor_i2c_submit(monitor_request_t *request, bsp_i2c_trans_t *trans)
+{
+    trans->timeout_ms = BSP_I2C_EXPAND_TIMEOUT_MS;
+    trans->done_cb = bsp_monitor_i2c_done;
+    trans->user_ctx = request;
+
+    esp_err_t ret = bsp_i2c_service_submit(i2c_expand_service, trans);
+    request->pending = (ESP_OK == ret);
     return ret;
 }
 
-static esp_err_t bsp_init_radar()
+static void bsp_bottom_probe_soon(TickType_t now)
+{
+    bottom_seen_tick = now - pdMS_TO_TICKS(BOTTOM_PROBE_PERIOD_MS);
+}
+
+/**
+ * @brief Bottom presence check
+ *
+ * Every acknowledged transaction to the bottom proves it is connected, so the address probe only runs when the
+ * bus has been quiet for BOTTOM_PROBE_PERIOD_MS or a transaction failed.
+ */
+static void bsp_bottom_probe(TickType_t now)
+{
+    bsp_i2c_trans_t trans = {
+        .addr = AT581X_ADDRRES_0,
+        .priority = BSP_I2C_PRIO_HIGH,
+    };
+
+    if (ESP_OK != bsp_monitor_i2c_submit(&probe_request, &trans)) {
+        bottom_seen_tick = now;
+    }
+}
+
+static void bsp_bottom_probe_done(TickType_t now)
+{
+    if (ESP_OK == probe_request.err) {
+        bsp_bottom_mark_seen(now);
+    } else {
+        bsp_bottom_mark_lost();
+        bottom_seen_tick = now;
+    }
+}
+
+static void bsp_humiture_process(TickType_t now)
+{
+    static const uint8_t calibrate_cmd[] = {AHT20_CMD_CALIBRATE, 0x08, 0x00};
+    static const uint8_t measure_cmd[] = {AHT20_CMD_MEASURE, 0x33, 0x00};
+    bsp_i2c_trans_t trans = {
+        .addr = AHT20_ADDR,
+        .priority = BSP_I2C_PRIO_LOW,
+    };
+
+    switch (humiture_state) {
+    case HUMITURE_CHECK:
+        trans.read_buf = humiture_data;
+        trans.read_size = 1;
+        break;
+    case HUMITURE_CALIBRATE:
+        trans.write_buf = calibrate_cmd;
+        trans.write_size = sizeof(calibrate_cmd);
+        break;
+    case HUMITURE_IDLE:
+        trans.write_buf = measure_cmd;
+        trans.write_size = sizeof(measure_cmd);
+        break;
+    case HUMITURE_CONVERTING:
+        trans.read_buf = humiture_data;
+        trans.read_size = sizeof(humiture_data);
+        break;
+    }
+    if (ESP_OK != bsp_monitor_i2c_submit(&humiture_request, &trans)) {
+        humiture_deadline = now + pdMS_TO_TICKS(HUMITURE_PERIOD_MS);
+    }
+}
+
+static void bsp_humiture_done(TickType_t now)
+{
+    const uint8_t *data = humiture_data;
+
+    if (ESP_OK != humiture_request.err) {
+        bsp_bottom_probe_soon(now);
+        humiture_state = HUMITURE_CHECK;
+        humiture_deadline = now + pdMS_TO_TICKS(HUMITURE_PERIOD_MS);
+        return;
+    }
+    bsp_bottom_mark_seen(now);
+
+    switch (humiture_state) {
+    case HUMITURE_CHECK:
+        humiture_state = (data[0] & AHT20_STATUS_CALIBRATED) ? HUMITURE_IDLE : HUMITURE_CALIBRATE;
+        humiture_deadline = now;
+        break;
+    case HUMITURE_CALIBRATE:
+        humiture_state = HUMITURE_IDLE;
+        humiture_deadline = now + pdMS_TO_TICKS(HUMITURE_CALIBRATION_MS);
+        break;
+    case HUMITURE_IDLE:
+        /* Measurement triggered */
+        humiture_busy_retry = 0;
+        humiture_state = HUMITURE_CONVERTING;
+        humiture_deadline = now + pdMS_TO_TICKS(HUMITURE_CONVERSION_MS);
+        break;
+    case HUMITURE_CONVERTING:
+        if ((data[0] & AHT20_STATUS_BUSY) && (humiture_busy_retry++ < HUMITURE_BUSY_RETRY_MAX)) {
+            humiture_deadline = now + pdMS_TO_TICKS(HUMITURE_BUSY_RETRY_MS);
+            break;
+        } else if (!(data[0] & AHT20_STATUS_BUSY)) {
+            uint32_t RH_raw = ((uint32_t)data[1] << 12) | ((uint32_t)data[2] << 4) | (data[3] >> 4);
+            uint32_t temp_raw = (((uint32_t)data[3] & 0x0F) << 16) | ((uint32_t)data[4] << 8) | data[5];
+            sys_RH_result = (float)RH_raw * 100 / (1 << 20);
+            sys_temp_result = (float)temp_raw * 200 / (1 << 20) - 50;
+            sys_humiture_valid = true;
+        }
+        humiture_state = HUMITURE_IDLE;
+        humiture_deadline = now + pdMS_TO_TICKS(sys_sleep_entered ? HUMITURE_SLEEP_PERIOD_MS : HUMITURE_PERIOD_MS);
+        break;
+    }
+}
+
+static void bsp_radar_process(TickType_t now)
+{
+    monitor_stats.radar_events++;
+    radar_level = gpio_get_level(BSP_RADAR_OUT_IO);
+    bsp_radar_arm(radar_level);
+
+    if (radar_level && radar_enabled) {
+        radar_presence_tick = now;
+        radar_presence_valid = true;
+        ESP_LOGD(TAG, "Radar: %s", "active");
+    }
+}
+
+static TickType_t bsp_monitor_next_deadline(TickType_t now, TickType_t stats_deadline)
+{
+    TickType_t deadline = stats_deadline;
+
+    if (!probe_request.pending) {
+        deadline = bsp_tick_min(deadline, bottom_seen_tick + pdMS_TO_TICKS(BOTTOM_PROBE_PERIOD_MS));
+    }
+    if (BOTTOM_ID_SENSOR == sys_bottom_id) {
+        if (!humiture_request.pending) {
+            deadline = bsp_tick_min(deadline, humiture_deadline);
+        }
+        if (radar_enabled && radar_presence_valid && !sys_sleep_entered) {
+            deadline = bsp_tick_min(deadline, radar_presence_tick + pdMS_TO_TICKS(RADAE_POWER_DELAY * 1000));
+        }
+    }
+
+    return bsp_tick_reached(now, deadline) ? 0 : (deadline - now);
+}
+
+static void low_power_monitor_task(void *arg)
+{
+    uint32_t events;
+    TickType_t now = xTaskGetTickCount();
+    TickType_t stats_deadline = now + MONITOR_STATS_PERIOD;
+
+    bottom_seen_tick = now;
+    humiture_deadline = now;
+    if (ESP_OK != bsp_radar_intr_init()) {
+        ESP_LOGE(TAG, "Radar interrupt init failed");
+    }
+
+    while (1) {
+        events = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &events, bsp_monitor_next_deadline(now, stats_deadline));
+        now = xTaskGetTickCount();
+        monitor_stats.wakeups++;
+
+        if (events & MONITOR_EVENT_RADAR) {
+            bsp_radar_process(now);
+        }
+
+        if (events & MONITOR_EVENT_HUMITURE) {
+            humiture_request.pending = false;
+            bsp_humiture_done(now);
+        }
+
+        if (events & MONITOR_EVENT_PROBE) {
+            probe_request.pending = false;
+            bsp_bottom_probe_done(now);
+        }
+
+        if ((BOTTOM_ID_SENSOR == sys_bottom_id) && !humiture_request.pending &&
+                bsp_tick_reached(now, humiture_deadline)) {
+            bsp_humiture_process(now);
+        }
+
+        if (!probe_request.pending && bsp_tick_reached(now, bottom_seen_tick + pdMS_TO_TICKS(BOTTOM_PROBE_PERIOD_MS))) {
+            bsp_bottom_probe(now);
+        }
+
+        if (true == sys_sleep_entered) {
+            if (radar_level || !radar_enabled || (BOTTOM_ID_SENSOR != sys_bottom_id)) {
+                bsp_sensor_exit_sleep();
+            }
+        } else if ((BOTTOM_ID_SENSOR == sys_bottom_id) && radar_enabled && radar_presence_valid &&
+                   bsp_tick_reached(now, radar_presence_tick + pdMS_TO_TICKS(RADAE_POWER_DELAY * 1000))) {
+            if (radar_level) {
+                /* Still somebody in front of the radar */
+                radar_presence_tick = now;
+            } else {
+                bsp_sensor_enter_sleep();
+            }
+        }
+
+        if (bsp_tick_reached(now, stats_deadline)) {
+            stats_deadline += MONITOR_STATS_PERIOD;
+            bsp_sensor_stats_publish();
+        }
+    }
+}
+
+static esp_err_t bsp_radar_init_exec(void *bus_ctx, void *user_ctx)
 {
-    esp_err_t ret = ESP_OK;
     at581x_dev_handle_t at581x = NULL;
 
     at581x_default_cfg_t def_cfg = ATH581X_INITIALIZATION_CONFIG();
 
     at581x_i2c_config_t i2c_conf = {
-        .i2c_port = BSP_I2C_EXPAND_NUM,
+        .i2c_port = (i2c_port_t)(intptr_t)bus_ctx,
         .i2c_addr = AT581X_ADDRRES_0,
         .def_conf = &def_cfg,
     };
 
-    ret |= at581x_new_sensor(&i2c_conf, &at581x);
-    if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "Radar init ok");
+    /* The driver writes the configuration through the legacy driver, while the service task holds the bus */
+    return at581x_new_sensor(&i2c_conf, &at581x);
+}
+
+static void bsp_radar_init_done(esp_err_t err, uint32_t busy_us, void *user_ctx)
+{
+    if (ESP_OK == err) {
+        ESP_LOGI(TAG, "Radar init ok, bus busy %"PRIu32" us", busy_us);
+    } else {
+        ESP_LOGE(TAG, "Radar init failed: %s", esp_err_to_name(err));
     }
-    return ret;
+}
+
+/* The humiture sensor needs no init here, the monitor calibrates it if its status asks for it */
+static esp_err_t bsp_init_radar()
+{
+    bsp_i2c_trans_t trans = {
+        .addr = AT581X_ADDRRES_0,
+        .exec = bsp_radar_init_exec,
+        .priority = BSP_I2C_PRIO_HIGH,
+        .timeout_ms = BSP_I2C_EXPAND_TIMEOUT_MS,
+        .done_cb = bsp_radar_init_done,
+    };
+    return bsp_i2c_service_submit(i2c_expand_service, &trans);
 }
 
 static esp_err_t bsp_pm_exit_sleep()
@@ -223,24 +677,17 @@ static esp_err_t bsp_pm_init()
                             TAG, "create l_cpu pm lock failed");
     }
     bsp_pm_exit_sleep();
-
-    ret = xTaskCreatePinnedToCore(&low_power_monitor_task, "Lowpower Task", 4 * 1024, NULL, 5, NULL, 1);
-    ESP_RETURN_ON_ERROR(pdPASS != ret, TAG,  "create Lowpower task failed");
     return ret;
 }
 
-static bool bsp_i2c_device_probe(i2c_port_t i2c_num, uint8_t addr)
+static bool bsp_i2c_device_probe(uint8_t addr)
 {
-    bool probe_result = false;
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, addr | I2C_MASTER_WRITE, true);
-    i2c_master_stop(cmd);
-    if (i2c_master_cmd_begin(i2c_num, cmd, 2000) == ESP_OK) {
-        probe_result = true;
-    }
-    i2c_cmd_link_delete(cmd);
-    return probe_result;
+    bsp_i2c_trans_t trans = {
+        .addr = addr,
+        .priority = BSP_I2C_PRIO_HIGH,
+        .timeout_ms = BSP_I2C_EXPAND_TIMEOUT_MS,
+    };
+    return (ESP_OK == bsp_i2c_service_transfer(i2c_expand_service, &trans));
 }
 
 static esp_err_t bsp_i2c_expand_init(void)
@@ -265,6 +712,21 @@ static esp_err_t bsp_i2c_expand_init(void)
     ESP_RETURN_ON_ERROR(i2c_driver_install(BSP_I2C_EXPAND_NUM, i2c_expand_conf.mode, 0, 0, 0),
                         TAG, "install expand i2c failed");
 
+    const bsp_i2c_service_config_t service_conf = {
+        .ops = &bsp_i2c_legacy_bus_ops,
+        .bus_ctx = (void *)(intptr_t)BSP_I2C_EXPAND_NUM,
+        .name = "I2C Expand",
+        .queue_depth = BSP_I2C_EXPAND_QUEUE_DEPTH,
+        .default_timeout_ms = BSP_I2C_EXPAND_TIMEOUT_MS,
+        .task_priority = 6,
+        .task_core_id = 1,
+    };
+    if (ESP_OK != bsp_i2c_service_new(&service_conf, &i2c_expand_service)) {
+        i2c_driver_delete(BSP_I2C_EXPAND_NUM);
+        ESP_LOGE(TAG, "create expand i2c service failed");
+        return ESP_FAIL;
+    }
+
     i2c_initialized = true;
 
     ESP_LOGI(TAG, "I2C num: %d, [%d, %d], speed:%d",
@@ -275,11 +737,20 @@ static esp_err_t bsp_i2c_expand_init(void)
 
 static esp_err_t bsp_i2c_expand_deinit(void)
 {
+    if (i2c_expand_service) {
+        bsp_i2c_service_del(i2c_expand_service);
+        i2c_expand_service = NULL;
+    }
     ESP_RETURN_ON_ERROR(i2c_driver_delete(BSP_I2C_EXPAND_NUM),
                         TAG, "uninstall expand i2c failed");
     return ESP_OK;
 }
 
+bsp_i2c_service_handle_t bsp_i2c_expand_get_service(void)
+{
+    return i2c_expand_service;
+}
+
 esp_err_t bsp_sensor_init(bsp_bottom_property_t *handle)
 {
     esp_err_t ret = ESP_OK;
@@ -287,11 +758,11 @@ esp_err_t bsp_sensor_init(bsp_bottom_property_t *handle)
     ret |= bsp_pm_init();
     ret |= bsp_i2c_expand_init();
 
-    if (bsp_i2c_device_probe(BSP_I2C_EXPAND_NUM, AT581X_ADDRRES_0)) {
+    if (i2c_expand_service && bsp_i2c_device_probe(AT581X_ADDRRES_0)) {
         ESP_LOGW(TAG, "Sensor bottom connected");
         ret |= bsp_init_radar();
-        ret |= bsp_init_temp_humudity();
         sys_bottom_id = BOTTOM_ID_SENSOR;
+        ret |= bsp_sensor_power_init();
     } else {
         ESP_LOGW(TAG, "Sensor bottom lost");
         sys_bottom_id = BOTTOM_ID_UNKNOW;
@@ -303,6 +774,16 @@ esp_err_t bsp_sensor_init(bsp_bottom_property_t *handle)
     handle->get_radar_status = bsp_sensor_get_radar_status;
     handle->set_radar_enable = bsp_sensor_set_radar_onoff;
     handle->get_humiture = bsp_sensor_get_humiture;
+    handle->get_monitor_stats = bsp_sensor_get_monitor_stats;
+
+    /* Without the sensor bottom at power on there is nothing to monitor */
+    if (BOTTOM_ID_SENSOR == sys_bottom_id) {
+        if (pdPASS != xTaskCreatePinnedToCore(&low_power_monitor_task, "Lowpower Task", 4 * 1024, NULL, 5,
+                                              &monitor_task_handle, 1)) {
+            ESP_LOGE(TAG, "create Lowpower task failed");
+            ret |= ESP_FAIL;
+        }
+    }
 
     return ret;
 }
@@ -0,0 +1,468 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "bsp_board.h"
+#include "bsp_board_priv.h"
+
+#define CODEC_DEFAULT_SAMPLE_RATE          (16000)
+#define CODEC_DEFAULT_BIT_WIDTH            (16)
+#define CODEC_DEFAULT_CHANNEL              (2)
+#define CODEC_DMA_FRAMES                   (6 * 240)   /* I2S DMA buffer of the box, in frames */
+#define WAV_HEADER_SIZE                    (44)
+
+typedef struct {
+    int fd;
+    bool opened;                /* Opening was tried since the last format change */
+    bool wav;
+    uint16_t file_channels;     /* Channels of a WAV input, 0 for raw input in the current format */
+    uint8_t pending[12];        /* Bytes of a raw input read while looking for a WAV header */
+    size_t pending_len;
+    uint32_t data_bytes;        /* Data written to a WAV output */
+    int file_index;             /* Output files written so far */
+    int64_t start_us;           /* Time of the first byte of the sample clock */
+    uint64_t clock_bytes;       /* Bytes since the start of the sample clock, 0 when it is stopped */
+    bsp_linux_audio_stats_t stats;
+} audio_stream_t;
+
+static const char *TAG = "bsp_linux_audio";
+
+static SemaphoreHandle_t s_lock = NULL;
+static audio_stream_t s_mic = {.fd = -1};
+static audio_stream_t s_speaker = {.fd = -1};
+static uint32_t s_rate = CODEC_DEFAULT_SAMPLE_RATE;
+static uint32_t s_bits = CODEC_DEFAULT_BIT_WIDTH;
+static uint32_t s_channels = CODEC_DEFAULT_CHANNEL;
+static int s_volume = 100;
+static bool s_mute = false;
+static bool s_realtime = true;
+
+static int64_t audio_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint32_t audio_bytes_per_second(void)
+{
+    return s_rate * (s_bits / 8) * s_channels;
+}
+
+static size_t audio_read_full(int fd, void *buf, size_t len)
+{
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = read(fd, (uint8_t *)buf + done, len - done);
+        if (n <= 0) {
+            break;
+        }
+        done += n;
+    }
+    return done;
+}
+
+static bool audio_write_full(int fd, const void *buf, size_t len)
+{
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = write(fd, (const uint8_t *)buf + done, len - done);
+        if (n <= 0) {
+            return false;
+        }
+        done += n;
+    }
+    return true;
+}
+
+static uint32_t audio_get_le(const uint8_t *p, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--) {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+static void audio_put_le(uint8_t *p, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++) {
+        p[i] = value >> (8 * i);
+    }
+}
+
+/**
+ * @brief Skip the header of a WAV input up to its samples, or keep the bytes read from a raw one
+ */
+static esp_err_t audio_mic_parse(audio_stream_t *s)
+{
+    uint8_t riff[12];
+    size_t len = audio_read_full(s->fd, riff, sizeof(riff));
+    if ((sizeof(riff) != len) || memcmp(riff, "RIFF", 4) || memcmp(riff + 8, "WAVE", 4)) {
+        memcpy(s->pending, riff, len);
+        s->pending_len = len;
+        return ESP_OK;
+    }
+
+    while (true) {
+        uint8_t chunk[8];
+        ESP_RETURN_ON_FALSE(sizeof(chunk) == audio_read_full(s->fd, chunk, sizeof(chunk)), ESP_ERR_INVALID_SIZE, TAG,
+                            "no data in the WAV input");
+        uint32_t size = audio_get_le(chunk + 4, 4);
+        size += size & 1;
+        if (0 == memcmp(chunk, "data", 4)) {
+            break;
+        }
+        if (0 == memcmp(chunk, "fmt ", 4)) {
+            uint8_t fmt[16];
+            ESP_RETURN_ON_FALSE((size >= sizeof(fmt)) && (sizeof(fmt) == audio_read_full(s->fd, fmt, sizeof(fmt))),
+                                ESP_ERR_INVALID_SIZE, TAG, "bad WAV format");
+            ESP_RETURN_ON_FALSE((1 == audio_get_le(fmt, 2)) && (16 == audio_get_le(fmt + 14, 2)),
+                                ESP_ERR_NOT_SUPPORTED, TAG, "only 16 bit PCM WAV input is supported");
+            s->file_channels = audio_get_le(fmt + 2, 2);
+            uint32_t rate = audio_get_le(fmt + 4, 4);
+            ESP_RETURN_ON_FALSE(s->file_channels && (s->file_channels <= 8), ESP_ERR_NOT_SUPPORTED, TAG, "bad WAV channels");
+            if (rate != s_rate) {
+                ESP_LOGW(TAG, "WAV input at %" PRIu32 " Hz is read at %" PRIu32 " Hz", rate, s_rate);
+            }
+            size -= sizeof(fmt);
+        }
+        uint8_t skip[64];
+        while (size) {
+            size_t n = (size < sizeof(skip)) ? size : sizeof(skip);
+            ESP_RETURN_ON_FALSE(n == audio_read_full(s->fd, skip, n), ESP_ERR_INVALID_SIZE, TAG, "truncated WAV input");
+            size -= n;
+        }
+    }
+    ESP_RETURN_ON_FALSE(s->file_channels, ESP_ERR_INVALID_SIZE, TAG, "no format in the WAV input");
+    s->wav = true;
+    return ESP_OK;
+}
+
+static void audio_mic_open(audio_stream_t *s)
+{
+    const char *path = bsp_linux_get_option("BSP_LINUX_MIC", CONFIG_BSP_LINUX_MIC);
+    s->opened = true;
+    s->fd = path[0] ? open(path, O_RDONLY) : -1;
+    if (s->fd < 0) {
+        ESP_LOGW(TAG, "no microphone input '%s', recording silence", path);
+        s->stats.eof = true;
+        return;
+    }
+    if (ESP_OK != audio_mic_parse(s)) {
+        close(s->fd);
+        s->fd = -1;
+        s->stats.eof = true;
+        return;
+    }
+    ESP_LOGI(TAG, "microphone: %s, %s", path, s->wav ? "WAV" : "raw PCM");
+}
+
+/**
+ * @brief Read frames of the current format, converting the channels of a WAV input
+ */
+static size_t audio_mic_read(audio_stream_t *s, uint8_t *buf, size_t len)
+{
+    size_t done = 0;
+    if (s->pending_len) {
+        done = (len < s->pending_len) ? len : s->pending_len;
+        memcpy(buf, s->pending, done);
+        memmove(s->pending, s->pending + done, s->pending_len - done);
+        s->pending_len -= done;
+    }
+    if (!s->file_channels || (s->file_channels == s_channels)) {
+        return done + audio_read_full(s->fd, buf + done, len - done);
+    }
+
+    const size_t frames = len / (s_channels * sizeof(int16_t));
+    int16_t *out = (int16_t *)buf;
+    int16_t in[256];
+    size_t done_frames = 0;
+    while (done_frames < frames) {
+        size_t want = frames - done_frames;
+        if (want > sizeof(in) / sizeof(int16_t) / s->file_channels) {
+            want = sizeof(in) / sizeof(int16_t) / s->file_channels;
+        }
+        size_t got = audio_read_full(s->fd, in, want * s->file_channels * sizeof(int16_t)) /
+                     (s->file_channels * sizeof(int16_t));
+        for (size_t i = 0; i < got; i++, done_frames++) {
+            for (uint32_t ch = 0; ch < s_channels; ch++) {
+                uint32_t file_ch = (ch < s->file_channels) ? ch : (s->file_channels - 1u);
+                out[done_frames * s_channels + ch] = in[i * s->file_channels + file_ch];
+            }
+        }
+        if (got < want) {
+            break;
+        }
+    }
+    return done_frames * s_channels * sizeof(int16_t);
+}
+
+static void audio_wav_header(uint8_t *header, uint32_t data_bytes)
+{
+    memcpy(header, "RIFF", 4);
+    audio_put_le(header + 4, 36 + data_bytes, 4);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    audio_put_le(header + 16, 16, 4);
+    audio_put_le(header + 20, 1, 2);
+    audio_put_le(header + 22, s_channels, 2);
+    audio_put_le(header + 24, s_rate, 4);
+    audio_put_le(header + 28, audio_bytes_per_second(), 4);
+    audio_put_le(header + 32, s_channels * (s_bits / 8), 2);
+    audio_put_le(header + 34, s_bits, 2);
+    memcpy(header + 36, "data", 4);
+    audio_put_le(header + 40, data_bytes, 4);
+}
+
+static void audio_speaker_open(audio_stream_t *s)
+{
+    const char *path = bsp_linux_get_option("BSP_LINUX_SPEAKER", CONFIG_BSP_LINUX_SPEAKER);
+    s->opened = true;
+    if (!path[0]) {
+        return;
+    }
+
+    /* A new format starts a new file: speaker.wav, speaker_1.wav, ... */
+    char name[256];
+    const char *ext = strrchr(path, '.');
+    if (s->file_index && ext) {
+        snprintf(name, sizeof(name), "%.*s_%d%s", (int)(ext - path), path, s->file_index, ext);
+    } else if (s->file_index) {
+        snprintf(name, sizeof(name), "%s_%d", path, s->file_index);
+    } else {
+        snprintf(name, sizeof(name), "%s", path);
+    }
+    s->fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (s->fd < 0) {
+        ESP_LOGW(TAG, "create speaker output '%s' failed, discarding playback", name);
+        return;
+    }
+    s->file_index++;
+    s->wav = ext && (0 == strcasecmp(ext, ".wav"));
+    s->data_bytes = 0;
+    if (s->wav) {
+        uint8_t header[WAV_HEADER_SIZE];
+        audio_wav_header(header, 0);
+        audio_write_full(s->fd, header, sizeof(header));
+    }
+    ESP_LOGI(TAG, "speaker: %s, %" PRIu32 " Hz %" PRIu32 " bit %" PRIu32 " ch", name, s_rate, s_bits, s_channels);
+}
+
+/**
+ * @brief Write the sizes into the WAV header of the speaker output and close it
+ */
+static void audio_speaker_close(audio_stream_t *s)
+{
+    if (s->fd >= 0) {
+        if (s->wav && (0 == lseek(s->fd, 0, SEEK_SET))) {
+            uint8_t header[WAV_HEADER_SIZE];
+            audio_wav_header(header, s->data_bytes);
+            audio_write_full(s->fd, header, sizeof(header));
+        }
+        close(s->fd);
+        s->fd = -1;
+    }
+    s->opened = false;
+}
+
+/**
+ * @brief Hold a call until the sample clock reaches it and record how late it came
+ *
+ * Microphone data is ready once its last sample was captured; samples the device would have overwritten in its DMA
+ * buffer restart the clock. Speaker data is taken once it fits in the DMA buffer; a speaker which ran dry restarts
+ * the clock, after a gap.
+ */
+static void audio_pace(audio_stream_t *s, size_t len, bool speaker)
+{
+    const int64_t now = audio_now_us();
+    const uint64_t bps = audio_bytes_per_second();
+    const int64_t dma_us = (int64_t)CODEC_DMA_FRAMES * 1000000 / s_rate;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s->stats.bytes += len;
+    s->stats.calls++;
+    if (0 == s->clock_bytes) {
+        s->start_us = now - (speaker ? 0 : (int64_t)(len * 1000000 / bps));
+    }
+    const int64_t clock_us = s->start_us + (int64_t)(s->clock_bytes * 1000000 / bps);
+    const int64_t late_us = speaker ? (now - clock_us) : (now - clock_us - (int64_t)(len * 1000000 / bps));
+    if ((late_us > 0) && s->clock_bytes) {
+        s->stats.max_late_us = (late_us > s->stats.max_late_us) ? late_us : s->stats.max_late_us;
+        if (speaker || (late_us > dma_us)) {
+            s->stats.overruns++;
+            s->start_us += late_us;
+        }
+    }
+    s->clock_bytes += len;
+    int64_t due_us = s->start_us + (int64_t)(s->clock_bytes * 1000000 / bps) - (speaker ? dma_us : 0);
+    xSemaphoreGive(s_lock);
+
+    if (s_realtime && (due_us > now)) {
+        vTaskDelay(pdMS_TO_TICKS((due_us - now + 999) / 1000));
+    }
+}
+
+esp_err_t bsp_i2s_read(void *audio_buffer, size_t len, size_t *bytes_read, uint32_t timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(audio_buffer && s_lock, ESP_ERR_INVALID_STATE, TAG, "audio not initialized");
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (!s_mic.opened) {
+        audio_mic_open(&s_mic);
+    }
+    size_t done = (s_mic.fd >= 0) ? audio_mic_read(&s_mic, audio_buffer, len) : 0;
+    if ((done < len) && !s_mic.stats.eof) {
+        ESP_LOGI(TAG, "microphone input ended, recording silence");
+        s_mic.stats.eof = true;
+    }
+    xSemaphoreGive(s_lock);
+
+    memset((uint8_t *)audio_buffer + done, 0, len - done);
+    audio_pace(&s_mic, len, false);
+    if (bytes_read) {
+        *bytes_read = len;
+    }
+    return ESP_OK;
+}
+
+esp_err_t bsp_i2s_write(void *audio_buffer, size_t len, size_t *bytes_written, uint32_t timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(audio_buffer && s_lock, ESP_ERR_INVALID_STATE, TAG, "audio not initialized");
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (!s_speaker.opened) {
+        audio_speaker_open(&s_speaker);
+    }
+    if (s_speaker.fd >= 0) {
+        /* Volume and mute of the codec, applied to 16 bit samples */
+        int16_t block[256];
+        const int gain = s_mute ? 0 : s_volume;
+        for (size_t done = 0; done < len; done += sizeof(block)) {
+            size_t n = ((len - done) < sizeof(block)) ? (len - done) : sizeof(block);
+            memcpy(block, (uint8_t *)audio_buffer + done, n);
+            for (size_t i = 0; (16 == s_bits) && (100 != gain) && (i < n / sizeof(int16_t)); i++) {
+                block[i] = block[i] * gain / 100;
+            }
+            if (!audio_write_full(s_speaker.fd, block, n)) {
+                ESP_LOGW(TAG, "speaker output failed, discarding playback");
+                audio_speaker_close(&s_speaker);
+                s_speaker.opened = true;
+                break;
+            }
+            s_speaker.data_bytes += n;
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    audio_pace(&s_speaker, len, true);
+    if (bytes_written) {
+        *bytes_written = len;
+    }
+    return ESP_OK;
+}
+
+esp_err_t bsp_codec_set_fs(uint32_t rate, uint32_t bits_cfg, i2s_slot_mode_t ch)
+{
+    ESP_RETURN_ON_FALSE(rate && ((16 == bits_cfg) || (24 == bits_cfg) || (32 == bits_cfg)) && ch, ESP_ERR_INVALID_ARG,
+                        TAG, "invalid format");
+    ESP_RETURN_ON_FALSE(s_lock, ESP_ERR_INVALID_STATE, TAG, "audio not initialized");
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if ((rate != s_rate) || (bits_cfg != s_bits) || (ch != s_channels)) {
+        audio_speaker_close(&s_speaker);
+    }
+    s_rate = rate;
+    s_bits = bits_cfg;
+    s_channels = ch;
+    s_mic.clock_bytes = 0;
+    s_speaker.clock_bytes = 0;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+esp_err_t bsp_codec_volume_set(int volume, int *volume_set)
+{
+    s_volume = (volume < 0) ? 0 : ((volume > 100) ? 100 : volume);
+    if (volume_set) {
+        *volume_set = s_volume;
+    }
+    return ESP_OK;
+}
+
+esp_err_t bsp_codec_mute_set(bool enable)
+{
+    s_mute = enable;
+    return ESP_OK;
+}
+
+esp_err_t bsp_codec_dev_stop(void)
+{
+    ESP_RETURN_ON_FALSE(s_lock, ESP_ERR_INVALID_STATE, TAG, "audio not initialized");
+
+    /* The sample clocks stop, the time until resume is no overrun */
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_mic.clock_bytes = 0;
+    s_speaker.clock_bytes = 0;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+esp_err_t bsp_codec_dev_resume(void)
+{
+    return bsp_codec_set_fs(CODEC_DEFAULT_SAMPLE_RATE, CODEC_DEFAULT_BIT_WIDTH, CODEC_DEFAULT_CHANNEL);
+}
+
+esp_err_t bsp_linux_get_audio_stats(bool speaker, bsp_linux_audio_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(s_lock, ESP_ERR_INVALID_STATE, TAG, "audio not initialized");
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    *stats = speaker ? s_speaker.stats : s_mic.stats;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+esp_err_t bsp_linux_audio_init(void)
+{
+    if (NULL == s_lock) {
+        s_lock = xSemaphoreCreateMutex();
+        ESP_RETURN_ON_FALSE(s_lock, ESP_ERR_NO_MEM, TAG, "no mem for audio lock");
+    }
+#if CONFIG_BSP_LINUX_REALTIME
+    const char *realtime = bsp_linux_get_option("BSP_LINUX_REALTIME", "1");
+#else
+    const char *realtime = bsp_linux_get_option("BSP_LINUX_REALTIME", "0");
+#endif
+    s_realtime = (0 != atoi(realtime));
+    return bsp_codec_dev_resume();
+}
+
+void bsp_linux_audio_close(void)
+{
+    if (NULL == s_lock) {
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    audio_speaker_close(&s_speaker);
+    if (s_mic.fd >= 0) {
+        close(s_mic.fd);
+        s_mic.fd = -1;
+    }
+    xSemaphoreGive(s_lock);
+}
@@ -0,0 +1,407 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "bsp_board.h"
+#include "bsp_board_priv.h"
+
+#define SCRIPT_LINE_MAX         128
+#define SCRIPT_BUTTON_CLICK     (-1)    /* press_down, press_up then single_click */
+
+typedef enum {
+    SCRIPT_BUTTON,
+    SCRIPT_RADAR,
+    SCRIPT_HUMITURE,
+    SCRIPT_SLEEP,
+    SCRIPT_BOTTOM,
+    SCRIPT_EXIT,
+} script_type_t;
+
+typedef struct {
+    uint32_t ms;
+    script_type_t type;
+    int arg[2];
+    float value[2];
+} script_event_t;
+
+typedef struct {
+    button_cb_t cb[BUTTON_EVENT_MAX];
+    void *user_data[BUTTON_EVENT_MAX];
+} button_t;
+
+typedef struct {
+    bottom_id_t bottom_id;
+    bool sleep_mode;
+    bool radar_enable;
+    bool radar_level;
+    bool humiture_valid;
+    float temperature;
+    float humidity;
+} sensor_state_t;
+
+static const board_res_desc_t g_board_linux_res = {
+    .GPIO_SDMMC_CLK =      (GPIO_NUM_NC),
+    .GPIO_SDMMC_CMD =      (GPIO_NUM_NC),
+    .GPIO_SDMMC_D0 =       (GPIO_NUM_NC),
+    .GPIO_SDMMC_D1 =       (GPIO_NUM_NC),
+    .GPIO_SDMMC_D2 =       (GPIO_NUM_NC),
+    .GPIO_SDMMC_D3 =       (GPIO_NUM_NC),
+    .GPIO_SDMMC_DET =      (GPIO_NUM_NC),
+    .GPIO_SDSPI_CS =       (GPIO_NUM_NC),
+    .GPIO_SDSPI_SCLK =     (GPIO_NUM_NC),
+    .GPIO_SDSPI_MISO =     (GPIO_NUM_NC),
+    .GPIO_SDSPI_MOSI =     (GPIO_NUM_NC),
+    .GPIO_SPI_CS =         (GPIO_NUM_NC),
+    .GPIO_SPI_MISO =       (GPIO_NUM_NC),
+    .GPIO_SPI_MOSI =       (GPIO_NUM_NC),
+    .GPIO_SPI_SCLK =       (GPIO_NUM_NC),
+    .GPIO_RMT_IR =         (GPIO_NUM_NC),
+    .GPIO_RMT_LED =        (GPIO_NUM_NC),
+};
+
+static const boards_info_t g_boards_info = {
+    .name =         "LINUX_HOST",
+    .board_desc =   &g_board_linux_res
+};
+
+static const struct {
+    const char *name;
+    int event;
+} g_button_events[] = {
+    {"press_down", BUTTON_PRESS_DOWN},
+    {"press_up", BUTTON_PRESS_UP},
+    {"single_click", BUTTON_SINGLE_CLICK},
+    {"double_click", BUTTON_DOUBLE_CLICK},
+    {"long_press_start", BUTTON_LONG_PRESS_START},
+    {"long_press_up", BUTTON_LONG_PRESS_UP},
+    {"click", SCRIPT_BUTTON_CLICK},
+};
+
+static const char *const g_button_names[BSP_BUTTON_NUM] = {
+    [BSP_BUTTON_CONFIG] = "config",
+    [BSP_BUTTON_MUTE] = "mute",
+    [BSP_BUTTON_MAIN] = "main",
+};
+
+static const char *const g_bottom_names[] = {
+    [BOTTOM_ID_SENSOR] = "sensor",
+    [BOTTOM_ID_UNKNOW] = "unknown",
+    [BOTTOM_ID_LOST] = "lost",
+};
+
+static const char *TAG = "bsp_board";
+
+static SemaphoreHandle_t s_lock = NULL;
+static button_t *g_btn_handle = NULL;
+static bsp_bottom_property_t g_bottom_handle;
+static sensor_state_t s_sensor = {.bottom_id = BOTTOM_ID_UNKNOW};
+static script_event_t *s_script = NULL;
+static size_t s_script_len = 0;
+
+const char *bsp_linux_get_option(const char *name, const char *config_value)
+{
+    const char *value = getenv(name);
+    return value ? value : config_value;
+}
+
+esp_err_t bsp_btn_init(void)
+{
+    ESP_ERROR_CHECK((NULL != g_btn_handle));
+
+    g_btn_handle = calloc(sizeof(button_t), BSP_BUTTON_NUM);
+    assert((g_btn_handle) && "memory is insufficient for button");
+    return ESP_OK;
+}
+
+esp_err_t bsp_btn_register_callback(bsp_button_t btn, button_event_t event, button_cb_t callback, void *user_data)
+{
+    assert((g_btn_handle) && "button not initialized");
+    assert((btn < BSP_BUTTON_NUM) && "button id incorrect");
+    ESP_RETURN_ON_FALSE(event < BUTTON_EVENT_MAX, ESP_ERR_INVALID_ARG, TAG, "event incorrect");
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    g_btn_handle[btn].cb[event] = callback;
+    g_btn_handle[btn].user_data[event] = user_data;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+esp_err_t bsp_btn_rm_all_callback(bsp_button_t btn)
+{
+    assert((g_btn_handle) && "button not initialized");
+    assert((btn < BSP_BUTTON_NUM) && "button id incorrect");
+
+    for (size_t event = 0; event < BUTTON_EVENT_MAX; event++) {
+        bsp_btn_register_callback(btn, event, NULL, NULL);
+    }
+    return ESP_OK;
+}
+
+esp_err_t bsp_btn_rm_event_callback(bsp_button_t btn, size_t event)
+{
+    assert((g_btn_handle) && "button not initialized");
+    assert((btn < BSP_BUTTON_NUM) && "button id incorrect");
+
+    return bsp_btn_register_callback(btn, event, NULL, NULL);
+}
+
+static void bsp_btn_emit(bsp_button_t btn, button_event_t event)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    button_cb_t cb = g_btn_handle[btn].cb[event];
+    void *user_data = g_btn_handle[btn].user_data[event];
+    xSemaphoreGive(s_lock);
+
+    if (cb) {
+        cb(&g_btn_handle[btn], user_data);
+    }
+}
+
+const boards_info_t *bsp_board_get_info(void)
+{
+    return &g_boards_info;
+}
+
+const board_res_desc_t *bsp_board_get_description(void)
+{
+    return g_boards_info.board_desc;
+}
+
+bsp_bottom_property_t *bsp_board_get_sensor_handle(void)
+{
+    return &g_bottom_handle;
+}
+
+bsp_i2c_service_handle_t bsp_i2c_expand_get_service(void)
+{
+    return NULL;
+}
+
+static bool bsp_get_sleep_mode()
+{
+    return s_sensor.sleep_mode;
+}
+
+static bottom_id_t bsp_get_bottom_id()
+{
+    return s_sensor.bottom_id;
+}
+
+static bool bsp_sensor_get_radar_status()
+{
+    return s_sensor.radar_enable && s_sensor.radar_level;
+}
+
+static void bsp_sensor_set_radar_enable(bool enable)
+{
+    s_sensor.radar_enable = enable;
+}
+
+static esp_err_t bsp_sensor_get_humiture(float *temperature, float *humidity)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    bool valid = s_sensor.humiture_valid && (BOTTOM_ID_SENSOR == s_sensor.bottom_id);
+    *temperature = s_sensor.temperature;
+    *humidity = s_sensor.humidity;
+    xSemaphoreGive(s_lock);
+    return valid ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t bsp_sensor_get_monitor_stats(bsp_bottom_monitor_stats_t *stats)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t bsp_sensor_init(bsp_bottom_property_t *handle)
+{
+    handle->get_sleep_mode = bsp_get_sleep_mode;
+    handle->get_bottom_id = bsp_get_bottom_id;
+    handle->get_radar_status = bsp_sensor_get_radar_status;
+    handle->set_radar_enable = bsp_sensor_set_radar_enable;
+    handle->get_humiture = bsp_sensor_get_humiture;
+    handle->get_monitor_stats = bsp_sensor_get_monitor_stats;
+    return ESP_OK;
+}
+
+static int bsp_script_lookup(const char *name, const char *const *names, size_t num)
+{
+    for (size_t i = 0; i < num; i++) {
+        if (names[i] && (0 == strcmp(name, names[i]))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static esp_err_t bsp_script_parse_line(char *line, int line_num, script_event_t *event)
+{
+    char kind[16] = {0};
+    char arg[2][24] = {{0}};
+    int fields = sscanf(line, "%" SCNu32 " %15s %23s %23s", &event->ms, kind, arg[0], arg[1]);
+    ESP_RETURN_ON_FALSE(fields >= 2, ESP_ERR_INVALID_ARG, TAG, "script line %d: expected '<ms> <event>'", line_num);
+
+    if (0 == strcmp(kind, "button")) {
+        event->type = SCRIPT_BUTTON;
+        event->arg[0] = bsp_script_lookup(arg[0], g_button_names, BSP_BUTTON_NUM);
+        event->arg[1] = BUTTON_EVENT_MAX;
+        for (size_t i = 0; i < sizeof(g_button_events) / sizeof(g_button_events[0]); i++) {
+            if (0 == strcmp(arg[1], g_button_events[i].name)) {
+                event->arg[1] = g_button_events[i].event;
+            }
+        }
+        ESP_RETURN_ON_FALSE((event->arg[0] >= 0) && (BUTTON_EVENT_MAX != event->arg[1]), ESP_ERR_INVALID_ARG, TAG,
+                            "script line %d: unknown button or event", line_num);
+    } else if (0 == strcmp(kind, "radar")) {
+        event->type = SCRIPT_RADAR;
+        event->arg[0] = atoi(arg[0]);
+    } else if (0 == strcmp(kind, "humiture")) {
+        event->type = SCRIPT_HUMITURE;
+        event->value[0] = strtof(arg[0], NULL);
+        event->value[1] = strtof(arg[1], NULL);
+        ESP_RETURN_ON_FALSE(4 == fields, ESP_ERR_INVALID_ARG, TAG, "script line %d: expected temperature and humidity",
+                            line_num);
+    } else if (0 == strcmp(kind, "sleep")) {
+        event->type = SCRIPT_SLEEP;
+        event->arg[0] = atoi(arg[0]);
+    } else if (0 == strcmp(kind, "bottom")) {
+        event->type = SCRIPT_BOTTOM;
+        event->arg[0] = bsp_script_lookup(arg[0], g_bottom_names, sizeof(g_bottom_names) / sizeof(g_bottom_names[0]));
+        ESP_RETURN_ON_FALSE(event->arg[0] >= 0, ESP_ERR_INVALID_ARG, TAG, "script line %d: unknown bottom", line_num);
+    } else if (0 == strcmp(kind, "exit")) {
+        event->type = SCRIPT_EXIT;
+        event->arg[0] = atoi(arg[0]);
+    } else {
+        ESP_LOGE(TAG, "script line %d: unknown event %s", line_num, kind);
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t bsp_script_load(const char *path)
+{
+    esp_err_t ret = ESP_OK;
+    FILE *fp = fopen(path, "r");
+    ESP_RETURN_ON_FALSE(fp, ESP_ERR_NOT_FOUND, TAG, "open script %s failed", path);
+
+    char line[SCRIPT_LINE_MAX];
+    for (int line_num = 1; fgets(line, sizeof(line), fp); line_num++) {
+        char *p = line + strspn(line, " \t");
+        if (('#' == *p) || ('\n' == *p) || ('\0' == *p)) {
+            continue;
+        }
+        script_event_t *script = realloc(s_script, (s_script_len + 1) * sizeof(script_event_t));
+        ESP_GOTO_ON_FALSE(script, ESP_ERR_NO_MEM, exit, TAG, "no mem for script");
+        s_script = script;
+        script_event_t *event = &s_script[s_script_len];
+        memset(event, 0, sizeof(script_event_t));
+        ESP_GOTO_ON_ERROR(bsp_script_parse_line(p, line_num, event), exit, TAG, "parse %s failed", path);
+        ESP_GOTO_ON_FALSE(!s_script_len || (event->ms >= s_script[s_script_len - 1].ms), ESP_ERR_INVALID_ARG, exit, TAG,
+                          "script line %d: out of order", line_num);
+        s_script_len++;
+    }
+
+exit:
+    fclose(fp);
+    return ret;
+}
+
+static void bsp_script_run(const script_event_t *event)
+{
+    switch (event->type) {
+    case SCRIPT_BUTTON:
+        if (SCRIPT_BUTTON_CLICK == event->arg[1]) {
+            bsp_btn_emit(event->arg[0], BUTTON_PRESS_DOWN);
+            bsp_btn_emit(event->arg[0], BUTTON_PRESS_UP);
+            bsp_btn_emit(event->arg[0], BUTTON_SINGLE_CLICK);
+        } else {
+            bsp_btn_emit(event->arg[0], event->arg[1]);
+        }
+        break;
+    case SCRIPT_RADAR:
+        s_sensor.radar_level = event->arg[0];
+        break;
+    case SCRIPT_HUMITURE:
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        s_sensor.temperature = event->value[0];
+        s_sensor.humidity = event->value[1];
+        s_sensor.humiture_valid = true;
+        xSemaphoreGive(s_lock);
+        break;
+    case SCRIPT_SLEEP:
+        s_sensor.sleep_mode = event->arg[0];
+        break;
+    case SCRIPT_BOTTOM:
+        s_sensor.bottom_id = event->arg[0];
+        break;
+    case SCRIPT_EXIT:
+        ESP_LOGI(TAG, "script exit %d", event->arg[0]);
+        bsp_linux_audio_close();
+        exit(event->arg[0]);
+        break;
+    }
+}
+
+static void bsp_script_task(void *arg)
+{
+    TickType_t start = (TickType_t)(uintptr_t)arg;
+    for (size_t i = 0; i < s_script_len; i++) {
+        TickType_t due = start + pdMS_TO_TICKS(s_script[i].ms);
+        TickType_t now = xTaskGetTickCount();
+        if ((int32_t)(due - now) > 0) {
+            vTaskDelay(due - now);
+        }
+        ESP_LOGD(TAG, "script event %u at %" PRIu32 " ms", (unsigned)i, s_script[i].ms);
+        bsp_script_run(&s_script[i]);
+    }
+    vTaskDelete(NULL);
+}
+
+__attribute__((weak)) void mute_btn_handler(void *handle, void *arg)
+{
+    button_event_t event = (button_event_t)arg;
+
+    if (BUTTON_PRESS_DOWN == event) {
+        printf("Mute On\r\n");
+    } else {
+        printf("Mute Off\r\n");
+    }
+}
+
+esp_err_t bsp_board_init(void)
+{
+    ESP_LOGD(TAG, "Board init");
+    const TickType_t start = xTaskGetTickCount();
+
+    s_lock = xSemaphoreCreateMutex();
+    ESP_RETURN_ON_FALSE(s_lock, ESP_ERR_NO_MEM, TAG, "no mem for board lock");
+
+    ESP_ERROR_CHECK(bsp_btn_init());
+    ESP_ERROR_CHECK(bsp_btn_register_callback(BSP_BUTTON_MUTE, BUTTON_PRESS_DOWN, mute_btn_handler, (void *)BUTTON_PRESS_DOWN));
+    ESP_ERROR_CHECK(bsp_btn_register_callback(BSP_BUTTON_MUTE, BUTTON_PRESS_UP, mute_btn_handler, (void *)BUTTON_PRESS_UP));
+
+    ESP_ERROR_CHECK(bsp_linux_audio_init());
+    atexit(bsp_linux_audio_close);
+    bsp_sensor_init(&g_bottom_handle);
+
+    const char *script = bsp_linux_get_option("BSP_LINUX_SCRIPT", CONFIG_BSP_LINUX_SCRIPT);
+    if (script[0]) {
+        ESP_RETURN_ON_ERROR(bsp_script_load(script), TAG, "load script failed");
+        BaseType_t ret_val = xTaskCreate(bsp_script_task, "BSP Script", 4 * 1024, (void *)(uintptr_t)start, 5, NULL);
+        ESP_RETURN_ON_FALSE(pdPASS == ret_val, ESP_ERR_NO_MEM, TAG, "create script task failed");
+        ESP_LOGI(TAG, "script %s: %u events", script, (unsigned)s_script_len);
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+
+#include "bsp_display_profile.h"
+
+typedef struct {
+    lv_disp_drv_t *drv;
+    void (*flush_cb)(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+    void (*wait_cb)(lv_disp_drv_t *drv);
+    void (*monitor_cb)(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px);
+    int64_t start_us;
+    int64_t wait_last_us;       /*!< Previous call of wait_cb in the current stall, 0 outside of a stall */
+    bsp_display_stats_t stats;
+} display_stats_ctx_t;
+
+static display_stats_ctx_t s_stats_ctx;
+
+static const char *TAG = "bsp_display";
+
+static const char *const s_profile_name[BSP_DISPLAY_PROFILE_MAX] = {
+    [BSP_DISPLAY_PROFILE_SINGLE_DMA] = "single DMA",
+    [BSP_DISPLAY_PROFILE_DOUBLE_DMA] = "double DMA",
+    [BSP_DISPLAY_PROFILE_PSRAM_FULL] = "PSRAM full frame",
+};
+
+esp_err_t bsp_display_profile_apply(const bsp_display_profile_config_t *profile, bsp_display_cfg_t *cfg)
+{
+    const bsp_display_profile_config_t default_profile = BSP_DISPLAY_PROFILE_CONFIG_DEFAULT();
+
+    ESP_RETURN_ON_FALSE(cfg, ESP_ERR_INVALID_ARG, TAG, "invalid display config");
+    if (NULL == profile) {
+        profile = &default_profile;
+    }
+    ESP_RETURN_ON_FALSE(profile->profile < BSP_DISPLAY_PROFILE_MAX, ESP_ERR_INVALID_ARG, TAG, "invalid profile");
+
+    memset(&cfg->flags, 0, sizeof(cfg->flags));
+    switch (profile->profile) {
+    case BSP_DISPLAY_PROFILE_SINGLE_DMA:
+    case BSP_DISPLAY_PROFILE_DOUBLE_DMA:
+        ESP_RETURN_ON_FALSE(profile->buf_lines > 0 && profile->buf_lines <= BSP_LCD_V_RES, ESP_ERR_INVALID_ARG, TAG,
+                            "invalid buffer lines %u", profile->buf_lines);
+        cfg->buffer_size = BSP_LCD_H_RES * profile->buf_lines;
+        cfg->double_buffer = (BSP_DISPLAY_PROFILE_DOUBLE_DMA == profile->profile);
+        cfg->flags.buff_dma = true;
+        break;
+    case BSP_DISPLAY_PROFILE_PSRAM_FULL:
+#if CONFIG_SPIRAM
+        /* A full frame lets LVGL render every dirty area at once, the SPI driver copies it out in DMA sized chunks */
+        cfg->buffer_size = BSP_LCD_H_RES * BSP_LCD_V_RES;
+        cfg->double_buffer = false;
+        cfg->flags.buff_spiram = true;
+        break;
+#else
+        ESP_LOGE(TAG, "%s needs PSRAM", s_profile_name[profile->profile]);
+        return ESP_ERR_NOT_SUPPORTED;
+#endif
+    default:
+        break;
+    }
+
+    ESP_LOGI(TAG, "%s profile, %u pixels x %d", s_profile_name[profile->profile], (unsigned)cfg->buffer_size,
+             cfg->double_buffer ? 2 : 1);
+    return ESP_OK;
+}
+
+const char *bsp_display_profile_name(bsp_display_profile_t profile)
+{
+    return (profile < BSP_DISPLAY_PROFILE_MAX) ? s_profile_name[profile] : "unknown";
+}
+
+static void display_stats_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    s_stats_ctx.wait_last_us = 0;
+    s_stats_ctx.stats.flushes++;
+    s_stats_ctx.stats.pixels += (uint64_t)lv_area_get_size(area);
+    s_stats_ctx.flush_cb(drv, area, color_map);
+}
+
+/**
+ * @brief Called by LVGL in a loop while a flush is pending, so the time between calls adds up to the stall
+ */
+static void display_stats_wait_cb(lv_disp_drv_t *drv)
+{
+    int64_t now = esp_timer_get_time();
+
+    if (s_stats_ctx.wait_last_us) {
+        s_stats_ctx.stats.stall_us += now - s_stats_ctx.wait_last_us;
+    }
+    s_stats_ctx.wait_last_us = now;
+    if (s_stats_ctx.wait_cb) {
+        s_stats_ctx.wait_cb(drv);
+    }
+}
+
+static void display_stats_monitor_cb(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px)
+{
+    s_stats_ctx.wait_last_us = 0;
+    s_stats_ctx.stats.frames++;
+    s_stats_ctx.stats.refresh_us += (uint64_t)time_ms * 1000;
+    if (s_stats_ctx.monitor_cb) {
+        s_stats_ctx.monitor_cb(drv, time_ms, px);
+    }
+}
+
+esp_err_t bsp_display_stats_attach(lv_disp_t *disp)
+{
+    ESP_RETURN_ON_FALSE(disp && disp->driver, ESP_ERR_INVALID_ARG, TAG, "invalid display");
+    ESP_RETURN_ON_FALSE(NULL == s_stats_ctx.drv || disp->driver == s_stats_ctx.drv, ESP_ERR_INVALID_STATE, TAG,
+                        "another display is measured");
+
+    if (NULL == s_stats_ctx.drv) {
+        s_stats_ctx.drv = disp->driver;
+        s_stats_ctx.flush_cb = disp->driver->flush_cb;
+        s_stats_ctx.wait_cb = disp->driver->wait_cb;
+        s_stats_ctx.monitor_cb = disp->driver->monitor_cb;
+        disp->driver->flush_cb = display_stats_flush_cb;
+        disp->driver->wait_cb = display_stats_wait_cb;
+        disp->driver->monitor_cb = display_stats_monitor_cb;
+    }
+    memset(&s_stats_ctx.stats, 0, sizeof(s_stats_ctx.stats));
+    s_stats_ctx.wait_last_us = 0;
+    s_stats_ctx.start_us = esp_timer_get_time();
+    return ESP_OK;
+}
+
+esp_err_t bsp_display_stats_get(bsp_display_stats_t *stats, bool reset)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid stats");
+    ESP_RETURN_ON_FALSE(s_stats_ctx.drv, ESP_ERR_INVALID_STATE, TAG, "no display measured");
+
+    int64_t now = esp_timer_get_time();
+    *stats = s_stats_ctx.stats;
+    stats->elapsed_us = now - s_stats_ctx.start_us;
+    if (reset) {
+        memset(&s_stats_ctx.stats, 0, sizeof(s_stats_ctx.stats));
+        s_stats_ctx.start_us = now;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include "driver/i2c.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+
+#include "bsp_i2c_service.h"
+
+static const char *TAG = "bsp_i2c_legacy";
+
+static esp_err_t bsp_i2c_legacy_transfer(void *bus_ctx, const bsp_i2c_trans_t *trans, TickType_t timeout,
+                                         uint32_t *busy_us)
+{
+    esp_err_t ret;
+    i2c_port_t i2c_num = (i2c_port_t)(intptr_t)bus_ctx;
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    ESP_RETURN_ON_FALSE(cmd, ESP_ERR_NO_MEM, TAG, "create i2c cmd link failed");
+
+    i2c_master_start(cmd);
+    if (trans->regs) {
+        /* One bus transaction, every register is addressed again after a repeated start */
+        for (size_t i = 0; i < trans->reg_count; i++) {
+            if (i) {
+                i2c_master_start(cmd);
+            }
+            i2c_master_write_byte(cmd, trans->addr | I2C_MASTER_WRITE, true);
+            i2c_master_write_byte(cmd, trans->regs[i], true);
+            i2c_master_start(cmd);
+            i2c_master_write_byte(cmd, trans->addr | I2C_MASTER_READ, true);
+            i2c_master_read_byte(cmd, &trans->read_buf[i], I2C_MASTER_NACK);
+        }
+    } else if (trans->write_size || !trans->read_size) {
+        i2c_master_write_byte(cmd, trans->addr | I2C_MASTER_WRITE, true);
+        if (trans->write_size) {
+            i2c_master_write(cmd, trans->write_buf, trans->write_size, true);
+        }
+        if (trans->read_size) {
+            i2c_master_start(cmd);
+            i2c_master_write_byte(cmd, trans->addr | I2C_MASTER_READ, true);
+            i2c_master_read(cmd, trans->read_buf, trans->read_size, I2C_MASTER_LAST_NACK);
+        }
+    } else {
+        i2c_master_write_byte(cmd, trans->addr | I2C_MASTER_READ, true);
+        i2c_master_read(cmd, trans->read_buf, trans->read_size, I2C_MASTER_LAST_NACK);
+    }
+    i2c_master_stop(cmd);
+
+    int64_t start = esp_timer_get_time();
+    ret = i2c_master_cmd_begin(i2c_num, cmd, timeout);
+    *busy_us = (uint32_t)(esp_timer_get_time() - start);
+
+    i2c_cmd_link_delete(cmd);
+    return ret;
+}
+
+const bsp_i2c_bus_ops_t bsp_i2c_legacy_bus_ops = {
+    .transfer = bsp_i2c_legacy_transfer,
+};
@@ -0,0 +1,303 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+
+#include "bsp_i2c_service.h"
+
+#define SERVICE_TASK_STACK_SIZE         (3 * 1024)
+
+typedef struct {
+    bsp_i2c_trans_t trans;
+    TickType_t deadline;
+} service_item_t;
+
+struct bsp_i2c_service {
+    const bsp_i2c_bus_ops_t *ops;
+    void *bus_ctx;
+    uint32_t default_timeout_ms;
+    QueueHandle_t queue[BSP_I2C_PRIO_MAX];
+    SemaphoreHandle_t pending;          /*!< Counts queued transactions of all priorities */
+    SemaphoreHandle_t stopped;
+    TaskHandle_t task;
+    volatile bool stopping;
+    int64_t create_time_us;
+    portMUX_TYPE stats_lock;
+    bsp_i2c_device_stats_t total;
+    bsp_i2c_device_stats_t devices[BSP_I2C_SERVICE_MAX_DEVICES];
+    size_t device_count;
+};
+
+typedef struct {
+    SemaphoreHandle_t done;
+    esp_err_t err;
+} service_sync_ctx_t;
+
+static const char *TAG = "bsp_i2c_service";
+
+static void service_stats_update(bsp_i2c_service_handle_t service, uint8_t addr, bool expired, esp_err_t err,
+                                 uint32_t busy_us)
+{
+    bsp_i2c_device_stats_t *device = NULL;
+
+    portENTER_CRITICAL(&service->stats_lock);
+    for (size_t i = 0; i < service->device_count; i++) {
+        if (service->devices[i].addr == addr) {
+            device = &service->devices[i];
+            break;
+        }
+    }
+    if (!device && (service->device_count < BSP_I2C_SERVICE_MAX_DEVICES)) {
+        device = &service->devices[service->device_count++];
+        device->addr = addr;
+    }
+
+    bsp_i2c_device_stats_t *targets[] = {&service->total, device};
+    for (size_t i = 0; i < sizeof(targets) / sizeof(targets[0]); i++) {
+        if (!targets[i]) {
+            continue;
+        }
+        if (expired) {
+            targets[i]->timeouts++;
+            continue;
+        }
+        targets[i]->transactions++;
+        targets[i]->busy_us += busy_us;
+        if (ESP_OK != err) {
+            targets[i]->errors++;
+        }
+    }
+    portEXIT_CRITICAL(&service->stats_lock);
+}
+
+static bool service_receive(bsp_i2c_service_handle_t service, service_item_t *item)
+{
+    for (int prio = BSP_I2C_PRIO_MAX - 1; prio >= 0; prio--) {
+        if (pdTRUE == xQueueReceive(service->queue[prio], item, 0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void service_task(void *arg)
+{
+    bsp_i2c_service_handle_t service = (bsp_i2c_service_handle_t)arg;
+    service_item_t item;
+
+    while (1) {
+        xSemaphoreTake(service->pending, portMAX_DELAY);
+        if (!service_receive(service, &item)) {
+            if (service->stopping) {
+                break;
+            }
+            continue;
+        }
+
+        esp_err_t err = ESP_ERR_INVALID_STATE;
+        uint32_t busy_us = 0;
+        if (!service->stopping) {
+            TickType_t remaining = item.deadline - xTaskGetTickCount();
+            bool expired = ((int32_t)remaining <= 0);
+            if (expired) {
+                /* Expired while waiting behind other transactions, the bus is not touched */
+                err = ESP_ERR_TIMEOUT;
+            } else if (item.trans.exec) {
+                int64_t start_us = esp_timer_get_time();
+                err = item.trans.exec(service->bus_ctx, item.trans.user_ctx);
+                busy_us = (uint32_t)(esp_timer_get_time() - start_us);
+            } else {
+                err = service->ops->transfer(service->bus_ctx, &item.trans, remaining, &busy_us);
+            }
+            service_stats_update(service, item.trans.addr, expired, err, busy_us);
+        }
+
+        if (item.trans.done_cb) {
+            item.trans.done_cb(err, busy_us, item.trans.user_ctx);
+        }
+    }
+
+    xSemaphoreGive(service->stopped);
+    vTaskDelete(NULL);
+}
+
+esp_err_t bsp_i2c_service_new(const bsp_i2c_service_config_t *config, bsp_i2c_service_handle_t *ret_handle)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(config && ret_handle && config->ops && config->ops->transfer && config->queue_depth,
+                        ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    bsp_i2c_service_handle_t service = calloc(1, sizeof(struct bsp_i2c_service));
+    ESP_RETURN_ON_FALSE(service, ESP_ERR_NO_MEM, TAG, "no mem for service");
+
+    service->ops = config->ops;
+    service->bus_ctx = config->bus_ctx;
+    service->default_timeout_ms = config->default_timeout_ms ? config->default_timeout_ms : 1000;
+    service->create_time_us = esp_timer_get_time();
+    service->total.addr = BSP_I2C_SERVICE_ALL_DEVICES;
+    portMUX_INITIALIZE(&service->stats_lock);
+
+    for (int prio = 0; prio < BSP_I2C_PRIO_MAX; prio++) {
+        service->queue[prio] = xQueueCreate(config->queue_depth, sizeof(service_item_t));
+        ESP_GOTO_ON_FALSE(service->queue[prio], ESP_ERR_NO_MEM, err, TAG, "create queue failed");
+    }
+    /* One extra count to wake the task up on delete */
+    service->pending = xSemaphoreCreateCounting(config->queue_depth * BSP_I2C_PRIO_MAX + 1, 0);
+    service->stopped = xSemaphoreCreateBinary();
+    ESP_GOTO_ON_FALSE(service->pending && service->stopped, ESP_ERR_NO_MEM, err, TAG, "create semaphore failed");
+
+    ESP_GOTO_ON_FALSE(pdPASS == xTaskCreatePinnedToCore(service_task, config->name ? config->name : "I2C Service",
+                      SERVICE_TASK_STACK_SIZE, service, config->task_priority, &service->task, config->task_core_id),
+                      ESP_ERR_NO_MEM, err, TAG, "create service task failed");
+
+    *ret_handle = service;
+    return ESP_OK;
+
+err:
+    for (int prio = 0; prio < BSP_I2C_PRIO_MAX; prio++) {
+        if (service->queue[prio]) {
+            vQueueDelete(service->queue[prio]);
+        }
+    }
+    if (service->pending) {
+        vSemaphoreDelete(service->pending);
+    }
+    if (service->stopped) {
+        vSemaphoreDelete(service->stopped);
+    }
+    free(service);
+    return ret;
+}
+
+esp_err_t bsp_i2c_service_del(bsp_i2c_service_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    handle->stopping = true;
+    xSemaphoreGive(handle->pending);
+    xSemaphoreTake(handle->stopped, portMAX_DELAY);
+
+    for (int prio = 0; prio < BSP_I2C_PRIO_MAX; prio++) {
+        vQueueDelete(handle->queue[prio]);
+    }
+    vSemaphoreDelete(handle->pending);
+    vSemaphoreDelete(handle->stopped);
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t bsp_i2c_service_submit(bsp_i2c_service_handle_t handle, const bsp_i2c_trans_t *trans)
+{
+    ESP_RETURN_ON_FALSE(handle && trans && (trans->priority < BSP_I2C_PRIO_MAX), ESP_ERR_INVALID_ARG, TAG,
+                        "invalid argument");
+    ESP_RETURN_ON_FALSE(!handle->stopping, ESP_ERR_INVALID_STATE, TAG, "service stopping");
+    ESP_RETURN_ON_FALSE((!trans->write_size || trans->write_buf) && (!trans->read_size || trans->read_buf),
+                        ESP_ERR_INVALID_ARG, TAG, "invalid buffer");
+    ESP_RETURN_ON_FALSE(!trans->regs || (trans->reg_count && (trans->read_size == trans->reg_count)),
+                        ESP_ERR_INVALID_ARG, TAG, "invalid register read");
+
+    uint32_t timeout_ms = trans->timeout_ms ? trans->timeout_ms : handle->default_timeout_ms;
+    service_item_t item = {
+        .trans = *trans,
+        .deadline = xTaskGetTickCount() + pdMS_TO_TICKS(timeout_ms) + 1,
+    };
+    if (pdTRUE != xQueueSend(handle->queue[trans->priority], &item, 0)) {
+        return ESP_ERR_NO_MEM;
+    }
+    xSemaphoreGive(handle->pending);
+    return ESP_OK;
+}
+
+static void service_sync_done(esp_err_t err, uint32_t busy_us, void *user_ctx)
+{
+    service_sync_ctx_t *ctx = (service_sync_ctx_t *)user_ctx;
+    ctx->err = err;
+    xSemaphoreGive(ctx->done);
+}
+
+esp_err_t bsp_i2c_service_transfer(bsp_i2c_service_handle_t handle, const bsp_i2c_trans_t *trans)
+{
+    ESP_RETURN_ON_FALSE(handle && trans, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(xTaskGetCurrentTaskHandle() != handle->task, ESP_ERR_INVALID_STATE, TAG,
+                        "can not wait in the service task");
+
+    StaticSemaphore_t done_buf;
+    service_sync_ctx_t ctx = {
+        .done = xSemaphoreCreateBinaryStatic(&done_buf),
+        .err = ESP_FAIL,
+    };
+    bsp_i2c_trans_t sync_trans = *trans;
+    sync_trans.done_cb = service_sync_done;
+    sync_trans.user_ctx = &ctx;
+
+    esp_err_t ret = bsp_i2c_service_submit(handle, &sync_trans);
+    if (ESP_OK == ret) {
+        /* The service always completes the transaction, even when it expired */
+        xSemaphoreTake(ctx.done, portMAX_DELAY);
+        ret = ctx.err;
+    }
+    vSemaphoreDelete(ctx.done);
+    return ret;
+}
+
+esp_err_t bsp_i2c_service_get_stats(bsp_i2c_service_handle_t handle, uint8_t addr, bsp_i2c_device_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(handle && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    portENTER_CRITICAL(&handle->stats_lock);
+    if (BSP_I2C_SERVICE_ALL_DEVICES == addr) {
+        *stats = handle->total;
+        ret = ESP_OK;
+    } else {
+        for (size_t i = 0; i < handle->device_count; i++) {
+            if (handle->devices[i].addr == addr) {
+                *stats = handle->devices[i];
+                ret = ESP_OK;
+                break;
+            }
+        }
+    }
+    portEXIT_CRITICAL(&handle->stats_lock);
+
+    stats->elapsed_us = esp_timer_get_time() - handle->create_time_us;
+    return ret;
+}
+
+void bsp_i2c_service_print_stats(bsp_i2c_service_handle_t handle)
+{
+    bsp_i2c_device_stats_t stats;
+    char name[8];
+
+    if (!handle) {
+        return;
+    }
+
+    ESP_LOGI(TAG, "device  trans     errors    timeouts  busy(us)    occupancy");
+    for (size_t i = 0; i <= handle->device_count; i++) {
+        if (i < handle->device_count) {
+            bsp_i2c_service_get_stats(handle, handle->devices[i].addr, &stats);
+            snprintf(name, sizeof(name), "0x%02x", stats.addr >> 1);
+        } else {
+            bsp_i2c_service_get_stats(handle, BSP_I2C_SERVICE_ALL_DEVICES, &stats);
+            strcpy(name, "total");
+        }
+        uint64_t elapsed_us = stats.elapsed_us ? stats.elapsed_us : 1;
+        uint32_t permyriad = (uint32_t)(stats.busy_us * 10000 / elapsed_us);
+        ESP_LOGI(TAG, "%-6s  %-8"PRIu32"  %-8"PRIu32"  %-8"PRIu32"  %-10"PRIu64"  %"PRIu32".%02"PRIu32"%%",
+                 name, stats.transactions, stats.errors, stats.timeouts, stats.busy_us,
+                 permyriad / 100, permyriad % 100);
+    }
+}
@@ -0,0 +1,213 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+
+#include "bsp_power.h"
+
+#define POWER_MAX_HOOKS             (12)
+#define POWER_WORKER_NUM            (2)
+#define POWER_WORKER_STACK_SIZE     (4 * 1024)
+#define POWER_WORKER_PRIORITY       (6)
+
+struct bsp_power_hook {
+    bsp_power_hook_config_t config;
+    size_t deps_count;
+    size_t deps_pending;            /*!< Dependencies not resumed yet, only valid during a resume */
+    esp_err_t result;
+    uint32_t resume_us;
+};
+
+static bsp_power_hook_handle_t s_hooks[POWER_MAX_HOOKS];
+static size_t s_hook_count;
+static SemaphoreHandle_t s_power_lock;
+static QueueHandle_t s_work_queue;
+static QueueHandle_t s_done_queue;
+static bsp_power_wake_stats_t s_wake_stats;
+
+static const char *TAG = "bsp_power";
+
+static const char *const s_milestone_name[BSP_POWER_MILESTONE_MAX] = {
+    [BSP_POWER_MILESTONE_NONE] = "none",
+    [BSP_POWER_MILESTONE_FIRST_FRAME] = "first frame",
+    [BSP_POWER_MILESTONE_AUDIO_READY] = "audio ready",
+};
+
+static void power_worker_task(void *arg)
+{
+    bsp_power_hook_handle_t hook;
+
+    while (1) {
+        xQueueReceive(s_work_queue, &hook, portMAX_DELAY);
+
+        int64_t start = esp_timer_get_time();
+        hook->result = hook->config.resume ? hook->config.resume(hook->config.user_ctx) : ESP_OK;
+        hook->resume_us = (uint32_t)(esp_timer_get_time() - start);
+
+        xQueueSend(s_done_queue, &hook, portMAX_DELAY);
+    }
+}
+
+static esp_err_t power_init(void)
+{
+    if (s_power_lock) {
+        return ESP_OK;
+    }
+
+    s_power_lock = xSemaphoreCreateMutex();
+    s_work_queue = xQueueCreate(POWER_MAX_HOOKS, sizeof(bsp_power_hook_handle_t));
+    s_done_queue = xQueueCreate(POWER_MAX_HOOKS, sizeof(bsp_power_hook_handle_t));
+    ESP_RETURN_ON_FALSE(s_power_lock && s_work_queue && s_done_queue, ESP_ERR_NO_MEM, TAG, "no mem for power manager");
+
+    for (int i = 0; i < POWER_WORKER_NUM; i++) {
+        ESP_RETURN_ON_FALSE(pdPASS == xTaskCreate(power_worker_task, "Power Worker", POWER_WORKER_STACK_SIZE, NULL,
+                                                  POWER_WORKER_PRIORITY, NULL),
+                            ESP_ERR_NO_MEM, TAG, "create power worker failed");
+    }
+    return ESP_OK;
+}
+
+esp_err_t bsp_power_register_hook(const bsp_power_hook_config_t *config, bsp_power_hook_handle_t *ret_hook)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(config && config->name && (config->milestone < BSP_POWER_MILESTONE_MAX),
+                        ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_ERROR(power_init(), TAG, "init power manager failed");
+
+    xSemaphoreTake(s_power_lock, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(s_hook_count < POWER_MAX_HOOKS, ESP_ERR_NO_MEM, exit, TAG, "too many hooks");
+
+    size_t deps_count = 0;
+    while ((deps_count < BSP_POWER_MAX_DEPS) && config->depends_on[deps_count]) {
+        bool registered = false;
+        for (size_t i = 0; i < s_hook_count; i++) {
+            registered |= (s_hooks[i] == config->depends_on[deps_count]);
+        }
+        ESP_GOTO_ON_FALSE(registered, ESP_ERR_INVALID_ARG, exit, TAG, "dependency of %s not registered", config->name);
+        deps_count++;
+    }
+
+    bsp_power_hook_handle_t hook = calloc(1, sizeof(struct bsp_power_hook));
+    ESP_GOTO_ON_FALSE(hook, ESP_ERR_NO_MEM, exit, TAG, "no mem for hook");
+    hook->config = *config;
+    hook->deps_count = deps_count;
+    s_hooks[s_hook_count++] = hook;
+
+    if (ret_hook) {
+        *ret_hook = hook;
+    }
+    ESP_LOGD(TAG, "Hook %s registered, %u dependencies", config->name, (unsigned)hook->deps_count);
+
+exit:
+    xSemaphoreGive(s_power_lock);
+    return ret;
+}
+
+esp_err_t bsp_power_suspend(void)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(s_power_lock, ESP_ERR_INVALID_STATE, TAG, "no hook registered");
+
+    xSemaphoreTake(s_power_lock, portMAX_DELAY);
+    /* Registration order is a dependency order, suspend runs it backwards */
+    for (int i = s_hook_count - 1; i >= 0; i--) {
+        bsp_power_hook_handle_t hook = s_hooks[i];
+        if (hook->config.suspend) {
+            esp_err_t err = hook->config.suspend(hook->config.user_ctx);
+            if (ESP_OK != err) {
+                ESP_LOGW(TAG, "Suspend %s failed: %s", hook->config.name, esp_err_to_name(err));
+                ret = (ESP_OK == ret) ? err : ret;
+            }
+        }
+    }
+    xSemaphoreGive(s_power_lock);
+    return ret;
+}
+
+static bool power_hook_depends_on(bsp_power_hook_handle_t hook, bsp_power_hook_handle_t dep)
+{
+    for (size_t i = 0; i < hook->deps_count; i++) {
+        if (hook->config.depends_on[i] == dep) {
+            return true;
+        }
+    }
+    return false;
+}
+
+esp_err_t bsp_power_resume(int64_t wake_time_us)
+{
+    esp_err_t ret = ESP_OK;
+    bsp_power_hook_handle_t hook;
+    ESP_RETURN_ON_FALSE(s_power_lock, ESP_ERR_INVALID_STATE, TAG, "no hook registered");
+
+    xSemaphoreTake(s_power_lock, portMAX_DELAY);
+    if (0 == wake_time_us) {
+        wake_time_us = esp_timer_get_time();
+    }
+
+    for (size_t i = 0; i < s_hook_count; i++) {
+        s_hooks[i]->deps_pending = s_hooks[i]->deps_count;
+        if (0 == s_hooks[i]->deps_count) {
+            xQueueSend(s_work_queue, &s_hooks[i], portMAX_DELAY);
+        }
+    }
+
+    uint32_t milestone_us[BSP_POWER_MILESTONE_MAX] = {0};
+    for (size_t done = 0; done < s_hook_count; done++) {
+        xQueueReceive(s_done_queue, &hook, portMAX_DELAY);
+        uint32_t elapsed_us = (uint32_t)(esp_timer_get_time() - wake_time_us);
+
+        if (ESP_OK != hook->result) {
+            /* Dependents are resumed anyway, as good as the system can get */
+            ESP_LOGW(TAG, "Resume %s failed: %s", hook->config.name, esp_err_to_name(hook->result));
+            ret = (ESP_OK == ret) ? hook->result : ret;
+        }
+        ESP_LOGD(TAG, "Resume %s took %"PRIu32" us, done at %"PRIu32" us", hook->config.name, hook->resume_us, elapsed_us);
+
+        if (milestone_us[hook->config.milestone] < elapsed_us) {
+            milestone_us[hook->config.milestone] = elapsed_us;
+        }
+        for (size_t i = 0; i < s_hook_count; i++) {
+            if (power_hook_depends_on(s_hooks[i], hook) && (0 == --s_hooks[i]->deps_pending)) {
+                xQueueSend(s_work_queue, &s_hooks[i], portMAX_DELAY);
+            }
+        }
+    }
+
+    s_wake_stats.wakes++;
+    s_wake_stats.last_total_us = (uint32_t)(esp_timer_get_time() - wake_time_us);
+    for (int i = BSP_POWER_MILESTONE_NONE + 1; i < BSP_POWER_MILESTONE_MAX; i++) {
+        s_wake_stats.last_us[i] = milestone_us[i];
+        if (s_wake_stats.max_us[i] < milestone_us[i]) {
+            s_wake_stats.max_us[i] = milestone_us[i];
+        }
+        if (milestone_us[i]) {
+            ESP_LOGI(TAG, "Wake to %s: %"PRIu32" ms (max %"PRIu32" ms)", s_milestone_name[i],
+                     milestone_us[i] / 1000, s_wake_stats.max_us[i] / 1000);
+        }
+    }
+    xSemaphoreGive(s_power_lock);
+    return ret;
+}
+
+esp_err_t bsp_power_get_wake_stats(bsp_power_wake_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(s_power_lock, ESP_ERR_INVALID_STATE, TAG, "no hook registered");
+
+    xSemaphoreTake(s_power_lock, portMAX_DELAY);
+    *stats = s_wake_stats;
+    xSemaphoreGive(s_power_lock);
+    return ESP_OK;
+}
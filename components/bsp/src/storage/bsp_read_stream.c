@@ -0,0 +1,403 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define _GNU_SOURCE     /* fopencookie */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+
+#include "bsp_read_stream.h"
+
+#define READ_STREAM_TASK_STACK_SIZE     (3 * 1024)
+#define READ_STREAM_TASK_PRIORITY       (5)
+#define READ_STREAM_SECTOR_SIZE         (512)
+#define READ_STREAM_ALIGN               (64)            /*!< Cache line, blocks may be DMA targets */
+#define READ_STREAM_DMA_CHUNK_SIZE      (16 * 1024)     /*!< Internal bounce buffer for blocks the card can not DMA to */
+
+typedef struct {
+    uint8_t *data;
+    off_t offset;
+    size_t len;
+} stream_block_t;
+
+struct bsp_read_stream {
+    FILE *fp;
+    off_t size;
+    bsp_read_stream_config_t config;
+    stream_block_t *blocks;         /*!< Ring of blocks, `ready` blocks from `head` hold data */
+    size_t head;
+    size_t ready;
+    off_t fetch_offset;             /*!< Offset of the next block to read */
+    off_t pos;                      /*!< Read position */
+    uint32_t generation;            /*!< Changed by a seek dropping the blocks, the block being read is then discarded */
+    uint32_t served;                /*!< Turn of the last block read, for round robin between equals */
+    bool fetching;                  /*!< The storage task is reading a block of this stream */
+    bool error;
+    SemaphoreHandle_t data_sem;     /*!< Given when a block of this stream was read */
+    bsp_read_stream_stats_t stats;
+    bsp_read_stream_handle_t next;
+};
+
+static SemaphoreHandle_t s_lock;
+static TaskHandle_t s_task;
+static bsp_read_stream_handle_t s_streams;
+static uint32_t s_turn;
+static uint8_t *s_dma_chunk;
+static portMUX_TYPE s_init_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char *TAG = "bsp_read_stream";
+
+/* The stream most in need of data: fewest buffered blocks, then the one served longest ago */
+static bsp_read_stream_handle_t read_stream_pick(void)
+{
+    bsp_read_stream_handle_t best = NULL;
+
+    for (bsp_read_stream_handle_t stream = s_streams; stream; stream = stream->next) {
+        if (stream->fetching || stream->error || (stream->ready == stream->config.block_num) ||
+                (stream->fetch_offset >= stream->size)) {
+            continue;
+        }
+        if (!best || (stream->ready < best->ready) ||
+                ((stream->ready == best->ready) && ((int32_t)(stream->served - best->served) < 0))) {
+            best = stream;
+        }
+    }
+    return best;
+}
+
+static size_t read_stream_fetch(FILE *fp, off_t offset, uint8_t *data, size_t size)
+{
+    if (0 != fseek(fp, offset, SEEK_SET)) {
+        return 0;
+    }
+    /* The card driver reads into internal DMA memory one sector per command, large chunks go through a bounce buffer */
+    if (esp_ptr_dma_capable(data) || !s_dma_chunk) {
+        return fread(data, 1, size, fp);
+    }
+
+    size_t len = 0;
+    while (len < size) {
+        size_t chunk = (size - len < READ_STREAM_DMA_CHUNK_SIZE) ? size - len : READ_STREAM_DMA_CHUNK_SIZE;
+        size_t n = fread(s_dma_chunk, 1, chunk, fp);
+        memcpy(data + len, s_dma_chunk, n);
+        len += n;
+        if (n < chunk) {
+            break;
+        }
+    }
+    return len;
+}
+
+static void read_stream_task(void *arg)
+{
+    while (1) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        bsp_read_stream_handle_t stream = read_stream_pick();
+        if (!stream) {
+            xSemaphoreGive(s_lock);
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        stream->fetching = true;
+        stream->served = ++s_turn;
+        stream_block_t *block = &stream->blocks[(stream->head + stream->ready) % stream->config.block_num];
+        off_t offset = stream->fetch_offset;
+        uint32_t generation = stream->generation;
+        xSemaphoreGive(s_lock);
+
+        /* One block per turn, the card is free for others in between */
+        int64_t start = esp_timer_get_time();
+        size_t len = read_stream_fetch(stream->fp, offset, block->data, stream->config.block_size);
+        uint32_t fetch_us = (uint32_t)(esp_timer_get_time() - start);
+
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        stream->fetching = false;
+        stream->stats.blocks_fetched++;
+        stream->stats.fetch_us += fetch_us;
+        if (generation == stream->generation) {
+            block->offset = offset;
+            block->len = len;
+            stream->fetch_offset = offset + len;
+            if (len) {
+                stream->ready++;
+            }
+            if ((len < stream->config.block_size) && (stream->fetch_offset < stream->size)) {
+                ESP_LOGE(TAG, "Read failed at %ld", (long)stream->fetch_offset);
+                stream->error = true;
+            }
+        }
+        /* Given with the lock held, a closing stream is not freed before */
+        xSemaphoreGive(stream->data_sem);
+        xSemaphoreGive(s_lock);
+    }
+}
+
+static esp_err_t read_stream_init(void)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (!s_lock) {
+        /* Two first streams may be opened at once, only one lock is kept */
+        SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+        ESP_RETURN_ON_FALSE(lock, ESP_ERR_NO_MEM, TAG, "no mem for read stream lock");
+        portENTER_CRITICAL(&s_init_spinlock);
+        if (!s_lock) {
+            s_lock = lock;
+            lock = NULL;
+        }
+        portEXIT_CRITICAL(&s_init_spinlock);
+        if (lock) {
+            vSemaphoreDelete(lock);
+        }
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (!s_task) {
+        s_dma_chunk = heap_caps_aligned_alloc(READ_STREAM_ALIGN, READ_STREAM_DMA_CHUNK_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (!s_dma_chunk) {
+            ESP_LOGW(TAG, "no mem for bounce buffer, reading blocks directly");
+        }
+        ESP_GOTO_ON_FALSE(pdPASS == xTaskCreate(read_stream_task, "Read Stream", READ_STREAM_TASK_STACK_SIZE, NULL,
+                                                READ_STREAM_TASK_PRIORITY, &s_task),
+                          ESP_ERR_NO_MEM, err, TAG, "create read stream task failed");
+    }
+err:
+    xSemaphoreGive(s_lock);
+    return ret;
+}
+
+static void read_stream_free(bsp_read_stream_handle_t stream)
+{
+    if (stream->blocks) {
+        for (size_t i = 0; i < stream->config.block_num; i++) {
+            heap_caps_free(stream->blocks[i].data);
+        }
+        free(stream->blocks);
+    }
+    if (stream->data_sem) {
+        vSemaphoreDelete(stream->data_sem);
+    }
+    if (stream->fp) {
+        fclose(stream->fp);
+    }
+    free(stream);
+}
+
+esp_err_t bsp_read_stream_open(const char *path, const bsp_read_stream_config_t *config,
+                               bsp_read_stream_handle_t *ret_stream)
+{
+    esp_err_t ret = ESP_OK;
+    const bsp_read_stream_config_t default_config = BSP_READ_STREAM_CONFIG_DEFAULT();
+    struct stat st;
+
+    config = config ? config : &default_config;
+    ESP_RETURN_ON_FALSE(path && ret_stream && (config->block_num >= 2) && config->block_size &&
+                        (0 == config->block_size % READ_STREAM_SECTOR_SIZE), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_ERROR(read_stream_init(), TAG, "init read stream failed");
+    ESP_RETURN_ON_FALSE(0 == stat(path, &st), ESP_ERR_NOT_FOUND, TAG, "stat %s failed", path);
+
+    bsp_read_stream_handle_t stream = calloc(1, sizeof(struct bsp_read_stream));
+    ESP_RETURN_ON_FALSE(stream, ESP_ERR_NO_MEM, TAG, "no mem for stream");
+    stream->config = *config;
+    stream->size = st.st_size;
+
+    stream->fp = fopen(path, "rb");
+    ESP_GOTO_ON_FALSE(stream->fp, ESP_ERR_NOT_FOUND, err, TAG, "open %s failed", path);
+    /* Blocks are read straight into their buffer, without the stdio buffer */
+    setvbuf(stream->fp, NULL, _IONBF, 0);
+
+    stream->data_sem = xSemaphoreCreateBinary();
+    stream->blocks = calloc(config->block_num, sizeof(stream_block_t));
+    ESP_GOTO_ON_FALSE(stream->data_sem && stream->blocks, ESP_ERR_NO_MEM, err, TAG, "no mem for stream");
+    for (size_t i = 0; i < config->block_num; i++) {
+        stream->blocks[i].data = heap_caps_aligned_alloc(READ_STREAM_ALIGN, config->block_size, config->caps);
+        ESP_GOTO_ON_FALSE(stream->blocks[i].data, ESP_ERR_NO_MEM, err, TAG, "no mem for %u blocks of %u bytes",
+                          (unsigned)config->block_num, (unsigned)config->block_size);
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    stream->served = s_turn;
+    stream->next = s_streams;
+    s_streams = stream;
+    xSemaphoreGive(s_lock);
+    xTaskNotifyGive(s_task);
+
+    *ret_stream = stream;
+    return ESP_OK;
+
+err:
+    read_stream_free(stream);
+    return ret;
+}
+
+size_t bsp_read_stream_read(bsp_read_stream_handle_t stream, void *buf, size_t size)
+{
+    size_t done = 0;
+
+    if (!stream || !buf) {
+        return 0;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    while ((done < size) && (stream->pos < stream->size)) {
+        if (stream->ready) {
+            stream_block_t *block = &stream->blocks[stream->head];
+            off_t block_end = block->offset + block->len;
+            if (stream->pos >= block_end) {
+                stream->head = (stream->head + 1) % stream->config.block_num;
+                stream->ready--;
+                xTaskNotifyGive(s_task);
+                continue;
+            }
+
+            /* Only the reader releases ready blocks, the copy does not need the lock */
+            size_t n = (size - done < block_end - stream->pos) ? size - done : (size_t)(block_end - stream->pos);
+            const uint8_t *src = block->data + (stream->pos - block->offset);
+            xSemaphoreGive(s_lock);
+            memcpy((uint8_t *)buf + done, src, n);
+            xSemaphoreTake(s_lock, portMAX_DELAY);
+            done += n;
+            stream->pos += n;
+            stream->stats.bytes_read += n;
+            continue;
+        }
+        if (stream->error) {
+            break;
+        }
+
+        int64_t start = esp_timer_get_time();
+        xSemaphoreGive(s_lock);
+        xTaskNotifyGive(s_task);
+        xSemaphoreTake(stream->data_sem, portMAX_DELAY);
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        stream->stats.stall_us += (uint32_t)(esp_timer_get_time() - start);
+    }
+    xSemaphoreGive(s_lock);
+    return done;
+}
+
+esp_err_t bsp_read_stream_seek(bsp_read_stream_handle_t stream, off_t offset, int whence)
+{
+    ESP_RETURN_ON_FALSE(stream, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    off_t pos = offset;
+    if (SEEK_CUR == whence) {
+        pos += stream->pos;
+    } else if (SEEK_END == whence) {
+        pos += stream->size;
+    }
+    if ((pos < 0) || (pos > stream->size) || ((SEEK_SET != whence) && (SEEK_CUR != whence) && (SEEK_END != whence))) {
+        xSemaphoreGive(s_lock);
+        ESP_LOGE(TAG, "invalid position %ld", (long)pos);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /* Keep the blocks if the position is inside them, e.g. a decoder skipping a tag */
+    bool buffered = stream->ready && (pos >= stream->blocks[stream->head].offset) && (pos < stream->fetch_offset);
+    if (!buffered && (pos != stream->pos)) {
+        stream->stats.blocks_dropped += stream->ready;
+        stream->ready = 0;
+        stream->generation++;
+        stream->error = false;
+        /* Aligned reads, FATFS reads whole sectors straight to the block */
+        stream->fetch_offset = pos - pos % stream->config.block_size;
+        xTaskNotifyGive(s_task);
+    }
+    stream->pos = pos;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+off_t bsp_read_stream_tell(bsp_read_stream_handle_t stream)
+{
+    return stream ? stream->pos : -1;
+}
+
+esp_err_t bsp_read_stream_get_stats(bsp_read_stream_handle_t stream, bsp_read_stream_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stream && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    *stats = stream->stats;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+void bsp_read_stream_close(bsp_read_stream_handle_t stream)
+{
+    if (!stream) {
+        return;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (bsp_read_stream_handle_t *p = &s_streams; *p; p = &(*p)->next) {
+        if (*p == stream) {
+            *p = stream->next;
+            break;
+        }
+    }
+    while (stream->fetching) {
+        xSemaphoreGive(s_lock);
+        xSemaphoreTake(stream->data_sem, portMAX_DELAY);
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+    }
+    xSemaphoreGive(s_lock);
+
+    read_stream_free(stream);
+}
+
+static ssize_t read_stream_cookie_read(void *cookie, char *buf, size_t size)
+{
+    return bsp_read_stream_read((bsp_read_stream_handle_t)cookie, buf, size);
+}
+
+static int read_stream_cookie_seek(void *cookie, off_t *offset, int whence)
+{
+    bsp_read_stream_handle_t stream = (bsp_read_stream_handle_t)cookie;
+
+    if (ESP_OK != bsp_read_stream_seek(stream, *offset, whence)) {
+        return -1;
+    }
+    *offset = bsp_read_stream_tell(stream);
+    return 0;
+}
+
+static int read_stream_cookie_close(void *cookie)
+{
+    bsp_read_stream_close((bsp_read_stream_handle_t)cookie);
+    return 0;
+}
+
+FILE *bsp_read_stream_fopen(const char *path, const bsp_read_stream_config_t *config)
+{
+    bsp_read_stream_handle_t stream = NULL;
+    const cookie_io_functions_t functions = {
+        .read = read_stream_cookie_read,
+        .write = NULL,
+        .seek = read_stream_cookie_seek,
+        .close = read_stream_cookie_close,
+    };
+
+    if (ESP_OK != bsp_read_stream_open(path, config, &stream)) {
+        return NULL;
+    }
+    FILE *fp = fopencookie(stream, "rb", functions);
+    if (!fp) {
+        ESP_LOGE(TAG, "fopencookie failed");
+        bsp_read_stream_close(stream);
+    }
+    return fp;
+}
@@ -8,6 +8,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "bsp_board.h"
+#include "bsp_storage.h"
 #include "esp_err.h"
 #include "esp_log.h"
 #include "esp_vfs_fat.h"
@@ -17,14 +18,16 @@
 #include "driver/sdmmc_host.h"
 #endif
 
-#define DEFAULT_FD_NUM      2
 #define DEFAULT_MOUNT_POINT "/sdcard"
 
 static sdmmc_card_t *card;
 static const char *TAG = "bsp_sdcard";
 
-esp_err_t bsp_sdcard_init(char *mount_point, size_t max_files)
+esp_err_t bsp_sdcard_init_with_config(const bsp_sdcard_config_t *config)
 {
+    if ((NULL == config) || (NULL == config->mount_point) || (0 == config->max_files)) {
+        return ESP_ERR_INVALID_ARG;
+    }
     if (NULL != card) {
         return ESP_ERR_INVALID_STATE;
     }
@@ -45,9 +48,9 @@ esp_err_t bsp_sdcard_init(char *mount_point, size_t max_files)
      *
      */
     esp_vfs_fat_sdmmc_mount_config_t mount_config = {
-        .format_if_mount_failed = false,
-        .max_files = max_files,
-        .allocation_unit_size = 16 * 1024
+        .format_if_mount_failed = config->format_if_mount_failed,
+        .max_files = config->max_files,
+        .allocation_unit_size = config->allocation_unit_size
     };
 
     /**
@@ -61,9 +64,19 @@ esp_err_t bsp_sdcard_init(char *mount_point, size_t max_files)
     if (brd->FUNC_SDMMC_EN) {
         sdmmc_host_t h = SDMMC_HOST_DEFAULT();
         memcpy(&host, &h, sizeof(sdmmc_host_t));
+        if (BSP_SDCARD_SPEED_DEFAULT != config->speed) {
+            host.max_freq_khz = SDMMC_FREQ_HIGHSPEED;
+        }
+        /* DDR is only negotiated with cards supporting it at 3.3 V, which are eMMC */
+        if (BSP_SDCARD_SPEED_HIGH == config->speed) {
+            host.flags &= ~SDMMC_HOST_FLAG_DDR;
+        }
     } else {
         sdmmc_host_t h = SDSPI_HOST_DEFAULT();
         memcpy(&host, &h, sizeof(sdmmc_host_t));
+        if (BSP_SDCARD_SPEED_DEFAULT != config->speed) {
+            ESP_LOGW(TAG, "SDSPI runs at default speed");
+        }
         spi_bus_config_t bus_cfg = {
             .mosi_io_num = brd->GPIO_SDSPI_MOSI,
             .miso_io_num = brd->GPIO_SDSPI_MISO,
@@ -104,12 +117,12 @@ esp_err_t bsp_sdcard_init(char *mount_point, size_t max_files)
 #endif
         slot_config.cd = brd->GPIO_SDMMC_DET;
         slot_config.flags |= SDMMC_SLOT_FLAG_INTERNAL_PULLUP;
-        ret_val = esp_vfs_fat_sdmmc_mount(mount_point, &host, &slot_config, &mount_config, &card);
+        ret_val = esp_vfs_fat_sdmmc_mount(config->mount_point, &host, &slot_config, &mount_config, &card);
     } else {
         sdspi_device_config_t slot_config = SDSPI_DEVICE_CONFIG_DEFAULT();
         slot_config.gpio_cs = brd->GPIO_SDSPI_CS;
         slot_config.host_id = host.slot;
-        ret_val = esp_vfs_fat_sdspi_mount(mount_point, &host, &slot_config, &mount_config, &card);
+        ret_val = esp_vfs_fat_sdspi_mount(config->mount_point, &host, &slot_config, &mount_config, &card);
     }
 
     /* Check for SDMMC mount result. */
@@ -130,9 +143,18 @@ esp_err_t bsp_sdcard_init(char *mount_point, size_t max_files)
     return ret_val;
 }
 
+esp_err_t bsp_sdcard_init(char *mount_point, size_t max_files)
+{
+    bsp_sdcard_config_t config = BSP_SDCARD_CONFIG_DEFAULT();
+    config.mount_point = mount_point;
+    config.max_files = max_files;
+    return bsp_sdcard_init_with_config(&config);
+}
+
 esp_err_t bsp_sdcard_init_default(void)
 {
-    return bsp_sdcard_init(DEFAULT_MOUNT_POINT, DEFAULT_FD_NUM);
+    const bsp_sdcard_config_t config = BSP_SDCARD_CONFIG_DEFAULT();
+    return bsp_sdcard_init_with_config(&config);
 }
 
 esp_err_t bsp_sdcard_deinit(char *mount_point)
@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "bsp_board.h"
+#include "bsp_storage.h"
+#include "bsp_board_priv.h"
+
+#define DEFAULT_MOUNT_POINT "/sdcard"
+
+static const char *TAG = "bsp_sdcard";
+
+static bool s_linked = false;
+
+/**
+ * @brief "Mount" the card: the mount point becomes a symbolic link to the SD card directory, unless it already is a
+ * directory of its own, such as a bind mount set up by the test environment.
+ */
+esp_err_t bsp_sdcard_init_with_config(const bsp_sdcard_config_t *config)
+{
+    if ((NULL == config) || (NULL == config->mount_point) || (0 == config->max_files)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const char *dir = bsp_linux_get_option("BSP_LINUX_SDCARD", CONFIG_BSP_LINUX_SDCARD);
+    ESP_RETURN_ON_FALSE((0 == mkdir(dir, 0755)) || (EEXIST == errno), ESP_FAIL, TAG, "create %s failed: %s", dir,
+                        strerror(errno));
+
+    struct stat st;
+    if (0 == stat(config->mount_point, &st)) {
+        ESP_RETURN_ON_FALSE(S_ISDIR(st.st_mode), ESP_FAIL, TAG, "%s is not a directory", config->mount_point);
+        ESP_LOGI(TAG, "SD card at %s", config->mount_point);
+        return ESP_OK;
+    }
+
+    char target[PATH_MAX];
+    ESP_RETURN_ON_FALSE(realpath(dir, target), ESP_FAIL, TAG, "resolve %s failed", dir);
+    ESP_RETURN_ON_FALSE(0 == symlink(target, config->mount_point), ESP_FAIL, TAG,
+                        "link %s to %s failed: %s, create the link or run where %s can be created", config->mount_point,
+                        target, strerror(errno), config->mount_point);
+    s_linked = true;
+    ESP_LOGI(TAG, "SD card at %s, directory %s", config->mount_point, target);
+    return ESP_OK;
+}
+
+esp_err_t bsp_sdcard_init(char *mount_point, size_t max_files)
+{
+    bsp_sdcard_config_t config = BSP_SDCARD_CONFIG_DEFAULT();
+    config.mount_point = mount_point;
+    config.max_files = max_files;
+    return bsp_sdcard_init_with_config(&config);
+}
+
+esp_err_t bsp_sdcard_init_default(void)
+{
+    const bsp_sdcard_config_t config = BSP_SDCARD_CONFIG_DEFAULT();
+    return bsp_sdcard_init_with_config(&config);
+}
+
+esp_err_t bsp_sdcard_deinit(char *mount_point)
+{
+    if (NULL == mount_point) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (s_linked) {
+        ESP_RETURN_ON_FALSE(0 == unlink(mount_point), ESP_FAIL, TAG, "unlink %s failed", mount_point);
+        s_linked = false;
+    }
+    return ESP_OK;
+}
+
+esp_err_t bsp_sdcard_deinit_default(void)
+{
+    return bsp_sdcard_deinit(DEFAULT_MOUNT_POINT);
+}
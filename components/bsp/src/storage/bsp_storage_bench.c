@@ -0,0 +1,182 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "esp_console.h"
+#include "argtable3/argtable3.h"
+
+#include "bsp_storage.h"
+#include "bsp_read_stream.h"
+
+#define BENCH_FILE_NAME         "sdbench.bin"
+#define BENCH_RANDOM_SIZE       (4 * 1024)
+#define BENCH_RANDOM_COUNT      (256)
+#define BENCH_DEFAULT_DIR       "/sdcard"
+#define BENCH_DEFAULT_SIZE      (4 * 1024 * 1024)
+#define BENCH_DEFAULT_BLOCK     (32 * 1024)
+
+static const char *TAG = "bsp_storage_bench";
+
+static void bench_report(const char *name, size_t bytes, int64_t us)
+{
+    us = us ? us : 1;
+    ESP_LOGI(TAG, "%-16s %7u KB in %6u ms, %4u.%02u MB/s", name, (unsigned)(bytes / 1024), (unsigned)(us / 1000),
+             (unsigned)(bytes / us), (unsigned)(bytes * 100 / us % 100));
+}
+
+static esp_err_t bench_write(const char *path, uint8_t *buf, size_t file_size, size_t block_size)
+{
+    FILE *fp = fopen(path, "wb");
+    ESP_RETURN_ON_FALSE(fp, ESP_FAIL, TAG, "create %s failed", path);
+
+    esp_err_t ret = ESP_OK;
+    int64_t start = esp_timer_get_time();
+    for (size_t done = 0; done < file_size; done += block_size) {
+        size_t n = (file_size - done < block_size) ? file_size - done : block_size;
+        ESP_GOTO_ON_FALSE(n == fwrite(buf, 1, n, fp), ESP_FAIL, err, TAG, "write failed");
+    }
+    fsync(fileno(fp));
+    bench_report("write", file_size, esp_timer_get_time() - start);
+err:
+    fclose(fp);
+    return ret;
+}
+
+static esp_err_t bench_read(const char *path, uint8_t *buf, size_t file_size, size_t block_size)
+{
+    FILE *fp = fopen(path, "rb");
+    ESP_RETURN_ON_FALSE(fp, ESP_FAIL, TAG, "open %s failed", path);
+
+    size_t done = 0;
+    size_t n;
+    int64_t start = esp_timer_get_time();
+    while ((n = fread(buf, 1, block_size, fp)) > 0) {
+        done += n;
+    }
+    bench_report("read", done, esp_timer_get_time() - start);
+    fclose(fp);
+    return (done == file_size) ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t bench_read_stream(const char *path, uint8_t *buf, size_t file_size)
+{
+    bsp_read_stream_handle_t stream = NULL;
+    bsp_read_stream_stats_t stats;
+
+    ESP_RETURN_ON_ERROR(bsp_read_stream_open(path, NULL, &stream), TAG, "open read stream failed");
+
+    /* Decoder sized reads, the stream fetches large blocks behind them */
+    size_t done = 0;
+    size_t n;
+    int64_t start = esp_timer_get_time();
+    while ((n = bsp_read_stream_read(stream, buf, 2 * 1024)) > 0) {
+        done += n;
+    }
+    bench_report("read stream", done, esp_timer_get_time() - start);
+    bsp_read_stream_get_stats(stream, &stats);
+    ESP_LOGI(TAG, "read stream      %u blocks, fetch %u ms, stall %u ms", (unsigned)stats.blocks_fetched,
+             (unsigned)(stats.fetch_us / 1000), (unsigned)(stats.stall_us / 1000));
+    bsp_read_stream_close(stream);
+    return (done == file_size) ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t bench_random_read(const char *path, uint8_t *buf, size_t file_size)
+{
+    FILE *fp = fopen(path, "rb");
+    ESP_RETURN_ON_FALSE(fp, ESP_FAIL, TAG, "open %s failed", path);
+    setvbuf(fp, NULL, _IONBF, 0);
+
+    esp_err_t ret = ESP_OK;
+    size_t slots = file_size / BENCH_RANDOM_SIZE;
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < BENCH_RANDOM_COUNT; i++) {
+        long offset = (long)(esp_random() % slots) * BENCH_RANDOM_SIZE;
+        ESP_GOTO_ON_FALSE((0 == fseek(fp, offset, SEEK_SET)) && (BENCH_RANDOM_SIZE == fread(buf, 1, BENCH_RANDOM_SIZE, fp)),
+                          ESP_FAIL, err, TAG, "read at %ld failed", offset);
+    }
+    int64_t us = esp_timer_get_time() - start;
+    us = us ? us : 1;
+    ESP_LOGI(TAG, "%-16s %7u reads in %6u ms, %u IOPS", "random 4K", BENCH_RANDOM_COUNT, (unsigned)(us / 1000),
+             (unsigned)(BENCH_RANDOM_COUNT * 1000000LL / us));
+err:
+    fclose(fp);
+    return ret;
+}
+
+esp_err_t bsp_storage_bench_run(const char *dir, size_t file_size, size_t block_size)
+{
+    esp_err_t ret = ESP_OK;
+    char path[128];
+
+    ESP_RETURN_ON_FALSE(dir && block_size && (file_size >= BENCH_RANDOM_SIZE), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    snprintf(path, sizeof(path), "%s/%s", dir, BENCH_FILE_NAME);
+
+    size_t buf_size = (block_size > BENCH_RANDOM_SIZE) ? block_size : BENCH_RANDOM_SIZE;
+    uint8_t *buf = malloc(buf_size);
+    ESP_RETURN_ON_FALSE(buf, ESP_ERR_NO_MEM, TAG, "no mem for %u bytes buffer", (unsigned)buf_size);
+    for (size_t i = 0; i < buf_size; i++) {
+        buf[i] = (uint8_t)i;
+    }
+
+    ESP_LOGI(TAG, "%s, %u KB file, %u bytes blocks", path, (unsigned)(file_size / 1024), (unsigned)block_size);
+    ESP_GOTO_ON_ERROR(bench_write(path, buf, file_size, block_size), err, TAG, "write test failed");
+    ESP_GOTO_ON_ERROR(bench_read(path, buf, file_size, block_size), err, TAG, "read test failed");
+    ESP_GOTO_ON_ERROR(bench_read_stream(path, buf, file_size), err, TAG, "read stream test failed");
+    ESP_GOTO_ON_ERROR(bench_random_read(path, buf, file_size), err, TAG, "random read test failed");
+
+err:
+    remove(path);
+    free(buf);
+    return ret;
+}
+
+static struct {
+    struct arg_str *dir;
+    struct arg_int *size;
+    struct arg_int *block;
+    struct arg_end *end;
+} s_bench_args;
+
+static int bench_cmd(int argc, char **argv)
+{
+    if (arg_parse(argc, argv, (void **)&s_bench_args)) {
+        arg_print_errors(stderr, s_bench_args.end, argv[0]);
+        return 1;
+    }
+
+    const char *dir = s_bench_args.dir->count ? s_bench_args.dir->sval[0] : BENCH_DEFAULT_DIR;
+    int size_kb = s_bench_args.size->count ? s_bench_args.size->ival[0] : BENCH_DEFAULT_SIZE / 1024;
+    int block = s_bench_args.block->count ? s_bench_args.block->ival[0] : BENCH_DEFAULT_BLOCK;
+    if ((size_kb <= 0) || (block <= 0)) {
+        printf("size and block must be positive\n");
+        return 1;
+    }
+    return (ESP_OK == bsp_storage_bench_run(dir, (size_t)size_kb * 1024, (size_t)block)) ? 0 : 1;
+}
+
+esp_err_t bsp_storage_bench_register_cmd(void)
+{
+    s_bench_args.dir = arg_str0(NULL, NULL, "<dir>", "directory to test, " BENCH_DEFAULT_DIR " by default");
+    s_bench_args.size = arg_int0("s", "size", "<kb>", "test file size in KB, 4096 by default");
+    s_bench_args.block = arg_int0("b", "block", "<bytes>", "sequential block size, 32768 by default");
+    s_bench_args.end = arg_end(3);
+
+    const esp_console_cmd_t cmd = {
+        .command = "sdbench",
+        .help = "Storage sequential and random read/write throughput",
+        .hint = NULL,
+        .func = bench_cmd,
+        .argtable = &s_bench_args,
+    };
+    return esp_console_cmd_register(&cmd);
+}
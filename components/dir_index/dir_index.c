@@ -0,0 +1,315 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <dirent.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "esp_log.h"
+#include "esp_check.h"
+
+#include "dir_index.h"
+
+#define DIR_INDEX_POOL_INIT_SIZE        (1024)
+#define DIR_INDEX_ENTRIES_INIT_NUM      (32)
+#define DIR_INDEX_HASH_INIT             (0xcbf29ce484222325ULL)
+#define DIR_INDEX_HASH_PRIME            (0x100000001b3ULL)
+
+typedef struct {
+    uint32_t name_offset;               /*!< Offset of the name in the pool */
+    uint16_t name_len;                  /*!< Name length, without the terminator */
+} dir_index_entry_t;
+
+struct dir_index {
+    char *path;
+    char *suffix;
+    size_t suffix_len;
+    bool sort;
+
+    char *pool;                         /*!< Every name, '\0' terminated, back to back */
+    size_t pool_size;
+    size_t pool_capacity;
+    dir_index_entry_t *entries;         /*!< Directory order */
+    uint32_t *order;                    /*!< Entry positions in name order */
+    size_t count;
+    size_t capacity;
+
+    bool scanned;
+    uint64_t hash;                      /*!< Hash of the names of the last scan, in directory order */
+};
+
+static const char *TAG = "dir_index";
+
+static bool dir_index_name_has_suffix(const char *name, size_t name_len, const char *suffix, size_t suffix_len)
+{
+    /* Compare the end of the name only, "x.mp3.bak" does not end with ".mp3" */
+    return (name_len >= suffix_len) && (0 == strcasecmp(name + name_len - suffix_len, suffix));
+}
+
+static const char *dir_index_entry_name(dir_index_handle_t index, uint32_t i)
+{
+    return index->pool + index->entries[i].name_offset;
+}
+
+static int dir_index_compare(dir_index_handle_t index, uint32_t a, uint32_t b)
+{
+    return strcasecmp(dir_index_entry_name(index, a), dir_index_entry_name(index, b));
+}
+
+static void dir_index_sift_down(dir_index_handle_t index, uint32_t *order, size_t root, size_t count)
+{
+    while (2 * root + 1 < count) {
+        size_t child = 2 * root + 1;
+        if ((child + 1 < count) && (dir_index_compare(index, order[child], order[child + 1]) < 0)) {
+            child++;
+        }
+        if (dir_index_compare(index, order[root], order[child]) >= 0) {
+            return;
+        }
+        uint32_t tmp = order[root];
+        order[root] = order[child];
+        order[child] = tmp;
+        root = child;
+    }
+}
+
+/* Heap sort: in place, bounded time and no comparator context limitation of qsort */
+static void dir_index_sort(dir_index_handle_t index)
+{
+    uint32_t *order = index->order;
+    size_t count = index->count;
+
+    for (size_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    for (size_t i = count / 2; i > 0; i--) {
+        dir_index_sift_down(index, order, i - 1, count);
+    }
+    for (size_t end = count; end > 1; end--) {
+        uint32_t tmp = order[0];
+        order[0] = order[end - 1];
+        order[end - 1] = tmp;
+        dir_index_sift_down(index, order, 0, end - 1);
+    }
+}
+
+static esp_err_t dir_index_reserve(dir_index_handle_t index, size_t name_size)
+{
+    if (index->pool_size + name_size > index->pool_capacity) {
+        size_t capacity = index->pool_capacity ? index->pool_capacity : DIR_INDEX_POOL_INIT_SIZE;
+        while (index->pool_size + name_size > capacity) {
+            capacity *= 2;
+        }
+        char *pool = realloc(index->pool, capacity);
+        ESP_RETURN_ON_FALSE(pool, ESP_ERR_NO_MEM, TAG, "no mem for %u bytes of names", (unsigned)capacity);
+        index->pool = pool;
+        index->pool_capacity = capacity;
+    }
+
+    if (index->count == index->capacity) {
+        size_t capacity = index->capacity ? index->capacity * 2 : DIR_INDEX_ENTRIES_INIT_NUM;
+        dir_index_entry_t *entries = realloc(index->entries, capacity * sizeof(dir_index_entry_t));
+        ESP_RETURN_ON_FALSE(entries, ESP_ERR_NO_MEM, TAG, "no mem for %u entries", (unsigned)capacity);
+        index->entries = entries;
+        if (index->sort) {
+            uint32_t *order = realloc(index->order, capacity * sizeof(uint32_t));
+            ESP_RETURN_ON_FALSE(order, ESP_ERR_NO_MEM, TAG, "no mem for %u entries", (unsigned)capacity);
+            index->order = order;
+        }
+        index->capacity = capacity;
+    }
+    return ESP_OK;
+}
+
+/* Give back the growth slack, a large library would otherwise hold up to twice its size */
+static void dir_index_trim(dir_index_handle_t index)
+{
+    if (index->pool_size && (index->pool_size < index->pool_capacity)) {
+        char *pool = realloc(index->pool, index->pool_size);
+        if (pool) {
+            index->pool = pool;
+            index->pool_capacity = index->pool_size;
+        }
+    }
+    if (index->count && (index->count < index->capacity)) {
+        dir_index_entry_t *entries = realloc(index->entries, index->count * sizeof(dir_index_entry_t));
+        if (entries) {
+            /* A failed shrink of the order array leaves it larger than needed, which is fine */
+            uint32_t *order = index->sort ? realloc(index->order, index->count * sizeof(uint32_t)) : NULL;
+            index->entries = entries;
+            index->order = order ? order : index->order;
+            index->capacity = index->count;
+        }
+    }
+}
+
+/* FNV-1a, terminators included, so that the names can not run into each other */
+static uint64_t dir_index_hash(uint64_t hash, const char *name, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ (uint8_t)name[i]) * DIR_INDEX_HASH_PRIME;
+    }
+    return hash;
+}
+
+static esp_err_t dir_index_scan(dir_index_handle_t index, uint64_t *hash)
+{
+    esp_err_t ret = ESP_OK;
+    struct dirent *p_dirent = NULL;
+
+    DIR *p_dir = opendir(index->path);
+    ESP_RETURN_ON_FALSE(p_dir, ESP_ERR_NOT_FOUND, TAG, "opendir %s failed", index->path);
+
+    /* The pool and arrays are reused, a rescan only allocates if the directory grew */
+    index->pool_size = 0;
+    index->count = 0;
+    *hash = DIR_INDEX_HASH_INIT;
+    while ((p_dirent = readdir(p_dir)) != NULL) {
+        if (p_dirent->d_type != DT_REG) {
+            continue;
+        }
+        size_t name_len = strlen(p_dirent->d_name);
+        if (index->suffix && !dir_index_name_has_suffix(p_dirent->d_name, name_len, index->suffix, index->suffix_len)) {
+            continue;
+        }
+        if (name_len > UINT16_MAX) {
+            continue;
+        }
+        ESP_GOTO_ON_ERROR(dir_index_reserve(index, name_len + 1), err, TAG, "index %s failed", index->path);
+
+        dir_index_entry_t *entry = &index->entries[index->count++];
+        entry->name_offset = index->pool_size;
+        entry->name_len = name_len;
+        memcpy(index->pool + index->pool_size, p_dirent->d_name, name_len + 1);
+        index->pool_size += name_len + 1;
+        *hash = dir_index_hash(*hash, p_dirent->d_name, name_len + 1);
+    }
+    closedir(p_dir);
+    dir_index_trim(index);
+    return ESP_OK;
+
+err:
+    closedir(p_dir);
+    index->pool_size = 0;
+    index->count = 0;
+    return ret;
+}
+
+esp_err_t dir_index_new(const dir_index_config_t *config, dir_index_handle_t *ret_index)
+{
+    ESP_RETURN_ON_FALSE(config && config->path && ret_index, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    dir_index_handle_t index = calloc(1, sizeof(struct dir_index));
+    ESP_RETURN_ON_FALSE(index, ESP_ERR_NO_MEM, TAG, "no mem for index");
+
+    index->path = strdup(config->path);
+    index->suffix = config->suffix ? strdup(config->suffix) : NULL;
+    index->suffix_len = config->suffix ? strlen(config->suffix) : 0;
+    index->sort = config->sort;
+    if (!index->path || (config->suffix && !index->suffix)) {
+        dir_index_del(index);
+        ESP_LOGE(TAG, "no mem for index config");
+        return ESP_ERR_NO_MEM;
+    }
+
+    *ret_index = index;
+    return ESP_OK;
+}
+
+void dir_index_del(dir_index_handle_t index)
+{
+    if (index) {
+        free(index->path);
+        free(index->suffix);
+        free(index->pool);
+        free(index->entries);
+        free(index->order);
+        free(index);
+    }
+}
+
+esp_err_t dir_index_refresh(dir_index_handle_t index, bool *changed)
+{
+    uint64_t hash = 0;
+    ESP_RETURN_ON_FALSE(index, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    /*
+     * The directory is always read: FATFS does not update the modification time of a directory when files are added
+     * or removed, so it can not tell whether the listing is still valid. The same names in the same order leave the
+     * entries as they were, only then the name order is kept.
+     */
+    esp_err_t ret = dir_index_scan(index, &hash);
+    bool same = (ESP_OK == ret) && index->scanned && (hash == index->hash);
+    if ((ESP_OK == ret) && !same && index->sort) {
+        dir_index_sort(index);
+    }
+    index->scanned = (ESP_OK == ret);
+    index->hash = hash;
+    if (changed) {
+        *changed = !same;
+    }
+    return ret;
+}
+
+size_t dir_index_count(dir_index_handle_t index)
+{
+    return index ? index->count : 0;
+}
+
+const char *dir_index_get_name(dir_index_handle_t index, size_t i)
+{
+    if (!index || (i >= index->count)) {
+        return NULL;
+    }
+    return dir_index_entry_name(index, i);
+}
+
+const char *dir_index_get_sorted_name(dir_index_handle_t index, size_t i)
+{
+    if (!index || !index->sort || (i >= index->count)) {
+        return NULL;
+    }
+    return dir_index_entry_name(index, index->order[i]);
+}
+
+bool dir_index_has_suffix(dir_index_handle_t index, size_t i, const char *suffix)
+{
+    if (!index || !suffix || (i >= index->count)) {
+        return false;
+    }
+    return dir_index_name_has_suffix(dir_index_entry_name(index, i), index->entries[i].name_len, suffix, strlen(suffix));
+}
+
+int dir_index_find(dir_index_handle_t index, const char *name)
+{
+    if (!index || !index->sort || !name) {
+        return -1;
+    }
+
+    size_t low = 0;
+    size_t high = index->count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        int cmp = strcasecmp(dir_index_entry_name(index, index->order[mid]), name);
+        if (0 == cmp) {
+            return (int)mid;
+        } else if (cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return -1;
+}
+
+size_t dir_index_get_mem_size(dir_index_handle_t index)
+{
+    if (!index) {
+        return 0;
+    }
+    return sizeof(struct dir_index) + index->pool_capacity +
+           index->capacity * (sizeof(dir_index_entry_t) + (index->sort ? sizeof(uint32_t) : 0));
+}
@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Index of the regular files of one directory
+ *
+ * A scan reads the directory once. Names go into a single string pool, and an offset array points into it, so
+ * thousands of files cost two allocations instead of one per file. The pool is kept between scans.
+ * Entries are kept in directory order, with a second array holding the case insensitive name order.
+ */
+typedef struct dir_index *dir_index_handle_t;
+
+typedef struct {
+    const char *path;       /*!< Directory to index */
+    const char *suffix;     /*!< Only index names ending with this suffix, case insensitive. NULL for every file */
+    bool sort;              /*!< Build the name order, needed by `dir_index_find` and the sorted getters */
+} dir_index_config_t;
+
+/**
+ * @brief Create a directory index, the directory is scanned by the first `dir_index_refresh`
+ *
+ * @param config: Index configuration
+ * @param ret_index: Output index handle
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t dir_index_new(const dir_index_config_t *config, dir_index_handle_t *ret_index);
+
+/**
+ * @brief Delete a directory index
+ *
+ * @param index: Index handle
+ */
+void dir_index_del(dir_index_handle_t index);
+
+/**
+ * @brief Scan the directory again
+ *
+ * The directory is read on every call, as neither FATFS nor SPIFFS keep a directory modification time which changes
+ * with its files. When the scan finds the same names in the same order as the previous one, the name order is kept
+ * instead of being sorted again, and `changed` is false, so callers can also keep what they derived from the index.
+ *
+ * @param index: Index handle
+ * @param changed: Output whether the names differ from the previous scan, true for the first one. May be NULL
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_NOT_FOUND: Directory can not be opened
+ *    - ESP_ERR_NO_MEM: Out of memory, the index is empty
+ */
+esp_err_t dir_index_refresh(dir_index_handle_t index, bool *changed);
+
+/**
+ * @brief Number of indexed files
+ *
+ * @param index: Index handle
+ *
+ * @return Number of files
+ */
+size_t dir_index_count(dir_index_handle_t index);
+
+/**
+ * @brief Name of a file, in directory order
+ *
+ * @param index: Index handle
+ * @param i: Entry position
+ *
+ * @return File name, valid until the next scan. NULL if out of range.
+ */
+const char *dir_index_get_name(dir_index_handle_t index, size_t i);
+
+/**
+ * @brief Name of a file, in case insensitive name order
+ *
+ * @param index: Index handle
+ * @param i: Position in name order
+ *
+ * @return File name, valid until the next scan. NULL if out of range or the index is not sorted.
+ */
+const char *dir_index_get_sorted_name(dir_index_handle_t index, size_t i);
+
+/**
+ * @brief Check the name of a file ends with a suffix, case insensitive
+ *
+ * @param index: Index handle
+ * @param i: Entry position, in directory order
+ * @param suffix: Suffix, e.g. ".mp3"
+ *
+ * @return true if the name ends with the suffix
+ */
+bool dir_index_has_suffix(dir_index_handle_t index, size_t i, const char *suffix);
+
+/**
+ * @brief Find a file by name with a binary search in name order
+ *
+ * @param index: Index handle
+ * @param name: File name, compared case insensitively
+ *
+ * @return Position in name order, -1 if not found or the index is not sorted
+ */
+int dir_index_find(dir_index_handle_t index, const char *name);
+
+/**
+ * @brief Total size of the pool and arrays of the index
+ *
+ * @param index: Index handle
+ *
+ * @return Size in bytes
+ */
+size_t dir_index_get_mem_size(dir_index_handle_t index);
+
+#ifdef __cplusplus
+}
+#endif
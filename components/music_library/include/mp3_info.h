@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include "esp_err.h"
+#include "music_library.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t start;                 /*!< Offset of the first audio frame, after the ID3v2 tag and the VBR header frame */
+    uint32_t end;                   /*!< End of the audio frames, before the ID3v1 tag */
+    uint16_t sample_rate_hz;        /*!< Sample rate of the first frame */
+    uint8_t channels;               /*!< 1 or 2 */
+    uint8_t layer;                  /*!< MPEG layer, 1 to 3 */
+    uint8_t version;                /*!< MPEG version bits of the frame header, 0 (2.5), 2 (2) or 3 (1) */
+} mp3_audio_range_t;
+
+/**
+ * @brief Read the tags and the duration of an MP3 file
+ *
+ * Only the ID3v2 text frames, the first MPEG frame (and its Xing, Info or VBRI header) and the ID3v1 tag are read,
+ * the audio data is not decoded.
+ *
+ * @param fp: File, at any position
+ * @param file_size: Size of the file
+ * @param info: Output metadata, fields not found are left cleared
+ *
+ * @return
+ *    - ESP_OK: Success, at least the first MPEG frame was found
+ *    - ESP_ERR_NOT_FOUND: No MPEG audio frame, the tags may still have been read
+ */
+esp_err_t mp3_info_parse(FILE *fp, uint32_t file_size, music_info_t *info);
+
+/**
+ * @brief Find the audio frames of an MP3 file, to play it right after another one without the tags in between
+ *
+ * @param fp: File, at any position
+ * @param file_size: Size of the file
+ * @param range: Output range and format of the audio frames
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NOT_FOUND: No MPEG audio frame
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t mp3_info_find_audio(FILE *fp, uint32_t file_size, mp3_audio_range_t *range);
+
+#ifdef __cplusplus
+}
+#endif
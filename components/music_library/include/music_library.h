@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum size of the title and artist strings, terminator included. Longer tags are truncated.
+ */
+#define MUSIC_LIBRARY_TEXT_MAX_LEN      (64)
+
+/**
+ * @brief Metadata of the music files of one directory
+ *
+ * The library is loaded from a cache file when created, so the metadata of a known library is available at once.
+ * A background task then checks every file against the cache, keyed by file size and modification time, and only
+ * parses the ID3 tags and MP3 frame headers of new or modified files. The cache is written back if anything changed.
+ * A library whose cache would exceed CONFIG_MUSIC_LIBRARY_CACHE_MAX_SIZE is not cached and is parsed on every boot.
+ */
+typedef struct music_library *music_library_handle_t;
+
+typedef struct {
+    char title[MUSIC_LIBRARY_TEXT_MAX_LEN];     /*!< Title, UTF-8. Empty if the file has no title tag */
+    char artist[MUSIC_LIBRARY_TEXT_MAX_LEN];    /*!< Artist, UTF-8. Empty if the file has no artist tag */
+    uint32_t duration_ms;                       /*!< Duration, 0 if unknown */
+    uint16_t bitrate_kbps;                      /*!< Bitrate, average for VBR files. 0 if unknown */
+    uint16_t sample_rate_hz;                    /*!< Sample rate, 0 if unknown */
+} music_info_t;
+
+/**
+ * @brief Called from the indexer task once every file of the directory is indexed
+ *
+ * @param library: Library handle
+ * @param user_ctx: User context
+ */
+typedef void (*music_library_ready_cb_t)(music_library_handle_t library, void *user_ctx);
+
+typedef struct {
+    const char *path;                   /*!< Directory of the music files */
+    const char *suffix;                 /*!< Only index names ending with this suffix, case insensitive. NULL for every file */
+    const char *cache_path;             /*!< Cache file, NULL to not persist the library */
+    int task_priority;                  /*!< Indexer task priority */
+    int task_core;                      /*!< Indexer task core, tskNO_AFFINITY for any */
+    music_library_ready_cb_t ready_cb;  /*!< Indexing done callback, may be NULL */
+    void *user_ctx;                     /*!< User context of the callback */
+} music_library_config_t;
+
+typedef struct {
+    uint32_t load_us;                   /*!< Time to load the cache, at creation */
+    uint32_t index_us;                  /*!< Time to index the directory, in the background */
+    uint16_t tracks;                    /*!< Number of indexed files */
+    uint16_t cached;                    /*!< Files whose metadata came from the cache */
+    uint16_t parsed;                    /*!< Files parsed by the last indexing */
+} music_library_stats_t;
+
+/**
+ * @brief Create a library, load its cache and start indexing the directory in the background
+ *
+ * @note The filesystem of `cache_path` must be mounted and writable.
+ *
+ * @param config: Library configuration
+ * @param ret_library: Output library handle
+ *
+ * @return
+ *    - ESP_OK: Success, even if the cache was missing or invalid
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t music_library_new(const music_library_config_t *config, music_library_handle_t *ret_library);
+
+/**
+ * @brief Delete a library, waits for the indexer task to stop
+ *
+ * @param library: Library handle
+ */
+void music_library_del(music_library_handle_t library);
+
+/**
+ * @brief Get the metadata of a file
+ *
+ * @param library: Library handle
+ * @param name: File name, relative to the library directory
+ * @param info: Output metadata
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NOT_FOUND: The file is not in the cache and not indexed yet
+ */
+esp_err_t music_library_get_info(music_library_handle_t library, const char *name, music_info_t *info);
+
+/**
+ * @brief Format the metadata of a file for a list, "Artist - Title  m:ss"
+ *
+ * Falls back to the file name for the parts which are unknown, or if library is NULL.
+ *
+ * @param library: Library handle
+ * @param name: File name, relative to the library directory
+ * @param buf: Output buffer
+ * @param size: Size of the buffer
+ *
+ * @return buf
+ */
+const char *music_library_format(music_library_handle_t library, const char *name, char *buf, size_t size);
+
+/**
+ * @brief Check whether the background indexing is done
+ *
+ * @param library: Library handle
+ *
+ * @return true once every file of the directory is indexed
+ */
+bool music_library_is_ready(music_library_handle_t library);
+
+/**
+ * @brief Get the load and indexing statistics
+ *
+ * @param library: Library handle
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ */
+esp_err_t music_library_get_stats(music_library_handle_t library, music_library_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
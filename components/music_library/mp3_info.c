@@ -0,0 +1,446 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_check.h"
+
+#include "mp3_info.h"
+
+#define MP3_INFO_BUF_SIZE           (2048)
+#define MP3_INFO_SYNC_SEARCH_MAX    (64 * 1024)     /*!< Give up looking for the first frame after this many bytes */
+#define MP3_INFO_TEXT_FRAME_MAX     (512)           /*!< Larger text frames are skipped, e.g. lyrics */
+#define ID3V2_HEADER_SIZE           (10)
+#define ID3V1_SIZE                  (128)
+
+typedef enum {
+    MPEG_VERSION_2_5 = 0,
+    MPEG_VERSION_RESERVED = 1,
+    MPEG_VERSION_2 = 2,
+    MPEG_VERSION_1 = 3,
+} mpeg_version_t;
+
+typedef struct {
+    mpeg_version_t version;
+    uint8_t layer;                  /*!< 1, 2 or 3 */
+    bool mono;
+    uint16_t bitrate_kbps;
+    uint16_t sample_rate_hz;
+    uint16_t samples_per_frame;
+    uint32_t frame_size;
+} mpeg_frame_t;
+
+typedef struct {
+    uint32_t tlen_ms;               /*!< TLEN frame, duration in milliseconds */
+} id3_extra_t;
+
+static const char *TAG = "mp3_info";
+
+/* [MPEG 1, MPEG 2 and 2.5][layer - 1][bitrate index] */
+static const uint16_t s_bitrate_kbps[2][3][15] = {
+    {
+        {0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448},
+        {0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384},
+        {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320},
+    }, {
+        {0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256},
+        {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160},
+        {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160},
+    },
+};
+
+/* [version][sample rate index] */
+static const uint16_t s_sample_rate_hz[4][3] = {
+    [MPEG_VERSION_2_5] = {11025, 12000, 8000},
+    [MPEG_VERSION_2] = {22050, 24000, 16000},
+    [MPEG_VERSION_1] = {44100, 48000, 32000},
+};
+
+static uint32_t be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint32_t syncsafe32(const uint8_t *p)
+{
+    return ((uint32_t)(p[0] & 0x7f) << 21) | ((uint32_t)(p[1] & 0x7f) << 14) | ((uint32_t)(p[2] & 0x7f) << 7) | (p[3] & 0x7f);
+}
+
+static bool read_at(FILE *fp, uint32_t offset, void *buf, size_t size)
+{
+    return (0 == fseek(fp, offset, SEEK_SET)) && (size == fread(buf, 1, size, fp));
+}
+
+static bool mpeg_frame_parse(const uint8_t *h, mpeg_frame_t *frame)
+{
+    if ((h[0] != 0xff) || ((h[1] & 0xe0) != 0xe0)) {
+        return false;
+    }
+    mpeg_version_t version = (h[1] >> 3) & 0x03;
+    uint8_t layer = 4 - ((h[1] >> 1) & 0x03);
+    uint8_t bitrate_index = h[2] >> 4;
+    uint8_t sample_rate_index = (h[2] >> 2) & 0x03;
+    /* Free format bitrate is not supported, its frame size is unknown */
+    if ((MPEG_VERSION_RESERVED == version) || (4 == layer) || (0 == bitrate_index) || (15 == bitrate_index) ||
+            (3 == sample_rate_index)) {
+        return false;
+    }
+
+    bool mpeg1 = (MPEG_VERSION_1 == version);
+    uint32_t padding = (h[2] >> 1) & 0x01;
+    frame->version = version;
+    frame->layer = layer;
+    frame->mono = ((h[3] >> 6) == 3);
+    frame->bitrate_kbps = s_bitrate_kbps[mpeg1 ? 0 : 1][layer - 1][bitrate_index];
+    frame->sample_rate_hz = s_sample_rate_hz[version][sample_rate_index];
+    if (1 == layer) {
+        frame->samples_per_frame = 384;
+        frame->frame_size = (12 * frame->bitrate_kbps * 1000 / frame->sample_rate_hz + padding) * 4;
+    } else {
+        frame->samples_per_frame = ((3 == layer) && !mpeg1) ? 576 : 1152;
+        frame->frame_size = frame->samples_per_frame / 8 * frame->bitrate_kbps * 1000 / frame->sample_rate_hz + padding;
+    }
+    return true;
+}
+
+/* Append a code point as UTF-8, returns false and writes nothing if it does not fit with the terminator */
+static bool utf8_put(char *out, size_t size, size_t *len, uint32_t cp)
+{
+    uint8_t bytes[4];
+    size_t n;
+
+    if (cp < 0x80) {
+        bytes[0] = cp;
+        n = 1;
+    } else if (cp < 0x800) {
+        bytes[0] = 0xc0 | (cp >> 6);
+        bytes[1] = 0x80 | (cp & 0x3f);
+        n = 2;
+    } else if (cp < 0x10000) {
+        bytes[0] = 0xe0 | (cp >> 12);
+        bytes[1] = 0x80 | ((cp >> 6) & 0x3f);
+        bytes[2] = 0x80 | (cp & 0x3f);
+        n = 3;
+    } else {
+        bytes[0] = 0xf0 | (cp >> 18);
+        bytes[1] = 0x80 | ((cp >> 12) & 0x3f);
+        bytes[2] = 0x80 | ((cp >> 6) & 0x3f);
+        bytes[3] = 0x80 | (cp & 0x3f);
+        n = 4;
+    }
+    if (*len + n >= size) {
+        return false;
+    }
+    memcpy(out + *len, bytes, n);
+    *len += n;
+    return true;
+}
+
+/* Decode an ID3 text, the first string only, to a trimmed UTF-8 string */
+static void id3_text_decode(uint8_t encoding, const uint8_t *data, size_t data_len, char *out, size_t size)
+{
+    size_t len = 0;
+    size_t i = 0;
+
+    if ((1 == encoding) || (2 == encoding)) {
+        bool big_endian = (2 == encoding);
+        if ((1 == encoding) && (data_len >= 2)) {
+            big_endian = (data[0] == 0xfe) && (data[1] == 0xff);
+            i = ((data[0] == 0xfe && data[1] == 0xff) || (data[0] == 0xff && data[1] == 0xfe)) ? 2 : 0;
+        }
+        while (i + 1 < data_len) {
+            uint32_t cp = big_endian ? ((data[i] << 8) | data[i + 1]) : ((data[i + 1] << 8) | data[i]);
+            i += 2;
+            if (0 == cp) {
+                break;
+            }
+            if ((cp >= 0xd800) && (cp < 0xdc00) && (i + 1 < data_len)) {
+                uint32_t low = big_endian ? ((data[i] << 8) | data[i + 1]) : ((data[i + 1] << 8) | data[i]);
+                i += 2;
+                cp = ((low >= 0xdc00) && (low < 0xe000)) ? 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00) : 0xfffd;
+            }
+            if (!utf8_put(out, size, &len, cp)) {
+                break;
+            }
+        }
+    } else {
+        for (; (i < data_len) && data[i]; i++) {
+            if (3 == encoding) {
+                /* Already UTF-8, stop before a multibyte character which does not fit */
+                size_t n = 1;
+                while ((i + n < data_len) && ((data[i + n] & 0xc0) == 0x80)) {
+                    n++;
+                }
+                if (len + n >= size) {
+                    break;
+                }
+                memcpy(out + len, &data[i], n);
+                len += n;
+                i += n - 1;
+            } else if (!utf8_put(out, size, &len, data[i])) {
+                break;
+            }
+        }
+    }
+
+    while (len && (out[len - 1] == ' ')) {
+        len--;
+    }
+    out[len] = '\0';
+}
+
+/* Returns the offset of the audio data, after the tag. Only skips the tag if info is NULL */
+static uint32_t id3v2_parse(FILE *fp, uint32_t file_size, music_info_t *info, id3_extra_t *extra)
+{
+    uint8_t header[ID3V2_HEADER_SIZE];
+    uint8_t data[MP3_INFO_TEXT_FRAME_MAX];
+
+    if (!read_at(fp, 0, header, sizeof(header)) || memcmp(header, "ID3", 3)) {
+        return 0;
+    }
+    uint8_t major = header[3];
+    uint8_t flags = header[5];
+    uint32_t tag_end = ID3V2_HEADER_SIZE + syncsafe32(&header[6]) + ((flags & 0x10) ? ID3V2_HEADER_SIZE : 0);
+    if ((major < 2) || (major > 4) || (tag_end > file_size)) {
+        return 0;
+    }
+    if (!info) {
+        return tag_end;
+    }
+
+    uint32_t pos = ID3V2_HEADER_SIZE;
+    if ((major > 2) && (flags & 0x40)) {
+        uint8_t ext[4];
+        if (!read_at(fp, pos, ext, sizeof(ext))) {
+            return tag_end;
+        }
+        pos += (3 == major) ? 4 + be32(ext) : syncsafe32(ext);
+    }
+
+    size_t frame_header_size = (2 == major) ? 6 : 10;
+    while (pos + frame_header_size <= tag_end) {
+        uint8_t fh[10];
+        if (!read_at(fp, pos, fh, frame_header_size) || (0 == fh[0])) {
+            break;      /* Padding */
+        }
+
+        uint32_t size;
+        char *out = NULL;
+        bool is_tlen = false;
+        bool skip = false;
+        if (2 == major) {
+            size = ((uint32_t)fh[3] << 16) | (fh[4] << 8) | fh[5];
+            out = !memcmp(fh, "TT2", 3) ? info->title : !memcmp(fh, "TP1", 3) ? info->artist : NULL;
+            is_tlen = !memcmp(fh, "TLE", 3);
+        } else {
+            size = (4 == major) ? syncsafe32(&fh[4]) : be32(&fh[4]);
+            out = !memcmp(fh, "TIT2", 4) ? info->title : !memcmp(fh, "TPE1", 4) ? info->artist : NULL;
+            is_tlen = !memcmp(fh, "TLEN", 4);
+            /* Compressed or encrypted */
+            skip = (3 == major) ? (fh[9] & 0xc0) : (fh[9] & 0x0c);
+        }
+        uint32_t data_pos = pos + frame_header_size;
+        pos = data_pos + size;
+        if ((pos > tag_end) || !size || skip || (size > sizeof(data)) || (!out && !is_tlen)) {
+            continue;
+        }
+        if ((4 == major) && (fh[9] & 0x01)) {
+            /* Data length indicator */
+            data_pos += 4;
+            size = (size > 4) ? size - 4 : 0;
+        }
+        if (!size || !read_at(fp, data_pos, data, size)) {
+            continue;
+        }
+
+        if (out) {
+            id3_text_decode(data[0], &data[1], size - 1, out, MUSIC_LIBRARY_TEXT_MAX_LEN);
+        } else {
+            char text[16];
+            id3_text_decode(data[0], &data[1], size - 1, text, sizeof(text));
+            extra->tlen_ms = strtoul(text, NULL, 10);
+        }
+    }
+    return tag_end;
+}
+
+/* Returns the end of the audio data, before the tag. Only finds the tag if info is NULL */
+static uint32_t id3v1_parse(FILE *fp, uint32_t file_size, music_info_t *info)
+{
+    uint8_t tag[ID3V1_SIZE];
+
+    if ((file_size < ID3V1_SIZE) || !read_at(fp, file_size - ID3V1_SIZE, tag, sizeof(tag)) || memcmp(tag, "TAG", 3)) {
+        return file_size;
+    }
+    if (!info) {
+        return file_size - ID3V1_SIZE;
+    }
+    /* ID3v2 wins when both are present */
+    if (!info->title[0]) {
+        id3_text_decode(0, &tag[3], 30, info->title, sizeof(info->title));
+    }
+    if (!info->artist[0]) {
+        id3_text_decode(0, &tag[33], 30, info->artist, sizeof(info->artist));
+    }
+    return file_size - ID3V1_SIZE;
+}
+
+/* Find the first frame, confirmed by the header of the next one. On success buf holds the data from the frame on. */
+static bool mpeg_frame_find(FILE *fp, uint32_t start, uint32_t end, uint8_t *buf, size_t *len, uint32_t *offset,
+                            mpeg_frame_t *frame)
+{
+    uint32_t search_end = (end - start > MP3_INFO_SYNC_SEARCH_MAX) ? start + MP3_INFO_SYNC_SEARCH_MAX : end;
+    uint32_t pos = start;
+
+    while (pos + 4 <= search_end) {
+        if (0 != fseek(fp, pos, SEEK_SET)) {
+            return false;
+        }
+        size_t n = fread(buf, 1, MP3_INFO_BUF_SIZE, fp);
+        if (n < 4) {
+            return false;
+        }
+        for (size_t i = 0; i + 4 <= n; i++) {
+            mpeg_frame_t next;
+            if (!mpeg_frame_parse(&buf[i], frame)) {
+                continue;
+            }
+            size_t next_pos = i + frame->frame_size;
+            if ((next_pos + 4 <= n) && (!mpeg_frame_parse(&buf[next_pos], &next) ||
+                                        (next.version != frame->version) || (next.layer != frame->layer) ||
+                                        (next.sample_rate_hz != frame->sample_rate_hz))) {
+                continue;
+            }
+            *offset = pos + i;
+            if (i) {
+                /* Have the frame at the start of the buffer for the VBR header */
+                if (0 != fseek(fp, *offset, SEEK_SET)) {
+                    return false;
+                }
+                n = fread(buf, 1, MP3_INFO_BUF_SIZE, fp);
+            }
+            *len = n;
+            return true;
+        }
+        pos += n - 3;
+    }
+    return false;
+}
+
+/* Xing, Info or VBRI header in the first frame, with the number of frames and bytes if present (0 otherwise) */
+static bool mpeg_vbr_header(const uint8_t *buf, size_t len, const mpeg_frame_t *frame, uint32_t *frames, uint32_t *bytes)
+{
+    size_t xing = 4;
+    if (MPEG_VERSION_1 == frame->version) {
+        xing += frame->mono ? 17 : 32;
+    } else {
+        xing += frame->mono ? 9 : 17;
+    }
+
+    *frames = 0;
+    *bytes = 0;
+    if ((xing + 16 <= len) && (!memcmp(&buf[xing], "Xing", 4) || !memcmp(&buf[xing], "Info", 4))) {
+        uint32_t flags = be32(&buf[xing + 4]);
+        size_t p = xing + 8;
+        if (flags & 0x01) {
+            *frames = be32(&buf[p]);
+            p += 4;
+        }
+        if ((flags & 0x02) && (p + 4 <= len)) {
+            *bytes = be32(&buf[p]);
+        }
+        return true;
+    }
+    if ((36 + 18 <= len) && !memcmp(&buf[36], "VBRI", 4)) {
+        *bytes = be32(&buf[36 + 10]);
+        *frames = be32(&buf[36 + 14]);
+        return true;
+    }
+    return false;
+}
+
+esp_err_t mp3_info_parse(FILE *fp, uint32_t file_size, music_info_t *info)
+{
+    id3_extra_t extra = {0};
+    mpeg_frame_t frame;
+    uint32_t offset = 0;
+    size_t len = 0;
+
+    memset(info, 0, sizeof(music_info_t));
+    uint32_t audio_start = id3v2_parse(fp, file_size, info, &extra);
+    uint32_t audio_end = id3v1_parse(fp, file_size, info);
+    if (audio_start >= audio_end) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    uint8_t *buf = malloc(MP3_INFO_BUF_SIZE);
+    ESP_RETURN_ON_FALSE(buf, ESP_ERR_NO_MEM, TAG, "no mem for parse buffer");
+    bool found = mpeg_frame_find(fp, audio_start, audio_end, buf, &len, &offset, &frame);
+    uint32_t vbr_bytes = 0;
+    uint32_t vbr_frames = 0;
+    if (found) {
+        mpeg_vbr_header(buf, len, &frame, &vbr_frames, &vbr_bytes);
+    }
+    free(buf);
+
+    if (!found) {
+        info->duration_ms = extra.tlen_ms;
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    uint32_t audio_bytes = audio_end - offset;
+    info->sample_rate_hz = frame.sample_rate_hz;
+    if (vbr_frames) {
+        info->duration_ms = (uint64_t)vbr_frames * frame.samples_per_frame * 1000 / frame.sample_rate_hz;
+    } else if (extra.tlen_ms) {
+        info->duration_ms = extra.tlen_ms;
+    } else {
+        /* Constant bitrate: kbit/s is bit/ms */
+        info->duration_ms = (uint64_t)audio_bytes * 8 / frame.bitrate_kbps;
+    }
+    if (vbr_frames && info->duration_ms) {
+        info->bitrate_kbps = (uint64_t)(vbr_bytes ? vbr_bytes : audio_bytes) * 8 / info->duration_ms;
+    } else {
+        info->bitrate_kbps = frame.bitrate_kbps;
+    }
+    return ESP_OK;
+}
+
+esp_err_t mp3_info_find_audio(FILE *fp, uint32_t file_size, mp3_audio_range_t *range)
+{
+    mpeg_frame_t frame;
+    uint32_t offset = 0;
+    size_t len = 0;
+
+    ESP_RETURN_ON_FALSE(fp && range, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    memset(range, 0, sizeof(mp3_audio_range_t));
+    uint32_t audio_start = id3v2_parse(fp, file_size, NULL, NULL);
+    uint32_t audio_end = id3v1_parse(fp, file_size, NULL);
+    if (audio_start >= audio_end) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    uint8_t *buf = malloc(MP3_INFO_BUF_SIZE);
+    ESP_RETURN_ON_FALSE(buf, ESP_ERR_NO_MEM, TAG, "no mem for parse buffer");
+    bool found = mpeg_frame_find(fp, audio_start, audio_end, buf, &len, &offset, &frame);
+    uint32_t vbr_frames = 0;
+    uint32_t vbr_bytes = 0;
+    /* The VBR header frame decodes to a frame of silence */
+    bool vbr = found && mpeg_vbr_header(buf, len, &frame, &vbr_frames, &vbr_bytes);
+    free(buf);
+    if (!found) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    range->start = vbr ? offset + frame.frame_size : offset;
+    range->end = audio_end;
+    range->sample_rate_hz = frame.sample_rate_hz;
+    range->channels = frame.mono ? 1 : 2;
+    range->layer = frame.layer;
+    range->version = frame.version;
+    return (range->start < range->end) ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
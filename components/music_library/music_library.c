@@ -0,0 +1,499 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_rom_crc.h"
+
+#include "dir_index.h"
+#include "mp3_info.h"
+#include "music_library.h"
+
+#define LIBRARY_CACHE_MAGIC         (0x4d4c)
+#define LIBRARY_CACHE_VERSION       (1)
+#define LIBRARY_TASK_STACK_SIZE     (4 * 1024)
+#define LIBRARY_PATH_MAX_LEN        (256)
+
+typedef struct __attribute__((packed)) {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t count;                 /*!< Number of records */
+    uint32_t records_size;          /*!< Size of the records, after the header */
+    uint32_t crc;                   /*!< CRC32 of the records */
+} library_cache_header_t;
+
+/* Followed by the name, title and artist, without terminators */
+typedef struct __attribute__((packed)) {
+    uint32_t file_size;
+    uint32_t mtime;
+    uint32_t duration_ms;
+    uint16_t bitrate_kbps;
+    uint16_t sample_rate_hz;
+    uint8_t name_len;
+    uint8_t title_len;
+    uint8_t artist_len;
+} library_cache_record_t;
+
+typedef struct {
+    char *name;
+    uint32_t file_size;             /*!< Cache key, with the modification time */
+    uint32_t mtime;
+    music_info_t info;
+} library_entry_t;
+
+struct music_library {
+    char *path;
+    char *cache_path;
+    music_library_ready_cb_t ready_cb;
+    void *user_ctx;
+
+    dir_index_handle_t index;
+    SemaphoreHandle_t lock;
+    SemaphoreHandle_t done;         /*!< Given by the indexer task when it exits */
+    volatile bool stop;
+
+    library_entry_t *entries;       /*!< Case insensitive name order */
+    size_t count;
+    bool ready;
+    music_library_stats_t stats;
+};
+
+static const char *TAG = "music_library";
+
+static void library_entries_free(library_entry_t *entries, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        free(entries[i].name);
+    }
+    free(entries);
+}
+
+static library_entry_t *library_find(music_library_handle_t library, const char *name)
+{
+    size_t low = 0;
+    size_t high = library->count;
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        int cmp = strcasecmp(library->entries[mid].name, name);
+        if (0 == cmp) {
+            return &library->entries[mid];
+        } else if (cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return NULL;
+}
+
+static bool library_entry_cacheable(const library_entry_t *entry)
+{
+    /* Names longer than a record can hold are indexed but not cached, tags always fit */
+    return strlen(entry->name) <= UINT8_MAX;
+}
+
+static esp_err_t library_cache_load(music_library_handle_t library)
+{
+    esp_err_t ret = ESP_OK;
+    struct stat st;
+    size_t blob_size = 0;
+    uint8_t *blob = NULL;
+    library_cache_header_t header;
+
+    /* No cache file yet is a first boot, not an error */
+    if ((0 != stat(library->cache_path, &st)) || (st.st_size < (off_t)sizeof(header))) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (st.st_size > CONFIG_MUSIC_LIBRARY_CACHE_MAX_SIZE) {
+        ESP_LOGW(TAG, "Cache of %ld bytes over the limit, ignored", (long)st.st_size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    FILE *fp = fopen(library->cache_path, "rb");
+    if (!fp) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    blob_size = st.st_size;
+    blob = malloc(blob_size);
+    ESP_GOTO_ON_FALSE(blob, ESP_ERR_NO_MEM, exit, TAG, "no mem for cache");
+    ESP_GOTO_ON_FALSE(blob_size == fread(blob, 1, blob_size, fp), ESP_FAIL, exit, TAG, "read cache failed");
+
+    memcpy(&header, blob, sizeof(header));
+    const uint8_t *records = blob + sizeof(header);
+    ESP_GOTO_ON_FALSE((LIBRARY_CACHE_MAGIC == header.magic) && (LIBRARY_CACHE_VERSION == header.version) &&
+                      (header.records_size == blob_size - sizeof(header)) &&
+                      (header.crc == esp_rom_crc32_le(0, records, header.records_size)),
+                      ESP_ERR_INVALID_VERSION, exit, TAG, "invalid cache");
+
+    library->entries = calloc(header.count, sizeof(library_entry_t));
+    ESP_GOTO_ON_FALSE(library->entries || !header.count, ESP_ERR_NO_MEM, exit, TAG, "no mem for %u entries", header.count);
+
+    size_t pos = 0;
+    for (size_t i = 0; i < header.count; i++) {
+        library_cache_record_t record;
+        ESP_GOTO_ON_FALSE(pos + sizeof(record) <= header.records_size, ESP_ERR_INVALID_SIZE, err, TAG, "truncated cache");
+        memcpy(&record, records + pos, sizeof(record));
+        pos += sizeof(record);
+        ESP_GOTO_ON_FALSE((record.title_len < MUSIC_LIBRARY_TEXT_MAX_LEN) && (record.artist_len < MUSIC_LIBRARY_TEXT_MAX_LEN) &&
+                          (pos + record.name_len + record.title_len + record.artist_len <= header.records_size),
+                          ESP_ERR_INVALID_SIZE, err, TAG, "truncated cache");
+
+        library_entry_t *entry = &library->entries[i];
+        entry->name = strndup((const char *)records + pos, record.name_len);
+        ESP_GOTO_ON_FALSE(entry->name, ESP_ERR_NO_MEM, err, TAG, "no mem for names");
+        pos += record.name_len;
+        memcpy(entry->info.title, records + pos, record.title_len);
+        pos += record.title_len;
+        memcpy(entry->info.artist, records + pos, record.artist_len);
+        pos += record.artist_len;
+        entry->file_size = record.file_size;
+        entry->mtime = record.mtime;
+        entry->info.duration_ms = record.duration_ms;
+        entry->info.bitrate_kbps = record.bitrate_kbps;
+        entry->info.sample_rate_hz = record.sample_rate_hz;
+        library->count++;
+    }
+    goto exit;
+
+err:
+    library_entries_free(library->entries, library->count);
+    library->entries = NULL;
+    library->count = 0;
+exit:
+    free(blob);
+    fclose(fp);
+    return ret;
+}
+
+static esp_err_t library_cache_save(music_library_handle_t library)
+{
+    esp_err_t ret = ESP_OK;
+    char tmp_path[LIBRARY_PATH_MAX_LEN];
+    size_t records_size = 0;
+
+    for (size_t i = 0; i < library->count; i++) {
+        const library_entry_t *entry = &library->entries[i];
+        if (library_entry_cacheable(entry)) {
+            records_size += sizeof(library_cache_record_t) + strlen(entry->name) + strlen(entry->info.title) +
+                            strlen(entry->info.artist);
+        }
+    }
+    /* A library too large for the cache is indexed on every boot, a stale cache would only be loaded for nothing */
+    size_t blob_size = sizeof(library_cache_header_t) + records_size;
+    if (blob_size > CONFIG_MUSIC_LIBRARY_CACHE_MAX_SIZE) {
+        ESP_LOGW(TAG, "Cache of %s would need %u bytes, over the limit, not saved", library->path, (unsigned)blob_size);
+        remove(library->cache_path);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    uint8_t *blob = malloc(blob_size);
+    ESP_RETURN_ON_FALSE(blob, ESP_ERR_NO_MEM, TAG, "no mem for cache");
+
+    uint8_t *p = blob + sizeof(library_cache_header_t);
+    size_t count = 0;
+    for (size_t i = 0; i < library->count; i++) {
+        const library_entry_t *entry = &library->entries[i];
+        if (!library_entry_cacheable(entry)) {
+            continue;
+        }
+        library_cache_record_t record = {
+            .file_size = entry->file_size,
+            .mtime = entry->mtime,
+            .duration_ms = entry->info.duration_ms,
+            .bitrate_kbps = entry->info.bitrate_kbps,
+            .sample_rate_hz = entry->info.sample_rate_hz,
+            .name_len = strlen(entry->name),
+            .title_len = strlen(entry->info.title),
+            .artist_len = strlen(entry->info.artist),
+        };
+        memcpy(p, &record, sizeof(record));
+        p += sizeof(record);
+        memcpy(p, entry->name, record.name_len);
+        p += record.name_len;
+        memcpy(p, entry->info.title, record.title_len);
+        p += record.title_len;
+        memcpy(p, entry->info.artist, record.artist_len);
+        p += record.artist_len;
+        count++;
+    }
+
+    library_cache_header_t header = {
+        .magic = LIBRARY_CACHE_MAGIC,
+        .version = LIBRARY_CACHE_VERSION,
+        .count = count,
+        .records_size = records_size,
+        .crc = esp_rom_crc32_le(0, blob + sizeof(header), records_size),
+    };
+    memcpy(blob, &header, sizeof(header));
+
+    /* Written aside first, a reset while writing leaves the previous cache or none, never a partial one */
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", library->cache_path);
+    FILE *fp = fopen(tmp_path, "wb");
+    ESP_GOTO_ON_FALSE(fp, ESP_FAIL, exit, TAG, "open %s failed", tmp_path);
+    bool written = (blob_size == fwrite(blob, 1, blob_size, fp));
+    written &= (0 == fclose(fp));
+    if (written) {
+        /* Neither SPIFFS nor FATFS rename over an existing file */
+        remove(library->cache_path);
+        written = (0 == rename(tmp_path, library->cache_path));
+    }
+    if (!written) {
+        remove(tmp_path);
+    }
+    ESP_GOTO_ON_FALSE(written, ESP_FAIL, exit, TAG, "write cache failed, %u bytes", (unsigned)blob_size);
+    ESP_LOGI(TAG, "Cache of %s saved, %u bytes", library->path, (unsigned)blob_size);
+
+exit:
+    free(blob);
+    return ret;
+}
+
+static void library_index_file(music_library_handle_t library, const char *name, library_entry_t *entry, bool *parsed)
+{
+    char path[LIBRARY_PATH_MAX_LEN];
+    struct stat st = {0};
+
+    *parsed = false;
+    snprintf(path, sizeof(path), "%s/%s", library->path, name);
+    stat(path, &st);
+    entry->file_size = st.st_size;
+    entry->mtime = st.st_mtime;
+
+    /* Without a modification time, a file of the same size is assumed unchanged */
+    const library_entry_t *cached = library_find(library, name);
+    if (cached && (cached->file_size == entry->file_size) && (cached->mtime == entry->mtime)) {
+        entry->info = cached->info;
+        return;
+    }
+
+    *parsed = true;
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        ESP_LOGW(TAG, "open %s failed", path);
+        return;
+    }
+    if (ESP_OK != mp3_info_parse(fp, entry->file_size, &entry->info)) {
+        ESP_LOGW(TAG, "%s: no MPEG audio found", name);
+    }
+    fclose(fp);
+}
+
+static void library_index_task(void *arg)
+{
+    music_library_handle_t library = (music_library_handle_t)arg;
+    library_entry_t *entries = NULL;
+    size_t count = 0;
+    uint16_t cached = 0;
+    uint16_t parsed = 0;
+    int64_t start = esp_timer_get_time();
+
+    if (ESP_OK == dir_index_refresh(library->index, NULL)) {
+        size_t total = dir_index_count(library->index);
+        entries = calloc(total, sizeof(library_entry_t));
+        if (!entries && total) {
+            ESP_LOGE(TAG, "no mem for %u entries", (unsigned)total);
+            total = 0;
+        }
+
+        /* Only this task changes the entries, reading them does not need the lock */
+        while ((count < total) && (count < UINT16_MAX) && !library->stop) {
+            bool file_parsed;
+            library_entry_t *entry = &entries[count];
+            const char *name = dir_index_get_sorted_name(library->index, count);
+            entry->name = strdup(name);
+            if (!entry->name) {
+                ESP_LOGE(TAG, "no mem for names");
+                break;
+            }
+            library_index_file(library, name, entry, &file_parsed);
+            parsed += file_parsed;
+            cached += !file_parsed;
+            count++;
+        }
+    }
+
+    if (library->stop) {
+        library_entries_free(entries, count);
+        xSemaphoreGive(library->done);
+        vTaskDelete(NULL);
+    }
+
+    /* Parsed, added or removed files */
+    bool dirty = parsed || (cached != library->count);
+
+    xSemaphoreTake(library->lock, portMAX_DELAY);
+    library_entries_free(library->entries, library->count);
+    library->entries = entries;
+    library->count = count;
+    library->ready = true;
+    library->stats.index_us = (uint32_t)(esp_timer_get_time() - start);
+    library->stats.tracks = count;
+    library->stats.cached = cached;
+    library->stats.parsed = parsed;
+    xSemaphoreGive(library->lock);
+
+    ESP_LOGI(TAG, "%s indexed: %u tracks, %u from cache, %u parsed, in %"PRIu32" ms", library->path, (unsigned)count,
+             cached, parsed, library->stats.index_us / 1000);
+
+    if (dirty && library->cache_path) {
+        library_cache_save(library);
+    }
+    if (library->ready_cb) {
+        library->ready_cb(library, library->user_ctx);
+    }
+
+    xSemaphoreGive(library->done);
+    vTaskDelete(NULL);
+}
+
+esp_err_t music_library_new(const music_library_config_t *config, music_library_handle_t *ret_library)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(config && config->path && ret_library, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    music_library_handle_t library = calloc(1, sizeof(struct music_library));
+    ESP_RETURN_ON_FALSE(library, ESP_ERR_NO_MEM, TAG, "no mem for library");
+    library->ready_cb = config->ready_cb;
+    library->user_ctx = config->user_ctx;
+    library->path = strdup(config->path);
+    library->cache_path = config->cache_path ? strdup(config->cache_path) : NULL;
+    library->lock = xSemaphoreCreateMutex();
+    library->done = xSemaphoreCreateBinary();
+    ESP_GOTO_ON_FALSE(library->path && (library->cache_path || !config->cache_path) && library->lock && library->done,
+                      ESP_ERR_NO_MEM, err, TAG, "no mem for library");
+
+    const dir_index_config_t index_config = {
+        .path = config->path,
+        .suffix = config->suffix,
+        .sort = true,
+    };
+    ESP_GOTO_ON_ERROR(dir_index_new(&index_config, &library->index), err, TAG, "create index failed");
+
+    if (library->cache_path) {
+        int64_t start = esp_timer_get_time();
+        if (ESP_OK == library_cache_load(library)) {
+            library->stats.load_us = (uint32_t)(esp_timer_get_time() - start);
+            ESP_LOGI(TAG, "Cache of %s: %u tracks loaded in %"PRIu32" us", library->path, (unsigned)library->count,
+                     library->stats.load_us);
+        } else {
+            ESP_LOGI(TAG, "No cache of %s, indexing every file", library->path);
+        }
+    }
+
+    ESP_GOTO_ON_FALSE(pdPASS == xTaskCreatePinnedToCore(library_index_task, "Music Library", LIBRARY_TASK_STACK_SIZE,
+                                                        library, config->task_priority, NULL, config->task_core),
+                      ESP_ERR_NO_MEM, err, TAG, "create indexer task failed");
+
+    *ret_library = library;
+    return ESP_OK;
+
+err:
+    /* The task was not started */
+    dir_index_del(library->index);
+    library_entries_free(library->entries, library->count);
+    if (library->done) {
+        vSemaphoreDelete(library->done);
+    }
+    if (library->lock) {
+        vSemaphoreDelete(library->lock);
+    }
+    free(library->cache_path);
+    free(library->path);
+    free(library);
+    return ret;
+}
+
+void music_library_del(music_library_handle_t library)
+{
+    if (!library) {
+        return;
+    }
+
+    library->stop = true;
+    xSemaphoreTake(library->done, portMAX_DELAY);
+
+    dir_index_del(library->index);
+    library_entries_free(library->entries, library->count);
+    vSemaphoreDelete(library->done);
+    vSemaphoreDelete(library->lock);
+    free(library->cache_path);
+    free(library->path);
+    free(library);
+}
+
+esp_err_t music_library_get_info(music_library_handle_t library, const char *name, music_info_t *info)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(library && name && info, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    xSemaphoreTake(library->lock, portMAX_DELAY);
+    const library_entry_t *entry = library_find(library, name);
+    if (entry) {
+        *info = entry->info;
+    } else {
+        ret = ESP_ERR_NOT_FOUND;
+    }
+    xSemaphoreGive(library->lock);
+    return ret;
+}
+
+const char *music_library_format(music_library_handle_t library, const char *name, char *buf, size_t size)
+{
+    music_info_t info;
+
+    if (!buf || !size) {
+        return buf;
+    }
+    if (!library || !name || (ESP_OK != music_library_get_info(library, name, &info))) {
+        snprintf(buf, size, "%s", name ? name : "");
+        return buf;
+    }
+
+    int len;
+    if (info.title[0] && info.artist[0]) {
+        len = snprintf(buf, size, "%s - %s", info.artist, info.title);
+    } else {
+        len = snprintf(buf, size, "%s", info.title[0] ? info.title : name);
+    }
+    if (info.duration_ms && (len >= 0) && ((size_t)len < size)) {
+        uint32_t seconds = info.duration_ms / 1000;
+        snprintf(buf + len, size - len, "  %"PRIu32":%02"PRIu32, seconds / 60, seconds % 60);
+    }
+    return buf;
+}
+
+bool music_library_is_ready(music_library_handle_t library)
+{
+    if (!library) {
+        return false;
+    }
+
+    xSemaphoreTake(library->lock, portMAX_DELAY);
+    bool ready = library->ready;
+    xSemaphoreGive(library->lock);
+    return ready;
+}
+
+esp_err_t music_library_get_stats(music_library_handle_t library, music_library_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(library && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    xSemaphoreTake(library->lock, portMAX_DELAY);
+    *stats = library->stats;
+    xSemaphoreGive(library->lock);
+    return ESP_OK;
+}
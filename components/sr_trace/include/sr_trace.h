@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Latency trace of the speech pipeline
+ *
+ * Each stage is timed with `sr_trace_begin` and `sr_trace_end` into a histogram of power of two microsecond buckets.
+ * The AFE feed and MultiNet detect stages, which only compute, use the CPU cycle counter. The stages which may block,
+ * for as long as the pipeline is paused, use esp_timer, whose 32 bit difference wraps after 71 minutes instead of
+ * 17.9 s at 240 MHz. So do all stages when power management may change the CPU frequency. Every stage has a single
+ * writer task, so recording takes no lock; a reader may see a stage in the middle of an update.
+ */
+typedef enum {
+    SR_TRACE_I2S_READ = 0,      /*!< I2S read of one feed chunk */
+    SR_TRACE_AFE_FEED,          /*!< AFE feed of one chunk */
+    SR_TRACE_AFE_FETCH,         /*!< AFE fetch, waiting for the feed task included */
+    SR_TRACE_MN_DETECT,         /*!< MultiNet detect of one chunk */
+    SR_TRACE_RESULT_QUEUE,      /*!< From sending a result to the handler task receiving it */
+    SR_TRACE_ACTION,            /*!< Action of a detected command in the handler task */
+    SR_TRACE_STAGE_MAX,
+} sr_trace_stage_t;
+
+#define SR_TRACE_HIST_BUCKETS   20  /*!< Bucket i counts durations in [2^i, 2^(i+1)) us, the last one everything above */
+
+typedef struct {
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t histogram[SR_TRACE_HIST_BUCKETS];
+} sr_trace_stage_stats_t;
+
+typedef struct {
+    uint32_t sent;              /*!< Results queued */
+    uint32_t dropped;           /*!< Results dropped, the queue was full */
+    uint32_t max_depth;         /*!< Most results waiting in the queue */
+} sr_trace_queue_stats_t;
+
+#if CONFIG_SR_TRACE_ENABLE
+/**
+ * @brief Timestamp the beginning of a stage
+ *
+ * @param stage: Stage
+ *
+ * @return Timestamp to pass to `sr_trace_end`
+ */
+uint32_t sr_trace_begin(sr_trace_stage_t stage);
+
+/**
+ * @brief Record the end of a stage
+ *
+ * @param stage: Stage
+ * @param stamp: Timestamp returned by `sr_trace_begin` for the same stage
+ */
+void sr_trace_end(sr_trace_stage_t stage, uint32_t stamp);
+
+/**
+ * @brief Record a result sent to the result queue
+ *
+ * @param sent: The result was queued
+ * @param depth: Results waiting in the queue after sending
+ */
+void sr_trace_queue_send(bool sent, uint32_t depth);
+#else
+static inline uint32_t sr_trace_begin(sr_trace_stage_t stage)
+{
+    return 0;
+}
+
+static inline void sr_trace_end(sr_trace_stage_t stage, uint32_t stamp)
+{
+}
+
+static inline void sr_trace_queue_send(bool sent, uint32_t depth)
+{
+}
+#endif
+
+/**
+ * @brief Get the statistics of a stage
+ *
+ * @param stage: Stage
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ */
+esp_err_t sr_trace_get_stage(sr_trace_stage_t stage, sr_trace_stage_stats_t *stats);
+
+/**
+ * @brief Get the result queue counters
+ *
+ * @param stats: Output counters
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ */
+esp_err_t sr_trace_get_queue(sr_trace_queue_stats_t *stats);
+
+/**
+ * @brief Clear all statistics
+ */
+void sr_trace_reset(void);
+
+/**
+ * @brief Print all statistics as a table
+ */
+void sr_trace_print(void);
+
+/**
+ * @brief Size of the binary dump
+ */
+size_t sr_trace_dump_size(void);
+
+/**
+ * @brief Dump all statistics in a little endian binary format
+ *
+ * Header: "SRTR", u16 version (1), u8 number of stages, u8 number of buckets, then the sent, dropped and max depth
+ * queue counters as u32. Then for each stage: count, last us, max us as u32, total us as u64 and the buckets as u32.
+ *
+ * @param buf: Output buffer
+ * @param size: Size of buf, at least `sr_trace_dump_size()`
+ * @param ret_len: Output number of bytes written
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_SIZE: Buffer too small
+ */
+esp_err_t sr_trace_dump(uint8_t *buf, size_t size, size_t *ret_len);
+
+/**
+ * @brief Run the trace command on its arguments, the command name excluded
+ *
+ * No argument prints the statistics, "reset" clears them, "dump" prints the binary dump as hex and "dump <path>"
+ * writes it to a file. For consoles which register commands their own way.
+ *
+ * @param argc: Number of arguments
+ * @param argv: Arguments
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Unknown arguments
+ *    - ESP_FAIL: Writing the file failed
+ */
+esp_err_t sr_trace_cmd_run(int argc, char **argv);
+
+/**
+ * @brief Register the `srtrace` console command, which runs `sr_trace_cmd_run`
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - Others: Fail
+ */
+esp_err_t sr_trace_register_cmd(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esp_console.h"
+#include "sr_trace.h"
+
+#define SR_TRACE_DUMP_VERSION   1
+#define SR_TRACE_DUMP_HEADER    (4 + 2 + 1 + 1 + 3 * 4)
+#define SR_TRACE_DUMP_STAGE     (3 * 4 + 8 + SR_TRACE_HIST_BUCKETS * 4)
+
+static const char *TAG = "sr_trace";
+
+static const char *const s_stage_names[SR_TRACE_STAGE_MAX] = {
+    [SR_TRACE_I2S_READ] = "i2s read",
+    [SR_TRACE_AFE_FEED] = "afe feed",
+    [SR_TRACE_AFE_FETCH] = "afe fetch",
+    [SR_TRACE_MN_DETECT] = "mn detect",
+    [SR_TRACE_RESULT_QUEUE] = "result queue",
+    [SR_TRACE_ACTION] = "action",
+};
+
+static sr_trace_stage_stats_t s_stages[SR_TRACE_STAGE_MAX];
+static sr_trace_queue_stats_t s_queue;
+
+#if CONFIG_SR_TRACE_ENABLE
+/**
+ * @brief The cycle count difference wraps after 2^32 cycles, 17.9 s at 240 MHz, so only compute stages use it
+ */
+static inline bool sr_trace_uses_cycles(sr_trace_stage_t stage)
+{
+#if CONFIG_PM_ENABLE
+    return false;
+#else
+    return (SR_TRACE_AFE_FEED == stage) || (SR_TRACE_MN_DETECT == stage);
+#endif
+}
+
+uint32_t sr_trace_begin(sr_trace_stage_t stage)
+{
+    return sr_trace_uses_cycles(stage) ? (uint32_t)esp_cpu_get_cycle_count() : (uint32_t)esp_timer_get_time();
+}
+
+void sr_trace_end(sr_trace_stage_t stage, uint32_t stamp)
+{
+    if (stage >= SR_TRACE_STAGE_MAX) {
+        return;
+    }
+
+    uint32_t us;
+    if (sr_trace_uses_cycles(stage)) {
+        us = ((uint32_t)esp_cpu_get_cycle_count() - stamp) / esp_rom_get_cpu_ticks_per_us();
+    } else {
+        us = (uint32_t)esp_timer_get_time() - stamp;
+    }
+
+    int bucket = us ? (31 - __builtin_clz(us)) : 0;
+    if (bucket >= SR_TRACE_HIST_BUCKETS) {
+        bucket = SR_TRACE_HIST_BUCKETS - 1;
+    }
+
+    sr_trace_stage_stats_t *stats = &s_stages[stage];
+    stats->count++;
+    stats->last_us = us;
+    stats->max_us = (us > stats->max_us) ? us : stats->max_us;
+    stats->total_us += us;
+    stats->histogram[bucket]++;
+}
+
+void sr_trace_queue_send(bool sent, uint32_t depth)
+{
+    if (sent) {
+        s_queue.sent++;
+    } else {
+        s_queue.dropped++;
+    }
+    s_queue.max_depth = (depth > s_queue.max_depth) ? depth : s_queue.max_depth;
+}
+#endif
+
+esp_err_t sr_trace_get_stage(sr_trace_stage_t stage, sr_trace_stage_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE((stage < SR_TRACE_STAGE_MAX) && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    *stats = s_stages[stage];
+    return ESP_OK;
+}
+
+esp_err_t sr_trace_get_queue(sr_trace_queue_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    *stats = s_queue;
+    return ESP_OK;
+}
+
+void sr_trace_reset(void)
+{
+    memset(s_stages, 0, sizeof(s_stages));
+    memset(&s_queue, 0, sizeof(s_queue));
+}
+
+/**
+ * @brief Duration at a percentile of a histogram, the upper bound of its bucket capped to the maximum
+ */
+static uint32_t sr_trace_percentile(const sr_trace_stage_stats_t *stats, uint32_t percent)
+{
+    uint64_t rank = ((uint64_t)stats->count * percent + 99) / 100;
+    uint64_t seen = 0;
+    for (int i = 0; (i < SR_TRACE_HIST_BUCKETS - 1) && stats->count; i++) {
+        seen += stats->histogram[i];
+        if (seen >= rank) {
+            uint32_t bound = (2u << i) - 1;
+            return (bound < stats->max_us) ? bound : stats->max_us;
+        }
+    }
+    return stats->max_us;
+}
+
+void sr_trace_print(void)
+{
+    sr_trace_stage_stats_t stats;
+    sr_trace_queue_stats_t queue;
+
+    printf("%-14s %8s %9s %9s %9s %9s\n", "stage", "count", "avg us", "p50 us", "p99 us", "max us");
+    for (int i = 0; i < SR_TRACE_STAGE_MAX; i++) {
+        sr_trace_get_stage(i, &stats);
+        printf("%-14s %8u %9u %9u %9u %9u\n", s_stage_names[i], (unsigned)stats.count,
+               (unsigned)(stats.count ? stats.total_us / stats.count : 0), (unsigned)sr_trace_percentile(&stats, 50),
+               (unsigned)sr_trace_percentile(&stats, 99), (unsigned)stats.max_us);
+    }
+    sr_trace_get_queue(&queue);
+    printf("result queue: %u sent, %u dropped, max depth %u\n", (unsigned)queue.sent, (unsigned)queue.dropped,
+           (unsigned)queue.max_depth);
+}
+
+size_t sr_trace_dump_size(void)
+{
+    return SR_TRACE_DUMP_HEADER + SR_TRACE_STAGE_MAX * SR_TRACE_DUMP_STAGE;
+}
+
+static uint8_t *sr_trace_put_u32(uint8_t *p, uint32_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+    return p + 4;
+}
+
+esp_err_t sr_trace_dump(uint8_t *buf, size_t size, size_t *ret_len)
+{
+    ESP_RETURN_ON_FALSE(buf && ret_len, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(size >= sr_trace_dump_size(), ESP_ERR_INVALID_SIZE, TAG, "buffer too small");
+
+    sr_trace_queue_stats_t queue;
+    sr_trace_get_queue(&queue);
+
+    uint8_t *p = buf;
+    memcpy(p, "SRTR", 4);
+    p += 4;
+    *p++ = SR_TRACE_DUMP_VERSION & 0xff;
+    *p++ = SR_TRACE_DUMP_VERSION >> 8;
+    *p++ = SR_TRACE_STAGE_MAX;
+    *p++ = SR_TRACE_HIST_BUCKETS;
+    p = sr_trace_put_u32(p, queue.sent);
+    p = sr_trace_put_u32(p, queue.dropped);
+    p = sr_trace_put_u32(p, queue.max_depth);
+
+    for (int i = 0; i < SR_TRACE_STAGE_MAX; i++) {
+        sr_trace_stage_stats_t stats;
+        sr_trace_get_stage(i, &stats);
+        p = sr_trace_put_u32(p, stats.count);
+        p = sr_trace_put_u32(p, stats.last_us);
+        p = sr_trace_put_u32(p, stats.max_us);
+        p = sr_trace_put_u32(p, (uint32_t)stats.total_us);
+        p = sr_trace_put_u32(p, (uint32_t)(stats.total_us >> 32));
+        for (int j = 0; j < SR_TRACE_HIST_BUCKETS; j++) {
+            p = sr_trace_put_u32(p, stats.histogram[j]);
+        }
+    }
+    *ret_len = p - buf;
+    return ESP_OK;
+}
+
+static esp_err_t sr_trace_dump_to(const char *path)
+{
+    uint8_t buf[SR_TRACE_DUMP_HEADER + SR_TRACE_STAGE_MAX * SR_TRACE_DUMP_STAGE];
+    size_t len;
+    ESP_RETURN_ON_ERROR(sr_trace_dump(buf, sizeof(buf), &len), TAG, "dump failed");
+
+    if (NULL == path) {
+        for (size_t i = 0; i < len; i++) {
+            printf("%02x%s", buf[i], ((i % 32) == 31) ? "\n" : "");
+        }
+        printf("\n");
+        return ESP_OK;
+    }
+
+    FILE *fp = fopen(path, "wb");
+    ESP_RETURN_ON_FALSE(fp, ESP_FAIL, TAG, "create %s failed", path);
+    size_t written = fwrite(buf, 1, len, fp);
+    fclose(fp);
+    ESP_RETURN_ON_FALSE(written == len, ESP_FAIL, TAG, "write %s failed", path);
+    printf("%u bytes written to %s\n", (unsigned)len, path);
+    return ESP_OK;
+}
+
+esp_err_t sr_trace_cmd_run(int argc, char **argv)
+{
+    if (0 == argc) {
+        sr_trace_print();
+        return ESP_OK;
+    }
+    if ((1 == argc) && (0 == strcmp(argv[0], "reset"))) {
+        sr_trace_reset();
+        return ESP_OK;
+    }
+    if ((argc <= 2) && (0 == strcmp(argv[0], "dump"))) {
+        return sr_trace_dump_to((2 == argc) ? argv[1] : NULL);
+    }
+    printf("usage: srtrace [reset | dump [<path>]]\n");
+    return ESP_ERR_INVALID_ARG;
+}
+
+static int sr_trace_cmd(int argc, char **argv)
+{
+    return (ESP_OK == sr_trace_cmd_run(argc - 1, argv + 1)) ? 0 : 1;
+}
+
+esp_err_t sr_trace_register_cmd(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "srtrace",
+        .help = "Speech pipeline latency per stage. 'reset' clears it, 'dump [<path>]' dumps it in binary",
+        .hint = "[reset | dump [<path>]]",
+        .func = sr_trace_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
@@ -0,0 +1,231 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Telemetry of heap, tasks and application counters
+ *
+ * A low priority task samples the heaps, the CPU load of each core and the application counters every period into a
+ * ring of the last CONFIG_TELEMETRY_RING_SAMPLES samples, so trends such as a shrinking minimum free heap or a growing
+ * PSRAM fragmentation show over a long run. With CONFIG_TELEMETRY_TASKS it also keeps the CPU load and the stack high
+ * water mark of each task over the last period.
+ *
+ * Counters are plain atomic additions, free to update from any task. A sample walks the heaps and the task list once,
+ * which takes well under a millisecond every few seconds: its own duration is part of the sample.
+ */
+
+#define TELEMETRY_NAME_LEN      16  /*!< Longest counter or task name, terminating zero included */
+#define TELEMETRY_MAX_CORES     2   /*!< Cores in a sample, the load of a missing core is 0 */
+
+typedef struct {
+    uint32_t time_ms;               /*!< Time since boot */
+    uint32_t internal_free;         /*!< Free bytes of the internal 8 bit capable heap */
+    uint32_t internal_min_free;     /*!< Lowest free bytes of the internal heap since boot */
+    uint32_t internal_largest;      /*!< Largest free block of the internal heap */
+    uint32_t psram_free;            /*!< Free bytes of PSRAM, 0 without PSRAM */
+    uint32_t psram_min_free;        /*!< Lowest free bytes of PSRAM since boot */
+    uint32_t psram_largest;         /*!< Largest free block of PSRAM */
+    uint16_t cpu_load[TELEMETRY_MAX_CORES]; /*!< Busy time of each core over the period, in 0.1 % */
+    uint16_t tasks;                 /*!< Number of tasks */
+    uint16_t min_stack_free;        /*!< Lowest stack high water mark of all tasks, in bytes */
+    uint32_t collect_us;            /*!< Time spent collecting this sample */
+    uint32_t counters[CONFIG_TELEMETRY_MAX_COUNTERS]; /*!< Application counters, in registration order */
+} telemetry_sample_t;
+
+typedef struct {
+    char name[TELEMETRY_NAME_LEN];  /*!< Task name */
+    uint16_t cpu_load;              /*!< Running time over the last period, in 0.1 % of one core */
+    uint16_t stack_free;            /*!< Stack high water mark, in bytes */
+    int8_t core;                    /*!< Core the task is pinned to, -1 for any */
+    uint8_t priority;               /*!< Current priority */
+} telemetry_task_t;
+
+/**
+ * @brief New sample collected, called from the telemetry task
+ *
+ * @param sample: The sample, valid during the call only
+ * @param user_ctx: User context passed to `telemetry_set_sample_cb`
+ */
+typedef void (*telemetry_sample_cb_t)(const telemetry_sample_t *sample, void *user_ctx);
+
+typedef struct {
+    uint32_t period_ms;             /*!< Sampling period */
+    int task_priority;              /*!< Priority of the sampling task */
+    int task_core;                  /*!< Core of the task, tskNO_AFFINITY for any */
+} telemetry_config_t;
+
+#define TELEMETRY_DEFAULT_CONFIG() {                \
+        .period_ms = CONFIG_TELEMETRY_PERIOD_MS,    \
+        .task_priority = 1,                         \
+        .task_core = tskNO_AFFINITY,                \
+    }
+
+/**
+ * @brief Start sampling
+ *
+ * @param config: Configuration
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Already started
+ *    - ESP_ERR_NO_MEM: No memory for the ring or the task
+ */
+esp_err_t telemetry_start(const telemetry_config_t *config);
+
+/**
+ * @brief Register an application counter, sampled with the heaps
+ *
+ * @note May be called before `telemetry_start`. Registering a name again returns the same counter.
+ *
+ * @param name: Name, at most TELEMETRY_NAME_LEN - 1 characters are kept
+ * @param id: Output counter id
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NO_MEM: CONFIG_TELEMETRY_MAX_COUNTERS counters already registered
+ */
+esp_err_t telemetry_counter_register(const char *name, int *id);
+
+/**
+ * @brief Add to a counter, from any task
+ *
+ * @param id: Counter id, ignored if not registered
+ * @param delta: Value to add
+ */
+void telemetry_counter_add(int id, uint32_t delta);
+
+/**
+ * @brief Set a counter used as a gauge, from any task
+ *
+ * @param id: Counter id, ignored if not registered
+ * @param value: New value
+ */
+void telemetry_counter_set(int id, uint32_t value);
+
+/**
+ * @brief Call a function with each new sample, e.g. to publish it
+ *
+ * @param cb: Callback, NULL to remove it
+ * @param user_ctx: User context of cb
+ */
+void telemetry_set_sample_cb(telemetry_sample_cb_t cb, void *user_ctx);
+
+/**
+ * @brief Get the most recent sample
+ *
+ * @param sample: Output sample
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NOT_FOUND: No sample yet
+ */
+esp_err_t telemetry_get_latest(telemetry_sample_t *sample);
+
+/**
+ * @brief Get the samples of the ring, oldest first
+ *
+ * @param samples: Output samples
+ * @param max: Room in samples
+ *
+ * @return Number of samples written, the most recent ones if max is less than the ring holds
+ */
+size_t telemetry_get_samples(telemetry_sample_t *samples, size_t max);
+
+/**
+ * @brief Get the tasks of the most recent sample, with CONFIG_TELEMETRY_TASKS
+ *
+ * @param tasks: Output tasks
+ * @param max: Room in tasks
+ *
+ * @return Number of tasks written
+ */
+size_t telemetry_get_tasks(telemetry_task_t *tasks, size_t max);
+
+/**
+ * @brief Clear the ring, the counters keep their values
+ */
+void telemetry_reset(void);
+
+/**
+ * @brief Print the most recent sample and the tasks
+ */
+void telemetry_print(void);
+
+/**
+ * @brief Print the ring, one sample per line
+ */
+void telemetry_print_history(void);
+
+/**
+ * @brief Size of the binary dump of the current ring
+ */
+size_t telemetry_dump_size(void);
+
+/**
+ * @brief Dump the ring in a little endian binary format
+ *
+ * Header: "TLMY", u16 version (1), u8 number of cores, u8 number of counters, u16 number of samples, u16 bytes per
+ * sample, u32 period in ms, then the counter names in TELEMETRY_NAME_LEN bytes each. Then each sample, oldest first:
+ * time ms, internal free, min free and largest block, PSRAM free, min free and largest block as u32, the load of each
+ * core as u16, tasks and lowest stack free as u16, collect us as u32, and the counters as u32.
+ *
+ * @note Only the most recent samples which fit are dumped, if the ring grew since `telemetry_dump_size()`.
+ *
+ * @param buf: Output buffer
+ * @param size: Size of buf, `telemetry_dump_size()` for the whole ring
+ * @param ret_len: Output number of bytes written
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_SIZE: Buffer too small for the header
+ */
+esp_err_t telemetry_dump(uint8_t *buf, size_t size, size_t *ret_len);
+
+/**
+ * @brief Run the telemetry command on its arguments, the command name excluded
+ *
+ * No argument prints the most recent sample and the tasks, "history" prints the ring, "reset" clears it, "dump"
+ * prints the binary dump as hex and "dump <path>" writes it to a file. For consoles which register commands their own
+ * way.
+ *
+ * @param argc: Number of arguments
+ * @param argv: Arguments
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Unknown arguments
+ *    - ESP_ERR_NO_MEM: No memory for the dump
+ *    - ESP_FAIL: Writing the file failed
+ */
+esp_err_t telemetry_cmd_run(int argc, char **argv);
+
+/**
+ * @brief Register the `telemetry` console command, which runs `telemetry_cmd_run`
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - Others: Fail
+ */
+esp_err_t telemetry_register_cmd(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,599 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_idf_version.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_console.h"
+#include "telemetry.h"
+
+#define TELEMETRY_DUMP_VERSION  1
+#define TELEMETRY_DUMP_HEADER   (4 + 2 + 1 + 1 + 2 + 2 + 4)
+#define TELEMETRY_TASK_STACK    (4 * 1024)
+
+static const char *TAG = "telemetry";
+
+/* Counters are updated lock free, the lock only orders registrations */
+static uint32_t s_counters[CONFIG_TELEMETRY_MAX_COUNTERS];
+static char s_counter_names[CONFIG_TELEMETRY_MAX_COUNTERS][TELEMETRY_NAME_LEN];
+static int s_counter_count;
+static portMUX_TYPE s_counter_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* The ring and the tasks of the latest sample, under s_lock */
+static SemaphoreHandle_t s_lock;
+static telemetry_sample_t *s_ring;
+static size_t s_ring_head;
+static size_t s_ring_count;
+static uint32_t s_period_ms;
+static telemetry_sample_cb_t s_sample_cb;
+static void *s_sample_cb_ctx;
+
+#if CONFIG_TELEMETRY_TASKS
+typedef struct {
+    TaskHandle_t handle;
+    uint32_t run_time;
+} telemetry_run_time_t;
+
+static TaskStatus_t *s_status;
+static telemetry_run_time_t *s_prev;
+static size_t s_prev_count;
+static uint32_t s_prev_total;
+static TaskHandle_t s_idle[TELEMETRY_MAX_CORES];
+static telemetry_task_t *s_tasks;
+static size_t s_task_count;
+#endif
+
+esp_err_t telemetry_counter_register(const char *name, int *id)
+{
+    ESP_RETURN_ON_FALSE(name && id, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    taskENTER_CRITICAL(&s_counter_lock);
+    for (int i = 0; i < s_counter_count; i++) {
+        if (0 == strncmp(s_counter_names[i], name, TELEMETRY_NAME_LEN - 1)) {
+            *id = i;
+            ret = ESP_OK;
+            break;
+        }
+    }
+    if ((ESP_OK != ret) && (s_counter_count < CONFIG_TELEMETRY_MAX_COUNTERS)) {
+        strlcpy(s_counter_names[s_counter_count], name, TELEMETRY_NAME_LEN);
+        s_counters[s_counter_count] = 0;
+        *id = s_counter_count++;
+        ret = ESP_OK;
+    }
+    taskEXIT_CRITICAL(&s_counter_lock);
+
+    ESP_RETURN_ON_ERROR(ret, TAG, "no room for counter %s", name);
+    return ESP_OK;
+}
+
+void telemetry_counter_add(int id, uint32_t delta)
+{
+    if ((id >= 0) && (id < CONFIG_TELEMETRY_MAX_COUNTERS)) {
+        __atomic_fetch_add(&s_counters[id], delta, __ATOMIC_RELAXED);
+    }
+}
+
+void telemetry_counter_set(int id, uint32_t value)
+{
+    if ((id >= 0) && (id < CONFIG_TELEMETRY_MAX_COUNTERS)) {
+        __atomic_store_n(&s_counters[id], value, __ATOMIC_RELAXED);
+    }
+}
+
+void telemetry_set_sample_cb(telemetry_sample_cb_t cb, void *user_ctx)
+{
+    taskENTER_CRITICAL(&s_counter_lock);
+    s_sample_cb = cb;
+    s_sample_cb_ctx = user_ctx;
+    taskEXIT_CRITICAL(&s_counter_lock);
+}
+
+static int telemetry_counter_count(void)
+{
+    taskENTER_CRITICAL(&s_counter_lock);
+    int count = s_counter_count;
+    taskEXIT_CRITICAL(&s_counter_lock);
+    return count;
+}
+
+#if CONFIG_TELEMETRY_TASKS
+static uint32_t telemetry_prev_run_time(TaskHandle_t handle, size_t hint, bool *found)
+{
+    /* Tasks mostly come in the same order as in the previous sample */
+    if ((hint < s_prev_count) && (s_prev[hint].handle == handle)) {
+        *found = true;
+        return s_prev[hint].run_time;
+    }
+    for (size_t i = 0; i < s_prev_count; i++) {
+        if (s_prev[i].handle == handle) {
+            *found = true;
+            return s_prev[i].run_time;
+        }
+    }
+    *found = false;
+    return 0;
+}
+
+/**
+ * @brief Load of each task and core since the previous call, from the run time counters of the tasks
+ */
+static void telemetry_collect_tasks(telemetry_sample_t *sample)
+{
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    UBaseType_t count = uxTaskGetSystemState(s_status, CONFIG_TELEMETRY_MAX_TASKS, &total);
+
+    sample->tasks = uxTaskGetNumberOfTasks();
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_task_count = 0;
+    if (0 == count) {
+        /* More tasks than room, the next sample has no previous run time either */
+        s_prev_count = 0;
+        xSemaphoreGive(s_lock);
+        return;
+    }
+
+    /* The counters wrap after an hour with a 1 MHz clock, the unsigned differences stay right over a period */
+    uint32_t elapsed = (uint32_t)total - s_prev_total;
+    bool baseline = (s_prev_count > 0) && (elapsed > 0);
+    uint32_t min_stack = UINT32_MAX;
+
+    for (size_t i = 0; i < count; i++) {
+        const TaskStatus_t *status = &s_status[i];
+        telemetry_task_t *task = &s_tasks[i];
+        bool found;
+        uint32_t prev = telemetry_prev_run_time(status->xHandle, i, &found);
+        uint32_t load = 0;
+
+        if (baseline && found) {
+            load = ((uint64_t)((uint32_t)status->ulRunTimeCounter - prev) * 1000 + elapsed / 2) / elapsed;
+            load = (load > 1000) ? 1000 : load;
+        }
+        strlcpy(task->name, status->pcTaskName, sizeof(task->name));
+        task->cpu_load = load;
+        task->stack_free = (status->usStackHighWaterMark > UINT16_MAX) ? UINT16_MAX : status->usStackHighWaterMark;
+        task->priority = status->uxCurrentPriority;
+#if CONFIG_FREERTOS_VTASKLIST_INCLUDE_COREID
+        task->core = (status->xCoreID < portNUM_PROCESSORS) ? status->xCoreID : -1;
+#else
+        task->core = -1;
+#endif
+        min_stack = (status->usStackHighWaterMark < min_stack) ? status->usStackHighWaterMark : min_stack;
+
+        for (int core = 0; baseline && (core < TELEMETRY_MAX_CORES); core++) {
+            if (s_idle[core] && (s_idle[core] == status->xHandle)) {
+                sample->cpu_load[core] = 1000 - load;
+            }
+        }
+    }
+    for (size_t i = 0; i < count; i++) {
+        s_prev[i].handle = s_status[i].xHandle;
+        s_prev[i].run_time = s_status[i].ulRunTimeCounter;
+    }
+    s_prev_count = count;
+    s_prev_total = total;
+    s_task_count = count;
+    sample->min_stack_free = (min_stack > UINT16_MAX) ? UINT16_MAX : min_stack;
+    xSemaphoreGive(s_lock);
+}
+#endif
+
+static void telemetry_collect(telemetry_sample_t *sample)
+{
+    int64_t start = esp_timer_get_time();
+    multi_heap_info_t info;
+
+    memset(sample, 0, sizeof(*sample));
+    sample->time_ms = start / 1000;
+
+    heap_caps_get_info(&info, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    sample->internal_free = info.total_free_bytes;
+    sample->internal_min_free = info.minimum_free_bytes;
+    sample->internal_largest = info.largest_free_block;
+    heap_caps_get_info(&info, MALLOC_CAP_SPIRAM);
+    sample->psram_free = info.total_free_bytes;
+    sample->psram_min_free = info.minimum_free_bytes;
+    sample->psram_largest = info.largest_free_block;
+
+#if CONFIG_TELEMETRY_TASKS
+    telemetry_collect_tasks(sample);
+#else
+    sample->tasks = uxTaskGetNumberOfTasks();
+#endif
+
+    int counters = telemetry_counter_count();
+    for (int i = 0; i < counters; i++) {
+        sample->counters[i] = __atomic_load_n(&s_counters[i], __ATOMIC_RELAXED);
+    }
+    sample->collect_us = esp_timer_get_time() - start;
+}
+
+static void telemetry_task(void *arg)
+{
+    TickType_t last_wake = xTaskGetTickCount();
+    TickType_t period = pdMS_TO_TICKS(s_period_ms);
+    telemetry_sample_t sample;
+
+#if CONFIG_TELEMETRY_TASKS
+    /* Run times to measure the first period against */
+    telemetry_collect(&sample);
+#endif
+    while (true) {
+        vTaskDelayUntil(&last_wake, period ? period : 1);
+        telemetry_collect(&sample);
+
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        s_ring[s_ring_head] = sample;
+        s_ring_head = (s_ring_head + 1) % CONFIG_TELEMETRY_RING_SAMPLES;
+        s_ring_count += (s_ring_count < CONFIG_TELEMETRY_RING_SAMPLES);
+        xSemaphoreGive(s_lock);
+
+        taskENTER_CRITICAL(&s_counter_lock);
+        telemetry_sample_cb_t cb = s_sample_cb;
+        void *ctx = s_sample_cb_ctx;
+        taskEXIT_CRITICAL(&s_counter_lock);
+        if (cb) {
+            cb(&sample, ctx);
+        }
+    }
+}
+
+esp_err_t telemetry_start(const telemetry_config_t *config)
+{
+    esp_err_t ret = ESP_OK;
+
+    ESP_RETURN_ON_FALSE(config && config->period_ms, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!s_lock, ESP_ERR_INVALID_STATE, TAG, "already started");
+
+    /* History goes to PSRAM, the task list is written with the scheduler suspended and stays internal */
+    s_ring = heap_caps_calloc_prefer(CONFIG_TELEMETRY_RING_SAMPLES, sizeof(telemetry_sample_t), 2,
+                                     MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT);
+    ESP_GOTO_ON_FALSE(s_ring, ESP_ERR_NO_MEM, err, TAG, "no mem for ring");
+#if CONFIG_TELEMETRY_TASKS
+    s_status = heap_caps_calloc(CONFIG_TELEMETRY_MAX_TASKS, sizeof(TaskStatus_t), MALLOC_CAP_INTERNAL);
+    s_prev = heap_caps_calloc(CONFIG_TELEMETRY_MAX_TASKS, sizeof(telemetry_run_time_t), MALLOC_CAP_INTERNAL);
+    s_tasks = heap_caps_calloc_prefer(CONFIG_TELEMETRY_MAX_TASKS, sizeof(telemetry_task_t), 2,
+                                      MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT);
+    ESP_GOTO_ON_FALSE(s_status && s_prev && s_tasks, ESP_ERR_NO_MEM, err, TAG, "no mem for tasks");
+    for (int core = 0; (core < portNUM_PROCESSORS) && (core < TELEMETRY_MAX_CORES); core++) {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+        s_idle[core] = xTaskGetIdleTaskHandleForCore(core);
+#else
+        s_idle[core] = xTaskGetIdleTaskHandleForCPU(core);
+#endif
+    }
+#endif
+    s_lock = xSemaphoreCreateMutex();
+    ESP_GOTO_ON_FALSE(s_lock, ESP_ERR_NO_MEM, err, TAG, "no mem for lock");
+    s_period_ms = config->period_ms;
+
+    BaseType_t res = xTaskCreatePinnedToCore(telemetry_task, "telemetry", TELEMETRY_TASK_STACK, NULL,
+                                             config->task_priority, NULL, config->task_core);
+    ESP_GOTO_ON_FALSE(pdPASS == res, ESP_ERR_NO_MEM, err, TAG, "create task failed");
+    ESP_LOGI(TAG, "every %u ms, %u samples kept", (unsigned)s_period_ms, (unsigned)CONFIG_TELEMETRY_RING_SAMPLES);
+    return ESP_OK;
+
+err:
+    if (s_lock) {
+        vSemaphoreDelete(s_lock);
+        s_lock = NULL;
+    }
+#if CONFIG_TELEMETRY_TASKS
+    free(s_status);
+    free(s_prev);
+    free(s_tasks);
+    s_status = NULL;
+    s_prev = NULL;
+    s_tasks = NULL;
+#endif
+    free(s_ring);
+    s_ring = NULL;
+    return ret;
+}
+
+/* Index in the ring of the i-th oldest sample, with s_lock taken */
+static inline size_t telemetry_ring_index(size_t i)
+{
+    return (s_ring_head + CONFIG_TELEMETRY_RING_SAMPLES - s_ring_count + i) % CONFIG_TELEMETRY_RING_SAMPLES;
+}
+
+esp_err_t telemetry_get_latest(telemetry_sample_t *sample)
+{
+    ESP_RETURN_ON_FALSE(sample, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    return (1 == telemetry_get_samples(sample, 1)) ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+size_t telemetry_get_samples(telemetry_sample_t *samples, size_t max)
+{
+    if (!s_lock || !samples) {
+        return 0;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    size_t count = (s_ring_count < max) ? s_ring_count : max;
+    for (size_t i = 0; i < count; i++) {
+        samples[i] = s_ring[telemetry_ring_index(s_ring_count - count + i)];
+    }
+    xSemaphoreGive(s_lock);
+    return count;
+}
+
+size_t telemetry_get_tasks(telemetry_task_t *tasks, size_t max)
+{
+    size_t count = 0;
+#if CONFIG_TELEMETRY_TASKS
+    if (!s_lock || !tasks) {
+        return 0;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    count = (s_task_count < max) ? s_task_count : max;
+    memcpy(tasks, s_tasks, count * sizeof(telemetry_task_t));
+    xSemaphoreGive(s_lock);
+#endif
+    return count;
+}
+
+void telemetry_reset(void)
+{
+    if (s_lock) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        s_ring_count = 0;
+        xSemaphoreGive(s_lock);
+    }
+}
+
+static unsigned telemetry_frag(uint32_t free, uint32_t largest)
+{
+    return free ? (unsigned)(100 - (uint64_t)largest * 100 / free) : 0;
+}
+
+static int telemetry_task_cmp(const void *a, const void *b)
+{
+    const telemetry_task_t *ta = a;
+    const telemetry_task_t *tb = b;
+    return (int)tb->cpu_load - (int)ta->cpu_load;
+}
+
+void telemetry_print(void)
+{
+    telemetry_sample_t sample;
+    int counters = telemetry_counter_count();
+
+    if (ESP_OK != telemetry_get_latest(&sample)) {
+        printf("no sample yet\n");
+        return;
+    }
+    printf("uptime %u s, %u tasks, sampled every %u ms in %u us\n", (unsigned)(sample.time_ms / 1000),
+           (unsigned)sample.tasks, (unsigned)s_period_ms, (unsigned)sample.collect_us);
+    printf("%-10s %9s %9s %9s %6s\n", "heap", "free", "min free", "largest", "frag %");
+    printf("%-10s %9u %9u %9u %6u\n", "internal", (unsigned)sample.internal_free, (unsigned)sample.internal_min_free,
+           (unsigned)sample.internal_largest, telemetry_frag(sample.internal_free, sample.internal_largest));
+    printf("%-10s %9u %9u %9u %6u\n", "psram", (unsigned)sample.psram_free, (unsigned)sample.psram_min_free,
+           (unsigned)sample.psram_largest, telemetry_frag(sample.psram_free, sample.psram_largest));
+    printf("%-10s", "cpu load");
+    for (int core = 0; core < portNUM_PROCESSORS && core < TELEMETRY_MAX_CORES; core++) {
+        printf("%score %d %u.%u %%", core ? ", " : " ", core, sample.cpu_load[core] / 10, sample.cpu_load[core] % 10);
+    }
+    printf("\n");
+    for (int i = 0; i < counters; i++) {
+        printf("%-16s %u\n", s_counter_names[i], (unsigned)sample.counters[i]);
+    }
+
+#if CONFIG_TELEMETRY_TASKS
+    telemetry_task_t *tasks = malloc(CONFIG_TELEMETRY_MAX_TASKS * sizeof(telemetry_task_t));
+    if (!tasks) {
+        return;
+    }
+    size_t count = telemetry_get_tasks(tasks, CONFIG_TELEMETRY_MAX_TASKS);
+    qsort(tasks, count, sizeof(telemetry_task_t), telemetry_task_cmp);
+    printf("%-16s %5s %5s %7s %11s\n", "task", "core", "prio", "cpu %", "stack free");
+    for (size_t i = 0; i < count; i++) {
+        printf("%-16s %5d %5u %5u.%u %11u\n", tasks[i].name, tasks[i].core, tasks[i].priority,
+               tasks[i].cpu_load / 10, tasks[i].cpu_load % 10, tasks[i].stack_free);
+    }
+    if (!count) {
+        printf("more than %d tasks\n", CONFIG_TELEMETRY_MAX_TASKS);
+    }
+    free(tasks);
+#endif
+}
+
+void telemetry_print_history(void)
+{
+    telemetry_sample_t *samples = malloc(CONFIG_TELEMETRY_RING_SAMPLES * sizeof(telemetry_sample_t));
+    int counters = telemetry_counter_count();
+
+    if (!samples) {
+        printf("no mem\n");
+        return;
+    }
+    size_t count = telemetry_get_samples(samples, CONFIG_TELEMETRY_RING_SAMPLES);
+    printf("%8s %9s %9s %6s %9s %6s %6s %6s", "time s", "int free", "int min", "frag %", "psram", "frag %",
+           "cpu0 %", "cpu1 %");
+    for (int i = 0; i < counters; i++) {
+        printf(" %10.10s", s_counter_names[i]);
+    }
+    printf("\n");
+    for (size_t i = 0; i < count; i++) {
+        const telemetry_sample_t *s = &samples[i];
+        printf("%8u %9u %9u %6u %9u %6u %4u.%u %4u.%u", (unsigned)(s->time_ms / 1000), (unsigned)s->internal_free,
+               (unsigned)s->internal_min_free, telemetry_frag(s->internal_free, s->internal_largest),
+               (unsigned)s->psram_free, telemetry_frag(s->psram_free, s->psram_largest), s->cpu_load[0] / 10,
+               s->cpu_load[0] % 10, s->cpu_load[1] / 10, s->cpu_load[1] % 10);
+        for (int j = 0; j < counters; j++) {
+            printf(" %10u", (unsigned)s->counters[j]);
+        }
+        printf("\n");
+    }
+    free(samples);
+}
+
+static size_t telemetry_dump_sample_size(int counters)
+{
+    return 7 * 4 + TELEMETRY_MAX_CORES * 2 + 2 + 2 + 4 + counters * 4;
+}
+
+size_t telemetry_dump_size(void)
+{
+    int counters = telemetry_counter_count();
+    size_t samples = 0;
+
+    if (s_lock) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        samples = s_ring_count;
+        xSemaphoreGive(s_lock);
+    }
+    return TELEMETRY_DUMP_HEADER + counters * TELEMETRY_NAME_LEN + samples * telemetry_dump_sample_size(counters);
+}
+
+static uint8_t *telemetry_put_u16(uint8_t *p, uint16_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+    return p + 2;
+}
+
+static uint8_t *telemetry_put_u32(uint8_t *p, uint32_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+    return p + 4;
+}
+
+esp_err_t telemetry_dump(uint8_t *buf, size_t size, size_t *ret_len)
+{
+    ESP_RETURN_ON_FALSE(buf && ret_len, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    int counters = telemetry_counter_count();
+    size_t header = TELEMETRY_DUMP_HEADER + counters * TELEMETRY_NAME_LEN;
+    size_t sample_size = telemetry_dump_sample_size(counters);
+    ESP_RETURN_ON_FALSE(size >= header, ESP_ERR_INVALID_SIZE, TAG, "buffer too small");
+
+    if (s_lock) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+    }
+    /* The ring may have grown since telemetry_dump_size(), keep the most recent samples which fit */
+    size_t fit = (size - header) / sample_size;
+    size_t count = (s_ring_count < fit) ? s_ring_count : fit;
+
+    uint8_t *p = buf;
+    memcpy(p, "TLMY", 4);
+    p += 4;
+    p = telemetry_put_u16(p, TELEMETRY_DUMP_VERSION);
+    *p++ = TELEMETRY_MAX_CORES;
+    *p++ = counters;
+    p = telemetry_put_u16(p, count);
+    p = telemetry_put_u16(p, sample_size);
+    p = telemetry_put_u32(p, s_period_ms);
+    for (int i = 0; i < counters; i++) {
+        memcpy(p, s_counter_names[i], TELEMETRY_NAME_LEN);
+        p += TELEMETRY_NAME_LEN;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const telemetry_sample_t *s = &s_ring[telemetry_ring_index(s_ring_count - count + i)];
+        p = telemetry_put_u32(p, s->time_ms);
+        p = telemetry_put_u32(p, s->internal_free);
+        p = telemetry_put_u32(p, s->internal_min_free);
+        p = telemetry_put_u32(p, s->internal_largest);
+        p = telemetry_put_u32(p, s->psram_free);
+        p = telemetry_put_u32(p, s->psram_min_free);
+        p = telemetry_put_u32(p, s->psram_largest);
+        for (int core = 0; core < TELEMETRY_MAX_CORES; core++) {
+            p = telemetry_put_u16(p, s->cpu_load[core]);
+        }
+        p = telemetry_put_u16(p, s->tasks);
+        p = telemetry_put_u16(p, s->min_stack_free);
+        p = telemetry_put_u32(p, s->collect_us);
+        for (int j = 0; j < counters; j++) {
+            p = telemetry_put_u32(p, s->counters[j]);
+        }
+    }
+    if (s_lock) {
+        xSemaphoreGive(s_lock);
+    }
+    *ret_len = p - buf;
+    return ESP_OK;
+}
+
+static esp_err_t telemetry_dump_to(const char *path)
+{
+    esp_err_t ret = ESP_OK;
+    size_t size = telemetry_dump_size();
+    size_t len;
+    uint8_t *buf = malloc(size);
+    ESP_RETURN_ON_FALSE(buf, ESP_ERR_NO_MEM, TAG, "no mem for %u bytes", (unsigned)size);
+    ESP_GOTO_ON_ERROR(telemetry_dump(buf, size, &len), out, TAG, "dump failed");
+
+    if (NULL == path) {
+        for (size_t i = 0; i < len; i++) {
+            printf("%02x%s", buf[i], ((i % 32) == 31) ? "\n" : "");
+        }
+        printf("\n");
+        goto out;
+    }
+
+    FILE *fp = fopen(path, "wb");
+    ESP_GOTO_ON_FALSE(fp, ESP_FAIL, out, TAG, "create %s failed", path);
+    size_t written = fwrite(buf, 1, len, fp);
+    fclose(fp);
+    ESP_GOTO_ON_FALSE(written == len, ESP_FAIL, out, TAG, "write %s failed", path);
+    printf("%u bytes written to %s\n", (unsigned)len, path);
+
+out:
+    free(buf);
+    return ret;
+}
+
+esp_err_t telemetry_cmd_run(int argc, char **argv)
+{
+    if (0 == argc) {
+        telemetry_print();
+        return ESP_OK;
+    }
+    if ((1 == argc) && (0 == strcmp(argv[0], "history"))) {
+        telemetry_print_history();
+        return ESP_OK;
+    }
+    if ((1 == argc) && (0 == strcmp(argv[0], "reset"))) {
+        telemetry_reset();
+        return ESP_OK;
+    }
+    if ((argc <= 2) && (0 == strcmp(argv[0], "dump"))) {
+        return telemetry_dump_to((2 == argc) ? argv[1] : NULL);
+    }
+    printf("usage: telemetry [history | reset | dump [<path>]]\n");
+    return ESP_ERR_INVALID_ARG;
+}
+
+static int telemetry_cmd(int argc, char **argv)
+{
+    return (ESP_OK == telemetry_cmd_run(argc - 1, argv + 1)) ? 0 : 1;
+}
+
+esp_err_t telemetry_register_cmd(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "telemetry",
+        .help = "Heap, CPU load, counters and tasks. 'history' prints the last samples, 'reset' clears them, "
+        "'dump [<path>]' dumps them in binary",
+        .hint = "[history | reset | dump [<path>]]",
+        .func = telemetry_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
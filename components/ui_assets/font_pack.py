@@ -0,0 +1,180 @@
+#!/usr/bin/env python
+#
+# SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Compress the glyph bitmaps of an LVGL font source generated by lv_font_conv.
+#
+# Every glyph is packed on its own so glyphs stay randomly accessible, as a sequence of 4 bpp pixel tokens:
+#   0b00nnnnnn   n + 1 transparent pixels
+#   0b01nnnnnn   n + 1 opaque pixels
+#   0b1nnnnnnn   n + 1 literal pixels follow, two per byte, high nibble first
+# The font then gets its bitmaps through ui_assets_font_get_bitmap(), which unpacks one glyph at a time. Fonts which
+# would shrink by less than 10% are copied unchanged.
+
+import argparse
+import os
+import re
+import sys
+
+RUN_MAX = 64
+LITERAL_MAX = 128
+OPAQUE = 0xf
+MIN_SAVING_PERCENT = 10     # Below this, unpacking each glyph costs more than the flash it saves
+
+
+def pixels_of(data, count):
+    return [(data[i // 2] >> (0 if i & 1 else 4)) & 0xf for i in range(count)]
+
+
+def pack(pixels):
+    """Shortest token sequence, by dynamic programming from the end of the glyph"""
+    n = len(pixels)
+    run = [0] * (n + 1)
+    for i in range(n - 1, -1, -1):
+        if pixels[i] in (0, OPAQUE):
+            run[i] = run[i + 1] + 1 if i + 1 < n and pixels[i + 1] == pixels[i] else 1
+
+    cost = [0] * (n + 1)
+    choice = [None] * (n + 1)
+    for i in range(n - 1, -1, -1):
+        best = None
+        if run[i] >= 2:
+            length = min(run[i], RUN_MAX)
+            best = (1 + cost[i + length], 'run', length)
+        # A literal ends where a run worth a token starts, or at the end of the glyph
+        for length in range(1, min(LITERAL_MAX, n - i) + 1):
+            end = i + length
+            if end == n or run[end] >= 2:
+                candidate = (1 + (length + 1) // 2 + cost[end], 'literal', length)
+                if best is None or candidate[0] < best[0]:
+                    best = candidate
+        if best is None:
+            best = (1 + (min(LITERAL_MAX, n - i) + 1) // 2 + cost[i + min(LITERAL_MAX, n - i)], 'literal',
+                    min(LITERAL_MAX, n - i))
+        cost[i] = best[0]
+        choice[i] = best[1:]
+
+    out = bytearray()
+    i = 0
+    while i < n:
+        kind, length = choice[i]
+        if kind == 'run':
+            out.append((0x40 if pixels[i] else 0x00) | (length - 1))
+        else:
+            out.append(0x80 | (length - 1))
+            literal = pixels[i:i + length] + [0]
+            out.extend((literal[k] << 4) | literal[k + 1] for k in range(0, length, 2))
+        i += length
+    return bytes(out)
+
+
+def unpack(data, count):
+    pixels = []
+    i = 0
+    while len(pixels) < count:
+        ctrl = data[i]
+        i += 1
+        if ctrl & 0x80:
+            length = (ctrl & 0x7f) + 1
+            pixels.extend(pixels_of(data[i:], length))
+            i += (length + 1) // 2
+        else:
+            pixels.extend([OPAQUE if ctrl & 0x40 else 0] * ((ctrl & 0x3f) + 1))
+    return pixels[:count]
+
+
+def fail(path, message):
+    sys.exit('{}: {}'.format(path, message))
+
+
+def copy(path, output_path, source, reason):
+    with open(output_path, 'w', encoding='utf-8') as f:
+        f.write(source)
+    print('{}: {}, copied'.format(os.path.basename(path), reason))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress the glyph bitmaps of an LVGL font source')
+    parser.add_argument('input', help='font source generated by lv_font_conv')
+    parser.add_argument('output', help='font source with compressed bitmaps')
+    args = parser.parse_args()
+
+    with open(args.input, encoding='utf-8-sig') as f:
+        source = f.read()
+
+    bitmap = re.search(r'(glyph_bitmap\[\] = \{\n)(.*?)(\n\};)', source, re.S)
+    dsc = re.search(r'(glyph_dsc\[\] = \{\n)(.*?)(\n\};)', source, re.S)
+    bpp = re.search(r'\.bpp = (\d+),', source)
+    if not bitmap or not dsc or not bpp:
+        fail(args.input, 'not an lv_font_conv font')
+    if not re.search(r'\.bitmap_format = 0,', source):
+        fail(args.input, 'bitmaps already compressed')
+    if int(bpp.group(1)) != 4:
+        copy(args.input, args.output, source, 'only 4 bpp fonts are packed')
+        return
+
+    # Glyph comments, one per glyph from id 1, and the bytes of each glyph
+    glyphs = []
+    for line in bitmap.group(2).split('\n'):
+        line = line.strip()
+        if line.startswith('/*'):
+            glyphs.append([line, bytearray()])
+        elif line:
+            if not glyphs:
+                fail(args.input, 'bitmap data before the first glyph comment')
+            glyphs[-1][1].extend(int(v, 0) for v in line.rstrip(',').split(','))
+
+    entries = list(re.finditer(r'\.bitmap_index = (\d+), \.adv_w = \d+, \.box_w = (\d+), \.box_h = (\d+)',
+                               dsc.group(2)))
+    if len(entries) != len(glyphs) + 1:
+        fail(args.input, '{} glyph descriptors for {} bitmaps'.format(len(entries), len(glyphs)))
+
+    raw_size = 0
+    packed = []
+    for entry, (comment, data) in zip(entries[1:], glyphs):
+        index, box_w, box_h = (int(v) for v in entry.groups())
+        if len(data) != (box_w * box_h + 1) // 2 or (data and index != raw_size):
+            fail(args.input, 'glyph {} does not match its descriptor'.format(comment))
+        raw_size += len(data)
+        pixels = pixels_of(data, box_w * box_h)
+        data = pack(pixels)
+        assert unpack(data, len(pixels)) == pixels
+        packed.append(data)
+
+    if sum(len(data) for data in packed) * 100 > raw_size * (100 - MIN_SAVING_PERCENT):
+        copy(args.input, args.output, source, 'glyph bitmaps would shrink less than {}%'.format(MIN_SAVING_PERCENT))
+        return
+
+    # New bitmap array and indexes
+    lines = []
+    indexes = [0]
+    offset = 0
+    for (comment, _), data in zip(glyphs, packed):
+        lines.append('    ' + comment)
+        for i in range(0, len(data), 16):
+            lines.append('    ' + ', '.join('0x{:x}'.format(v) for v in data[i:i + 16]) + ',')
+        lines.append('')
+        indexes.append(offset)
+        offset += len(data)
+    if lines:
+        lines.pop()
+
+    entry_iter = iter(indexes)
+    new_dsc = re.sub(r'\.bitmap_index = \d+', lambda m: '.bitmap_index = {}'.format(next(entry_iter)), dsc.group(2))
+
+    output = (source[:bitmap.start(2)] + '\n'.join(lines) + source[bitmap.end(2):dsc.start(2)] + new_dsc +
+              source[dsc.end(2):])
+    output = output.replace('lv_font_get_bitmap_fmt_txt,', 'ui_assets_font_get_bitmap,')
+    output = output.replace('/*-----------------\n *    BITMAPS', '#include "ui_assets.h"\n\n/*-----------------\n *    BITMAPS', 1)
+
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write('/* Generated by font_pack.py from {}, do not edit */\n\n'.format(os.path.basename(args.input)))
+        f.write(output)
+
+    print('{}: glyph bitmaps {} -> {} bytes'.format(os.path.basename(args.input), raw_size, offset))
+
+
+if __name__ == '__main__':
+    main()
@@ -4,7 +4,7 @@
  * Opts: --bpp 4 --size 20 --font C:\Users\liu\Desktop\Project\squareline\chat_gpt_new_gui\assets\pingfang.otf -o C:\Users\liu\Desktop\Project\squareline\chat_gpt_new_gui\assets\ui_font_PingFangEN20.c --format lvgl -r 0x20-0x7f --no-compress --no-prefilter
  ******************************************************************************/
 
-#include "../ui.h"
+#include "lvgl.h"
 
 #ifndef UI_FONT_PINGFANGEN20
 #define UI_FONT_PINGFANGEN20 1
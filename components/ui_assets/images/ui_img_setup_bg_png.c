@@ -3,7 +3,7 @@
 // LVGL version: 8.3.4
 // Project name: chat_gpt
 
-#include "../ui.h"
+#include "lvgl.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
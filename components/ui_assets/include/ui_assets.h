@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Fonts and images shared by the examples
+ *
+ * Every asset is a separate object of the component library, so an application links only the assets it references.
+ * Assets are constant data, read in place from flash through the cache. With UI_ASSETS_FONT_COMPRESS, the glyph
+ * bitmaps of the fonts which shrink enough are packed at build time by font_pack.py.
+ */
+LV_FONT_DECLARE(font_app);
+LV_FONT_DECLARE(font_app_16);
+LV_FONT_DECLARE(font_cn_gb1_16);
+LV_FONT_DECLARE(font_en_12);
+LV_FONT_DECLARE(font_en_14);
+LV_FONT_DECLARE(font_en_16);
+LV_FONT_DECLARE(font_en_24);
+LV_FONT_DECLARE(font_en_64);
+LV_FONT_DECLARE(font_en_bold_36);
+LV_FONT_DECLARE(font_hint_16);
+LV_FONT_DECLARE(font_icon_16);
+LV_FONT_DECLARE(ui_font_PingFangEN14);
+LV_FONT_DECLARE(ui_font_PingFangEN16);
+LV_FONT_DECLARE(ui_font_PingFangEN20);
+
+LV_IMG_DECLARE(esp_logo);
+LV_IMG_DECLARE(esp_logo_tiny);
+LV_IMG_DECLARE(esp_text);
+LV_IMG_DECLARE(hand_down);
+LV_IMG_DECLARE(hand_left);
+LV_IMG_DECLARE(icon_about_us);
+LV_IMG_DECLARE(icon_air_off);
+LV_IMG_DECLARE(icon_air_on);
+LV_IMG_DECLARE(icon_box);
+LV_IMG_DECLARE(icon_box_lite);
+LV_IMG_DECLARE(icon_dev_ctrl);
+LV_IMG_DECLARE(icon_fan_off);
+LV_IMG_DECLARE(icon_fan_on);
+LV_IMG_DECLARE(icon_help);
+LV_IMG_DECLARE(icon_light_off);
+LV_IMG_DECLARE(icon_light_on);
+LV_IMG_DECLARE(icon_media_player);
+LV_IMG_DECLARE(icon_network);
+LV_IMG_DECLARE(icon_rmaker);
+LV_IMG_DECLARE(icon_switch_off);
+LV_IMG_DECLARE(icon_switch_on);
+LV_IMG_DECLARE(img_music);
+LV_IMG_DECLARE(media_off);
+LV_IMG_DECLARE(media_on);
+LV_IMG_DECLARE(mic_logo);
+LV_IMG_DECLARE(mute_off);
+LV_IMG_DECLARE(mute_on);
+LV_IMG_DECLARE(ui_img_setup_bg_png);
+LV_IMG_DECLARE(ui_img_setup_text_bg_png);
+
+/**
+ * @brief Glyph bitmap getter of the fonts packed by font_pack.py
+ *
+ * @note The bitmap is unpacked into a buffer shared by all packed fonts, valid until the next call. LVGL draws one
+ *       glyph at a time from its own task, like its own decompression.
+ *
+ * @param font: Font
+ * @param letter: Unicode letter
+ *
+ * @return
+ *    - Unpacked 4 bpp bitmap
+ *    - NULL: no glyph, or out of memory
+ */
+const uint8_t *ui_assets_font_get_bitmap(const lv_font_t *font, uint32_t letter);
+
+/**
+ * @brief Unpack a glyph bitmap packed by font_pack.py
+ *
+ * @param src: Packed glyph
+ * @param dst: Output 4 bpp bitmap of (pixels + 1) / 2 bytes
+ * @param pixels: Pixels of the glyph, box_w * box_h
+ */
+void ui_assets_unpack_glyph(const uint8_t *src, uint8_t *dst, uint32_t pixels);
+
+#ifdef __cplusplus
+}
+#endif
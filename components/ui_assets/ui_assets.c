@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include "ui_assets.h"
+
+#define GLYPH_LITERAL           (0x80)  /* 0b1nnnnnnn: n + 1 literal pixels, two per byte */
+#define GLYPH_OPAQUE            (0x40)  /* 0b01nnnnnn: n + 1 opaque pixels, 0b00nnnnnn: n + 1 transparent pixels */
+
+static uint8_t *s_glyph_buf;
+static uint32_t s_glyph_buf_size;
+
+void ui_assets_unpack_glyph(const uint8_t *src, uint8_t *dst, uint32_t pixels)
+{
+    uint32_t i = 0;
+
+    /* Transparent runs are only skipped */
+    memset(dst, 0, (pixels + 1) / 2);
+    while (i < pixels) {
+        uint8_t ctrl = *src++;
+
+        if (ctrl & GLYPH_LITERAL) {
+            uint32_t len = (ctrl & 0x7f) + 1;
+            if (len > pixels - i) {
+                len = pixels - i;
+            }
+            if (0 == (i & 1)) {
+                /* Nibbles are aligned, copy whole bytes */
+                memcpy(&dst[i / 2], src, len / 2);
+                if (len & 1) {
+                    dst[(i + len) / 2] = src[len / 2] & 0xf0;
+                }
+            } else {
+                for (uint32_t k = 0; k < len; k++) {
+                    uint8_t v = (k & 1) ? (src[k / 2] & 0x0f) : (src[k / 2] >> 4);
+                    dst[(i + k) / 2] |= ((i + k) & 1) ? v : (uint8_t)(v << 4);
+                }
+            }
+            src += (len + 1) / 2;
+            i += len;
+        } else {
+            uint32_t len = (ctrl & 0x3f) + 1;
+            if (len > pixels - i) {
+                len = pixels - i;
+            }
+            if (ctrl & GLYPH_OPAQUE) {
+                for (uint32_t end = i + len; i < end; i++) {
+                    dst[i / 2] |= (i & 1) ? 0x0f : 0xf0;
+                }
+            } else {
+                i += len;
+            }
+        }
+    }
+}
+
+const uint8_t *ui_assets_font_get_bitmap(const lv_font_t *font, uint32_t letter)
+{
+    lv_font_glyph_dsc_t dsc;
+
+    /* Bitmap indexes of packed fonts point at the packed glyphs */
+    const uint8_t *packed = lv_font_get_bitmap_fmt_txt(font, letter);
+    if ((NULL == packed) || !lv_font_get_glyph_dsc_fmt_txt(font, &dsc, letter, 0)) {
+        return NULL;
+    }
+
+    uint32_t pixels = (uint32_t)dsc.box_w * dsc.box_h;
+    uint32_t size = (pixels + 1) / 2;
+    if (size > s_glyph_buf_size) {
+        uint8_t *buf = lv_mem_realloc(s_glyph_buf, size);
+        if (NULL == buf) {
+            return NULL;
+        }
+        s_glyph_buf = buf;
+        s_glyph_buf_size = size;
+    }
+
+    ui_assets_unpack_glyph(packed, s_glyph_buf, pixels);
+    return s_glyph_buf;
+}
@@ -14,6 +14,7 @@
 #include "esp_tinyuf2.h"
 #include "ui.h"
 #include "bsp/esp-bsp.h"
+#include "bsp_display_profile.h"
 #include "esp_ota_ops.h"
 
 #define NVS_MODIFIED_BIT          BIT0
@@ -96,12 +97,8 @@ void app_main(void)
 
     bsp_display_cfg_t cfg = {
         .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
-        .buffer_size = BSP_LCD_H_RES * CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,
-        .double_buffer = 0,
-        .flags = {
-            .buff_dma = true,
-        }
     };
+    bsp_display_profile_apply(NULL, &cfg);
     bsp_display_start_with_config(&cfg);
     bsp_display_backlight_on();
     ui_init();
@@ -1,969 +0,0 @@
-/*******************************************************************************
- * Size: 16 px
- * Bpp: 4
- * Opts: --bpp 4 --size 16 --font C:\Users\liu\Desktop\Project\squareline\chat_gpt_new_gui\assets\pingfang.otf -o C:\Users\liu\Desktop\Project\squareline\chat_gpt_new_gui\assets\ui_font_PingFangEN16.c --format lvgl -r 0x20-0x7f --no-compress --no-prefilter
- ******************************************************************************/
-
-#include "../ui.h"
-
-#ifndef UI_FONT_PINGFANGEN16
-#define UI_FONT_PINGFANGEN16 1
-#endif
-
-#if UI_FONT_PINGFANGEN16
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x1f, 0x60, 0xf5, 0xf, 0x50, 0xf4, 0xf, 0x40,
-    0xe4, 0xe, 0x30, 0xd3, 0xb, 0x20, 0x0, 0x1e,
-    0x61, 0xe6,
-
-    /* U+0022 "\"" */
-    0xb9, 0xc, 0x8a, 0x90, 0xb7, 0xa8, 0xb, 0x79,
-    0x80, 0xa6, 0x11, 0x2, 0x10,
-
-    /* U+0023 "#" */
-    0x0, 0xa, 0x60, 0x2e, 0x0, 0x0, 0xc, 0x40,
-    0x4c, 0x0, 0x0, 0xe, 0x20, 0x6a, 0x0, 0xc,
-    0xef, 0xee, 0xff, 0xe1, 0x1, 0x4d, 0x11, 0xc6,
-    0x10, 0x0, 0x6a, 0x0, 0xe2, 0x0, 0x0, 0x88,
-    0x0, 0xf0, 0x0, 0x0, 0xb5, 0x3, 0xd0, 0x0,
-    0x7e, 0xfe, 0xee, 0xfe, 0x70, 0x1, 0xf2, 0x19,
-    0x91, 0x0, 0x2, 0xe0, 0xa, 0x60, 0x0, 0x5,
-    0xc0, 0xd, 0x30, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x92, 0x0, 0x0, 0x0, 0x9, 0x20,
-    0x0, 0x0, 0x7d, 0xff, 0xb2, 0x0, 0x8e, 0x7b,
-    0x6b, 0xe1, 0xe, 0x60, 0x92, 0xe, 0x60, 0xe6,
-    0x9, 0x20, 0x43, 0xa, 0xe5, 0xa2, 0x0, 0x0,
-    0x9, 0xff, 0x81, 0x0, 0x0, 0x1, 0xce, 0xf8,
-    0x0, 0x0, 0x9, 0x25, 0xf7, 0x1d, 0x20, 0x92,
-    0x9, 0xb0, 0xe7, 0x9, 0x20, 0xaa, 0x7, 0xf7,
-    0xb6, 0x9f, 0x40, 0x7, 0xdf, 0xfc, 0x50, 0x0,
-    0x0, 0x92, 0x0, 0x0, 0x0, 0x4, 0x10, 0x0,
-
-    /* U+0025 "%" */
-    0xa, 0xed, 0x30, 0x0, 0xc, 0x30, 0x0, 0x9b,
-    0x5, 0xe0, 0x0, 0x5a, 0x0, 0x0, 0xd6, 0x0,
-    0xf3, 0x0, 0xd2, 0x0, 0x0, 0xc6, 0x0, 0xf3,
-    0x6, 0x90, 0x0, 0x0, 0x8b, 0x6, 0xe0, 0xd,
-    0x10, 0x0, 0x0, 0x9, 0xec, 0x30, 0x78, 0x7,
-    0xdc, 0x30, 0x0, 0x0, 0x1, 0xe1, 0x5d, 0x15,
-    0xe0, 0x0, 0x0, 0x8, 0x70, 0xa8, 0x0, 0xf4,
-    0x0, 0x0, 0x1d, 0x0, 0xb7, 0x0, 0xd6, 0x0,
-    0x0, 0xa6, 0x0, 0xa9, 0x0, 0xf4, 0x0, 0x2,
-    0xd0, 0x0, 0x5d, 0x14, 0xf0, 0x0, 0xb, 0x50,
-    0x0, 0x8, 0xed, 0x40,
-
-    /* U+0026 "&" */
-    0x0, 0x1a, 0xfe, 0x90, 0x0, 0x0, 0x0, 0xbc,
-    0x34, 0xe8, 0x0, 0x0, 0x0, 0xe6, 0x0, 0xaa,
-    0x0, 0x0, 0x0, 0xac, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0x1e, 0xce, 0x60, 0x1, 0x0, 0x0, 0x4d,
-    0xf9, 0x0, 0x2f, 0x10, 0x6, 0xf5, 0x3f, 0x70,
-    0x5f, 0x0, 0xf, 0x50, 0x3, 0xf6, 0x9c, 0x0,
-    0x4f, 0x0, 0x0, 0x4f, 0xf6, 0x0, 0x2f, 0x40,
-    0x0, 0xc, 0xf5, 0x0, 0xb, 0xe7, 0x46, 0xce,
-    0x9f, 0x20, 0x0, 0x7d, 0xfd, 0x91, 0xa, 0xd1,
-
-    /* U+0027 "'" */
-    0xb9, 0xa9, 0xa8, 0x98, 0x11,
-
-    /* U+0028 "(" */
-    0x0, 0xe, 0x30, 0x6, 0xc0, 0x0, 0xe5, 0x0,
-    0x5e, 0x0, 0x9, 0xa0, 0x0, 0xd6, 0x0, 0xf,
-    0x40, 0x0, 0xf3, 0x0, 0xf, 0x30, 0x0, 0xf4,
-    0x0, 0xd, 0x60, 0x0, 0x9a, 0x0, 0x5, 0xe0,
-    0x0, 0xe, 0x50, 0x0, 0x6c, 0x0, 0x0, 0xe3,
-
-    /* U+0029 ")" */
-    0xd, 0x40, 0x0, 0x6b, 0x0, 0x0, 0xf3, 0x0,
-    0x9, 0xa0, 0x0, 0x5e, 0x0, 0x1, 0xf2, 0x0,
-    0xf, 0x40, 0x0, 0xe5, 0x0, 0xe, 0x50, 0x0,
-    0xf4, 0x0, 0x1f, 0x20, 0x5, 0xe0, 0x0, 0x9a,
-    0x0, 0xf, 0x30, 0x6, 0xc0, 0x0, 0xd4, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x7, 0x90, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x48, 0x26, 0x81, 0x86, 0x39, 0xee, 0xee, 0xa4,
-    0x0, 0x1e, 0xe1, 0x0, 0x0, 0xa8, 0x6c, 0x0,
-    0x6, 0xd0, 0xb, 0x70, 0x0, 0x20, 0x1, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0xb, 0x60,
-    0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0xb,
-    0x60, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xd0, 0x22,
-    0x2c, 0x72, 0x22, 0x0, 0x0, 0xb6, 0x0, 0x0,
-    0x0, 0xb, 0x60, 0x0, 0x0, 0x0, 0xb6, 0x0,
-    0x0,
-
-    /* U+002C "," */
-    0x0, 0xb, 0xd0, 0xaf, 0x40, 0xc2, 0x8a, 0x6,
-    0x0,
-
-    /* U+002D "-" */
-    0x3f, 0xff, 0xff, 0xff, 0xd0, 0x22, 0x22, 0x22,
-    0x22,
-
-    /* U+002E "." */
-    0x0, 0xa, 0xd0, 0x9c, 0x0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x62, 0x0, 0x0, 0x1, 0xf1,
-    0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0xd, 0x40,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x99, 0x0,
-    0x0, 0x0, 0xe3, 0x0, 0x0, 0x4, 0xd0, 0x0,
-    0x0, 0xa, 0x70, 0x0, 0x0, 0xf, 0x10, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x2, 0xf0, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0,
-    0xd, 0x40, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x2a, 0xed, 0x80, 0x0, 0x1d, 0xb4, 0x6e,
-    0x90, 0x8, 0xc0, 0x0, 0x3f, 0x20, 0xe6, 0x0,
-    0x0, 0xc7, 0xf, 0x30, 0x0, 0x9, 0xa2, 0xf2,
-    0x0, 0x0, 0x8b, 0x2f, 0x20, 0x0, 0x8, 0xb0,
-    0xf3, 0x0, 0x0, 0x9a, 0xe, 0x60, 0x0, 0xc,
-    0x70, 0x8c, 0x0, 0x3, 0xf2, 0x1, 0xdb, 0x46,
-    0xe9, 0x0, 0x2, 0xae, 0xd7, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x1c, 0xb0, 0x6e, 0xfb, 0x4e, 0x69, 0xb1,
-    0x0, 0x9b, 0x0, 0x9, 0xb0, 0x0, 0x9b, 0x0,
-    0x9, 0xb0, 0x0, 0x9b, 0x0, 0x9, 0xb0, 0x0,
-    0x9b, 0x0, 0x9, 0xb0, 0x0, 0x9b,
-
-    /* U+0032 "2" */
-    0x0, 0x1a, 0xee, 0xa2, 0x0, 0x1e, 0xa4, 0x4b,
-    0xe1, 0x9, 0xd0, 0x0, 0xe, 0x60, 0xc8, 0x0,
-    0x0, 0xc8, 0x4, 0x20, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0xa, 0xe3, 0x0,
-    0x0, 0x2d, 0xc1, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0xb, 0xd3, 0x33,
-    0x33, 0x20, 0xef, 0xff, 0xff, 0xf9,
-
-    /* U+0033 "3" */
-    0x0, 0x3b, 0xee, 0xb3, 0x0, 0x3f, 0x94, 0x4a,
-    0xf2, 0xb, 0xa0, 0x0, 0xe, 0x70, 0x63, 0x0,
-    0x0, 0xc6, 0x0, 0x0, 0x0, 0x6e, 0x10, 0x0,
-    0xe, 0xfe, 0x20, 0x0, 0x0, 0x13, 0x8d, 0x20,
-    0x0, 0x0, 0x0, 0xba, 0x1e, 0x30, 0x0, 0x9,
-    0xb0, 0xd8, 0x0, 0x0, 0xd9, 0x4, 0xf8, 0x34,
-    0xbe, 0x10, 0x4, 0xcf, 0xea, 0x20,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x1e,
-    0xf5, 0x0, 0x0, 0x0, 0xb8, 0xd5, 0x0, 0x0,
-    0x6, 0xc0, 0xd5, 0x0, 0x0, 0x3e, 0x20, 0xd5,
-    0x0, 0x0, 0xd5, 0x0, 0xd5, 0x0, 0x9, 0x90,
-    0x0, 0xd5, 0x0, 0x5d, 0x0, 0x0, 0xd5, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xf3, 0x12, 0x22, 0x22,
-    0xe7, 0x20, 0x0, 0x0, 0x0, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0xd5, 0x0,
-
-    /* U+0035 "5" */
-    0x5, 0xff, 0xff, 0xff, 0x40, 0x7c, 0x33, 0x33,
-    0x31, 0x8, 0xa0, 0x0, 0x0, 0x0, 0xa8, 0x0,
-    0x0, 0x0, 0xb, 0x78, 0xde, 0xa2, 0x0, 0xdf,
-    0x83, 0x4b, 0xe1, 0x7, 0x50, 0x0, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0x9b, 0x5, 0x0, 0x0, 0x9,
-    0xb0, 0xf6, 0x0, 0x0, 0xe7, 0x6, 0xf8, 0x45,
-    0xdd, 0x0, 0x5, 0xcf, 0xd9, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x9, 0xee, 0xb3, 0x0, 0xc, 0xb4, 0x5b,
-    0xe1, 0x6, 0xd0, 0x0, 0xe, 0x70, 0xc6, 0x0,
-    0x0, 0x0, 0xf, 0x26, 0xce, 0xb2, 0x1, 0xf8,
-    0xa3, 0x4b, 0xe1, 0x2f, 0xb0, 0x0, 0xd, 0x81,
-    0xf5, 0x0, 0x0, 0x9b, 0xf, 0x60, 0x0, 0x9,
-    0xb0, 0x9b, 0x0, 0x0, 0xe7, 0x2, 0xea, 0x44,
-    0xcd, 0x0, 0x2, 0xae, 0xea, 0x10,
-
-    /* U+0037 "7" */
-    0x7f, 0xff, 0xff, 0xff, 0x1, 0x44, 0x44, 0x49,
-    0xe0, 0x0, 0x0, 0x0, 0xc8, 0x0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0xe5, 0x0, 0x0, 0x0, 0x5e, 0x0, 0x0,
-    0x0, 0xc, 0x90, 0x0, 0x0, 0x2, 0xf3, 0x0,
-    0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0xe, 0x60,
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x5c, 0xfe, 0xa2, 0x0, 0x6f, 0x62, 0x3a,
-    0xe1, 0xd, 0x70, 0x0, 0xd, 0x60, 0xc6, 0x0,
-    0x0, 0xc6, 0x6, 0xd3, 0x0, 0x6e, 0x10, 0x8,
-    0xff, 0xff, 0x30, 0x8, 0xe6, 0x23, 0x9f, 0x32,
-    0xf3, 0x0, 0x0, 0xab, 0x4f, 0x0, 0x0, 0x6,
-    0xe2, 0xf3, 0x0, 0x0, 0xab, 0xa, 0xe5, 0x23,
-    0x9f, 0x40, 0x7, 0xdf, 0xeb, 0x30,
-
-    /* U+0039 "9" */
-    0x0, 0x5c, 0xfd, 0x80, 0x0, 0x6f, 0x73, 0x4c,
-    0xa0, 0xf, 0x60, 0x0, 0x1e, 0x32, 0xf2, 0x0,
-    0x0, 0xb8, 0xf, 0x40, 0x0, 0xe, 0xa0, 0xae,
-    0x40, 0x2a, 0xcc, 0x0, 0x9f, 0xfe, 0x58, 0xb0,
-    0x0, 0x1, 0x0, 0xa9, 0x7, 0x20, 0x0, 0xe,
-    0x60, 0xb9, 0x0, 0x6, 0xf0, 0x4, 0xf7, 0x37,
-    0xf6, 0x0, 0x5, 0xcf, 0xc6, 0x0,
-
-    /* U+003A ":" */
-    0x0, 0xa, 0xd0, 0x9c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xd0, 0x9c, 0x0,
-
-    /* U+003B ";" */
-    0x0, 0xa, 0xd0, 0x9c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xd0, 0xaf, 0x40, 0xc2, 0x8a,
-    0x6, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x1, 0x70, 0x0, 0x0, 0x29,
-    0xfa, 0x0, 0x2, 0xaf, 0xa2, 0x0, 0x3b, 0xf9,
-    0x20, 0x0, 0x3f, 0xc1, 0x0, 0x0, 0x0, 0x7e,
-    0xc5, 0x0, 0x0, 0x0, 0x7, 0xed, 0x60, 0x0,
-    0x0, 0x0, 0x6d, 0xe6, 0x0, 0x0, 0x0, 0x5,
-    0xa0,
-
-    /* U+003D "=" */
-    0x3f, 0xff, 0xff, 0xff, 0xd0, 0x22, 0x22, 0x22,
-    0x22, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfd, 0x2, 0x22, 0x22, 0x22, 0x20,
-
-    /* U+003E ">" */
-    0x26, 0x0, 0x0, 0x0, 0x1, 0xde, 0x70, 0x0,
-    0x0, 0x0, 0x5c, 0xe7, 0x10, 0x0, 0x0, 0x4,
-    0xbf, 0x81, 0x0, 0x0, 0x0, 0x4e, 0xd0, 0x0,
-    0x1, 0x7e, 0xc5, 0x0, 0x18, 0xfc, 0x40, 0x1,
-    0x9f, 0xb3, 0x0, 0x0, 0x3a, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x0, 0x7d, 0xfd, 0x50, 0x7, 0xe6, 0x37, 0xf5,
-    0xf, 0x50, 0x0, 0xaa, 0x1d, 0x10, 0x0, 0x9b,
-    0x0, 0x0, 0x1, 0xe7, 0x0, 0x0, 0x1c, 0xc0,
-    0x0, 0x0, 0xcc, 0x0, 0x0, 0x3, 0xf1, 0x0,
-    0x0, 0x5, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xd0, 0x0, 0x0, 0x7, 0xd0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x7b, 0xee, 0xc7, 0x0, 0x0, 0x2,
-    0xd9, 0x30, 0x2, 0x9d, 0x10, 0x0, 0xe5, 0x5,
-    0xcd, 0x48, 0x6b, 0x0, 0x9a, 0x5, 0xf6, 0x3d,
-    0xb0, 0xc2, 0xe, 0x30, 0xe5, 0x0, 0xa6, 0x9,
-    0x51, 0xf0, 0x3e, 0x0, 0xd, 0x20, 0xa3, 0x1f,
-    0x5, 0xc0, 0x3, 0xe0, 0x1d, 0x0, 0xe2, 0x2f,
-    0x23, 0xcc, 0x1b, 0x60, 0xa, 0x70, 0x7e, 0xd3,
-    0xcd, 0x63, 0x50, 0x2e, 0x20, 0x0, 0x0, 0x2,
-    0xe3, 0x0, 0x5e, 0x72, 0x0, 0x16, 0xd4, 0x0,
-    0x0, 0x18, 0xce, 0xed, 0x81, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x1f,
-    0xd9, 0x0, 0x0, 0x0, 0x6, 0xc4, 0xe0, 0x0,
-    0x0, 0x0, 0xc6, 0xe, 0x50, 0x0, 0x0, 0x2f,
-    0x0, 0x8b, 0x0, 0x0, 0x8, 0xa0, 0x2, 0xf1,
-    0x0, 0x0, 0xe3, 0x0, 0xb, 0x70, 0x0, 0x4f,
-    0xff, 0xff, 0xfd, 0x0, 0xa, 0x92, 0x22, 0x23,
-    0xf3, 0x1, 0xf3, 0x0, 0x0, 0xb, 0x90, 0x6e,
-    0x0, 0x0, 0x0, 0x6e, 0xc, 0x90, 0x0, 0x0,
-    0x1, 0xf5,
-
-    /* U+0042 "B" */
-    0xdf, 0xff, 0xff, 0xc5, 0x0, 0xd8, 0x22, 0x23,
-    0x8f, 0x40, 0xd7, 0x0, 0x0, 0xb, 0x90, 0xd7,
-    0x0, 0x0, 0xa, 0x90, 0xd7, 0x0, 0x0, 0x5e,
-    0x30, 0xdf, 0xff, 0xff, 0xf5, 0x0, 0xd8, 0x22,
-    0x23, 0x7e, 0x70, 0xd7, 0x0, 0x0, 0x6, 0xf0,
-    0xd7, 0x0, 0x0, 0x2, 0xf2, 0xd7, 0x0, 0x0,
-    0x6, 0xf0, 0xd8, 0x22, 0x24, 0x8f, 0x90, 0xdf,
-    0xff, 0xff, 0xd7, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x5, 0xbe, 0xfc, 0x60, 0x0, 0x9, 0xf9,
-    0x54, 0x8e, 0xa0, 0x5, 0xf3, 0x0, 0x0, 0x2e,
-    0x60, 0xd8, 0x0, 0x0, 0x0, 0x78, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x0, 0x13, 0xe, 0x70, 0x0, 0x0,
-    0x8, 0xb0, 0x6e, 0x20, 0x0, 0x3, 0xf5, 0x0,
-    0xaf, 0x85, 0x48, 0xf9, 0x0, 0x0, 0x6b, 0xee,
-    0xc5, 0x0,
-
-    /* U+0044 "D" */
-    0xdf, 0xff, 0xfc, 0x91, 0x0, 0xd9, 0x33, 0x46,
-    0xde, 0x30, 0xd7, 0x0, 0x0, 0xa, 0xc0, 0xd7,
-    0x0, 0x0, 0x2, 0xf4, 0xd7, 0x0, 0x0, 0x0,
-    0xd6, 0xd7, 0x0, 0x0, 0x0, 0xb8, 0xd7, 0x0,
-    0x0, 0x0, 0xb8, 0xd7, 0x0, 0x0, 0x0, 0xd6,
-    0xd7, 0x0, 0x0, 0x3, 0xf3, 0xd7, 0x0, 0x0,
-    0xc, 0xb0, 0xd9, 0x33, 0x47, 0xed, 0x20, 0xdf,
-    0xff, 0xec, 0x80, 0x0,
-
-    /* U+0045 "E" */
-    0xdf, 0xff, 0xff, 0xff, 0x3d, 0x93, 0x33, 0x33,
-    0x30, 0xd7, 0x0, 0x0, 0x0, 0xd, 0x70, 0x0,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xd0, 0xd9, 0x22, 0x22, 0x22, 0xd,
-    0x70, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd, 0x70, 0x0, 0x0, 0x0, 0xd9, 0x33, 0x33,
-    0x33, 0x1d, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+0046 "F" */
-    0xdf, 0xff, 0xff, 0xfc, 0xd9, 0x33, 0x33, 0x32,
-    0xd7, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf7,
-    0xd9, 0x22, 0x22, 0x21, 0xd7, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x5, 0xbe, 0xec, 0x60, 0x0, 0x8, 0xf9,
-    0x54, 0x8f, 0xb0, 0x5, 0xf3, 0x0, 0x0, 0x2f,
-    0x60, 0xd8, 0x0, 0x0, 0x0, 0x9c, 0x1f, 0x30,
-    0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0xff, 0xff, 0xe1, 0xf2,
-    0x0, 0x2, 0x22, 0x7e, 0xe, 0x80, 0x0, 0x0,
-    0x5, 0xe0, 0x5f, 0x30, 0x0, 0x0, 0x6e, 0x0,
-    0x9f, 0x95, 0x45, 0x9f, 0xb0, 0x0, 0x4a, 0xdf,
-    0xda, 0x40,
-
-    /* U+0048 "H" */
-    0xd7, 0x0, 0x0, 0x0, 0xe6, 0xd7, 0x0, 0x0,
-    0x0, 0xe6, 0xd7, 0x0, 0x0, 0x0, 0xe6, 0xd7,
-    0x0, 0x0, 0x0, 0xe6, 0xd7, 0x0, 0x0, 0x0,
-    0xe6, 0xdf, 0xff, 0xff, 0xff, 0xf6, 0xd9, 0x22,
-    0x22, 0x22, 0xe6, 0xd7, 0x0, 0x0, 0x0, 0xe6,
-    0xd7, 0x0, 0x0, 0x0, 0xe6, 0xd7, 0x0, 0x0,
-    0x0, 0xe6, 0xd7, 0x0, 0x0, 0x0, 0xe6, 0xd7,
-    0x0, 0x0, 0x0, 0xe6,
-
-    /* U+0049 "I" */
-    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
-    0xb8, 0xb8, 0xb8, 0xb8,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x3, 0xf1, 0x9c, 0x0, 0x7, 0xf0,
-    0x3f, 0x84, 0x6f, 0x90, 0x5, 0xdf, 0xd8, 0x0,
-
-    /* U+004B "K" */
-    0xd7, 0x0, 0x0, 0x1c, 0xc0, 0xd, 0x70, 0x0,
-    0x1c, 0xc0, 0x0, 0xd7, 0x0, 0xc, 0xc0, 0x0,
-    0xd, 0x70, 0xc, 0xc0, 0x0, 0x0, 0xd7, 0xc,
-    0xc0, 0x0, 0x0, 0xd, 0x8c, 0xf7, 0x0, 0x0,
-    0x0, 0xdf, 0xb6, 0xf5, 0x0, 0x0, 0xd, 0xc0,
-    0x8, 0xf3, 0x0, 0x0, 0xd7, 0x0, 0xa, 0xe2,
-    0x0, 0xd, 0x70, 0x0, 0xc, 0xd0, 0x0, 0xd7,
-    0x0, 0x0, 0x1e, 0xb0, 0xd, 0x70, 0x0, 0x0,
-    0x3f, 0x90,
-
-    /* U+004C "L" */
-    0xd7, 0x0, 0x0, 0x0, 0xd, 0x70, 0x0, 0x0,
-    0x0, 0xd7, 0x0, 0x0, 0x0, 0xd, 0x70, 0x0,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd, 0x70,
-    0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd,
-    0x70, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd, 0x70, 0x0, 0x0, 0x0, 0xd9, 0x33, 0x33,
-    0x33, 0xd, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+004D "M" */
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xdf, 0x60,
-    0x0, 0x0, 0x4, 0xff, 0xde, 0xd0, 0x0, 0x0,
-    0xb, 0xef, 0xd8, 0xf3, 0x0, 0x0, 0x2f, 0x8f,
-    0xd7, 0xaa, 0x0, 0x0, 0x8b, 0x5f, 0xd7, 0x3f,
-    0x10, 0x0, 0xe5, 0x5f, 0xd7, 0xd, 0x70, 0x5,
-    0xe0, 0x5f, 0xd7, 0x6, 0xe0, 0xc, 0x80, 0x5f,
-    0xd7, 0x0, 0xf5, 0x3f, 0x10, 0x5f, 0xd7, 0x0,
-    0x9b, 0x9a, 0x0, 0x5f, 0xd7, 0x0, 0x2f, 0xf4,
-    0x0, 0x5f, 0xd7, 0x0, 0xb, 0xd0, 0x0, 0x5f,
-
-    /* U+004E "N" */
-    0xdd, 0x0, 0x0, 0x0, 0xf5, 0xdf, 0x80, 0x0,
-    0x0, 0xf5, 0xdb, 0xf3, 0x0, 0x0, 0xf5, 0xd7,
-    0x9d, 0x0, 0x0, 0xf5, 0xd7, 0xe, 0x80, 0x0,
-    0xf5, 0xd7, 0x4, 0xf2, 0x0, 0xf5, 0xd7, 0x0,
-    0x9c, 0x0, 0xf5, 0xd7, 0x0, 0xe, 0x70, 0xf5,
-    0xd7, 0x0, 0x4, 0xf2, 0xf5, 0xd7, 0x0, 0x0,
-    0xac, 0xf5, 0xd7, 0x0, 0x0, 0x1e, 0xf5, 0xd7,
-    0x0, 0x0, 0x5, 0xf5,
-
-    /* U+004F "O" */
-    0x0, 0x4, 0xae, 0xeb, 0x70, 0x0, 0x0, 0x8f,
-    0x95, 0x47, 0xec, 0x10, 0x5, 0xf4, 0x0, 0x0,
-    0x1d, 0x90, 0xd, 0x90, 0x0, 0x0, 0x4, 0xf2,
-    0x1f, 0x30, 0x0, 0x0, 0x0, 0xe5, 0x4f, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0xc8, 0x1f, 0x30, 0x0, 0x0, 0x0, 0xe5,
-    0xe, 0x80, 0x0, 0x0, 0x4, 0xf2, 0x5, 0xf3,
-    0x0, 0x0, 0x1d, 0x90, 0x0, 0x9f, 0x95, 0x47,
-    0xec, 0x10, 0x0, 0x4, 0xbe, 0xeb, 0x70, 0x0,
-
-    /* U+0050 "P" */
-    0xdf, 0xff, 0xfe, 0xb3, 0xd, 0x93, 0x33, 0x4a,
-    0xf3, 0xd7, 0x0, 0x0, 0xc, 0x9d, 0x70, 0x0,
-    0x0, 0x9b, 0xd7, 0x0, 0x0, 0xb, 0x9d, 0x70,
-    0x0, 0x17, 0xf4, 0xdf, 0xff, 0xff, 0xe6, 0xd,
-    0x92, 0x22, 0x10, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd, 0x70, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0,
-    0x0, 0xd, 0x70, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x4, 0xae, 0xeb, 0x70, 0x0, 0x0, 0x8f,
-    0x95, 0x47, 0xec, 0x10, 0x5, 0xf4, 0x0, 0x0,
-    0x1d, 0x90, 0xd, 0x90, 0x0, 0x0, 0x4, 0xf2,
-    0x1f, 0x30, 0x0, 0x0, 0x0, 0xe5, 0x4f, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0xc8, 0x1f, 0x30, 0x0, 0x29, 0x0, 0xe5,
-    0xe, 0x80, 0x0, 0xc, 0x94, 0xf2, 0x5, 0xf3,
-    0x0, 0x1, 0xee, 0x90, 0x0, 0x9f, 0x95, 0x47,
-    0xef, 0x40, 0x0, 0x4, 0xbe, 0xfc, 0x67, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa2,
-
-    /* U+0052 "R" */
-    0xdf, 0xff, 0xff, 0xc4, 0x0, 0xd9, 0x33, 0x34,
-    0x9f, 0x30, 0xd7, 0x0, 0x0, 0xc, 0x90, 0xd7,
-    0x0, 0x0, 0x9, 0xc0, 0xd7, 0x0, 0x0, 0xb,
-    0xa0, 0xd7, 0x0, 0x1, 0x7f, 0x20, 0xdf, 0xff,
-    0xff, 0xf3, 0x0, 0xd9, 0x22, 0x34, 0xaf, 0x10,
-    0xd7, 0x0, 0x0, 0xd, 0x70, 0xd7, 0x0, 0x0,
-    0xa, 0x90, 0xd7, 0x0, 0x0, 0x8, 0xc0, 0xd7,
-    0x0, 0x0, 0x4, 0xf2,
-
-    /* U+0053 "S" */
-    0x0, 0x6c, 0xfe, 0xc6, 0x0, 0x9, 0xe7, 0x44,
-    0x8f, 0x80, 0xf, 0x40, 0x0, 0x6, 0xf0, 0x1f,
-    0x40, 0x0, 0x0, 0xa2, 0xa, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0xfa, 0x50, 0x0, 0x0, 0x0,
-    0x27, 0xde, 0x50, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0x5f, 0x0, 0x0, 0x0, 0xc8, 0x1f, 0x50, 0x0,
-    0x0, 0xe6, 0x7, 0xf8, 0x44, 0x6d, 0xe1, 0x0,
-    0x5c, 0xef, 0xd9, 0x10,
-
-    /* U+0054 "T" */
-    0xbf, 0xff, 0xff, 0xff, 0xf9, 0x23, 0x33, 0xca,
-    0x33, 0x32, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xd7, 0x0, 0x0, 0x0, 0xf4, 0xd7, 0x0, 0x0,
-    0x0, 0xf4, 0xd7, 0x0, 0x0, 0x0, 0xf4, 0xd7,
-    0x0, 0x0, 0x0, 0xf4, 0xd7, 0x0, 0x0, 0x0,
-    0xf4, 0xd7, 0x0, 0x0, 0x0, 0xf4, 0xd7, 0x0,
-    0x0, 0x0, 0xf4, 0xc8, 0x0, 0x0, 0x1, 0xf3,
-    0xaa, 0x0, 0x0, 0x3, 0xf1, 0x6f, 0x10, 0x0,
-    0x9, 0xd0, 0xd, 0xe6, 0x45, 0xaf, 0x40, 0x0,
-    0x8d, 0xfe, 0xb3, 0x0,
-
-    /* U+0056 "V" */
-    0xba, 0x0, 0x0, 0x0, 0x7e, 0x6, 0xf0, 0x0,
-    0x0, 0xc, 0x90, 0x1f, 0x50, 0x0, 0x2, 0xf4,
-    0x0, 0xbb, 0x0, 0x0, 0x7e, 0x0, 0x5, 0xf1,
-    0x0, 0xd, 0x80, 0x0, 0xf, 0x60, 0x2, 0xf3,
-    0x0, 0x0, 0xab, 0x0, 0x8d, 0x0, 0x0, 0x4,
-    0xf1, 0xd, 0x80, 0x0, 0x0, 0xe, 0x62, 0xf2,
-    0x0, 0x0, 0x0, 0x9c, 0x8c, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x70, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xca, 0x0, 0x0, 0x6f, 0x40, 0x0, 0xc, 0xa8,
-    0xe0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0xf6, 0x3f,
-    0x20, 0x0, 0xeb, 0xc0, 0x0, 0x4f, 0x10, 0xf6,
-    0x0, 0x2f, 0x3f, 0x10, 0x8, 0xd0, 0xb, 0xa0,
-    0x6, 0xc0, 0xe4, 0x0, 0xc9, 0x0, 0x6e, 0x0,
-    0xb8, 0x9, 0x90, 0xf, 0x40, 0x2, 0xf2, 0xf,
-    0x30, 0x5d, 0x4, 0xf0, 0x0, 0xd, 0x63, 0xf0,
-    0x1, 0xf1, 0x8b, 0x0, 0x0, 0x9a, 0x7b, 0x0,
-    0xd, 0x5c, 0x70, 0x0, 0x5, 0xeb, 0x70, 0x0,
-    0x9a, 0xf3, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x5,
-    0xfe, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x1f,
-    0xa0, 0x0,
-
-    /* U+0058 "X" */
-    0x4f, 0x50, 0x0, 0x2, 0xf7, 0x0, 0x9e, 0x10,
-    0x0, 0xcc, 0x0, 0x0, 0xda, 0x0, 0x7f, 0x20,
-    0x0, 0x4, 0xf5, 0x2f, 0x60, 0x0, 0x0, 0x9,
-    0xec, 0xb0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xda, 0x7f, 0x10, 0x0, 0x0, 0x9e, 0x10, 0xcb,
-    0x0, 0x0, 0x3f, 0x50, 0x2, 0xf6, 0x0, 0xd,
-    0xb0, 0x0, 0x7, 0xf2, 0x9, 0xe1, 0x0, 0x0,
-    0xc, 0xc0,
-
-    /* U+0059 "Y" */
-    0x9e, 0x0, 0x0, 0x0, 0x6f, 0x31, 0xe9, 0x0,
-    0x0, 0x1e, 0x80, 0x5, 0xf3, 0x0, 0xa, 0xd0,
-    0x0, 0xa, 0xd0, 0x4, 0xf4, 0x0, 0x0, 0x1f,
-    0x70, 0xda, 0x0, 0x0, 0x0, 0x6f, 0x9e, 0x10,
-    0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x0,
-    0x5, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf0,
-    0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x1f, 0xff, 0xff, 0xff, 0xf3, 0x3, 0x33, 0x33,
-    0x3d, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0x0, 0xae, 0x10, 0x0, 0x0, 0x6,
-    0xf4, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x9, 0xe1, 0x0,
-    0x0, 0x0, 0x5f, 0x83, 0x33, 0x33, 0x31, 0x9f,
-    0xff, 0xff, 0xff, 0xf9,
-
-    /* U+005B "[" */
-    0x4f, 0xff, 0x94, 0xe2, 0x21, 0x4e, 0x0, 0x4,
-    0xe0, 0x0, 0x4e, 0x0, 0x4, 0xe0, 0x0, 0x4e,
-    0x0, 0x4, 0xe0, 0x0, 0x4e, 0x0, 0x4, 0xe0,
-    0x0, 0x4e, 0x0, 0x4, 0xe0, 0x0, 0x4e, 0x0,
-    0x4, 0xe0, 0x0, 0x4e, 0x0, 0x4, 0xff, 0xf9,
-    0x2, 0x22, 0x10,
-
-    /* U+005C "\\" */
-    0x26, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0,
-    0x0, 0xe3, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0xd, 0x40, 0x0,
-    0x0, 0x7, 0xa0, 0x0, 0x0, 0x2, 0xf0, 0x0,
-    0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0xa, 0x70,
-    0x0, 0x0, 0x4, 0xd0, 0x0, 0x0, 0x0, 0xe3,
-
-    /* U+005D "]" */
-    0x4f, 0xff, 0x90, 0x22, 0xa9, 0x0, 0x8, 0x90,
-    0x0, 0x89, 0x0, 0x8, 0x90, 0x0, 0x89, 0x0,
-    0x8, 0x90, 0x0, 0x89, 0x0, 0x8, 0x90, 0x0,
-    0x89, 0x0, 0x8, 0x90, 0x0, 0x89, 0x0, 0x8,
-    0x90, 0x0, 0x89, 0x0, 0x8, 0x94, 0xff, 0xf9,
-    0x2, 0x22, 0x10,
-
-    /* U+005E "^" */
-    0x0, 0xa, 0xe0, 0x0, 0x0, 0x1f, 0xc6, 0x0,
-    0x0, 0x89, 0x4d, 0x0, 0x0, 0xe2, 0xd, 0x40,
-    0x6, 0xb0, 0x6, 0xa0, 0xd, 0x30, 0x0, 0xe1,
-
-    /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x22, 0x22, 0x22,
-
-    /* U+0060 "`" */
-    0x56, 0x0, 0x1e, 0x30, 0x2, 0xc0,
-
-    /* U+0061 "a" */
-    0x0, 0x9e, 0xfd, 0x70, 0xb, 0xd5, 0x24, 0xd7,
-    0x4, 0x10, 0x0, 0x6d, 0x0, 0x7c, 0xee, 0xef,
-    0xb, 0xd4, 0x21, 0x6f, 0x2f, 0x20, 0x0, 0x7f,
-    0x4f, 0x0, 0x0, 0xdf, 0x1f, 0x92, 0x3c, 0xaf,
-    0x4, 0xdf, 0xd5, 0x3f,
-
-    /* U+0062 "b" */
-    0xf, 0x40, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0xf4, 0x7d,
-    0xe9, 0x0, 0xf, 0xb9, 0x34, 0xdc, 0x0, 0xfb,
-    0x0, 0x1, 0xf5, 0xf, 0x50, 0x0, 0xb, 0x90,
-    0xf3, 0x0, 0x0, 0xaa, 0xf, 0x50, 0x0, 0xb,
-    0x90, 0xfa, 0x0, 0x1, 0xf5, 0xf, 0xc8, 0x24,
-    0xcc, 0x0, 0xf3, 0x9e, 0xe9, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x5c, 0xfd, 0x80, 0x0, 0x6f, 0x73, 0x6e,
-    0x90, 0xe, 0x70, 0x0, 0x6f, 0x3, 0xf1, 0x0,
-    0x0, 0x10, 0x4f, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0x0, 0x0, 0x50, 0xe, 0x60, 0x0, 0x4f, 0x0,
-    0x7f, 0x62, 0x5e, 0x80, 0x0, 0x6c, 0xfd, 0x70,
-    0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0, 0xe, 0x60, 0x6, 0xce,
-    0xa1, 0xe6, 0x6, 0xf6, 0x25, 0xbe, 0x60, 0xe6,
-    0x0, 0x5, 0xf6, 0x3f, 0x10, 0x0, 0xf, 0x64,
-    0xf0, 0x0, 0x0, 0xe6, 0x3f, 0x10, 0x0, 0xf,
-    0x60, 0xe6, 0x0, 0x4, 0xf6, 0x6, 0xf6, 0x25,
-    0xde, 0x60, 0x6, 0xcf, 0xb3, 0xc6,
-
-    /* U+0065 "e" */
-    0x0, 0x6c, 0xfc, 0x50, 0x0, 0x7e, 0x63, 0x6e,
-    0x50, 0x1f, 0x50, 0x0, 0x6d, 0x5, 0xf0, 0x0,
-    0x1, 0xf2, 0x7f, 0xee, 0xee, 0xef, 0x45, 0xe1,
-    0x11, 0x11, 0x10, 0x2f, 0x30, 0x0, 0x4c, 0x0,
-    0x8e, 0x52, 0x6e, 0x80, 0x0, 0x7d, 0xfd, 0x60,
-    0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x3d, 0xfe, 0x0, 0xbb, 0x32, 0x0, 0xd7,
-    0x0, 0xef, 0xff, 0xfc, 0x22, 0xd8, 0x21, 0x0,
-    0xd6, 0x0, 0x0, 0xd6, 0x0, 0x0, 0xd6, 0x0,
-    0x0, 0xd6, 0x0, 0x0, 0xd6, 0x0, 0x0, 0xd6,
-    0x0, 0x0, 0xd6, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x5c, 0xeb, 0x2c, 0x70, 0x6f, 0x72, 0x5c,
-    0xe7, 0xe, 0x70, 0x0, 0x4f, 0x73, 0xf1, 0x0,
-    0x0, 0xe7, 0x4f, 0x0, 0x0, 0xd, 0x73, 0xf1,
-    0x0, 0x0, 0xe7, 0xe, 0x60, 0x0, 0x4f, 0x70,
-    0x6f, 0x63, 0x5c, 0xd7, 0x0, 0x6c, 0xeb, 0x2d,
-    0x60, 0x42, 0x0, 0x0, 0xf3, 0xa, 0xe4, 0x23,
-    0xbc, 0x0, 0x8, 0xef, 0xe9, 0x10,
-
-    /* U+0068 "h" */
-    0xf, 0x40, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0xf, 0x48, 0xee, 0x80,
-    0xf, 0xc7, 0x36, 0xf7, 0xf, 0x90, 0x0, 0x9c,
-    0xf, 0x50, 0x0, 0x6e, 0xf, 0x40, 0x0, 0x5e,
-    0xf, 0x40, 0x0, 0x5e, 0xf, 0x40, 0x0, 0x5e,
-    0xf, 0x40, 0x0, 0x5e, 0xf, 0x40, 0x0, 0x5e,
-
-    /* U+0069 "i" */
-    0xab, 0xa, 0xc0, 0x0, 0x9, 0xa0, 0x9a, 0x9,
-    0xa0, 0x9a, 0x9, 0xa0, 0x9a, 0x9, 0xa0, 0x9a,
-    0x9, 0xa0,
-
-    /* U+006A "j" */
-    0x0, 0x7d, 0x0, 0x8, 0xd0, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x6d, 0x0, 0x6, 0xd0, 0x0,
-    0x6d, 0x0, 0x6, 0xd0, 0x0, 0x6d, 0x0, 0x6,
-    0xd0, 0x0, 0x6d, 0x0, 0x6, 0xd0, 0x0, 0x7d,
-    0x0, 0x3c, 0xb0, 0x3f, 0xd2, 0x0,
-
-    /* U+006B "k" */
-    0xf, 0x40, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x2e, 0x90, 0xf, 0x40, 0x2e, 0x90, 0x0, 0xf4,
-    0x2e, 0x90, 0x0, 0xf, 0x6e, 0xb0, 0x0, 0x0,
-    0xff, 0xcf, 0x20, 0x0, 0xf, 0x90, 0xbd, 0x0,
-    0x0, 0xf4, 0x1, 0xe9, 0x0, 0xf, 0x40, 0x4,
-    0xf5, 0x0, 0xf4, 0x0, 0x8, 0xf2,
-
-    /* U+006C "l" */
-    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
-    0xb8, 0xb8, 0xb8, 0xb8,
-
-    /* U+006D "m" */
-    0xf, 0x5a, 0xec, 0x40, 0x9e, 0xd6, 0x0, 0xfe,
-    0x63, 0x9e, 0xa7, 0x37, 0xf4, 0xf, 0x80, 0x0,
-    0xeb, 0x0, 0xb, 0x90, 0xf4, 0x0, 0xc, 0x80,
-    0x0, 0x9a, 0xf, 0x40, 0x0, 0xc7, 0x0, 0x9,
-    0xa0, 0xf4, 0x0, 0xc, 0x70, 0x0, 0x9a, 0xf,
-    0x40, 0x0, 0xc7, 0x0, 0x9, 0xa0, 0xf4, 0x0,
-    0xc, 0x70, 0x0, 0x9a, 0xf, 0x40, 0x0, 0xc7,
-    0x0, 0x9, 0xa0,
-
-    /* U+006E "n" */
-    0xf, 0x49, 0xee, 0x80, 0xf, 0xd7, 0x36, 0xf7,
-    0xf, 0x90, 0x0, 0x8c, 0xf, 0x50, 0x0, 0x5e,
-    0xf, 0x40, 0x0, 0x5f, 0xf, 0x40, 0x0, 0x5f,
-    0xf, 0x40, 0x0, 0x5f, 0xf, 0x40, 0x0, 0x5f,
-    0xf, 0x40, 0x0, 0x5f,
-
-    /* U+006F "o" */
-    0x0, 0x4c, 0xfd, 0x80, 0x0, 0x5f, 0x73, 0x5d,
-    0xb0, 0xe, 0x70, 0x0, 0x2f, 0x42, 0xf1, 0x0,
-    0x0, 0xb8, 0x4f, 0x0, 0x0, 0xa, 0xa2, 0xf1,
-    0x0, 0x0, 0xb8, 0xe, 0x70, 0x0, 0x2f, 0x40,
-    0x5f, 0x72, 0x4d, 0xb0, 0x0, 0x4c, 0xfd, 0x80,
-    0x0,
-
-    /* U+0070 "p" */
-    0xf, 0x39, 0xee, 0x90, 0x0, 0xfc, 0x93, 0x4d,
-    0xc0, 0xf, 0xa0, 0x0, 0x1f, 0x50, 0xf5, 0x0,
-    0x0, 0xb9, 0xf, 0x30, 0x0, 0xa, 0xa0, 0xf5,
-    0x0, 0x0, 0xb9, 0xf, 0xa0, 0x0, 0x1f, 0x50,
-    0xfb, 0x82, 0x4c, 0xc0, 0xf, 0x47, 0xde, 0xa0,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x6c, 0xfb, 0x2c, 0x60, 0x6f, 0x62, 0x5d,
-    0xe6, 0xe, 0x60, 0x0, 0x4f, 0x63, 0xf1, 0x0,
-    0x0, 0xf6, 0x4f, 0x0, 0x0, 0xe, 0x63, 0xf1,
-    0x0, 0x0, 0xf6, 0xe, 0x60, 0x0, 0x4f, 0x60,
-    0x7f, 0x62, 0x5b, 0xe6, 0x0, 0x6d, 0xea, 0x1e,
-    0x60, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0,
-    0xe, 0x60, 0x0, 0x0, 0x0, 0xe6,
-
-    /* U+0072 "r" */
-    0xf, 0x4a, 0xfc, 0xf, 0xcc, 0x66, 0xf, 0xc0,
-    0x0, 0xf, 0x60, 0x0, 0xf, 0x40, 0x0, 0xf,
-    0x30, 0x0, 0xf, 0x30, 0x0, 0xf, 0x30, 0x0,
-    0xf, 0x30, 0x0,
-
-    /* U+0073 "s" */
-    0x3, 0xbf, 0xeb, 0x20, 0x1f, 0x93, 0x4b, 0xe0,
-    0x3f, 0x10, 0x1, 0xa2, 0xc, 0xd7, 0x20, 0x0,
-    0x0, 0x6b, 0xfd, 0x50, 0x0, 0x0, 0x6, 0xf4,
-    0x5d, 0x0, 0x0, 0xd8, 0x1e, 0x92, 0x27, 0xf4,
-    0x3, 0xbe, 0xfd, 0x60,
-
-    /* U+0074 "t" */
-    0x0, 0x82, 0x0, 0x0, 0xf3, 0x0, 0x0, 0xf3,
-    0x0, 0xbf, 0xff, 0xf3, 0x13, 0xf5, 0x20, 0x0,
-    0xf3, 0x0, 0x0, 0xf3, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0xf3, 0x0, 0x0, 0xf3, 0x0, 0x0, 0xe7,
-    0x20, 0x0, 0x7f, 0xf0,
-
-    /* U+0075 "u" */
-    0xf, 0x40, 0x0, 0x4f, 0xf, 0x40, 0x0, 0x4f,
-    0xf, 0x40, 0x0, 0x4f, 0xf, 0x40, 0x0, 0x4f,
-    0xf, 0x40, 0x0, 0x4f, 0xf, 0x40, 0x0, 0x5f,
-    0xe, 0x70, 0x0, 0xbf, 0x9, 0xe5, 0x39, 0xdf,
-    0x0, 0x9e, 0xd8, 0x5f,
-
-    /* U+0076 "v" */
-    0xba, 0x0, 0x0, 0xe7, 0x6f, 0x0, 0x4, 0xf1,
-    0x1f, 0x40, 0x9, 0xc0, 0xb, 0xa0, 0xe, 0x60,
-    0x5, 0xe0, 0x3f, 0x10, 0x0, 0xf4, 0x9b, 0x0,
-    0x0, 0xa9, 0xe5, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0xf, 0xa0, 0x0,
-
-    /* U+0077 "w" */
-    0xc9, 0x0, 0xb, 0xc0, 0x0, 0x8d, 0x7e, 0x0,
-    0xf, 0xf0, 0x0, 0xd8, 0x2f, 0x20, 0x3d, 0xc4,
-    0x1, 0xf3, 0xd, 0x70, 0x79, 0x78, 0x6, 0xe0,
-    0x8, 0xb0, 0xb4, 0x3d, 0xa, 0x90, 0x3, 0xf1,
-    0xf0, 0xf, 0x1e, 0x40, 0x0, 0xe9, 0xc0, 0xb,
-    0x9f, 0x0, 0x0, 0x9f, 0x70, 0x6, 0xfa, 0x0,
-    0x0, 0x4f, 0x30, 0x2, 0xf5, 0x0,
-
-    /* U+0078 "x" */
-    0x3f, 0x40, 0x2, 0xf5, 0x0, 0x8e, 0x0, 0xca,
-    0x0, 0x0, 0xd9, 0x7e, 0x10, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0xd, 0xe1, 0x0, 0x0, 0x8,
-    0xdc, 0xa0, 0x0, 0x3, 0xf4, 0x2f, 0x50, 0x0,
-    0xd9, 0x0, 0x7e, 0x10, 0x9e, 0x0, 0x0, 0xcb,
-    0x0,
-
-    /* U+0079 "y" */
-    0xba, 0x0, 0x0, 0xba, 0x5f, 0x0, 0x1, 0xf4,
-    0xe, 0x60, 0x7, 0xe0, 0x9, 0xc0, 0xc, 0x80,
-    0x2, 0xf2, 0x2f, 0x20, 0x0, 0xc8, 0x8c, 0x0,
-    0x0, 0x6d, 0xd6, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0xb, 0xa0, 0x0, 0x0, 0x1f, 0x40, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x6f, 0xff, 0xff, 0xf2, 0x2, 0x22, 0x2d, 0xb0,
-    0x0, 0x0, 0x8e, 0x10, 0x0, 0x4, 0xf4, 0x0,
-    0x0, 0x1e, 0x80, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x7, 0xe2, 0x0, 0x0, 0x3f, 0x72, 0x22, 0x20,
-    0x9f, 0xff, 0xff, 0xf6,
-
-    /* U+007B "{" */
-    0x0, 0x4d, 0xe0, 0xe, 0x72, 0x1, 0xf1, 0x0,
-    0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x3,
-    0xf0, 0x0, 0x8b, 0x0, 0xaf, 0x10, 0x2, 0xab,
-    0x0, 0x3, 0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0,
-    0x0, 0x2f, 0x0, 0x0, 0xf4, 0x0, 0x8, 0xfe,
-    0x0, 0x0, 0x10,
-
-    /* U+007C "|" */
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1,
-
-    /* U+007D "}" */
-    0x9e, 0x80, 0x1, 0x4f, 0x40, 0x0, 0xb7, 0x0,
-    0xb, 0x70, 0x0, 0xb7, 0x0, 0xb, 0x70, 0x0,
-    0xa8, 0x0, 0x6, 0xc1, 0x0, 0xb, 0xf0, 0x5,
-    0xd4, 0x0, 0xa8, 0x0, 0xb, 0x70, 0x0, 0xb7,
-    0x0, 0xb, 0x70, 0x1, 0xe6, 0x9, 0xfc, 0x0,
-    0x11, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x1a, 0xea, 0x40, 0x54, 0x57, 0x16, 0xdf, 0xd2,
-    0x0, 0x0, 0x1, 0x0,
-
-    /* U+007F "" */
-
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 85, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 85, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18, .adv_w = 109, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 31, .adv_w = 154, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 91, .adv_w = 154, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 163, .adv_w = 248, .box_w = 14, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 247, .adv_w = 186, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 319, .adv_w = 62, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 324, .adv_w = 85, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 364, .adv_w = 85, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 404, .adv_w = 130, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 436, .adv_w = 155, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 477, .adv_w = 68, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 486, .adv_w = 155, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 495, .adv_w = 68, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 500, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 564, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 618, .adv_w = 103, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 648, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 702, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 756, .adv_w = 154, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 816, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 870, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 924, .adv_w = 140, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 978, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1032, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1086, .adv_w = 68, .box_w = 3, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1100, .adv_w = 68, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1118, .adv_w = 155, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1159, .adv_w = 155, .box_w = 9, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 1182, .adv_w = 155, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1223, .adv_w = 137, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1271, .adv_w = 220, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1349, .adv_w = 168, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1415, .adv_w = 173, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1475, .adv_w = 186, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1541, .adv_w = 181, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1601, .adv_w = 163, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1655, .adv_w = 148, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1703, .adv_w = 191, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1769, .adv_w = 184, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1829, .adv_w = 61, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1841, .adv_w = 132, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1889, .adv_w = 177, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1955, .adv_w = 151, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2009, .adv_w = 226, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2081, .adv_w = 184, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2141, .adv_w = 196, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2213, .adv_w = 164, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2267, .adv_w = 196, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2345, .adv_w = 173, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2405, .adv_w = 162, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2465, .adv_w = 158, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2525, .adv_w = 183, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2585, .adv_w = 164, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2651, .adv_w = 238, .box_w = 15, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2741, .adv_w = 163, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2807, .adv_w = 169, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2873, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2933, .adv_w = 85, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2976, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3040, .adv_w = 85, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3083, .adv_w = 133, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 3107, .adv_w = 128, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3115, .adv_w = 85, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 3121, .adv_w = 143, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3157, .adv_w = 150, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3211, .adv_w = 140, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3252, .adv_w = 150, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3306, .adv_w = 142, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3347, .adv_w = 95, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3383, .adv_w = 151, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3437, .adv_w = 142, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3485, .adv_w = 66, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3503, .adv_w = 68, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 3541, .adv_w = 135, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3595, .adv_w = 60, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3607, .adv_w = 219, .box_w = 13, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3666, .adv_w = 143, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3702, .adv_w = 150, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3743, .adv_w = 150, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3797, .adv_w = 150, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3851, .adv_w = 93, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3878, .adv_w = 129, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3914, .adv_w = 91, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3950, .adv_w = 143, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3986, .adv_w = 123, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4022, .adv_w = 193, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4076, .adv_w = 130, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4117, .adv_w = 127, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4165, .adv_w = 125, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4201, .adv_w = 85, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4244, .adv_w = 50, .box_w = 2, .box_h = 17, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4261, .adv_w = 85, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4304, .adv_w = 128, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 4316, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 96, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 1,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t ui_font_PingFangEN16 = {
-#else
-lv_font_t ui_font_PingFangEN16 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 18,          /*The maximum line height required by the font*/
-    .base_line = 3,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if UI_FONT_PINGFANGEN16*/
-
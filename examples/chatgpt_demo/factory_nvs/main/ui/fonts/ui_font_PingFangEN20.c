@@ -1,1252 +0,0 @@
-/*******************************************************************************
- * Size: 20 px
- * Bpp: 4
- * Opts: --bpp 4 --size 20 --font C:\Users\liu\Desktop\Project\squareline\chat_gpt_new_gui\assets\pingfang.otf -o C:\Users\liu\Desktop\Project\squareline\chat_gpt_new_gui\assets\ui_font_PingFangEN20.c --format lvgl -r 0x20-0x7f --no-compress --no-prefilter
- ******************************************************************************/
-
-#include "../ui.h"
-
-#ifndef UI_FONT_PINGFANGEN20
-#define UI_FONT_PINGFANGEN20 1
-#endif
-
-#if UI_FONT_PINGFANGEN20
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x9f, 0x38, 0xf3, 0x8f, 0x37, 0xf2, 0x7f, 0x26,
-    0xf1, 0x6f, 0x16, 0xf0, 0x5f, 0x5, 0xf0, 0x3c,
-    0x0, 0x0, 0x15, 0xb, 0xf6, 0x7e, 0x30,
-
-    /* U+0022 "\"" */
-    0x6f, 0x40, 0xbe, 0x5f, 0x30, 0xad, 0x4f, 0x30,
-    0xad, 0x4f, 0x20, 0x9c, 0x3f, 0x10, 0x9c, 0x2,
-    0x0, 0x11,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0xc8, 0x0, 0x6e, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x8c, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0xaa, 0x0, 0x0, 0x2, 0xf2, 0x0, 0xd8, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2, 0x39,
-    0xd3, 0x35, 0xf5, 0x30, 0x0, 0xa, 0xa0, 0x4,
-    0xf0, 0x0, 0x0, 0xd, 0x80, 0x7, 0xd0, 0x0,
-    0x0, 0xf, 0x50, 0xa, 0xb0, 0x0, 0x0, 0x3f,
-    0x20, 0xd, 0x80, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x13, 0x9e, 0x33, 0x4f, 0x53, 0x10,
-    0x0, 0xab, 0x0, 0x4f, 0x10, 0x0, 0x0, 0xc9,
-    0x0, 0x6e, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x8c,
-    0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x8, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x70, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xfd,
-    0x70, 0x0, 0x0, 0xdf, 0x9c, 0xbc, 0xfa, 0x0,
-    0x7, 0xf4, 0x8, 0x70, 0x8f, 0x40, 0xb, 0xe0,
-    0x8, 0x70, 0xf, 0x90, 0xb, 0xf0, 0x8, 0x70,
-    0x2, 0x20, 0x6, 0xfb, 0x18, 0x70, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x3,
-    0xaf, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x8, 0xbc,
-    0xfe, 0x20, 0x0, 0x0, 0x8, 0x70, 0x5f, 0xb0,
-    0xc, 0x90, 0x8, 0x70, 0xb, 0xf0, 0xb, 0xe0,
-    0x8, 0x70, 0xb, 0xe0, 0x6, 0xf6, 0x8, 0x70,
-    0x2f, 0xb0, 0x0, 0xcf, 0xab, 0xa9, 0xff, 0x20,
-    0x0, 0x8, 0xdf, 0xfd, 0xa2, 0x0, 0x0, 0x0,
-    0x8, 0x70, 0x0, 0x0, 0x0, 0x0, 0x8, 0x70,
-    0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x2, 0xbf, 0xc4, 0x0, 0x0, 0x3, 0xf1, 0x0,
-    0x0, 0xeb, 0x28, 0xf3, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0x6f, 0x10, 0xe, 0x90, 0x0, 0x4f, 0x10,
-    0x0, 0x8, 0xf0, 0x0, 0xbc, 0x0, 0xc, 0x70,
-    0x0, 0x0, 0x8e, 0x0, 0xb, 0xc0, 0x5, 0xe0,
-    0x0, 0x0, 0x6, 0xf1, 0x0, 0xda, 0x0, 0xd6,
-    0x0, 0x0, 0x0, 0x1f, 0x90, 0x6f, 0x40, 0x6d,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0x70, 0xe,
-    0x50, 0x1a, 0xec, 0x60, 0x0, 0x1, 0x0, 0x7,
-    0xc0, 0xc, 0xd3, 0x6f, 0x50, 0x0, 0x0, 0x1,
-    0xf4, 0x3, 0xf4, 0x0, 0xbc, 0x0, 0x0, 0x0,
-    0x8b, 0x0, 0x6f, 0x10, 0x8, 0xe0, 0x0, 0x0,
-    0x1f, 0x30, 0x6, 0xf1, 0x0, 0x8f, 0x0, 0x0,
-    0x9, 0xa0, 0x0, 0x3f, 0x40, 0xb, 0xc0, 0x0,
-    0x2, 0xf2, 0x0, 0x0, 0xdc, 0x36, 0xf5, 0x0,
-    0x0, 0xa9, 0x0, 0x0, 0x1, 0xbe, 0xd6, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x2, 0xae, 0xfc, 0x30, 0x0, 0x0, 0x0,
-    0x1, 0xde, 0x86, 0xdf, 0x30, 0x0, 0x0, 0x0,
-    0x5f, 0x40, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x6,
-    0xf4, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x1f,
-    0xc0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x9c, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xe2, 0x0, 0x9, 0x70, 0x0, 0x5, 0xfe, 0xbf,
-    0x60, 0x0, 0xf9, 0x0, 0x5, 0xfb, 0x10, 0xaf,
-    0x50, 0x3f, 0x60, 0x0, 0xdd, 0x0, 0x0, 0xbf,
-    0x57, 0xf3, 0x0, 0x1f, 0x80, 0x0, 0x0, 0xcf,
-    0xed, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0xdf,
-    0x80, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x7f, 0xfe,
-    0x20, 0x0, 0x2e, 0xfb, 0x8a, 0xef, 0xc3, 0xed,
-    0x10, 0x0, 0x18, 0xdf, 0xfc, 0x60, 0x4, 0xfc,
-    0x0,
-
-    /* U+0027 "'" */
-    0x6f, 0x45, 0xf3, 0x4f, 0x34, 0xf2, 0x3f, 0x10,
-    0x20,
-
-    /* U+0028 "(" */
-    0x0, 0x7, 0x20, 0x7, 0xe0, 0x1, 0xf7, 0x0,
-    0x6f, 0x10, 0xd, 0xb0, 0x2, 0xf6, 0x0, 0x6f,
-    0x20, 0x9, 0xf0, 0x0, 0xbd, 0x0, 0xc, 0xc0,
-    0x0, 0xdb, 0x0, 0xb, 0xd0, 0x0, 0xae, 0x0,
-    0x8, 0xf1, 0x0, 0x4f, 0x40, 0x0, 0xf8, 0x0,
-    0xa, 0xe0, 0x0, 0x3f, 0x40, 0x0, 0xbb, 0x0,
-    0x3, 0xf3,
-
-    /* U+0029 ")" */
-    0x55, 0x0, 0x6, 0xf2, 0x0, 0xe, 0xa0, 0x0,
-    0x8f, 0x10, 0x1, 0xf7, 0x0, 0xc, 0xc0, 0x0,
-    0x8f, 0x0, 0x5, 0xf4, 0x0, 0x3f, 0x50, 0x2,
-    0xf6, 0x0, 0x1f, 0x70, 0x2, 0xf6, 0x0, 0x4f,
-    0x50, 0x6, 0xf2, 0x0, 0xae, 0x0, 0xe, 0xa0,
-    0x4, 0xf4, 0x0, 0xbd, 0x0, 0x2f, 0x60, 0x9,
-    0xd0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x0, 0x9b,
-    0x0, 0x0, 0x2, 0x0, 0x8a, 0x0, 0x11, 0x5f,
-    0xc5, 0x8a, 0x5b, 0xf7, 0x4, 0x9e, 0xff, 0xea,
-    0x50, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x1d,
-    0x97, 0xe2, 0x0, 0x0, 0xbd, 0x0, 0xbd, 0x0,
-    0x1, 0xc3, 0x0, 0x1c, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x11, 0x11,
-    0xac, 0x11, 0x11, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x44, 0x44, 0xbd, 0x44, 0x44, 0x0, 0x0,
-    0x9, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x9b, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x17, 0x30, 0x8f, 0xd0, 0x4e, 0xf1, 0x3, 0xf0,
-    0x1b, 0x80, 0xa9, 0x0, 0x0, 0x0,
-
-    /* U+002D "-" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x0,
-
-    /* U+002E "." */
-    0x6, 0x27, 0xfb, 0x3e, 0x70,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0,
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0x50, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0xd9,
-    0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0xe, 0x70, 0x0,
-    0x0, 0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0xbb,
-    0x0, 0x0, 0x0, 0x1, 0xf5, 0x0, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0,
-    0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x0,
-    0x5, 0xf1, 0x0, 0x0, 0x0, 0xb, 0xb0, 0x0,
-    0x0, 0x0, 0x1f, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x3b, 0xff, 0xb3, 0x0, 0x4, 0xfd, 0x88,
-    0xdf, 0x40, 0xe, 0xd0, 0x0, 0xd, 0xe0, 0x5f,
-    0x40, 0x0, 0x4, 0xf5, 0xaf, 0x0, 0x0, 0x0,
-    0xfa, 0xcc, 0x0, 0x0, 0x0, 0xcc, 0xeb, 0x0,
-    0x0, 0x0, 0xbe, 0xfa, 0x0, 0x0, 0x0, 0xaf,
-    0xeb, 0x0, 0x0, 0x0, 0xbe, 0xcc, 0x0, 0x0,
-    0x0, 0xcc, 0xaf, 0x0, 0x0, 0x0, 0xfa, 0x5f,
-    0x40, 0x0, 0x4, 0xf5, 0xe, 0xe1, 0x0, 0x1e,
-    0xe0, 0x4, 0xfe, 0x88, 0xef, 0x40, 0x0, 0x3b,
-    0xff, 0xb3, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x1, 0xdd, 0x0, 0x4e, 0xfd, 0x1d, 0xfb,
-    0xcd, 0x1d, 0x60, 0xcd, 0x0, 0x0, 0xcd, 0x0,
-    0x0, 0xcd, 0x0, 0x0, 0xcd, 0x0, 0x0, 0xcd,
-    0x0, 0x0, 0xcd, 0x0, 0x0, 0xcd, 0x0, 0x0,
-    0xcd, 0x0, 0x0, 0xcd, 0x0, 0x0, 0xcd, 0x0,
-    0x0, 0xcd, 0x0, 0x0, 0xcd,
-
-    /* U+0032 "2" */
-    0x0, 0x2a, 0xdf, 0xc6, 0x0, 0x4, 0xfe, 0x98,
-    0xbf, 0xa0, 0xd, 0xd1, 0x0, 0x8, 0xf5, 0x5f,
-    0x50, 0x0, 0x0, 0xf9, 0x8f, 0x10, 0x0, 0x0,
-    0xfa, 0x46, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x0, 0x2c, 0xf8, 0x0, 0x0, 0x4, 0xee,
-    0x40, 0x0, 0x0, 0x7f, 0xc1, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0xb8, 0x88, 0x88, 0x86, 0xaf, 0xff,
-    0xff, 0xff, 0xfc,
-
-    /* U+0033 "3" */
-    0x0, 0x4b, 0xef, 0xd8, 0x10, 0x7, 0xfd, 0x88,
-    0xbf, 0xd0, 0x3f, 0xa0, 0x0, 0x5, 0xf7, 0x8f,
-    0x10, 0x0, 0x0, 0xfa, 0x11, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x1, 0x4c, 0xe1, 0x0, 0x0,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x34, 0x7e, 0xc1,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0x11, 0x0, 0x0,
-    0x0, 0xce, 0xdc, 0x0, 0x0, 0x0, 0xbe, 0x9f,
-    0x10, 0x0, 0x0, 0xec, 0x3f, 0xa0, 0x0, 0x8,
-    0xf6, 0x8, 0xfd, 0x88, 0xcf, 0xa0, 0x0, 0x5c,
-    0xee, 0xc5, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0xf3, 0x0, 0x0, 0x0, 0xd, 0x95, 0xf3, 0x0,
-    0x0, 0x0, 0xad, 0x5, 0xf3, 0x0, 0x0, 0x6,
-    0xf2, 0x5, 0xf3, 0x0, 0x0, 0x2f, 0x60, 0x5,
-    0xf3, 0x0, 0x0, 0xda, 0x0, 0x5, 0xf3, 0x0,
-    0xa, 0xd0, 0x0, 0x5, 0xf3, 0x0, 0x5f, 0x41,
-    0x11, 0x16, 0xf4, 0x10, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x24, 0x44, 0x44, 0x48, 0xf7, 0x42,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x0,
-
-    /* U+0035 "5" */
-    0xf, 0xff, 0xff, 0xff, 0xf6, 0xf, 0xb8, 0x88,
-    0x88, 0x83, 0x2f, 0x50, 0x0, 0x0, 0x0, 0x3f,
-    0x30, 0x0, 0x0, 0x0, 0x5f, 0x20, 0x0, 0x0,
-    0x0, 0x6f, 0x1a, 0xef, 0xe9, 0x0, 0x8f, 0xea,
-    0x65, 0xaf, 0xd0, 0x9f, 0x70, 0x0, 0x7, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x42, 0x0, 0x0, 0x0, 0xbe, 0xcd,
-    0x0, 0x0, 0x0, 0xea, 0x7f, 0x60, 0x0, 0xa,
-    0xf4, 0xb, 0xfb, 0x88, 0xdf, 0x70, 0x0, 0x6c,
-    0xfe, 0xb3, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x1a, 0xef, 0xd8, 0x0, 0x1, 0xee, 0x97,
-    0xaf, 0xc0, 0xb, 0xe2, 0x0, 0x6, 0xf6, 0x2f,
-    0x50, 0x0, 0x0, 0x96, 0x8e, 0x0, 0x1, 0x0,
-    0x0, 0xbb, 0x9, 0xff, 0xe9, 0x0, 0xda, 0xbc,
-    0x65, 0xaf, 0xd0, 0xfe, 0xb0, 0x0, 0x6, 0xf7,
-    0xef, 0x20, 0x0, 0x0, 0xdc, 0xdf, 0x0, 0x0,
-    0x0, 0xaf, 0xbf, 0x0, 0x0, 0x0, 0xbe, 0x6f,
-    0x30, 0x0, 0x0, 0xeb, 0xe, 0xc1, 0x0, 0x9,
-    0xf4, 0x4, 0xfe, 0x88, 0xcf, 0x90, 0x0, 0x3a,
-    0xde, 0xb5, 0x0,
-
-    /* U+0037 "7" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0x2, 0x88, 0x88,
-    0x88, 0x8d, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x0,
-    0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0,
-    0x0, 0xf, 0xb0, 0x0, 0x0, 0x0, 0x5, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x7, 0xce, 0xec, 0x70, 0x0, 0x0, 0xcf,
-    0xa7, 0x7a, 0xfc, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0x5f, 0x60, 0x9, 0xe0, 0x0, 0x0, 0xe, 0x90,
-    0x7, 0xf1, 0x0, 0x0, 0x1f, 0x70, 0x1, 0xdd,
-    0x41, 0x15, 0xdb, 0x10, 0x0, 0x1d, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xdf, 0x85, 0x58, 0xfd, 0x10,
-    0xa, 0xf2, 0x0, 0x0, 0x2f, 0xa0, 0xf, 0xa0,
-    0x0, 0x0, 0xa, 0xf0, 0x1f, 0x70, 0x0, 0x0,
-    0x7, 0xf1, 0xf, 0xa0, 0x0, 0x0, 0xa, 0xf0,
-    0xa, 0xf4, 0x0, 0x0, 0x4f, 0xa0, 0x1, 0xdf,
-    0xa7, 0x7a, 0xfd, 0x10, 0x0, 0x7, 0xce, 0xec,
-    0x70, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x6c, 0xed, 0xa3, 0x0, 0xa, 0xfc, 0x88,
-    0xdf, 0x40, 0x6f, 0x70, 0x0, 0xb, 0xe0, 0xcd,
-    0x0, 0x0, 0x1, 0xf6, 0xeb, 0x0, 0x0, 0x0,
-    0xeb, 0xdc, 0x0, 0x0, 0x0, 0xfd, 0xaf, 0x30,
-    0x0, 0x7, 0xfe, 0x1f, 0xe6, 0x23, 0x9c, 0xaf,
-    0x2, 0xcf, 0xff, 0xc1, 0xad, 0x0, 0x1, 0x42,
-    0x0, 0xcb, 0x12, 0x0, 0x0, 0x1, 0xf8, 0x8f,
-    0x10, 0x0, 0x6, 0xf2, 0x4f, 0x90, 0x0, 0x2f,
-    0xb0, 0xa, 0xfb, 0x7a, 0xfe, 0x20, 0x0, 0x6c,
-    0xfe, 0xa1, 0x0,
-
-    /* U+003A ":" */
-    0x3e, 0x77, 0xfb, 0x6, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x62, 0x7f, 0xb3, 0xe7,
-
-    /* U+003B ";" */
-    0x3e, 0x70, 0x7f, 0xb0, 0x6, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0x30,
-    0x8f, 0xd0, 0x4e, 0xf1, 0x3, 0xf0, 0x1b, 0x80,
-    0xa9, 0x0, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0xf1, 0x0, 0x0, 0x18, 0xff, 0x92,
-    0x0, 0x2, 0x9f, 0xe8, 0x10, 0x0, 0x3b, 0xfe,
-    0x70, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xfc,
-    0x40, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0x10,
-
-    /* U+003D "=" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0,
-
-    /* U+003E ">" */
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe7, 0x10,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0x92, 0x0, 0x0,
-    0x0, 0x1, 0x7e, 0xfa, 0x30, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x0, 0x0, 0x1, 0x8f, 0xf9, 0x0, 0x0,
-    0x2a, 0xfe, 0x81, 0x0, 0x4, 0xbf, 0xe6, 0x0,
-    0x0, 0xc, 0xfd, 0x50, 0x0, 0x0, 0x0, 0xc4,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x8c, 0xfd, 0x90, 0x0, 0xcf, 0xa7, 0xaf,
-    0xd0, 0x7f, 0x40, 0x0, 0x6f, 0x7c, 0xc0, 0x0,
-    0x0, 0xfa, 0xc8, 0x0, 0x0, 0xf, 0xa0, 0x0,
-    0x0, 0x6, 0xf6, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0x3, 0xfc, 0x10, 0x0, 0x0, 0xed, 0x10,
-    0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x8, 0xf1,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2,
-    0x50, 0x0, 0x0, 0x0, 0xdf, 0x50, 0x0, 0x0,
-    0x8, 0xd2, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x5a, 0xef, 0xeb, 0x81, 0x0, 0x0,
-    0x0, 0x1c, 0xf9, 0x63, 0x47, 0xdf, 0x40, 0x0,
-    0x1, 0xec, 0x20, 0x0, 0x0, 0x7, 0xf2, 0x0,
-    0xc, 0xd0, 0x0, 0xae, 0xe4, 0x94, 0x9b, 0x0,
-    0x5f, 0x30, 0x1c, 0xe6, 0x5d, 0xf3, 0xf, 0x20,
-    0xac, 0x0, 0x8f, 0x20, 0x9, 0xf0, 0xd, 0x40,
-    0xd9, 0x1, 0xf8, 0x0, 0x9, 0xb0, 0xb, 0x60,
-    0xe7, 0x4, 0xf2, 0x0, 0xd, 0x70, 0xd, 0x40,
-    0xe9, 0x6, 0xf0, 0x0, 0x1f, 0x30, 0x1f, 0x10,
-    0xbb, 0x6, 0xf0, 0x0, 0x9f, 0x0, 0x99, 0x0,
-    0x7e, 0x12, 0xf7, 0x6, 0xfe, 0x18, 0xe1, 0x0,
-    0xe, 0xa0, 0x5f, 0xfd, 0x2d, 0xfc, 0x23, 0x60,
-    0x4, 0xf8, 0x0, 0x10, 0x0, 0x10, 0x5f, 0x50,
-    0x0, 0x4e, 0xe7, 0x42, 0x24, 0x7c, 0xd4, 0x0,
-    0x0, 0x0, 0x6b, 0xef, 0xed, 0xa5, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x8,
-    0xf3, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x7f, 0x50, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x2f, 0xb0, 0x0, 0x0,
-    0xef, 0x11, 0x11, 0x1d, 0xf1, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0xa, 0xf6, 0x44,
-    0x44, 0x45, 0xfd, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0xaf, 0x30, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0x4f, 0x90, 0xce, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0,
-
-    /* U+0042 "B" */
-    0x8f, 0xff, 0xff, 0xfe, 0xb3, 0x0, 0x8f, 0x76,
-    0x66, 0x79, 0xef, 0x40, 0x8f, 0x10, 0x0, 0x0,
-    0x1e, 0xd0, 0x8f, 0x10, 0x0, 0x0, 0x9, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x9, 0xf0, 0x8f, 0x10,
-    0x0, 0x0, 0xd, 0xc0, 0x8f, 0x21, 0x11, 0x24,
-    0xbf, 0x30, 0x8f, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x8f, 0x54, 0x44, 0x46, 0xaf, 0xa0, 0x8f, 0x10,
-    0x0, 0x0, 0x6, 0xf6, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0xfa, 0x8f, 0x10, 0x0, 0x0, 0x0, 0xf9,
-    0x8f, 0x10, 0x0, 0x0, 0x8, 0xf6, 0x8f, 0x76,
-    0x66, 0x68, 0xcf, 0xc0, 0x8f, 0xff, 0xff, 0xfe,
-    0xc7, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x5a, 0xef, 0xdb, 0x40, 0x0, 0x0,
-    0xa, 0xfe, 0xb8, 0xae, 0xfb, 0x0, 0x0, 0x9f,
-    0xa0, 0x0, 0x0, 0x7f, 0xa0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x9, 0xf1, 0xa, 0xf2, 0x0, 0x0,
-    0x0, 0x2, 0xb4, 0xe, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x32, 0xb, 0xf1,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0x3, 0xf9, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x8f, 0x70, 0x0, 0xc, 0xfe, 0xb8, 0xae,
-    0xf9, 0x0, 0x0, 0x0, 0x5b, 0xef, 0xda, 0x30,
-    0x0,
-
-    /* U+0044 "D" */
-    0x8f, 0xff, 0xff, 0xec, 0x70, 0x0, 0x8, 0xf8,
-    0x77, 0x8a, 0xdf, 0xe2, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x6f, 0xe0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x8f, 0x10, 0x0, 0x0, 0x0, 0xdd,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x7f, 0x28, 0xf1, 0x0,
-    0x0, 0x0, 0x6, 0xf3, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x7f, 0x28, 0xf1, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0xed, 0x8,
-    0xf1, 0x0, 0x0, 0x0, 0x7f, 0x50, 0x8f, 0x10,
-    0x0, 0x0, 0x7f, 0xc0, 0x8, 0xf8, 0x77, 0x8b,
-    0xef, 0xa1, 0x0, 0x8f, 0xff, 0xff, 0xeb, 0x50,
-    0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x88, 0xf8, 0x77,
-    0x77, 0x77, 0x74, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x32, 0x22, 0x22, 0x22, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x8f, 0x65, 0x55, 0x55,
-    0x55, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x77, 0x77, 0x77, 0x76, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xe0,
-
-    /* U+0046 "F" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x87, 0x77,
-    0x77, 0x77, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x8f, 0x32,
-    0x22, 0x22, 0x21, 0x8f, 0xff, 0xff, 0xff, 0xf9,
-    0x8f, 0x65, 0x55, 0x55, 0x53, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x4a, 0xef, 0xdb, 0x60, 0x0, 0x0,
-    0xa, 0xfe, 0xb8, 0xad, 0xfd, 0x10, 0x0, 0x8f,
-    0xa0, 0x0, 0x0, 0x5f, 0xc0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0xa, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xa6, 0xd, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x22, 0x22,
-    0x21, 0x1f, 0x80, 0x0, 0x6, 0xff, 0xff, 0xfa,
-    0xf, 0x90, 0x0, 0x2, 0x55, 0x55, 0xfa, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0xa, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x9f, 0xa1, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0xa, 0xff, 0xc9, 0x9b,
-    0xef, 0xc3, 0x0, 0x0, 0x4a, 0xef, 0xfd, 0xa4,
-    0x0,
-
-    /* U+0048 "H" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xaf, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0xaf, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0xaf, 0x8f, 0x10, 0x0, 0x0, 0x0, 0xaf,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xaf, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0xaf, 0x8f, 0x32, 0x22, 0x22,
-    0x22, 0xbf, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0x65, 0x55, 0x55, 0x55, 0xcf, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0xaf, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0xaf, 0x8f, 0x10, 0x0, 0x0, 0x0, 0xaf,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xaf, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0xaf, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0xaf,
-
-    /* U+0049 "I" */
-    0x6f, 0x26, 0xf2, 0x6f, 0x26, 0xf2, 0x6f, 0x26,
-    0xf2, 0x6f, 0x26, 0xf2, 0x6f, 0x26, 0xf2, 0x6f,
-    0x26, 0xf2, 0x6f, 0x26, 0xf2, 0x6f, 0x20,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0, 0x0,
-    0xbe, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0xb,
-    0xe0, 0x0, 0x0, 0x0, 0xbe, 0xaf, 0x0, 0x0,
-    0xc, 0xd9, 0xf1, 0x0, 0x0, 0xeb, 0x5f, 0x70,
-    0x0, 0x6f, 0x70, 0xcf, 0xb8, 0xbf, 0xe1, 0x0,
-    0x8d, 0xfd, 0x91, 0x0,
-
-    /* U+004B "K" */
-    0x8f, 0x10, 0x0, 0x0, 0xb, 0xf6, 0x8, 0xf1,
-    0x0, 0x0, 0xb, 0xf6, 0x0, 0x8f, 0x10, 0x0,
-    0xa, 0xf6, 0x0, 0x8, 0xf1, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x8f, 0x10, 0xa, 0xf6, 0x0, 0x0,
-    0x8, 0xf1, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x8f,
-    0x1a, 0xfa, 0x0, 0x0, 0x0, 0x8, 0xfa, 0xfd,
-    0xf5, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0xd, 0xf3,
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0x2e, 0xe2, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x3f, 0xd1, 0x0, 0x8,
-    0xf1, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x8f, 0xa0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0xaf, 0x80, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0x50,
-
-    /* U+004C "L" */
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x77, 0x77, 0x77, 0x72, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0x40,
-
-    /* U+004D "M" */
-    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3,
-    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf3,
-    0x8f, 0xce, 0x0, 0x0, 0x0, 0x4, 0xfc, 0xf3,
-    0x8f, 0x5f, 0x50, 0x0, 0x0, 0xb, 0xe7, 0xf3,
-    0x8f, 0x1d, 0xc0, 0x0, 0x0, 0x2f, 0x76, 0xf3,
-    0x8f, 0x17, 0xf2, 0x0, 0x0, 0x8f, 0x16, 0xf3,
-    0x8f, 0x11, 0xf9, 0x0, 0x0, 0xea, 0x6, 0xf3,
-    0x8f, 0x10, 0x9f, 0x0, 0x5, 0xf3, 0x6, 0xf3,
-    0x8f, 0x10, 0x3f, 0x60, 0xc, 0xd0, 0x6, 0xf3,
-    0x8f, 0x10, 0xc, 0xd0, 0x3f, 0x60, 0x6, 0xf3,
-    0x8f, 0x10, 0x5, 0xf4, 0x9f, 0x0, 0x6, 0xf3,
-    0x8f, 0x10, 0x0, 0xeb, 0xf9, 0x0, 0x6, 0xf3,
-    0x8f, 0x10, 0x0, 0x8f, 0xf2, 0x0, 0x6, 0xf3,
-    0x8f, 0x10, 0x0, 0x2f, 0xc0, 0x0, 0x6, 0xf3,
-
-    /* U+004E "N" */
-    0x8f, 0x70, 0x0, 0x0, 0x0, 0xbe, 0x8f, 0xf2,
-    0x0, 0x0, 0x0, 0xbe, 0x8f, 0xfc, 0x0, 0x0,
-    0x0, 0xbe, 0x8f, 0x6f, 0x70, 0x0, 0x0, 0xbe,
-    0x8f, 0x1a, 0xf2, 0x0, 0x0, 0xbe, 0x8f, 0x11,
-    0xec, 0x0, 0x0, 0xbe, 0x8f, 0x10, 0x5f, 0x70,
-    0x0, 0xbe, 0x8f, 0x10, 0xa, 0xf2, 0x0, 0xbe,
-    0x8f, 0x10, 0x1, 0xec, 0x0, 0xbe, 0x8f, 0x10,
-    0x0, 0x5f, 0x70, 0xbe, 0x8f, 0x10, 0x0, 0xb,
-    0xf2, 0xbe, 0x8f, 0x10, 0x0, 0x1, 0xfc, 0xbe,
-    0x8f, 0x10, 0x0, 0x0, 0x6f, 0xfe, 0x8f, 0x10,
-    0x0, 0x0, 0xb, 0xfe, 0x8f, 0x10, 0x0, 0x0,
-    0x1, 0xfe,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x4a, 0xef, 0xec, 0x70, 0x0, 0x0,
-    0x0, 0xaf, 0xfb, 0x9a, 0xdf, 0xd2, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0xa, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0xdc, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf3, 0xf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x51, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0xf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x50, 0xdc, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf3, 0xa, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0xaf, 0xeb, 0x9a, 0xdf, 0xd2,
-    0x0, 0x0, 0x0, 0x4a, 0xef, 0xec, 0x60, 0x0,
-    0x0,
-
-    /* U+0050 "P" */
-    0x8f, 0xff, 0xff, 0xfd, 0xa2, 0x0, 0x8f, 0x87,
-    0x77, 0x8a, 0xff, 0x30, 0x8f, 0x10, 0x0, 0x0,
-    0x3f, 0xc0, 0x8f, 0x10, 0x0, 0x0, 0x9, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x7, 0xf2, 0x8f, 0x10,
-    0x0, 0x0, 0x9, 0xf1, 0x8f, 0x10, 0x0, 0x0,
-    0xe, 0xe0, 0x8f, 0x32, 0x22, 0x25, 0xcf, 0x60,
-    0x8f, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x8f, 0x65,
-    0x55, 0x42, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x4a, 0xef, 0xec, 0x70, 0x0, 0x0,
-    0x0, 0xaf, 0xfb, 0x9a, 0xdf, 0xd2, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0xa, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0xdc, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf3, 0xf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x51, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0xf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x50, 0xdc, 0x0, 0x0, 0x6,
-    0xb0, 0x6, 0xf3, 0xa, 0xf2, 0x0, 0x0, 0x3f,
-    0x90, 0xcf, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x5f,
-    0xbf, 0x70, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0xaf,
-    0xd0, 0x0, 0x0, 0xaf, 0xeb, 0x99, 0xdf, 0xfe,
-    0x10, 0x0, 0x0, 0x4a, 0xef, 0xeb, 0x51, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x8f, 0xff, 0xff, 0xfe, 0xb3, 0x0, 0x8f, 0x87,
-    0x77, 0x79, 0xef, 0x50, 0x8f, 0x10, 0x0, 0x0,
-    0xd, 0xe0, 0x8f, 0x10, 0x0, 0x0, 0x8, 0xf2,
-    0x8f, 0x10, 0x0, 0x0, 0x7, 0xf2, 0x8f, 0x10,
-    0x0, 0x0, 0xc, 0xe0, 0x8f, 0x32, 0x22, 0x24,
-    0xbf, 0x40, 0x8f, 0xff, 0xff, 0xff, 0xe3, 0x0,
-    0x8f, 0x65, 0x55, 0x57, 0xee, 0x20, 0x8f, 0x10,
-    0x0, 0x0, 0x2f, 0x90, 0x8f, 0x10, 0x0, 0x0,
-    0xb, 0xe0, 0x8f, 0x10, 0x0, 0x0, 0x9, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x7, 0xf1, 0x8f, 0x10,
-    0x0, 0x0, 0x5, 0xf4, 0x8f, 0x10, 0x0, 0x0,
-    0x1, 0xfa,
-
-    /* U+0053 "S" */
-    0x0, 0x6, 0xce, 0xfd, 0xa2, 0x0, 0x1, 0xdf,
-    0xb8, 0x8a, 0xff, 0x50, 0xa, 0xf3, 0x0, 0x0,
-    0x1d, 0xf1, 0xe, 0xb0, 0x0, 0x0, 0x4, 0xf6,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x85, 0x7, 0xfb,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xbf, 0xc0, 0x1, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x3f, 0x60, 0x0, 0x0,
-    0x0, 0xce, 0xf, 0xb0, 0x0, 0x0, 0x0, 0xcd,
-    0x9, 0xf7, 0x0, 0x0, 0x6, 0xf9, 0x0, 0xcf,
-    0xda, 0x8a, 0xdf, 0xc0, 0x0, 0x6, 0xce, 0xfe,
-    0xb6, 0x0,
-
-    /* U+0054 "T" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4, 0x77,
-    0x77, 0xcf, 0x77, 0x77, 0x70, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0,
-    0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xcd, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0xcd, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0xcd, 0x8f, 0x10, 0x0, 0x0, 0x0, 0xcd,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xcd, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0xcd, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0xcd, 0x8f, 0x10, 0x0, 0x0, 0x0, 0xcd,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xcd, 0x8f, 0x20,
-    0x0, 0x0, 0x0, 0xdc, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0xfa, 0x2f, 0x90, 0x0, 0x0, 0x4, 0xf7,
-    0xa, 0xf5, 0x0, 0x0, 0x2d, 0xe0, 0x2, 0xdf,
-    0xc9, 0x8b, 0xff, 0x40, 0x0, 0x7, 0xbe, 0xfc,
-    0x91, 0x0,
-
-    /* U+0056 "V" */
-    0xbf, 0x10, 0x0, 0x0, 0x0, 0x4f, 0x86, 0xf6,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0xaf, 0x10, 0x0, 0x0,
-    0x5f, 0x70, 0x5, 0xf6, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0xfb, 0x0, 0x0,
-    0x9f, 0x10, 0x0, 0x5f, 0x60, 0x0, 0x4, 0xf7,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0xe, 0xc0, 0x0,
-    0xfb, 0x0, 0x0, 0x0, 0x8f, 0x20, 0x5f, 0x50,
-    0x0, 0x0, 0x3, 0xf7, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0xd, 0xc0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xcf, 0x10, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x7f, 0x57, 0xf4, 0x0, 0x0, 0xf, 0xf9, 0x0,
-    0x0, 0xb, 0xf1, 0x3f, 0x80, 0x0, 0x3, 0xfe,
-    0xd0, 0x0, 0x0, 0xfd, 0x0, 0xec, 0x0, 0x0,
-    0x7f, 0x7f, 0x10, 0x0, 0x3f, 0x80, 0xa, 0xf1,
-    0x0, 0xb, 0xc2, 0xf5, 0x0, 0x7, 0xf4, 0x0,
-    0x6f, 0x40, 0x0, 0xf7, 0xe, 0x90, 0x0, 0xbf,
-    0x0, 0x2, 0xf8, 0x0, 0x4f, 0x30, 0x9d, 0x0,
-    0xf, 0xb0, 0x0, 0xd, 0xc0, 0x8, 0xf0, 0x5,
-    0xf2, 0x3, 0xf7, 0x0, 0x0, 0x9f, 0x10, 0xcb,
-    0x0, 0x1f, 0x60, 0x7f, 0x20, 0x0, 0x4, 0xf4,
-    0xf, 0x70, 0x0, 0xda, 0xb, 0xe0, 0x0, 0x0,
-    0xf, 0x84, 0xf3, 0x0, 0x9, 0xe0, 0xfa, 0x0,
-    0x0, 0x0, 0xcc, 0x9e, 0x0, 0x0, 0x5f, 0x6f,
-    0x50, 0x0, 0x0, 0x7, 0xfe, 0xa0, 0x0, 0x1,
-    0xfd, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0,
-    0x0, 0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x20, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x3f, 0xc0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x8f,
-    0x70, 0x0, 0x0, 0xcf, 0x30, 0x0, 0xcf, 0x20,
-    0x0, 0x6f, 0x80, 0x0, 0x2, 0xfc, 0x0, 0x2f,
-    0xd0, 0x0, 0x0, 0x7, 0xf7, 0xb, 0xf3, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x3f, 0xb1, 0xed, 0x0,
-    0x0, 0x0, 0xd, 0xf2, 0x5, 0xf9, 0x0, 0x0,
-    0x8, 0xf6, 0x0, 0xb, 0xf4, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x1e, 0xe0, 0x0, 0xdf, 0x20, 0x0,
-    0x0, 0x5f, 0x90, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0xbf, 0x40,
-
-    /* U+0059 "Y" */
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0xe,
-    0xe1, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x4, 0xfa,
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x1e, 0xd0, 0x0, 0x0, 0x1e, 0xd0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x6, 0xf7, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x2d, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0,
-    0x0,
-
-    /* U+005A "Z" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x6, 0x77,
-    0x77, 0x77, 0x7e, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x20, 0x0, 0x0, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe7,
-    0x77, 0x77, 0x77, 0x77, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff,
-
-    /* U+005B "[" */
-    0x1, 0x11, 0x11, 0x1f, 0xff, 0xfc, 0x1f, 0x84,
-    0x43, 0x1f, 0x50, 0x0, 0x1f, 0x50, 0x0, 0x1f,
-    0x50, 0x0, 0x1f, 0x50, 0x0, 0x1f, 0x50, 0x0,
-    0x1f, 0x50, 0x0, 0x1f, 0x50, 0x0, 0x1f, 0x50,
-    0x0, 0x1f, 0x50, 0x0, 0x1f, 0x50, 0x0, 0x1f,
-    0x50, 0x0, 0x1f, 0x50, 0x0, 0x1f, 0x50, 0x0,
-    0x1f, 0x50, 0x0, 0x1f, 0x50, 0x0, 0x1f, 0x61,
-    0x11, 0x1f, 0xff, 0xfc, 0x4, 0x44, 0x43,
-
-    /* U+005C "\\" */
-    0x1f, 0x50, 0x0, 0x0, 0x0, 0xb, 0xb0, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0xd,
-    0x90, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0,
-    0x0, 0x1, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xbb,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x9, 0xd0,
-    0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xd9, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x0,
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x5, 0xf1,
-
-    /* U+005D "]" */
-    0x1, 0x11, 0x11, 0x1f, 0xff, 0xfc, 0x4, 0x44,
-    0xcc, 0x0, 0x0, 0xbc, 0x0, 0x0, 0xbc, 0x0,
-    0x0, 0xbc, 0x0, 0x0, 0xbc, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0xbc, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0xbc, 0x0, 0x0, 0xbc, 0x0,
-    0x0, 0xbc, 0x0, 0x0, 0xbc, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0xbc, 0x0, 0x0, 0xbc, 0x1, 0x11,
-    0xbc, 0x1f, 0xff, 0xfc, 0x4, 0x44, 0x43,
-
-    /* U+005E "^" */
-    0x0, 0xc, 0xf2, 0x0, 0x0, 0x4, 0xfd, 0x90,
-    0x0, 0x0, 0xba, 0x4f, 0x10, 0x0, 0x3f, 0x30,
-    0xd8, 0x0, 0xa, 0xb0, 0x5, 0xf0, 0x1, 0xf4,
-    0x0, 0xe, 0x70, 0x9c, 0x0, 0x0, 0x6e, 0x0,
-
-    /* U+005F "_" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x44, 0x44, 0x44, 0x44, 0x44,
-
-    /* U+0060 "`" */
-    0x2f, 0x90, 0x0, 0x3f, 0x40, 0x0, 0x5d, 0x0,
-
-    /* U+0061 "a" */
-    0x0, 0x29, 0xef, 0xeb, 0x20, 0x3, 0xfe, 0x96,
-    0x7d, 0xf2, 0x9, 0xe1, 0x0, 0x0, 0xea, 0x0,
-    0x0, 0x0, 0x0, 0xbd, 0x0, 0x2a, 0xdf, 0xff,
-    0xfe, 0x4, 0xfc, 0x64, 0x33, 0xbe, 0xd, 0xd0,
-    0x0, 0x0, 0xbe, 0x1f, 0x80, 0x0, 0x1, 0xfe,
-    0xf, 0xa0, 0x0, 0xb, 0xfe, 0xa, 0xf9, 0x57,
-    0xda, 0x9e, 0x0, 0x8e, 0xfd, 0x70, 0x8e,
-
-    /* U+0062 "b" */
-    0xcd, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0xcd,
-    0x0, 0x0, 0x0, 0x0, 0xcd, 0x8, 0xee, 0xb5,
-    0x0, 0xcd, 0xac, 0x77, 0xcf, 0x70, 0xcf, 0xb0,
-    0x0, 0xa, 0xf2, 0xcf, 0x20, 0x0, 0x1, 0xf9,
-    0xce, 0x0, 0x0, 0x0, 0xeb, 0xcc, 0x0, 0x0,
-    0x0, 0xcd, 0xce, 0x0, 0x0, 0x0, 0xeb, 0xcf,
-    0x20, 0x0, 0x1, 0xf9, 0xcf, 0xa0, 0x0, 0xa,
-    0xf2, 0xcc, 0xdc, 0x77, 0xcf, 0x70, 0xcb, 0x1a,
-    0xee, 0xb5, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x7, 0xcf, 0xeb, 0x30, 0x0, 0xa, 0xfa,
-    0x78, 0xdf, 0x40, 0x6, 0xf6, 0x0, 0x0, 0xdd,
-    0x0, 0xdd, 0x0, 0x0, 0x5, 0xc1, 0xf, 0x90,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x90, 0x0, 0x0, 0x1, 0x0, 0xdd,
-    0x0, 0x0, 0x7, 0xf1, 0x6, 0xf6, 0x0, 0x0,
-    0xdc, 0x0, 0xb, 0xfa, 0x78, 0xef, 0x20, 0x0,
-    0x7, 0xcf, 0xea, 0x20, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x70, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x70, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x8,
-    0xcf, 0xd5, 0x1f, 0x70, 0xb, 0xfa, 0x78, 0xe7,
-    0xf7, 0x6, 0xf6, 0x0, 0x1, 0xef, 0x70, 0xdc,
-    0x0, 0x0, 0x7, 0xf7, 0xf, 0x90, 0x0, 0x0,
-    0x3f, 0x71, 0xf8, 0x0, 0x0, 0x1, 0xf7, 0xf,
-    0x90, 0x0, 0x0, 0x3f, 0x70, 0xdd, 0x0, 0x0,
-    0x6, 0xf7, 0x6, 0xf6, 0x0, 0x1, 0xef, 0x70,
-    0xb, 0xfa, 0x78, 0xe9, 0xf7, 0x0, 0x7, 0xcf,
-    0xd7, 0xf, 0x70,
-
-    /* U+0065 "e" */
-    0x0, 0x8, 0xcf, 0xc8, 0x0, 0x0, 0xc, 0xf9,
-    0x78, 0xfd, 0x10, 0x8, 0xf4, 0x0, 0x2, 0xf9,
-    0x0, 0xfb, 0x0, 0x0, 0x8, 0xf0, 0x3f, 0x70,
-    0x0, 0x0, 0x5f, 0x35, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x3f, 0x83, 0x33, 0x33, 0x33, 0x11, 0xf9,
-    0x0, 0x0, 0x3, 0x71, 0x9, 0xf2, 0x0, 0x1,
-    0xdd, 0x0, 0x1d, 0xf9, 0x68, 0xef, 0x30, 0x0,
-    0x8, 0xcf, 0xd9, 0x10, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x5, 0xdf, 0xf5, 0x0, 0x1f, 0xd7, 0x62,
-    0x0, 0x4f, 0x60, 0x0, 0x0, 0x4f, 0x40, 0x0,
-    0xef, 0xff, 0xff, 0xf3, 0x56, 0x9f, 0x96, 0x61,
-    0x0, 0x4f, 0x40, 0x0, 0x0, 0x4f, 0x40, 0x0,
-    0x0, 0x4f, 0x40, 0x0, 0x0, 0x4f, 0x40, 0x0,
-    0x0, 0x4f, 0x40, 0x0, 0x0, 0x4f, 0x40, 0x0,
-    0x0, 0x4f, 0x40, 0x0, 0x0, 0x4f, 0x40, 0x0,
-    0x0, 0x4f, 0x40, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x7, 0xcf, 0xd6, 0xf, 0x90, 0xb, 0xfa,
-    0x78, 0xe8, 0xf9, 0x6, 0xf7, 0x0, 0x1, 0xdf,
-    0x90, 0xdd, 0x0, 0x0, 0x6, 0xf9, 0xf, 0x90,
-    0x0, 0x0, 0x2f, 0x91, 0xf8, 0x0, 0x0, 0x0,
-    0xf9, 0xf, 0x90, 0x0, 0x0, 0x2f, 0x90, 0xdd,
-    0x0, 0x0, 0x6, 0xf9, 0x6, 0xf6, 0x0, 0x1,
-    0xdf, 0x90, 0xb, 0xfa, 0x78, 0xe8, 0xf9, 0x0,
-    0x7, 0xcf, 0xd6, 0xf, 0x70, 0x0, 0x0, 0x0,
-    0x2, 0xf5, 0x8, 0xf2, 0x0, 0x0, 0x9f, 0x10,
-    0x1e, 0xe8, 0x66, 0xbf, 0x70, 0x0, 0x29, 0xdf,
-    0xeb, 0x40, 0x0,
-
-    /* U+0068 "h" */
-    0xcd, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x0, 0x0,
-    0x0, 0xcd, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x0,
-    0x0, 0x0, 0xcd, 0x8, 0xde, 0xc3, 0xc, 0xdc,
-    0xb7, 0x9f, 0xf2, 0xcf, 0xa0, 0x0, 0x3f, 0xac,
-    0xf1, 0x0, 0x0, 0xdc, 0xce, 0x0, 0x0, 0xb,
-    0xec, 0xd0, 0x0, 0x0, 0xbe, 0xcd, 0x0, 0x0,
-    0xb, 0xec, 0xd0, 0x0, 0x0, 0xbe, 0xcd, 0x0,
-    0x0, 0xb, 0xec, 0xd0, 0x0, 0x0, 0xbe, 0xcd,
-    0x0, 0x0, 0xb, 0xe0,
-
-    /* U+0069 "i" */
-    0x4e, 0x68, 0xfa, 0x5, 0x10, 0x0, 0x3f, 0x53,
-    0xf5, 0x3f, 0x53, 0xf5, 0x3f, 0x53, 0xf5, 0x3f,
-    0x53, 0xf5, 0x3f, 0x53, 0xf5, 0x3f, 0x50,
-
-    /* U+006A "j" */
-    0x0, 0x2d, 0x90, 0x5, 0xfd, 0x0, 0x5, 0x20,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0xf8, 0x0,
-    0xf, 0x80, 0x0, 0xf8, 0x0, 0xf, 0x80, 0x0,
-    0xf8, 0x0, 0xf, 0x80, 0x0, 0xf8, 0x0, 0xf,
-    0x80, 0x0, 0xf8, 0x0, 0xf, 0x80, 0x0, 0xf8,
-    0x0, 0x2f, 0x81, 0x6c, 0xf4, 0x4f, 0xe7, 0x0,
-
-    /* U+006B "k" */
-    0xcd, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0xcd,
-    0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0, 0x7f,
-    0x90, 0xcd, 0x0, 0x8, 0xf9, 0x0, 0xcd, 0x0,
-    0x8f, 0x80, 0x0, 0xcd, 0x8, 0xf8, 0x0, 0x0,
-    0xcd, 0x8f, 0xc0, 0x0, 0x0, 0xcf, 0xfc, 0xf6,
-    0x0, 0x0, 0xcf, 0x70, 0xcf, 0x30, 0x0, 0xcd,
-    0x0, 0x2f, 0xd0, 0x0, 0xcd, 0x0, 0x5, 0xfa,
-    0x0, 0xcd, 0x0, 0x0, 0x9f, 0x60, 0xcd, 0x0,
-    0x0, 0xd, 0xf3,
-
-    /* U+006C "l" */
-    0x6f, 0x26, 0xf2, 0x6f, 0x26, 0xf2, 0x6f, 0x26,
-    0xf2, 0x6f, 0x26, 0xf2, 0x6f, 0x26, 0xf2, 0x6f,
-    0x26, 0xf2, 0x6f, 0x26, 0xf2, 0x6f, 0x20,
-
-    /* U+006D "m" */
-    0xcd, 0x1a, 0xee, 0x90, 0x7, 0xcf, 0xc3, 0xc,
-    0xed, 0xa7, 0xbf, 0xa9, 0xd7, 0x8e, 0xf2, 0xcf,
-    0x70, 0x0, 0xaf, 0xd0, 0x0, 0x2f, 0x9c, 0xf0,
-    0x0, 0x5, 0xf7, 0x0, 0x0, 0xdc, 0xcd, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0xb, 0xdc, 0xd0, 0x0,
-    0x3, 0xf5, 0x0, 0x0, 0xbd, 0xcd, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0xb, 0xdc, 0xd0, 0x0, 0x3,
-    0xf5, 0x0, 0x0, 0xbd, 0xcd, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0xb, 0xdc, 0xd0, 0x0, 0x3, 0xf5,
-    0x0, 0x0, 0xbd, 0xcd, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0xb, 0xd0,
-
-    /* U+006E "n" */
-    0xcd, 0x8, 0xde, 0xc3, 0xc, 0xeb, 0xb7, 0x9f,
-    0xf2, 0xcf, 0x90, 0x0, 0x3f, 0xac, 0xf1, 0x0,
-    0x0, 0xcd, 0xcd, 0x0, 0x0, 0xa, 0xec, 0xd0,
-    0x0, 0x0, 0xae, 0xcd, 0x0, 0x0, 0xa, 0xec,
-    0xd0, 0x0, 0x0, 0xae, 0xcd, 0x0, 0x0, 0xa,
-    0xec, 0xd0, 0x0, 0x0, 0xae, 0xcd, 0x0, 0x0,
-    0xa, 0xe0,
-
-    /* U+006F "o" */
-    0x0, 0x6, 0xbe, 0xda, 0x30, 0x0, 0xa, 0xfb,
-    0x78, 0xdf, 0x60, 0x5, 0xf8, 0x0, 0x0, 0xbf,
-    0x10, 0xdd, 0x0, 0x0, 0x2, 0xf8, 0xf, 0x90,
-    0x0, 0x0, 0xd, 0xb1, 0xf8, 0x0, 0x0, 0x0,
-    0xcd, 0xf, 0x90, 0x0, 0x0, 0xd, 0xb0, 0xdd,
-    0x0, 0x0, 0x2, 0xf8, 0x5, 0xf8, 0x0, 0x0,
-    0xbf, 0x10, 0x9, 0xfb, 0x78, 0xdf, 0x50, 0x0,
-    0x5, 0xbe, 0xda, 0x30, 0x0,
-
-    /* U+0070 "p" */
-    0xcb, 0x1a, 0xee, 0xb4, 0x0, 0xcc, 0xdc, 0x77,
-    0xcf, 0x70, 0xcf, 0xb0, 0x0, 0xa, 0xf2, 0xcf,
-    0x20, 0x0, 0x2, 0xf9, 0xce, 0x0, 0x0, 0x0,
-    0xeb, 0xcc, 0x0, 0x0, 0x0, 0xcd, 0xce, 0x0,
-    0x0, 0x0, 0xeb, 0xcf, 0x20, 0x0, 0x1, 0xf9,
-    0xcf, 0xb0, 0x0, 0xa, 0xf2, 0xcd, 0xac, 0x77,
-    0xcf, 0x70, 0xcd, 0x8, 0xef, 0xb5, 0x0, 0xcd,
-    0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x7, 0xcf, 0xd7, 0xf, 0x70, 0xb, 0xfa,
-    0x78, 0xe9, 0xf7, 0x6, 0xf6, 0x0, 0x1, 0xef,
-    0x70, 0xdd, 0x0, 0x0, 0x6, 0xf7, 0xf, 0x90,
-    0x0, 0x0, 0x3f, 0x71, 0xf8, 0x0, 0x0, 0x1,
-    0xf7, 0xf, 0x90, 0x0, 0x0, 0x3f, 0x70, 0xdd,
-    0x0, 0x0, 0x6, 0xf7, 0x7, 0xf6, 0x0, 0x1,
-    0xef, 0x70, 0xc, 0xfa, 0x78, 0xe7, 0xf7, 0x0,
-    0x8, 0xcf, 0xd5, 0x1f, 0x70, 0x0, 0x0, 0x0,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x70,
-    0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x70,
-
-    /* U+0072 "r" */
-    0xcc, 0x1a, 0xff, 0x3c, 0xdb, 0xfb, 0xd2, 0xcf,
-    0xd1, 0x0, 0xc, 0xf4, 0x0, 0x0, 0xce, 0x0,
-    0x0, 0xc, 0xd0, 0x0, 0x0, 0xcc, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0xc,
-    0xc0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x6c, 0xfe, 0xc5, 0x0, 0x9, 0xfb, 0x77,
-    0xcf, 0x60, 0xf, 0xa0, 0x0, 0xb, 0xe0, 0xe,
-    0xd1, 0x0, 0x2, 0x40, 0x5, 0xff, 0xa5, 0x10,
-    0x0, 0x0, 0x17, 0xcf, 0xfa, 0x20, 0x0, 0x0,
-    0x1, 0x5e, 0xe1, 0x2a, 0x30, 0x0, 0x4, 0xf5,
-    0x1f, 0x90, 0x0, 0x6, 0xf4, 0x8, 0xfa, 0x76,
-    0x9f, 0xd0, 0x0, 0x6c, 0xef, 0xd9, 0x10,
-
-    /* U+0074 "t" */
-    0x0, 0x3, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x9, 0xf0, 0x0, 0xaf, 0xff,
-    0xff, 0x84, 0x6b, 0xf6, 0x63, 0x0, 0x9f, 0x0,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x6, 0xf9,
-    0x61, 0x0, 0xa, 0xff, 0x40,
-
-    /* U+0075 "u" */
-    0xcd, 0x0, 0x0, 0xa, 0xfc, 0xd0, 0x0, 0x0,
-    0xaf, 0xcd, 0x0, 0x0, 0xa, 0xfc, 0xd0, 0x0,
-    0x0, 0xaf, 0xcd, 0x0, 0x0, 0xa, 0xfc, 0xd0,
-    0x0, 0x0, 0xaf, 0xcd, 0x0, 0x0, 0xa, 0xfa,
-    0xf0, 0x0, 0x0, 0xef, 0x7f, 0x50, 0x0, 0x8f,
-    0xf1, 0xff, 0x97, 0xbd, 0xbf, 0x2, 0xbe, 0xd9,
-    0x1a, 0xf0,
-
-    /* U+0076 "v" */
-    0xbf, 0x0, 0x0, 0x6, 0xf5, 0x6f, 0x50, 0x0,
-    0xb, 0xf0, 0xf, 0xb0, 0x0, 0x1f, 0xa0, 0xa,
-    0xf0, 0x0, 0x6f, 0x40, 0x4, 0xf5, 0x0, 0xbe,
-    0x0, 0x0, 0xea, 0x1, 0xf9, 0x0, 0x0, 0x9f,
-    0x6, 0xf3, 0x0, 0x0, 0x3f, 0x5b, 0xd0, 0x0,
-    0x0, 0xe, 0xcf, 0x80, 0x0, 0x0, 0x8, 0xff,
-    0x20, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0xbf, 0x0, 0x0, 0x5f, 0x60, 0x0, 0xe, 0xd6,
-    0xf4, 0x0, 0x9, 0xfb, 0x0, 0x3, 0xf8, 0x1f,
-    0x90, 0x0, 0xdc, 0xf0, 0x0, 0x7f, 0x30, 0xcd,
-    0x0, 0x2f, 0x4f, 0x30, 0xc, 0xe0, 0x7, 0xf2,
-    0x6, 0xe0, 0xc8, 0x0, 0xf8, 0x0, 0x2f, 0x60,
-    0xaa, 0x8, 0xc0, 0x5f, 0x30, 0x0, 0xdb, 0xe,
-    0x50, 0x4f, 0x9, 0xe0, 0x0, 0x7, 0xf3, 0xf1,
-    0x0, 0xf5, 0xe9, 0x0, 0x0, 0x2f, 0xcc, 0x0,
-    0xb, 0xcf, 0x40, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x7f, 0xf0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x2,
-    0xfa, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x2f, 0xc0, 0x0, 0x9, 0xf4, 0x0, 0x6f, 0x70,
-    0x4, 0xf9, 0x0, 0x0, 0xbf, 0x20, 0xed, 0x0,
-    0x0, 0x1, 0xec, 0xaf, 0x30, 0x0, 0x0, 0x4,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x0, 0x0, 0xb, 0xed, 0xd0, 0x0, 0x0, 0x7,
-    0xf5, 0x3f, 0x90, 0x0, 0x2, 0xfa, 0x0, 0x8f,
-    0x50, 0x0, 0xde, 0x10, 0x0, 0xce, 0x10, 0x8f,
-    0x50, 0x0, 0x2, 0xfb, 0x0,
-
-    /* U+0079 "y" */
-    0xbf, 0x0, 0x0, 0x1, 0xf9, 0x5f, 0x60, 0x0,
-    0x7, 0xf3, 0xe, 0xc0, 0x0, 0xd, 0xd0, 0x8,
-    0xf2, 0x0, 0x3f, 0x70, 0x2, 0xf7, 0x0, 0x8f,
-    0x10, 0x0, 0xcd, 0x0, 0xeb, 0x0, 0x0, 0x6f,
-    0x34, 0xf5, 0x0, 0x0, 0xf, 0x99, 0xf0, 0x0,
-    0x0, 0x9, 0xff, 0x90, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x4f, 0xff, 0xff, 0xff, 0xe0, 0x16, 0x66, 0x66,
-    0xaf, 0xa0, 0x0, 0x0, 0x1, 0xed, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x1e,
-    0xd0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x8, 0xf6, 0x0, 0x0, 0x0, 0x4f, 0xe6, 0x66,
-    0x66, 0x61, 0x7f, 0xff, 0xff, 0xff, 0xf3,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0,
-    0x6f, 0x84, 0x0, 0xa, 0xe0, 0x0, 0x0, 0xac,
-    0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0xac, 0x0,
-    0x0, 0xa, 0xc0, 0x0, 0x0, 0xda, 0x0, 0x1,
-    0x5f, 0x50, 0x0, 0x9f, 0x70, 0x0, 0x3, 0x9f,
-    0x30, 0x0, 0x0, 0xea, 0x0, 0x0, 0xb, 0xc0,
-    0x0, 0x0, 0xac, 0x0, 0x0, 0xa, 0xc0, 0x0,
-    0x0, 0xac, 0x0, 0x0, 0xa, 0xd0, 0x0, 0x0,
-    0x7f, 0x51, 0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0,
-    0x23, 0x0,
-
-    /* U+007C "|" */
-    0x54, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
-
-    /* U+007D "}" */
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x50, 0x0, 0x24,
-    0xbf, 0x10, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x2f,
-    0x50, 0x0, 0x2, 0xf5, 0x0, 0x0, 0x2f, 0x50,
-    0x0, 0x2, 0xf5, 0x0, 0x0, 0xf, 0x70, 0x0,
-    0x0, 0xbd, 0x30, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0x8e, 0x61, 0x0, 0xf, 0x80, 0x0, 0x2, 0xf5,
-    0x0, 0x0, 0x2f, 0x50, 0x0, 0x2, 0xf5, 0x0,
-    0x0, 0x2f, 0x50, 0x0, 0x3, 0xf5, 0x0, 0x1,
-    0x9f, 0x20, 0x9, 0xff, 0x80, 0x0, 0x23, 0x10,
-    0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x70,
-    0x0, 0x62, 0x3f, 0x87, 0xed, 0x45, 0xf5, 0x38,
-    0x0, 0x1a, 0xff, 0x80, 0x0, 0x0, 0x0, 0x12,
-    0x0,
-
-    /* U+007F "" */
-
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 107, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 107, .box_w = 3, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23, .adv_w = 137, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 41, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 131, .adv_w = 192, .box_w = 12, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 245, .adv_w = 310, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 373, .adv_w = 232, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 486, .adv_w = 78, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 495, .adv_w = 107, .box_w = 5, .box_h = 20, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 545, .adv_w = 107, .box_w = 5, .box_h = 20, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 595, .adv_w = 162, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 645, .adv_w = 194, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 706, .adv_w = 84, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 720, .adv_w = 194, .box_w = 11, .box_h = 3, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 737, .adv_w = 84, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 742, .adv_w = 160, .box_w = 10, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 837, .adv_w = 192, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 912, .adv_w = 128, .box_w = 6, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 957, .adv_w = 192, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1032, .adv_w = 192, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1107, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1197, .adv_w = 192, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1272, .adv_w = 192, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1347, .adv_w = 175, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1430, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1520, .adv_w = 192, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1595, .adv_w = 84, .box_w = 3, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1610, .adv_w = 84, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1638, .adv_w = 194, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1699, .adv_w = 194, .box_w = 11, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1738, .adv_w = 194, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1799, .adv_w = 172, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1867, .adv_w = 275, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1987, .adv_w = 210, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2092, .adv_w = 217, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2182, .adv_w = 233, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2287, .adv_w = 226, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2385, .adv_w = 204, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2468, .adv_w = 185, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2543, .adv_w = 239, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2648, .adv_w = 230, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2738, .adv_w = 76, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2761, .adv_w = 165, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2829, .adv_w = 221, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2927, .adv_w = 188, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3010, .adv_w = 282, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3130, .adv_w = 230, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3220, .adv_w = 245, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3333, .adv_w = 205, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3423, .adv_w = 245, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3551, .adv_w = 216, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3641, .adv_w = 202, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3731, .adv_w = 198, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3829, .adv_w = 228, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3919, .adv_w = 204, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4017, .adv_w = 298, .box_w = 19, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4160, .adv_w = 204, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4258, .adv_w = 212, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4363, .adv_w = 200, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4453, .adv_w = 107, .box_w = 6, .box_h = 21, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4516, .adv_w = 160, .box_w = 10, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4611, .adv_w = 107, .box_w = 6, .box_h = 21, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4674, .adv_w = 166, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 4706, .adv_w = 160, .box_w = 10, .box_h = 3, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 4721, .adv_w = 107, .box_w = 5, .box_h = 3, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 4729, .adv_w = 179, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4784, .adv_w = 188, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4859, .adv_w = 175, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4920, .adv_w = 188, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5003, .adv_w = 178, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5064, .adv_w = 119, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5124, .adv_w = 189, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5207, .adv_w = 178, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5275, .adv_w = 82, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5298, .adv_w = 85, .box_w = 5, .box_h = 19, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 5346, .adv_w = 169, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5421, .adv_w = 75, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5444, .adv_w = 274, .box_w = 15, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5527, .adv_w = 179, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5577, .adv_w = 188, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5638, .adv_w = 188, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5713, .adv_w = 188, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5796, .adv_w = 117, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5835, .adv_w = 162, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5890, .adv_w = 114, .box_w = 7, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5943, .adv_w = 179, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5993, .adv_w = 154, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6048, .adv_w = 242, .box_w = 15, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6131, .adv_w = 163, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6192, .adv_w = 159, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 6267, .adv_w = 156, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6322, .adv_w = 107, .box_w = 7, .box_h = 21, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 6396, .adv_w = 62, .box_w = 2, .box_h = 21, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 6417, .adv_w = 107, .box_w = 7, .box_h = 21, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 6491, .adv_w = 160, .box_w = 10, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 6516, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 96, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 1,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t ui_font_PingFangEN20 = {
-#else
-lv_font_t ui_font_PingFangEN20 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 22,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -3,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if UI_FONT_PINGFANGEN20*/
-
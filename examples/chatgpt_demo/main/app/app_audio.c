@@ -25,6 +25,7 @@
 #include "file_iterator.h"
 #include "app_ui_ctrl.h"
 #include "app_wifi.h"
+#include "asset_pack.h"
 
 static const char *TAG = "app_audio";
 
@@ -191,48 +192,65 @@ static esp_err_t audio_record_stop()
              record_total_len, \
              record_total_len / 1024);
 
-    FILE *fp = fopen("/spiffs/echo_en_wake.wav", "r");
-    ESP_GOTO_ON_FALSE(NULL != fp, ESP_FAIL, err, TAG, "Failed create record file");
-
-    wav_header_t wav_head;
-    int len = fread(&wav_head, 1, sizeof(wav_header_t), fp);
-    ESP_GOTO_ON_FALSE(len > 0, ESP_FAIL, err, TAG, "Failed create record file");
-
-    wav_head.SampleRate = 16000;
+    wav_header_t wav_head = {
+        .ChunkID = "RIFF",
+        .Format = "WAVE",
+        .Subchunk1ID = "fmt ",
+        .Subchunk1Size = 16,
+        .AudioFormat = 1,
+        .SampleRate = 16000,
 #if PCM_ONE_CHANNEL
-    wav_head.NumChannels = 1;
+        .NumChannels = 1,
 #else
-    wav_head.NumChannels = 2;
+        .NumChannels = 2,
 #endif
-    wav_head.BitsPerSample = 16;
+        .BitsPerSample = 16,
+        .Subchunk2ID = "data",
+    };
     wav_head.ChunkSize = file_total_len - 8;
     wav_head.ByteRate = wav_head.SampleRate * wav_head.BitsPerSample * wav_head.NumChannels / 8;
-    wav_head.Subchunk2ID[0] = 'd';
-    wav_head.Subchunk2ID[1] = 'a';
-    wav_head.Subchunk2ID[2] = 't';
-    wav_head.Subchunk2ID[3] = 'a';
+    wav_head.BlockAlign = wav_head.BitsPerSample * wav_head.NumChannels / 8;
     wav_head.Subchunk2Size = record_total_len;
     memcpy((void *)record_audio_buffer, &wav_head, sizeof(wav_header_t));
     Cache_WriteBack_Addr((uint32_t)record_audio_buffer, record_total_len);
 
 #endif
-err:
-    if (fp) {
-        fclose(fp);
-    }
     return ret;
 }
 
+/* Write the samples of fp to the codec, already set to their format */
+static esp_err_t audio_play_stream(FILE *fp)
+{
+    const size_t chunk_size = 4096;
+    uint8_t *buffer = malloc(chunk_size);
+    ESP_RETURN_ON_FALSE(NULL != buffer, ESP_FAIL, TAG, "buffer malloc failed");
+
+    bsp_codec_mute_set(true);
+    bsp_codec_mute_set(false);
+    bsp_codec_volume_set(CONFIG_VOLUME_LEVEL, NULL);
+
+    size_t cnt, total_cnt = 0;
+    do {
+        /* Read file in chunks into the scratch buffer */
+        int len = fread(buffer, 1, chunk_size, fp);
+        if (len <= 0) {
+            break;
+        } else if (len > 0) {
+            bsp_i2s_write(buffer, len, &cnt, portMAX_DELAY);
+            total_cnt += cnt;
+        }
+    } while (1);
+
+    free(buffer);
+    return ESP_OK;
+}
+
 esp_err_t audio_play_task(void *filepath)
 {
     FILE *fp = NULL;
     struct stat file_stat;
     esp_err_t ret = ESP_OK;
 
-    const size_t chunk_size = 4096;
-    uint8_t *buffer = malloc(chunk_size);
-    ESP_GOTO_ON_FALSE(NULL != buffer, ESP_FAIL, EXIT, TAG, "buffer malloc failed");
-
     ESP_GOTO_ON_FALSE(-1 != stat(filepath, &file_stat), ESP_FAIL, EXIT, TAG, "Failed to stat file");
 
     fp = fopen(filepath, "r");
@@ -254,29 +272,31 @@ esp_err_t audio_play_task(void *filepath)
     ESP_LOGI(TAG, "frame_rate= %" PRIi32 ", ch=%d, width=%d", wav_head.SampleRate, wav_head.NumChannels, wav_head.BitsPerSample);
     bsp_codec_set_fs(wav_head.SampleRate, wav_head.BitsPerSample, I2S_SLOT_MODE_STEREO);
 
-    bsp_codec_mute_set(true);
-    bsp_codec_mute_set(false);
-    bsp_codec_volume_set(CONFIG_VOLUME_LEVEL, NULL);
-
-    size_t cnt, total_cnt = 0;
-    do {
-        /* Read file in chunks into the scratch buffer */
-        len = fread(buffer, 1, chunk_size, fp);
-        if (len <= 0) {
-            break;
-        } else if (len > 0) {
-            bsp_i2s_write(buffer, len, &cnt, portMAX_DELAY);
-            total_cnt += cnt;
-        }
-    } while (1);
+    ret = audio_play_stream(fp);
 
 EXIT:
     if (fp) {
         fclose(fp);
     }
-    if (buffer) {
-        free(buffer);
-    }
+    return ret;
+}
+
+esp_err_t audio_play_prompt(const char *name)
+{
+    const uint8_t *samples = NULL;
+    const asset_pack_entry_t *pcm = NULL;
+    size_t cnt;
+
+    /* Converted to raw PCM in the codec format at build time, no header to parse, and mapped from flash */
+    ESP_RETURN_ON_ERROR(asset_pack_pcm_load(name, &samples, &pcm), TAG, "No prompt %s", name);
+
+    bsp_codec_set_fs(pcm->sample_rate, pcm->format, (2 == pcm->channels) ? I2S_SLOT_MODE_STEREO : I2S_SLOT_MODE_MONO);
+    bsp_codec_mute_set(true);
+    bsp_codec_mute_set(false);
+    bsp_codec_volume_set(CONFIG_VOLUME_LEVEL, NULL);
+
+    esp_err_t ret = bsp_i2s_write((void *)samples, pcm->size, &cnt, portMAX_DELAY);
+    asset_pack_free(samples);
     return ret;
 }
 
@@ -312,7 +332,7 @@ void sr_handler_task(void *pvParam)
         if (ESP_MN_STATE_TIMEOUT == result.state) {
             ESP_LOGI(TAG, "ESP_MN_STATE_TIMEOUT");
             audio_record_stop();
-            FILE *fp = fopen("/spiffs/ok.mp3", "r");
+            FILE *fp = asset_pack_open("ok.mp3", NULL);
             if (fp) {
                 audio_player_play(fp);
             }
@@ -329,14 +349,14 @@ void sr_handler_task(void *pvParam)
             ui_ctrl_guide_jump();
             ui_ctrl_show_panel(UI_CTRL_PANEL_LISTEN, 0);
 
-            audio_play_task("/spiffs/echo_en_wake.wav");
+            audio_play_prompt("echo_en_wake.wav");
             continue;
         }
 
         if (ESP_MN_STATE_DETECTED & result.state) {
             ESP_LOGI(TAG, "STOP:%d", result.command_id);
             audio_record_stop();
-            audio_play_task("/spiffs/echo_cn_ok.wav");
+            audio_play_prompt("echo_cn_ok.wav");
             //How to stop the transmission, when start_answer begins.
             continue;
         }
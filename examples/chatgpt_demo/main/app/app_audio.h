@@ -42,6 +42,11 @@ extern uint8_t *audio_rx_buffer;
 
 esp_err_t audio_play_task(void *filepath);
 
+/**
+ * @brief Play a prompt converted by asset_pack, e.g. "echo_en_wake.wav"
+ */
+esp_err_t audio_play_prompt(const char *name);
+
 void audio_record_init();
 
 void audio_record_save(int16_t *audio_buffer, int audio_chunksize);
@@ -17,9 +17,12 @@
 #include "app_sr.h"
 #include "bsp/esp-bsp.h"
 #include "bsp_board.h"
+#include "bsp_display_profile.h"
 #include "app_audio.h"
 #include "app_wifi.h"
 #include "settings.h"
+#include "asset_pack.h"
+#include "telemetry.h"
 
 #include "esp_event.h"
 #include "esp_http_client.h"
@@ -33,6 +36,8 @@
 
 static char *TAG = "app_main";
 static sys_param_t *sys_param = NULL;
+static int s_answer_counter = -1;
+static int s_http_error_counter = -1;
 
 #define CHUNK_SIZE 10240 // 每次上传的音频块大小
 #define MAX_HTTP_OUTPUT_BUFFER (1024 * 20)
@@ -177,6 +182,7 @@ void send_audio_data(uint8_t *audio, int audio_len) {
             sent_len += chunk_len;
         } else {
             ESP_LOGE(TAG, "Error in uploading chunk: %s", esp_err_to_name(err));
+            telemetry_counter_add(s_http_error_counter, 1);
             break;
         }
     }
@@ -193,6 +199,7 @@ void wait_for_response(const char *url, int timeout_ms) {
     esp_err_t err = esp_http_client_perform(client);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "HTTP GET request failed: %s", esp_err_to_name(err));
+        telemetry_counter_add(s_http_error_counter, 1);
     }
 
     esp_http_client_cleanup(client);
@@ -202,6 +209,7 @@ void wait_for_response(const char *url, int timeout_ms) {
 esp_err_t start_answer(uint8_t *audio, int audio_len) {
     esp_err_t ret = ESP_OK;
 
+    telemetry_counter_add(s_answer_counter, 1);
     send_audio_data(audio, audio_len);
 
     wait_for_response("http://192.168.71.83:5000/get_response", 10000);
@@ -230,6 +238,13 @@ static void audio_play_finish_cb(void) {
     }
 }
 
+static void telemetry_log(const telemetry_sample_t *sample, void *user_ctx) {
+    ESP_LOGD(TAG, "Free internal %u (min %u), PSRAM %u (min %u), CPU %u.%u%% %u.%u%%",
+             (unsigned)sample->internal_free, (unsigned)sample->internal_min_free,
+             (unsigned)sample->psram_free, (unsigned)sample->psram_min_free,
+             sample->cpu_load[0] / 10, sample->cpu_load[0] % 10, sample->cpu_load[1] / 10, sample->cpu_load[1] % 10);
+}
+
 void app_main() {
     // Initialize NVS
     esp_err_t ret = nvs_flash_init();
@@ -242,14 +257,16 @@ void app_main() {
     sys_param = settings_get_parameter();
 
     bsp_spiffs_mount();
+    /* The prompts were converted to raw PCM at build time, and are played straight from flash */
+    if (ESP_OK != asset_pack_init_partition("assets")) {
+        ESP_LOGW(TAG, "No converted prompts");
+    }
     bsp_i2c_init();
 
-    bsp_display_cfg_t cfg = {.lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
-                             .buffer_size = BSP_LCD_H_RES * CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,
-                             .double_buffer = 0,
-                             .flags = {
-                                 .buff_dma = true,
-                             }};
+    bsp_display_cfg_t cfg = {
+        .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
+    };
+    bsp_display_profile_apply(NULL, &cfg);
     bsp_display_start_with_config(&cfg);
     bsp_board_init();
 
@@ -262,14 +279,10 @@ void app_main() {
     app_sr_start(false);
     audio_register_play_finish_cb(audio_play_finish_cb);
 
-    while (true) {
-
-        ESP_LOGD(TAG, "\tDescription\tInternal\tSPIRAM");
-        ESP_LOGD(TAG, "Current Free Memory\t%d\t\t%d", heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL),
-                 heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
-        ESP_LOGD(TAG, "Min. Ever Free Size\t%d\t\t%d",
-                 heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL),
-                 heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
-        vTaskDelay(pdMS_TO_TICKS(5 * 1000));
-    }
+    /* Heap and CPU load are sampled in the background and logged at debug level */
+    const telemetry_config_t telemetry_config = TELEMETRY_DEFAULT_CONFIG();
+    telemetry_counter_register("answers", &s_answer_counter);
+    telemetry_counter_register("http_errors", &s_http_error_counter);
+    telemetry_set_sample_cb(telemetry_log, NULL);
+    ESP_ERROR_CHECK_WITHOUT_ABORT(telemetry_start(&telemetry_config));
 }
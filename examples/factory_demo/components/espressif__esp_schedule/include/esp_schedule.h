@@ -231,6 +231,60 @@ esp_err_t esp_schedule_disable(esp_schedule_handle_t handle);
  */
 esp_err_t esp_schedule_get(esp_schedule_handle_t handle, esp_schedule_config_t *schedule_config);
 
+/** Begin a batch of schedule changes
+ *
+ * Schedules are stored in NVS as a single table. By default, the table is written 200 ms after a create, edit or
+ * delete, unless another change follows, so that changes made one after the other, as RainMaker makes them for a
+ * cloud update, are written together. Between esp_schedule_batch_begin() and esp_schedule_batch_end(), changes are
+ * only applied in RAM, and the table is written once, right when the outermost batch ends. This should be used when
+ * adding or editing several schedules at once, for example when importing them.
+ * Batches can be nested. Changes are lost if the device resets before they are written.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure (or if NVS is not enabled).
+ */
+esp_err_t esp_schedule_batch_begin(void);
+
+/** End a batch of schedule changes
+ *
+ * Writes all the changes made since the matching esp_schedule_batch_begin() to NVS, with a single commit.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t esp_schedule_batch_end(void);
+
+/** Get the next trigger time of a schedule
+ *
+ * This computes the first time after the given time at which a schedule with the given trigger would trigger,
+ * which also lies inside the validity window. It does not depend on any schedule state, so it can be used to
+ * preview a schedule before creating it.
+ * The trigger hours and minutes are w.r.t. the local timezone. On a DST change, a time that gets skipped triggers
+ * after the clock change (e.g. 02:30 becomes 03:30) and a time that occurs twice triggers only the first time.
+ * For ESP_SCHEDULE_TYPE_DATE, months which do not have the given day are skipped.
+ *
+ * @param[in] trigger Trigger details of the schedule.
+ * @param[in] validity (Optional) Validity of the schedule. NULL, or 0 for start/end time means no limit.
+ * @param[in] after UTC timestamp after which the next trigger time is to be found.
+ * @param[out] next_time UTC timestamp of the next trigger.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_NOT_FOUND if the schedule will not trigger again.
+ * @return error in case of failure.
+ */
+esp_err_t esp_schedule_get_next_time(const esp_schedule_trigger_t *trigger, const esp_schedule_validity_t *validity,
+                                     time_t after, time_t *next_time);
+
+/** Notify ESP Schedule of a time change
+ *
+ * This API can be called after the system time has been changed (for example from the SNTP time sync notification
+ * callback) to recompute the next trigger time of all the enabled schedules. Schedules which are already due at the new
+ * time are triggered first. Both happen shortly after, from the timer task.
+ * Time changes are also detected internally, but only when the schedule timer wakes up next, which can be up to an
+ * hour later.
+ */
+void esp_schedule_time_changed(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Next occurrence computation for schedules.
+ *
+ * Dates are walked with plain civil (proleptic Gregorian) day arithmetic and only the final local wall time of each
+ * candidate is converted to UTC. The conversion looks at the UTC offset before and after the candidate, so DST
+ * transitions are resolved directly:
+ * - a wall time which does not exist (spring forward) is shifted forward by the DST delta,
+ * - a wall time which exists twice (fall back) resolves to its first occurrence, so it triggers only once.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include <esp_err.h>
+#include <esp_schedule.h>
+
+#define SECONDS_IN_DAY (60 * 60 * 24)
+/* A day of month which exists in every month can be found within 12 months. The 29th of February needs up to 8 years. */
+#define ESP_SCHEDULE_MAX_MONTHS_TO_SEARCH (12 * 9)
+#define ESP_SCHEDULE_ALL_MONTHS 0xFFF
+
+static int64_t esp_schedule_days_from_civil(int year, int month, int day)
+{
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t yoe = year - era * 400;
+    const int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+static void esp_schedule_civil_from_days(int64_t days, int *year, int *month, int *day)
+{
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const int64_t doe = days - era * 146097;
+    const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int64_t mp = (5 * doy + 2) / 153;
+    *day = (int)(doy - (153 * mp + 2) / 5 + 1);
+    *month = (int)(mp < 10 ? mp + 3 : mp - 9);
+    *year = (int)(yoe + era * 400 + (*month <= 2));
+}
+
+static int64_t esp_schedule_floor_div(int64_t a, int64_t b)
+{
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+
+static int esp_schedule_days_in_month(int year, int month)
+{
+    static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month == 2 && ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)) {
+        return 29;
+    }
+    return days[month - 1];
+}
+
+/* Local wall time (seconds since 1970-01-01 00:00 local) minus UTC, at the given UTC instant */
+static int64_t esp_schedule_local_offset(time_t utc)
+{
+    struct tm tm;
+    localtime_r(&utc, &tm);
+    int64_t wall = esp_schedule_days_from_civil(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday) * SECONDS_IN_DAY
+                   + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+    return wall - (int64_t)utc;
+}
+
+static time_t esp_schedule_wall_to_utc(int64_t wall)
+{
+    /* UTC offsets are always well below a day, so these are before and after any transition affecting this wall time */
+    int64_t offset_before = esp_schedule_local_offset((time_t)(wall - SECONDS_IN_DAY));
+    int64_t offset_after = esp_schedule_local_offset((time_t)(wall + SECONDS_IN_DAY));
+    if (offset_before == offset_after) {
+        return (time_t)(wall - offset_before);
+    }
+    time_t t_before = (time_t)(wall - offset_before);
+    time_t t_after = (time_t)(wall - offset_after);
+    bool before_valid = (esp_schedule_local_offset(t_before) == offset_before);
+    bool after_valid = (esp_schedule_local_offset(t_after) == offset_after);
+    if (before_valid && after_valid) {
+        /* Repeated wall time. Use the first one. */
+        return t_before < t_after ? t_before : t_after;
+    } else if (after_valid) {
+        return t_after;
+    }
+    /* Either only the old offset applies, or the wall time falls in a gap and gets shifted forward */
+    return t_before;
+}
+
+static esp_err_t esp_schedule_next_day_of_week(const esp_schedule_trigger_t *trigger, time_t after, time_t *next_time)
+{
+    int64_t day = esp_schedule_floor_div((int64_t)after + esp_schedule_local_offset(after), SECONDS_IN_DAY);
+    int64_t seconds_in_day = (trigger->hours * 60 + trigger->minutes) * 60;
+    /* One extra day so that a DST shift around midnight can not make us miss the next week's occurrence */
+    for (int i = 0; i <= 8; i++, day++) {
+        /* 1970-01-01 was a Thursday. For days, monday = 0, sunday = 6. */
+        int day_of_week = (int)(((day + 3) % 7 + 7) % 7);
+        if (trigger->day.repeat_days != ESP_SCHEDULE_DAY_ONCE && !(trigger->day.repeat_days & (1 << day_of_week))) {
+            continue;
+        }
+        time_t candidate = esp_schedule_wall_to_utc(day * SECONDS_IN_DAY + seconds_in_day);
+        if (candidate > after) {
+            *next_time = candidate;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+static esp_err_t esp_schedule_next_date(const esp_schedule_trigger_t *trigger, time_t after, time_t *next_time)
+{
+    int year, month, day;
+    int64_t after_day = esp_schedule_floor_div((int64_t)after + esp_schedule_local_offset(after), SECONDS_IN_DAY);
+    esp_schedule_civil_from_days(after_day, &year, &month, &day);
+
+    uint16_t repeat_months = trigger->date.repeat_months & ESP_SCHEDULE_ALL_MONTHS;
+    int last_year = INT32_MAX;
+    if (repeat_months == ESP_SCHEDULE_MONTH_ONCE) {
+        /* One time schedule on the given day of the next suitable month */
+        repeat_months = ESP_SCHEDULE_ALL_MONTHS;
+    } else if (!trigger->date.repeat_every_year) {
+        last_year = trigger->date.year ? trigger->date.year : year;
+    }
+    if (trigger->date.year > year) {
+        year = trigger->date.year;
+        month = 1;
+    }
+    int64_t seconds_in_day = (trigger->hours * 60 + trigger->minutes) * 60;
+    for (int i = 0; i < ESP_SCHEDULE_MAX_MONTHS_TO_SEARCH; i++) {
+        if (year > last_year) {
+            break;
+        }
+        /* Months which do not have the given day are skipped */
+        if ((repeat_months & (1 << (month - 1))) && trigger->date.day >= 1
+                && trigger->date.day <= esp_schedule_days_in_month(year, month)) {
+            int64_t days = esp_schedule_days_from_civil(year, month, trigger->date.day);
+            time_t candidate = esp_schedule_wall_to_utc(days * SECONDS_IN_DAY + seconds_in_day);
+            if (candidate > after) {
+                *next_time = candidate;
+                return ESP_OK;
+            }
+        }
+        if (++month > 12) {
+            month = 1;
+            year++;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_schedule_get_next_time(const esp_schedule_trigger_t *trigger, const esp_schedule_validity_t *validity,
+                                     time_t after, time_t *next_time)
+{
+    if (trigger == NULL || next_time == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    time_t candidate = 0;
+    if (trigger->type == ESP_SCHEDULE_TYPE_RELATIVE) {
+        /* Relative schedules trigger once, at a fixed time. They can not be moved into the validity window. */
+        candidate = (trigger->next_scheduled_time_utc > 0) ? trigger->next_scheduled_time_utc : after + trigger->relative_seconds;
+        if (candidate < after || (validity && validity->start_time != 0 && candidate < validity->start_time)) {
+            return ESP_ERR_NOT_FOUND;
+        }
+    } else if (trigger->hours > 23 || trigger->minutes > 59) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    /* The first occurrence has to be at or after the start of the validity window */
+    if (validity && validity->start_time != 0 && after < validity->start_time) {
+        after = validity->start_time - 1;
+    }
+
+    esp_err_t err = ESP_OK;
+    switch (trigger->type) {
+    case ESP_SCHEDULE_TYPE_DAYS_OF_WEEK:
+        err = esp_schedule_next_day_of_week(trigger, after, &candidate);
+        break;
+    case ESP_SCHEDULE_TYPE_DATE:
+        err = esp_schedule_next_date(trigger, after, &candidate);
+        break;
+    case ESP_SCHEDULE_TYPE_RELATIVE:
+        /* Already computed above */
+        break;
+    default:
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (validity && validity->end_time != 0 && candidate > validity->end_time) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    *next_time = candidate;
+    return ESP_OK;
+}
@@ -6,6 +6,11 @@
 #include <string.h>
 #include <time.h>
 #include <esp_log.h>
+#include <esp_idf_version.h>
+#include <esp_timer.h>
+#include <esp_rom_crc.h>
+#include <esp_rmaker_utils.h>
+#include <freertos/semphr.h>
 #include <nvs.h>
 #include "esp_schedule_internal.h"
 
@@ -13,67 +18,228 @@ static const char *TAG = "esp_schedule_nvs";
 
 #define ESP_SCHEDULE_NVS_NAMESPACE "schd"
 #define ESP_SCHEDULE_COUNT_KEY "schd_count"
+/* All the schedules are stored in this single blob */
+#define ESP_SCHEDULE_TABLE_KEY "schd_table"
+#define ESP_SCHEDULE_TABLE_MAGIC 0x5343
+#define ESP_SCHEDULE_TABLE_VERSION 1
+#define ESP_SCHEDULE_TABLE_MAX_ENTRIES UINT8_MAX
+/*
+ * Changes made outside a batch are written once none followed for this long. RainMaker creates, edits and deletes the
+ * schedules of a cloud update one by one, they end up in a single write.
+ */
+#define ESP_SCHEDULE_TABLE_WRITE_DELAY_MS 200
+
+/* Compact, fixed width copy of the persistent part of esp_schedule_t */
+typedef struct __attribute__((packed)) {
+    char name[MAX_SCHEDULE_NAME_LEN + 1];
+    uint8_t type;
+    uint8_t hours;
+    uint8_t minutes;
+    uint8_t repeat_days;
+    uint8_t day;
+    uint8_t repeat_every_year;
+    uint16_t repeat_months;
+    uint16_t year;
+    int32_t relative_seconds;
+    int64_t next_scheduled_time_utc;
+    int64_t validity_start_time;
+    int64_t validity_end_time;
+} esp_schedule_nvs_entry_t;
+
+typedef struct __attribute__((packed)) {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t entry_size;
+    uint16_t count;
+    uint16_t reserved;
+    /* CRC32 of the entries following the header */
+    uint32_t crc;
+} esp_schedule_nvs_table_header_t;
 
 static char *esp_schedule_nvs_partition = NULL;
 static bool nvs_enabled = false;
 
-esp_err_t esp_schedule_nvs_add(esp_schedule_t *schedule)
+/* RAM copy of the table. Changes are made here and written to NVS as a whole. */
+static struct {
+    SemaphoreHandle_t lock;
+    esp_timer_handle_t write_timer;
+    esp_schedule_nvs_entry_t *entries;
+    size_t count;
+    size_t capacity;
+    uint32_t batch_depth;
+    bool dirty;
+} s_table;
+
+static void esp_schedule_nvs_entry_from_schedule(esp_schedule_nvs_entry_t *entry, const esp_schedule_t *schedule)
 {
-    if (!nvs_enabled) {
-        ESP_LOGD(TAG, "NVS not enabled. Not adding to NVS.");
-        return ESP_ERR_INVALID_STATE;
+    memset(entry, 0, sizeof(*entry));
+    strlcpy(entry->name, schedule->name, sizeof(entry->name));
+    entry->type = schedule->trigger.type;
+    entry->hours = schedule->trigger.hours;
+    entry->minutes = schedule->trigger.minutes;
+    entry->repeat_days = schedule->trigger.day.repeat_days;
+    entry->day = schedule->trigger.date.day;
+    entry->repeat_every_year = schedule->trigger.date.repeat_every_year;
+    entry->repeat_months = schedule->trigger.date.repeat_months;
+    entry->year = schedule->trigger.date.year;
+    entry->relative_seconds = schedule->trigger.relative_seconds;
+    entry->next_scheduled_time_utc = schedule->trigger.next_scheduled_time_utc;
+    entry->validity_start_time = schedule->validity.start_time;
+    entry->validity_end_time = schedule->validity.end_time;
+}
+
+static void esp_schedule_nvs_entry_to_schedule(const esp_schedule_nvs_entry_t *entry, esp_schedule_t *schedule)
+{
+    strlcpy(schedule->name, entry->name, sizeof(schedule->name));
+    schedule->trigger.type = entry->type;
+    schedule->trigger.hours = entry->hours;
+    schedule->trigger.minutes = entry->minutes;
+    schedule->trigger.day.repeat_days = entry->repeat_days;
+    schedule->trigger.date.day = entry->day;
+    schedule->trigger.date.repeat_every_year = entry->repeat_every_year;
+    schedule->trigger.date.repeat_months = entry->repeat_months;
+    schedule->trigger.date.year = entry->year;
+    schedule->trigger.relative_seconds = entry->relative_seconds;
+    schedule->trigger.next_scheduled_time_utc = (time_t)entry->next_scheduled_time_utc;
+    schedule->validity.start_time = (time_t)entry->validity_start_time;
+    schedule->validity.end_time = (time_t)entry->validity_end_time;
+    schedule->heap_index = ESP_SCHEDULE_NOT_ARMED;
+}
+
+static int esp_schedule_nvs_find(const char *name)
+{
+    for (size_t i = 0; i < s_table.count; i++) {
+        if (strncmp(s_table.entries[i].name, name, sizeof(s_table.entries[i].name)) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static esp_err_t esp_schedule_nvs_reserve(size_t capacity)
+{
+    if (capacity <= s_table.capacity) {
+        return ESP_OK;
+    }
+    size_t new_capacity = s_table.capacity ? s_table.capacity * 2 : 8;
+    while (new_capacity < capacity) {
+        new_capacity *= 2;
     }
+    esp_schedule_nvs_entry_t *entries = MEM_REALLOC_EXTRAM(s_table.entries, new_capacity * sizeof(esp_schedule_nvs_entry_t));
+    if (entries == NULL) {
+        ESP_LOGE(TAG, "Could not allocate schedule table");
+        return ESP_ERR_NO_MEM;
+    }
+    s_table.entries = entries;
+    s_table.capacity = new_capacity;
+    return ESP_OK;
+}
+
+/* Write the RAM table to NVS in a single blob and commit. Must be called with the lock held. */
+static esp_err_t esp_schedule_nvs_write_table(void)
+{
+    /* Anything pending is written now */
+    esp_timer_stop(s_table.write_timer);
+    int64_t start_time = esp_timer_get_time();
+    size_t entries_size = s_table.count * sizeof(esp_schedule_nvs_entry_t);
+    size_t blob_size = sizeof(esp_schedule_nvs_table_header_t) + entries_size;
+    uint8_t *blob = MEM_ALLOC_EXTRAM(blob_size);
+    if (blob == NULL) {
+        ESP_LOGE(TAG, "Could not allocate schedule table blob");
+        return ESP_ERR_NO_MEM;
+    }
+    esp_schedule_nvs_table_header_t header = {
+        .magic = ESP_SCHEDULE_TABLE_MAGIC,
+        .version = ESP_SCHEDULE_TABLE_VERSION,
+        .entry_size = sizeof(esp_schedule_nvs_entry_t),
+        .count = s_table.count,
+        .crc = esp_rom_crc32_le(0, (const uint8_t *)s_table.entries, entries_size),
+    };
+    memcpy(blob, &header, sizeof(header));
+    if (entries_size) {
+        memcpy(blob + sizeof(header), s_table.entries, entries_size);
+    }
+
     nvs_handle_t nvs_handle;
     esp_err_t err = nvs_open_from_partition(esp_schedule_nvs_partition, ESP_SCHEDULE_NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "NVS open failed with error %d", err);
+        free(blob);
         return err;
     }
-
-    /* Check if this is new schedule or editing an existing schedule */
-    size_t buf_size;
-    bool editing_schedule = true;
-    err = nvs_get_blob(nvs_handle, schedule->name, NULL, &buf_size);
-    if (err != ESP_OK) {
-        if (err == ESP_ERR_NVS_NOT_FOUND) {
-            editing_schedule = false;
-        } else {
-            ESP_LOGE(TAG, "NVS get failed with error %d", err);
-            nvs_close(nvs_handle);
-            return err;
-        }
-    } else {
-        ESP_LOGI(TAG, "Updating the existing schedule %s", schedule->name);
-    }
-
-    err = nvs_set_blob(nvs_handle, schedule->name, schedule, sizeof(esp_schedule_t));
+    err = nvs_set_blob(nvs_handle, ESP_SCHEDULE_TABLE_KEY, blob, blob_size);
+    free(blob);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "NVS set failed with error %d", err);
         nvs_close(nvs_handle);
         return err;
     }
-    if (editing_schedule == false) {
-        uint8_t schedule_count;
-        err = nvs_get_u8(nvs_handle, ESP_SCHEDULE_COUNT_KEY, &schedule_count);
-        if (err != ESP_OK) {
-            if (err == ESP_ERR_NVS_NOT_FOUND) {
-                schedule_count = 0;
-            } else {
-                ESP_LOGE(TAG, "NVS get failed with error %d", err);
-                nvs_close(nvs_handle);
-                return err;
-            }
+    err = nvs_commit(nvs_handle);
+    nvs_close(nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "NVS commit failed with error %d", err);
+        return err;
+    }
+    s_table.dirty = false;
+    ESP_LOGI(TAG, "Stored %d schedule(s) in NVS in %lld us", (int)s_table.count, (long long)(esp_timer_get_time() - start_time));
+    return ESP_OK;
+}
+
+/* Write the RAM table after a change, at the end of the batch or of the write delay. Must be called with the lock held. */
+static void esp_schedule_nvs_table_changed(void)
+{
+    s_table.dirty = true;
+    if (s_table.batch_depth == 0) {
+        /* Restarts the delay if a write is pending */
+        esp_timer_stop(s_table.write_timer);
+        esp_timer_start_once(s_table.write_timer, ESP_SCHEDULE_TABLE_WRITE_DELAY_MS * 1000);
+    }
+}
+
+static void esp_schedule_nvs_write_timer_cb(void *arg)
+{
+    xSemaphoreTake(s_table.lock, portMAX_DELAY);
+    /* Inside a batch, the end of the batch writes */
+    if (s_table.batch_depth == 0 && s_table.dirty) {
+        esp_schedule_nvs_write_table();
+    }
+    xSemaphoreGive(s_table.lock);
+}
+
+esp_err_t esp_schedule_nvs_add(esp_schedule_t *schedule)
+{
+    if (!nvs_enabled) {
+        ESP_LOGD(TAG, "NVS not enabled. Not adding to NVS.");
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_schedule_nvs_entry_t entry;
+    esp_schedule_nvs_entry_from_schedule(&entry, schedule);
+
+    xSemaphoreTake(s_table.lock, portMAX_DELAY);
+    int index = esp_schedule_nvs_find(schedule->name);
+    if (index >= 0) {
+        ESP_LOGI(TAG, "Updating the existing schedule %s", schedule->name);
+        if (memcmp(&s_table.entries[index], &entry, sizeof(entry)) == 0) {
+            /* Nothing changed, no need to write to flash */
+            xSemaphoreGive(s_table.lock);
+            return ESP_OK;
         }
-        schedule_count++;
-        err = nvs_set_u8(nvs_handle, ESP_SCHEDULE_COUNT_KEY, schedule_count);
+    } else {
+        if (s_table.count >= ESP_SCHEDULE_TABLE_MAX_ENTRIES) {
+            ESP_LOGE(TAG, "Maximum number of schedules (%d) reached", ESP_SCHEDULE_TABLE_MAX_ENTRIES);
+            xSemaphoreGive(s_table.lock);
+            return ESP_ERR_NO_MEM;
+        }
+        esp_err_t err = esp_schedule_nvs_reserve(s_table.count + 1);
         if (err != ESP_OK) {
-            ESP_LOGE(TAG, "NVS set failed for schedule count with error %d", err);
-            nvs_close(nvs_handle);
+            xSemaphoreGive(s_table.lock);
             return err;
         }
+        index = s_table.count++;
     }
-    nvs_commit(nvs_handle);
-    nvs_close(nvs_handle);
+    s_table.entries[index] = entry;
+    esp_schedule_nvs_table_changed();
+    xSemaphoreGive(s_table.lock);
     ESP_LOGI(TAG, "Schedule %s added in NVS", schedule->name);
     return ESP_OK;
 }
@@ -98,6 +264,11 @@ esp_err_t esp_schedule_nvs_remove_all(void)
     }
     nvs_commit(nvs_handle);
     nvs_close(nvs_handle);
+    xSemaphoreTake(s_table.lock, portMAX_DELAY);
+    esp_timer_stop(s_table.write_timer);
+    s_table.count = 0;
+    s_table.dirty = false;
+    xSemaphoreGive(s_table.lock);
     ESP_LOGI(TAG, "All schedules removed from NVS");
     return ESP_OK;
 }
@@ -108,157 +279,296 @@ esp_err_t esp_schedule_nvs_remove(esp_schedule_t *schedule)
         ESP_LOGD(TAG, "NVS not enabled. Not removing from NVS.");
         return ESP_ERR_INVALID_STATE;
     }
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open_from_partition(esp_schedule_nvs_partition, ESP_SCHEDULE_NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS open failed with error %d", err);
-        return err;
+    xSemaphoreTake(s_table.lock, portMAX_DELAY);
+    int index = esp_schedule_nvs_find(schedule->name);
+    if (index < 0) {
+        xSemaphoreGive(s_table.lock);
+        ESP_LOGE(TAG, "Schedule %s not found in NVS", schedule->name);
+        return ESP_ERR_NVS_NOT_FOUND;
     }
-    err = nvs_erase_key(nvs_handle, schedule->name);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS erase key failed with error %d", err);
-        nvs_close(nvs_handle);
-        return err;
+    /* The order of the entries does not matter */
+    s_table.entries[index] = s_table.entries[--s_table.count];
+    esp_schedule_nvs_table_changed();
+    xSemaphoreGive(s_table.lock);
+    ESP_LOGI(TAG, "Schedule %s removed from NVS", schedule->name);
+    return ESP_OK;
+}
+
+esp_err_t esp_schedule_nvs_batch_begin(void)
+{
+    if (!nvs_enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(s_table.lock, portMAX_DELAY);
+    s_table.batch_depth++;
+    xSemaphoreGive(s_table.lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_schedule_nvs_batch_end(void)
+{
+    if (!nvs_enabled) {
+        return ESP_ERR_INVALID_STATE;
     }
-    uint8_t schedule_count;
-    err = nvs_get_u8(nvs_handle, ESP_SCHEDULE_COUNT_KEY, &schedule_count);
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(s_table.lock, portMAX_DELAY);
+    if (s_table.batch_depth == 0) {
+        ESP_LOGE(TAG, "No batch in progress");
+        err = ESP_ERR_INVALID_STATE;
+    } else if (--s_table.batch_depth == 0 && s_table.dirty) {
+        err = esp_schedule_nvs_write_table();
+    }
+    xSemaphoreGive(s_table.lock);
+    return err;
+}
+
+/* Schedules stored by older versions, as one esp_schedule_t blob per schedule plus a count */
+static esp_schedule_t *esp_schedule_nvs_legacy_get(nvs_handle_t nvs_handle, const char *nvs_key)
+{
+    size_t buf_size;
+    esp_err_t err = nvs_get_blob(nvs_handle, nvs_key, NULL, &buf_size);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS get failed for schedule count with error %d", err);
-        nvs_close(nvs_handle);
-        return err;
+        ESP_LOGE(TAG, "NVS get failed with error %d", err);
+        return NULL;
     }
-    schedule_count--;
-    err = nvs_set_u8(nvs_handle, ESP_SCHEDULE_COUNT_KEY, schedule_count);
+    if (buf_size != sizeof(esp_schedule_t)) {
+        ESP_LOGE(TAG, "Schedule %s has unexpected size %d", nvs_key, (int)buf_size);
+        return NULL;
+    }
+    esp_schedule_t *schedule = (esp_schedule_t *)malloc(buf_size);
+    if (schedule == NULL) {
+        ESP_LOGE(TAG, "Could not allocate handle");
+        return NULL;
+    }
+    err = nvs_get_blob(nvs_handle, nvs_key, schedule, &buf_size);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS set failed for schedule count with error %d", err);
-        nvs_close(nvs_handle);
-        return err;
+        ESP_LOGE(TAG, "NVS get failed with error %d", err);
+        free(schedule);
+        return NULL;
     }
-    nvs_commit(nvs_handle);
-    nvs_close(nvs_handle);
-    ESP_LOGI(TAG, "Schedule %s removed from NVS", schedule->name);
+    return schedule;
+}
+
+/* Keys of the legacy schedule blobs. They are listed first and used after, as NVS is not to be changed while iterated. */
+static esp_err_t esp_schedule_nvs_legacy_keys(char (**keys)[NVS_KEY_NAME_MAX_SIZE], size_t *key_count)
+{
+    nvs_entry_info_t nvs_entry;
+    *keys = NULL;
+    *key_count = 0;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+    nvs_iterator_t nvs_iterator = NULL;
+    esp_err_t iter_err = nvs_entry_find(esp_schedule_nvs_partition, ESP_SCHEDULE_NVS_NAMESPACE, NVS_TYPE_BLOB, &nvs_iterator);
+    while (iter_err == ESP_OK) {
+        nvs_entry_info(nvs_iterator, &nvs_entry);
+#else
+    nvs_iterator_t nvs_iterator = nvs_entry_find(esp_schedule_nvs_partition, ESP_SCHEDULE_NVS_NAMESPACE, NVS_TYPE_BLOB);
+    while (nvs_iterator != NULL) {
+        nvs_entry_info(nvs_iterator, &nvs_entry);
+#endif
+        if (strcmp(nvs_entry.key, ESP_SCHEDULE_TABLE_KEY) != 0) {
+            char (*new_keys)[NVS_KEY_NAME_MAX_SIZE] = realloc(*keys, (*key_count + 1) * NVS_KEY_NAME_MAX_SIZE);
+            if (new_keys == NULL) {
+                ESP_LOGE(TAG, "Could not allocate legacy key list");
+                free(*keys);
+                *keys = NULL;
+                *key_count = 0;
+                nvs_release_iterator(nvs_iterator);
+                return ESP_ERR_NO_MEM;
+            }
+            *keys = new_keys;
+            strlcpy((*keys)[(*key_count)++], nvs_entry.key, NVS_KEY_NAME_MAX_SIZE);
+        }
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+        iter_err = nvs_entry_next(&nvs_iterator);
+    }
+    nvs_release_iterator(nvs_iterator);
+#else
+        nvs_iterator = nvs_entry_next(nvs_iterator);
+    }
+#endif
     return ESP_OK;
 }
 
-static uint8_t esp_schedule_nvs_get_count(void)
+/* Erase the legacy keys, once the table holds their schedules. Also finishes a migration interrupted by a reset. */
+static void esp_schedule_nvs_drop_legacy(void)
 {
-    if (!nvs_enabled) {
-        ESP_LOGD(TAG, "NVS not enabled. Not getting count from NVS.");
-        return 0;
+    nvs_handle_t nvs_handle;
+    if (nvs_open_from_partition(esp_schedule_nvs_partition, ESP_SCHEDULE_NVS_NAMESPACE, NVS_READWRITE, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    uint8_t legacy_count = 0;
+    char (*keys)[NVS_KEY_NAME_MAX_SIZE] = NULL;
+    size_t key_count = 0;
+    if (nvs_get_u8(nvs_handle, ESP_SCHEDULE_COUNT_KEY, &legacy_count) != ESP_OK
+            || esp_schedule_nvs_legacy_keys(&keys, &key_count) != ESP_OK) {
+        nvs_close(nvs_handle);
+        return;
+    }
+    for (size_t i = 0; i < key_count; i++) {
+        nvs_erase_key(nvs_handle, keys[i]);
+    }
+    free(keys);
+    /* The count goes last: while it is there, the remaining legacy keys are erased on the next boot */
+    esp_err_t err = nvs_commit(nvs_handle);
+    if (err == ESP_OK) {
+        nvs_erase_key(nvs_handle, ESP_SCHEDULE_COUNT_KEY);
+        err = nvs_commit(nvs_handle);
     }
+    nvs_close(nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Could not erase the legacy schedules: %d", err);
+    }
+}
+
+/*
+ * Move schedules stored in the legacy format to the table. Must be called with the lock held.
+ * The legacy keys are only erased once the table is committed, so a reset or a full partition in between loses nothing.
+ */
+static esp_err_t esp_schedule_nvs_migrate_legacy(void)
+{
     nvs_handle_t nvs_handle;
     esp_err_t err = nvs_open_from_partition(esp_schedule_nvs_partition, ESP_SCHEDULE_NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS open failed with error %d", err);
-        return 0;
+        return err;
     }
-    uint8_t schedule_count;
-    err = nvs_get_u8(nvs_handle, ESP_SCHEDULE_COUNT_KEY, &schedule_count);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS get failed for schedule count with error %d", err);
+    uint8_t legacy_count = 0;
+    if (nvs_get_u8(nvs_handle, ESP_SCHEDULE_COUNT_KEY, &legacy_count) != ESP_OK || legacy_count == 0) {
         nvs_close(nvs_handle);
-        return 0;
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    ESP_LOGI(TAG, "Migrating %d schedule(s) to the schedule table", legacy_count);
+
+    char (*keys)[NVS_KEY_NAME_MAX_SIZE] = NULL;
+    size_t key_count = 0;
+    err = esp_schedule_nvs_legacy_keys(&keys, &key_count);
+    for (size_t i = 0; i < key_count; i++) {
+        esp_schedule_t *schedule = esp_schedule_nvs_legacy_get(nvs_handle, keys[i]);
+        if (schedule && esp_schedule_nvs_reserve(s_table.count + 1) == ESP_OK) {
+            esp_schedule_nvs_entry_from_schedule(&s_table.entries[s_table.count++], schedule);
+        }
+        free(schedule);
     }
+    free(keys);
     nvs_close(nvs_handle);
-    ESP_LOGI(TAG, "Schedules in NVS: %d", schedule_count);
-    return schedule_count;
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = esp_schedule_nvs_write_table();
+    if (err != ESP_OK) {
+        /* The schedules still run from RAM. The table is written with the next change, or migrated again on the next boot. */
+        ESP_LOGE(TAG, "Could not store the schedule table, keeping the legacy schedules: %d", err);
+        s_table.dirty = true;
+        return ESP_OK;
+    }
+    esp_schedule_nvs_drop_legacy();
+    return ESP_OK;
 }
 
-static esp_schedule_handle_t esp_schedule_nvs_get(char *nvs_key)
+/* Read the table from NVS into RAM with a single read. Must be called with the lock held. */
+static esp_err_t esp_schedule_nvs_load_table(void)
 {
-    if (!nvs_enabled) {
-        ESP_LOGD(TAG, "NVS not enabled. Not getting from NVS.");
-        return NULL;
-    }
-    size_t buf_size;
     nvs_handle_t nvs_handle;
     esp_err_t err = nvs_open_from_partition(esp_schedule_nvs_partition, ESP_SCHEDULE_NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS open failed with error %d", err);
-        return NULL;
+        return err;
     }
-    err = nvs_get_blob(nvs_handle, nvs_key, NULL, &buf_size);
+    size_t blob_size = 0;
+    err = nvs_get_blob(nvs_handle, ESP_SCHEDULE_TABLE_KEY, NULL, &blob_size);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS get failed with error %d", err);
         nvs_close(nvs_handle);
-        return NULL;
+        return err;
     }
-    esp_schedule_t *schedule = (esp_schedule_t *)malloc(buf_size);
-    if (schedule == NULL) {
-        ESP_LOGE(TAG, "Could not allocate handle");
+    uint8_t *blob = MEM_ALLOC_EXTRAM(blob_size);
+    if (blob == NULL) {
         nvs_close(nvs_handle);
-        return NULL;
+        return ESP_ERR_NO_MEM;
     }
-    err = nvs_get_blob(nvs_handle, nvs_key, schedule, &buf_size);
+    err = nvs_get_blob(nvs_handle, ESP_SCHEDULE_TABLE_KEY, blob, &blob_size);
+    nvs_close(nvs_handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS get failed with error %d", err);
-        nvs_close(nvs_handle);
-        free(schedule);
-        return NULL;
+        free(blob);
+        return err;
     }
-    nvs_close(nvs_handle);
-    ESP_LOGI(TAG, "Schedule %s found in NVS", schedule->name);
-    return (esp_schedule_handle_t) schedule;
+
+    esp_schedule_nvs_table_header_t header;
+    if (blob_size < sizeof(header)) {
+        free(blob);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(&header, blob, sizeof(header));
+    size_t entries_size = header.count * sizeof(esp_schedule_nvs_entry_t);
+    if (header.magic != ESP_SCHEDULE_TABLE_MAGIC || header.version != ESP_SCHEDULE_TABLE_VERSION
+            || header.entry_size != sizeof(esp_schedule_nvs_entry_t)) {
+        ESP_LOGE(TAG, "Unsupported schedule table version %d", header.version);
+        free(blob);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (blob_size != sizeof(header) + entries_size) {
+        ESP_LOGE(TAG, "Schedule table size mismatch");
+        free(blob);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const uint8_t *entries = blob + sizeof(header);
+    if (esp_rom_crc32_le(0, entries, entries_size) != header.crc) {
+        ESP_LOGE(TAG, "Schedule table CRC mismatch");
+        free(blob);
+        return ESP_ERR_INVALID_CRC;
+    }
+    err = esp_schedule_nvs_reserve(header.count);
+    if (err == ESP_OK) {
+        memcpy(s_table.entries, entries, entries_size);
+        s_table.count = header.count;
+    }
+    free(blob);
+    return err;
 }
 
 esp_schedule_handle_t *esp_schedule_nvs_get_all(uint8_t *schedule_count)
 {
+    *schedule_count = 0;
     if (!nvs_enabled) {
         ESP_LOGD(TAG, "NVS not enabled. Not Initialising NVS.");
         return NULL;
     }
-
-    *schedule_count = esp_schedule_nvs_get_count();
-    if (*schedule_count == 0) {
+    int64_t start_time = esp_timer_get_time();
+    xSemaphoreTake(s_table.lock, portMAX_DELAY);
+    s_table.count = 0;
+    esp_err_t err = esp_schedule_nvs_load_table();
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        err = esp_schedule_nvs_migrate_legacy();
+    } else if (err == ESP_OK) {
+        esp_schedule_nvs_drop_legacy();
+    }
+    if (err != ESP_OK || s_table.count == 0) {
+        if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+            ESP_LOGE(TAG, "Could not read schedules from NVS: %d", err);
+        }
+        xSemaphoreGive(s_table.lock);
         ESP_LOGI(TAG, "No Entries found in NVS");
         return NULL;
     }
-    esp_schedule_handle_t *handle_list = (esp_schedule_handle_t *)malloc(sizeof(esp_schedule_handle_t) * (*schedule_count));
+
+    esp_schedule_handle_t *handle_list = (esp_schedule_handle_t *)malloc(sizeof(esp_schedule_handle_t) * s_table.count);
     if (handle_list == NULL) {
         ESP_LOGE(TAG, "Could not allocate schedule list");
-        *schedule_count = 0;
+        xSemaphoreGive(s_table.lock);
         return NULL;
     }
     int handle_count = 0;
-
-    nvs_entry_info_t nvs_entry;
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
-    nvs_iterator_t nvs_iterator = NULL;
-    esp_err_t err = nvs_entry_find(esp_schedule_nvs_partition, ESP_SCHEDULE_NVS_NAMESPACE, NVS_TYPE_BLOB, &nvs_iterator);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "No entry found in NVS");
-        return NULL;;
-    }
-    while (err == ESP_OK) {
-        nvs_entry_info(nvs_iterator, &nvs_entry);
-        ESP_LOGI(TAG, "Found schedule in NVS with key: %s", nvs_entry.key);
-        handle_list[handle_count] = esp_schedule_nvs_get(nvs_entry.key);
-        if (handle_list[handle_count] != NULL) {
-            /* Increase count only if nvs_get was successful */
-            handle_count++;
+    for (size_t i = 0; i < s_table.count; i++) {
+        /* Each schedule is freed individually with esp_schedule_delete(), so it needs its own allocation */
+        esp_schedule_t *schedule = (esp_schedule_t *)MEM_CALLOC_EXTRAM(1, sizeof(esp_schedule_t));
+        if (schedule == NULL) {
+            ESP_LOGE(TAG, "Could not allocate handle");
+            break;
         }
-        err = nvs_entry_next(&nvs_iterator);
+        esp_schedule_nvs_entry_to_schedule(&s_table.entries[i], schedule);
+        ESP_LOGD(TAG, "Schedule %s found in NVS", schedule->name);
+        handle_list[handle_count++] = (esp_schedule_handle_t)schedule;
     }
-    nvs_release_iterator(nvs_iterator);
-#else
-    nvs_iterator_t nvs_iterator = nvs_entry_find(esp_schedule_nvs_partition, ESP_SCHEDULE_NVS_NAMESPACE, NVS_TYPE_BLOB);
-    if (nvs_iterator == NULL) {
-        ESP_LOGE(TAG, "No entry found in NVS");
-        return NULL;;
-    }
-    while (nvs_iterator != NULL) {
-        nvs_entry_info(nvs_iterator, &nvs_entry);
-        ESP_LOGI(TAG, "Found schedule in NVS with key: %s", nvs_entry.key);
-        handle_list[handle_count] = esp_schedule_nvs_get(nvs_entry.key);
-        if (handle_list[handle_count] != NULL) {
-            /* Increase count only if nvs_get was successful */
-            handle_count++;
-        }
-        nvs_iterator = nvs_entry_next(nvs_iterator);
-    }
-#endif
+    xSemaphoreGive(s_table.lock);
     *schedule_count = handle_count;
-    ESP_LOGI(TAG, "Found %d schedules in NVS", *schedule_count);
+    ESP_LOGI(TAG, "Found %d schedules in NVS in %lld us", *schedule_count, (long long)(esp_timer_get_time() - start_time));
     return handle_list;
 }
 
@@ -282,6 +592,21 @@ esp_err_t esp_schedule_nvs_init(char *nvs_partition)
         ESP_LOGE(TAG, "Could not allocate nvs_partition");
         return ESP_ERR_NO_MEM;
     }
+    s_table.lock = xSemaphoreCreateMutex();
+    const esp_timer_create_args_t write_timer_args = {
+        .callback = esp_schedule_nvs_write_timer_cb,
+        .name = "schd_nvs",
+    };
+    if (s_table.lock == NULL || esp_timer_create(&write_timer_args, &s_table.write_timer) != ESP_OK) {
+        ESP_LOGE(TAG, "Could not create schedule table lock or timer");
+        if (s_table.lock) {
+            vSemaphoreDelete(s_table.lock);
+            s_table.lock = NULL;
+        }
+        free(esp_schedule_nvs_partition);
+        esp_schedule_nvs_partition = NULL;
+        return ESP_ERR_NO_MEM;
+    }
     nvs_enabled = true;
     return ESP_OK;
 }
@@ -0,0 +1,364 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Single timer backend for ESP Schedule.
+ *
+ * All the enabled schedules are kept in a binary min-heap keyed by their absolute UTC fire time, and only one
+ * FreeRTOS timer is armed, for the earliest entry. The timer is never armed for more than
+ * ESP_SCHEDULE_TIMER_MAX_ARM_SECONDS, so schedules which are months away do not overflow the tick count, and a
+ * change of the system time (e.g. SNTP sync) is noticed at the latest on the next wake up. When the time has jumped,
+ * the schedules which are due are triggered first, then the next fire time of every other schedule is recomputed and
+ * the heap is rebuilt.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <esp_log.h>
+#include <esp_rmaker_utils.h>
+#include <freertos/semphr.h>
+#include "esp_schedule_internal.h"
+
+static const char *TAG = "esp_schedule_timer";
+
+/* Longest period the timer is armed for. Longer waits are split into multiple wake ups. */
+#define ESP_SCHEDULE_TIMER_MAX_ARM_SECONDS      (60 * 60)
+/* Poll interval while there are schedules waiting for the time to be synced */
+#define ESP_SCHEDULE_TIMER_TIME_SYNC_POLL_SECONDS 10
+/* Difference between the wall clock and the tick count above which the time is considered to have been changed */
+#define ESP_SCHEDULE_TIMER_JUMP_THRESHOLD_SECONDS 30
+#define ESP_SCHEDULE_TIMER_INITIAL_CAPACITY     8
+
+typedef struct {
+    /* Absolute UTC time at which the schedule is to be triggered */
+    time_t fire_time;
+    /* Set if the time was not synced when the schedule was added. Such entries sort after all others. */
+    bool waiting_for_time;
+    esp_schedule_t *schedule;
+} esp_schedule_timer_node_t;
+
+static struct {
+    SemaphoreHandle_t lock;
+    TimerHandle_t timer;
+    esp_schedule_timer_node_t *heap;
+    size_t count;
+    size_t capacity;
+    /* Wall clock and tick count when the timer was last armed. Used for detecting time jumps. */
+    time_t armed_time;
+    TickType_t armed_tick;
+    /* Set by esp_schedule_timer_resync(). The timer callback recomputes the schedules once the due ones are fired. */
+    bool resync_pending;
+} s_timer;
+
+static inline void esp_schedule_timer_lock(void)
+{
+    xSemaphoreTakeRecursive(s_timer.lock, portMAX_DELAY);
+}
+
+static inline void esp_schedule_timer_unlock(void)
+{
+    xSemaphoreGiveRecursive(s_timer.lock);
+}
+
+static inline bool esp_schedule_timer_node_less(const esp_schedule_timer_node_t *a, const esp_schedule_timer_node_t *b)
+{
+    if (a->waiting_for_time != b->waiting_for_time) {
+        return b->waiting_for_time;
+    }
+    return a->fire_time < b->fire_time;
+}
+
+static inline void esp_schedule_timer_heap_set(size_t index, const esp_schedule_timer_node_t *node)
+{
+    s_timer.heap[index] = *node;
+    s_timer.heap[index].schedule->heap_index = (int32_t)index;
+}
+
+static void esp_schedule_timer_sift_up(size_t index)
+{
+    esp_schedule_timer_node_t node = s_timer.heap[index];
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!esp_schedule_timer_node_less(&node, &s_timer.heap[parent])) {
+            break;
+        }
+        esp_schedule_timer_heap_set(index, &s_timer.heap[parent]);
+        index = parent;
+    }
+    esp_schedule_timer_heap_set(index, &node);
+}
+
+static void esp_schedule_timer_sift_down(size_t index)
+{
+    esp_schedule_timer_node_t node = s_timer.heap[index];
+    while (true) {
+        size_t child = 2 * index + 1;
+        if (child >= s_timer.count) {
+            break;
+        }
+        if (child + 1 < s_timer.count && esp_schedule_timer_node_less(&s_timer.heap[child + 1], &s_timer.heap[child])) {
+            child++;
+        }
+        if (!esp_schedule_timer_node_less(&s_timer.heap[child], &node)) {
+            break;
+        }
+        esp_schedule_timer_heap_set(index, &s_timer.heap[child]);
+        index = child;
+    }
+    esp_schedule_timer_heap_set(index, &node);
+}
+
+static void esp_schedule_timer_heap_remove(size_t index)
+{
+    s_timer.heap[index].schedule->heap_index = ESP_SCHEDULE_NOT_ARMED;
+    s_timer.count--;
+    if (index == s_timer.count) {
+        return;
+    }
+    esp_schedule_t *moved = s_timer.heap[s_timer.count].schedule;
+    esp_schedule_timer_heap_set(index, &s_timer.heap[s_timer.count]);
+    /* The moved node can be out of place in either direction */
+    esp_schedule_timer_sift_up(index);
+    esp_schedule_timer_sift_down(moved->heap_index);
+}
+
+static TickType_t esp_schedule_timer_seconds_to_ticks(time_t seconds)
+{
+    if (seconds <= 0) {
+        /* Already due. Timer periods must be greater than 0. */
+        return 1;
+    }
+    if (seconds > ESP_SCHEDULE_TIMER_MAX_ARM_SECONDS) {
+        seconds = ESP_SCHEDULE_TIMER_MAX_ARM_SECONDS;
+    }
+    TickType_t ticks = (TickType_t)(((uint64_t)seconds * 1000) / portTICK_PERIOD_MS);
+    return ticks > 0 ? ticks : 1;
+}
+
+static bool esp_schedule_timer_in_timer_task(void)
+{
+    return xTaskGetCurrentTaskHandle() == xTimerGetTimerDaemonTaskHandle();
+}
+
+/* Must be called with the lock held. Sends the timer command for the current heap without blocking. */
+static BaseType_t esp_schedule_timer_arm(void)
+{
+    if (s_timer.count == 0) {
+        return xTimerStop(s_timer.timer, 0);
+    }
+    time_t now;
+    time(&now);
+    const esp_schedule_timer_node_t *top = &s_timer.heap[0];
+    time_t wait_seconds = top->waiting_for_time ? ESP_SCHEDULE_TIMER_TIME_SYNC_POLL_SECONDS : top->fire_time - now;
+    if (s_timer.resync_pending) {
+        /* Keep the callback due, it resyncs */
+        wait_seconds = 0;
+    }
+
+    s_timer.armed_time = now;
+    s_timer.armed_tick = xTaskGetTickCount();
+    ESP_LOGD(TAG, "Next wake up in %lld seconds for schedule %s", (long long)wait_seconds, top->schedule->name);
+    /* xTimerChangePeriod() also starts the timer if it is dormant */
+    return xTimerChangePeriod(s_timer.timer, esp_schedule_timer_seconds_to_ticks(wait_seconds), 0);
+}
+
+/* Must be called with the lock held, not nested */
+static void esp_schedule_timer_rearm(void)
+{
+    /* Never block on the timer command queue with the lock held: the timer task may be waiting for the lock in the
+     * callback, and would never empty a full queue. Let it run, then arm for the heap as it is by then.
+     */
+    while (esp_schedule_timer_arm() != pdPASS) {
+        if (esp_schedule_timer_in_timer_task()) {
+            /* Waiting here could never succeed either */
+            ESP_LOGE(TAG, "Timer command queue full, schedules are held until the next change");
+            return;
+        }
+        esp_schedule_timer_unlock();
+        vTaskDelay(1);
+        esp_schedule_timer_lock();
+    }
+}
+
+/* Must be called with the lock held */
+static void esp_schedule_timer_resync_locked(void)
+{
+    size_t i = s_timer.count;
+    while (i-- > 0) {
+        esp_schedule_timer_node_t *node = &s_timer.heap[i];
+        esp_err_t err = esp_schedule_update_next_time(node->schedule);
+        if (err == ESP_ERR_NOT_FOUND) {
+            /* No trigger left. Replace it with the last entry, which has already been updated. */
+            node->schedule->heap_index = ESP_SCHEDULE_NOT_ARMED;
+            s_timer.count--;
+            if (i != s_timer.count) {
+                esp_schedule_timer_heap_set(i, &s_timer.heap[s_timer.count]);
+            }
+            continue;
+        }
+        node->waiting_for_time = (err != ESP_OK);
+        node->fire_time = node->schedule->trigger.next_scheduled_time_utc;
+    }
+    /* Rebuild the heap bottom up */
+    for (size_t i = s_timer.count / 2; i > 0; i--) {
+        esp_schedule_timer_sift_down(i - 1);
+    }
+    ESP_LOGI(TAG, "Recomputed %d schedule(s) after time change", (int)s_timer.count);
+}
+
+static bool esp_schedule_timer_time_jumped(time_t now)
+{
+    if (s_timer.count == 0) {
+        return false;
+    }
+    if (s_timer.heap[0].waiting_for_time) {
+        /* The first entry sorts last only if every entry is waiting. Retry once the time is synced. */
+        return now >= SECONDS_TILL_2020;
+    }
+    uint64_t elapsed_ms = (uint64_t)(xTaskGetTickCount() - s_timer.armed_tick) * portTICK_PERIOD_MS;
+    time_t expected = s_timer.armed_time + (time_t)(elapsed_ms / 1000);
+    time_t drift = now - expected;
+    return (drift > ESP_SCHEDULE_TIMER_JUMP_THRESHOLD_SECONDS) || (drift < -ESP_SCHEDULE_TIMER_JUMP_THRESHOLD_SECONDS);
+}
+
+static void esp_schedule_timer_cb(TimerHandle_t timer)
+{
+    time_t now;
+    time(&now);
+    esp_schedule_timer_lock();
+    bool resync = s_timer.resync_pending || esp_schedule_timer_time_jumped(now);
+    s_timer.resync_pending = false;
+    /* Fire the due entries before recomputing: after a jump forward, a relative schedule which is already due has no
+     * next time anymore, and would be dropped without ever being triggered.
+     */
+    while (s_timer.count > 0) {
+        esp_schedule_timer_node_t *top = &s_timer.heap[0];
+        if (top->waiting_for_time || top->fire_time > now) {
+            break;
+        }
+        esp_schedule_t *schedule = top->schedule;
+        esp_schedule_timer_heap_remove(0);
+        /* The schedule re-adds itself if it has to be triggered again */
+        esp_schedule_timer_unlock();
+        esp_schedule_process(schedule);
+        esp_schedule_timer_lock();
+        time(&now);
+    }
+    if (resync) {
+        ESP_LOGW(TAG, "System time changed");
+        esp_schedule_timer_resync_locked();
+    }
+    esp_schedule_timer_rearm();
+    esp_schedule_timer_unlock();
+}
+
+static esp_err_t esp_schedule_timer_reserve(size_t capacity)
+{
+    if (capacity <= s_timer.capacity) {
+        return ESP_OK;
+    }
+    size_t new_capacity = s_timer.capacity ? s_timer.capacity * 2 : ESP_SCHEDULE_TIMER_INITIAL_CAPACITY;
+    while (new_capacity < capacity) {
+        new_capacity *= 2;
+    }
+    esp_schedule_timer_node_t *heap = MEM_REALLOC_EXTRAM(s_timer.heap, new_capacity * sizeof(esp_schedule_timer_node_t));
+    if (heap == NULL) {
+        ESP_LOGE(TAG, "Could not grow the schedule heap to %d entries", (int)new_capacity);
+        return ESP_ERR_NO_MEM;
+    }
+    s_timer.heap = heap;
+    s_timer.capacity = new_capacity;
+    return ESP_OK;
+}
+
+esp_err_t esp_schedule_timer_add(esp_schedule_t *schedule, bool time_valid)
+{
+    esp_err_t err = esp_schedule_timer_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+    esp_schedule_timer_node_t node = {
+        .fire_time = schedule->trigger.next_scheduled_time_utc,
+        .waiting_for_time = !time_valid,
+        .schedule = schedule,
+    };
+    esp_schedule_timer_lock();
+    if (schedule->heap_index >= 0 && (size_t)schedule->heap_index < s_timer.count
+            && s_timer.heap[schedule->heap_index].schedule == schedule) {
+        /* Already armed. Just move it to the new position. */
+        size_t index = schedule->heap_index;
+        esp_schedule_timer_heap_set(index, &node);
+        esp_schedule_timer_sift_up(index);
+        esp_schedule_timer_sift_down(schedule->heap_index);
+    } else {
+        err = esp_schedule_timer_reserve(s_timer.count + 1);
+        if (err != ESP_OK) {
+            esp_schedule_timer_unlock();
+            return err;
+        }
+        s_timer.count++;
+        esp_schedule_timer_heap_set(s_timer.count - 1, &node);
+        esp_schedule_timer_sift_up(s_timer.count - 1);
+    }
+    /* Only re-arm if the earliest entry changed */
+    if (s_timer.heap[0].schedule == schedule) {
+        esp_schedule_timer_rearm();
+    }
+    esp_schedule_timer_unlock();
+    return ESP_OK;
+}
+
+void esp_schedule_timer_remove(esp_schedule_t *schedule)
+{
+    if (s_timer.lock == NULL) {
+        return;
+    }
+    esp_schedule_timer_lock();
+    if (schedule->heap_index >= 0 && (size_t)schedule->heap_index < s_timer.count
+            && s_timer.heap[schedule->heap_index].schedule == schedule) {
+        bool was_first = (schedule->heap_index == 0);
+        esp_schedule_timer_heap_remove(schedule->heap_index);
+        if (was_first) {
+            esp_schedule_timer_rearm();
+        }
+    }
+    schedule->heap_index = ESP_SCHEDULE_NOT_ARMED;
+    esp_schedule_timer_unlock();
+}
+
+void esp_schedule_timer_resync(void)
+{
+    if (s_timer.lock == NULL) {
+        return;
+    }
+    /* Done by the timer callback, so that the due schedules are triggered first and from the timer task */
+    esp_schedule_timer_lock();
+    s_timer.resync_pending = true;
+    esp_schedule_timer_unlock();
+    /* Sent without the lock, see esp_schedule_timer_rearm(). A rearm in between keeps the callback due. */
+    xTimerChangePeriod(s_timer.timer, 1, esp_schedule_timer_in_timer_task() ? 0 : portMAX_DELAY);
+}
+
+esp_err_t esp_schedule_timer_init(void)
+{
+    if (s_timer.timer) {
+        return ESP_OK;
+    }
+    s_timer.lock = xSemaphoreCreateRecursiveMutex();
+    if (s_timer.lock == NULL) {
+        ESP_LOGE(TAG, "Could not create schedule timer lock");
+        return ESP_ERR_NO_MEM;
+    }
+    /* Temporarily setting the timer for 1 (anything greater than 0) tick. This will get changed when xTimerChangePeriod() is called. */
+    s_timer.timer = xTimerCreate("schedule", 1, pdFALSE, NULL, esp_schedule_timer_cb);
+    if (s_timer.timer == NULL) {
+        ESP_LOGE(TAG, "Could not create schedule timer");
+        vSemaphoreDelete(s_timer.lock);
+        s_timer.lock = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,504 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "esp_log.h"
+#include "esp_check.h"
+#include "app_ir_code.h"
+
+#define IR_CODE_MAGIC0          'I'
+#define IR_CODE_MAGIC1          'R'
+#define IR_CODE_VERSION         1
+#define IR_CODE_HEADER_SIZE     4
+#define IR_CODE_MAX_FRAMES      UINT8_MAX
+#define IR_CODE_MAX_BITS        512         /* Longest pulse distance frame */
+#define IR_CODE_MIN_BITS        8
+
+#define NEC_HEADER_MARK         9000
+#define NEC_HEADER_SPACE        4500
+#define NEC_BIT_MARK            560
+#define NEC_ZERO_SPACE          560
+#define NEC_ONE_SPACE           1690
+#define NEC_BITS                32
+
+#define RC5_HALF_BIT            889
+#define RC5_BITS                14
+
+static const char *TAG = "app_ir_code";
+
+/**
+ * @brief A frame in its compact form
+ */
+typedef struct {
+    uint8_t protocol;
+    uint32_t gap_us;
+    uint16_t header_mark;
+    uint16_t header_space;
+    uint16_t bit_mark;
+    uint16_t zero_space;
+    uint16_t one_space;
+    uint16_t trail_mark;
+    uint16_t nbits;             /* Bits, or symbols of a raw frame */
+    const uint8_t *data;        /* Bits LSB first, or raw symbol words little endian */
+} ir_frame_t;
+
+typedef struct {
+    const uint8_t *p;
+    size_t left;
+    bool ok;
+} ir_reader_t;
+
+static uint32_t ir_read(ir_reader_t *r, size_t bytes)
+{
+    uint32_t v = 0;
+    if (r->left < bytes) {
+        r->ok = false;
+        return 0;
+    }
+    for (size_t i = 0; i < bytes; i++) {
+        v |= (uint32_t)r->p[i] << (8 * i);
+    }
+    r->p += bytes;
+    r->left -= bytes;
+    return v;
+}
+
+static const uint8_t *ir_read_bytes(ir_reader_t *r, size_t bytes)
+{
+    const uint8_t *p = r->p;
+    if (r->left < bytes) {
+        r->ok = false;
+        return NULL;
+    }
+    r->p += bytes;
+    r->left -= bytes;
+    return p;
+}
+
+static uint8_t *ir_write(uint8_t *p, uint32_t v, size_t bytes)
+{
+    for (size_t i = 0; i < bytes; i++) {
+        *p++ = (v >> (8 * i)) & 0xff;
+    }
+    return p;
+}
+
+/**
+ * @brief Duration match with the usual receiver distortion, marks often come out 100 us longer or shorter
+ */
+static bool ir_near(uint32_t value, uint32_t ref)
+{
+    uint32_t diff = (value > ref) ? value - ref : ref - value;
+    return diff <= ref / 4 + 100;
+}
+
+/**
+ * @brief Both durations within the tolerance of each other, a frame sent with the reference timings still matches
+ */
+static bool ir_near_both(uint32_t value, uint32_t ref)
+{
+    return ir_near(value, ref) && ir_near(ref, value);
+}
+
+/**
+ * @brief Number of symbols of a received frame, up to the end marker
+ */
+static size_t ir_frame_length(const rmt_symbol_word_t *symbols, size_t num_symbols)
+{
+    for (size_t i = 0; i < num_symbols; i++) {
+        if (0 == symbols[i].duration0) {
+            return i;
+        }
+        if (0 == symbols[i].duration1) {
+            return i + 1;
+        }
+    }
+    return num_symbols;
+}
+
+/**
+ * @brief Header, then bits of equal marks with a short or long space, then a trailing mark
+ */
+static bool ir_decode_pulse_distance(const rmt_symbol_word_t *s, size_t n, ir_frame_t *frame, uint8_t *bits)
+{
+    if ((n < IR_CODE_MIN_BITS + 2) || (n - 2 > IR_CODE_MAX_BITS)) {
+        return false;
+    }
+    const size_t nbits = n - 2;
+    uint32_t mark_sum = 0;
+    uint32_t space_min = UINT32_MAX;
+    uint32_t space_max = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (!s[i].level0 || s[i].level1) {
+            return false;
+        }
+    }
+    for (size_t i = 1; i <= nbits; i++) {
+        mark_sum += s[i].duration0;
+        space_min = MIN(space_min, s[i].duration1);
+        space_max = MAX(space_max, s[i].duration1);
+    }
+    const uint32_t bit_mark = mark_sum / nbits;
+    if ((s[0].duration0 < 2 * bit_mark) || !ir_near(s[n - 1].duration0, bit_mark)) {
+        return false;
+    }
+
+    /* Two clusters of spaces, a single one if all the bits are equal */
+    const uint32_t threshold = (space_max >= space_min * 3 / 2) ? (space_min + space_max) / 2 : UINT32_MAX;
+    uint32_t zero_sum = 0, zero_count = 0, one_sum = 0, one_count = 0;
+    memset(bits, 0, (nbits + 7) / 8);
+    for (size_t i = 0; i < nbits; i++) {
+        const rmt_symbol_word_t *b = &s[i + 1];
+        if (!ir_near(b->duration0, bit_mark)) {
+            return false;
+        }
+        if (b->duration1 >= threshold) {
+            bits[i / 8] |= 1 << (i % 8);
+            one_sum += b->duration1;
+            one_count++;
+        } else {
+            zero_sum += b->duration1;
+            zero_count++;
+        }
+    }
+    const uint32_t zero_space = zero_count ? zero_sum / zero_count : 0;
+    const uint32_t one_space = one_count ? one_sum / one_count : 0;
+    for (size_t i = 0; i < nbits; i++) {
+        const bool one = bits[i / 8] & (1 << (i % 8));
+        if (!ir_near(s[i + 1].duration1, one ? one_space : zero_space)) {
+            return false;
+        }
+    }
+
+    frame->header_mark = s[0].duration0;
+    frame->header_space = s[0].duration1;
+    frame->bit_mark = bit_mark;
+    frame->zero_space = zero_space ? zero_space : one_space;
+    frame->one_space = one_space ? one_space : zero_space;
+    frame->trail_mark = s[n - 1].duration0;
+    frame->nbits = nbits;
+    frame->data = bits;
+    frame->protocol = APP_IR_PROTO_PULSE_DISTANCE;
+
+    /* NEC frames are sent with the nominal timings */
+    if ((NEC_BITS == nbits) && ir_near_both(frame->header_mark, NEC_HEADER_MARK) &&
+            ir_near_both(frame->header_space, NEC_HEADER_SPACE) && ir_near_both(bit_mark, NEC_BIT_MARK) &&
+            ir_near_both(frame->zero_space, NEC_ZERO_SPACE) && ir_near_both(frame->one_space, NEC_ONE_SPACE) &&
+            ir_near_both(frame->trail_mark, NEC_BIT_MARK)) {
+        frame->protocol = APP_IR_PROTO_NEC;
+    }
+    return true;
+}
+
+/**
+ * @brief Manchester code of 889 us half bits, a 1 is a space then a mark, MSB first
+ *
+ * The space of the first start bit is not seen by the receiver, the frame starts with its mark.
+ */
+static bool ir_decode_rc5(const rmt_symbol_word_t *s, size_t n, ir_frame_t *frame, uint8_t *bits)
+{
+    uint8_t halves[2 * RC5_BITS];
+    size_t count = 0;
+
+    halves[count++] = 0;
+    for (size_t i = 0; i < n; i++) {
+        const uint32_t durations[2] = {s[i].duration0, s[i].duration1};
+        const uint8_t levels[2] = {s[i].level0, s[i].level1};
+        for (int h = 0; h < 2; h++) {
+            /* The space after the last mark merges into the idle line */
+            if ((i == n - 1) && (h == 1) && ((0 == durations[h]) || (durations[h] > 3 * RC5_HALF_BIT))) {
+                break;
+            }
+            uint32_t units = ir_near(durations[h], RC5_HALF_BIT) ? 1 : (ir_near(durations[h], 2 * RC5_HALF_BIT) ? 2 : 0);
+            if (!units || (levels[h] != (h == 0)) || (count + units > sizeof(halves))) {
+                return false;
+            }
+            while (units--) {
+                halves[count++] = levels[h];
+            }
+        }
+    }
+    if (count == sizeof(halves) - 1) {
+        halves[count++] = 0;
+    }
+    if (count != sizeof(halves)) {
+        return false;
+    }
+
+    uint16_t value = 0;
+    for (size_t i = 0; i < RC5_BITS; i++) {
+        if (halves[2 * i] == halves[2 * i + 1]) {
+            return false;
+        }
+        value = (value << 1) | halves[2 * i + 1];
+    }
+    if (!(value & (1 << (RC5_BITS - 1)))) {
+        return false;
+    }
+    bits[0] = value & 0xff;
+    bits[1] = value >> 8;
+    frame->protocol = APP_IR_PROTO_RC5;
+    frame->nbits = RC5_BITS;
+    frame->data = bits;
+    return true;
+}
+
+static size_t ir_frame_symbols(const ir_frame_t *frame, rmt_symbol_word_t *dst)
+{
+    size_t n = 0;
+
+#define IR_PUT(mark, space) do { \
+        if (dst) { \
+            dst[n] = (rmt_symbol_word_t) {.level0 = 1, .duration0 = (mark), .level1 = 0, .duration1 = (space)}; \
+        } \
+        n++; \
+    } while (0)
+
+    switch (frame->protocol) {
+    case APP_IR_PROTO_NEC:
+    case APP_IR_PROTO_PULSE_DISTANCE: {
+        const bool nec = (APP_IR_PROTO_NEC == frame->protocol);
+        IR_PUT(nec ? NEC_HEADER_MARK : frame->header_mark, nec ? NEC_HEADER_SPACE : frame->header_space);
+        for (size_t i = 0; i < frame->nbits; i++) {
+            const bool one = frame->data[i / 8] & (1 << (i % 8));
+            IR_PUT(nec ? NEC_BIT_MARK : frame->bit_mark,
+                   one ? (nec ? NEC_ONE_SPACE : frame->one_space) : (nec ? NEC_ZERO_SPACE : frame->zero_space));
+        }
+        IR_PUT(nec ? NEC_BIT_MARK : frame->trail_mark, 0);
+        break;
+    }
+    case APP_IR_PROTO_RC5: {
+        const uint16_t value = frame->data[0] | (frame->data[1] << 8);
+        uint32_t runs[2 * RC5_BITS];
+        size_t num_runs = 0;
+        int level = 0;
+        /* Half bit levels without the leading space, merged into alternating mark and space runs */
+        for (size_t h = 1; h < 2 * RC5_BITS; h++) {
+            const int bit = (value >> (RC5_BITS - 1 - h / 2)) & 1;
+            const int half = (h % 2) ? bit : !bit;
+            if (num_runs && (half == level)) {
+                runs[num_runs - 1] += RC5_HALF_BIT;
+            } else {
+                runs[num_runs++] = RC5_HALF_BIT;
+                level = half;
+            }
+        }
+        for (size_t i = 0; i < num_runs; i += 2) {
+            IR_PUT(runs[i], (i + 1 < num_runs) ? runs[i + 1] : 0);
+        }
+        break;
+    }
+    default:
+        for (size_t i = 0; i < frame->nbits; i++) {
+            if (dst) {
+                dst[n].val = frame->data[4 * i] | (frame->data[4 * i + 1] << 8) | (frame->data[4 * i + 2] << 16) |
+                             ((uint32_t)frame->data[4 * i + 3] << 24);
+            }
+            n++;
+        }
+        break;
+    }
+#undef IR_PUT
+    return n;
+}
+
+static uint8_t *ir_frame_write(uint8_t *p, const ir_frame_t *frame)
+{
+    p = ir_write(p, frame->protocol, 1);
+    p = ir_write(p, frame->gap_us, 4);
+    switch (frame->protocol) {
+    case APP_IR_PROTO_NEC:
+        memcpy(p, frame->data, NEC_BITS / 8);
+        return p + NEC_BITS / 8;
+    case APP_IR_PROTO_RC5:
+        memcpy(p, frame->data, 2);
+        return p + 2;
+    case APP_IR_PROTO_PULSE_DISTANCE:
+        p = ir_write(p, frame->header_mark, 2);
+        p = ir_write(p, frame->header_space, 2);
+        p = ir_write(p, frame->bit_mark, 2);
+        p = ir_write(p, frame->zero_space, 2);
+        p = ir_write(p, frame->one_space, 2);
+        p = ir_write(p, frame->trail_mark, 2);
+        p = ir_write(p, frame->nbits, 2);
+        memcpy(p, frame->data, (frame->nbits + 7) / 8);
+        return p + (frame->nbits + 7) / 8;
+    default:
+        p = ir_write(p, frame->nbits, 2);
+        memcpy(p, frame->data, frame->nbits * sizeof(uint32_t));
+        return p + frame->nbits * sizeof(uint32_t);
+    }
+}
+
+static bool ir_frame_read(ir_reader_t *r, ir_frame_t *frame)
+{
+    memset(frame, 0, sizeof(ir_frame_t));
+    frame->protocol = ir_read(r, 1);
+    frame->gap_us = ir_read(r, 4);
+    switch (frame->protocol) {
+    case APP_IR_PROTO_NEC:
+        frame->nbits = NEC_BITS;
+        frame->data = ir_read_bytes(r, NEC_BITS / 8);
+        break;
+    case APP_IR_PROTO_RC5:
+        frame->nbits = RC5_BITS;
+        frame->data = ir_read_bytes(r, 2);
+        break;
+    case APP_IR_PROTO_PULSE_DISTANCE:
+        frame->header_mark = ir_read(r, 2);
+        frame->header_space = ir_read(r, 2);
+        frame->bit_mark = ir_read(r, 2);
+        frame->zero_space = ir_read(r, 2);
+        frame->one_space = ir_read(r, 2);
+        frame->trail_mark = ir_read(r, 2);
+        frame->nbits = ir_read(r, 2);
+        r->ok = r->ok && (frame->nbits <= IR_CODE_MAX_BITS);
+        frame->data = ir_read_bytes(r, (frame->nbits + 7) / 8);
+        break;
+    case APP_IR_PROTO_RAW:
+        frame->nbits = ir_read(r, 2);
+        frame->data = ir_read_bytes(r, frame->nbits * sizeof(uint32_t));
+        break;
+    default:
+        r->ok = false;
+        break;
+    }
+    return r->ok;
+}
+
+static bool ir_code_open(const uint8_t *code, size_t size, ir_reader_t *r, size_t *num_frames)
+{
+    *r = (ir_reader_t) {
+        .p = code, .left = size, .ok = (NULL != code),
+    };
+    const uint8_t magic0 = ir_read(r, 1);
+    const uint8_t magic1 = ir_read(r, 1);
+    const uint8_t version = ir_read(r, 1);
+    *num_frames = ir_read(r, 1);
+    return r->ok && (IR_CODE_MAGIC0 == magic0) && (IR_CODE_MAGIC1 == magic1) && (IR_CODE_VERSION == version);
+}
+
+esp_err_t app_ir_code_encode(const app_ir_tx_frame_t *frames, size_t num_frames, uint8_t **ret_code, size_t *ret_size)
+{
+    ESP_RETURN_ON_FALSE(frames && num_frames && (num_frames <= IR_CODE_MAX_FRAMES) && ret_code && ret_size,
+                        ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    /* Upper bound, raw symbols are the largest form of a frame */
+    size_t bound = IR_CODE_HEADER_SIZE;
+    for (size_t i = 0; i < num_frames; i++) {
+        ESP_RETURN_ON_FALSE(frames[i].symbols || !frames[i].num_symbols, ESP_ERR_INVALID_ARG, TAG, "invalid frame");
+        ESP_RETURN_ON_FALSE(frames[i].num_symbols <= UINT16_MAX, ESP_ERR_INVALID_ARG, TAG, "frame too long");
+        bound += 1 + 4 + sizeof(uint16_t) + frames[i].num_symbols * sizeof(uint32_t);
+    }
+    uint8_t *code = malloc(bound);
+    ESP_RETURN_ON_FALSE(code, ESP_ERR_NO_MEM, TAG, "no mem for code");
+
+    uint8_t *p = code;
+    *p++ = IR_CODE_MAGIC0;
+    *p++ = IR_CODE_MAGIC1;
+    *p++ = IR_CODE_VERSION;
+    *p++ = num_frames;
+    uint8_t bits[IR_CODE_MAX_BITS / 8];
+    for (size_t i = 0; i < num_frames; i++) {
+        const size_t n = ir_frame_length(frames[i].symbols, frames[i].num_symbols);
+        ir_frame_t frame = {
+            .gap_us = (i > 0) ? frames[i].gap_us : 0,
+        };
+        /* RC5 first, its exact 14 bits can also read as a pulse distance frame of 889 us marks */
+        if (!ir_decode_rc5(frames[i].symbols, n, &frame, bits) &&
+                !ir_decode_pulse_distance(frames[i].symbols, n, &frame, bits)) {
+            frame.protocol = APP_IR_PROTO_RAW;
+            frame.nbits = n;
+            frame.data = (const uint8_t *)frames[i].symbols;
+        }
+        ESP_LOGD(TAG, "frame %u: protocol %d, %u bits", i, frame.protocol, frame.nbits);
+        p = ir_frame_write(p, &frame);
+    }
+
+    /* Give back the unused part of the bound, the code stays valid if it cannot be shrunk */
+    *ret_size = p - code;
+    uint8_t *shrunk = realloc(code, *ret_size);
+    *ret_code = shrunk ? shrunk : code;
+    return ESP_OK;
+}
+
+esp_err_t app_ir_code_encode_learned(const struct ir_learn_sub_list_head *cmd_list, uint8_t **ret_code, size_t *ret_size)
+{
+    ESP_RETURN_ON_FALSE(cmd_list, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    size_t num_frames = 0;
+    ir_learn_sub_list_t *sub_it;
+    SLIST_FOREACH(sub_it, cmd_list, next) {
+        num_frames++;
+    }
+    ESP_RETURN_ON_FALSE(num_frames, ESP_ERR_INVALID_ARG, TAG, "empty command");
+
+    app_ir_tx_frame_t *frames = calloc(num_frames, sizeof(app_ir_tx_frame_t));
+    ESP_RETURN_ON_FALSE(frames, ESP_ERR_NO_MEM, TAG, "no mem for frames");
+    size_t i = 0;
+    SLIST_FOREACH(sub_it, cmd_list, next) {
+        frames[i].symbols = sub_it->symbols.received_symbols;
+        frames[i].num_symbols = sub_it->symbols.num_symbols;
+        frames[i].gap_us = sub_it->timediff;
+        i++;
+    }
+    esp_err_t ret = app_ir_code_encode(frames, num_frames, ret_code, ret_size);
+    free(frames);
+    return ret;
+}
+
+esp_err_t app_ir_code_decode(const uint8_t *code, size_t size, app_ir_tx_frame_t **ret_frames, size_t *ret_num_frames)
+{
+    ESP_RETURN_ON_FALSE(code && ret_frames && ret_num_frames, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    ir_reader_t r;
+    ir_frame_t frame;
+    size_t num_frames;
+    size_t num_symbols = 0;
+    ESP_RETURN_ON_FALSE(ir_code_open(code, size, &r, &num_frames) && num_frames, ESP_ERR_INVALID_CRC, TAG, "bad code");
+    for (size_t i = 0; i < num_frames; i++) {
+        ESP_RETURN_ON_FALSE(ir_frame_read(&r, &frame), ESP_ERR_INVALID_CRC, TAG, "bad frame %u", i);
+        num_symbols += ir_frame_symbols(&frame, NULL);
+    }
+
+    app_ir_tx_frame_t *frames = malloc(num_frames * sizeof(app_ir_tx_frame_t) + num_symbols * sizeof(rmt_symbol_word_t));
+    ESP_RETURN_ON_FALSE(frames, ESP_ERR_NO_MEM, TAG, "no mem for %u symbols", num_symbols);
+    rmt_symbol_word_t *symbols = (rmt_symbol_word_t *)(frames + num_frames);
+    ir_code_open(code, size, &r, &num_frames);
+    for (size_t i = 0; i < num_frames; i++) {
+        ir_frame_read(&r, &frame);
+        frames[i].symbols = symbols;
+        frames[i].num_symbols = ir_frame_symbols(&frame, symbols);
+        frames[i].gap_us = frame.gap_us;
+        symbols += frames[i].num_symbols;
+    }
+    *ret_frames = frames;
+    *ret_num_frames = num_frames;
+    return ESP_OK;
+}
+
+app_ir_proto_t app_ir_code_get_protocol(const uint8_t *code, size_t size, size_t frame_index, uint16_t *ret_bits)
+{
+    ir_reader_t r;
+    ir_frame_t frame;
+    size_t num_frames;
+
+    if (!ir_code_open(code, size, &r, &num_frames) || (frame_index >= num_frames)) {
+        return APP_IR_PROTO_RAW;
+    }
+    for (size_t i = 0; i <= frame_index; i++) {
+        if (!ir_frame_read(&r, &frame)) {
+            return APP_IR_PROTO_RAW;
+        }
+    }
+    if (ret_bits) {
+        *ret_bits = frame.nbits;
+    }
+    return frame.protocol;
+}
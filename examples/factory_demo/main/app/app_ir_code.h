@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "app_ir_tx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Compact IR codes
+ *
+ * Each frame of a learned command is recognized as NEC, RC5 or a pulse distance frame (one header followed by bits of
+ * equal marks and two space lengths, as sent by most air conditioners) and stored as its bits and timings. Frames of
+ * another kind are kept as raw symbols. A two frame AC command takes about 60 bytes instead of 2 KB of symbols.
+ */
+typedef enum {
+    APP_IR_PROTO_RAW = 0,
+    APP_IR_PROTO_NEC,
+    APP_IR_PROTO_RC5,
+    APP_IR_PROTO_PULSE_DISTANCE,
+} app_ir_proto_t;
+
+/**
+ * @brief Encode the frames of a command into a compact code
+ *
+ * @param frames: Frames at 1 us resolution, marks on level 1
+ * @param num_frames: Number of frames
+ * @param ret_code: Output code, free with free()
+ * @param ret_size: Output code size
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t app_ir_code_encode(const app_ir_tx_frame_t *frames, size_t num_frames, uint8_t **ret_code, size_t *ret_size);
+
+/**
+ * @brief Encode a command learned by ir_learn
+ *
+ * @param cmd_list: Learned frames
+ * @param ret_code: Output code, free with free()
+ * @param ret_size: Output code size
+ *
+ * @return Same as app_ir_code_encode
+ */
+esp_err_t app_ir_code_encode_learned(const struct ir_learn_sub_list_head *cmd_list, uint8_t **ret_code, size_t *ret_size);
+
+/**
+ * @brief Decode a code into frames for `app_ir_tx_send`
+ *
+ * @param code: Code
+ * @param size: Code size
+ * @param ret_frames: Output frames and their symbols in one allocation, free with free()
+ * @param ret_num_frames: Output number of frames
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_CRC: Malformed code
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t app_ir_code_decode(const uint8_t *code, size_t size, app_ir_tx_frame_t **ret_frames, size_t *ret_num_frames);
+
+/**
+ * @brief Get the protocol of a frame of a code
+ *
+ * @param code: Code
+ * @param size: Code size
+ * @param frame: Frame index
+ * @param ret_bits: Output number of bits, symbols for raw frames, may be NULL
+ *
+ * @return Protocol, APP_IR_PROTO_RAW if the frame does not exist
+ */
+app_ir_proto_t app_ir_code_get_protocol(const uint8_t *code, size_t size, size_t frame, uint16_t *ret_bits);
+
+#ifdef __cplusplus
+}
+#endif
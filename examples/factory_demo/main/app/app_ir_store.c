@@ -0,0 +1,191 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_check.h"
+#include "nvs.h"
+#include "app_ir_code.h"
+#include "app_ir_tx.h"
+#include "app_ir_store.h"
+
+#define IR_STORE_NAMESPACE      "ir_codes"
+#define IR_STORE_PROBES         4           /* Keys tried when two names hash to the same key */
+#define IR_STORE_NAME_MAX       32
+
+static const char *TAG = "app_ir_store";
+
+static nvs_handle_t s_nvs = 0;
+
+static uint32_t ir_store_hash(const char *device, const char *command)
+{
+    uint32_t hash = 2166136261u;
+    for (const char *p = device; *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+    hash = (hash ^ 0xff) * 16777619u;
+    for (const char *p = command; *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Blob of a command: device name, command name, then the code
+ */
+static bool ir_store_names_match(const uint8_t *blob, size_t size, const char *device, const char *command,
+                                 size_t *code_offset)
+{
+    const size_t device_len = strlen(device);
+    const size_t command_len = strlen(command);
+    const size_t offset = 2 + device_len + command_len;
+
+    if ((size < offset) || (blob[0] != device_len) || memcmp(blob + 1, device, device_len) ||
+            (blob[1 + device_len] != command_len) || memcmp(blob + 2 + device_len, command, command_len)) {
+        return false;
+    }
+    *code_offset = offset;
+    return true;
+}
+
+/**
+ * @brief Find the key of a command, or the first free key of its probe sequence
+ */
+static esp_err_t ir_store_find(const char *device, const char *command, char *key, uint8_t **ret_blob,
+                               size_t *ret_size, size_t *ret_offset)
+{
+    const uint32_t hash = ir_store_hash(device, command);
+    char free_key[NVS_KEY_NAME_MAX_SIZE] = {0};
+
+    for (int probe = 0; probe < IR_STORE_PROBES; probe++) {
+        char probe_key[NVS_KEY_NAME_MAX_SIZE];
+        size_t size = 0;
+        snprintf(probe_key, sizeof(probe_key), "%08" PRIx32 "_%d", hash, probe);
+        if (ESP_OK != nvs_get_blob(s_nvs, probe_key, NULL, &size)) {
+            if (!free_key[0]) {
+                strcpy(free_key, probe_key);
+            }
+            continue;
+        }
+        uint8_t *blob = malloc(size);
+        ESP_RETURN_ON_FALSE(blob, ESP_ERR_NO_MEM, TAG, "no mem for %u bytes code", size);
+        size_t offset;
+        if ((ESP_OK == nvs_get_blob(s_nvs, probe_key, blob, &size)) &&
+                ir_store_names_match(blob, size, device, command, &offset)) {
+            strcpy(key, probe_key);
+            if (ret_blob) {
+                *ret_blob = blob;
+                *ret_size = size;
+                *ret_offset = offset;
+            } else {
+                free(blob);
+            }
+            return ESP_OK;
+        }
+        free(blob);
+    }
+    strcpy(key, free_key);
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t app_ir_store_init(void)
+{
+    if (s_nvs) {
+        return ESP_OK;
+    }
+    ESP_RETURN_ON_ERROR(nvs_open(IR_STORE_NAMESPACE, NVS_READWRITE, &s_nvs), TAG, "open nvs failed");
+    return ESP_OK;
+}
+
+esp_err_t app_ir_store_save_learned(const char *device, const char *command, const struct ir_learn_sub_list_head *cmd_list)
+{
+    esp_err_t ret = ESP_OK;
+    char key[NVS_KEY_NAME_MAX_SIZE] = {0};
+    uint8_t *code = NULL;
+    uint8_t *blob = NULL;
+    size_t code_size;
+
+    ESP_RETURN_ON_FALSE(device && command && cmd_list && (strlen(device) < IR_STORE_NAME_MAX) &&
+                        (strlen(command) < IR_STORE_NAME_MAX), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(s_nvs, ESP_ERR_INVALID_STATE, TAG, "store not open");
+
+    /* The key of the command, or a free one if it is new */
+    ret = ir_store_find(device, command, key, NULL, NULL, NULL);
+    ESP_RETURN_ON_FALSE((ESP_OK == ret) || (ESP_ERR_NOT_FOUND == ret), ret, TAG, "look up %s/%s failed", device, command);
+    ESP_RETURN_ON_FALSE(key[0], ESP_ERR_NO_MEM, TAG, "no free key for %s/%s", device, command);
+    ret = ESP_OK;
+    ESP_RETURN_ON_ERROR(app_ir_code_encode_learned(cmd_list, &code, &code_size), TAG, "encode failed");
+
+    const size_t device_len = strlen(device);
+    const size_t command_len = strlen(command);
+    const size_t size = 2 + device_len + command_len + code_size;
+    blob = malloc(size);
+    ESP_GOTO_ON_FALSE(blob, ESP_ERR_NO_MEM, exit, TAG, "no mem for blob");
+    blob[0] = device_len;
+    memcpy(blob + 1, device, device_len);
+    blob[1 + device_len] = command_len;
+    memcpy(blob + 2 + device_len, command, command_len);
+    memcpy(blob + 2 + device_len + command_len, code, code_size);
+
+    ESP_GOTO_ON_ERROR(nvs_set_blob(s_nvs, key, blob, size), exit, TAG, "write %s failed", key);
+    ESP_GOTO_ON_ERROR(nvs_commit(s_nvs), exit, TAG, "commit failed");
+
+    uint16_t bits = 0;
+    app_ir_proto_t protocol = app_ir_code_get_protocol(code, code_size, 0, &bits);
+    ESP_LOGI(TAG, "saved %s/%s: %u bytes, first frame protocol %d, %u bits", device, command, size, protocol, bits);
+
+exit:
+    free(blob);
+    free(code);
+    return ret;
+}
+
+bool app_ir_store_exists(const char *device, const char *command)
+{
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    return s_nvs && device && command && (ESP_OK == ir_store_find(device, command, key, NULL, NULL, NULL));
+}
+
+esp_err_t app_ir_store_send(const char *device, const char *command, TickType_t ticks_to_wait)
+{
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    uint8_t *blob = NULL;
+    size_t size;
+    size_t offset;
+    app_ir_tx_frame_t *frames = NULL;
+    size_t num_frames;
+
+    ESP_RETURN_ON_FALSE(device && command, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(s_nvs, ESP_ERR_INVALID_STATE, TAG, "store not open");
+
+    esp_err_t ret = ir_store_find(device, command, key, &blob, &size, &offset);
+    ESP_RETURN_ON_FALSE(ESP_OK == ret, ret, TAG, "%s/%s not stored", device, command);
+    ESP_GOTO_ON_ERROR(app_ir_code_decode(blob + offset, size - offset, &frames, &num_frames), exit, TAG, "decode failed");
+    ret = app_ir_tx_send(frames, num_frames, ticks_to_wait);
+
+exit:
+    free(frames);
+    free(blob);
+    return ret;
+}
+
+esp_err_t app_ir_store_erase(const char *device, const char *command)
+{
+    char key[NVS_KEY_NAME_MAX_SIZE];
+
+    ESP_RETURN_ON_FALSE(device && command, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(s_nvs, ESP_ERR_INVALID_STATE, TAG, "store not open");
+
+    esp_err_t ret = ir_store_find(device, command, key, NULL, NULL, NULL);
+    if (ESP_OK != ret) {
+        return ret;
+    }
+    ESP_RETURN_ON_ERROR(nvs_erase_key(s_nvs, key), TAG, "erase %s failed", key);
+    return nvs_commit(s_nvs);
+}
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "ir_learn.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Learned IR commands in NVS, one compact code per device and command
+ *
+ * The key of a command is a hash of its device and command names, so a lookup is one NVS read whatever the number of
+ * appliances. Nothing is loaded at boot.
+ */
+
+/**
+ * @brief Open the IR code store in NVS
+ *
+ * @return
+ *    - ESP_OK: Success, or already open
+ *    - Others: Fail
+ */
+esp_err_t app_ir_store_init(void);
+
+/**
+ * @brief Save a learned command, replaces the code of the same device and command
+ *
+ * @param device: Device name, e.g. "ac"
+ * @param command: Command name, e.g. "power_on"
+ * @param cmd_list: Learned frames
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Store not open
+ *    - Others: Fail
+ */
+esp_err_t app_ir_store_save_learned(const char *device, const char *command, const struct ir_learn_sub_list_head *cmd_list);
+
+/**
+ * @brief Check if a command is stored
+ *
+ * @param device: Device name
+ * @param command: Command name
+ *
+ * @return true if stored
+ */
+bool app_ir_store_exists(const char *device, const char *command);
+
+/**
+ * @brief Send a stored command through `app_ir_tx_send`
+ *
+ * @param device: Device name
+ * @param command: Command name
+ * @param ticks_to_wait: Time to wait for room in the transmit queue
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_NOT_FOUND: Not stored
+ *    - Others: Fail
+ */
+esp_err_t app_ir_store_send(const char *device, const char *command, TickType_t ticks_to_wait);
+
+/**
+ * @brief Erase a stored command
+ *
+ * @param device: Device name
+ * @param command: Command name
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_NOT_FOUND: Not stored
+ *    - Others: Fail
+ */
+esp_err_t app_ir_store_erase(const char *device, const char *command);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,241 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "driver/gpio.h"
+#include "bsp_board.h"
+#include "driver/rmt_tx.h"
+#include "ir_encoder.h"
+#include "app_ir_tx.h"
+
+#define IR_TX_RESOLUTION_HZ     1000000     // 1MHz resolution, 1 tick = 1us
+#define IR_TX_QUEUE_LEN         4
+#define IR_TX_TASK_STACK        (3 * 1024)
+#define IR_TX_TASK_PRIORITY     10
+#define IR_TX_TASK_CORE         1
+#define IR_TX_MAX_DURATION      0x7fff      // 15 bits per half symbol
+
+static const char *TAG = "app_ir_tx";
+
+typedef struct {
+    rmt_symbol_word_t *symbols;
+    size_t num_symbols;
+    int64_t queued_us;
+} ir_tx_cmd_t;
+
+static QueueHandle_t s_cmd_queue = NULL;
+static rmt_channel_handle_t s_tx_channel = NULL;
+static rmt_encoder_handle_t s_encoder = NULL;
+static app_ir_tx_stats_t s_stats;
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static void ir_tx_task(void *arg)
+{
+    const rmt_transmit_config_t transmit_config = {
+        .loop_count = 0,
+        .flags.eot_level = 0,
+    };
+    ir_tx_cmd_t cmd;
+
+    while (1) {
+        if (pdPASS != xQueueReceive(s_cmd_queue, &cmd, portMAX_DELAY)) {
+            continue;
+        }
+        /* The ir_learn encoder takes the number of symbols as payload size */
+        esp_err_t ret = rmt_transmit(s_tx_channel, s_encoder, cmd.symbols, cmd.num_symbols, &transmit_config);
+        int64_t start = esp_timer_get_time();
+        if (ESP_OK == ret) {
+            rmt_tx_wait_all_done(s_tx_channel, -1);
+        } else {
+            ESP_LOGE(TAG, "transmit failed: %s", esp_err_to_name(ret));
+        }
+        int64_t end = esp_timer_get_time();
+        free(cmd.symbols);
+
+        portENTER_CRITICAL(&s_stats_lock);
+        s_stats.commands++;
+        s_stats.last_latency_us = start - cmd.queued_us;
+        s_stats.max_latency_us = MAX(s_stats.max_latency_us, s_stats.last_latency_us);
+        s_stats.last_duration_us = end - start;
+        portEXIT_CRITICAL(&s_stats_lock);
+        ESP_LOGI(TAG, "IR command: %u symbols, latency %" PRIu32 " us, %" PRIu32 " us on air", cmd.num_symbols,
+                 (uint32_t)(start - cmd.queued_us), (uint32_t)(end - start));
+    }
+}
+
+esp_err_t app_ir_tx_start(void)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (s_cmd_queue) {
+        return ESP_OK;
+    }
+
+    const gpio_config_t io_conf = {
+        .pin_bit_mask = BIT64(BSP_IR_CTRL_GPIO),
+        .mode = GPIO_MODE_OUTPUT,
+        .pull_up_en = true,
+    };
+    gpio_config(&io_conf);
+    gpio_set_level(BSP_IR_CTRL_GPIO, 0); // enable IR TX
+
+    const rmt_tx_channel_config_t tx_channel_cfg = {
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = IR_TX_RESOLUTION_HZ,
+        .mem_block_symbols = 128,
+        .trans_queue_depth = 4,
+        .gpio_num = BSP_IR_TX_GPIO,
+    };
+    ESP_RETURN_ON_ERROR(rmt_new_tx_channel(&tx_channel_cfg, &s_tx_channel), TAG, "create RMT TX channel failed");
+
+    const rmt_carrier_config_t carrier_cfg = {
+        .duty_cycle = 0.33,
+        .frequency_hz = 38000, // 38KHz
+    };
+    ESP_GOTO_ON_ERROR(rmt_apply_carrier(s_tx_channel, &carrier_cfg), err, TAG, "apply carrier failed");
+
+    const ir_encoder_config_t encoder_cfg = {
+        .resolution = IR_TX_RESOLUTION_HZ,
+    };
+    ESP_GOTO_ON_ERROR(ir_encoder_new(&encoder_cfg, &s_encoder), err, TAG, "create IR encoder failed");
+    ESP_GOTO_ON_ERROR(rmt_enable(s_tx_channel), err, TAG, "enable RMT TX channel failed");
+
+    s_cmd_queue = xQueueCreate(IR_TX_QUEUE_LEN, sizeof(ir_tx_cmd_t));
+    ESP_GOTO_ON_FALSE(s_cmd_queue, ESP_ERR_NO_MEM, err_disable, TAG, "create command queue failed");
+    BaseType_t ret_val = xTaskCreatePinnedToCore(ir_tx_task, "ir_tx_task", IR_TX_TASK_STACK, NULL,
+                                                 IR_TX_TASK_PRIORITY, NULL, IR_TX_TASK_CORE);
+    ESP_GOTO_ON_FALSE(pdPASS == ret_val, ESP_ERR_NO_MEM, err_queue, TAG, "create IR TX task failed");
+    return ESP_OK;
+
+err_queue:
+    vQueueDelete(s_cmd_queue);
+    s_cmd_queue = NULL;
+err_disable:
+    rmt_disable(s_tx_channel);
+err:
+    if (s_encoder) {
+        rmt_del_encoder(s_encoder);
+        s_encoder = NULL;
+    }
+    rmt_del_channel(s_tx_channel);
+    s_tx_channel = NULL;
+    return ret;
+}
+
+static size_t ir_tx_gap_symbols(uint32_t gap_us)
+{
+    return (gap_us + 2 * IR_TX_MAX_DURATION - 1) / (2 * IR_TX_MAX_DURATION);
+}
+
+/**
+ * @brief Idle (carrier off) symbols of gap_us, both halves non-zero as a zero duration ends the transmission
+ */
+static rmt_symbol_word_t *ir_tx_put_gap(rmt_symbol_word_t *dst, uint32_t gap_us)
+{
+    while (gap_us) {
+        uint32_t part = MIN(gap_us, 2 * IR_TX_MAX_DURATION);
+        part = MAX(part, 2);
+        *dst++ = (rmt_symbol_word_t) {
+            .level0 = 0,
+            .duration0 = (part + 1) / 2,
+            .level1 = 0,
+            .duration1 = part / 2,
+        };
+        gap_us -= MIN(gap_us, part);
+    }
+    return dst;
+}
+
+esp_err_t app_ir_tx_send(const app_ir_tx_frame_t *frames, size_t num_frames, TickType_t ticks_to_wait)
+{
+    ESP_RETURN_ON_FALSE(frames && num_frames, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(s_cmd_queue, ESP_ERR_INVALID_STATE, TAG, "IR TX not started");
+
+    ir_tx_cmd_t cmd = {
+        .queued_us = esp_timer_get_time(),
+    };
+    size_t total = 0;
+    for (size_t i = 0; i < num_frames; i++) {
+        total += frames[i].num_symbols + ((i > 0) ? ir_tx_gap_symbols(frames[i].gap_us) : 0);
+    }
+    ESP_RETURN_ON_FALSE(total, ESP_ERR_INVALID_ARG, TAG, "no symbols");
+    cmd.symbols = heap_caps_malloc(total * sizeof(rmt_symbol_word_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_RETURN_ON_FALSE(cmd.symbols, ESP_ERR_NO_MEM, TAG, "no mem for %u symbols", total);
+
+    rmt_symbol_word_t *dst = cmd.symbols;
+    for (size_t i = 0; i < num_frames; i++) {
+        if (i > 0) {
+            dst = ir_tx_put_gap(dst, frames[i].gap_us);
+        }
+        for (size_t j = 0; j < frames[i].num_symbols; j++) {
+            rmt_symbol_word_t symbol = frames[i].symbols[j];
+            /* Received frames end with a zero duration, which would stop the sequence here */
+            if (0 == symbol.duration0) {
+                break;
+            }
+            if (0 == symbol.duration1) {
+                symbol.level1 = 0;
+                symbol.duration1 = 1;
+            }
+            *dst++ = symbol;
+        }
+    }
+    cmd.num_symbols = dst - cmd.symbols;
+
+    if (pdPASS != xQueueSend(s_cmd_queue, &cmd, ticks_to_wait)) {
+        free(cmd.symbols);
+        portENTER_CRITICAL(&s_stats_lock);
+        s_stats.dropped++;
+        portEXIT_CRITICAL(&s_stats_lock);
+        ESP_LOGW(TAG, "IR command queue full");
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+esp_err_t app_ir_tx_send_learned(const struct ir_learn_sub_list_head *cmd_list, TickType_t ticks_to_wait)
+{
+    ESP_RETURN_ON_FALSE(cmd_list, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    size_t num_frames = 0;
+    ir_learn_sub_list_t *sub_it;
+    SLIST_FOREACH(sub_it, cmd_list, next) {
+        num_frames++;
+    }
+    ESP_RETURN_ON_FALSE(num_frames, ESP_ERR_INVALID_ARG, TAG, "empty command");
+
+    app_ir_tx_frame_t *frames = calloc(num_frames, sizeof(app_ir_tx_frame_t));
+    ESP_RETURN_ON_FALSE(frames, ESP_ERR_NO_MEM, TAG, "no mem for frames");
+    size_t i = 0;
+    SLIST_FOREACH(sub_it, cmd_list, next) {
+        frames[i].symbols = sub_it->symbols.received_symbols;
+        frames[i].num_symbols = sub_it->symbols.num_symbols;
+        frames[i].gap_us = sub_it->timediff;
+        i++;
+    }
+    esp_err_t ret = app_ir_tx_send(frames, num_frames, ticks_to_wait);
+    free(frames);
+    return ret;
+}
+
+esp_err_t app_ir_tx_get_stats(app_ir_tx_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    portENTER_CRITICAL(&s_stats_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_stats_lock);
+    return ESP_OK;
+}
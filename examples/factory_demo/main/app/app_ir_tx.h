@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "driver/rmt_tx.h"
+#include "ir_learn.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One IR frame of a command
+ */
+typedef struct {
+    const rmt_symbol_word_t *symbols;   /*!< Symbols at 1 us resolution */
+    size_t num_symbols;                 /*!< Number of symbols */
+    uint32_t gap_us;                    /*!< Idle time before this frame, ignored for the first frame */
+} app_ir_tx_frame_t;
+
+typedef struct {
+    uint32_t commands;                  /*!< Commands sent */
+    uint32_t dropped;                   /*!< Commands not queued, the queue was full */
+    uint32_t last_latency_us;           /*!< From app_ir_tx_send to the start of the IR output */
+    uint32_t max_latency_us;            /*!< Largest latency so far */
+    uint32_t last_duration_us;          /*!< Time on air of the last command, gaps included */
+} app_ir_tx_stats_t;
+
+/**
+ * @brief Start the IR transmitter, the RMT channel and encoder stay enabled from now on
+ *
+ * @return
+ *    - ESP_OK: Success, or already started
+ *    - Others: Fail
+ */
+esp_err_t app_ir_tx_start(void);
+
+/**
+ * @brief Queue a command of several frames
+ *
+ * The frames are copied into one symbol sequence where the gaps are idle symbols, so the RMT times the whole command
+ * in hardware. The caller may free the frames when this function returns.
+ *
+ * @param frames: Frames of the command
+ * @param num_frames: Number of frames
+ * @param ticks_to_wait: Time to wait for room in the queue
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Not started
+ *    - ESP_ERR_NO_MEM: Out of memory
+ *    - ESP_ERR_TIMEOUT: Queue full
+ */
+esp_err_t app_ir_tx_send(const app_ir_tx_frame_t *frames, size_t num_frames, TickType_t ticks_to_wait);
+
+/**
+ * @brief Queue a command learned by ir_learn, the time diff of each node is the gap before its frame
+ *
+ * @param cmd_list: Learned frames
+ * @param ticks_to_wait: Time to wait for room in the queue
+ *
+ * @return Same as app_ir_tx_send
+ */
+esp_err_t app_ir_tx_send_learned(const struct ir_learn_sub_list_head *cmd_list, TickType_t ticks_to_wait);
+
+/**
+ * @brief Get the transmitter statistics
+ *
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ */
+esp_err_t app_ir_tx_get_stats(app_ir_tx_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -17,7 +17,10 @@
 #include "esp_check.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "app_sr.h"
+#include "sr_trace.h"
 
 #include "esp_mn_speech_commands.h"
 #include "esp_process_sdkconfig.h"
@@ -36,17 +39,29 @@
 
 static const char *TAG = "app_sr";
 
+/**
+ * @brief Models and commands of a language, kept resident once loaded
+ */
 typedef struct {
     sr_language_t lang;
+    char *wn_name;
     char *mn_name;
     model_iface_data_t *model_data;
     const esp_mn_iface_t *multinet;
+    sr_cmd_t *cmd_table;    /* Commands of the language, the id of a command is its index */
+    uint8_t cmd_num;
+    sr_model_stats_t stats;
+} sr_model_t;
+
+typedef struct {
+    sr_model_t model[SR_LANG_MAX];
+    sr_model_t *active;     /* Model run by the detect task, only changed by it between two AFE chunks */
+    sr_model_t *target;     /* Model of the requested language, the command functions work on it */
+    int64_t switch_request_us;
     const esp_afe_sr_iface_t *afe_handle;
     esp_afe_sr_data_t *afe_data;
     int16_t *afe_in_buffer;
     int16_t *afe_out_buffer;
-    SLIST_HEAD(sr_cmd_list_t, sr_cmd_t) cmd_list;
-    uint8_t cmd_num;
     TaskHandle_t feed_task;
     TaskHandle_t detect_task;
     TaskHandle_t handle_task;
@@ -62,58 +77,75 @@ static srmodel_list_t *models = NULL;
 
 static sr_data_t *g_sr_data = NULL;
 
+static void sr_model_swap(void);
+
 #define I2S_CHANNEL_NUM     (2)
 #define NEED_DELETE BIT0
 #define FEED_DELETED BIT1
 #define DETECT_DELETED BIT2
 
 /**
- * @brief all default commands
+ * @brief default commands of each language
  */
-static const sr_cmd_t g_default_cmd_info[] = {
-    // English
-    {SR_CMD_LIGHT_ON, SR_LANG_EN, 0, "Turn On the Light", "TkN nN jc LiT", {NULL}},
-    {SR_CMD_LIGHT_ON, SR_LANG_EN, 0, "Switch On the Light", "SWgp nN jc LiT", {NULL}},
-    {SR_CMD_LIGHT_OFF, SR_LANG_EN, 0, "Switch Off the Light", "SWgp eF jc LiT", {NULL}},
-    {SR_CMD_LIGHT_OFF, SR_LANG_EN, 0, "Turn Off the Light", "TkN eF jc LiT", {NULL}},
-    {SR_CMD_SET_RED, SR_LANG_EN, 0, "Turn Red", "TkN RfD", {NULL}},
-    {SR_CMD_SET_GREEN, SR_LANG_EN, 0, "Turn Green", "TkN GRmN", {NULL}},
-    {SR_CMD_SET_BLUE, SR_LANG_EN, 0, "Turn Blue", "TkN BLo", {NULL}},
-    {SR_CMD_CUSTOMIZE_COLOR, SR_LANG_EN, 0, "Customize Color", "KcSTcMiZ KcLk", {NULL}},
-    {SR_CMD_PLAY, SR_LANG_EN, 0, "Sing a song", "Sgl c Sel", {NULL}},
-    {SR_CMD_PLAY, SR_LANG_EN, 0, "Play Music", "PLd MYoZgK", {NULL}},
-    {SR_CMD_NEXT, SR_LANG_EN, 0, "Next Song", "NfKST Sel", {NULL}},
-    {SR_CMD_PAUSE, SR_LANG_EN, 0, "Pause Playing", "PeZ PLdgl", {NULL}},
-
-    {SR_CMD_AC_ON, SR_LANG_EN, 0, "Turn on the Air", "TkN nN jc fR", {NULL}},
-    {SR_CMD_AC_OFF, SR_LANG_EN, 0, "Turn off the Air", "TkN eF jc fR", {NULL}},
-
-    // Chinese
-    {SR_CMD_LIGHT_ON, SR_LANG_CN, 0, "打开电灯", "da kai dian deng", {NULL}},
-    {SR_CMD_LIGHT_OFF, SR_LANG_CN, 0, "关闭电灯", "guan bi dian deng", {NULL}},
-    {SR_CMD_SET_RED, SR_LANG_CN, 0, "调成红色", "tiao cheng hong se", {NULL}},
-    {SR_CMD_SET_GREEN, SR_LANG_CN, 0, "调成绿色", "tiao cheng lv se", {NULL}},
-    {SR_CMD_SET_BLUE, SR_LANG_CN, 0, "调成蓝色", "tiao cheng lan se", {NULL}},
-    {SR_CMD_CUSTOMIZE_COLOR, SR_LANG_CN, 0, "自定义颜色", "zi ding yi yan se", {NULL}},
-    {SR_CMD_PLAY, SR_LANG_CN, 0, "播放音乐", "bo fang yin yue", {NULL}},
-    {SR_CMD_NEXT, SR_LANG_CN, 0, "切歌", "qie ge", {NULL}},
-    {SR_CMD_NEXT, SR_LANG_CN, 0, "下一曲", "xia yi qu", {NULL}},
-    {SR_CMD_PAUSE, SR_LANG_CN, 0, "暂停", "zan ting", {NULL}},
-    {SR_CMD_PAUSE, SR_LANG_CN, 0, "暂停播放", "zan ting bo fang", {NULL}},
-    {SR_CMD_PAUSE, SR_LANG_CN, 0, "停止播放", "ting zhi bo fang", {NULL}},
-
-    {SR_CMD_AC_ON, SR_LANG_CN, 0, "打开空调", "da kai kong tiao", {NULL}},
-    {SR_CMD_AC_OFF, SR_LANG_CN, 0, "关闭空调", "guan bi kong tiao", {NULL}},
-    {SR_CMD_MAX, SR_LANG_CN, 0, "舒适模式", "shu shi mo shi", {NULL}},
-    {SR_CMD_MAX, SR_LANG_CN, 0, "制冷模式", "zhi leng mo shi", {NULL}},
-    {SR_CMD_MAX, SR_LANG_CN, 0, "制热模式", "zhi re mo shi", {NULL}},
-    {SR_CMD_MAX, SR_LANG_CN, 0, "加热模式", "jia re mo shi", {NULL}},
-    {SR_CMD_MAX, SR_LANG_CN, 0, "除湿模式", "chu shi mo shi", {NULL}},
-    {SR_CMD_MAX, SR_LANG_CN, 0, "送风模式", "song feng mo shi", {NULL}},
-    {SR_CMD_MAX, SR_LANG_CN, 0, "升高温度", "sheng gao wen du", {NULL}},
-    {SR_CMD_MAX, SR_LANG_CN, 0, "降低温度", "jiang di wen du", {NULL}},
+static const sr_cmd_t g_default_cmd_en[] = {
+    {SR_CMD_LIGHT_ON, SR_LANG_EN, 0, "Turn On the Light", "TkN nN jc LiT"},
+    {SR_CMD_LIGHT_ON, SR_LANG_EN, 0, "Switch On the Light", "SWgp nN jc LiT"},
+    {SR_CMD_LIGHT_OFF, SR_LANG_EN, 0, "Switch Off the Light", "SWgp eF jc LiT"},
+    {SR_CMD_LIGHT_OFF, SR_LANG_EN, 0, "Turn Off the Light", "TkN eF jc LiT"},
+    {SR_CMD_SET_RED, SR_LANG_EN, 0, "Turn Red", "TkN RfD"},
+    {SR_CMD_SET_GREEN, SR_LANG_EN, 0, "Turn Green", "TkN GRmN"},
+    {SR_CMD_SET_BLUE, SR_LANG_EN, 0, "Turn Blue", "TkN BLo"},
+    {SR_CMD_CUSTOMIZE_COLOR, SR_LANG_EN, 0, "Customize Color", "KcSTcMiZ KcLk"},
+    {SR_CMD_PLAY, SR_LANG_EN, 0, "Sing a song", "Sgl c Sel"},
+    {SR_CMD_PLAY, SR_LANG_EN, 0, "Play Music", "PLd MYoZgK"},
+    {SR_CMD_NEXT, SR_LANG_EN, 0, "Next Song", "NfKST Sel"},
+    {SR_CMD_PAUSE, SR_LANG_EN, 0, "Pause Playing", "PeZ PLdgl"},
+
+    {SR_CMD_AC_ON, SR_LANG_EN, 0, "Turn on the Air", "TkN nN jc fR"},
+    {SR_CMD_AC_OFF, SR_LANG_EN, 0, "Turn off the Air", "TkN eF jc fR"},
+};
+
+static const sr_cmd_t g_default_cmd_cn[] = {
+    {SR_CMD_LIGHT_ON, SR_LANG_CN, 0, "打开电灯", "da kai dian deng"},
+    {SR_CMD_LIGHT_OFF, SR_LANG_CN, 0, "关闭电灯", "guan bi dian deng"},
+    {SR_CMD_SET_RED, SR_LANG_CN, 0, "调成红色", "tiao cheng hong se"},
+    {SR_CMD_SET_GREEN, SR_LANG_CN, 0, "调成绿色", "tiao cheng lv se"},
+    {SR_CMD_SET_BLUE, SR_LANG_CN, 0, "调成蓝色", "tiao cheng lan se"},
+    {SR_CMD_CUSTOMIZE_COLOR, SR_LANG_CN, 0, "自定义颜色", "zi ding yi yan se"},
+    {SR_CMD_PLAY, SR_LANG_CN, 0, "播放音乐", "bo fang yin yue"},
+    {SR_CMD_NEXT, SR_LANG_CN, 0, "切歌", "qie ge"},
+    {SR_CMD_NEXT, SR_LANG_CN, 0, "下一曲", "xia yi qu"},
+    {SR_CMD_PAUSE, SR_LANG_CN, 0, "暂停", "zan ting"},
+    {SR_CMD_PAUSE, SR_LANG_CN, 0, "暂停播放", "zan ting bo fang"},
+    {SR_CMD_PAUSE, SR_LANG_CN, 0, "停止播放", "ting zhi bo fang"},
+
+    {SR_CMD_AC_ON, SR_LANG_CN, 0, "打开空调", "da kai kong tiao"},
+    {SR_CMD_AC_OFF, SR_LANG_CN, 0, "关闭空调", "guan bi kong tiao"},
+    {SR_CMD_MAX, SR_LANG_CN, 0, "舒适模式", "shu shi mo shi"},
+    {SR_CMD_MAX, SR_LANG_CN, 0, "制冷模式", "zhi leng mo shi"},
+    {SR_CMD_MAX, SR_LANG_CN, 0, "制热模式", "zhi re mo shi"},
+    {SR_CMD_MAX, SR_LANG_CN, 0, "加热模式", "jia re mo shi"},
+    {SR_CMD_MAX, SR_LANG_CN, 0, "除湿模式", "chu shi mo shi"},
+    {SR_CMD_MAX, SR_LANG_CN, 0, "送风模式", "song feng mo shi"},
+    {SR_CMD_MAX, SR_LANG_CN, 0, "升高温度", "sheng gao wen du"},
+    {SR_CMD_MAX, SR_LANG_CN, 0, "降低温度", "jiang di wen du"},
+};
+
+static const struct {
+    const sr_cmd_t *cmds;
+    size_t num;
+} g_default_cmds[SR_LANG_MAX] = {
+    [SR_LANG_EN] = {g_default_cmd_en, sizeof(g_default_cmd_en) / sizeof(sr_cmd_t)},
+    [SR_LANG_CN] = {g_default_cmd_cn, sizeof(g_default_cmd_cn) / sizeof(sr_cmd_t)},
 };
 
+static void sr_result_send(sr_result_t *result)
+{
+    result->trace_stamp = sr_trace_begin(SR_TRACE_RESULT_QUEUE);
+    bool sent = (pdPASS == xQueueSend(g_sr_data->result_que, result, 0));
+    sr_trace_queue_send(sent, uxQueueMessagesWaiting(g_sr_data->result_que));
+}
+
 static void audio_feed_task(void *arg)
 {
     size_t bytes_read = 0;
@@ -151,7 +183,9 @@ static void audio_feed_task(void *arg)
         }
 
         /* Read audio data from I2S bus */
+        uint32_t stamp = sr_trace_begin(SR_TRACE_I2S_READ);
         bsp_i2s_read((char *)audio_buffer, audio_chunksize * I2S_CHANNEL_NUM * sizeof(int16_t), &bytes_read, portMAX_DELAY);
+        sr_trace_end(SR_TRACE_I2S_READ, stamp);
 
         /* Save audio data to file if record enabled */
         if (g_sr_data->b_record_en && (NULL != g_sr_data->fp)) {
@@ -165,7 +199,9 @@ static void audio_feed_task(void *arg)
             audio_buffer[i * 3 + 0] = audio_buffer[i * 2 + 0];
         }
         /* Feed samples of an audio stream to the AFE_SR */
+        stamp = sr_trace_begin(SR_TRACE_AFE_FEED);
         afe_handle->feed(afe_data, audio_buffer);
+        sr_trace_end(SR_TRACE_AFE_FEED, stamp);
     }
 }
 
@@ -176,7 +212,7 @@ static void audio_detect_task(void *arg)
     int afe_chunksize = afe_handle->get_fetch_chunksize(afe_data);
     //int nch = afe_handle->get_channel_num(afe_data);
 
-    int mu_chunksize = g_sr_data->multinet->get_samp_chunksize(g_sr_data->model_data);
+    int mu_chunksize = g_sr_data->active->multinet->get_samp_chunksize(g_sr_data->active->model_data);
     assert(mu_chunksize == afe_chunksize);
     ESP_LOGI(TAG, "------------detect start------------\n");
 
@@ -187,7 +223,18 @@ static void audio_detect_task(void *arg)
             vTaskDelete(NULL);
         }
 
+        if (g_sr_data->target != g_sr_data->active) {
+            sr_model_swap();
+            if (detect_flag) {
+                g_sr_data->afe_handle->enable_wakenet(afe_data);
+                detect_flag = false;
+            }
+        }
+        sr_model_t *model = g_sr_data->active;
+
+        uint32_t stamp = sr_trace_begin(SR_TRACE_AFE_FETCH);
         afe_fetch_result_t *res = afe_handle->fetch(afe_data);
+        sr_trace_end(SR_TRACE_AFE_FETCH, stamp);
         if (!res || res->ret_value == ESP_FAIL) {
             continue;
         }
@@ -198,8 +245,9 @@ static void audio_detect_task(void *arg)
                 .wakenet_mode = WAKENET_DETECTED,
                 .state = ESP_MN_STATE_DETECTING,
                 .command_id = 0,
+                .lang = model->lang,
             };
-            xQueueSend(g_sr_data->result_que, &result, 0);
+            sr_result_send(&result);
         } else if (res->wakeup_state == WAKENET_CHANNEL_VERIFIED) {
             detect_flag = true;
             g_sr_data->afe_handle->disable_wakenet(afe_data);
@@ -214,7 +262,9 @@ static void audio_detect_task(void *arg)
 
             esp_mn_state_t mn_state = ESP_MN_STATE_DETECTING;
             if (false == sr_echo_is_playing()) {
-                mn_state = g_sr_data->multinet->detect(g_sr_data->model_data, res->data);
+                stamp = sr_trace_begin(SR_TRACE_MN_DETECT);
+                mn_state = model->multinet->detect(model->model_data, res->data);
+                sr_trace_end(SR_TRACE_MN_DETECT, stamp);
             } else {
                 continue;
             }
@@ -229,28 +279,34 @@ static void audio_detect_task(void *arg)
                     .wakenet_mode = WAKENET_NO_DETECT,
                     .state = mn_state,
                     .command_id = 0,
+                    .lang = model->lang,
                 };
-                xQueueSend(g_sr_data->result_que, &result, 0);
+                sr_result_send(&result);
                 g_sr_data->afe_handle->enable_wakenet(afe_data);
                 detect_flag = false;
                 continue;
             }
 
             if (ESP_MN_STATE_DETECTED == mn_state) {
-                esp_mn_results_t *mn_result = g_sr_data->multinet->get_results(g_sr_data->model_data);
+                esp_mn_results_t *mn_result = model->multinet->get_results(model->model_data);
                 for (int i = 0; i < mn_result->num; i++) {
                     printf("TOP %d, command_id: %d, phrase_id: %d, prob: %f\n",
                            i + 1, mn_result->command_id[i], mn_result->phrase_id[i], mn_result->prob[i]);
                 }
 
+                if (model != g_sr_data->target) {
+                    ESP_LOGW(TAG, "Language switched, drop command");
+                    continue;
+                }
                 int sr_command_id = mn_result->command_id[0];
                 ESP_LOGI(TAG, "Deteted command : %d", sr_command_id);
                 sr_result_t result = {
                     .wakenet_mode = WAKENET_NO_DETECT,
                     .state = mn_state,
                     .command_id = sr_command_id,
+                    .lang = model->lang,
                 };
-                xQueueSend(g_sr_data->result_que, &result, 0);
+                sr_result_send(&result);
 #if !SR_CONTINUE_DET
                 g_sr_data->afe_handle->enable_wakenet(afe_data);
                 detect_flag = false;
@@ -270,55 +326,155 @@ static void audio_detect_task(void *arg)
     vTaskDelete(NULL);
 }
 
+static char *sr_cmd_text(const sr_model_t *model, const sr_cmd_t *cmd)
+{
+    return (char *)(strstr(model->mn_name, "mn6_en") ? cmd->str : cmd->phoneme);
+}
+
+static esp_err_t sr_model_add_cmds(sr_model_t *model, const sr_cmd_t *cmds, size_t num)
+{
+    ESP_RETURN_ON_FALSE(NULL != cmds || 0 == num, ESP_ERR_INVALID_ARG, TAG, "pointer of cmd is invaild");
+    for (size_t i = 0; i < num; i++) {
+        ESP_RETURN_ON_FALSE(cmds[i].lang == model->lang, ESP_ERR_INVALID_ARG, TAG, "cmd lang error");
+    }
+
+    /* Add what fits, a full table drops the rest of the batch only */
+    const size_t room = ESP_MN_MAX_PHRASE_NUM - model->cmd_num;
+    for (size_t i = 0; (i < num) && (i < room); i++) {
+        sr_cmd_t *item = &model->cmd_table[model->cmd_num];
+        memcpy(item, &cmds[i], sizeof(sr_cmd_t));
+        item->id = model->cmd_num;
+        esp_mn_commands_add(item->id, sr_cmd_text(model, item));
+        model->cmd_num++;
+    }
+    ESP_RETURN_ON_FALSE(num <= room, ESP_ERR_INVALID_SIZE, TAG, "cmd is full, %u of %u cmds dropped", num - room, num);
+    return ESP_OK;
+}
+
+static void sr_model_update_cmds(sr_model_t *model)
+{
+    for (uint32_t i = 0; i < model->cmd_num; i++) {
+        model->cmd_table[i].id = i;
+    }
+
+    esp_mn_error_t *err_id = esp_mn_commands_update(model->multinet, model->model_data);
+    if (err_id) {
+        for (int i = 0; i < err_id->num; i++) {
+            ESP_LOGE(TAG, "err cmd id:%d", err_id->phrases[i]);
+        }
+    }
+    esp_mn_commands_print();
+}
+
+static esp_err_t sr_model_set_cmds(sr_model_t *model, const sr_cmd_t *cmds, size_t num)
+{
+    ESP_RETURN_ON_FALSE(ESP_MN_MAX_PHRASE_NUM >= num, ESP_ERR_INVALID_STATE, TAG, "cmd is full");
+
+    model->cmd_num = 0;
+    if (strstr(model->mn_name, "mn6")) {
+        esp_mn_commands_clear();
+    }
+    ESP_RETURN_ON_ERROR(sr_model_add_cmds(model, cmds, num), TAG, "add cmds failed");
+    sr_model_update_cmds(model);
+    return ESP_OK;
+}
+
+/**
+ * @brief Point the speech commands list back to the commands of a resident model, they are already in the model
+ */
+static void sr_model_sync_cmds(const sr_model_t *model)
+{
+    esp_mn_commands_clear();
+    for (uint32_t i = 0; i < model->cmd_num; i++) {
+        esp_mn_commands_add(i, sr_cmd_text(model, &model->cmd_table[i]));
+    }
+}
+
+static esp_err_t sr_model_load(sr_language_t lang)
+{
+    sr_model_t *model = &g_sr_data->model[lang];
+    int64_t start = esp_timer_get_time();
+    size_t psram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    size_t internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+
+    model->lang = lang;
+    model->wn_name = esp_srmodel_filter(models, ESP_WN_PREFIX, (SR_LANG_EN == lang ? "hiesp" : "hilexin"));
+    ESP_RETURN_ON_FALSE(NULL != model->wn_name, ESP_ERR_INVALID_ARG, TAG, "Modifications to the code are required to support the relevant configuration");
+    model->mn_name = esp_srmodel_filter(models, ESP_MN_PREFIX, ((SR_LANG_EN == lang) ? ESP_MN_ENGLISH : ESP_MN_CHINESE));
+    ESP_RETURN_ON_FALSE(NULL != model->mn_name, ESP_ERR_INVALID_ARG, TAG, "Modifications to the code are required to support the relevant configuration");
+
+    if (NULL == model->cmd_table) {
+        model->cmd_table = heap_caps_calloc(ESP_MN_MAX_PHRASE_NUM, sizeof(sr_cmd_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        ESP_RETURN_ON_FALSE(NULL != model->cmd_table, ESP_ERR_NO_MEM, TAG, "Failed create command table");
+    }
+    model->multinet = esp_mn_handle_from_name(model->mn_name);
+    model->model_data = model->multinet->create(model->mn_name, 5760);
+    ESP_RETURN_ON_FALSE(NULL != model->model_data, ESP_ERR_NO_MEM, TAG, "Failed create multinet %s", model->mn_name);
+    ESP_LOGI(TAG, "load multinet:%s", model->mn_name);
+
+    ESP_LOGI(TAG, "cmd_number=%u", g_default_cmds[lang].num);
+    ESP_RETURN_ON_ERROR(sr_model_set_cmds(model, g_default_cmds[lang].cmds, g_default_cmds[lang].num), TAG, "Failed set commands");
+
+    size_t psram_used = psram_free - heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    size_t internal_used = internal_free - heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    model->stats.resident = true;
+    model->stats.psram_bytes = (psram_used <= psram_free) ? psram_used : 0;
+    model->stats.internal_bytes = (internal_used <= internal_free) ? internal_used : 0;
+    model->stats.load_us = esp_timer_get_time() - start;
+    ESP_LOGI(TAG, "%s resident: %u KB PSRAM, %u KB internal, loaded in %u ms", model->mn_name,
+             model->stats.psram_bytes / 1024, model->stats.internal_bytes / 1024, model->stats.load_us / 1000);
+    return ESP_OK;
+}
+
+/**
+ * @brief Make the requested model the active one, runs on the detect task between two AFE chunks
+ */
+static void sr_model_swap(void)
+{
+    sr_model_t *model = g_sr_data->target;
+
+    g_sr_data->afe_handle->set_wakenet(g_sr_data->afe_data, model->wn_name);
+    ESP_LOGI(TAG, "load wakenet:%s", model->wn_name);
+    g_sr_data->active = model;
+    model->stats.switch_us = esp_timer_get_time() - g_sr_data->switch_request_us;
+    ESP_LOGI(TAG, "Language %s active in %u ms", SR_LANG_EN == model->lang ? "EN" : "CN", model->stats.switch_us / 1000);
+}
+
 esp_err_t app_sr_set_language(sr_language_t new_lang)
 {
     ESP_RETURN_ON_FALSE(NULL != g_sr_data, ESP_ERR_INVALID_STATE, TAG, "SR is not running");
+    ESP_RETURN_ON_FALSE(new_lang < SR_LANG_MAX, ESP_ERR_INVALID_ARG, TAG, "language invalid");
 
-    if (new_lang == g_sr_data->lang) {
+    if (g_sr_data->target && (new_lang == g_sr_data->target->lang)) {
         ESP_LOGW(TAG, "nothing to do");
         return ESP_OK;
-    } else {
-        g_sr_data->lang = new_lang;
     }
 
-    ESP_LOGW(TAG, "Set language to %s", SR_LANG_EN == g_sr_data->lang ? "EN" : "CN");
-    if (g_sr_data->model_data) {
-        g_sr_data->multinet->destroy(g_sr_data->model_data);
+    ESP_LOGW(TAG, "Set language to %s", SR_LANG_EN == new_lang ? "EN" : "CN");
+    int64_t start = esp_timer_get_time();
+    sr_model_t *model = &g_sr_data->model[new_lang];
+    if (model->model_data) {
+        sr_model_sync_cmds(model);
+    } else {
+        ESP_RETURN_ON_ERROR(sr_model_load(new_lang), TAG, "Failed load models");
     }
 
-    g_sr_data->cmd_num = 0;
-
-    char *wn_name = esp_srmodel_filter(models, ESP_WN_PREFIX, (SR_LANG_EN == g_sr_data->lang ? "hiesp" : "hilexin"));
-    ESP_RETURN_ON_FALSE(NULL != wn_name, ESP_ERR_INVALID_ARG, TAG, "Modifications to the code are required to support the relevant configuration");
-    g_sr_data->afe_handle->set_wakenet(g_sr_data->afe_data, wn_name);
-    ESP_LOGI(TAG, "load wakenet:%s", wn_name);
-
-    char *mn_name = esp_srmodel_filter(models, ESP_MN_PREFIX, ((SR_LANG_EN == g_sr_data->lang) ? ESP_MN_ENGLISH : ESP_MN_CHINESE));
-    ESP_RETURN_ON_FALSE(NULL != mn_name, ESP_ERR_INVALID_ARG, TAG, "Modifications to the code are required to support the relevant configuration");
-    esp_mn_iface_t *multinet = esp_mn_handle_from_name(mn_name);
-    model_iface_data_t *model_data = multinet->create(mn_name, 5760);
-    g_sr_data->multinet = multinet;
-    g_sr_data->model_data = model_data;
-    g_sr_data->mn_name = mn_name;
-    ESP_LOGI(TAG, "load multinet:%s", g_sr_data->mn_name);
-
-    // remove all command
-    app_sr_remove_all_cmd();
-    if (strstr(g_sr_data->mn_name, "mn6")) {
-        esp_mn_commands_clear();
+    /* The detect task swaps to the target before its next chunk */
+    g_sr_data->switch_request_us = start;
+    g_sr_data->target = model;
+    if (NULL == g_sr_data->detect_task) {
+        sr_model_swap();
     }
+    return ESP_OK;
+}
 
-    uint8_t cmd_number = 0;
-    // count command number
-    for (size_t i = 0; i < sizeof(g_default_cmd_info) / sizeof(sr_cmd_t); i++) {
-        if (g_default_cmd_info[i].lang == g_sr_data->lang) {
-            app_sr_add_cmd(&g_default_cmd_info[i]);
-            cmd_number++;
-        }
-    }
-    ESP_LOGI(TAG, "cmd_number=%d", cmd_number);
+esp_err_t app_sr_get_model_stats(sr_language_t lang, sr_model_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(NULL != g_sr_data, ESP_ERR_INVALID_STATE, TAG, "SR is not running");
+    ESP_RETURN_ON_FALSE((lang < SR_LANG_MAX) && (NULL != stats), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
 
-    return app_sr_update_cmds();/* Reset command list */
+    *stats = g_sr_data->model[lang].stats;
+    return ESP_OK;
 }
 
 esp_err_t app_sr_start(bool record_en)
@@ -335,8 +491,6 @@ esp_err_t app_sr_start(bool record_en)
     g_sr_data->event_group = xEventGroupCreate();
     ESP_GOTO_ON_FALSE(NULL != g_sr_data->event_group, ESP_ERR_NO_MEM, err, TAG, "Failed create event_group");
 
-    SLIST_INIT(&g_sr_data->cmd_list);
-
     /* Create file if record to SD card enabled*/
     g_sr_data->b_record_en = record_en;
     if (record_en) {
@@ -368,7 +522,6 @@ esp_err_t app_sr_start(bool record_en)
     g_sr_data->afe_data = afe_data;
 
     sys_param_t *param = settings_get_parameter();
-    g_sr_data->lang = SR_LANG_MAX;
     ret = app_sr_set_language(param->sr_lang);
     ESP_GOTO_ON_FALSE(ESP_OK == ret, ESP_FAIL, err, TAG,  "Failed to set language");
 
@@ -413,21 +566,20 @@ esp_err_t app_sr_stop(void)
         g_sr_data->fp = NULL;
     }
 
-    if (g_sr_data->model_data) {
-        g_sr_data->multinet->destroy(g_sr_data->model_data);
+    for (size_t i = 0; i < SR_LANG_MAX; i++) {
+        sr_model_t *model = &g_sr_data->model[i];
+        if (model->model_data) {
+            model->multinet->destroy(model->model_data);
+        }
+        if (model->cmd_table) {
+            heap_caps_free(model->cmd_table);
+        }
     }
 
     if (g_sr_data->afe_data) {
         g_sr_data->afe_handle->destroy(g_sr_data->afe_data);
     }
 
-    sr_cmd_t *it;
-    while (!SLIST_EMPTY(&g_sr_data->cmd_list)) {
-        it = SLIST_FIRST(&g_sr_data->cmd_list);
-        SLIST_REMOVE_HEAD(&g_sr_data->cmd_list, next);
-        heap_caps_free(it);
-    }
-
     if (g_sr_data->afe_in_buffer) {
         heap_caps_free(g_sr_data->afe_in_buffer);
     }
@@ -449,131 +601,78 @@ esp_err_t app_sr_get_result(sr_result_t *result, TickType_t xTicksToWait)
     return ESP_OK;
 }
 
+
 esp_err_t app_sr_add_cmd(const sr_cmd_t *cmd)
+{
+    return app_sr_add_cmds(cmd, 1);
+}
+
+esp_err_t app_sr_add_cmds(const sr_cmd_t *cmds, size_t num)
 {
     ESP_RETURN_ON_FALSE(NULL != g_sr_data, ESP_ERR_INVALID_STATE, TAG, "SR is not running");
-    ESP_RETURN_ON_FALSE(NULL != cmd, ESP_ERR_INVALID_ARG, TAG, "pointer of cmd is invaild");
-    ESP_RETURN_ON_FALSE(cmd->lang == g_sr_data->lang, ESP_ERR_INVALID_ARG, TAG, "cmd lang error");
-    ESP_RETURN_ON_FALSE(ESP_MN_MAX_PHRASE_NUM >= g_sr_data->cmd_num, ESP_ERR_INVALID_STATE, TAG, "cmd is full");
-
-    sr_cmd_t *item = (sr_cmd_t *)heap_caps_calloc(1, sizeof(sr_cmd_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    ESP_RETURN_ON_FALSE(NULL != item, ESP_ERR_NO_MEM, TAG, "memory for sr cmd is not enough");
-    memcpy(item, cmd, sizeof(sr_cmd_t));
-    item->next.sle_next = NULL;
-#if 1 // insert after
-    sr_cmd_t *last = SLIST_FIRST(&g_sr_data->cmd_list);
-    if (last == NULL) {
-        SLIST_INSERT_HEAD(&g_sr_data->cmd_list, item, next);
-    } else {
-        sr_cmd_t *it;
-        while ((it = SLIST_NEXT(last, next)) != NULL) {
-            last = it;
-        }
-        SLIST_INSERT_AFTER(last, item, next);
-    }
-#else  // insert head
-    SLIST_INSERT_HEAD(&g_sr_data->cmd_list, it, next);
-#endif
+    return sr_model_add_cmds(g_sr_data->target, cmds, num);
+}
 
-    if (strstr(g_sr_data->mn_name, "mn6_en")) {
-        esp_mn_commands_add(g_sr_data->cmd_num, (char *)cmd->str);
-    } else {
-        esp_mn_commands_add(g_sr_data->cmd_num, (char *)cmd->phoneme);
-    }
-    g_sr_data->cmd_num++;
-    return ESP_OK;
+esp_err_t app_sr_set_cmds(const sr_cmd_t *cmds, size_t num)
+{
+    ESP_RETURN_ON_FALSE(NULL != g_sr_data, ESP_ERR_INVALID_STATE, TAG, "SR is not running");
+    return sr_model_set_cmds(g_sr_data->target, cmds, num);
 }
 
 esp_err_t app_sr_modify_cmd(uint32_t id, const sr_cmd_t *cmd)
 {
     ESP_RETURN_ON_FALSE(NULL != g_sr_data, ESP_ERR_INVALID_STATE, TAG, "SR is not running");
+    sr_model_t *model = g_sr_data->target;
     ESP_RETURN_ON_FALSE(NULL != cmd, ESP_ERR_INVALID_ARG, TAG, "pointer of cmd is invaild");
-    ESP_RETURN_ON_FALSE(id < g_sr_data->cmd_num, ESP_ERR_INVALID_ARG, TAG, "cmd id out of range");
-    ESP_RETURN_ON_FALSE(cmd->lang == g_sr_data->lang, ESP_ERR_INVALID_ARG, TAG, "cmd lang error");
-
-    sr_cmd_t *it;
-    SLIST_FOREACH(it, &g_sr_data->cmd_list, next) {
-        if (it->id == id) {
-            ESP_LOGI(TAG, "modify cmd [%d] from %s to %s", id, it->str, cmd->str);
-            if (strstr(g_sr_data->mn_name, "mn6_en")) {
-                esp_mn_commands_modify(it->str, (char *)cmd->str);
-            } else {
-                esp_mn_commands_modify(it->phoneme, (char *)cmd->phoneme);
-            }
-            memcpy(it, cmd, sizeof(sr_cmd_t));
-            break;
-        }
-    }
-    ESP_RETURN_ON_FALSE(NULL != it, ESP_ERR_NOT_FOUND, TAG, "can't find cmd id:%d", cmd->id);
+    ESP_RETURN_ON_FALSE(id < model->cmd_num, ESP_ERR_INVALID_ARG, TAG, "cmd id out of range");
+    ESP_RETURN_ON_FALSE(cmd->lang == model->lang, ESP_ERR_INVALID_ARG, TAG, "cmd lang error");
+
+    sr_cmd_t *it = &model->cmd_table[id];
+    ESP_LOGI(TAG, "modify cmd [%d] from %s to %s", id, it->str, cmd->str);
+    esp_mn_commands_modify(sr_cmd_text(model, it), sr_cmd_text(model, cmd));
+    memcpy(it, cmd, sizeof(sr_cmd_t));
+    it->id = id;
     return ESP_OK;
 }
 
 esp_err_t app_sr_remove_cmd(uint32_t id)
 {
     ESP_RETURN_ON_FALSE(NULL != g_sr_data, ESP_ERR_INVALID_STATE, TAG, "SR is not running");
-    ESP_RETURN_ON_FALSE(id < g_sr_data->cmd_num, ESP_ERR_INVALID_ARG, TAG, "cmd id out of range");
-    sr_cmd_t *it;
-    SLIST_FOREACH(it, &g_sr_data->cmd_list, next) {
-        if (it->id == id) {
-            ESP_LOGI(TAG, "remove cmd id [%d]", it->id);
-            SLIST_REMOVE(&g_sr_data->cmd_list, it, sr_cmd_t, next);
-            heap_caps_free(it);
-            g_sr_data->cmd_num--;
-            break;
-        }
-    }
-    ESP_RETURN_ON_FALSE(NULL != it, ESP_ERR_NOT_FOUND, TAG, "can't find cmd id:%d", id);
+    sr_model_t *model = g_sr_data->target;
+    ESP_RETURN_ON_FALSE(id < model->cmd_num, ESP_ERR_INVALID_ARG, TAG, "cmd id out of range");
+
+    ESP_LOGI(TAG, "remove cmd id [%d]", id);
+    model->cmd_num--;
+    memmove(&model->cmd_table[id], &model->cmd_table[id + 1], (model->cmd_num - id) * sizeof(sr_cmd_t));
     return ESP_OK;
 }
 
 esp_err_t app_sr_remove_all_cmd(void)
 {
     ESP_RETURN_ON_FALSE(NULL != g_sr_data, ESP_ERR_INVALID_STATE, TAG, "SR is not running");
-    sr_cmd_t *it;
-    while (!SLIST_EMPTY(&g_sr_data->cmd_list)) {
-        it = SLIST_FIRST(&g_sr_data->cmd_list);
-        SLIST_REMOVE_HEAD(&g_sr_data->cmd_list, next);
-        heap_caps_free(it);
-    }
-    SLIST_INIT(&g_sr_data->cmd_list);
+    g_sr_data->target->cmd_num = 0;
     return ESP_OK;
 }
 
 esp_err_t app_sr_update_cmds(void)
 {
     ESP_RETURN_ON_FALSE(NULL != g_sr_data, ESP_ERR_INVALID_STATE, TAG, "SR is not running");
-
-    uint32_t count = 0;
-    sr_cmd_t *it;
-    SLIST_FOREACH(it, &g_sr_data->cmd_list, next) {
-        it->id = count++;
-    }
-
-    esp_mn_error_t *err_id = esp_mn_commands_update(g_sr_data->multinet, g_sr_data->model_data);
-    if (err_id) {
-        for (int i = 0; i < err_id->num; i++) {
-            ESP_LOGE(TAG, "err cmd id:%d", err_id->phrases[i]);
-        }
-    }
-    esp_mn_commands_print();
-
+    sr_model_update_cmds(g_sr_data->target);
     return ESP_OK;
 }
 
 uint8_t app_sr_search_cmd_from_user_cmd(sr_user_cmd_t user_cmd, uint8_t *id_list, uint16_t max_len)
 {
     ESP_RETURN_ON_FALSE(NULL != g_sr_data, 0, TAG, "SR is not running");
+    const sr_model_t *model = g_sr_data->target;
 
     uint8_t cmd_num = 0;
-    sr_cmd_t *it;
-    SLIST_FOREACH(it, &g_sr_data->cmd_list, next) {
-        if (user_cmd == it->cmd) {
+    for (uint32_t i = 0; (i < model->cmd_num) && (cmd_num < max_len); i++) {
+        if (user_cmd == model->cmd_table[i].cmd) {
             if (id_list) {
-                id_list[cmd_num] = it->id;
-            }
-            if (++cmd_num >= max_len) {
-                break;
+                id_list[cmd_num] = i;
             }
+            cmd_num++;
         }
     }
     return cmd_num;
@@ -582,17 +681,15 @@ uint8_t app_sr_search_cmd_from_user_cmd(sr_user_cmd_t user_cmd, uint8_t *id_list
 uint8_t app_sr_search_cmd_from_phoneme(const char *phoneme, uint8_t *id_list, uint16_t max_len)
 {
     ESP_RETURN_ON_FALSE(NULL != g_sr_data, 0, TAG, "SR is not running");
+    const sr_model_t *model = g_sr_data->target;
 
     uint8_t cmd_num = 0;
-    sr_cmd_t *it;
-    SLIST_FOREACH(it, &g_sr_data->cmd_list, next) {
-        if (0 == strcmp(phoneme, it->phoneme)) {
+    for (uint32_t i = 0; (i < model->cmd_num) && (cmd_num < max_len); i++) {
+        if (0 == strcmp(phoneme, model->cmd_table[i].phoneme)) {
             if (id_list) {
-                id_list[cmd_num] = it->id;
-            }
-            if (++cmd_num >= max_len) {
-                break;
+                id_list[cmd_num] = i;
             }
+            cmd_num++;
         }
     }
     return cmd_num;
@@ -601,14 +698,19 @@ uint8_t app_sr_search_cmd_from_phoneme(const char *phoneme, uint8_t *id_list, ui
 const sr_cmd_t *app_sr_get_cmd_from_id(uint32_t id)
 {
     ESP_RETURN_ON_FALSE(NULL != g_sr_data, NULL, TAG, "SR is not running");
-    ESP_RETURN_ON_FALSE(id < g_sr_data->cmd_num, NULL, TAG, "cmd id out of range");
+    const sr_model_t *model = g_sr_data->target;
+    ESP_RETURN_ON_FALSE(id < model->cmd_num, NULL, TAG, "cmd id out of range");
 
-    sr_cmd_t *it;
-    SLIST_FOREACH(it, &g_sr_data->cmd_list, next) {
-        if (id == it->id) {
-            return it;
-        }
-    }
-    ESP_RETURN_ON_FALSE(NULL != it, NULL, TAG, "can't find cmd id:%d", id);
-    return NULL;
+    return &model->cmd_table[id];
+}
+
+const sr_cmd_t *app_sr_get_result_cmd(const sr_result_t *result)
+{
+    ESP_RETURN_ON_FALSE(NULL != g_sr_data, NULL, TAG, "SR is not running");
+    ESP_RETURN_ON_FALSE((NULL != result) && (result->lang < SR_LANG_MAX), NULL, TAG, "invalid argument");
+    const sr_model_t *model = &g_sr_data->model[result->lang];
+    ESP_RETURN_ON_FALSE((result->command_id >= 0) && (result->command_id < model->cmd_num), NULL, TAG,
+                        "cmd id %d out of range", result->command_id);
+
+    return &model->cmd_table[result->command_id];
 }
@@ -7,7 +7,7 @@
 #pragma once
 
 #include <stdbool.h>
-#include <sys/queue.h>
+#include <stddef.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_err.h"
@@ -30,10 +30,18 @@ extern "C" {
 #define SR_CMD_STR_LEN_MAX 64
 #define SR_CMD_PHONEME_LEN_MAX 64
 
+typedef enum {
+    SR_LANG_EN,
+    SR_LANG_CN,
+    SR_LANG_MAX,
+} sr_language_t;
+
 typedef struct {
     wakenet_state_t wakenet_mode;
     esp_mn_state_t state;
     int command_id;
+    sr_language_t lang;     /**< Language of the model which detected the command >*/
+    uint32_t trace_stamp;   /**< Queue stage timestamp of sr_trace >*/
 } sr_result_t;
 
 /**
@@ -55,30 +63,100 @@ typedef enum {
     SR_CMD_MAX,
 } sr_user_cmd_t;
 
-typedef enum {
-    SR_LANG_EN,
-    SR_LANG_CN,
-    SR_LANG_MAX,
-} sr_language_t;
-
 typedef struct sr_cmd_t {
     sr_user_cmd_t cmd;
     sr_language_t lang;
     uint32_t id;
     char str[SR_CMD_STR_LEN_MAX];
     char phoneme[SR_CMD_PHONEME_LEN_MAX];
-    SLIST_ENTRY(sr_cmd_t) next;
 } sr_cmd_t;
 
+typedef struct {
+    bool resident;              /*!< Models of the language are loaded */
+    size_t psram_bytes;         /*!< PSRAM taken by the multinet model and its commands */
+    size_t internal_bytes;      /*!< Internal RAM taken by the multinet model and its commands */
+    uint32_t load_us;           /*!< Time to create the model and apply its commands */
+    uint32_t switch_us;         /*!< Last switch to the language, from the request to its first AFE chunk */
+} sr_model_stats_t;
+
 esp_err_t app_sr_start(bool record_en);
 esp_err_t app_sr_stop(void);
 esp_err_t app_sr_get_result(sr_result_t *result, TickType_t xTicksToWait);
+
+/**
+ * @brief Switch the speech recognition language without stopping SR
+ *
+ * The models of a language are loaded on its first use and stay resident, so switching back costs no model
+ * creation. The detect task swaps to the new models between two AFE chunks; commands detected by the old models
+ * after this call are dropped.
+ *
+ * @param new_lang: Language to switch to
+ *
+ * @return
+ *    - ESP_OK: Success, the command functions already work on the new language
+ *    - ESP_ERR_INVALID_ARG: Language invalid or its models are not in the model partition
+ *    - ESP_ERR_INVALID_STATE: SR not running
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
 esp_err_t app_sr_set_language(sr_language_t new_lang);
+
+/**
+ * @brief Get the memory cost and switch latency of the models of a language
+ *
+ * @param lang: Language
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: SR not running
+ */
+esp_err_t app_sr_get_model_stats(sr_language_t lang, sr_model_stats_t *stats);
+
 esp_err_t app_sr_add_cmd(const sr_cmd_t *cmd);
+
+/**
+ * @brief Append several commands, `app_sr_update_cmds` still has to be called to apply them
+ *
+ * @param cmds: Commands of the current language
+ * @param num: Number of commands
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: A command is of another language, none is added
+ *    - ESP_ERR_INVALID_SIZE: The table is full, the commands which fit are added and the others dropped
+ *    - ESP_ERR_INVALID_STATE: SR not running
+ */
+esp_err_t app_sr_add_cmds(const sr_cmd_t *cmds, size_t num);
+
+/**
+ * @brief Replace all commands by a command set and apply it to the model in one update
+ *
+ * @param cmds: Commands of the current language, the id of cmds[i] becomes i
+ * @param num: Number of commands
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: A command is of another language
+ *    - ESP_ERR_INVALID_STATE: SR not running, or more commands than the table holds
+ */
+esp_err_t app_sr_set_cmds(const sr_cmd_t *cmds, size_t num);
 esp_err_t app_sr_modify_cmd(uint32_t id, const sr_cmd_t *cmd);
 esp_err_t app_sr_remove_cmd(uint32_t id);
 esp_err_t app_sr_remove_all_cmd(void);
 const sr_cmd_t *app_sr_get_cmd_from_id(uint32_t id);
+
+/**
+ * @brief Get the command of a detected result
+ *
+ * The result may be read after a language switch, its command id is looked up in the commands of the language
+ * which detected it.
+ *
+ * @param result: Result of app_sr_get_result with a detected command
+ *
+ * @return The command, NULL if SR is not running or the id is no longer in the table
+ */
+const sr_cmd_t *app_sr_get_result_cmd(const sr_result_t *result);
 uint8_t app_sr_search_cmd_from_user_cmd(sr_user_cmd_t user_cmd, uint8_t *id_list, uint16_t max_len);
 uint8_t app_sr_search_cmd_from_phoneme(const char *phoneme, uint8_t *id_list, uint16_t max_len);
 esp_err_t app_sr_update_cmds(void);
@@ -11,8 +11,11 @@
 #include "esp_check.h"
 #include "app_led.h"
 #include "app_sr.h"
-#include "file_manager.h"
+#include "sr_trace.h"
+#include "telemetry.h"
 #include "audio_player.h"
+#include "audio_playlist.h"
+#include "asset_pack.h"
 #include "file_iterator.h"
 #include "bsp_board.h"
 #include "bsp/esp-bsp.h"
@@ -35,49 +38,21 @@ typedef enum {
 } audio_segment_t;
 
 typedef struct {
-    uint8_t *audio_buffer;
-    size_t len;
+    const uint8_t *audio_buffer;
+    const asset_pack_entry_t *pcm;
 } audio_data_t;
 
 static audio_data_t g_audio_data[AUDIO_MAX];
 
 static esp_err_t sr_echo_play(audio_segment_t audio)
 {
-    typedef struct {
-        // The "RIFF" chunk descriptor
-        uint8_t ChunkID[4];
-        int32_t ChunkSize;
-        uint8_t Format[4];
-        // The "fmt" sub-chunk
-        uint8_t Subchunk1ID[4];
-        int32_t Subchunk1Size;
-        int16_t AudioFormat;
-        int16_t NumChannels;
-        int32_t SampleRate;
-        int32_t ByteRate;
-        int16_t BlockAlign;
-        int16_t BitsPerSample;
-        // The "data" sub-chunk
-        uint8_t Subchunk2ID[4];
-        int32_t Subchunk2Size;
-    } wav_header_t;
+    const asset_pack_entry_t *pcm = g_audio_data[audio].pcm;
 
-    /**
-     * read head of WAV file
-     */
-    uint8_t *p = g_audio_data[audio].audio_buffer;
-    wav_header_t *wav_head = (wav_header_t *)p;
-
-    if (NULL == strstr((char *)wav_head->Subchunk1ID, "fmt") &&
-            NULL == strstr((char *)wav_head->Subchunk2ID, "data")) {
-        ESP_LOGE(TAG, "Header of wav format error");
-        return ESP_FAIL;
-    }
-    p += sizeof(wav_header_t);
-    size_t len = g_audio_data[audio].len - sizeof(wav_header_t);
-    len = len & 0xfffffffc;
-    ESP_LOGD(TAG, "frame_rate=%d, ch=%d, width=%d", wav_head->SampleRate, wav_head->NumChannels, wav_head->BitsPerSample);
-    bsp_codec_set_fs(wav_head->SampleRate, wav_head->BitsPerSample, I2S_SLOT_MODE_STEREO);
+    /* Converted to raw PCM in the codec format at build time */
+    ESP_RETURN_ON_FALSE(g_audio_data[audio].audio_buffer, ESP_ERR_INVALID_STATE, TAG, "No echo loaded");
+    size_t len = pcm->size & 0xfffffffc;
+    ESP_LOGD(TAG, "frame_rate=%" PRIu32 ", ch=%d, width=%d", pcm->sample_rate, pcm->channels, pcm->format);
+    bsp_codec_set_fs(pcm->sample_rate, pcm->format, (2 == pcm->channels) ? I2S_SLOT_MODE_STEREO : I2S_SLOT_MODE_MONO);
 
     bsp_codec_mute_set(true);
     bsp_codec_mute_set(false);
@@ -86,7 +61,7 @@ static esp_err_t sr_echo_play(audio_segment_t audio)
     vTaskDelay(pdMS_TO_TICKS(50));
 
     b_audio_playing = true;
-    bsp_i2s_write((char *)p, len, &bytes_written, portMAX_DELAY);
+    bsp_i2s_write((char *)g_audio_data[audio].audio_buffer, len, &bytes_written, portMAX_DELAY);
     vTaskDelay(pdMS_TO_TICKS(20));
     b_audio_playing = false;
 
@@ -103,8 +78,6 @@ bool sr_echo_is_playing(void)
 sr_language_t sr_detect_language()
 {
     static sr_language_t sr_current_lang = SR_LANG_MAX;
-    esp_err_t ret;
-    FILE *fp = NULL;
     const sys_param_t *param = settings_get_parameter();
 
     if (param->sr_lang ^ sr_current_lang) {
@@ -112,39 +85,23 @@ sr_language_t sr_detect_language()
         ESP_LOGI(TAG, "boardcast language change to = %s", (SR_LANG_EN == param->sr_lang ? "EN" : "CN"));
 
         const char *files[2][3] = {
-            {"/spiffs/echo_en_wake.wav", "/spiffs/echo_en_ok.wav", "/spiffs/echo_en_end.wav"},
-            {"/spiffs/echo_cn_wake.wav", "/spiffs/echo_cn_ok.wav", "/spiffs/echo_cn_end.wav"},
+            {"echo_en_wake.wav", "echo_en_ok.wav", "echo_en_end.wav"},
+            {"echo_cn_wake.wav", "echo_cn_ok.wav", "echo_cn_end.wav"},
         };
 
-        char audio_file[48] = {0};
         for (size_t i = 0; i < AUDIO_MAX; i++) {
-            strncpy(audio_file, files[param->sr_lang][i], sizeof(audio_file));
-            fp = fopen(audio_file, "rb");
-            ESP_GOTO_ON_FALSE(NULL != fp, ESP_ERR_NOT_FOUND, err, TAG, "Open file %s failed", audio_file);
-            size_t file_size = fm_get_file_size(audio_file);
-
             if (g_audio_data[i].audio_buffer) {
-                heap_caps_free(g_audio_data[i].audio_buffer);
-                g_audio_data[i].len = 0;
+                asset_pack_free(g_audio_data[i].audio_buffer);
+                g_audio_data[i].audio_buffer = NULL;
+            }
+            if (ESP_OK != asset_pack_pcm_load(files[param->sr_lang][i], &g_audio_data[i].audio_buffer,
+                                              &g_audio_data[i].pcm)) {
+                ESP_LOGI(TAG, "Read audio failed");
+                break;
             }
-            g_audio_data[i].len = file_size;
-            g_audio_data[i].audio_buffer = heap_caps_calloc(1, file_size, MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM);
-            ESP_GOTO_ON_FALSE(NULL != g_audio_data[i].audio_buffer, ESP_ERR_NO_MEM, err, TAG,  "No mem for sr echo buffer");
-            fread(g_audio_data[i].audio_buffer, 1, file_size, fp);
-            fclose(fp);
         }
     }
     return sr_current_lang;
-
-err:
-    if (ESP_OK != ret) {
-        ESP_LOGI(TAG, "Read audio failed");
-    }
-
-    if (fp) {
-        fclose(fp);
-    }
-    return sr_current_lang;
 }
 
 void sr_handler_task(void *pvParam)
@@ -154,14 +111,21 @@ void sr_handler_task(void *pvParam)
 
     sr_language_t sr_current_lang;
     audio_player_state_t last_player_state = AUDIO_PLAYER_STATE_IDLE;
+    int wake_counter = -1, command_counter = -1, timeout_counter = -1;
+
+    telemetry_counter_register("sr_wake", &wake_counter);
+    telemetry_counter_register("sr_command", &command_counter);
+    telemetry_counter_register("sr_timeout", &timeout_counter);
 
     while (true) {
         sr_result_t result;
         app_sr_get_result(&result, portMAX_DELAY);
+        sr_trace_end(SR_TRACE_RESULT_QUEUE, result.trace_stamp);
 
         sr_current_lang = sr_detect_language();
 
         if (ESP_MN_STATE_TIMEOUT == result.state) {
+            telemetry_counter_add(timeout_counter, 1);
             if (SR_LANG_EN == sr_current_lang) {
                 sr_anim_set_text("Timeout");
             } else {
@@ -181,6 +145,7 @@ void sr_handler_task(void *pvParam)
         }
 
         if (WAKENET_DETECTED == result.wakenet_mode) {
+            telemetry_counter_add(wake_counter, 1);
             sr_anim_start();
             last_player_state = audio_player_get_state();
             audio_player_pause();
@@ -196,7 +161,11 @@ void sr_handler_task(void *pvParam)
         }
 
         if (ESP_MN_STATE_DETECTED & result.state) {
-            const sr_cmd_t *cmd = app_sr_get_cmd_from_id(result.command_id);
+            const sr_cmd_t *cmd = app_sr_get_result_cmd(&result);
+            if (NULL == cmd) {
+                continue;
+            }
+            telemetry_counter_add(command_counter, 1);
             ESP_LOGI(TAG, "command:%s, act:%d", cmd->str, cmd->cmd);
             sr_anim_set_text((char *) cmd->str);
 #if !SR_CONTINUE_DET
@@ -214,6 +183,7 @@ void sr_handler_task(void *pvParam)
             sr_echo_play(AUDIO_OK);
 #endif
 
+            uint32_t stamp = sr_trace_begin(SR_TRACE_ACTION);
             switch (cmd->cmd) {
             case SR_CMD_SET_RED:
                 app_pwm_led_set_all(128, 0, 0);
@@ -239,7 +209,7 @@ void sr_handler_task(void *pvParam)
             case SR_CMD_NEXT:
                 file_iterator_next(file_iterator);
                 file_iterator_get_full_path_from_index(file_iterator, file_iterator_get_index(file_iterator), filename, sizeof(filename));
-                fp = fopen(filename, "rb");
+                fp = audio_playlist_open(filename);
                 if (!fp) {
                     ESP_LOGE(TAG, "unable to open '%s'", filename);
                 } else {
@@ -251,7 +221,7 @@ void sr_handler_task(void *pvParam)
                 ESP_LOGD(TAG, "SR_CMD_PLAY:%d, last_player_state:%d", audio_player_get_state(), last_player_state);
                 if (AUDIO_PLAYER_STATE_IDLE == audio_player_get_state()) {
                     file_iterator_get_full_path_from_index(file_iterator, file_iterator_get_index(file_iterator), filename, sizeof(filename));
-                    fp = fopen(filename, "rb");
+                    fp = audio_playlist_open(filename);
                     if (!fp) {
                         ESP_LOGE(TAG, "unable to open '%s'", filename);
                     } else {
@@ -279,6 +249,7 @@ void sr_handler_task(void *pvParam)
                 ESP_LOGE(TAG, "Unknow cmd");
                 break;
             }
+            sr_trace_end(SR_TRACE_ACTION, stamp);
 
         }
     }
@@ -57,9 +57,12 @@ static void ui_factory_page_save_click_cb(lv_event_t *e)
     param->need_hint = 1; //
     settings_write_parameter_to_nvs();
     lv_task_handler(); vTaskDelay(50);
+    esp_err_t ret = app_sr_set_language(param->sr_lang);
     lv_obj_del(page);
     ui_factory_page_return_click_cb(e);
-    esp_restart();
+    if (ESP_OK != ret) {
+        esp_restart();
+    }
 }
 
 static void radio_event_handler(lv_event_t *e)
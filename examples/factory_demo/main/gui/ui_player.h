@@ -8,6 +8,7 @@
 
 #include <stdbool.h>
 #include "esp_err.h"
+#include "music_library.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -16,6 +17,16 @@ extern "C" {
 void ui_media_player(void (*fn)(void));
 lv_obj_t* get_player_page();
 
+/**
+ * @brief Show the metadata of the current track once the music library is indexed
+ */
+void ui_player_library_ready(music_library_handle_t library, void *user_ctx);
+
+/**
+ * @brief Move to the track the playlist continued with and show it, called from the player task
+ */
+void ui_player_track_changed(const char *path, void *user_ctx);
+
 #ifdef __cplusplus
 }
 #endif
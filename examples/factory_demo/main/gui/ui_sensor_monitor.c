@@ -14,6 +14,8 @@
 #include "app_led.h"
 #include "app_fan.h"
 #include "app_switch.h"
+#include "app_ir_tx.h"
+#include "app_ir_store.h"
 #include "ui_main.h"
 #include "ui_sensor_monitor.h"
 
@@ -21,8 +23,9 @@
 #define IR_RESOLUTION_HZ                1000000 // 1MHz resolution, 1 tick = 1us
 
 #define UPDATE_TIME_PERIOD              300
-#define POWER_ON_PATH                   BSP_SPIFFS_MOUNT_POINT"/my_learn_off.cfg"
-#define POWER_OFF_PATH                  BSP_SPIFFS_MOUNT_POINT"/my_learn_off.cfg"
+#define IR_DEVICE_AC                    "ac"
+#define IR_CMD_POWER_ON                 "power_on"
+#define IR_CMD_POWER_OFF                "power_off"
 
 #define IR_ERR_CHECK(con, err, format, ...) if (con) { \
             ESP_LOGE(TAG, format , ##__VA_ARGS__); \
@@ -31,15 +34,11 @@
 static const char *TAG = "ui_sensor_monitor";
 
 //IR learning
-static QueueHandle_t rmt_out_queue = NULL;
 static ir_learn_handle_t ir_learn_handle = NULL;
 
 struct ir_learn_list_head learn_off_head;
 struct ir_learn_list_head learn_on_head;
 
-struct ir_learn_sub_list_head ir_leran_read_on;
-struct ir_learn_sub_list_head ir_leran_read_off;
-
 struct ir_learn_sub_list_head ir_leran_data_off;
 struct ir_learn_sub_list_head ir_leran_data_on;
 
@@ -140,10 +139,8 @@ bool sensor_ir_learn_enable(void)
 
 esp_err_t ui_sensor_set_ac_poweroff(void)
 {
-    if (!SLIST_EMPTY(&ir_leran_read_off)) {
-        if (rmt_out_queue) {
-            xQueueSendFromISR(rmt_out_queue, &ir_leran_read_off, 0);
-        }
+    if (app_ir_store_exists(IR_DEVICE_AC, IR_CMD_POWER_OFF)) {
+        app_ir_store_send(IR_DEVICE_AC, IR_CMD_POWER_OFF, pdMS_TO_TICKS(100));
         ui_acquire();
         if (AIR_SWITCH_REVERSE_STATE & xEventGroupGetBits(sensor_monitor_event_grp)) {
             lv_label_set_text(ac_switch_btn_lab, "Turn off the air");
@@ -161,10 +158,8 @@ esp_err_t ui_sensor_set_ac_poweroff(void)
 
 esp_err_t ui_sensor_set_ac_poweron(void)
 {
-    if (!SLIST_EMPTY(&ir_leran_read_on)) {
-        if (rmt_out_queue) {
-            xQueueSendFromISR(rmt_out_queue, &ir_leran_read_on, 0);
-        }
+    if (app_ir_store_exists(IR_DEVICE_AC, IR_CMD_POWER_ON)) {
+        app_ir_store_send(IR_DEVICE_AC, IR_CMD_POWER_ON, pdMS_TO_TICKS(100));
         ui_acquire();
         if (AIR_SWITCH_REVERSE_STATE & xEventGroupGetBits(sensor_monitor_event_grp)) {
             lv_label_set_text(ac_switch_btn_lab, "Turn on the air");
@@ -216,167 +211,6 @@ static void user_info_send(uint8_t num, char *tips, uint16_t next_delay)
     }
 }
 
-esp_err_t ir_learn_save_cfg(char *filepath, struct ir_learn_sub_list_head *cmd_list)
-{
-    esp_err_t ret = ESP_OK;
-
-    FILE *fp = fopen(filepath, "wb");
-    ESP_GOTO_ON_FALSE(fp, ESP_FAIL, err, TAG,  "Failed open file:%s", filepath);
-
-    uint8_t cmd_num = 0;
-    ir_learn_sub_list_t *sub_it;
-    SLIST_FOREACH(sub_it, cmd_list, next) {
-        cmd_num++;
-    }
-    ESP_LOGD(TAG, "save cmd_num:%d", cmd_num);
-    fwrite(&cmd_num, 1, sizeof(cmd_num), fp);
-
-    cmd_num = 0;
-    SLIST_FOREACH(sub_it, cmd_list, next) {
-
-        uint32_t timediff = sub_it->timediff;
-        fwrite(&timediff, 1, sizeof(uint32_t), fp);
-
-        size_t symbol_num = sub_it->symbols.num_symbols;
-        fwrite(&symbol_num, 1, sizeof(size_t), fp);
-
-        ESP_LOGD(TAG, "save cmd :%d, symbols:%d", cmd_num++, symbol_num);
-        rmt_symbol_word_t *rmt_nec_symbols = sub_it->symbols.received_symbols;
-        fwrite(rmt_nec_symbols, 1, symbol_num * sizeof(rmt_symbol_word_t), fp);
-    }
-    fclose(fp);
-err:
-    return ret;
-}
-
-esp_err_t ir_learn_read_cfg(char *filepath, struct ir_learn_sub_list_head *cmd_list)
-{
-    esp_err_t ret = ESP_OK;
-
-    FILE *fp = fopen(filepath, "r");
-    ESP_GOTO_ON_FALSE(fp, ESP_FAIL, err, TAG,  "Failed open file:%s", filepath);
-
-    uint8_t total_cmd_num = 0;
-    fread(&total_cmd_num, 1, sizeof(total_cmd_num), fp);
-    ESP_LOGD(TAG, "total cmd_num:%d", total_cmd_num);
-
-    for (int i = 0; i < total_cmd_num; i++) {
-        uint32_t timediff;
-        fread(&timediff, 1, sizeof(uint32_t), fp);
-
-        rmt_rx_done_event_data_t symbols;
-        fread(&symbols.num_symbols, 1, sizeof(size_t), fp);
-        ESP_LOGD(TAG, "read cmd :%d, symbols:%d", i, symbols.num_symbols);
-        symbols.received_symbols = (rmt_symbol_word_t *)heap_caps_malloc(symbols.num_symbols * sizeof(rmt_symbol_word_t), \
-                                   MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-        fread(symbols.received_symbols, 1, symbols.num_symbols * sizeof(rmt_symbol_word_t), fp);
-        ir_learn_add_sub_list_node(cmd_list, timediff, &symbols);
-        if (symbols.received_symbols) {
-            free(symbols.received_symbols);
-        }
-    }
-    fclose(fp);
-err:
-    return ret;
-}
-
-static void ir_learn_test_tx_raw(struct ir_learn_sub_list_head *rmt_out)
-{
-    rmt_tx_channel_config_t tx_channel_cfg = {
-        .clk_src = RMT_CLK_SRC_DEFAULT,
-        .resolution_hz = IR_RESOLUTION_HZ,
-        .mem_block_symbols = 128, // amount of RMT symbols that the channel can store at a time
-        .trans_queue_depth = 4,  // number of transactions that allowed to pending in the background, this example won't queue multiple transactions, so queue depth > 1 is sufficient
-        .gpio_num = BSP_IR_TX_GPIO,
-        // .flags.with_dma = true,
-        // .flags.invert_out = true,
-    };
-    rmt_channel_handle_t tx_channel = NULL;
-    ESP_ERROR_CHECK(rmt_new_tx_channel(&tx_channel_cfg, &tx_channel));
-
-    rmt_carrier_config_t carrier_cfg = {
-        .duty_cycle = 0.33,
-        .frequency_hz = 38000, // 38KHz
-    };
-    ESP_ERROR_CHECK(rmt_apply_carrier(tx_channel, &carrier_cfg));
-
-    rmt_transmit_config_t transmit_config = {
-        .loop_count = 0, // no loop
-    };
-
-    ir_encoder_config_t nec_encoder_cfg = {
-        .resolution = IR_RESOLUTION_HZ,
-    };
-    rmt_encoder_handle_t nec_encoder = NULL;
-    ESP_ERROR_CHECK(ir_encoder_new(&nec_encoder_cfg, &nec_encoder));
-
-    ESP_ERROR_CHECK(rmt_enable(tx_channel));
-
-    ir_learn_sub_list_t *sub_it;
-    SLIST_FOREACH(sub_it, rmt_out, next) {
-        ESP_LOGD(TAG, "RMT out timediff:%" PRIu32 " ms, symbols:%03u",
-                 sub_it->timediff / 1000, sub_it->symbols.num_symbols);
-
-        vTaskDelay(pdMS_TO_TICKS(sub_it->timediff / 1000));
-
-        rmt_symbol_word_t *rmt_nec_symbols = sub_it->symbols.received_symbols;
-        size_t symbol_num = sub_it->symbols.num_symbols;
-
-        ESP_ERROR_CHECK(rmt_transmit(tx_channel, nec_encoder, rmt_nec_symbols, symbol_num, &transmit_config));
-        rmt_tx_wait_all_done(tx_channel, -1);
-    }
-
-    rmt_disable(tx_channel);
-    rmt_del_channel(tx_channel);
-    nec_encoder->del(nec_encoder);
-}
-
-static void ir_learn_test_tx_task(void *arg)
-{
-    struct ir_learn_sub_list_head tx_data;
-
-    gpio_config_t io_conf = {};
-    io_conf.pin_bit_mask = BIT64(BSP_IR_CTRL_GPIO);
-    io_conf.mode = GPIO_MODE_OUTPUT;
-    io_conf.pull_up_en = true;
-    gpio_config(&io_conf);
-    gpio_set_level(BSP_IR_CTRL_GPIO, 0);//enable IR TX
-
-    rmt_out_queue = xQueueCreate(1, sizeof(rmt_rx_done_event_data_t));
-    if (NULL == rmt_out_queue) {
-        ESP_LOGW(TAG, "receive queue creation failed");
-    }
-
-    if (IR_LEARNING_STATE & xEventGroupGetBits(sensor_monitor_event_grp)) {
-        esp_err_t ret = ir_learn_read_cfg(POWER_ON_PATH, &ir_leran_read_on);
-        if (ret == ESP_OK) {
-            ESP_LOGD(TAG, "air_on ir-data read OK.");
-        }
-        ret = ir_learn_read_cfg(POWER_OFF_PATH, &ir_leran_read_off);
-        if (ret == ESP_OK) {
-            ESP_LOGD(TAG, "air_off ir-data read OK.");
-        }
-    }
-
-    xEventGroupClearBits(sensor_monitor_event_grp, NEED_DELETE);
-
-    while (1) {
-        if ((NEED_DELETE & xEventGroupGetBits(sensor_monitor_event_grp))) {
-            xEventGroupSetBits(sensor_monitor_event_grp, TX_CH_DELETED);
-            ESP_LOGD(TAG, "ir learn tx_task delete.");
-            if (rmt_out_queue) {
-                vQueueDelete(rmt_out_queue);
-                rmt_out_queue = NULL;
-            }
-            vTaskDelete(NULL);
-        }
-
-        if (xQueueReceive(rmt_out_queue, &tx_data, pdMS_TO_TICKS(500)) == pdPASS) {
-            ir_learn_test_tx_raw(&tx_data);
-        }
-    }
-}
-
 static void ir_learn_test_save_result(struct ir_learn_sub_list_head *data_save, struct ir_learn_sub_list_head *data_src)
 {
     assert(data_src && "rmt_symbols is null");
@@ -453,15 +287,11 @@ static void ir_learn_learn_send_callback(ir_learn_state_t state, uint8_t sub_ste
             lv_obj_clear_flag(ac_switch_btn, LV_OBJ_FLAG_HIDDEN);
             ui_release();
 
-            ir_learn_save_cfg(POWER_ON_PATH, &ir_leran_data_on);
-            esp_err_t ret = ir_learn_read_cfg(POWER_ON_PATH, &ir_leran_read_on);
-            if (ret == ESP_OK) {
-                ESP_LOGD(TAG, "air_on ir-data read OK.");
+            if (ESP_OK != app_ir_store_save_learned(IR_DEVICE_AC, IR_CMD_POWER_ON, &ir_leran_data_on)) {
+                ESP_LOGE(TAG, "save air_on ir-data failed");
             }
-            ir_learn_save_cfg(POWER_OFF_PATH, &ir_leran_data_off);
-            ret = ir_learn_read_cfg(POWER_OFF_PATH, &ir_leran_read_off);
-            if (ret == ESP_OK) {
-                ESP_LOGD(TAG, "air_off ir-data read OK.");
+            if (ESP_OK != app_ir_store_save_learned(IR_DEVICE_AC, IR_CMD_POWER_OFF, &ir_leran_data_off)) {
+                ESP_LOGE(TAG, "save air_off ir-data failed");
             }
             xEventGroupSetBits(sensor_monitor_event_grp, IR_LEARNING_STATE);
             ir_learn_stop(&ir_learn_handle);
@@ -543,8 +373,6 @@ static void ui_sensor_monitor_page_return_click_cb(lv_event_t *e)
     ir_learn_clean_data(&learn_off_head);
     ir_learn_clean_sub_data(&ir_leran_data_on);
     ir_learn_clean_sub_data(&ir_leran_data_off);
-    ir_learn_clean_sub_data(&ir_leran_read_on);
-    ir_learn_clean_sub_data(&ir_leran_read_off);
     xEventGroupClearBits(sensor_monitor_event_grp, SENSOR_MONITOR_ALIVE_STATE);
 
     if (timer_handle) {
@@ -565,9 +393,6 @@ static void ui_sensor_monitor_page_return_click_cb(lv_event_t *e)
         ir_learn_enable = false;
     }
 
-    xEventGroupSetBits(sensor_monitor_event_grp, NEED_DELETE);
-    xEventGroupWaitBits(sensor_monitor_event_grp, NEED_DELETE | TX_CH_DELETED, 1, 1, portMAX_DELAY);
-
     lv_obj_t *obj = lv_event_get_user_data(e);
     if (ui_get_btn_op_group()) {
         lv_group_remove_all_objs(ui_get_btn_op_group());
@@ -775,13 +600,11 @@ static void ui_sensor_monitor_relearn_btn_event(lv_event_t *e)
     ir_learn_clean_data(&learn_off_head);
     ir_learn_clean_sub_data(&ir_leran_data_on);
     ir_learn_clean_sub_data(&ir_leran_data_off);
-    ir_learn_clean_sub_data(&ir_leran_read_on);
-    ir_learn_clean_sub_data(&ir_leran_read_off);
 
-    if (remove(POWER_ON_PATH) == 0 && remove(POWER_OFF_PATH) == 0) {
-        ESP_LOGD(TAG, "remove file succes.\n");
+    if (app_ir_store_erase(IR_DEVICE_AC, IR_CMD_POWER_ON) == ESP_OK && app_ir_store_erase(IR_DEVICE_AC, IR_CMD_POWER_OFF) == ESP_OK) {
+        ESP_LOGD(TAG, "erase ir-data succes.\n");
     } else {
-        ESP_LOGE(TAG, "remove file failed.\n");
+        ESP_LOGE(TAG, "erase ir-data failed.\n");
     }
     if (0 == (IR_LEARNING_STATE & xEventGroupGetBits(sensor_monitor_event_grp))) {
         ESP_LOGD(TAG, "ir_learn_stop.\n");
@@ -810,14 +633,19 @@ void ui_sensor_monitor_start(void (*fn)(void))
     ESP_LOGI(TAG, "sensor monitor initialize");
     g_sensor_monitor_end_cb = fn;
     const sys_param_t *param = settings_get_parameter();
-    struct stat file_stat;
-    if (stat(POWER_ON_PATH, &file_stat) == 0 && stat(POWER_OFF_PATH, &file_stat) == 0) {
+    if (ESP_OK != app_ir_store_init()) {
+        ESP_LOGW(TAG, "IR code store not available");
+    }
+    if (app_ir_store_exists(IR_DEVICE_AC, IR_CMD_POWER_ON) && app_ir_store_exists(IR_DEVICE_AC, IR_CMD_POWER_OFF)) {
         xEventGroupSetBits(sensor_monitor_event_grp, IR_LEARNING_STATE);
     } else {
         xEventGroupClearBits(sensor_monitor_event_grp, IR_LEARNING_STATE);
     }
 
-    xTaskCreatePinnedToCore(ir_learn_test_tx_task, "ir_learn_test_tx_task", 1024 * 4, NULL, 10, NULL, 1);
+    /* The transmitter stays enabled once started, AC commands only queue their frames */
+    if (ESP_OK != app_ir_tx_start()) {
+        ESP_LOGW(TAG, "IR TX not available");
+    }
 
     user_info_queue = xQueueCreate(sizeof(user_tips_info) / sizeof(user_tips_info[0]), sizeof(user_tips_info_t));
     if (NULL == user_info_queue) {
@@ -48,9 +48,6 @@ typedef enum {
     RADAR_STATE = BIT(4),
     IR_LEARNING_STATE = BIT(5),
     SENSOR_BASE_CONNECT_STATE = BIT(6),
-
-    NEED_DELETE = BIT(7),
-    TX_CH_DELETED = BIT(8),
 } sensor_task_state_type_t;
 
 esp_err_t sensor_task_state_event_init(void);
@@ -6,7 +6,6 @@
 
 #include <stdio.h>
 #include <math.h>
-#include "esp_heap_caps.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -20,50 +19,70 @@
 #include "app_rmaker.h"
 #include "app_sr.h"
 #include "audio_player.h"
+#include "audio_playlist.h"
+#include "asset_pack.h"
 #include "file_iterator.h"
+#include "music_library.h"
 #include "gui/ui_main.h"
+#include "gui/ui_player.h"
 #include "ui_sensor_monitor.h"
 
 #include "bsp_board.h"
 #include "bsp/esp-bsp.h"
+#include "bsp_display_profile.h"
+#include "bsp_read_stream.h"
+#if CONFIG_BSP_STORAGE_BENCH_CONSOLE || CONFIG_SR_TRACE_CONSOLE || CONFIG_TELEMETRY_CONSOLE
+#include "esp_console.h"
+#endif
+#if CONFIG_SR_TRACE_CONSOLE
+#include "sr_trace.h"
+#endif
+#include "telemetry.h"
 
 static const char *TAG = "main";
 
 file_iterator_instance_t *file_iterator;
+music_library_handle_t music_library;
 
-#define MEMORY_MONITOR 0
-
-#if MEMORY_MONITOR
-static void monitor_task(void *arg)
+#if CONFIG_BSP_STORAGE_BENCH_CONSOLE || CONFIG_SR_TRACE_CONSOLE || CONFIG_TELEMETRY_CONSOLE
+static void console_start(void)
 {
-    (void) arg;
-
-    while (true) {
-        ESP_LOGI(TAG, "System Info Trace");
-        // printf("\tDescription\tInternal\tSPIRAM\n");
-        printf("Current Free Memory\t%d\t\t%d\n",
-               heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL),
-               heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
-        printf("Largest Free Block\t%d\t\t%d\n",
-               heap_caps_get_largest_free_block(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL),
-               heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
-        printf("Min. Ever Free Size\t%d\t\t%d\n",
-               heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL),
-               heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
-
-        // esp_intr_dump(stdout);
-        vTaskDelay(pdMS_TO_TICKS(5 * 1000));
-    }
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    esp_console_dev_uart_config_t uart_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+
+    repl_config.prompt = "box>";
+    ESP_ERROR_CHECK(esp_console_new_repl_uart(&uart_config, &repl_config, &repl));
+    esp_console_register_help_command();
+#if CONFIG_BSP_STORAGE_BENCH_CONSOLE
+    ESP_ERROR_CHECK(bsp_storage_bench_register_cmd());
+#endif
+#if CONFIG_SR_TRACE_CONSOLE
+    ESP_ERROR_CHECK(sr_trace_register_cmd());
+#endif
+#if CONFIG_TELEMETRY_CONSOLE
+    ESP_ERROR_CHECK(telemetry_register_cmd());
+#endif
+    ESP_ERROR_CHECK(esp_console_start_repl(repl));
+}
+#endif
 
-    vTaskDelete(NULL);
+static FILE *playlist_open_track(const char *path)
+{
+    /* Large blocks read ahead into PSRAM, the decoder never waits on the file system */
+    FILE *fp = bsp_read_stream_fopen(path, NULL);
+    return fp ? fp : fopen(path, "rb");
 }
 
-static void sys_monitor_start(void)
+static bool playlist_next_track(const char *current, char *next, size_t size, void *user_ctx)
 {
-    BaseType_t ret_val = xTaskCreatePinnedToCore(monitor_task, "Monitor Task", 4 * 1024, NULL, configMAX_PRIORITIES - 3, NULL, 0);
-    ESP_ERROR_CHECK_WITHOUT_ABORT((pdPASS == ret_val) ? ESP_OK : ESP_FAIL);
+    size_t count = file_iterator_get_count(file_iterator);
+    if (!count) {
+        return false;
+    }
+    size_t index = (file_iterator_get_index(file_iterator) + 1) % count;
+    return file_iterator_get_full_path_from_index(file_iterator, index, next, size) > 0;
 }
-#endif
 
 static esp_err_t audio_mute_function(AUDIO_PLAYER_MUTE_SETTING setting)
 {
@@ -100,21 +119,21 @@ void app_main(void)
     ESP_ERROR_CHECK(err);
     ESP_ERROR_CHECK(settings_read_parameter_from_nvs());
 
-#if !SR_RUN_TEST && MEMORY_MONITOR
-    sys_monitor_start(); // Logs should be reduced during SR testing
-#endif
+    /* Heap, CPU load and tasks kept in a ring, see the telemetry console command */
+    const telemetry_config_t telemetry_config = TELEMETRY_DEFAULT_CONFIG();
+    ESP_ERROR_CHECK_WITHOUT_ABORT(telemetry_start(&telemetry_config));
     bsp_spiffs_mount();
+    /* The prompts were converted to raw PCM at build time, and are played straight from flash */
+    if (ESP_OK != asset_pack_init_partition("assets")) {
+        ESP_LOGW(TAG, "No converted prompts, the speech recognition is silent");
+    }
 
     bsp_i2c_init();
 
     bsp_display_cfg_t cfg = {
         .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
-        .buffer_size = BSP_LCD_H_RES * CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,
-        .double_buffer = 0,
-        .flags = {
-            .buff_dma = true,
-        }
     };
+    bsp_display_profile_apply(NULL, &cfg);
     cfg.lvgl_port_cfg.task_affinity = 1;
     bsp_display_start_with_config(&cfg);
     bsp_board_init();
@@ -128,9 +147,32 @@ void app_main(void)
 
     file_iterator = file_iterator_new("/spiffs/mp3");
     assert(file_iterator != NULL);
+    /* Titles and durations come from the cache at once, new files are parsed in the background */
+    const music_library_config_t library_config = {
+        .path = "/spiffs/mp3",
+        .suffix = ".mp3",
+        .cache_path = "/spiffs/music_lib.bin",     /* Outside of the listed directory */
+        .task_priority = 2,
+        .task_core = 0,
+        .ready_cb = ui_player_library_ready,
+    };
+    if (ESP_OK != music_library_new(&library_config, &music_library)) {
+        ESP_LOGW(TAG, "Music library not available, showing file names");
+    }
+    /* The next track is opened while the current one plays and joins the same stream */
+    const audio_playlist_config_t playlist_config = {
+        .write_fn = bsp_i2s_write,
+        .clk_set_fn = bsp_codec_set_fs,
+        .open_fn = playlist_open_track,
+        .next_cb = playlist_next_track,
+        .track_cb = ui_player_track_changed,
+        .task_priority = 2,
+        .task_core = 0,
+    };
+    ESP_ERROR_CHECK(audio_playlist_init(&playlist_config));
     audio_player_config_t config = { .mute_fn = audio_mute_function,
-                                     .write_fn = bsp_i2s_write,
-                                     .clk_set_fn = bsp_codec_set_fs,
+                                     .write_fn = audio_playlist_write,
+                                     .clk_set_fn = audio_playlist_clk_set,
                                      .priority = 5
                                    };
     ESP_ERROR_CHECK(audio_player_new(config));
@@ -146,4 +188,8 @@ void app_main(void)
     vTaskDelay(pdMS_TO_TICKS(4 * 1000));
     app_sr_start(false);
     app_rmaker_start();
+
+#if CONFIG_BSP_STORAGE_BENCH_CONSOLE || CONFIG_SR_TRACE_CONSOLE || CONFIG_TELEMETRY_CONSOLE
+    console_start();
+#endif
 }
@@ -24,6 +24,7 @@
 #include "app_wifi.h"
 #include "app_sr.h"
 #include "rmaker_devices.h"
+#include "rmaker_telemetry.h"
 #include "settings.h"
 #include "app_led.h"
 #include "ui_main.h"
@@ -178,6 +179,9 @@ static void rmaker_task(void *args)
 
     /* Initialize Box devices. */
     ESP_ERROR_CHECK(esp_box_init());
+#if CONFIG_FACTORY_TELEMETRY_RAINMAKER
+    ESP_ERROR_CHECK_WITHOUT_ABORT(rmaker_telemetry_enable(CONFIG_FACTORY_TELEMETRY_RAINMAKER_PERIOD_S));
+#endif
 
     /* Enable OTA */
     // esp_rmaker_ota_config_t ota_config = {
@@ -6,6 +6,7 @@
 
 #include <esp_log.h>
 #include <sdkconfig.h>
+#include <stdlib.h>
 #include <string.h>
 #include "esp_check.h"
 #include <esp_rmaker_core.h>
@@ -23,26 +24,47 @@
 #include "app_sr.h"
 #include "app_fan.h"
 #include "app_switch.h"
+#include "settings.h"
 
 static const char *TAG = "esp_box_driver";
 
 
-static void cmd_write_to_sr(const sr_cmd_t *cmd)
+#define VOICE_PER_ACTION_MAX 8
+
+/**
+ * @brief Check a command against the SR table and the commands already accepted from the same config
+ *
+ * @return true if the command is to be added, false if it is dropped or replaced an existing one
+ */
+static bool cmd_accept(const sr_cmd_t *cmd, const sr_cmd_t *accepted, size_t num_accepted)
 {
-    if (0 != app_sr_search_cmd_from_phoneme(cmd->phoneme, NULL, 1)) {
+    if (cmd->lang != settings_get_parameter()->sr_lang) {
+        ESP_LOGW(TAG, "The phoneme(%s) is not of the current language, drop it", cmd->phoneme);
+        return false;
+    }
+    uint8_t id_list[VOICE_PER_ACTION_MAX];
+    uint8_t table_num = app_sr_search_cmd_from_user_cmd(cmd->cmd, id_list, sizeof(id_list));
+    size_t cmd_num = table_num;
+    bool duplicate = (0 != app_sr_search_cmd_from_phoneme(cmd->phoneme, NULL, 1));
+    for (size_t i = 0; i < num_accepted; i++) {
+        duplicate |= (0 == strcmp(cmd->phoneme, accepted[i].phoneme));
+        cmd_num += (cmd->cmd == accepted[i].cmd);
+    }
+    if (duplicate) {
         ESP_LOGW(TAG, "The phoneme(%s) already be configurated, drop it", cmd->phoneme);
-        return;
+        return false;
     }
-    uint8_t id_list[8];
-    uint8_t cmd_num = app_sr_search_cmd_from_user_cmd(cmd->cmd, id_list, sizeof(id_list));
-    if (cmd_num) {
-        if (cmd_num < sizeof(id_list)) {
-            app_sr_add_cmd(cmd);
-        } else {
-            ESP_LOGE(TAG, "The voice of an action cannot exceed %d", sizeof(id_list));
-            app_sr_modify_cmd(id_list[sizeof(id_list) - 1], cmd);
+    if (0 == cmd_num) {
+        return false;
+    }
+    if (cmd_num >= VOICE_PER_ACTION_MAX) {
+        ESP_LOGE(TAG, "The voice of an action cannot exceed %d", VOICE_PER_ACTION_MAX);
+        if (table_num >= VOICE_PER_ACTION_MAX) {
+            app_sr_modify_cmd(id_list[VOICE_PER_ACTION_MAX - 1], cmd);
         }
+        return false;
     }
+    return true;
 }
 
 static void parse_cmd(const cJSON *voice_item, sr_cmd_t *cmd)
@@ -69,6 +91,13 @@ static esp_err_t parse_sr_config(const char *json_text)
     cJSON *voice_item_array = root_obj;
     int voice_item_size = cJSON_GetArraySize(voice_item_array);
     ESP_LOGI(TAG, "voice cmd num=%d", voice_item_size);
+    sr_cmd_t *cmds = calloc(voice_item_size ? voice_item_size : 1, sizeof(sr_cmd_t));
+    if (NULL == cmds) {
+        cJSON_Delete(root_obj);
+        ESP_LOGE(TAG, "No mem for voice cmds");
+        return ESP_ERR_NO_MEM;
+    }
+    size_t cmd_num = 0;
     for (size_t i = 0; i < voice_item_size; i++) {
         sr_cmd_t cmd = {0};
         cJSON *voice_item = cJSON_GetArrayItem(voice_item_array, i);
@@ -83,23 +112,33 @@ static esp_err_t parse_sr_config(const char *json_text)
             app_pwm_led_set_customize_color(h, s, v);
             parse_cmd(voice_item, &cmd);
             cmd.cmd = SR_CMD_CUSTOMIZE_COLOR;
-            cmd_write_to_sr(&cmd);
+            if (cmd_accept(&cmd, cmds, cmd_num)) {
+                cmds[cmd_num++] = cmd;
+            }
         } else { // light state
             if (cJSON_GetObjectItem(voice_item, "status")->valuedouble == 1) {
                 parse_cmd(voice_item, &cmd);
                 cmd.cmd = SR_CMD_LIGHT_ON;
-                cmd_write_to_sr(&cmd);
+                if (cmd_accept(&cmd, cmds, cmd_num)) {
+                    cmds[cmd_num++] = cmd;
+                }
             } else {
                 parse_cmd(voice_item, &cmd);
                 cmd.cmd = SR_CMD_LIGHT_OFF;
-                cmd_write_to_sr(&cmd);
+                if (cmd_accept(&cmd, cmds, cmd_num)) {
+                    cmds[cmd_num++] = cmd;
+                }
             }
         }
     }
     // actully write all commands to sr
+    if (cmd_num && (ESP_ERR_INVALID_SIZE == app_sr_add_cmds(cmds, cmd_num))) {
+        ESP_LOGW(TAG, "SR command table full, not all voice commands are added");
+    }
     app_sr_update_cmds();
 
     //free the memory
+    free(cmds);
     cJSON_Delete(root_obj);
     return ESP_OK;
 }
@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#include <esp_log.h>
+#include <esp_check.h>
+
+#include <esp_rmaker_core.h>
+#include <esp_rmaker_standard_params.h>
+#include <esp_rmaker_standard_types.h>
+
+#include "telemetry.h"
+#include "rmaker_telemetry.h"
+
+static const char *TAG = "rmaker_telemetry";
+
+enum {
+    TELEMETRY_PARAM_FREE_HEAP,
+    TELEMETRY_PARAM_MIN_FREE_HEAP,
+    TELEMETRY_PARAM_FREE_PSRAM,
+    TELEMETRY_PARAM_CPU_LOAD,
+    TELEMETRY_PARAM_MIN_STACK,
+    TELEMETRY_PARAM_MAX,
+};
+
+static const char *const s_param_names[TELEMETRY_PARAM_MAX] = {
+    [TELEMETRY_PARAM_FREE_HEAP] = "Free Heap",
+    [TELEMETRY_PARAM_MIN_FREE_HEAP] = "Min Free Heap",
+    [TELEMETRY_PARAM_FREE_PSRAM] = "Free PSRAM",
+    [TELEMETRY_PARAM_CPU_LOAD] = "CPU Load",
+    [TELEMETRY_PARAM_MIN_STACK] = "Min Stack Free",
+};
+
+static esp_rmaker_param_t *s_params[TELEMETRY_PARAM_MAX];
+static uint32_t s_period_ms;
+static uint32_t s_last_report_ms;
+
+/* Called from the telemetry task at each sample, only one in a period goes to the cloud */
+static void telemetry_report(const telemetry_sample_t *sample, void *user_ctx)
+{
+    if (s_last_report_ms && (sample->time_ms - s_last_report_ms < s_period_ms)) {
+        return;
+    }
+    s_last_report_ms = sample->time_ms ? sample->time_ms : 1;
+
+    uint16_t load = (sample->cpu_load[0] > sample->cpu_load[1]) ? sample->cpu_load[0] : sample->cpu_load[1];
+    const int values[TELEMETRY_PARAM_MAX] = {
+        [TELEMETRY_PARAM_FREE_HEAP] = sample->internal_free,
+        [TELEMETRY_PARAM_MIN_FREE_HEAP] = sample->internal_min_free,
+        [TELEMETRY_PARAM_FREE_PSRAM] = sample->psram_free,
+        [TELEMETRY_PARAM_CPU_LOAD] = (load + 5) / 10,
+        [TELEMETRY_PARAM_MIN_STACK] = sample->min_stack_free,
+    };
+    /* The last update reports every updated parameter in one message */
+    for (int i = 0; i < TELEMETRY_PARAM_MAX - 1; i++) {
+        esp_rmaker_param_update(s_params[i], esp_rmaker_int(values[i]));
+    }
+    esp_rmaker_param_update_and_report(s_params[TELEMETRY_PARAM_MAX - 1],
+                                       esp_rmaker_int(values[TELEMETRY_PARAM_MAX - 1]));
+}
+
+esp_err_t rmaker_telemetry_enable(uint32_t period_s)
+{
+    esp_rmaker_device_t *device = esp_rmaker_device_create("Telemetry", ESP_RMAKER_DEVICE_OTHER, NULL);
+    ESP_RETURN_ON_FALSE(device, ESP_ERR_NO_MEM, TAG, "create device failed");
+
+    esp_rmaker_device_add_param(device, esp_rmaker_name_param_create(ESP_RMAKER_DEF_NAME_PARAM, "Telemetry"));
+    for (int i = 0; i < TELEMETRY_PARAM_MAX; i++) {
+        s_params[i] = esp_rmaker_param_create(s_param_names[i], NULL, esp_rmaker_int(0), PROP_FLAG_READ);
+        ESP_RETURN_ON_FALSE(s_params[i], ESP_ERR_NO_MEM, TAG, "create %s failed", s_param_names[i]);
+        esp_rmaker_device_add_param(device, s_params[i]);
+    }
+    esp_rmaker_node_add_device(esp_rmaker_get_node(), device);
+
+    s_period_ms = period_s * 1000;
+    telemetry_set_sample_cb(telemetry_report, NULL);
+    return ESP_OK;
+}
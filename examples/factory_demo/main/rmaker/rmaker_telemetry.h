@@ -0,0 +1,31 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Add the "Telemetry" device to the node and report the latest telemetry sample every period
+ *
+ * @note Call after esp_rmaker_node_init() and before esp_rmaker_start().
+ *
+ * @param period_s: Report period in seconds
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_NO_MEM: No memory for the device
+ */
+esp_err_t rmaker_telemetry_enable(uint32_t period_s);
+
+#ifdef __cplusplus
+}
+#endif
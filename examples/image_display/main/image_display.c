@@ -4,14 +4,22 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
-#include <dirent.h>
+#include <stdio.h>
 
+#include "asset_pack.h"
 #include "bsp/esp-bsp.h"
+#include "bsp_display_profile.h"
 #include "esp_log.h"
+#include "img_cache.h"
+
+#define IMAGE_BASE_PATH     "/spiffs"
 
 static const char *TAG = "main";
 
 static lv_group_t *g_btn_op_group = NULL;
+static lv_obj_t *g_img = NULL;
+static const lv_img_dsc_t *g_img_shown = NULL;      /* Pinned in the cache while displayed */
+static uint32_t g_select_seq = 0;                   /* Tells a late decode from the current selection */
 
 static void image_display(void);
 
@@ -23,46 +31,110 @@ void app_main(void)
     /* Initialize display and LVGL */
     bsp_display_cfg_t cfg = {
         .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
-        .buffer_size = BSP_LCD_H_RES * CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,
-        .double_buffer = 0,
-        .flags = {
-            .buff_dma = true,
-        }
     };
+    bsp_display_profile_apply(NULL, &cfg);
     bsp_display_start_with_config(&cfg);
 
     /* Set display brightness to 100% */
     bsp_display_backlight_on();
 
-    /* Mount SPIFFS */
+    /* Mount SPIFFS, its images were converted at build time */
     bsp_spiffs_mount();
+    ESP_ERROR_CHECK(asset_pack_init(IMAGE_BASE_PATH));
+
+    /* Load the images in the background, ahead of their selection */
+    const img_cache_config_t cache_cfg = {
+        .base_path = IMAGE_BASE_PATH,
+        .capacity = CONFIG_IMAGE_DISPLAY_CACHE_SIZE_KB * 1024,
+        .task_priority = 2,
+        .task_core = tskNO_AFFINITY,
+    };
+    ESP_ERROR_CHECK(img_cache_init(&cache_cfg));
 
     image_display();
 }
 
-static void btn_event_cb(lv_event_t *event)
+/* Called with the display lock held */
+static void image_show(const lv_img_dsc_t *img)
 {
-    lv_obj_t *img = (lv_obj_t *) event->user_data;
-    const char *file_name = lv_list_get_btn_text(lv_obj_get_parent(event->target), event->target);
-    char *file_name_with_path = (char *) heap_caps_malloc(256, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    /* Set the new source before the previous image may be dropped from the cache */
+    lv_img_set_src(g_img, img);
+    lv_obj_align(g_img, LV_ALIGN_CENTER, 80, 0);
+    img_cache_release(g_img_shown);
+    g_img_shown = img;
+}
 
-    if (NULL != file_name_with_path) {
-        /* Get full file name with mount point and folder path */
-        strcpy(file_name_with_path, "S:/spiffs/");
-        strcat(file_name_with_path, file_name);
+/* Let LVGL decode the file itself, for the images the cache can not decode */
+/*
+ * The partition holds the converted image only, and the LVGL file decoders are disabled: there is no file source to
+ * fall back to. The image on display is kept.
+ */
+static void image_show_failed(const char *file_name, esp_err_t err)
+{
+    ESP_LOGE(TAG, "Can not display %s: %s", file_name, esp_err_to_name(err));
+}
+
+static void image_log_stats(void)
+{
+    img_cache_stats_t stats;
+
+    if (ESP_OK == img_cache_get_stats(&stats) && (stats.hits + stats.misses)) {
+        ESP_LOGI(TAG, "Cache hit rate %u%% (%u/%u), %u images in %u KB, average load %u ms",
+                 (unsigned)(stats.hits * 100 / (stats.hits + stats.misses)), (unsigned)stats.hits,
+                 (unsigned)(stats.hits + stats.misses), (unsigned)stats.images, (unsigned)(stats.used / 1024),
+                 stats.decodes ? (unsigned)(stats.decode_us / stats.decodes / 1000) : 0);
+    }
+}
 
-        /* Set src of image with file name */
-        lv_img_set_src(img, file_name_with_path);
+static void image_ready_cb(const char *name, const lv_img_dsc_t *img, void *user_ctx)
+{
+    bsp_display_lock(0);
+    if ((uint32_t)(uintptr_t)user_ctx != g_select_seq) {
+        /* Another image was selected meanwhile */
+        img_cache_release(img);
+    } else if (img) {
+        image_show(img);
+        ESP_LOGI(TAG, "Display %s, loaded in %u ms", name, (unsigned)(img_cache_decode_time_us(img) / 1000));
+    } else {
+        image_show_failed(name, ESP_FAIL);
+    }
+    bsp_display_unlock();
+}
 
-        /* Align object */
-        lv_obj_align(img, LV_ALIGN_CENTER, 80, 0);
+/* Decode the entries around the selected one, the nearest first */
+static void image_prefetch(lv_obj_t *list, lv_obj_t *btn)
+{
+    int32_t index = lv_obj_get_index(btn);
+    int32_t count = lv_obj_get_child_cnt(list);
 
-        /* Only for debug */
-        ESP_LOGI(TAG, "Display image file : %s", file_name_with_path);
+    for (int32_t i = 1; i <= CONFIG_IMAGE_DISPLAY_PREFETCH_NEIGHBOURS; i++) {
+        if (index + i < count) {
+            img_cache_prefetch(lv_list_get_btn_text(list, lv_obj_get_child(list, index + i)));
+        }
+        if (index - i >= 0) {
+            img_cache_prefetch(lv_list_get_btn_text(list, lv_obj_get_child(list, index - i)));
+        }
+    }
+}
 
-        /* Don't forget to free allocated memory */
-        free(file_name_with_path);
+static void btn_event_cb(lv_event_t *event)
+{
+    lv_obj_t *list = lv_obj_get_parent(event->target);
+    const char *file_name = lv_list_get_btn_text(list, event->target);
+    const lv_img_dsc_t *img = NULL;
+
+    g_select_seq++;
+    esp_err_t ret = img_cache_get(file_name, &img, image_ready_cb, (void *)(uintptr_t)g_select_seq);
+    if (ESP_OK == ret) {
+        image_show(img);
+        ESP_LOGI(TAG, "Display %s from cache", file_name);
+    } else if (ESP_ERR_NOT_FINISHED != ret) {
+        image_show_failed(file_name, ret);
     }
+    /* Otherwise image_ready_cb shows it once decoded */
+
+    image_prefetch(list, event->target);
+    image_log_stats();
 }
 
 static void image_display(void)
@@ -81,22 +153,15 @@ static void image_display(void)
     lv_obj_set_style_border_width(list, 0, LV_STATE_DEFAULT);
     lv_obj_align(list, LV_ALIGN_LEFT_MID, -15, 0);
 
-    lv_obj_t *img = lv_img_create(lv_scr_act());
-
-    /* Get file name in storage */
-    struct dirent *p_dirent = NULL;
-    DIR *p_dir_stream = opendir("/spiffs");
+    g_img = lv_img_create(lv_scr_act());
 
-    /* Scan files in storage */
-    while (true) {
-        p_dirent = readdir(p_dir_stream);
-        if (NULL != p_dirent) {
-            lv_obj_t *btn = lv_list_add_btn(list, LV_SYMBOL_IMAGE, p_dirent->d_name);
+    /* List the images of the storage */
+    for (size_t i = 0; i < asset_pack_count(); i++) {
+        const asset_pack_entry_t *entry = asset_pack_get(i);
+        if (ASSET_PACK_TYPE_IMAGE == entry->type) {
+            lv_obj_t *btn = lv_list_add_btn(list, LV_SYMBOL_IMAGE, entry->name);
             lv_group_add_obj(g_btn_op_group, btn);
-            lv_obj_add_event_cb(btn, btn_event_cb, LV_EVENT_CLICKED, (void *) img);
-        } else {
-            closedir(p_dir_stream);
-            break;
+            lv_obj_add_event_cb(btn, btn_event_cb, LV_EVENT_CLICKED, NULL);
         }
     }
 }
@@ -0,0 +1,403 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#include <sys/stat.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "asset_pack.h"
+
+#include "img_cache.h"
+
+#if LV_USE_PNG
+#include "src/extra/libs/png/lodepng.h"
+
+#if !LV_MEM_CUSTOM
+#error "img_cache decodes outside of the LVGL task, lv_mem_alloc() must be thread safe"
+#endif
+#endif
+
+#define IMG_CACHE_NAME_MAX          (64)
+#define IMG_CACHE_PATH_MAX          (128)
+#define IMG_CACHE_QUEUE_LEN         (8)
+#define IMG_CACHE_TASK_STACK_SIZE   (6 * 1024)
+
+typedef struct img_entry {
+    lv_img_dsc_t dsc;                       /*!< First, images handed out are entries */
+    TAILQ_ENTRY(img_entry) link;            /*!< Most recently used first */
+    char name[IMG_CACHE_NAME_MAX];
+    int refs;
+    uint32_t decode_us;
+} img_entry_t;
+
+typedef struct {
+    char name[IMG_CACHE_NAME_MAX];
+    img_cache_ready_cb_t cb;                /*!< NULL for a prefetch */
+    void *user_ctx;
+} img_req_t;
+
+static struct {
+    img_cache_config_t config;
+    SemaphoreHandle_t lock;
+    TaskHandle_t task;
+    TAILQ_HEAD(img_lru, img_entry) lru;
+    img_req_t queue[IMG_CACHE_QUEUE_LEN];   /*!< Requests from img_cache_get first, then prefetches */
+    size_t queued;
+    img_req_t decoding;                     /*!< Request of the decode in progress, empty name when idle */
+    img_cache_stats_t stats;
+} s_cache;
+
+static const char *TAG = "img_cache";
+
+static img_entry_t *cache_find(const char *name)
+{
+    img_entry_t *entry;
+
+    TAILQ_FOREACH(entry, &s_cache.lru, link) {
+        if (0 == strcmp(entry->name, name)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void entry_free(img_entry_t *entry)
+{
+    /* Heap pixels, or nothing to free for those mapped from an asset_pack flat image */
+    asset_pack_free(entry->dsc.data);
+    free(entry);
+}
+
+/* Drop unpinned images, least recently used first, until `size` more bytes fit. Called with the lock held */
+static bool cache_make_room(size_t size)
+{
+    img_entry_t *entry = TAILQ_LAST(&s_cache.lru, img_lru);
+
+    while (entry && (s_cache.stats.used + size > s_cache.config.capacity)) {
+        img_entry_t *prev = TAILQ_PREV(entry, img_lru, link);
+        if (0 == entry->refs) {
+            TAILQ_REMOVE(&s_cache.lru, entry, link);
+            s_cache.stats.used -= entry->dsc.data_size;
+            s_cache.stats.images--;
+            s_cache.stats.evictions++;
+            entry_free(entry);
+        }
+        entry = prev;
+    }
+    return s_cache.stats.used + size <= s_cache.config.capacity;
+}
+
+static int queue_find(const char *name)
+{
+    for (size_t i = 0; i < s_cache.queued; i++) {
+        if (0 == strcmp(s_cache.queue[i].name, name)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void queue_remove(size_t index)
+{
+    memmove(&s_cache.queue[index], &s_cache.queue[index + 1], (s_cache.queued - index - 1) * sizeof(img_req_t));
+    s_cache.queued--;
+}
+
+#if LV_USE_PNG
+/* Read a PNG file and convert it to LV_IMG_CF_TRUE_COLOR_ALPHA in PSRAM */
+static esp_err_t img_decode_png(const char *name, lv_img_dsc_t *dsc)
+{
+    esp_err_t ret = ESP_OK;
+    char path[IMG_CACHE_PATH_MAX];
+    struct stat st;
+    uint8_t *file = NULL;
+    uint8_t *rgba = NULL;
+    uint8_t *data = NULL;
+    unsigned w = 0;
+    unsigned h = 0;
+
+    snprintf(path, sizeof(path), "%s/%s", s_cache.config.base_path, name);
+    FILE *fp = fopen(path, "rb");
+    ESP_RETURN_ON_FALSE(fp, ESP_ERR_NOT_FOUND, TAG, "open %s failed", path);
+    if ((0 == fstat(fileno(fp), &st)) && (st.st_size > 0)) {
+        file = heap_caps_malloc_prefer(st.st_size, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, MALLOC_CAP_DEFAULT);
+    }
+    bool read = file && (fread(file, 1, st.st_size, fp) == (size_t)st.st_size);
+    fclose(fp);
+    ESP_GOTO_ON_FALSE(read, ESP_FAIL, err, TAG, "read %s failed", path);
+
+    unsigned error = lodepng_decode32(&rgba, &w, &h, file, st.st_size);
+    ESP_GOTO_ON_FALSE(!error, ESP_FAIL, err, TAG, "%s: %s", name, lodepng_error_text(error));
+
+    uint32_t size = w * h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    data = heap_caps_malloc_prefer(size, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, MALLOC_CAP_DEFAULT);
+    ESP_GOTO_ON_FALSE(data, ESP_ERR_NO_MEM, err, TAG, "no mem for %s, %" PRIu32 " bytes", name, size);
+
+    /* RGBA8888 to the display color, followed by the alpha byte */
+    for (uint32_t i = 0; i < w * h; i++) {
+        const uint8_t *src = &rgba[i * 4];
+        uint8_t *dst = &data[i * LV_IMG_PX_SIZE_ALPHA_BYTE];
+        lv_color_t color = lv_color_make(src[0], src[1], src[2]);
+        memcpy(dst, &color, LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+        dst[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = src[3];
+    }
+
+    dsc->header.always_zero = 0;
+    dsc->header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    dsc->header.w = w;
+    dsc->header.h = h;
+    dsc->data_size = size;
+    dsc->data = data;
+
+err:
+    heap_caps_free(file);
+    lv_mem_free(rgba);
+    return ret;
+}
+#endif
+
+static img_entry_t *img_decode(const char *name)
+{
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    int64_t start = esp_timer_get_time();
+    img_entry_t *entry = calloc(1, sizeof(img_entry_t));
+
+    ESP_RETURN_ON_FALSE(entry, NULL, TAG, "no mem for %s", name);
+    const asset_pack_entry_t *asset = asset_pack_find(name);
+    if (asset && (ASSET_PACK_TYPE_IMAGE == asset->type)) {
+        /* Converted at build time, only read */
+        ret = asset_pack_image_load(name, &entry->dsc);
+    }
+#if LV_USE_PNG
+    else {
+        ret = img_decode_png(name, &entry->dsc);
+    }
+#endif
+    if (ESP_OK != ret) {
+        ESP_LOGW(TAG, "%s: no image", name);
+        free(entry);
+        return NULL;
+    }
+
+    strlcpy(entry->name, name, sizeof(entry->name));
+    entry->decode_us = esp_timer_get_time() - start;
+    return entry;
+}
+
+/* Take the next request, or serve it from the cache. Called with the lock held */
+static bool cache_next(img_req_t *req, img_entry_t **hit)
+{
+    while (s_cache.queued) {
+        *req = s_cache.queue[0];
+        queue_remove(0);
+        *hit = cache_find(req->name);
+        if (!*hit) {
+            s_cache.decoding = *req;
+            return true;
+        }
+        if (req->cb) {
+            /* Prefetched while the request waited */
+            (*hit)->refs++;
+            TAILQ_REMOVE(&s_cache.lru, *hit, link);
+            TAILQ_INSERT_HEAD(&s_cache.lru, *hit, link);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void img_cache_task(void *arg)
+{
+    img_req_t req;
+    img_entry_t *entry;
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        xSemaphoreTake(s_cache.lock, portMAX_DELAY);
+        while (cache_next(&req, &entry)) {
+            if (!entry) {
+                xSemaphoreGive(s_cache.lock);
+                entry = img_decode(req.name);
+                xSemaphoreTake(s_cache.lock, portMAX_DELAY);
+
+                /* img_cache_get may have asked for it meanwhile */
+                req = s_cache.decoding;
+                s_cache.decoding.name[0] = '\0';
+                if (entry) {
+                    s_cache.stats.decodes++;
+                    s_cache.stats.decode_us += entry->decode_us;
+                    ESP_LOGI(TAG, "%s: %ux%u loaded in %" PRIu32 " ms%s", req.name, entry->dsc.header.w,
+                             entry->dsc.header.h, entry->decode_us / 1000, req.cb ? "" : ", prefetched");
+                    /* An image on display goes in even if the pinned ones fill the cache, a prefetch does not */
+                    if (cache_make_room(entry->dsc.data_size) || req.cb) {
+                        TAILQ_INSERT_HEAD(&s_cache.lru, entry, link);
+                        s_cache.stats.used += entry->dsc.data_size;
+                        s_cache.stats.images++;
+                        entry->refs = req.cb ? 1 : 0;
+                    } else {
+                        entry_free(entry);
+                        entry = NULL;
+                    }
+                } else {
+                    s_cache.stats.decode_failures++;
+                }
+            }
+            xSemaphoreGive(s_cache.lock);
+
+            if (req.cb) {
+                req.cb(req.name, entry ? &entry->dsc : NULL, req.user_ctx);
+            }
+            xSemaphoreTake(s_cache.lock, portMAX_DELAY);
+        }
+        xSemaphoreGive(s_cache.lock);
+    }
+}
+
+esp_err_t img_cache_init(const img_cache_config_t *config)
+{
+    esp_err_t ret = ESP_OK;
+
+    ESP_RETURN_ON_FALSE(config && config->base_path && config->capacity, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!s_cache.lock, ESP_ERR_INVALID_STATE, TAG, "already initialized");
+
+    s_cache.config = *config;
+    TAILQ_INIT(&s_cache.lru);
+    s_cache.lock = xSemaphoreCreateMutex();
+    ESP_RETURN_ON_FALSE(s_cache.lock, ESP_ERR_NO_MEM, TAG, "no mem for image cache");
+    ESP_GOTO_ON_FALSE(pdPASS == xTaskCreatePinnedToCore(img_cache_task, "Image Cache", IMG_CACHE_TASK_STACK_SIZE, NULL,
+                                                        config->task_priority, &s_cache.task, config->task_core),
+                      ESP_ERR_NO_MEM, err, TAG, "create image cache task failed");
+    return ESP_OK;
+
+err:
+    vSemaphoreDelete(s_cache.lock);
+    s_cache.lock = NULL;
+    return ret;
+}
+
+esp_err_t img_cache_get(const char *name, const lv_img_dsc_t **img, img_cache_ready_cb_t cb, void *user_ctx)
+{
+    esp_err_t ret = ESP_ERR_NOT_FINISHED;
+
+    ESP_RETURN_ON_FALSE(name && img && cb && (strlen(name) < IMG_CACHE_NAME_MAX), ESP_ERR_INVALID_ARG, TAG,
+                        "invalid argument");
+    ESP_RETURN_ON_FALSE(s_cache.lock, ESP_ERR_INVALID_STATE, TAG, "not initialized");
+
+    xSemaphoreTake(s_cache.lock, portMAX_DELAY);
+    img_entry_t *entry = cache_find(name);
+    if (entry) {
+        entry->refs++;
+        TAILQ_REMOVE(&s_cache.lru, entry, link);
+        TAILQ_INSERT_HEAD(&s_cache.lru, entry, link);
+        s_cache.stats.hits++;
+        *img = &entry->dsc;
+        xSemaphoreGive(s_cache.lock);
+        return ESP_OK;
+    }
+
+    s_cache.stats.misses++;
+    if ((0 == strcmp(s_cache.decoding.name, name)) && !s_cache.decoding.cb) {
+        /* Being prefetched, wait for it */
+        s_cache.decoding.cb = cb;
+        s_cache.decoding.user_ctx = user_ctx;
+        goto exit;
+    }
+
+    /* Behind the other requests from img_cache_get, ahead of the prefetches */
+    int index = queue_find(name);
+    if ((index >= 0) && !s_cache.queue[index].cb) {
+        queue_remove(index);
+    }
+    size_t pos = 0;
+    while ((pos < s_cache.queued) && s_cache.queue[pos].cb) {
+        pos++;
+    }
+    if (IMG_CACHE_QUEUE_LEN == s_cache.queued) {
+        if (pos == s_cache.queued) {
+            ret = ESP_ERR_NO_MEM;
+            goto exit;
+        }
+        s_cache.queued--;
+    }
+    memmove(&s_cache.queue[pos + 1], &s_cache.queue[pos], (s_cache.queued - pos) * sizeof(img_req_t));
+    strlcpy(s_cache.queue[pos].name, name, sizeof(s_cache.queue[pos].name));
+    s_cache.queue[pos].cb = cb;
+    s_cache.queue[pos].user_ctx = user_ctx;
+    s_cache.queued++;
+    xTaskNotifyGive(s_cache.task);
+
+exit:
+    xSemaphoreGive(s_cache.lock);
+    return ret;
+}
+
+esp_err_t img_cache_prefetch(const char *name)
+{
+    esp_err_t ret = ESP_OK;
+
+    ESP_RETURN_ON_FALSE(name && (strlen(name) < IMG_CACHE_NAME_MAX), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(s_cache.lock, ESP_ERR_INVALID_STATE, TAG, "not initialized");
+
+    xSemaphoreTake(s_cache.lock, portMAX_DELAY);
+    if (cache_find(name) || (0 == strcmp(s_cache.decoding.name, name)) || (queue_find(name) >= 0)) {
+        goto exit;
+    }
+    if (IMG_CACHE_QUEUE_LEN == s_cache.queued) {
+        ret = ESP_ERR_NO_MEM;
+        goto exit;
+    }
+    img_req_t *req = &s_cache.queue[s_cache.queued++];
+    strlcpy(req->name, name, sizeof(req->name));
+    req->cb = NULL;
+    req->user_ctx = NULL;
+    xTaskNotifyGive(s_cache.task);
+
+exit:
+    xSemaphoreGive(s_cache.lock);
+    return ret;
+}
+
+void img_cache_release(const lv_img_dsc_t *img)
+{
+    img_entry_t *entry = (img_entry_t *)img;
+
+    if (!img || !s_cache.lock) {
+        return;
+    }
+    xSemaphoreTake(s_cache.lock, portMAX_DELAY);
+    if (entry->refs > 0) {
+        entry->refs--;
+    }
+    /* Back under the capacity once the images on display are released */
+    cache_make_room(0);
+    xSemaphoreGive(s_cache.lock);
+}
+
+uint32_t img_cache_decode_time_us(const lv_img_dsc_t *img)
+{
+    return img ? ((const img_entry_t *)img)->decode_us : 0;
+}
+
+esp_err_t img_cache_get_stats(img_cache_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid stats");
+    ESP_RETURN_ON_FALSE(s_cache.lock, ESP_ERR_INVALID_STATE, TAG, "not initialized");
+
+    xSemaphoreTake(s_cache.lock, portMAX_DELAY);
+    *stats = s_cache.stats;
+    xSemaphoreGive(s_cache.lock);
+    return ESP_OK;
+}
@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Cache of decoded images
+ *
+ * A background task loads the images into PSRAM, as true color images which LVGL draws without any decoder: the ones
+ * converted at build time by asset_pack are only read, other PNG files are decoded with lodepng when LV_USE_PNG is
+ * enabled. The least recently used images are dropped once the loaded images exceed the capacity, except those
+ * still displayed.
+ *
+ * Images are returned pinned: they stay valid until released with `img_cache_release`.
+ */
+
+/**
+ * @brief Decode requested by `img_cache_get` finished, called from the cache task
+ *
+ * @param name: File name of the image
+ * @param img: Pinned decoded image, NULL if the file could not be decoded
+ * @param user_ctx: User context passed to `img_cache_get`
+ */
+typedef void (*img_cache_ready_cb_t)(const char *name, const lv_img_dsc_t *img, void *user_ctx);
+
+typedef struct {
+    const char *base_path;          /*!< Directory of the images, e.g. "/spiffs" */
+    size_t capacity;                /*!< Bytes of decoded images kept */
+    int task_priority;              /*!< Priority of the decoding task */
+    int task_core;                  /*!< Core of the task, tskNO_AFFINITY for any */
+} img_cache_config_t;
+
+typedef struct {
+    uint32_t hits;                  /*!< `img_cache_get` calls served from the cache */
+    uint32_t misses;                /*!< `img_cache_get` calls which had to wait for a load */
+    uint32_t decodes;               /*!< Images loaded, on demand or prefetched */
+    uint32_t decode_failures;       /*!< Images which could not be loaded */
+    uint64_t decode_us;             /*!< Time spent loading, summed over the images */
+    uint32_t evictions;             /*!< Images dropped to make room */
+    uint32_t images;                /*!< Images in the cache */
+    size_t used;                    /*!< Bytes of decoded images in the cache */
+} img_cache_stats_t;
+
+/**
+ * @brief Start the cache and its decoding task
+ *
+ * @note Call `asset_pack_init()` on the same directory first. With LV_USE_PNG, lodepng allocates with lv_mem_alloc()
+ *       from the cache task, so LV_MEM_CUSTOM must be enabled.
+ *
+ * @param config: Cache configuration
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Already initialized
+ *    - ESP_ERR_NO_MEM: No memory for the task
+ */
+esp_err_t img_cache_init(const img_cache_config_t *config);
+
+/**
+ * @brief Get a decoded image, decoding it ahead of any prefetch if it is not cached
+ *
+ * @param name: File name of the image, in the base directory
+ * @param img: Output pinned image on a hit
+ * @param cb: Called once the image is decoded, on a miss only
+ * @param user_ctx: User context of cb
+ *
+ * @return
+ *    - ESP_OK: Hit, *img is set
+ *    - ESP_ERR_NOT_FINISHED: Miss, cb will be called with the image
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Not initialized
+ *    - ESP_ERR_NO_MEM: Too many decodes pending
+ */
+esp_err_t img_cache_get(const char *name, const lv_img_dsc_t **img, img_cache_ready_cb_t cb, void *user_ctx);
+
+/**
+ * @brief Decode an image in the background if it is not cached yet
+ *
+ * @note Dropped when the cache is full of pinned images.
+ *
+ * @param name: File name of the image, in the base directory
+ *
+ * @return
+ *    - ESP_OK: Cached, pending or queued
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Not initialized
+ *    - ESP_ERR_NO_MEM: Too many decodes pending
+ */
+esp_err_t img_cache_prefetch(const char *name);
+
+/**
+ * @brief Unpin an image returned by `img_cache_get` or passed to `img_cache_ready_cb_t`
+ *
+ * @note Do it only once LVGL does not use the image anymore, e.g. after setting another source.
+ *
+ * @param img: Pinned image
+ */
+void img_cache_release(const lv_img_dsc_t *img);
+
+/**
+ * @brief Time spent loading a cached image
+ *
+ * @param img: Pinned image
+ *
+ * @return Decode time in microseconds
+ */
+uint32_t img_cache_decode_time_us(const lv_img_dsc_t *img);
+
+/**
+ * @brief Get the cache statistics
+ *
+ * @param stats: Output statistics
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_INVALID_STATE: Not initialized
+ */
+esp_err_t img_cache_get_stats(img_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "bsp/esp-bsp.h"
+#include "demos/lv_demos.h"
+
+#include "display_bench.h"
+
+#define BENCH_MAGIC             (0x44425043)    /* "DBPC" */
+#define BENCH_TIE_PERCENT       (3)             /* Frame rates closer than this are considered equal */
+
+typedef enum {
+    BENCH_PENDING,
+    BENCH_DONE,
+    BENCH_SKIPPED,
+} bench_status_t;
+
+typedef struct {
+    bench_status_t status;
+    uint32_t fps_x10;
+    uint32_t stall_permille;    /* Share of the refresh time spent waiting for flushes */
+    uint32_t flush_px;          /* Average pixels per flush */
+} bench_result_t;
+
+static const bsp_display_profile_config_t s_candidates[] = {
+    { .profile = BSP_DISPLAY_PROFILE_SINGLE_DMA, .buf_lines = 10 },
+    { .profile = BSP_DISPLAY_PROFILE_DOUBLE_DMA, .buf_lines = 10 },
+    { .profile = BSP_DISPLAY_PROFILE_DOUBLE_DMA, .buf_lines = 20 },
+    { .profile = BSP_DISPLAY_PROFILE_DOUBLE_DMA, .buf_lines = 40 },
+    { .profile = BSP_DISPLAY_PROFILE_PSRAM_FULL, .buf_lines = BSP_LCD_V_RES },
+};
+
+#define BENCH_CANDIDATES        (sizeof(s_candidates) / sizeof(s_candidates[0]))
+
+typedef struct {
+    uint32_t magic;
+    uint32_t next;
+    bench_result_t results[BENCH_CANDIDATES];
+} bench_state_t;
+
+/* Survives esp_restart(), so each profile can be measured on a freshly started display */
+static RTC_NOINIT_ATTR bench_state_t s_bench;
+
+static const char *TAG = "display_bench";
+
+static uint32_t bench_internal_bytes(const bsp_display_profile_config_t *profile)
+{
+    switch (profile->profile) {
+    case BSP_DISPLAY_PROFILE_SINGLE_DMA:
+        return BSP_LCD_H_RES * profile->buf_lines * sizeof(lv_color_t);
+    case BSP_DISPLAY_PROFILE_DOUBLE_DMA:
+        return 2 * BSP_LCD_H_RES * profile->buf_lines * sizeof(lv_color_t);
+    default:
+        return 0;
+    }
+}
+
+static void bench_finished_cb(void)
+{
+    bsp_display_stats_t stats;
+    bench_result_t *result = &s_bench.results[s_bench.next];
+
+    bsp_display_stats_get(&stats, false);
+    if (stats.elapsed_us) {
+        result->fps_x10 = (uint32_t)(stats.frames * 10000000ULL / stats.elapsed_us);
+    }
+    if (stats.refresh_us) {
+        result->stall_permille = (uint32_t)(stats.stall_us * 1000 / stats.refresh_us);
+    }
+    if (stats.flushes) {
+        result->flush_px = (uint32_t)(stats.pixels / stats.flushes);
+    }
+    result->status = BENCH_DONE;
+    ESP_LOGI(TAG, "%s, %u lines: %" PRIu32 ".%" PRIu32 " FPS", bsp_display_profile_name(s_candidates[s_bench.next].profile),
+             s_candidates[s_bench.next].buf_lines, result->fps_x10 / 10, result->fps_x10 % 10);
+
+    s_bench.next++;
+    esp_restart();
+}
+
+static void bench_measure(const bsp_display_profile_config_t *profile)
+{
+    bsp_display_cfg_t cfg = {
+        .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
+    };
+    bsp_display_profile_apply(profile, &cfg);
+    lv_disp_t *disp = bsp_display_start_with_config(&cfg);
+    if (NULL == disp) {
+        ESP_LOGW(TAG, "%s, %u lines: display start failed", bsp_display_profile_name(profile->profile),
+                 profile->buf_lines);
+        s_bench.results[s_bench.next].status = BENCH_SKIPPED;
+        s_bench.next++;
+        esp_restart();
+    }
+    bsp_display_backlight_on();
+
+    bsp_display_lock(0);
+    lv_demo_benchmark_set_finished_cb(bench_finished_cb);
+    lv_demo_benchmark_set_max_speed(true);
+    lv_demo_benchmark();
+    /* After the benchmark installed its own monitor, which keeps being called */
+    bsp_display_stats_attach(disp);
+    bsp_display_unlock();
+
+    /* bench_finished_cb restarts the chip */
+    vTaskSuspend(NULL);
+}
+
+void display_bench_run(bsp_display_profile_config_t *profile)
+{
+    if ((ESP_RST_SW != esp_reset_reason()) || (BENCH_MAGIC != s_bench.magic) || (s_bench.next > BENCH_CANDIDATES)) {
+        s_bench.magic = BENCH_MAGIC;
+        s_bench.next = 0;
+        for (size_t i = 0; i < BENCH_CANDIDATES; i++) {
+            s_bench.results[i].status = BENCH_PENDING;
+        }
+    }
+
+    while (s_bench.next < BENCH_CANDIDATES) {
+        bsp_display_cfg_t cfg = {0};
+        if (ESP_OK == bsp_display_profile_apply(&s_candidates[s_bench.next], &cfg)) {
+            bench_measure(&s_candidates[s_bench.next]);
+        }
+        s_bench.results[s_bench.next].status = BENCH_SKIPPED;
+        s_bench.next++;
+    }
+
+    size_t best = BENCH_CANDIDATES;
+    ESP_LOGI(TAG, "%-18s %5s %9s %6s %8s %8s", "profile", "lines", "internal", "FPS", "stall", "px/flush");
+    for (size_t i = 0; i < BENCH_CANDIDATES; i++) {
+        const bench_result_t *result = &s_bench.results[i];
+        if (BENCH_DONE != result->status) {
+            ESP_LOGI(TAG, "%-18s %5u %9s", bsp_display_profile_name(s_candidates[i].profile), s_candidates[i].buf_lines,
+                     "skipped");
+            continue;
+        }
+        ESP_LOGI(TAG, "%-18s %5u %9" PRIu32 " %4" PRIu32 ".%" PRIu32 " %6" PRIu32 ".%" PRIu32 "%% %8" PRIu32,
+                 bsp_display_profile_name(s_candidates[i].profile), s_candidates[i].buf_lines,
+                 bench_internal_bytes(&s_candidates[i]), result->fps_x10 / 10, result->fps_x10 % 10,
+                 result->stall_permille / 10, result->stall_permille % 10, result->flush_px);
+
+        if (BENCH_CANDIDATES == best) {
+            best = i;
+            continue;
+        }
+        /* Prefer the smaller internal footprint unless it is clearly slower */
+        uint32_t best_fps = s_bench.results[best].fps_x10;
+        bool faster = result->fps_x10 * 100 > best_fps * (100 + BENCH_TIE_PERCENT);
+        bool tie = !faster && (result->fps_x10 * (100 + BENCH_TIE_PERCENT) >= best_fps * 100);
+        if (faster || (tie && bench_internal_bytes(&s_candidates[i]) < bench_internal_bytes(&s_candidates[best]))) {
+            best = i;
+        }
+    }
+
+    /* Measure again on the next software reset */
+    s_bench.magic = 0;
+    if (BENCH_CANDIDATES == best) {
+        ESP_LOGW(TAG, "no profile measured, keep the configured one");
+        return;
+    }
+
+    *profile = s_candidates[best];
+    ESP_LOGI(TAG, "best: %s, %u lines, set it with BSP_DISPLAY_PROFILE and BSP_LCD_DRAW_BUF_HEIGHT",
+             bsp_display_profile_name(profile->profile), profile->buf_lines);
+}
@@ -0,0 +1,28 @@
+/*
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+#pragma once
+
+#include "bsp_display_profile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Measure every display profile with the LVGL benchmark, one per boot, then pick the fastest
+ *
+ * Each boot runs the benchmark with the next profile and restarts. Once every profile is measured, the results are
+ * printed and the function returns the fastest one, preferring the one using less internal memory when the frame
+ * rates are within a few percent.
+ *
+ * @param profile: Output fastest profile
+ */
+void display_bench_run(bsp_display_profile_config_t *profile);
+
+#ifdef __cplusplus
+}
+#endif
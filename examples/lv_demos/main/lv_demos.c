@@ -5,6 +5,8 @@
  */
 
 #include "bsp/esp-bsp.h"
+#include "bsp_display_profile.h"
+#include "display_bench.h"
 
 #include "demos/lv_demos.h"
 
@@ -13,14 +15,15 @@ void app_main(void)
     /* Initialize I2C (for touch and audio) */
     bsp_i2c_init();
     /* Initialize display and LVGL */
+    bsp_display_profile_config_t profile = BSP_DISPLAY_PROFILE_CONFIG_DEFAULT();
+#if CONFIG_LV_DEMOS_DISPLAY_BENCH
+    /* Restarts until every profile is measured, then returns the fastest */
+    display_bench_run(&profile);
+#endif
     bsp_display_cfg_t cfg = {
         .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
-        .buffer_size = BSP_LCD_H_RES * CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,
-        .double_buffer = 0,
-        .flags = {
-            .buff_dma = true,
-        }
     };
+    bsp_display_profile_apply(&profile, &cfg);
     bsp_display_start_with_config(&cfg);
 
     /* Set display brightness to 100% */
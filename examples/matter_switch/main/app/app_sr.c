@@ -18,6 +18,7 @@
 #include "esp_err.h"
 #include "esp_log.h"
 #include "app_sr.h"
+#include "sr_trace.h"
 
 #include "esp_mn_speech_commands.h"
 #include "esp_process_sdkconfig.h"
@@ -198,6 +199,13 @@ static const sr_cmd_t g_default_cmd_info[] = {
 #endif
 };
 
+static void sr_result_send(sr_result_t *result)
+{
+    result->trace_stamp = sr_trace_begin(SR_TRACE_RESULT_QUEUE);
+    bool sent = (pdPASS == xQueueSend(g_sr_data->result_que, result, 0));
+    sr_trace_queue_send(sent, uxQueueMessagesWaiting(g_sr_data->result_que));
+}
+
 static void audio_feed_task(void *arg)
 {
     size_t bytes_read = 0;
@@ -225,7 +233,9 @@ static void audio_feed_task(void *arg)
         }
 
         /* Read audio data from I2S bus */
+        uint32_t stamp = sr_trace_begin(SR_TRACE_I2S_READ);
         bsp_i2s_read((char *)audio_buffer, audio_chunksize * I2S_CHANNEL_NUM * sizeof(int16_t), &bytes_read, portMAX_DELAY);
+        sr_trace_end(SR_TRACE_I2S_READ, stamp);
 
         /* Save audio data to file if record enabled */
         if (g_sr_data->b_record_en && (NULL != g_sr_data->fp)) {
@@ -240,7 +250,9 @@ static void audio_feed_task(void *arg)
         }
 
         /* Feed samples of an audio stream to the AFE_SR */
+        stamp = sr_trace_begin(SR_TRACE_AFE_FEED);
         afe_handle->feed(afe_data, audio_buffer);
+        sr_trace_end(SR_TRACE_AFE_FEED, stamp);
     }
 }
 
@@ -262,7 +274,9 @@ static void audio_detect_task(void *arg)
             vTaskDelete(NULL);
         }
 
+        uint32_t stamp = sr_trace_begin(SR_TRACE_AFE_FETCH);
         afe_fetch_result_t *res = afe_handle->fetch(afe_data);
+        sr_trace_end(SR_TRACE_AFE_FETCH, stamp);
         if (!res || res->ret_value == ESP_FAIL) {
             continue;
         }
@@ -274,7 +288,7 @@ static void audio_detect_task(void *arg)
                 .state = ESP_MN_STATE_DETECTING,
                 .command_id = 0,
             };
-            xQueueSend(g_sr_data->result_que, &result, 0);
+            sr_result_send(&result);
         } else if (res->wakeup_state == WAKENET_CHANNEL_VERIFIED) {
             detect_flag = true;
             g_sr_data->afe_handle->disable_wakenet(afe_data);
@@ -289,7 +303,9 @@ static void audio_detect_task(void *arg)
 
             esp_mn_state_t mn_state = ESP_MN_STATE_DETECTING;
             if (false == sr_echo_is_playing()) {
+                stamp = sr_trace_begin(SR_TRACE_MN_DETECT);
                 mn_state = g_sr_data->multinet->detect(g_sr_data->model_data, res->data);
+                sr_trace_end(SR_TRACE_MN_DETECT, stamp);
             } else {
                 continue;
             }
@@ -305,7 +321,7 @@ static void audio_detect_task(void *arg)
                     .state = mn_state,
                     .command_id = 0,
                 };
-                xQueueSend(g_sr_data->result_que, &result, 0);
+                sr_result_send(&result);
                 g_sr_data->afe_handle->enable_wakenet(afe_data);
                 detect_flag = false;
                 continue;
@@ -325,7 +341,7 @@ static void audio_detect_task(void *arg)
                     .state = mn_state,
                     .command_id = sr_command_id,
                 };
-                xQueueSend(g_sr_data->result_que, &result, 0);
+                sr_result_send(&result);
 #if !SR_CONTINUE_DET
                 g_sr_data->afe_handle->enable_wakenet(afe_data);
                 detect_flag = false;
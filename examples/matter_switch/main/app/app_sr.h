@@ -34,6 +34,7 @@ typedef struct {
     wakenet_state_t wakenet_mode;
     esp_mn_state_t state;
     int command_id;
+    uint32_t trace_stamp;   /**< Queue stage timestamp of sr_trace >*/
 } sr_result_t;
 
 /**
@@ -13,6 +13,7 @@
 #include "app_fan.h"
 #include "app_switch.h"
 #include "app_sr.h"
+#include "sr_trace.h"
 #include "file_manager.h"
 #include "audio_player.h"
 #include "file_iterator.h"
@@ -161,6 +162,7 @@ void sr_handler_task(void *pvParam)
     while (true) {
         sr_result_t result;
         app_sr_get_result(&result, portMAX_DELAY);
+        sr_trace_end(SR_TRACE_RESULT_QUEUE, result.trace_stamp);
 
         sr_current_lang = sr_detect_language();
 
@@ -216,6 +218,7 @@ void sr_handler_task(void *pvParam)
             sr_echo_play(AUDIO_OK);
 #endif
 
+            uint32_t stamp = sr_trace_begin(SR_TRACE_ACTION);
             switch (cmd->cmd) {
             case SR_CMD_SET_RED:
                 app_pwm_led_set_all(128, 0, 0);
@@ -291,6 +294,7 @@ void sr_handler_task(void *pvParam)
                 ESP_LOGE(TAG, "Unknow cmd");
                 break;
             }
+            sr_trace_end(SR_TRACE_ACTION, stamp);
         }
     }
     vTaskDelete(NULL);
@@ -24,6 +24,7 @@
 #include "app_led.h"
 #include "app_fan.h"
 #include "app_switch.h"
+#include "sr_trace.h"
 #include <app_driver.h>
 #include <controller/CHIPCluster.h>
 #include <zap-generated/CHIPClusters.h>
@@ -182,6 +183,17 @@ static void app_driver_register_commands()
         .handler = app_driver_client_console_handler,
     };
     esp_matter::console::add_commands(&client_command, 1);
+
+#if CONFIG_SR_TRACE_ENABLE
+    /* Add console command for the speech pipeline latency trace */
+    static const esp_matter::console::command_t sr_trace_command = {
+        .name = "srtrace",
+        .description = "Speech pipeline latency per stage. "
+        "Usage: matter esp srtrace [reset | dump [<path>]].",
+        .handler = sr_trace_cmd_run,
+    };
+    esp_matter::console::add_commands(&sr_trace_command, 1);
+#endif
 }
 #endif // CONFIG_ENABLE_CHIP_SHELL
 
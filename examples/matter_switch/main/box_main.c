@@ -20,14 +20,18 @@
 #include "app_sr.h"
 #include "audio_player.h"
 #include "file_iterator.h"
+#include "music_library.h"
 #include "gui/ui_main.h"
+#include "gui/ui_player.h"
 
 #include "bsp_board.h"
 #include "bsp/esp-bsp.h"
+#include "bsp_display_profile.h"
 
 static const char *TAG = "main";
 
 file_iterator_instance_t *file_iterator;
+music_library_handle_t music_library;
 
 #define MEMORY_MONITOR 0
 
@@ -113,12 +117,8 @@ void box_main(void)
             .task_max_sleep_ms = 500, \
             .timer_period_ms = 5,     \
         },
-        .buffer_size = BSP_LCD_H_RES * CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,
-        .double_buffer = 0,
-        .flags = {
-            .buff_dma = true,
-        }
     };
+    bsp_display_profile_apply(NULL, &cfg);
     bsp_display_start_with_config(&cfg);
 
     bsp_board_init();
@@ -129,6 +129,18 @@ void box_main(void)
 
     file_iterator = file_iterator_new("/spiffs/mp3");
     assert(file_iterator != NULL);
+    /* Titles and durations come from the cache at once, new files are parsed in the background */
+    const music_library_config_t library_config = {
+        .path = "/spiffs/mp3",
+        .suffix = ".mp3",
+        .cache_path = "/spiffs/music_lib.bin",     /* Outside of the listed directory */
+        .task_priority = 2,
+        .task_core = 0,
+        .ready_cb = ui_player_library_ready,
+    };
+    if (ESP_OK != music_library_new(&library_config, &music_library)) {
+        ESP_LOGW(TAG, "Music library not available, showing file names");
+    }
     audio_player_config_t config = { .mute_fn = audio_mute_function,
                                      .write_fn = bsp_i2s_write,
                                      .clk_set_fn = bsp_codec_set_fs,
@@ -1,1478 +0,0 @@
-/*******************************************************************************
- * Size: 16 px
- * Bpp: 4
- * Opts: 
- ******************************************************************************/
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef FONT_CN_GB1_16
-#define FONT_CN_GB1_16 1
-#endif
-
-#if FONT_CN_GB1_16
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x1f, 0x60, 0xf5, 0xf, 0x50, 0xf4, 0xf, 0x40,
-    0xe4, 0xe, 0x30, 0xd3, 0xb, 0x20, 0x0, 0x2f,
-    0x62, 0xe6,
-
-    /* U+0022 "\"" */
-    0xb, 0xd0, 0x9e, 0x10, 0xbf, 0x28, 0xf5, 0x0,
-    0xd1, 0xa, 0x30, 0x6b, 0x3, 0xd0, 0x9, 0x10,
-    0x82, 0x0,
-
-    /* U+0023 "#" */
-    0x0, 0xa, 0x60, 0x2e, 0x0, 0x0, 0xc, 0x40,
-    0x4c, 0x0, 0x0, 0xe, 0x20, 0x6a, 0x0, 0xc,
-    0xef, 0xee, 0xff, 0xe1, 0x1, 0x4d, 0x11, 0xc6,
-    0x10, 0x0, 0x6b, 0x0, 0xe2, 0x0, 0x0, 0x88,
-    0x0, 0xf0, 0x0, 0x0, 0xb5, 0x3, 0xd0, 0x0,
-    0x7e, 0xfe, 0xee, 0xfe, 0x70, 0x1, 0xf2, 0x19,
-    0x91, 0x0, 0x2, 0xe0, 0xa, 0x60, 0x0, 0x5,
-    0xc0, 0xd, 0x30, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0xa, 0x20,
-    0x0, 0x0, 0x8d, 0xff, 0xb2, 0x0, 0x9e, 0x5b,
-    0x5b, 0xe1, 0xf, 0x60, 0xa2, 0xe, 0x60, 0xf5,
-    0xa, 0x20, 0x33, 0xa, 0xe4, 0xa2, 0x0, 0x0,
-    0x9, 0xff, 0x82, 0x0, 0x0, 0x1, 0xbd, 0xf9,
-    0x0, 0x0, 0xa, 0x24, 0xf8, 0x1e, 0x20, 0xa2,
-    0x8, 0xc0, 0xe7, 0xa, 0x20, 0xab, 0x7, 0xf5,
-    0xa5, 0x8f, 0x50, 0x7, 0xdf, 0xfc, 0x50, 0x0,
-    0x0, 0xa2, 0x0, 0x0, 0x0, 0x5, 0x10, 0x0,
-
-    /* U+0025 "%" */
-    0xa, 0xed, 0x30, 0x0, 0xc, 0x30, 0x0, 0x9b,
-    0x5, 0xe0, 0x0, 0x5a, 0x0, 0x0, 0xd5, 0x0,
-    0xf3, 0x0, 0xd2, 0x0, 0x0, 0xc5, 0x0, 0xf3,
-    0x6, 0x90, 0x0, 0x0, 0x8b, 0x6, 0xe0, 0xd,
-    0x10, 0x0, 0x0, 0x9, 0xec, 0x30, 0x78, 0x8,
-    0xed, 0x40, 0x0, 0x0, 0x1, 0xe1, 0x5d, 0x15,
-    0xe0, 0x0, 0x0, 0x8, 0x70, 0xa8, 0x0, 0xe4,
-    0x0, 0x0, 0x1d, 0x0, 0xb7, 0x0, 0xd6, 0x0,
-    0x0, 0xa6, 0x0, 0xa8, 0x0, 0xe4, 0x0, 0x2,
-    0xd0, 0x0, 0x5d, 0x14, 0xf0, 0x0, 0xb, 0x50,
-    0x0, 0x9, 0xfe, 0x40,
-
-    /* U+0026 "&" */
-    0x0, 0x1a, 0xfe, 0x90, 0x0, 0x0, 0x0, 0xbb,
-    0x23, 0xe8, 0x0, 0x0, 0x0, 0xe6, 0x0, 0xab,
-    0x0, 0x0, 0x0, 0xac, 0x2, 0xe5, 0x0, 0x0,
-    0x0, 0x1e, 0xce, 0x60, 0x1, 0x0, 0x0, 0x4d,
-    0xf9, 0x0, 0x3f, 0x10, 0x7, 0xf5, 0x3f, 0x80,
-    0x5f, 0x0, 0x1f, 0x50, 0x3, 0xf6, 0x9c, 0x0,
-    0x4f, 0x0, 0x0, 0x4f, 0xf6, 0x0, 0x3f, 0x40,
-    0x0, 0xb, 0xf5, 0x0, 0xb, 0xe7, 0x45, 0xcf,
-    0x9f, 0x20, 0x0, 0x7d, 0xfe, 0xa2, 0xa, 0xd1,
-
-    /* U+0027 "'" */
-    0xb, 0xd0, 0xb, 0xf2, 0x0, 0xd1, 0x6, 0xb0,
-    0x9, 0x10,
-
-    /* U+0028 "(" */
-    0x0, 0x1e, 0x20, 0x8, 0xa0, 0x0, 0xf4, 0x0,
-    0x5e, 0x0, 0x9, 0xa0, 0x0, 0xd6, 0x0, 0xf,
-    0x40, 0x0, 0xf3, 0x0, 0xf, 0x30, 0x0, 0xf4,
-    0x0, 0xd, 0x60, 0x0, 0x9a, 0x0, 0x5, 0xe0,
-    0x0, 0xf, 0x30, 0x0, 0x8a, 0x0, 0x1, 0xe2,
-
-    /* U+0029 ")" */
-    0xd, 0x50, 0x0, 0x5d, 0x0, 0x0, 0xe4, 0x0,
-    0x9, 0xa0, 0x0, 0x5e, 0x0, 0x1, 0xf2, 0x0,
-    0xf, 0x40, 0x0, 0xe5, 0x0, 0xe, 0x50, 0x0,
-    0xf4, 0x0, 0x1f, 0x20, 0x5, 0xe0, 0x0, 0x9a,
-    0x0, 0xe, 0x40, 0x5, 0xd0, 0x0, 0xd5, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x7, 0x90, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x48, 0x26, 0x81, 0x86, 0x39, 0xee, 0xee, 0xa4,
-    0x0, 0x1e, 0xe1, 0x0, 0x0, 0xa8, 0x6c, 0x0,
-    0x6, 0xd0, 0xb, 0x70, 0x0, 0x20, 0x1, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0xb, 0x60,
-    0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0xb,
-    0x60, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xd0, 0x22,
-    0x2c, 0x72, 0x22, 0x0, 0x0, 0xb6, 0x0, 0x0,
-    0x0, 0xb, 0x60, 0x0, 0x0, 0x0, 0xb6, 0x0,
-    0x0,
-
-    /* U+002C "," */
-    0xa, 0xd0, 0xb, 0xf2, 0x0, 0xc1, 0x5, 0xb0,
-    0x9, 0x10,
-
-    /* U+002D "-" */
-    0x3f, 0xff, 0xff, 0xff, 0xd0, 0x22, 0x22, 0x22,
-    0x22,
-
-    /* U+002E "." */
-    0x0, 0xa, 0xd0, 0xad, 0x0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x62, 0x0, 0x0, 0x1, 0xf1,
-    0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0xd, 0x40,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x99, 0x0,
-    0x0, 0x0, 0xe3, 0x0, 0x0, 0x4, 0xd0, 0x0,
-    0x0, 0xa, 0x70, 0x0, 0x0, 0xf, 0x10, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x2, 0xf0, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0,
-    0xd, 0x40, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x2b, 0xfe, 0x80, 0x0, 0x1e, 0xa3, 0x5d,
-    0xa0, 0x9, 0xc0, 0x0, 0x2f, 0x30, 0xe6, 0x0,
-    0x0, 0xc8, 0x1f, 0x30, 0x0, 0x9, 0xb2, 0xf2,
-    0x0, 0x0, 0x8c, 0x2f, 0x20, 0x0, 0x8, 0xc1,
-    0xf3, 0x0, 0x0, 0x9b, 0xe, 0x60, 0x0, 0xd,
-    0x80, 0x9c, 0x0, 0x2, 0xf3, 0x1, 0xea, 0x35,
-    0xda, 0x0, 0x2, 0xbf, 0xe8, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x1c, 0xc0, 0x5d, 0xfc, 0x3f, 0x78, 0xc0,
-    0x0, 0x8c, 0x0, 0x8, 0xc0, 0x0, 0x8c, 0x0,
-    0x8, 0xc0, 0x0, 0x8c, 0x0, 0x8, 0xc0, 0x0,
-    0x8c, 0x0, 0x8, 0xc0, 0x0, 0x8c,
-
-    /* U+0032 "2" */
-    0x0, 0x2b, 0xfe, 0xa2, 0x0, 0x1e, 0xa4, 0x4b,
-    0xe1, 0x9, 0xd0, 0x0, 0xe, 0x70, 0xd8, 0x0,
-    0x0, 0xc9, 0x4, 0x20, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0x9, 0xe0, 0x0, 0x0, 0xa, 0xe3, 0x0,
-    0x0, 0x3d, 0xc1, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0x3f, 0x60, 0x0, 0x0, 0xb, 0xd3, 0x33,
-    0x33, 0x20, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0033 "3" */
-    0x0, 0x3b, 0xee, 0xb3, 0x0, 0x3f, 0x94, 0x4a,
-    0xf2, 0xb, 0xa0, 0x0, 0xd, 0x70, 0x63, 0x0,
-    0x0, 0xc8, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0xe, 0xff, 0x40, 0x0, 0x0, 0x13, 0x8e, 0x20,
-    0x0, 0x0, 0x0, 0xba, 0x1e, 0x30, 0x0, 0x9,
-    0xc0, 0xe8, 0x0, 0x0, 0xd9, 0x5, 0xf8, 0x34,
-    0xbf, 0x20, 0x4, 0xcf, 0xfb, 0x20,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x1e,
-    0xf6, 0x0, 0x0, 0x0, 0xb8, 0xe6, 0x0, 0x0,
-    0x6, 0xc0, 0xe6, 0x0, 0x0, 0x3e, 0x20, 0xe6,
-    0x0, 0x0, 0xd5, 0x0, 0xe6, 0x0, 0xa, 0x90,
-    0x0, 0xe6, 0x0, 0x5d, 0x0, 0x0, 0xe6, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xf3, 0x12, 0x22, 0x22,
-    0xe7, 0x20, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0xe6, 0x0,
-
-    /* U+0035 "5" */
-    0x5, 0xff, 0xff, 0xff, 0x50, 0x7c, 0x33, 0x33,
-    0x31, 0x8, 0xa0, 0x0, 0x0, 0x0, 0xa8, 0x0,
-    0x0, 0x0, 0xb, 0x79, 0xee, 0xb2, 0x0, 0xde,
-    0x73, 0x4b, 0xe1, 0x7, 0x40, 0x0, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0x9b, 0x6, 0x0, 0x0, 0x9,
-    0xb0, 0xf6, 0x0, 0x0, 0xe8, 0x7, 0xf7, 0x35,
-    0xdd, 0x10, 0x5, 0xcf, 0xe9, 0x10,
-
-    /* U+0036 "6" */
-    0x0, 0x1a, 0xfe, 0xb3, 0x0, 0xd, 0xa3, 0x3a,
-    0xe1, 0x7, 0xd0, 0x0, 0xd, 0x70, 0xd6, 0x0,
-    0x0, 0x0, 0xf, 0x37, 0xde, 0xb2, 0x2, 0xfa,
-    0xa3, 0x4b, 0xe1, 0x2f, 0xb0, 0x0, 0xd, 0x81,
-    0xf5, 0x0, 0x0, 0x9b, 0xf, 0x60, 0x0, 0x9,
-    0xb0, 0xab, 0x0, 0x0, 0xe8, 0x2, 0xfa, 0x44,
-    0xce, 0x10, 0x3, 0xbf, 0xfa, 0x10,
-
-    /* U+0037 "7" */
-    0xff, 0xff, 0xff, 0xf9, 0x34, 0x44, 0x44, 0xf6,
-    0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0xa, 0xa0,
-    0x0, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x7d, 0x0,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0x4, 0xf1, 0x0,
-    0x0, 0xa, 0xb0, 0x0, 0x0, 0x1f, 0x50, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x5c, 0xfe, 0xa2, 0x0, 0x6f, 0x62, 0x3a,
-    0xe1, 0xd, 0x70, 0x0, 0xd, 0x60, 0xd6, 0x0,
-    0x0, 0xc7, 0x7, 0xd3, 0x0, 0x7e, 0x10, 0x9,
-    0xff, 0xff, 0x40, 0x8, 0xe6, 0x23, 0x9f, 0x32,
-    0xf3, 0x0, 0x0, 0xab, 0x4f, 0x0, 0x0, 0x6,
-    0xe2, 0xf3, 0x0, 0x0, 0xac, 0xb, 0xe5, 0x23,
-    0x9f, 0x40, 0x7, 0xdf, 0xeb, 0x30,
-
-    /* U+0039 "9" */
-    0x0, 0x6d, 0xfe, 0x90, 0x0, 0x7f, 0x73, 0x4c,
-    0xb0, 0xf, 0x60, 0x0, 0x1e, 0x42, 0xf2, 0x0,
-    0x0, 0xb9, 0xf, 0x40, 0x0, 0xe, 0xb0, 0xae,
-    0x40, 0x2a, 0xcc, 0x0, 0xaf, 0xff, 0x78, 0xc0,
-    0x0, 0x12, 0x0, 0xaa, 0x7, 0x20, 0x0, 0xe,
-    0x60, 0xba, 0x0, 0x5, 0xf1, 0x4, 0xf8, 0x36,
-    0xf7, 0x0, 0x5, 0xcf, 0xd6, 0x0,
-
-    /* U+003A ":" */
-    0x0, 0xa, 0xd0, 0xad, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xd0, 0xad, 0x0,
-
-    /* U+003B ";" */
-    0x0, 0xa, 0xd0, 0xad, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xd0, 0xaf, 0x30, 0xc2, 0x4c,
-    0x9, 0x10,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x1, 0x70, 0x0, 0x0, 0x29,
-    0xfa, 0x0, 0x2, 0xaf, 0xa2, 0x0, 0x3b, 0xf9,
-    0x20, 0x0, 0x3f, 0xc1, 0x0, 0x0, 0x0, 0x7e,
-    0xc5, 0x0, 0x0, 0x0, 0x7, 0xed, 0x60, 0x0,
-    0x0, 0x0, 0x6d, 0xe6, 0x0, 0x0, 0x0, 0x5,
-    0xa0,
-
-    /* U+003D "=" */
-    0x3f, 0xff, 0xff, 0xff, 0xd0, 0x22, 0x22, 0x22,
-    0x22, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfd, 0x2, 0x22, 0x22, 0x22, 0x20,
-
-    /* U+003E ">" */
-    0x26, 0x0, 0x0, 0x0, 0x1, 0xde, 0x70, 0x0,
-    0x0, 0x0, 0x5c, 0xe7, 0x10, 0x0, 0x0, 0x4,
-    0xbf, 0x81, 0x0, 0x0, 0x0, 0x4e, 0xd0, 0x0,
-    0x1, 0x7e, 0xc5, 0x0, 0x18, 0xfc, 0x40, 0x1,
-    0x9f, 0xb3, 0x0, 0x0, 0x3a, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x0, 0x7e, 0xfd, 0x50, 0x7, 0xe6, 0x37, 0xf5,
-    0xf, 0x50, 0x0, 0xaa, 0x1d, 0x10, 0x0, 0x9b,
-    0x0, 0x0, 0x1, 0xe7, 0x0, 0x0, 0x1c, 0xc0,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x4, 0xf1, 0x0,
-    0x0, 0x5, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xe1, 0x0, 0x0, 0x8, 0xe0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x1, 0x7c, 0xef, 0xd8, 0x10, 0x0, 0x3,
-    0xe8, 0x20, 0x2, 0x8e, 0x20, 0x1, 0xe4, 0x5,
-    0xdd, 0x58, 0x5c, 0x0, 0x99, 0x5, 0xf5, 0x3d,
-    0xb0, 0xc3, 0xf, 0x20, 0xe5, 0x0, 0xa6, 0x9,
-    0x52, 0xf0, 0x4e, 0x0, 0xd, 0x20, 0xa4, 0x2f,
-    0x5, 0xc0, 0x2, 0xe0, 0x1e, 0x0, 0xf1, 0x2e,
-    0x11, 0xcb, 0x1b, 0x60, 0xb, 0x60, 0x6e, 0xd4,
-    0xce, 0x63, 0x50, 0x3e, 0x20, 0x0, 0x0, 0x1,
-    0xd3, 0x0, 0x5e, 0x61, 0x0, 0x16, 0xd4, 0x0,
-    0x0, 0x29, 0xde, 0xed, 0x81, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x1f,
-    0xd9, 0x0, 0x0, 0x0, 0x7, 0xc4, 0xe0, 0x0,
-    0x0, 0x0, 0xd6, 0xe, 0x50, 0x0, 0x0, 0x3f,
-    0x0, 0x8b, 0x0, 0x0, 0x9, 0xa0, 0x2, 0xf1,
-    0x0, 0x0, 0xe3, 0x0, 0xb, 0x70, 0x0, 0x5f,
-    0xff, 0xff, 0xfd, 0x0, 0xb, 0x92, 0x22, 0x23,
-    0xf3, 0x1, 0xf3, 0x0, 0x0, 0xb, 0x90, 0x7e,
-    0x0, 0x0, 0x0, 0x6e, 0xd, 0x90, 0x0, 0x0,
-    0x1, 0xf5,
-
-    /* U+0042 "B" */
-    0xdf, 0xff, 0xff, 0xc5, 0x0, 0xd8, 0x22, 0x23,
-    0x8f, 0x40, 0xd7, 0x0, 0x0, 0xb, 0x90, 0xd7,
-    0x0, 0x0, 0xa, 0x90, 0xd7, 0x0, 0x0, 0x5f,
-    0x30, 0xdf, 0xff, 0xff, 0xf6, 0x0, 0xd8, 0x22,
-    0x23, 0x6e, 0x70, 0xd7, 0x0, 0x0, 0x6, 0xf0,
-    0xd7, 0x0, 0x0, 0x3, 0xf2, 0xd7, 0x0, 0x0,
-    0x6, 0xf0, 0xd8, 0x22, 0x23, 0x7f, 0xa0, 0xdf,
-    0xff, 0xff, 0xd7, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x6, 0xcf, 0xfd, 0x70, 0x0, 0xa, 0xf8,
-    0x44, 0x8e, 0xb0, 0x7, 0xf2, 0x0, 0x0, 0x2e,
-    0x60, 0xe8, 0x0, 0x0, 0x0, 0x79, 0x2f, 0x20,
-    0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf2,
-    0x0, 0x0, 0x0, 0x13, 0xe, 0x70, 0x0, 0x0,
-    0x9, 0xc0, 0x8e, 0x20, 0x0, 0x3, 0xf5, 0x0,
-    0xbe, 0x84, 0x48, 0xfa, 0x0, 0x0, 0x6c, 0xff,
-    0xc6, 0x0,
-
-    /* U+0044 "D" */
-    0xdf, 0xff, 0xfd, 0x92, 0x0, 0xd9, 0x33, 0x36,
-    0xcf, 0x30, 0xd7, 0x0, 0x0, 0xa, 0xd0, 0xd7,
-    0x0, 0x0, 0x1, 0xf4, 0xd7, 0x0, 0x0, 0x0,
-    0xc8, 0xd7, 0x0, 0x0, 0x0, 0xb9, 0xd7, 0x0,
-    0x0, 0x0, 0xb9, 0xd7, 0x0, 0x0, 0x0, 0xd7,
-    0xd7, 0x0, 0x0, 0x2, 0xf3, 0xd7, 0x0, 0x0,
-    0xb, 0xc0, 0xd9, 0x33, 0x36, 0xde, 0x20, 0xdf,
-    0xff, 0xfd, 0x81, 0x0,
-
-    /* U+0045 "E" */
-    0xdf, 0xff, 0xff, 0xff, 0x4d, 0x93, 0x33, 0x33,
-    0x30, 0xd7, 0x0, 0x0, 0x0, 0xd, 0x70, 0x0,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xd0, 0xd9, 0x33, 0x33, 0x32, 0xd,
-    0x70, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd, 0x70, 0x0, 0x0, 0x0, 0xd9, 0x33, 0x33,
-    0x33, 0x1d, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+0046 "F" */
-    0xdf, 0xff, 0xff, 0xfc, 0xd9, 0x33, 0x33, 0x32,
-    0xd7, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf7,
-    0xd9, 0x33, 0x33, 0x31, 0xd7, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x5, 0xcf, 0xfd, 0x70, 0x0, 0xa, 0xf8,
-    0x44, 0x8f, 0xb0, 0x6, 0xf3, 0x0, 0x0, 0x2f,
-    0x70, 0xe7, 0x0, 0x0, 0x0, 0x9c, 0x2f, 0x20,
-    0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0xff, 0xff, 0xe2, 0xf2,
-    0x0, 0x2, 0x33, 0x7e, 0xe, 0x70, 0x0, 0x0,
-    0x6, 0xe0, 0x7f, 0x30, 0x0, 0x0, 0x6e, 0x0,
-    0xaf, 0x84, 0x35, 0x9f, 0xc0, 0x0, 0x5c, 0xff,
-    0xeb, 0x50,
-
-    /* U+0048 "H" */
-    0xd7, 0x0, 0x0, 0x0, 0xe6, 0xd7, 0x0, 0x0,
-    0x0, 0xe6, 0xd7, 0x0, 0x0, 0x0, 0xe6, 0xd7,
-    0x0, 0x0, 0x0, 0xe6, 0xd7, 0x0, 0x0, 0x0,
-    0xe6, 0xdf, 0xff, 0xff, 0xff, 0xf6, 0xd9, 0x33,
-    0x33, 0x33, 0xe6, 0xd7, 0x0, 0x0, 0x0, 0xe6,
-    0xd7, 0x0, 0x0, 0x0, 0xe6, 0xd7, 0x0, 0x0,
-    0x0, 0xe6, 0xd7, 0x0, 0x0, 0x0, 0xe6, 0xd7,
-    0x0, 0x0, 0x0, 0xe6,
-
-    /* U+0049 "I" */
-    0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8,
-    0xc8, 0xc8, 0xc8, 0xc8,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x3, 0xf1, 0x9c, 0x0, 0x7, 0xf0,
-    0x3f, 0x84, 0x6f, 0x90, 0x5, 0xdf, 0xe9, 0x0,
-
-    /* U+004B "K" */
-    0xd7, 0x0, 0x0, 0x1c, 0xc0, 0xd, 0x70, 0x0,
-    0x1c, 0xc0, 0x0, 0xd7, 0x0, 0xc, 0xc0, 0x0,
-    0xd, 0x70, 0xc, 0xc0, 0x0, 0x0, 0xd7, 0xc,
-    0xc0, 0x0, 0x0, 0xd, 0x8c, 0xf7, 0x0, 0x0,
-    0x0, 0xdf, 0xb6, 0xf5, 0x0, 0x0, 0xd, 0xc0,
-    0x8, 0xf3, 0x0, 0x0, 0xd7, 0x0, 0xa, 0xe2,
-    0x0, 0xd, 0x70, 0x0, 0xc, 0xd0, 0x0, 0xd7,
-    0x0, 0x0, 0x1e, 0xb0, 0xd, 0x70, 0x0, 0x0,
-    0x3f, 0x90,
-
-    /* U+004C "L" */
-    0xd7, 0x0, 0x0, 0x0, 0xd, 0x70, 0x0, 0x0,
-    0x0, 0xd7, 0x0, 0x0, 0x0, 0xd, 0x70, 0x0,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd, 0x70,
-    0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0xd,
-    0x70, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd, 0x70, 0x0, 0x0, 0x0, 0xd9, 0x33, 0x33,
-    0x33, 0xd, 0xff, 0xff, 0xff, 0xf1,
-
-    /* U+004D "M" */
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xdf, 0x60,
-    0x0, 0x0, 0x4, 0xff, 0xde, 0xd0, 0x0, 0x0,
-    0xb, 0xef, 0xd8, 0xf3, 0x0, 0x0, 0x2f, 0x8f,
-    0xd7, 0xaa, 0x0, 0x0, 0x8b, 0x5f, 0xd7, 0x3f,
-    0x10, 0x0, 0xe5, 0x5f, 0xd7, 0xd, 0x70, 0x5,
-    0xe0, 0x5f, 0xd7, 0x6, 0xe0, 0xc, 0x80, 0x5f,
-    0xd7, 0x0, 0xf5, 0x3f, 0x10, 0x5f, 0xd7, 0x0,
-    0x9b, 0x9a, 0x0, 0x5f, 0xd7, 0x0, 0x2f, 0xf4,
-    0x0, 0x5f, 0xd7, 0x0, 0xb, 0xd0, 0x0, 0x5f,
-
-    /* U+004E "N" */
-    0xdd, 0x0, 0x0, 0x0, 0xf5, 0xdf, 0x80, 0x0,
-    0x0, 0xf5, 0xdb, 0xf3, 0x0, 0x0, 0xf5, 0xd7,
-    0x9d, 0x0, 0x0, 0xf5, 0xd7, 0xe, 0x80, 0x0,
-    0xf5, 0xd7, 0x4, 0xf2, 0x0, 0xf5, 0xd7, 0x0,
-    0x9c, 0x0, 0xf5, 0xd7, 0x0, 0xe, 0x70, 0xf5,
-    0xd7, 0x0, 0x4, 0xf2, 0xf5, 0xd7, 0x0, 0x0,
-    0xac, 0xf5, 0xd7, 0x0, 0x0, 0x1e, 0xf5, 0xd7,
-    0x0, 0x0, 0x5, 0xf5,
-
-    /* U+004F "O" */
-    0x0, 0x5, 0xcf, 0xfd, 0x80, 0x0, 0x0, 0xaf,
-    0x84, 0x47, 0xed, 0x10, 0x6, 0xf3, 0x0, 0x0,
-    0xc, 0xb0, 0xe, 0x80, 0x0, 0x0, 0x3, 0xf2,
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0xe6, 0x4f, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0xc8, 0x2f, 0x20, 0x0, 0x0, 0x0, 0xe7,
-    0xe, 0x70, 0x0, 0x0, 0x3, 0xf2, 0x7, 0xf3,
-    0x0, 0x0, 0x1c, 0xb0, 0x0, 0xaf, 0x84, 0x47,
-    0xed, 0x10, 0x0, 0x5, 0xcf, 0xfd, 0x80, 0x0,
-
-    /* U+0050 "P" */
-    0xdf, 0xff, 0xfe, 0xb4, 0xd, 0x93, 0x33, 0x4a,
-    0xf3, 0xd7, 0x0, 0x0, 0xc, 0x9d, 0x70, 0x0,
-    0x0, 0x9b, 0xd7, 0x0, 0x0, 0xb, 0x9d, 0x70,
-    0x0, 0x17, 0xf4, 0xdf, 0xff, 0xff, 0xe6, 0xd,
-    0x93, 0x32, 0x10, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xd, 0x70, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0,
-    0x0, 0xd, 0x70, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x5, 0xcf, 0xfd, 0x80, 0x0, 0x0, 0xaf,
-    0x84, 0x47, 0xed, 0x10, 0x6, 0xf3, 0x0, 0x0,
-    0xc, 0xb0, 0xe, 0x80, 0x0, 0x0, 0x3, 0xf2,
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0xe7, 0x4f, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0xc8, 0x2f, 0x20, 0x0, 0x29, 0x0, 0xe6,
-    0xe, 0x70, 0x0, 0xc, 0x94, 0xf2, 0x7, 0xf3,
-    0x0, 0x1, 0xee, 0xa0, 0x0, 0xaf, 0x84, 0x47,
-    0xef, 0x50, 0x0, 0x5, 0xcf, 0xfc, 0x67, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa2,
-
-    /* U+0052 "R" */
-    0xdf, 0xff, 0xff, 0xc4, 0x0, 0xd9, 0x33, 0x34,
-    0x9f, 0x40, 0xd7, 0x0, 0x0, 0xc, 0xa0, 0xd7,
-    0x0, 0x0, 0x9, 0xc0, 0xd7, 0x0, 0x0, 0xb,
-    0xa0, 0xd7, 0x0, 0x1, 0x7f, 0x30, 0xdf, 0xff,
-    0xff, 0xf4, 0x0, 0xd9, 0x33, 0x34, 0xaf, 0x20,
-    0xd7, 0x0, 0x0, 0xd, 0x70, 0xd7, 0x0, 0x0,
-    0xa, 0xa0, 0xd7, 0x0, 0x0, 0x8, 0xc0, 0xd7,
-    0x0, 0x0, 0x5, 0xf1,
-
-    /* U+0053 "S" */
-    0x0, 0x6c, 0xfe, 0xc6, 0x0, 0xa, 0xe6, 0x44,
-    0x8f, 0x80, 0x1f, 0x40, 0x0, 0x6, 0xf0, 0x2f,
-    0x40, 0x0, 0x0, 0xa2, 0xb, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0xfa, 0x50, 0x0, 0x0, 0x0,
-    0x27, 0xce, 0x60, 0x0, 0x0, 0x0, 0x5, 0xf4,
-    0x6f, 0x0, 0x0, 0x0, 0xc8, 0x2f, 0x60, 0x0,
-    0x0, 0xe7, 0x9, 0xf8, 0x54, 0x6d, 0xe1, 0x0,
-    0x5c, 0xef, 0xd9, 0x10,
-
-    /* U+0054 "T" */
-    0xbf, 0xff, 0xff, 0xff, 0xfa, 0x23, 0x33, 0xca,
-    0x33, 0x32, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xd7, 0x0, 0x0, 0x0, 0xf4, 0xd7, 0x0, 0x0,
-    0x0, 0xf4, 0xd7, 0x0, 0x0, 0x0, 0xf4, 0xd7,
-    0x0, 0x0, 0x0, 0xf4, 0xd7, 0x0, 0x0, 0x0,
-    0xf4, 0xd7, 0x0, 0x0, 0x0, 0xf4, 0xd7, 0x0,
-    0x0, 0x0, 0xf4, 0xd8, 0x0, 0x0, 0x1, 0xf3,
-    0xba, 0x0, 0x0, 0x3, 0xf2, 0x7f, 0x10, 0x0,
-    0x9, 0xd0, 0xd, 0xe6, 0x45, 0xaf, 0x50, 0x1,
-    0x9e, 0xff, 0xb4, 0x0,
-
-    /* U+0056 "V" */
-    0xba, 0x0, 0x0, 0x0, 0x7e, 0x6, 0xf0, 0x0,
-    0x0, 0xc, 0x90, 0x1f, 0x50, 0x0, 0x2, 0xf4,
-    0x0, 0xbb, 0x0, 0x0, 0x7e, 0x0, 0x5, 0xf1,
-    0x0, 0xd, 0x80, 0x0, 0xf, 0x60, 0x2, 0xf3,
-    0x0, 0x0, 0xab, 0x0, 0x8d, 0x0, 0x0, 0x4,
-    0xf1, 0xd, 0x80, 0x0, 0x0, 0xe, 0x62, 0xf2,
-    0x0, 0x0, 0x0, 0x9c, 0x8c, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x70, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xca, 0x0, 0x0, 0x6f, 0x40, 0x0, 0xc, 0xa8,
-    0xe0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0xf6, 0x3f,
-    0x20, 0x0, 0xeb, 0xc0, 0x0, 0x4f, 0x10, 0xf6,
-    0x0, 0x2f, 0x3f, 0x10, 0x8, 0xd0, 0xb, 0xa0,
-    0x6, 0xc0, 0xe5, 0x0, 0xc9, 0x0, 0x6e, 0x0,
-    0xb8, 0xa, 0x90, 0xf, 0x40, 0x2, 0xf2, 0xf,
-    0x30, 0x5d, 0x4, 0xf0, 0x0, 0xd, 0x63, 0xf0,
-    0x1, 0xf1, 0x8b, 0x0, 0x0, 0x9a, 0x7b, 0x0,
-    0xd, 0x5c, 0x70, 0x0, 0x5, 0xeb, 0x70, 0x0,
-    0x9a, 0xf3, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x5,
-    0xfe, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x1f,
-    0xa0, 0x0,
-
-    /* U+0058 "X" */
-    0x4f, 0x50, 0x0, 0x2, 0xf7, 0x0, 0x9e, 0x10,
-    0x0, 0xcc, 0x0, 0x0, 0xda, 0x0, 0x7f, 0x20,
-    0x0, 0x4, 0xf5, 0x2f, 0x60, 0x0, 0x0, 0x9,
-    0xec, 0xb0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xda, 0x7f, 0x10, 0x0, 0x0, 0x9e, 0x10, 0xcb,
-    0x0, 0x0, 0x3f, 0x50, 0x2, 0xf6, 0x0, 0xd,
-    0xb0, 0x0, 0x7, 0xf2, 0x9, 0xe1, 0x0, 0x0,
-    0xd, 0xc0,
-
-    /* U+0059 "Y" */
-    0x9e, 0x0, 0x0, 0x0, 0x6f, 0x31, 0xe9, 0x0,
-    0x0, 0x1e, 0x80, 0x5, 0xf3, 0x0, 0xa, 0xd0,
-    0x0, 0xa, 0xd0, 0x4, 0xf4, 0x0, 0x0, 0x1f,
-    0x70, 0xda, 0x0, 0x0, 0x0, 0x6f, 0x9e, 0x10,
-    0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x0,
-    0x5, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf0,
-    0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x2f, 0xff, 0xff, 0xff, 0xf3, 0x3, 0x33, 0x33,
-    0x3d, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0x0, 0xae, 0x10, 0x0, 0x0, 0x6,
-    0xf4, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x9, 0xe1, 0x0,
-    0x0, 0x0, 0x5f, 0x83, 0x33, 0x33, 0x31, 0x9f,
-    0xff, 0xff, 0xff, 0xf9,
-
-    /* U+005B "[" */
-    0x4f, 0xff, 0x94, 0xe2, 0x21, 0x4e, 0x0, 0x4,
-    0xe0, 0x0, 0x4e, 0x0, 0x4, 0xe0, 0x0, 0x4e,
-    0x0, 0x4, 0xe0, 0x0, 0x4e, 0x0, 0x4, 0xe0,
-    0x0, 0x4e, 0x0, 0x4, 0xe0, 0x0, 0x4e, 0x0,
-    0x4, 0xe0, 0x0, 0x4e, 0x0, 0x4, 0xff, 0xf9,
-    0x2, 0x22, 0x10,
-
-    /* U+005C "\\" */
-    0x26, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0,
-    0x0, 0xe3, 0x0, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0xd, 0x40, 0x0,
-    0x0, 0x7, 0xa0, 0x0, 0x0, 0x2, 0xf0, 0x0,
-    0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0xa, 0x70,
-    0x0, 0x0, 0x4, 0xd0, 0x0, 0x0, 0x0, 0xe3,
-
-    /* U+005D "]" */
-    0x4f, 0xff, 0x90, 0x22, 0xaa, 0x0, 0x9, 0xa0,
-    0x0, 0x9a, 0x0, 0x9, 0xa0, 0x0, 0x9a, 0x0,
-    0x9, 0xa0, 0x0, 0x9a, 0x0, 0x9, 0xa0, 0x0,
-    0x9a, 0x0, 0x9, 0xa0, 0x0, 0x9a, 0x0, 0x9,
-    0xa0, 0x0, 0x9a, 0x0, 0x9, 0xa4, 0xff, 0xfa,
-    0x2, 0x22, 0x10,
-
-    /* U+005E "^" */
-    0x0, 0xa, 0xe0, 0x0, 0x0, 0x1f, 0xc6, 0x0,
-    0x0, 0x89, 0x4d, 0x0, 0x0, 0xe2, 0xd, 0x40,
-    0x6, 0xb0, 0x6, 0xa0, 0xd, 0x40, 0x0, 0xe1,
-
-    /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x22, 0x22, 0x22,
-
-    /* U+0060 "`" */
-    0x56, 0x0, 0x1e, 0x30, 0x2, 0xc0,
-
-    /* U+0061 "a" */
-    0x0, 0x8e, 0xfd, 0x70, 0xa, 0xc4, 0x24, 0xd7,
-    0x8, 0x20, 0x0, 0x6d, 0x0, 0x8c, 0xef, 0xff,
-    0xc, 0xd5, 0x22, 0x6f, 0x3f, 0x20, 0x0, 0x6f,
-    0x4f, 0x0, 0x0, 0xdf, 0x1f, 0x92, 0x4c, 0xcf,
-    0x4, 0xdf, 0xd6, 0x4f,
-
-    /* U+0062 "b" */
-    0xf, 0x40, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0xf4, 0x8e,
-    0xfa, 0x10, 0xf, 0xc9, 0x34, 0xdc, 0x0, 0xfb,
-    0x0, 0x1, 0xf5, 0xf, 0x50, 0x0, 0xb, 0x90,
-    0xf3, 0x0, 0x0, 0xaa, 0xf, 0x50, 0x0, 0xb,
-    0x90, 0xfa, 0x0, 0x1, 0xf5, 0xf, 0xd8, 0x23,
-    0xcc, 0x0, 0xf4, 0xaf, 0xfa, 0x10,
-
-    /* U+0063 "c" */
-    0x0, 0x6d, 0xfd, 0x80, 0x0, 0x6f, 0x73, 0x5d,
-    0x90, 0xe, 0x70, 0x0, 0x4f, 0x3, 0xf1, 0x0,
-    0x0, 0x10, 0x4f, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0x0, 0x0, 0x50, 0xe, 0x60, 0x0, 0x4f, 0x0,
-    0x7f, 0x62, 0x5e, 0x80, 0x0, 0x7d, 0xfd, 0x70,
-    0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0, 0xe, 0x60, 0x7, 0xef,
-    0xb2, 0xe6, 0x7, 0xf6, 0x25, 0xce, 0x60, 0xe6,
-    0x0, 0x5, 0xf6, 0x3f, 0x10, 0x0, 0xf, 0x64,
-    0xf0, 0x0, 0x0, 0xe6, 0x3f, 0x10, 0x0, 0xf,
-    0x60, 0xe6, 0x0, 0x4, 0xf6, 0x7, 0xf5, 0x25,
-    0xde, 0x60, 0x7, 0xdf, 0xc3, 0xd6,
-
-    /* U+0065 "e" */
-    0x0, 0x7d, 0xfd, 0x60, 0x0, 0x8e, 0x63, 0x6e,
-    0x60, 0x1f, 0x50, 0x0, 0x6e, 0x6, 0xf0, 0x0,
-    0x1, 0xf3, 0x7f, 0xee, 0xee, 0xef, 0x56, 0xf1,
-    0x11, 0x11, 0x10, 0x2f, 0x30, 0x0, 0x3c, 0x0,
-    0x9e, 0x52, 0x5e, 0x80, 0x0, 0x7e, 0xfd, 0x60,
-    0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x3d, 0xfe, 0x0, 0xbb, 0x22, 0x0, 0xd7,
-    0x0, 0xef, 0xff, 0xfc, 0x22, 0xd8, 0x21, 0x0,
-    0xd7, 0x0, 0x0, 0xd7, 0x0, 0x0, 0xd7, 0x0,
-    0x0, 0xd7, 0x0, 0x0, 0xd7, 0x0, 0x0, 0xd7,
-    0x0, 0x0, 0xd7, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x6d, 0xfc, 0x3d, 0x70, 0x6f, 0x72, 0x5d,
-    0xe7, 0xe, 0x70, 0x0, 0x4f, 0x73, 0xf1, 0x0,
-    0x0, 0xe7, 0x4f, 0x0, 0x0, 0xd, 0x73, 0xf1,
-    0x0, 0x0, 0xe7, 0xe, 0x60, 0x0, 0x4f, 0x70,
-    0x7f, 0x62, 0x5d, 0xe7, 0x0, 0x7e, 0xfc, 0x3d,
-    0x60, 0x41, 0x0, 0x0, 0xf4, 0xa, 0xd4, 0x23,
-    0xbd, 0x0, 0x8, 0xef, 0xea, 0x10,
-
-    /* U+0068 "h" */
-    0xf, 0x40, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0xf, 0x49, 0xfe, 0x80,
-    0xf, 0xd7, 0x36, 0xf7, 0xf, 0x90, 0x0, 0x9c,
-    0xf, 0x50, 0x0, 0x6e, 0xf, 0x40, 0x0, 0x5e,
-    0xf, 0x40, 0x0, 0x5e, 0xf, 0x40, 0x0, 0x5e,
-    0xf, 0x40, 0x0, 0x5e, 0xf, 0x40, 0x0, 0x5e,
-
-    /* U+0069 "i" */
-    0xbc, 0xb, 0xd0, 0x0, 0x9, 0xb0, 0x9b, 0x9,
-    0xb0, 0x9b, 0x9, 0xb0, 0x9b, 0x9, 0xb0, 0x9b,
-    0x9, 0xb0,
-
-    /* U+006A "j" */
-    0x0, 0x8e, 0x10, 0x8, 0xe1, 0x0, 0x0, 0x0,
-    0x7, 0xd0, 0x0, 0x7d, 0x0, 0x7, 0xd0, 0x0,
-    0x7d, 0x0, 0x7, 0xd0, 0x0, 0x7d, 0x0, 0x7,
-    0xd0, 0x0, 0x7d, 0x0, 0x7, 0xd0, 0x0, 0x7d,
-    0x0, 0x2b, 0xb0, 0x3f, 0xd2, 0x0,
-
-    /* U+006B "k" */
-    0xf, 0x40, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x2e, 0x90, 0xf, 0x40, 0x2e, 0x90, 0x0, 0xf4,
-    0x2e, 0x90, 0x0, 0xf, 0x6e, 0xb0, 0x0, 0x0,
-    0xff, 0xcf, 0x20, 0x0, 0xf, 0x90, 0xbd, 0x0,
-    0x0, 0xf4, 0x1, 0xe9, 0x0, 0xf, 0x40, 0x4,
-    0xf5, 0x0, 0xf4, 0x0, 0x8, 0xf2,
-
-    /* U+006C "l" */
-    0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8,
-    0xc8, 0xc8, 0xc8, 0xc8,
-
-    /* U+006D "m" */
-    0xf, 0x5b, 0xfd, 0x50, 0xaf, 0xd6, 0x0, 0xfe,
-    0x63, 0x9f, 0xb7, 0x37, 0xf4, 0xf, 0x80, 0x0,
-    0xeb, 0x0, 0xb, 0x90, 0xf4, 0x0, 0xc, 0x80,
-    0x0, 0x9a, 0xf, 0x40, 0x0, 0xc7, 0x0, 0x9,
-    0xb0, 0xf4, 0x0, 0xc, 0x70, 0x0, 0x9b, 0xf,
-    0x40, 0x0, 0xc7, 0x0, 0x9, 0xb0, 0xf4, 0x0,
-    0xc, 0x70, 0x0, 0x9b, 0xf, 0x40, 0x0, 0xc7,
-    0x0, 0x9, 0xb0,
-
-    /* U+006E "n" */
-    0xf, 0x59, 0xfe, 0x80, 0xf, 0xe7, 0x36, 0xf7,
-    0xf, 0x90, 0x0, 0x8d, 0xf, 0x50, 0x0, 0x5e,
-    0xf, 0x40, 0x0, 0x5f, 0xf, 0x40, 0x0, 0x5f,
-    0xf, 0x40, 0x0, 0x5f, 0xf, 0x40, 0x0, 0x5f,
-    0xf, 0x40, 0x0, 0x5f,
-
-    /* U+006F "o" */
-    0x0, 0x5d, 0xfe, 0x90, 0x0, 0x5f, 0x72, 0x4d,
-    0xb0, 0xe, 0x70, 0x0, 0x1f, 0x53, 0xf1, 0x0,
-    0x0, 0xb9, 0x4f, 0x0, 0x0, 0xa, 0xa3, 0xf1,
-    0x0, 0x0, 0xb9, 0xe, 0x70, 0x0, 0x1f, 0x50,
-    0x5f, 0x62, 0x4d, 0xb0, 0x0, 0x5d, 0xfe, 0x90,
-    0x0,
-
-    /* U+0070 "p" */
-    0xf, 0x3a, 0xfe, 0xa1, 0x0, 0xfd, 0x93, 0x3c,
-    0xc0, 0xf, 0xa0, 0x0, 0x1f, 0x50, 0xf5, 0x0,
-    0x0, 0xb9, 0xf, 0x30, 0x0, 0xa, 0xa0, 0xf5,
-    0x0, 0x0, 0xb9, 0xf, 0xa0, 0x0, 0x1f, 0x50,
-    0xfc, 0x82, 0x4c, 0xc0, 0xf, 0x48, 0xef, 0xa1,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x7d, 0xfc, 0x3d, 0x60, 0x7f, 0x62, 0x5d,
-    0xe6, 0xe, 0x60, 0x0, 0x4f, 0x63, 0xf1, 0x0,
-    0x0, 0xf6, 0x4f, 0x0, 0x0, 0xe, 0x63, 0xf1,
-    0x0, 0x0, 0xf6, 0xe, 0x60, 0x0, 0x4f, 0x60,
-    0x7f, 0x62, 0x5c, 0xe6, 0x0, 0x7e, 0xfb, 0x2e,
-    0x60, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0,
-    0xe, 0x60, 0x0, 0x0, 0x0, 0xe6,
-
-    /* U+0072 "r" */
-    0xf, 0x4a, 0xfc, 0xf, 0xdc, 0x66, 0xf, 0xc0,
-    0x0, 0xf, 0x60, 0x0, 0xf, 0x40, 0x0, 0xf,
-    0x40, 0x0, 0xf, 0x40, 0x0, 0xf, 0x40, 0x0,
-    0xf, 0x40, 0x0,
-
-    /* U+0073 "s" */
-    0x3, 0xbf, 0xeb, 0x20, 0x1f, 0x93, 0x3a, 0xe0,
-    0x3f, 0x20, 0x0, 0xa2, 0xc, 0xd7, 0x20, 0x0,
-    0x0, 0x6b, 0xfd, 0x50, 0x0, 0x0, 0x6, 0xf4,
-    0x5d, 0x0, 0x0, 0xd8, 0x1e, 0x92, 0x27, 0xf4,
-    0x3, 0xbe, 0xfd, 0x60,
-
-    /* U+0074 "t" */
-    0x0, 0x82, 0x0, 0x1, 0xf3, 0x0, 0x1, 0xf3,
-    0x0, 0xbf, 0xff, 0xf4, 0x13, 0xf5, 0x20, 0x1,
-    0xf3, 0x0, 0x1, 0xf3, 0x0, 0x1, 0xf3, 0x0,
-    0x1, 0xf3, 0x0, 0x0, 0xf3, 0x0, 0x0, 0xf7,
-    0x20, 0x0, 0x7f, 0xf0,
-
-    /* U+0075 "u" */
-    0xf, 0x40, 0x0, 0x5f, 0xf, 0x40, 0x0, 0x5f,
-    0xf, 0x40, 0x0, 0x5f, 0xf, 0x40, 0x0, 0x5f,
-    0xf, 0x40, 0x0, 0x5f, 0xf, 0x40, 0x0, 0x5f,
-    0xe, 0x70, 0x0, 0xbf, 0x9, 0xe5, 0x39, 0xdf,
-    0x0, 0x9e, 0xe8, 0x5f,
-
-    /* U+0076 "v" */
-    0xca, 0x0, 0x0, 0xe7, 0x6f, 0x0, 0x4, 0xf1,
-    0x1f, 0x40, 0x9, 0xc0, 0xb, 0xa0, 0xe, 0x60,
-    0x5, 0xe0, 0x3f, 0x10, 0x0, 0xf4, 0x9b, 0x0,
-    0x0, 0xa9, 0xe5, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0xf, 0xa0, 0x0,
-
-    /* U+0077 "w" */
-    0xc9, 0x0, 0xb, 0xc0, 0x0, 0x8d, 0x7e, 0x0,
-    0xf, 0xf0, 0x0, 0xd8, 0x2f, 0x20, 0x3d, 0xc4,
-    0x1, 0xf3, 0xd, 0x70, 0x79, 0x78, 0x6, 0xe0,
-    0x8, 0xb0, 0xc4, 0x3d, 0xa, 0x90, 0x3, 0xf1,
-    0xf0, 0xf, 0x1e, 0x40, 0x0, 0xe9, 0xc0, 0xb,
-    0x9f, 0x0, 0x0, 0x9f, 0x70, 0x6, 0xfa, 0x0,
-    0x0, 0x4f, 0x30, 0x2, 0xf5, 0x0,
-
-    /* U+0078 "x" */
-    0x3f, 0x40, 0x2, 0xf5, 0x0, 0x8e, 0x0, 0xca,
-    0x0, 0x0, 0xd9, 0x7e, 0x10, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0xd, 0xe1, 0x0, 0x0, 0x8,
-    0xdc, 0xa0, 0x0, 0x3, 0xf4, 0x2f, 0x50, 0x0,
-    0xd9, 0x0, 0x7e, 0x10, 0x9e, 0x0, 0x0, 0xcb,
-    0x0,
-
-    /* U+0079 "y" */
-    0xba, 0x0, 0x0, 0xba, 0x5f, 0x0, 0x1, 0xf4,
-    0xe, 0x60, 0x7, 0xe0, 0x9, 0xc0, 0xc, 0x80,
-    0x2, 0xf2, 0x2f, 0x20, 0x0, 0xc8, 0x8c, 0x0,
-    0x0, 0x6d, 0xd6, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0xb, 0xa0, 0x0, 0x0, 0x1f, 0x40, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x7f, 0xff, 0xff, 0xf2, 0x2, 0x22, 0x2d, 0xb0,
-    0x0, 0x0, 0x8e, 0x10, 0x0, 0x4, 0xf4, 0x0,
-    0x0, 0x1e, 0x80, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x7, 0xe2, 0x0, 0x0, 0x3f, 0x72, 0x22, 0x20,
-    0x9f, 0xff, 0xff, 0xf6,
-
-    /* U+007B "{" */
-    0x0, 0x4d, 0xe0, 0xe, 0x61, 0x1, 0xf0, 0x0,
-    0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x2,
-    0xf0, 0x0, 0x7c, 0x0, 0xaf, 0x20, 0x2, 0x9c,
-    0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0,
-    0x0, 0x2f, 0x0, 0x0, 0xf3, 0x0, 0x8, 0xfe,
-    0x0, 0x0, 0x10,
-
-    /* U+007C "|" */
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1,
-
-    /* U+007D "}" */
-    0x9e, 0x80, 0x1, 0x3e, 0x40, 0x0, 0xb7, 0x0,
-    0xb, 0x70, 0x0, 0xb7, 0x0, 0xb, 0x70, 0x0,
-    0xb7, 0x0, 0x7, 0xc1, 0x0, 0xc, 0xf0, 0x6,
-    0xd4, 0x0, 0xb7, 0x0, 0xb, 0x70, 0x0, 0xb7,
-    0x0, 0xb, 0x70, 0x0, 0xd5, 0x9, 0xfc, 0x0,
-    0x11, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x1b, 0xeb, 0x40, 0x54, 0x57, 0x16, 0xdf, 0xd2,
-    0x0, 0x0, 0x1, 0x0,
-
-    /* U+007F "" */
-
-    /* U+4E00 "一" */
-    0x3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x2e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe2,
-
-    /* U+4E0B "下" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x2, 0x22, 0x22, 0x2f, 0x42, 0x22, 0x22, 0x20,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfb, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x39, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x2c, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x7d, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+4E49 "义" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xe3, 0x0, 0x0, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x8e, 0x10, 0x0, 0xe4, 0x0,
-    0x0, 0x47, 0x0, 0xc, 0x90, 0x2, 0xf0, 0x0,
-    0x0, 0x5f, 0x0, 0x2, 0xf2, 0x7, 0xc0, 0x0,
-    0x0, 0xd, 0x70, 0x0, 0x10, 0xe, 0x60, 0x0,
-    0x0, 0x4, 0xf1, 0x0, 0x0, 0x5f, 0x0, 0x0,
-    0x0, 0x0, 0xab, 0x0, 0x0, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0x70, 0x8, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf6, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xf5, 0x2c, 0xe4, 0x0, 0x0,
-    0x0, 0x18, 0xfb, 0x20, 0x0, 0x8f, 0xb4, 0x0,
-    0xb, 0xfc, 0x40, 0x0, 0x0, 0x2, 0x9f, 0xd1,
-    0x5, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0x50,
-
-    /* U+4E50 "乐" */
-    0x0, 0x0, 0x0, 0x1, 0x35, 0x8c, 0x60, 0x1,
-    0xed, 0xee, 0xfe, 0xca, 0x74, 0x0, 0x3, 0xe1,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xa0, 0x0,
-    0x16, 0x0, 0x0, 0x0, 0x9, 0x70, 0x0, 0x4e,
-    0x0, 0x0, 0x0, 0xc, 0x40, 0x0, 0x4e, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x2, 0x22, 0x22, 0x6e, 0x22, 0x22, 0x21,
-    0x0, 0x13, 0x0, 0x4e, 0x0, 0x32, 0x0, 0x0,
-    0x8c, 0x0, 0x4e, 0x0, 0x9b, 0x0, 0x0, 0xe4,
-    0x0, 0x4e, 0x0, 0x1f, 0x30, 0x8, 0xd0, 0x0,
-    0x4e, 0x0, 0x8, 0xc0, 0x2f, 0x40, 0x0, 0x4e,
-    0x0, 0x1, 0xf3, 0xba, 0x0, 0x10, 0x7e, 0x0,
-    0x0, 0x9b, 0x11, 0x0, 0xdf, 0xf7, 0x0, 0x0,
-    0x12,
-
-    /* U+505C "停" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x89, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0xe, 0x6d, 0xdd, 0xdf, 0xdd, 0xdd, 0x50, 0x5,
-    0xe0, 0x33, 0x33, 0x33, 0x33, 0x31, 0x0, 0xc7,
-    0x0, 0xee, 0xee, 0xee, 0xe2, 0x0, 0x6f, 0x50,
-    0xf, 0x0, 0x0, 0xe, 0x30, 0x1e, 0xf5, 0x0,
-    0xfc, 0xcc, 0xcc, 0xf3, 0x8, 0x8c, 0x50, 0x2,
-    0x22, 0x22, 0x22, 0x0, 0x20, 0xc5, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0xc, 0x53, 0xe1, 0x11,
-    0x11, 0x11, 0xa7, 0x0, 0xc5, 0x2b, 0x33, 0x33,
-    0x33, 0x39, 0x50, 0xc, 0x50, 0x1c, 0xcc, 0xfd,
-    0xcc, 0x70, 0x0, 0xc5, 0x0, 0x0, 0xe, 0x40,
-    0x0, 0x0, 0xc, 0x50, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x0, 0xc5, 0x0, 0x3, 0x3f, 0x30, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0xce, 0xb0, 0x0, 0x0,
-
-    /* U+5173 "关" */
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x3, 0x0, 0x0,
-    0x0, 0x0, 0xd5, 0x0, 0x0, 0x6d, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0x10, 0x0, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x60, 0x6, 0xd0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x22, 0x22, 0x2b, 0x92, 0x22, 0x22, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0, 0x0,
-    0xc, 0xdd, 0xdd, 0xdf, 0xed, 0xdd, 0xdd, 0xa0,
-    0x3, 0x44, 0x44, 0x8f, 0xf6, 0x44, 0x44, 0x30,
-    0x0, 0x0, 0x0, 0xb9, 0x9a, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xe1, 0x1e, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x40, 0x2, 0xe9, 0x0, 0x0,
-    0x0, 0x6d, 0xd3, 0x0, 0x0, 0x1b, 0xe6, 0x0,
-    0xe, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xe0,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
-
-    /* U+5207 "切" */
-    0x0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xe0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x4e, 0x0, 0x1, 0x13, 0xf1, 0x14, 0xf0, 0x4,
-    0xe0, 0x2, 0x10, 0x3f, 0x0, 0x3f, 0x1, 0x7f,
-    0xbe, 0xf7, 0x3, 0xe0, 0x3, 0xf4, 0xff, 0xf7,
-    0x41, 0x0, 0x4d, 0x0, 0x3e, 0x1, 0x4e, 0x0,
-    0x0, 0x6, 0xb0, 0x3, 0xe0, 0x4, 0xe0, 0x0,
-    0x0, 0x99, 0x0, 0x4e, 0x0, 0x4e, 0x0, 0x0,
-    0xd, 0x50, 0x4, 0xe0, 0x4, 0xe0, 0x4, 0x2,
-    0xf1, 0x0, 0x4d, 0x0, 0x4e, 0x4d, 0xd0, 0x9b,
-    0x0, 0x5, 0xd0, 0xa, 0xff, 0x70, 0x2f, 0x30,
-    0x0, 0x6c, 0x0, 0x86, 0x0, 0xd, 0xa0, 0x0,
-    0x8, 0xa0, 0x0, 0x0, 0xb, 0xd1, 0x1, 0x2,
-    0xe6, 0x0, 0x0, 0xb, 0xd1, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x21, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5B9A "定" */
-    0x0, 0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0x0,
-    0x1, 0x33, 0x33, 0x38, 0xd3, 0x33, 0x33, 0x30,
-    0x5, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xe0,
-    0x5, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x5, 0xc0, 0x22, 0x22, 0x22, 0x22, 0x13, 0xe0,
-    0x1, 0x37, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x20,
-    0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xa0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xd0, 0x3, 0xf3, 0x33, 0x32, 0x0,
-    0x0, 0x8, 0x90, 0x3, 0xfe, 0xee, 0xe9, 0x0,
-    0x0, 0xe, 0x80, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xe3, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xd6, 0x4e, 0x33, 0xe0, 0x0, 0x0, 0x0,
-    0x7, 0xd0, 0x4, 0xed, 0xf4, 0x31, 0x11, 0x11,
-    0xd, 0x30, 0x0, 0x5, 0x9c, 0xdf, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5F00 "开" */
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x22, 0x6e, 0x22, 0x22, 0xaa, 0x22, 0x0,
-    0x0, 0x0, 0x4e, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x2, 0x22, 0x8c, 0x22, 0x22, 0xaa, 0x22, 0x20,
-    0x0, 0x0, 0x89, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x0, 0x0, 0xb7, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x0, 0x0, 0xf3, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x0, 0x6, 0xe0, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x3, 0xeb, 0x0, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x8, 0xa0, 0x0, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+6210 "成" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xb, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x1, 0xb6, 0x0,
-    0x0, 0xbd, 0xdd, 0xdd, 0xef, 0xdd, 0xdd, 0xc0,
-    0x0, 0xe7, 0x44, 0x44, 0x6f, 0x44, 0x44, 0x30,
-    0x0, 0xe4, 0x0, 0x0, 0x1f, 0x0, 0x11, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0xf, 0x20, 0x7b, 0x0,
-    0x0, 0xef, 0xff, 0xf3, 0xd, 0x40, 0xd6, 0x0,
-    0x0, 0xe6, 0x22, 0xf2, 0xa, 0x73, 0xf0, 0x0,
-    0x0, 0xe3, 0x0, 0xf2, 0x6, 0xbc, 0x80, 0x0,
-    0x0, 0xf2, 0x0, 0xf1, 0x2, 0xfe, 0x0, 0x0,
-    0x1, 0xf0, 0x2, 0xf0, 0x2, 0xf7, 0x0, 0x50,
-    0x4, 0xd3, 0xde, 0x90, 0xc, 0xcc, 0x0, 0xf1,
-    0x9, 0x90, 0x22, 0x0, 0xbb, 0xd, 0x42, 0xe0,
-    0xe, 0x30, 0x0, 0x1c, 0xc0, 0x5, 0xe9, 0xa0,
-    0x4c, 0x0, 0x0, 0xba, 0x0, 0x0, 0x7e, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+6253 "打" */
-    0x0, 0x9, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xa0, 0xa, 0xdd, 0xdd, 0xdd, 0xd5,
-    0x2, 0x29, 0xa2, 0x13, 0x44, 0x48, 0xe4, 0x42,
-    0x1f, 0xff, 0xff, 0xa0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x9, 0xa0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x9, 0xa0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x9, 0xa0, 0x50, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x9, 0xde, 0xb0, 0x0, 0x5, 0xd0, 0x0,
-    0x18, 0xdf, 0xd3, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x1a, 0x59, 0xa0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x9, 0xa0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x9, 0xa0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x9, 0xa0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x1, 0xa, 0x90, 0x0, 0x11, 0x18, 0xd0, 0x0,
-    0x9, 0xff, 0x50, 0x0, 0x7f, 0xff, 0x70, 0x0,
-
-    /* U+64AD "播" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0x0, 0x0, 0x12, 0x46, 0x9d, 0x80,
-    0x0, 0x3e, 0x1, 0xee, 0xee, 0xfa, 0x85, 0x10,
-    0x0, 0x3e, 0x0, 0x6, 0x3, 0xd0, 0x2a, 0x0,
-    0x1e, 0xff, 0xe3, 0xb, 0x53, 0xd0, 0xa6, 0x0,
-    0x1, 0x4e, 0x13, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x3e, 0x0, 0x0, 0xa8, 0xd8, 0x60, 0x0,
-    0x0, 0x3e, 0x1, 0x1b, 0x83, 0xd0, 0x99, 0x10,
-    0x0, 0x4f, 0xe9, 0xe6, 0x2, 0x80, 0x6, 0xe4,
-    0x2c, 0xff, 0x22, 0xbf, 0xff, 0xff, 0xff, 0x50,
-    0x15, 0x4e, 0x0, 0x97, 0x2, 0xd0, 0xd, 0x40,
-    0x0, 0x3e, 0x0, 0x9e, 0xdd, 0xfd, 0xdf, 0x40,
-    0x0, 0x3e, 0x0, 0x97, 0x13, 0xd1, 0x1d, 0x40,
-    0x0, 0x3e, 0x0, 0x97, 0x3, 0xd0, 0xd, 0x40,
-    0x3, 0x7e, 0x0, 0x9f, 0xee, 0xee, 0xef, 0x40,
-    0xc, 0xd6, 0x0, 0x97, 0x0, 0x0, 0xd, 0x40,
-
-    /* U+653E "放" */
-    0x0, 0x3, 0x0, 0x0, 0x3, 0x30, 0x0, 0x0,
-    0x0, 0xc, 0x70, 0x0, 0x9, 0x90, 0x0, 0x0,
-    0x0, 0x5, 0xe0, 0x0, 0xc, 0x50, 0x0, 0x0,
-    0x1e, 0xee, 0xfe, 0xe8, 0xf, 0xee, 0xee, 0xe0,
-    0x3, 0x8b, 0x33, 0x32, 0x5d, 0x33, 0x6e, 0x30,
-    0x0, 0x69, 0x0, 0x0, 0xb8, 0x0, 0x4c, 0x0,
-    0x0, 0x7a, 0x11, 0x13, 0xfc, 0x0, 0x6b, 0x0,
-    0x0, 0x8f, 0xff, 0xb8, 0x8f, 0x10, 0x98, 0x0,
-    0x0, 0x87, 0x5, 0xb0, 0xa, 0x60, 0xd5, 0x0,
-    0x0, 0xa6, 0x6, 0xb0, 0x4, 0xd2, 0xf0, 0x0,
-    0x0, 0xc4, 0x6, 0xb0, 0x0, 0xdd, 0xa0, 0x0,
-    0x0, 0xf1, 0x6, 0xb0, 0x0, 0x6f, 0x30, 0x0,
-    0x3, 0xe0, 0x7, 0xa0, 0x0, 0xcf, 0x90, 0x0,
-    0x7, 0xa0, 0x7, 0x90, 0xa, 0xd2, 0xe6, 0x0,
-    0xe, 0x50, 0xc, 0x81, 0xce, 0x10, 0x3f, 0x80,
-    0x2d, 0xb, 0xfd, 0x19, 0xb1, 0x0, 0x3, 0xd5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+6682 "暂" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0x0, 0x1, 0x5a, 0x20,
-    0x1f, 0xff, 0xff, 0xff, 0x4a, 0xee, 0xb6, 0x10,
-    0x0, 0xb9, 0x12, 0x0, 0xc, 0x40, 0x0, 0x0,
-    0x5, 0xf2, 0x7b, 0x11, 0xc, 0x52, 0x22, 0x20,
-    0x6, 0xdd, 0xef, 0xdd, 0x2e, 0xed, 0xfe, 0xd1,
-    0x0, 0x0, 0x6b, 0x23, 0x1f, 0x0, 0xe3, 0x0,
-    0xb, 0xff, 0xff, 0xcb, 0x7c, 0x0, 0xe3, 0x0,
-    0x1, 0x10, 0x6a, 0x0, 0xa5, 0x0, 0xe3, 0x0,
-    0x0, 0x3, 0x45, 0x33, 0x43, 0x33, 0x61, 0x0,
-    0x0, 0x2f, 0xcc, 0xcc, 0xcc, 0xcc, 0xf2, 0x0,
-    0x0, 0x2f, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x0,
-    0x0, 0x2f, 0xee, 0xee, 0xee, 0xee, 0xf2, 0x0,
-    0x0, 0x2f, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x2f, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x0,
-
-    /* U+66F2 "曲" */
-    0x0, 0x0, 0x3e, 0x0, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0x0, 0xe3, 0x0, 0x0, 0x2, 0x22,
-    0x5e, 0x22, 0xe5, 0x22, 0x20, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x2e, 0x0, 0x3e, 0x0,
-    0xe3, 0x0, 0xe2, 0x2e, 0x0, 0x3e, 0x0, 0xe3,
-    0x0, 0xe2, 0x2e, 0x0, 0x3e, 0x0, 0xe3, 0x0,
-    0xe2, 0x2f, 0x44, 0x7f, 0x44, 0xf7, 0x44, 0xf2,
-    0x2f, 0xcc, 0xdf, 0xcc, 0xfd, 0xcc, 0xf2, 0x2e,
-    0x0, 0x3e, 0x0, 0xe3, 0x0, 0xe2, 0x2e, 0x0,
-    0x3e, 0x0, 0xe3, 0x0, 0xe2, 0x2e, 0x0, 0x3e,
-    0x0, 0xe3, 0x0, 0xe2, 0x2e, 0x22, 0x5e, 0x22,
-    0xe5, 0x22, 0xe2, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x2e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe2,
-
-    /* U+6B4C "歌" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x40, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x3a, 0x70, 0x0, 0x0,
-    0x0, 0x11, 0x11, 0xa7, 0xd, 0xa8, 0x88, 0x50,
-    0x7, 0xdc, 0xe5, 0xa6, 0x1f, 0x88, 0x8c, 0x90,
-    0x7, 0x70, 0xa5, 0xa6, 0x6b, 0x1, 0xa, 0x60,
-    0x6, 0xcb, 0xc4, 0xa6, 0xd5, 0x4d, 0xd, 0x20,
-    0x0, 0x0, 0x0, 0x76, 0xa0, 0x4c, 0x1f, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x5b, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x97, 0x0, 0x7e, 0x0, 0x0,
-    0x6, 0xdc, 0xd5, 0x97, 0x0, 0xaf, 0x30, 0x0,
-    0x7, 0x70, 0x95, 0x97, 0x0, 0xe7, 0xa0, 0x0,
-    0x7, 0xdb, 0xe5, 0x97, 0x4, 0xe0, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x97, 0xd, 0x60, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0xa7, 0xbb, 0x0, 0x9, 0xb0,
-    0x0, 0x0, 0x8f, 0xe6, 0xc1, 0x0, 0x0, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+706F "灯" */
-    0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x30, 0xf, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0xe, 0x30, 0x71, 0x11, 0x1c, 0x71, 0x10,
-    0x8, 0x2e, 0x4b, 0x90, 0x0, 0xc, 0x70, 0x0,
-    0xc, 0x2e, 0xea, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0xd, 0x1e, 0x80, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0xf, 0xe, 0x30, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x2d, 0xf, 0x20, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x1, 0xf, 0x10, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x0, 0x6c, 0xb8, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x0, 0xa8, 0x1e, 0x50, 0x0, 0xc, 0x70, 0x0,
-    0x1, 0xf2, 0x5, 0x60, 0x0, 0xc, 0x70, 0x0,
-    0xa, 0xb0, 0x0, 0x0, 0x0, 0x1d, 0x60, 0x0,
-    0xc, 0x20, 0x0, 0x0, 0x6f, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+7535 "电" */
-    0x0, 0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0xf5, 0x22, 0x2e,
-    0x52, 0x22, 0xd4, 0x0, 0xf3, 0x0, 0xe, 0x30,
-    0x0, 0xd4, 0x0, 0xf5, 0x33, 0x3e, 0x63, 0x33,
-    0xd4, 0x0, 0xfe, 0xdd, 0xdf, 0xed, 0xdd, 0xf4,
-    0x0, 0xf3, 0x0, 0xe, 0x30, 0x0, 0xd4, 0x0,
-    0xf3, 0x0, 0xe, 0x30, 0x0, 0xd4, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xf5, 0x22,
-    0x2e, 0x52, 0x22, 0x20, 0x0, 0x51, 0x0, 0xe,
-    0x30, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xe, 0x30,
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0xc, 0x81, 0x11,
-    0x16, 0xd0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xfe,
-    0x60,
-
-    /* U+7EA2 "红" */
-    0x0, 0x8, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x30, 0xf, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x7b, 0x0, 0x2, 0x22, 0xc7, 0x22, 0x10,
-    0x1, 0xe3, 0xb, 0x50, 0x0, 0xc6, 0x0, 0x0,
-    0x9, 0x90, 0x4e, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x4f, 0xbd, 0xf5, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x16, 0x49, 0xc0, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x0, 0x2e, 0x20, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x0, 0xc6, 0x3, 0x20, 0x0, 0xc6, 0x0, 0x0,
-    0xa, 0xea, 0xed, 0x30, 0x0, 0xc6, 0x0, 0x0,
-    0xc, 0x96, 0x20, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x3, 0x6a, 0xed, 0x22, 0x22, 0xc7, 0x22, 0x20,
-    0x5f, 0xb7, 0x30, 0x7f, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+7EFF "绿" */
-    0x0, 0x6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x10, 0x2f, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0,
-    0x2, 0xe1, 0x2b, 0xb, 0xff, 0xff, 0xf7, 0x0,
-    0xb, 0x74, 0xb8, 0x0, 0x0, 0x0, 0xb5, 0x0,
-    0x2f, 0xcd, 0xe1, 0xac, 0xcc, 0xcc, 0xfd, 0xc0,
-    0x0, 0xe, 0x50, 0x34, 0x45, 0xf4, 0x44, 0x40,
-    0x0, 0x8b, 0x0, 0x52, 0x1, 0xf1, 0x8, 0x70,
-    0x3, 0xe4, 0x76, 0x7e, 0x44, 0xf8, 0x4f, 0x20,
-    0xf, 0xff, 0xa3, 0x4, 0x6e, 0xfc, 0xe4, 0x0,
-    0x5, 0x30, 0x0, 0x1, 0xd6, 0xf3, 0xd1, 0x0,
-    0x0, 0x0, 0x32, 0x2d, 0x71, 0xf0, 0x8c, 0x10,
-    0x4, 0x8d, 0xf8, 0xf8, 0x1, 0xf0, 0xb, 0xd2,
-    0x4f, 0xb6, 0x3, 0x60, 0x2, 0xf0, 0x0, 0xa1,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0,
-
-    /* U+81EA "自" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5d, 0x0, 0x0, 0x0, 0x2, 0x22, 0xb8, 0x22,
-    0x22, 0x20, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x4e, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x4e, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0x4f, 0xee, 0xee, 0xee,
-    0xee, 0xf4, 0x4e, 0x22, 0x22, 0x22, 0x22, 0xe4,
-    0x4e, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x4e, 0x11,
-    0x11, 0x11, 0x11, 0xe4, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x4e, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x4e, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x4f, 0x55,
-    0x55, 0x55, 0x55, 0xe4, 0x4f, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xf4, 0x4e, 0x0, 0x0, 0x0, 0x0, 0xe4,
-
-    /* U+8272 "色" */
-    0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xdc, 0xcc, 0xcb, 0x0, 0x0,
-    0x0, 0x7, 0xd4, 0x44, 0x44, 0xea, 0x0, 0x0,
-    0x0, 0x8e, 0x20, 0x0, 0x7, 0xe1, 0x0, 0x0,
-    0xb, 0xf7, 0x44, 0x44, 0x6f, 0x84, 0x44, 0x0,
-    0x8, 0x5f, 0xcc, 0xcd, 0xfc, 0xcc, 0xde, 0x0,
-    0x0, 0x4e, 0x0, 0x3, 0xe0, 0x0, 0x4e, 0x0,
-    0x0, 0x4e, 0x0, 0x3, 0xe0, 0x0, 0x4e, 0x0,
-    0x0, 0x4f, 0x55, 0x57, 0xf5, 0x55, 0x7e, 0x0,
-    0x0, 0x4f, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0x0,
-    0x0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd1,
-    0x0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf0,
-    0x0, 0x3f, 0x31, 0x11, 0x11, 0x11, 0x29, 0xc0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+84DD "蓝" */
-    0x0, 0x0, 0x4e, 0x0, 0x0, 0xe4, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1, 0x22, 0x5e, 0x22, 0x22, 0xe5, 0x22, 0x10,
-    0x0, 0x0, 0x17, 0x0, 0x4, 0x51, 0x0, 0x0,
-    0x0, 0xa1, 0xf, 0x20, 0x2f, 0x51, 0x11, 0x0,
-    0x0, 0xf1, 0xf, 0x20, 0xaf, 0xff, 0xff, 0x80,
-    0x0, 0xf1, 0xf, 0x28, 0xf2, 0x22, 0x0, 0x0,
-    0x0, 0xf1, 0xf, 0x2a, 0x40, 0x5e, 0x80, 0x0,
-    0x0, 0x50, 0xb, 0x10, 0x0, 0x0, 0x82, 0x0,
-    0x0, 0x5d, 0xdd, 0xdd, 0xdd, 0xdd, 0xd5, 0x0,
-    0x0, 0x6b, 0x36, 0xe3, 0x3f, 0x53, 0xb6, 0x0,
-    0x0, 0x6a, 0x3, 0xe0, 0xf, 0x20, 0xa6, 0x0,
-    0x0, 0x6a, 0x3, 0xe0, 0xf, 0x20, 0xa6, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-
-    /* U+8C03 "调" */
-    0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc1, 0xe, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7, 0xd0, 0xe3, 0x3, 0xc1, 0x2, 0xf0, 0x0,
-    0x0, 0xe, 0x4b, 0xcf, 0xbb, 0x2f, 0x15, 0x55,
-    0x0, 0xe3, 0x36, 0xf4, 0x32, 0xf4, 0xff, 0xf0,
-    0xe, 0x30, 0x4f, 0x10, 0x2f, 0x0, 0x1f, 0x0,
-    0xe7, 0xee, 0xee, 0xe6, 0xf0, 0x1, 0xf0, 0xe,
-    0x20, 0x0, 0x0, 0x2f, 0x0, 0x1f, 0x0, 0xe2,
-    0xef, 0xff, 0xb2, 0xf0, 0x1, 0xf0, 0xe, 0x2e,
-    0x10, 0x4b, 0x2f, 0x0, 0x1f, 0x23, 0xf1, 0xe1,
-    0x4, 0xb2, 0xf0, 0x1, 0xfe, 0x6f, 0xe, 0xff,
-    0xfb, 0x2f, 0x0, 0x4f, 0x85, 0xd0, 0x0, 0x0,
-    0x2, 0xf0, 0x3, 0x90, 0xb7, 0x0, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0xc, 0x10, 0x0, 0x2, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+946B "鑫" */
-    0x0, 0x0, 0x1, 0x8d, 0xb4, 0x0, 0x0, 0x0,
-    0x2, 0x7b, 0xc4, 0x3, 0xad, 0x94, 0x0, 0xd,
-    0xc8, 0xdc, 0xce, 0xdc, 0xd9, 0xbe, 0x60, 0x3,
-    0x55, 0x55, 0xd7, 0x55, 0x54, 0x0, 0x0, 0x36,
-    0xf7, 0x6d, 0x86, 0xca, 0x50, 0x0, 0x5a, 0xae,
-    0xba, 0xeb, 0xaf, 0xba, 0x90, 0x1, 0x36, 0xc5,
-    0x33, 0x33, 0x9b, 0x32, 0x0, 0x18, 0xb5, 0xc8,
-    0x0, 0x99, 0x7c, 0x30, 0x2d, 0xd9, 0x99, 0x96,
-    0xdd, 0x77, 0xbf, 0x80, 0x3, 0x7c, 0x31, 0x42,
-    0x48, 0xb4, 0x22, 0x9, 0xde, 0xfd, 0xd1, 0xab,
-    0xde, 0xbb, 0x0, 0x22, 0x4b, 0x16, 0x5, 0x37,
-    0xa2, 0x80, 0x3, 0xa4, 0xb5, 0xa0, 0x59, 0x6a,
-    0x49, 0x1, 0xaf, 0xdf, 0xdb, 0x7e, 0xff, 0xff,
-    0xf8, 0x4, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+95ED "闭" */
-    0x0, 0x87, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x40, 0x7f, 0xff, 0xff, 0xfd, 0x0, 0x7,
-    0xd0, 0x1, 0x11, 0x11, 0x5d, 0x3e, 0x0, 0x30,
-    0x0, 0xe1, 0x0, 0x4d, 0x3e, 0x0, 0x0, 0x0,
-    0xf2, 0x0, 0x4d, 0x3e, 0xe, 0xff, 0xff, 0xff,
-    0xf3, 0x4d, 0x3e, 0x2, 0x22, 0x28, 0xf4, 0x20,
-    0x4d, 0x3e, 0x0, 0x0, 0x1d, 0xf2, 0x0, 0x4d,
-    0x3e, 0x0, 0x1, 0xd5, 0xf2, 0x0, 0x4d, 0x3e,
-    0x0, 0x2d, 0x70, 0xf2, 0x0, 0x4d, 0x3e, 0x7,
-    0xf7, 0x0, 0xf2, 0x0, 0x4d, 0x3e, 0x2e, 0x40,
-    0x0, 0xf2, 0x0, 0x4d, 0x3e, 0x0, 0x0, 0x56,
-    0xf1, 0x0, 0x4d, 0x3e, 0x0, 0x0, 0xab, 0x70,
-    0x0, 0x7c, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf6,
-
-    /* U+97F3 "音" */
-    0x0, 0x0, 0x0, 0x1e, 0x20, 0x0, 0x0, 0x0,
-    0x1, 0x44, 0x44, 0x4c, 0xa4, 0x44, 0x44, 0x10,
-    0x3, 0xcc, 0xfd, 0xcc, 0xcc, 0xde, 0xcc, 0x40,
-    0x0, 0x0, 0x8b, 0x0, 0x0, 0x97, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x10, 0x1, 0xe1, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
-    0x0, 0xb, 0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0xf, 0x74, 0x44, 0x44, 0x46, 0xf0, 0x0,
-    0x0, 0xf, 0x30, 0x0, 0x0, 0x2, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0xf, 0x41, 0x11, 0x11, 0x13, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0x30, 0x0, 0x0, 0x2, 0xf0, 0x0,
-
-    /* U+989C "颜" */
-    0x0, 0x3, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xf4,
-    0x1, 0xa7, 0x17, 0xa0, 0x11, 0x3f, 0x21, 0x10,
-    0x0, 0x78, 0x9, 0x60, 0x29, 0xaf, 0x99, 0x70,
-    0x3, 0x8c, 0x4d, 0x74, 0x4e, 0xaa, 0xab, 0xd0,
-    0xd, 0xcc, 0xcc, 0xcb, 0x4d, 0x7, 0x4, 0xd0,
-    0xd, 0x30, 0x4, 0xa0, 0x4d, 0xf, 0x14, 0xd0,
-    0xd, 0x33, 0xad, 0x30, 0x4d, 0xf, 0x14, 0xd0,
-    0xd, 0x5c, 0x60, 0x72, 0x4d, 0x1f, 0x4, 0xd0,
-    0xe, 0x20, 0x2b, 0xb0, 0x4d, 0x2f, 0x4, 0xd0,
-    0xf, 0x1b, 0xe7, 0x3, 0x4d, 0x6c, 0x4, 0xd0,
-    0x1f, 0x3, 0x1, 0xba, 0x1, 0xc8, 0xa3, 0x10,
-    0x4c, 0x0, 0x6e, 0x90, 0xa, 0xe1, 0x7f, 0x30,
-    0x79, 0x5f, 0xc4, 0x4, 0xed, 0x20, 0x6, 0xf2,
-    0x2, 0x12, 0x0, 0x1, 0x60, 0x0, 0x0, 0x40
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 85, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 85, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18, .adv_w = 117, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 36, .adv_w = 154, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 96, .adv_w = 154, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 168, .adv_w = 248, .box_w = 14, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 252, .adv_w = 186, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 324, .adv_w = 67, .box_w = 4, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 334, .adv_w = 85, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 374, .adv_w = 85, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 414, .adv_w = 130, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 446, .adv_w = 155, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 487, .adv_w = 68, .box_w = 4, .box_h = 5, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 497, .adv_w = 155, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 506, .adv_w = 68, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 511, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 575, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 629, .adv_w = 154, .box_w = 5, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 659, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 713, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 767, .adv_w = 154, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 827, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 881, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 935, .adv_w = 154, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 983, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1037, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1091, .adv_w = 68, .box_w = 3, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1105, .adv_w = 68, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1123, .adv_w = 155, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1164, .adv_w = 155, .box_w = 9, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 1187, .adv_w = 155, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1228, .adv_w = 137, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1276, .adv_w = 220, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1354, .adv_w = 168, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1420, .adv_w = 173, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1480, .adv_w = 186, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1546, .adv_w = 181, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1606, .adv_w = 163, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1660, .adv_w = 148, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1708, .adv_w = 191, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1774, .adv_w = 184, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1834, .adv_w = 61, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1846, .adv_w = 132, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1894, .adv_w = 177, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1960, .adv_w = 151, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2014, .adv_w = 226, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2086, .adv_w = 184, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2146, .adv_w = 196, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2218, .adv_w = 164, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2272, .adv_w = 196, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2350, .adv_w = 173, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2410, .adv_w = 162, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2470, .adv_w = 158, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2530, .adv_w = 183, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2590, .adv_w = 164, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2656, .adv_w = 238, .box_w = 15, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2746, .adv_w = 163, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2812, .adv_w = 169, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2878, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2938, .adv_w = 85, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2981, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3045, .adv_w = 85, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3088, .adv_w = 133, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 3112, .adv_w = 128, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3120, .adv_w = 85, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 3126, .adv_w = 143, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3162, .adv_w = 150, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3216, .adv_w = 140, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3257, .adv_w = 150, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3311, .adv_w = 142, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3352, .adv_w = 95, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3388, .adv_w = 151, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3442, .adv_w = 142, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3490, .adv_w = 66, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3508, .adv_w = 68, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 3546, .adv_w = 135, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3600, .adv_w = 60, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3612, .adv_w = 219, .box_w = 13, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3671, .adv_w = 143, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3707, .adv_w = 150, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3748, .adv_w = 150, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3802, .adv_w = 150, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3856, .adv_w = 93, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3883, .adv_w = 129, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3919, .adv_w = 91, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3955, .adv_w = 143, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3991, .adv_w = 123, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4027, .adv_w = 193, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4081, .adv_w = 130, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4122, .adv_w = 127, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4170, .adv_w = 125, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4206, .adv_w = 85, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4249, .adv_w = 50, .box_w = 2, .box_h = 17, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4266, .adv_w = 85, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4309, .adv_w = 128, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 4321, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4321, .adv_w = 256, .box_w = 16, .box_h = 2, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 4337, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4449, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4577, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4682, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4802, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4930, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5050, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5178, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5298, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5434, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5554, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5682, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5818, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5946, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 6051, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 6179, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 6307, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 6412, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6532, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6652, .adv_w = 256, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 6748, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 6884, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7004, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 7124, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7237, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 7342, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7462, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0xb, 0x49, 0x50, 0x25c, 0x373, 0x407, 0xd9a,
-    0x1100, 0x1410, 0x1453, 0x16ad, 0x173e, 0x1882, 0x18f2, 0x1d4c,
-    0x226f, 0x2735, 0x30a2, 0x30ff, 0x33ea, 0x3472, 0x36dd, 0x3e03,
-    0x466b, 0x47ed, 0x49f3, 0x4a9c
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 96, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 19968, .range_length = 19101, .glyph_id_start = 97,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 28, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 2,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t font_cn_gb1_16 = {
-#else
-lv_font_t font_cn_gb1_16 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 18,          /*The maximum line height required by the font*/
-    .base_line = 3,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if FONT_CN_GB1_16*/
-
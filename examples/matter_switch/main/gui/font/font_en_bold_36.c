@@ -1,3008 +0,0 @@
-/*******************************************************************************
- * Size: 36 px
- * Bpp: 4
- * Opts: 
- ******************************************************************************/
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef FONT_EN_BOLD_36
-#define FONT_EN_BOLD_36 1
-#endif
-
-#if FONT_EN_BOLD_36
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x3f, 0xff, 0xf3, 0x2f, 0xff, 0xf2, 0x2f, 0xff,
-    0xf2, 0x1f, 0xff, 0xf1, 0xf, 0xff, 0xf0, 0xf,
-    0xff, 0xf0, 0xf, 0xff, 0xf0, 0xe, 0xff, 0xe0,
-    0xd, 0xff, 0xd0, 0xd, 0xff, 0xd0, 0xc, 0xff,
-    0xc0, 0xb, 0xff, 0xb0, 0xb, 0xff, 0xa0, 0xa,
-    0xff, 0xa0, 0x9, 0xff, 0x90, 0x8, 0xff, 0x80,
-    0x8, 0xff, 0x80, 0x7, 0xff, 0x70, 0x2, 0x55,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xa0, 0x6f, 0xff, 0xf6, 0x9f, 0xff, 0xf9,
-    0x5f, 0xff, 0xf5, 0x7, 0xee, 0x80,
-
-    /* U+0022 "\"" */
-    0x1f, 0xff, 0xe0, 0x0, 0xdf, 0xff, 0x20, 0xff,
-    0xfd, 0x0, 0xc, 0xff, 0xf1, 0xf, 0xff, 0xc0,
-    0x0, 0xcf, 0xff, 0x0, 0xef, 0xfb, 0x0, 0xb,
-    0xff, 0xf0, 0xd, 0xff, 0xa0, 0x0, 0xaf, 0xfe,
-    0x0, 0xcf, 0xf9, 0x0, 0x9, 0xff, 0xd0, 0xb,
-    0xff, 0x90, 0x0, 0x8f, 0xfc, 0x0, 0xaf, 0xf8,
-    0x0, 0x7, 0xff, 0xb0, 0x9, 0xff, 0x70, 0x0,
-    0x6f, 0xfa, 0x0, 0x1, 0x10, 0x0, 0x0, 0x11,
-    0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0xc,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf3,
-    0x0, 0x0, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x10, 0x0, 0x1f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x4, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0,
-    0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xa0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0,
-    0x3c, 0xcc, 0xef, 0xfe, 0xcc, 0xcc, 0xef, 0xfd,
-    0xcc, 0x70, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0x3f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x5,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfa,
-    0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x80, 0x0, 0xb, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf5, 0x0, 0x0, 0xef,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x20,
-    0x0, 0xf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x6f, 0xfb,
-    0x0, 0x0, 0x0, 0x8c, 0xcd, 0xff, 0xec, 0xcc,
-    0xce, 0xff, 0xec, 0xcc, 0x30, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xef, 0xf3, 0x0, 0x0,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x0, 0x0, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xe0, 0x0, 0x5, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0x7f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x90,
-    0x0, 0x9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf7, 0x0, 0x0, 0xcf, 0xf5, 0x0, 0x0,
-    0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0xce, 0xff, 0xff, 0xda, 0x40, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x5, 0xff, 0xff, 0xc5,
-    0x8f, 0xe5, 0xaf, 0xff, 0xf8, 0x0, 0xc, 0xff,
-    0xf8, 0x0, 0x6f, 0xd0, 0x5, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xe0, 0x0, 0x6f, 0xd0, 0x0, 0xaf,
-    0xff, 0x50, 0x3f, 0xff, 0xb0, 0x0, 0x6f, 0xd0,
-    0x0, 0x4f, 0xff, 0x80, 0x2f, 0xff, 0xc0, 0x0,
-    0x6f, 0xd0, 0x0, 0x6, 0x66, 0x40, 0xf, 0xff,
-    0xf4, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x60, 0x6f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfd, 0xbf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xef, 0xff, 0xff, 0xff, 0xe8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xbf, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe8, 0xef, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xd0, 0x8, 0xff, 0xff, 0x80,
-    0x1, 0x11, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x7f,
-    0xff, 0xe0, 0x7f, 0xff, 0x60, 0x0, 0x6f, 0xd0,
-    0x0, 0xe, 0xff, 0xf0, 0x5f, 0xff, 0x80, 0x0,
-    0x6f, 0xd0, 0x0, 0xc, 0xff, 0xf1, 0x2f, 0xff,
-    0xd0, 0x0, 0x6f, 0xd0, 0x0, 0xe, 0xff, 0xf0,
-    0xd, 0xff, 0xf5, 0x0, 0x6f, 0xd0, 0x0, 0x7f,
-    0xff, 0xd0, 0x6, 0xff, 0xff, 0x70, 0x6f, 0xd0,
-    0x29, 0xff, 0xff, 0x70, 0x0, 0xdf, 0xff, 0xff,
-    0xef, 0xfd, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x46, 0xaf, 0xe7,
-    0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0x70, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x3, 0xae, 0xfe, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfc, 0x8b, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xc0, 0x0, 0xbf, 0xfe, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x60, 0x0, 0x5f, 0xff, 0x40, 0x0,
-    0x0, 0xd, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x20, 0x0, 0x1f, 0xff, 0x70, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x10, 0x0, 0xf, 0xff, 0x90, 0x0,
-    0x1, 0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x10, 0x0, 0xf, 0xff, 0x90, 0x0,
-    0x8, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x20, 0x0, 0xf, 0xff, 0x80, 0x0,
-    0x1f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x40, 0x0, 0x3f, 0xff, 0x50, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x90, 0x0, 0x7f, 0xff, 0x10, 0x2,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf5, 0x4, 0xff, 0xfa, 0x0, 0xb,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x4f,
-    0xfb, 0x0, 0x0, 0x7c, 0xff, 0xd8, 0x10, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xfb, 0x10, 0x0, 0xcf,
-    0xf2, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x15, 0x65, 0x20, 0x0, 0x5, 0xff,
-    0x90, 0x0, 0xcf, 0xff, 0x88, 0xef, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x10, 0x5, 0xff, 0xf4, 0x0, 0x2f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8,
-    0x0, 0xa, 0xff, 0xe0, 0x0, 0xc, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0,
-    0x0, 0xd, 0xff, 0xb0, 0x0, 0x8, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x60,
-    0x0, 0xf, 0xff, 0xa0, 0x0, 0x7, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd, 0x0,
-    0x0, 0xf, 0xff, 0xa0, 0x0, 0x7, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0,
-    0x0, 0xd, 0xff, 0xb0, 0x0, 0x8, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x0,
-    0x0, 0xa, 0xff, 0xe0, 0x0, 0xc, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0,
-    0x0, 0x5, 0xff, 0xf4, 0x0, 0x3f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x98, 0xef, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0xff, 0xd8, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x88, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x60, 0x4, 0xef, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8,
-    0x0, 0x0, 0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf5, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf8, 0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x20,
-    0x0, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xc0, 0x1a, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xfb, 0xef, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0xaf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0xcf, 0xff, 0x20,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xbf, 0xff, 0xf6,
-    0x0, 0x0, 0xef, 0xff, 0x10, 0x0, 0x0, 0xdf,
-    0xff, 0xe4, 0x6, 0xff, 0xff, 0x60, 0x1, 0xff,
-    0xfe, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x20, 0x0,
-    0x7f, 0xff, 0xf5, 0x5, 0xff, 0xfb, 0x0, 0x0,
-    0x1f, 0xff, 0xf2, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x49, 0xff, 0xf7, 0x0, 0x0, 0x6f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfe, 0xff, 0xf2,
-    0x0, 0x0, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x8f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xe2, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xa3, 0x0, 0x2, 0x8e, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xef, 0xff, 0xd1, 0x0,
-    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x2e, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7d,
-    0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x25, 0x67, 0x65,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x1f, 0xff, 0xe0, 0xff, 0xfd, 0xf, 0xff, 0xc0,
-    0xef, 0xfb, 0xd, 0xff, 0xa0, 0xcf, 0xf9, 0xb,
-    0xff, 0x90, 0xaf, 0xf8, 0x9, 0xff, 0x70, 0x1,
-    0x10,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x78, 0x81, 0x0, 0x0, 0x8,
-    0xff, 0xc0, 0x0, 0x0, 0x2f, 0xff, 0x30, 0x0,
-    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x4, 0xff, 0xf3,
-    0x0, 0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x9f, 0xff, 0x10, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x3, 0xff, 0xf6,
-    0x0, 0x0, 0x8, 0xff, 0xf2, 0x0, 0x0, 0xc,
-    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xb0, 0x0,
-    0x0, 0x1f, 0xff, 0x90, 0x0, 0x0, 0x3f, 0xff,
-    0x70, 0x0, 0x0, 0x4f, 0xff, 0x60, 0x0, 0x0,
-    0x5f, 0xff, 0x50, 0x0, 0x0, 0x5f, 0xff, 0x50,
-    0x0, 0x0, 0x5f, 0xff, 0x60, 0x0, 0x0, 0x4f,
-    0xff, 0x60, 0x0, 0x0, 0x2f, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0xd, 0xff,
-    0xd0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0,
-    0x6, 0xff, 0xf4, 0x0, 0x0, 0x1, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x30, 0x0, 0x0, 0xf, 0xff, 0x90,
-    0x0, 0x0, 0x8, 0xff, 0xf1, 0x0, 0x0, 0x1,
-    0xef, 0xf7, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x80, 0x0, 0x0, 0x3,
-    0xff, 0xf1,
-
-    /* U+0029 ")" */
-    0x18, 0x87, 0x0, 0x0, 0x0, 0xc, 0xff, 0x70,
-    0x0, 0x0, 0x3, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x30,
-    0x0, 0x0, 0xd, 0xff, 0xb0, 0x0, 0x0, 0x7,
-    0xff, 0xf2, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x30, 0x0, 0x0, 0x2f, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xb0, 0x0, 0x0, 0xc, 0xff,
-    0xf0, 0x0, 0x0, 0xa, 0xff, 0xf1, 0x0, 0x0,
-    0x7, 0xff, 0xf3, 0x0, 0x0, 0x6, 0xff, 0xf4,
-    0x0, 0x0, 0x6, 0xff, 0xf5, 0x0, 0x0, 0x5,
-    0xff, 0xf5, 0x0, 0x0, 0x6, 0xff, 0xf5, 0x0,
-    0x0, 0x7, 0xff, 0xf4, 0x0, 0x0, 0x9, 0xff,
-    0xf2, 0x0, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x0,
-    0xd, 0xff, 0xd0, 0x0, 0x0, 0x1f, 0xff, 0xa0,
-    0x0, 0x0, 0x5f, 0xff, 0x60, 0x0, 0x0, 0x9f,
-    0xff, 0x10, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0,
-    0x4, 0xff, 0xf6, 0x0, 0x0, 0xa, 0xff, 0xe0,
-    0x0, 0x0, 0x1f, 0xff, 0x70, 0x0, 0x0, 0x8f,
-    0xfe, 0x0, 0x0, 0x1, 0xff, 0xf6, 0x0, 0x0,
-    0x8, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0x20,
-    0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x2, 0x93, 0x0, 0x2,
-    0xff, 0xa0, 0x0, 0x6, 0x80, 0x8, 0xff, 0xc6,
-    0x1, 0xff, 0x90, 0x39, 0xff, 0xf0, 0xd, 0xff,
-    0xff, 0xf9, 0xff, 0xcc, 0xff, 0xff, 0xf5, 0x6,
-    0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x82,
-    0x0, 0x0, 0x37, 0xcf, 0xff, 0xfe, 0x95, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x71,
-    0xef, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xfc,
-    0x0, 0x4f, 0xff, 0x60, 0x0, 0x0, 0xc, 0xff,
-    0xf2, 0x0, 0x9, 0xff, 0xf4, 0x0, 0x0, 0x5,
-    0xff, 0x60, 0x0, 0x0, 0xdf, 0xb1, 0x0, 0x0,
-    0x0, 0x28, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x22, 0x22, 0x22, 0x2b, 0xff, 0x82, 0x22,
-    0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf7, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x1, 0x44, 0x0, 0x3, 0xef, 0xfd, 0x10, 0xcf,
-    0xff, 0xf9, 0xe, 0xff, 0xff, 0xf0, 0xaf, 0xff,
-    0xff, 0x11, 0xaf, 0xff, 0xf1, 0x0, 0x8, 0xfe,
-    0x0, 0x0, 0xdf, 0xa0, 0x0, 0x8f, 0xf2, 0x1,
-    0x9f, 0xf8, 0x0, 0xcf, 0xf8, 0x0, 0xc, 0xd4,
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+002D "-" */
-    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+002E "." */
-    0x0, 0x32, 0x0, 0x1d, 0xff, 0xb0, 0x9f, 0xff,
-    0xf6, 0xbf, 0xff, 0xf8, 0x7f, 0xff, 0xf4, 0x9,
-    0xee, 0x70,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xec, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xfe, 0x85, 0x6a, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x9f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0xf3, 0x0, 0x2, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfb, 0x0, 0x7, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0xc, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x60,
-    0xf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x90, 0x3f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x5f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x6f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf1, 0x6f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x5f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0,
-    0x4f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xd0, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xb0, 0xe, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x80, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x30,
-    0x4, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xfe, 0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0,
-    0xb, 0xff, 0xf7, 0x0, 0x0, 0x5f, 0xff, 0xf7,
-    0x0, 0x2, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfd, 0xef, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x57, 0x65, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x40, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x0, 0x2, 0xaf, 0xff, 0xff,
-    0x40, 0x39, 0xff, 0xff, 0xff, 0xf4, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0x8a, 0xff,
-    0xf4, 0x8f, 0xfc, 0x30, 0xaf, 0xff, 0x48, 0xb4,
-    0x0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x40, 0x0, 0x0, 0xa, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0xa,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x40,
-    0x0, 0x0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x40, 0x0, 0x0, 0xa, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x40, 0x0, 0x0,
-    0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x40, 0x0, 0x0, 0xa, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x40, 0x0,
-    0x0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x40, 0x0, 0x0, 0xa, 0xff, 0xf4,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x49, 0xde, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x1, 0xef, 0xff,
-    0xe8, 0x55, 0x7b, 0xff, 0xff, 0x60, 0x0, 0xaf,
-    0xff, 0xc0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x0,
-    0x2f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf5, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x80, 0xbf, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf9, 0xd, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x80, 0x8a, 0xaa,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x40, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-
-    /* U+0033 "3" */
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x6f,
-    0xff, 0xfd, 0x85, 0x57, 0xbf, 0xff, 0xfa, 0x0,
-    0x1, 0xef, 0xff, 0x70, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x20, 0x6, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x60, 0xb, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x80, 0xc, 0xee,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x6e, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x6d, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xd0, 0x12, 0x22, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf0, 0x5f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0x3f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0,
-    0xe, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xc0, 0x9, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xff, 0x70, 0x1, 0xff, 0xff, 0xd4,
-    0x0, 0x0, 0x5e, 0xff, 0xfe, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x67, 0x76, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfb, 0xcf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x1c, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x30,
-    0xcf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0xc, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xa0, 0x0, 0xcf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xd0, 0x0, 0xc,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf2,
-    0x0, 0x0, 0xcf, 0xff, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf5, 0x0, 0x0, 0xc, 0xff, 0xf0, 0x0,
-    0x0, 0x1, 0xef, 0xf9, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x0, 0x0, 0x0, 0xcf, 0xfc, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf0, 0x0, 0x0, 0x9f, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x0, 0x0,
-    0x3f, 0xff, 0x40, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x1c, 0xff, 0xf1, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x0,
-    0x0,
-
-    /* U+0035 "5" */
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xef,
-    0xfc, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x0,
-    0x0, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x5, 0xae, 0xff,
-    0xd9, 0x30, 0x0, 0x0, 0x9, 0xff, 0xe2, 0xdf,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xc, 0xff, 0xff, 0xe9, 0x53, 0x36, 0xcf, 0xff,
-    0xf9, 0x0, 0xd, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x20, 0xc, 0xdd, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0x5f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xd0,
-    0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x90, 0xd, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x30, 0x5, 0xff, 0xff, 0x91,
-    0x0, 0x1, 0x8f, 0xff, 0xfa, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xed, 0xef, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff,
-    0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14,
-    0x67, 0x65, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x9,
-    0xff, 0xfe, 0x84, 0x46, 0xcf, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xd1, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x50, 0x3, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0xdd, 0x70, 0x8, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x80, 0x4, 0xad, 0xff,
-    0xd9, 0x40, 0x0, 0x0, 0x3f, 0xff, 0x61, 0xbf,
-    0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x5f, 0xff,
-    0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x6f, 0xff, 0xef, 0xfb, 0x53, 0x35, 0xbf, 0xff,
-    0xfa, 0x0, 0x6f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x30, 0x6f, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x90, 0x5f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xd0,
-    0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf0, 0x2f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf1, 0xf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0xb, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x6, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xa0, 0x0, 0xef, 0xfe, 0x10, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x40, 0x0, 0x6f, 0xff, 0xe4,
-    0x0, 0x0, 0x5e, 0xff, 0xfb, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xec, 0xce, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x57, 0x76, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x78, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x8d, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb6, 0x10,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xdf,
-    0xff, 0xe8, 0x32, 0x25, 0xaf, 0xff, 0xf7, 0x0,
-    0x6, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x0, 0xb, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x40, 0xd, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x60, 0xc, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x60,
-    0xa, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x40, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xfd, 0x0, 0x0, 0xaf, 0xff, 0xa3,
-    0x0, 0x1, 0x5d, 0xff, 0xf4, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfe, 0xef, 0xff, 0xfd, 0x40, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x3, 0xff, 0xff, 0xb4,
-    0x10, 0x2, 0x7e, 0xff, 0xfc, 0x0, 0xd, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x70,
-    0x5f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xe0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf3, 0xcf, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf5, 0xbf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf4,
-    0x9f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf2, 0x4f, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xe0, 0xc, 0xff, 0xfe, 0x50,
-    0x0, 0x0, 0x18, 0xff, 0xff, 0x60, 0x2, 0xef,
-    0xff, 0xff, 0xca, 0xbd, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x7d, 0xff, 0xff, 0xff,
-    0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
-    0x67, 0x76, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x2, 0x8c, 0xef, 0xec, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfa, 0x53, 0x48, 0xef, 0xff, 0xb0, 0x0,
-    0x6, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x1c, 0xff,
-    0xf5, 0x0, 0xe, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xfd, 0x0, 0x2f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x30, 0x5f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x80,
-    0x6f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xb0, 0x6f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xe0, 0x4f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x1f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf0,
-    0xb, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf1, 0x3, 0xff, 0xff, 0xd6, 0x10, 0x14,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9b, 0xff, 0xf0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xc, 0xff, 0xe0,
-    0x0, 0x0, 0x18, 0xdf, 0xff, 0xfa, 0x40, 0xd,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
-    0x0, 0xf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x50, 0x7, 0x88,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x0,
-    0xc, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfa, 0x0, 0x7, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf2, 0x0, 0x1, 0xff, 0xff, 0xa1,
-    0x0, 0x3, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xdc, 0xdf, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
-    0x77, 0x63, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x8, 0xee, 0x60, 0x7f, 0xff, 0xf4, 0xbf, 0xff,
-    0xf8, 0x9f, 0xff, 0xf6, 0x1d, 0xff, 0xb0, 0x0,
-    0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x43, 0x0, 0x1d, 0xff, 0xb0, 0x9f, 0xff, 0xf6,
-    0xbf, 0xff, 0xf8, 0x7f, 0xff, 0xf4, 0x8, 0xee,
-    0x60,
-
-    /* U+003B ";" */
-    0x9, 0xee, 0x60, 0x7, 0xff, 0xff, 0x40, 0xbf,
-    0xff, 0xf8, 0x9, 0xff, 0xff, 0x60, 0x1d, 0xff,
-    0xb0, 0x0, 0x4, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x40,
-    0x0, 0x3e, 0xff, 0xd1, 0xc, 0xff, 0xff, 0x90,
-    0xef, 0xff, 0xff, 0xa, 0xff, 0xff, 0xf1, 0x1a,
-    0xff, 0xff, 0x10, 0x0, 0x8f, 0xe0, 0x0, 0xd,
-    0xfa, 0x0, 0x8, 0xff, 0x20, 0x19, 0xff, 0x80,
-    0xc, 0xff, 0x80, 0x0, 0xcd, 0x40, 0x0, 0x1,
-    0x0, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xf9, 0x20,
-    0x0, 0x0, 0x2, 0x8f, 0xff, 0xff, 0xfd, 0x60,
-    0x0, 0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xb4,
-    0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xe8,
-    0x20, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xfd,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xf9,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff,
-    0xff, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7e, 0xff, 0xff, 0xfe, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x8e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0,
-
-    /* U+003E ">" */
-    0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
-    0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xef, 0xff, 0xff, 0xe7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
-    0xff, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff,
-    0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x6d, 0xff,
-    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x28, 0xff,
-    0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x92, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x4, 0x9d, 0xef, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xdf, 0xff, 0xe7, 0x54,
-    0x7d, 0xff, 0xff, 0x30, 0x6, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xb0, 0xc, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0xf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf1, 0x2f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1,
-    0x17, 0x77, 0x40, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x50, 0x0,
-    0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x5a, 0xcd, 0xff,
-    0xec, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xca, 0x99, 0xad, 0xff, 0xff,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
-    0xc5, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xa0, 0x0, 0x0,
-    0x5f, 0xff, 0x40, 0x0, 0x1, 0x7c, 0xfe, 0x90,
-    0x15, 0x53, 0xc, 0xff, 0x20, 0x0, 0xd, 0xff,
-    0x90, 0x0, 0x4, 0xef, 0xff, 0xff, 0xb7, 0xff,
-    0x80, 0x3f, 0xf8, 0x0, 0x5, 0xff, 0xf1, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf4, 0x0,
-    0xdf, 0xd0, 0x0, 0xaf, 0xfa, 0x0, 0x1, 0xef,
-    0xff, 0x71, 0x3, 0xff, 0xff, 0x0, 0x9, 0xff,
-    0x0, 0xe, 0xff, 0x60, 0x0, 0xbf, 0xff, 0x40,
-    0x0, 0x9, 0xff, 0xb0, 0x0, 0x8f, 0xf0, 0x0,
-    0xff, 0xf3, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x9f, 0xf6, 0x0, 0x8, 0xff, 0x0, 0x2f, 0xff,
-    0x20, 0x9, 0xff, 0xe0, 0x0, 0x0, 0xd, 0xff,
-    0x20, 0x0, 0x9f, 0xf0, 0x2, 0xff, 0xf1, 0x0,
-    0xdf, 0xf9, 0x0, 0x0, 0x2, 0xff, 0xd0, 0x0,
-    0xd, 0xfb, 0x0, 0x1f, 0xff, 0x10, 0xf, 0xff,
-    0x50, 0x0, 0x0, 0x6f, 0xf9, 0x0, 0x2, 0xff,
-    0x70, 0x0, 0xff, 0xf3, 0x0, 0xff, 0xf4, 0x0,
-    0x0, 0xb, 0xff, 0x40, 0x0, 0x9f, 0xf1, 0x0,
-    0xe, 0xff, 0x50, 0xe, 0xff, 0x50, 0x0, 0x3,
-    0xff, 0xf0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x9f,
-    0xfa, 0x0, 0xaf, 0xfb, 0x0, 0x3, 0xef, 0xfd,
-    0x0, 0x3f, 0xfd, 0x0, 0x0, 0x5, 0xff, 0xe0,
-    0x3, 0xff, 0xfc, 0x8a, 0xff, 0xff, 0xf8, 0xaf,
-    0xfe, 0x20, 0x0, 0x0, 0xd, 0xff, 0x80, 0x6,
-    0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xfd, 0x30,
-    0x11, 0x10, 0x0, 0x5f, 0xff, 0x30, 0x3, 0xae,
-    0xfd, 0x80, 0x6, 0xef, 0xd7, 0x0, 0x7f, 0xfd,
-    0x0, 0x0, 0xaf, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x30, 0x0,
-    0x0, 0xcf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xbf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf9, 0x51, 0x0, 0x0, 0x2, 0x6b,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5d,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xae,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x46,
-    0x77, 0x75, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x95, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf3, 0xf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfd, 0x0, 0x9f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x80, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf2, 0x0, 0xe,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x8f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x60, 0x0,
-    0x2, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x50, 0x0, 0x0, 0x1, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x8, 0xff,
-    0xf9, 0x33, 0x33, 0x33, 0x33, 0x33, 0x6f, 0xff,
-    0xc0, 0x0, 0x0, 0xef, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x20, 0x0, 0x4f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf8, 0x0, 0xa, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x40, 0x6f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfb,
-    0xc, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf1,
-
-    /* U+0042 "B" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0x93, 0x33, 0x33, 0x33, 0x47,
-    0xcf, 0xff, 0xf7, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x10, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x30, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfe, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf8, 0x0, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x14, 0x9f, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc2, 0x0, 0x7f, 0xff, 0x83, 0x33, 0x33, 0x33,
-    0x35, 0x8e, 0xff, 0xfe, 0x10, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xa0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf0, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf3, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf4, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf3, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xff, 0xd0, 0x7f, 0xff, 0x83, 0x33, 0x33, 0x33,
-    0x46, 0xaf, 0xff, 0xff, 0x50, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xda, 0x61, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x1, 0x5a, 0xce, 0xff, 0xdb,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0xff, 0xa8, 0x77, 0x9d, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0xfe, 0x10, 0x0, 0xaf, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x90,
-    0x2, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf0, 0x9, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf4,
-    0xe, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x77, 0x73, 0x2f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdd, 0xda,
-    0xd, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf3,
-    0x1, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xb0, 0x0, 0x7f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x30,
-    0x0, 0xb, 0xff, 0xff, 0xd7, 0x20, 0x0, 0x16,
-    0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29,
-    0xef, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x56, 0x77, 0x52,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xc9, 0x51,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x7, 0xff, 0xf9, 0x55, 0x55, 0x56,
-    0x8b, 0xff, 0xff, 0xff, 0x40, 0x0, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe,
-    0x10, 0x7, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0xfa, 0x0, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf2,
-    0x7, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x80, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x7,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf0, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x27, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf3, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x47, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf4, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x37, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf2,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x7, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf8, 0x7, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0xa0, 0x7, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xe1, 0x0, 0x7f, 0xff, 0x95,
-    0x55, 0x55, 0x68, 0xbf, 0xff, 0xff, 0xf3, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x95, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x7f, 0xff, 0x95, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x0, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x95, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0046 "F" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0x95, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x7f, 0xff,
-    0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xce, 0xff, 0xec,
-    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0xb8, 0x77, 0x9d, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x3c, 0xff, 0xff, 0x60, 0x0, 0x8f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf5, 0x7, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf9,
-    0xd, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xbb, 0xb8, 0x1f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x5, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x8f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xc, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x5, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x41, 0x0, 0x0,
-    0x37, 0xdf, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x45, 0x77, 0x65,
-    0x30, 0x0, 0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfd, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfd,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0x95, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x56, 0xff, 0xfd, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfd,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfd, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfd,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfd,
-
-    /* U+0049 "I" */
-    0x6f, 0xff, 0x76, 0xff, 0xf7, 0x6f, 0xff, 0x76,
-    0xff, 0xf7, 0x6f, 0xff, 0x76, 0xff, 0xf7, 0x6f,
-    0xff, 0x76, 0xff, 0xf7, 0x6f, 0xff, 0x76, 0xff,
-    0xf7, 0x6f, 0xff, 0x76, 0xff, 0xf7, 0x6f, 0xff,
-    0x76, 0xff, 0xf7, 0x6f, 0xff, 0x76, 0xff, 0xf7,
-    0x6f, 0xff, 0x76, 0xff, 0xf7, 0x6f, 0xff, 0x76,
-    0xff, 0xf7, 0x6f, 0xff, 0x76, 0xff, 0xf7, 0x6f,
-    0xff, 0x76, 0xff, 0xf7, 0x6f, 0xff, 0x76, 0xff,
-    0xf7,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xa3, 0x77, 0x73, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfa, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x96, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf8, 0x4f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x60, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x2f, 0xff, 0xf2, 0x9, 0xff, 0xfe, 0x50, 0x0,
-    0x5e, 0xff, 0xfd, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x2b, 0xff,
-    0xff, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x1,
-    0x56, 0x76, 0x51, 0x0, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf5, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x50, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf4, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x9f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x8f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x8,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x8f, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x78, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xdf, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xe2, 0x9f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x20,
-    0xb, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xd1, 0x0, 0x0, 0xdf, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x1e, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0x60, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xf4, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0x30, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe2,
-
-    /* U+004C "L" */
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x95, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+004D "M" */
-    0x7f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfd, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xfd, 0x7f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x7f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xfd, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0xff, 0xfd,
-    0x7f, 0xff, 0x7e, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf6, 0xff, 0xfd, 0x7f, 0xff,
-    0x78, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xd1, 0xff, 0xfd, 0x7f, 0xff, 0x71, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x61,
-    0xff, 0xfd, 0x7f, 0xff, 0x70, 0xaf, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x1, 0xff, 0xfd,
-    0x7f, 0xff, 0x70, 0x4f, 0xff, 0x80, 0x0, 0x0,
-    0x3, 0xff, 0xf9, 0x1, 0xff, 0xfd, 0x7f, 0xff,
-    0x70, 0xd, 0xff, 0xe0, 0x0, 0x0, 0xa, 0xff,
-    0xf2, 0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70, 0x6,
-    0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff, 0xb0, 0x1,
-    0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0, 0xff, 0xfd,
-    0x0, 0x0, 0x7f, 0xff, 0x40, 0x1, 0xff, 0xfd,
-    0x7f, 0xff, 0x70, 0x0, 0x8f, 0xff, 0x40, 0x0,
-    0xef, 0xfd, 0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff,
-    0x70, 0x0, 0x2f, 0xff, 0xb0, 0x5, 0xff, 0xf7,
-    0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0,
-    0xb, 0xff, 0xf2, 0xc, 0xff, 0xf1, 0x0, 0x1,
-    0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0, 0x4, 0xff,
-    0xf8, 0x3f, 0xff, 0x90, 0x0, 0x1, 0xff, 0xfd,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0xdf, 0xfe, 0xaf,
-    0xff, 0x30, 0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x1,
-    0xff, 0xfd, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xfd,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x10, 0x0,
-    0x0, 0x1, 0xff, 0xfd,
-
-    /* U+004E "N" */
-    0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfb, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfb, 0x7f, 0xff, 0xdf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff, 0x7b,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0x7f, 0xff, 0x71, 0xef, 0xff, 0x40, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70, 0x5f, 0xff,
-    0xe0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff,
-    0x70, 0xa, 0xff, 0xf9, 0x0, 0x0, 0x3, 0xff,
-    0xfb, 0x7f, 0xff, 0x70, 0x1, 0xef, 0xff, 0x40,
-    0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0,
-    0x4f, 0xff, 0xe1, 0x0, 0x3, 0xff, 0xfb, 0x7f,
-    0xff, 0x70, 0x0, 0x9, 0xff, 0xfa, 0x0, 0x3,
-    0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0, 0xef,
-    0xff, 0x50, 0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x4f, 0xff, 0xe1, 0x3, 0xff, 0xfb,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x9, 0xff, 0xfb,
-    0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x53, 0xff, 0xfb, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0xff,
-    0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfe, 0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfb, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfb,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xdc,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0xb9, 0x77, 0x9c, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x81, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x9f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf6, 0x0, 0x1, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfe, 0x0, 0x8, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x50,
-    0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xb0, 0x2f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf2, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf4, 0x8f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf5, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf5, 0x7f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf4, 0x6f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf3,
-    0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf1, 0xf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xd0, 0xc, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x90, 0x5,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x20, 0x0, 0xdf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xfb,
-    0x0, 0x0, 0x4f, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xff, 0xe1, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf8, 0x30, 0x0, 0x14, 0x9f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x46,
-    0x77, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xa5,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x60, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7,
-    0xff, 0xf9, 0x55, 0x55, 0x55, 0x57, 0xaf, 0xff,
-    0xff, 0x40, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0xfc, 0x7, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0x37, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf5, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x57, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf3, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x7, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xb0, 0x7f, 0xff,
-    0x95, 0x55, 0x55, 0x55, 0x7a, 0xff, 0xff, 0xf3,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe5, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xda, 0x50, 0x0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xdc,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0xb9, 0x77, 0x9c, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x81, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x9f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf6, 0x0, 0x1, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfe, 0x0, 0x8, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x50,
-    0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xb0, 0x2f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf2, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf4, 0x8f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf5, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf5, 0x7f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf4, 0x6f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x20, 0x0, 0xb, 0xff, 0xf3,
-    0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xe2, 0x0, 0xe, 0xff, 0xf1, 0xf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfd, 0x10, 0x3f,
-    0xff, 0xd0, 0xc, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x9f, 0xff, 0x90, 0x5,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfb, 0xff, 0xff, 0x20, 0x0, 0xdf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x4f, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf8, 0x30, 0x0, 0x14, 0x9f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0x60, 0xbf,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0x46,
-    0x77, 0x64, 0x10, 0x0, 0x1e, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x61,
-    0x0,
-
-    /* U+0052 "R" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb8,
-    0x20, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x7f, 0xff, 0x95, 0x55, 0x55, 0x55, 0x69,
-    0xef, 0xff, 0xf7, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x30, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x60, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x60, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfb,
-    0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x14,
-    0xaf, 0xff, 0xf2, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0x7f, 0xff, 0x95,
-    0x55, 0x55, 0x55, 0x6a, 0xff, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xf7, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfb, 0x0, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x0, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x20, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x30, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x50, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x80,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xd0, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf7,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x1, 0x7a, 0xdf, 0xff, 0xeb, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x1, 0xef, 0xff, 0xfb, 0x86, 0x67, 0x9d,
-    0xff, 0xff, 0xf1, 0x0, 0x8, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x0, 0xe,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x10, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x50, 0x1f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xfb, 0x51,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8e, 0xff,
-    0xff, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x49, 0xef, 0xff, 0xff, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9d,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xef, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x80, 0x67, 0x76, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0xcf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf1, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf2, 0x5f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0xe,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xc0, 0x6, 0xff, 0xff, 0xd6, 0x20, 0x0,
-    0x3, 0x7e, 0xff, 0xff, 0x40, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x29, 0xef, 0xff,
-    0xff, 0xff, 0xfe, 0x92, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x56, 0x77, 0x65, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+0054 "T" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x25, 0x55, 0x55, 0x55, 0x5e, 0xff, 0xf5,
-    0x55, 0x55, 0x55, 0x53, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfb, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfb, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfa, 0x6f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x4f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf8, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf4, 0xc, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x5,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0x90, 0x0, 0xcf, 0xff, 0xf9, 0x30, 0x0,
-    0x2, 0x7e, 0xff, 0xfe, 0x10, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x30, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff,
-    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x46, 0x77, 0x65, 0x10, 0x0, 0x0,
-    0x0,
-
-    /* U+0056 "V" */
-    0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf2, 0x4f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xd0,
-    0xe, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x70, 0x9, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10,
-    0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfc, 0x0, 0x0, 0xdf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf6, 0x0,
-    0x0, 0x8f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf1, 0x0, 0x0, 0x2f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x0,
-    0x0, 0xc, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x50, 0x0, 0x0, 0x7, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x50, 0x0, 0x0, 0xc, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xa0, 0x0, 0x0, 0x1f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf5, 0x0, 0x0, 0xcf,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfa, 0x0, 0x1, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x50, 0xc, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xb0, 0x2f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf5, 0xcf, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfc, 0x6f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf8, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0xd, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xe0, 0x8, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xa0, 0x4, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x60, 0x0, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0xa, 0xff, 0xdb, 0xff,
-    0xc0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10, 0x0,
-    0xbf, 0xff, 0x70, 0x0, 0x0, 0xe, 0xff, 0x97,
-    0xff, 0xf1, 0x0, 0x0, 0x5, 0xff, 0xfc, 0x0,
-    0x0, 0x6f, 0xff, 0xb0, 0x0, 0x0, 0x3f, 0xff,
-    0x53, 0xff, 0xf5, 0x0, 0x0, 0x9, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x7f,
-    0xff, 0x10, 0xef, 0xf9, 0x0, 0x0, 0xd, 0xff,
-    0xf3, 0x0, 0x0, 0xd, 0xff, 0xf3, 0x0, 0x0,
-    0xbf, 0xfc, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0x8, 0xff, 0xf7, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x6f, 0xff, 0x10, 0x0,
-    0x5f, 0xff, 0xa0, 0x0, 0x0, 0x4, 0xff, 0xfb,
-    0x0, 0x3, 0xff, 0xf4, 0x0, 0x2f, 0xff, 0x50,
-    0x0, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xf0, 0x0, 0xe, 0xff,
-    0x90, 0x0, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x30, 0xc, 0xff, 0xc0, 0x0, 0xa,
-    0xff, 0xe0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x60, 0xf, 0xff, 0x70, 0x0,
-    0x5, 0xff, 0xf2, 0x5, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xa0, 0x4f, 0xff, 0x30,
-    0x0, 0x1, 0xff, 0xf6, 0x8, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xe0, 0x8f, 0xff,
-    0x0, 0x0, 0x0, 0xdf, 0xfa, 0xc, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0xcf,
-    0xfb, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x1f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf7,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x7f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0,
-    0x0, 0x0,
-
-    /* U+0058 "X" */
-    0xd, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0,
-    0x0, 0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf2, 0x0, 0x0, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x90, 0x0, 0x0, 0xd,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x3, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0x90, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x9f, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfe, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfe, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4, 0x9f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xa0, 0xe, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfe, 0x10, 0x4, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x9f, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xa0, 0x0, 0x0, 0xe,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x4, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf2, 0x0, 0x2, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfc, 0x0,
-    0xc, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x70, 0x7f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf3,
-
-    /* U+0059 "Y" */
-    0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x20, 0xdf, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x70, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xc0, 0x0, 0x8, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x90, 0x0, 0x0, 0xef,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x30, 0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x0, 0x3f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xf6, 0xc, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf8,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x57, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x85, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+005B "[" */
-    0x12, 0x22, 0x22, 0x22, 0x21, 0xaf, 0xff, 0xff,
-    0xff, 0xfa, 0xaf, 0xff, 0xff, 0xff, 0xfa, 0xaf,
-    0xff, 0xff, 0xff, 0xfa, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd,
-    0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0,
-    0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0,
-    0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf,
-    0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd,
-    0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0,
-    0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0,
-    0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf,
-    0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd,
-    0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0,
-    0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0,
-    0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf,
-    0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xfd,
-    0x11, 0x11, 0x11, 0xaf, 0xff, 0xff, 0xff, 0xfa,
-    0xaf, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff, 0xff,
-    0xff, 0xfa,
-
-    /* U+005C "\\" */
-    0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfc,
-
-    /* U+005D "]" */
-    0x12, 0x22, 0x22, 0x22, 0x21, 0xaf, 0xff, 0xff,
-    0xff, 0xfa, 0xaf, 0xff, 0xff, 0xff, 0xfa, 0xaf,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xdf,
-    0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0,
-    0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa,
-    0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0,
-    0xdf, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0,
-    0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0xdf,
-    0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0,
-    0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa,
-    0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0,
-    0xdf, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0,
-    0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0xdf,
-    0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0,
-    0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa,
-    0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0,
-    0xdf, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0,
-    0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0xdf,
-    0xfa, 0x0, 0x0, 0x0, 0xdf, 0xfa, 0x11, 0x11,
-    0x11, 0xdf, 0xfa, 0xaf, 0xff, 0xff, 0xff, 0xfa,
-    0xaf, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff, 0xff,
-    0xff, 0xfa,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x1, 0x88, 0x84, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf5, 0xef, 0xf4, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xd0, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x50, 0xe, 0xff, 0x30, 0x0,
-    0x0, 0x4f, 0xfd, 0x0, 0x7, 0xff, 0xb0, 0x0,
-    0x0, 0xcf, 0xf6, 0x0, 0x1, 0xff, 0xf2, 0x0,
-    0x3, 0xff, 0xe0, 0x0, 0x0, 0x8f, 0xfa, 0x0,
-    0xa, 0xff, 0x60, 0x0, 0x0, 0x1f, 0xff, 0x10,
-    0x2f, 0xfe, 0x0, 0x0, 0x0, 0x9, 0xff, 0x80,
-    0x9f, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf1,
-
-    /* U+005F "_" */
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x5f, 0xff, 0xb0, 0x0, 0x4, 0xff, 0xf6, 0x0,
-    0x0, 0x4f, 0xff, 0x20, 0x0, 0x4, 0xff, 0xc0,
-    0x0, 0x0, 0x3f, 0xf7,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x0, 0x25, 0x77, 0x65, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xfc,
-    0x40, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0xbf, 0xff, 0xfd, 0xa9,
-    0xbf, 0xff, 0xff, 0x30, 0x4, 0xff, 0xff, 0x50,
-    0x0, 0x1, 0xcf, 0xff, 0xb0, 0xb, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x9, 0xbc,
-    0xc0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf4, 0x0, 0x0, 0x38, 0xce, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x3, 0xef, 0xff, 0xfe, 0xcc,
-    0xcc, 0xcd, 0xff, 0xf4, 0xd, 0xff, 0xfb, 0x30,
-    0x0, 0x0, 0x7, 0xff, 0xf4, 0x4f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf4, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf4, 0x8f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4,
-    0x6f, 0xff, 0xd1, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xf4, 0x1f, 0xff, 0xfe, 0x86, 0x7a, 0xff, 0xfd,
-    0xff, 0xf4, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa4, 0xff, 0xf4, 0x0, 0x4d, 0xff, 0xff, 0xff,
-    0xc5, 0x3, 0xff, 0xf4, 0x0, 0x0, 0x36, 0x76,
-    0x51, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0062 "b" */
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x0, 0x1, 0x57, 0x64, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf0, 0x9, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xdf, 0xff, 0x1d, 0xff,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0xd, 0xff, 0xfc,
-    0xff, 0xc9, 0xad, 0xff, 0xff, 0xe1, 0x0, 0xdf,
-    0xff, 0xfe, 0x30, 0x0, 0x3, 0xef, 0xff, 0x90,
-    0xd, 0xff, 0xff, 0x30, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x20, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf8, 0xd, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xc0, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0,
-    0xdf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x1d, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf0, 0xdf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0xd, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xb0, 0xdf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf7, 0xd,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x10, 0xdf, 0xff, 0xfe, 0x30, 0x0, 0x3, 0xef,
-    0xff, 0x90, 0xd, 0xff, 0xff, 0xff, 0xc9, 0xad,
-    0xff, 0xff, 0xd0, 0x0, 0xdf, 0xfb, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xd1, 0x0, 0xd, 0xff, 0xb0,
-    0x6e, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x67, 0x64, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x4, 0x67, 0x65, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xfc,
-    0x40, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xba,
-    0xbf, 0xff, 0xff, 0x60, 0x1, 0xef, 0xff, 0xa0,
-    0x0, 0x0, 0x8f, 0xff, 0xe0, 0x8, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf6, 0xe, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb, 0x3f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x65,
-    0x6f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfd, 0xf, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x8,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf4,
-    0x1, 0xef, 0xff, 0x90, 0x0, 0x0, 0x8f, 0xff,
-    0xc0, 0x0, 0x5f, 0xff, 0xff, 0xba, 0xbf, 0xff,
-    0xff, 0x30, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x15,
-    0x67, 0x64, 0x10, 0x0, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x25, 0x76, 0x40, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x4, 0xdf, 0xff, 0xff,
-    0xd4, 0x7, 0xff, 0xf6, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x7f, 0xff, 0x60, 0x6, 0xff,
-    0xff, 0xfb, 0x9a, 0xef, 0xfc, 0xff, 0xf6, 0x2,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x60, 0x9f, 0xff, 0x90, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xf6, 0xf, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x63, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf6, 0x6f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x68, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6,
-    0x8f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x67, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf6, 0x6f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x63, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf6, 0xe, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x60,
-    0x9f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf6, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x60, 0x6, 0xff, 0xff, 0xfb, 0x9a,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x6f, 0xff, 0x60, 0x0, 0x3,
-    0xcf, 0xff, 0xff, 0xfb, 0x23, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x15, 0x77, 0x51, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x25, 0x77, 0x53, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xea, 0xac, 0xff, 0xff, 0xb0, 0x0, 0x4, 0xff,
-    0xff, 0x60, 0x0, 0x2, 0xcf, 0xff, 0x60, 0x0,
-    0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x0, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf5, 0x8, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xa0, 0xcf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xfe, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2d, 0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xd2, 0xcf, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x2, 0xee, 0xea, 0x0, 0xdf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x60,
-    0x5, 0xff, 0xff, 0x50, 0x0, 0x1, 0xaf, 0xff,
-    0xd0, 0x0, 0x9, 0xff, 0xff, 0xda, 0xac, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x5, 0xdf,
-    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x25, 0x77, 0x63, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x3b, 0xef, 0xff, 0xf6, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x5f,
-    0xff, 0xd5, 0x33, 0x31, 0x0, 0x0, 0x7f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x11, 0x11,
-    0x9f, 0xff, 0x51, 0x11, 0x10, 0x0, 0x0, 0x8f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x40, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x25, 0x76, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xf8,
-    0x6, 0xff, 0xf6, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x6f, 0xff, 0x60, 0x6, 0xff, 0xff,
-    0xea, 0x9b, 0xff, 0xfe, 0xff, 0xf6, 0x2, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x60,
-    0x9f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf6, 0xf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x64, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf6, 0x6f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x68, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6, 0x8f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x67, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf6, 0x6f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x62, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf6, 0xd, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x60, 0x6f,
-    0xff, 0xd1, 0x0, 0x0, 0x2, 0xef, 0xff, 0xf6,
-    0x0, 0xcf, 0xff, 0xe7, 0x32, 0x38, 0xff, 0xff,
-    0xff, 0x60, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0xff, 0xf6, 0x0, 0x1, 0xcf, 0xff, 0xff,
-    0xff, 0xe3, 0x6f, 0xff, 0x60, 0x0, 0x0, 0x4a,
-    0xdf, 0xec, 0x71, 0x6, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf2, 0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x0, 0x5f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x90, 0x0, 0xef, 0xff, 0xa3,
-    0x10, 0x3, 0xaf, 0xff, 0xf2, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x6a, 0xdf, 0xff, 0xeb, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x2, 0x57,
-    0x64, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x1b, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xdf, 0xff, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0xd, 0xff, 0xfd, 0xff,
-    0xba, 0xcf, 0xff, 0xff, 0x70, 0xdf, 0xff, 0xfc,
-    0x10, 0x0, 0x2c, 0xff, 0xfd, 0xd, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x1f, 0xff, 0xf2, 0xdf, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x5d, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0xdf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x6d,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf7,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x7d, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf7, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x7d, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf7, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x7d, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf7, 0xdf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x7d, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf7, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x7d, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf7,
-
-    /* U+0069 "i" */
-    0x9, 0xee, 0x60, 0x8f, 0xff, 0xf4, 0xbf, 0xff,
-    0xf7, 0x8f, 0xff, 0xf4, 0xb, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0,
-    0xf, 0xff, 0xc0, 0xf, 0xff, 0xc0, 0xf, 0xff,
-    0xc0, 0xf, 0xff, 0xc0, 0xf, 0xff, 0xc0, 0xf,
-    0xff, 0xc0, 0xf, 0xff, 0xc0, 0xf, 0xff, 0xc0,
-    0xf, 0xff, 0xc0, 0xf, 0xff, 0xc0, 0xf, 0xff,
-    0xc0, 0xf, 0xff, 0xc0, 0xf, 0xff, 0xc0, 0xf,
-    0xff, 0xc0, 0xf, 0xff, 0xc0, 0xf, 0xff, 0xc0,
-    0xf, 0xff, 0xc0, 0xf, 0xff, 0xc0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x8e, 0xe8, 0x0, 0x0, 0x6f, 0xff,
-    0xf5, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0, 0x6f,
-    0xff, 0xf6, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0xf, 0xff, 0xd0, 0x0, 0x1,
-    0xff, 0xfc, 0x1, 0x23, 0xbf, 0xff, 0xa0, 0x8f,
-    0xff, 0xff, 0xf4, 0x8, 0xff, 0xff, 0xf8, 0x0,
-    0x8f, 0xfe, 0xb4, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x70,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf6,
-    0x0, 0xdf, 0xff, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x50, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x8f, 0xff,
-    0xf5, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x9, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x9f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xa,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xaf, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfd, 0xcf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xc1, 0x1e, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x3, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xf4, 0x0, 0x0, 0xdf, 0xff, 0x0,
-    0x0, 0xa, 0xff, 0xfe, 0x20, 0x0, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xd0, 0x0, 0xdf,
-    0xff, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x70, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf4,
-
-    /* U+006C "l" */
-    0x6f, 0xff, 0x66, 0xff, 0xf6, 0x6f, 0xff, 0x66,
-    0xff, 0xf6, 0x6f, 0xff, 0x66, 0xff, 0xf6, 0x6f,
-    0xff, 0x66, 0xff, 0xf6, 0x6f, 0xff, 0x66, 0xff,
-    0xf6, 0x6f, 0xff, 0x66, 0xff, 0xf6, 0x6f, 0xff,
-    0x66, 0xff, 0xf6, 0x6f, 0xff, 0x66, 0xff, 0xf6,
-    0x6f, 0xff, 0x66, 0xff, 0xf6, 0x6f, 0xff, 0x66,
-    0xff, 0xf6, 0x6f, 0xff, 0x66, 0xff, 0xf6, 0x6f,
-    0xff, 0x66, 0xff, 0xf6, 0x6f, 0xff, 0x66, 0xff,
-    0xf6,
-
-    /* U+006D "m" */
-    0x0, 0x0, 0x0, 0x4, 0x67, 0x52, 0x0, 0x0,
-    0x0, 0x25, 0x76, 0x40, 0x0, 0x0, 0xdf, 0xff,
-    0x4, 0xef, 0xff, 0xff, 0xb2, 0x0, 0x1b, 0xff,
-    0xff, 0xfe, 0x60, 0x0, 0xdf, 0xff, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x22, 0xef, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xdf, 0xff, 0xff, 0xfb, 0xbe, 0xff,
-    0xff, 0xdd, 0xff, 0xdb, 0xcf, 0xff, 0xff, 0x50,
-    0xdf, 0xff, 0xfb, 0x10, 0x0, 0x6f, 0xff, 0xff,
-    0xf4, 0x0, 0x1, 0xaf, 0xff, 0xd0, 0xdf, 0xff,
-    0xd0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0xe, 0xff, 0xf2, 0xdf, 0xff, 0x50, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf5, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf6, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf6, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf6, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf6, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf6, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf6, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf6, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf6, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf6, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6,
-
-    /* U+006E "n" */
-    0x0, 0x0, 0x0, 0x2, 0x67, 0x64, 0x0, 0x0,
-    0xd, 0xff, 0xf0, 0x3c, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xdf, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0xd, 0xff, 0xff, 0xff, 0xcb, 0xcf, 0xff,
-    0xff, 0x80, 0xdf, 0xff, 0xfd, 0x20, 0x0, 0x1c,
-    0xff, 0xfe, 0xd, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x1e, 0xff, 0xf3, 0xdf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x6d, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf7, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x8d, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf8, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x8d, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf8, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x8d, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf8, 0xdf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x8d,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf8,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x8d, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf8, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x8d, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf8,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x3, 0x67, 0x65, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xef, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xca, 0xbe, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0xdf, 0xff, 0xc2, 0x0, 0x0, 0x7f, 0xff,
-    0xf5, 0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfd, 0x0, 0xe, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x50, 0x2f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x90,
-    0x6f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xd0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xe0, 0x8f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x7f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0,
-    0x6f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xd0, 0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xa0, 0xe, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x50, 0x7, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x0,
-    0x0, 0xdf, 0xff, 0xc2, 0x0, 0x0, 0x7f, 0xff,
-    0xf5, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xca, 0xbe,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xef, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x67, 0x65, 0x10, 0x0,
-    0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x0, 0x0, 0x0, 0x4, 0x67, 0x64, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xb0, 0x6e, 0xff, 0xff, 0xfe,
-    0x80, 0x0, 0x0, 0xdf, 0xfb, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xc9, 0xad, 0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff,
-    0xfe, 0x30, 0x0, 0x3, 0xdf, 0xff, 0x90, 0xd,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x10, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf7, 0xd, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xb0, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0xd, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0xdf,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x1d, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xd, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0xdf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf8, 0xd, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2, 0xff, 0xff, 0x20,
-    0xdf, 0xff, 0xfe, 0x40, 0x0, 0x3, 0xdf, 0xff,
-    0x90, 0xd, 0xff, 0xfc, 0xff, 0xc9, 0xad, 0xff,
-    0xff, 0xe1, 0x0, 0xdf, 0xff, 0x1d, 0xff, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0xd, 0xff, 0xf0, 0xa,
-    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0xdf, 0xff,
-    0x0, 0x1, 0x57, 0x64, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x15, 0x77, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xfb,
-    0x23, 0xff, 0xf6, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x6f, 0xff, 0x60, 0x6, 0xff, 0xff,
-    0xfb, 0x9a, 0xff, 0xff, 0xff, 0xf6, 0x1, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x60,
-    0x9f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf6, 0xe, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x63, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf6, 0x6f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x67, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6, 0x8f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x68, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf6, 0x6f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x63, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf6, 0xf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x60, 0x9f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf6,
-    0x2, 0xff, 0xff, 0x90, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x60, 0x6, 0xff, 0xff, 0xfb, 0x9a, 0xef,
-    0xfc, 0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x7f, 0xff, 0x60, 0x0, 0x4, 0xdf,
-    0xff, 0xff, 0xe5, 0x7, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x25, 0x76, 0x40, 0x0, 0x7f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x60,
-
-    /* U+0072 "r" */
-    0x0, 0x0, 0x0, 0x5, 0x77, 0x40, 0xdf, 0xff,
-    0x3, 0xef, 0xff, 0xf3, 0xdf, 0xff, 0x3f, 0xff,
-    0xff, 0xf3, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xf3,
-    0xdf, 0xff, 0xff, 0xe8, 0x66, 0x92, 0xdf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x3, 0x67, 0x76, 0x41, 0x0, 0x0,
-    0x0, 0x0, 0x8e, 0xff, 0xff, 0xff, 0xfb, 0x20,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0xcf, 0xff, 0xfc, 0xaa, 0xbf, 0xff,
-    0xff, 0x10, 0x3f, 0xff, 0xe2, 0x0, 0x0, 0x1c,
-    0xff, 0xf8, 0x6, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xd0, 0x6f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x57, 0x76, 0x2, 0xff, 0xff, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfe,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x4, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x5, 0x9d, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x6d, 0xff, 0xff, 0x31, 0x11,
-    0x10, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf8, 0xdf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x99,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf8,
-    0x4f, 0xff, 0xe2, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0x40, 0xbf, 0xff, 0xfc, 0xa9, 0xad, 0xff, 0xff,
-    0xd0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xfe,
-    0x91, 0x0, 0x0, 0x0, 0x3, 0x67, 0x77, 0x53,
-    0x0, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x1, 0x7a, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xd0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x11, 0x22, 0x2f, 0xff, 0xd2, 0x22,
-    0x20, 0x0, 0x0, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf5, 0x22, 0x10, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0x90, 0x0, 0x0, 0x2, 0xae,
-    0xff, 0xf9, 0x0,
-
-    /* U+0075 "u" */
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x9d, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf9, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x9d, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf9, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x9d, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf9, 0xdf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x9d, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf9, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x9d, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf9, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x9d, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf9, 0xcf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x9b, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x9f,
-    0xff, 0x80, 0x0, 0x0, 0xa, 0xff, 0xff, 0x94,
-    0xff, 0xff, 0x60, 0x0, 0x9, 0xff, 0xff, 0xf9,
-    0xd, 0xff, 0xff, 0xeb, 0xbf, 0xff, 0xdf, 0xff,
-    0x90, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff,
-    0xf9, 0x0, 0x3c, 0xff, 0xff, 0xff, 0x70, 0x3f,
-    0xff, 0x90, 0x0, 0x2, 0x67, 0x64, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0076 "v" */
-    0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfa, 0x4f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf4, 0xe, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xe0, 0x8, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x80, 0x2, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x20, 0x0, 0xdf, 0xff,
-    0x20, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x0, 0x7f,
-    0xff, 0x70, 0x0, 0x7, 0xff, 0xf7, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0xc, 0xff, 0xf1, 0x0,
-    0x0, 0xb, 0xff, 0xf2, 0x0, 0x2f, 0xff, 0xb0,
-    0x0, 0x0, 0x5, 0xff, 0xf7, 0x0, 0x7f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0xcf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x12,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x77, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xcc, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1,
-    0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x5f, 0xff,
-    0xc0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xf, 0xff, 0xf1, 0xf, 0xff, 0xf1, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x50, 0x0, 0x0, 0x4f,
-    0xff, 0xc0, 0xa, 0xff, 0xf5, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x8f, 0xff, 0x70,
-    0x5, 0xff, 0xf9, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x5f, 0xfb, 0xef, 0xf1, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0xaf, 0xff, 0x20,
-    0x0, 0x9f, 0xf6, 0xaf, 0xf6, 0x0, 0x6, 0xff,
-    0xf7, 0x0, 0x0, 0x5f, 0xff, 0x60, 0x0, 0xdf,
-    0xf2, 0x5f, 0xfa, 0x0, 0xa, 0xff, 0xf2, 0x0,
-    0x0, 0xf, 0xff, 0xb0, 0x2, 0xff, 0xd0, 0x1f,
-    0xfe, 0x0, 0xe, 0xff, 0xc0, 0x0, 0x0, 0xa,
-    0xff, 0xf0, 0x6, 0xff, 0x90, 0xd, 0xff, 0x20,
-    0x3f, 0xff, 0x70, 0x0, 0x0, 0x5, 0xff, 0xf4,
-    0xa, 0xff, 0x50, 0x8, 0xff, 0x70, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xff, 0xf8, 0xe, 0xff,
-    0x10, 0x4, 0xff, 0xb0, 0xbf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xfc, 0x3f, 0xfc, 0x0, 0x0,
-    0xff, 0xf1, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x8f, 0xf8, 0x0, 0x0, 0xbf, 0xf8,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0x0, 0xa, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x20, 0x0, 0x0, 0x5, 0xff, 0xf7, 0x0,
-    0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x9, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfb, 0x0, 0xd, 0xff, 0xf7, 0x0, 0x0, 0x5,
-    0xff, 0xfe, 0x10, 0x0, 0x3f, 0xff, 0xf3, 0x0,
-    0x1, 0xef, 0xff, 0x40, 0x0, 0x0, 0x7f, 0xff,
-    0xd0, 0x0, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x80, 0x6f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0x5f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0xef,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6,
-    0x4, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x9, 0xff,
-    0xfb, 0x0, 0x9, 0xff, 0xfa, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x10, 0x0, 0xd, 0xff, 0xf6, 0x0,
-    0x1, 0xef, 0xff, 0x60, 0x0, 0x0, 0x3f, 0xff,
-    0xf2, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xc0, 0x7f, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x80,
-
-    /* U+0079 "y" */
-    0x9f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x43, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe0, 0xc, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf8, 0x0, 0x6f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x20, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xb0, 0x0,
-    0x9, 0xff, 0xf5, 0x0, 0x0, 0xa, 0xff, 0xf5,
-    0x0, 0x0, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x10, 0x0,
-    0x5f, 0xff, 0x90, 0x0, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0xb, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xd0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x30, 0x6f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf9, 0xc, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf2, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x1, 0x11, 0x11, 0x11, 0x11,
-    0x2d, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x51, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x8d, 0xff, 0xf7, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x8f, 0xff,
-    0xfe, 0xe7, 0x0, 0x0, 0xef, 0xfd, 0x10, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf2, 0x0, 0x0, 0x2, 0x6f, 0xff, 0xb0,
-    0x0, 0x0, 0x8f, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfc, 0x10, 0x0, 0x0, 0x1, 0x5f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfe, 0xe6, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x8d, 0xff, 0xf7,
-
-    /* U+007C "|" */
-    0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5,
-    0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5,
-    0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5,
-    0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5,
-    0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5,
-    0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5,
-    0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5,
-    0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5,
-    0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5,
-
-    /* U+007D "}" */
-    0x8f, 0xff, 0xd8, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x7e, 0xef, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x70, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf6, 0x10, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xf7, 0x0, 0x0, 0xb, 0xff,
-    0xe5, 0x10, 0x0, 0x0, 0x2f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x1,
-    0xdf, 0xfe, 0x0, 0x0, 0x7e, 0xef, 0xff, 0xf8,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x8f, 0xff, 0xd8, 0x0, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x5, 0xce, 0xc7, 0x10, 0x0, 0x0, 0x2,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xe6, 0x0, 0x0,
-    0x7f, 0x70, 0x8, 0xff, 0xff, 0xff, 0xff, 0xd5,
-    0x6, 0xff, 0xf3, 0x3f, 0xff, 0x60, 0x5d, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x7, 0xf7, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x20, 0x0,
-    0x0, 0x1, 0x8d, 0xfd, 0x60, 0x0,
-
-    /* U+007F "" */
-
-    /* U+00B0 "°" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
-    0xc4, 0x0, 0x5, 0xff, 0xff, 0xff, 0x60, 0x1f,
-    0xf8, 0x11, 0x8f, 0xf1, 0x6f, 0xb0, 0x0, 0xb,
-    0xf7, 0x8f, 0x80, 0x0, 0x7, 0xf8, 0x6f, 0xc0,
-    0x0, 0xb, 0xf7, 0x1f, 0xf9, 0x22, 0x9f, 0xf1,
-    0x5, 0xff, 0xff, 0xff, 0x50, 0x0, 0x3b, 0xff,
-    0xb3, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 192, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 192, .box_w = 6, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 78, .adv_w = 273, .box_w = 13, .box_h = 10, .ofs_x = 2, .ofs_y = 16},
-    {.bitmap_index = 143, .adv_w = 346, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 416, .adv_w = 346, .box_w = 20, .box_h = 33, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 746, .adv_w = 570, .box_w = 32, .box_h = 27, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 1178, .adv_w = 429, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 1529, .adv_w = 157, .box_w = 5, .box_h = 10, .ofs_x = 2, .ofs_y = 16},
-    {.bitmap_index = 1554, .adv_w = 192, .box_w = 10, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1724, .adv_w = 192, .box_w = 10, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1894, .adv_w = 296, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 2038, .adv_w = 348, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2219, .adv_w = 157, .box_w = 7, .box_h = 13, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 2265, .adv_w = 348, .box_w = 19, .box_h = 4, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 2303, .adv_w = 157, .box_w = 6, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2321, .adv_w = 288, .box_w = 16, .box_h = 33, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2585, .adv_w = 346, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 2855, .adv_w = 235, .box_w = 11, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2998, .adv_w = 346, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3245, .adv_w = 346, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 3515, .adv_w = 346, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3788, .adv_w = 346, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 4058, .adv_w = 346, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 4328, .adv_w = 317, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4562, .adv_w = 346, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 4832, .adv_w = 346, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 5102, .adv_w = 157, .box_w = 6, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5159, .adv_w = 157, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 5250, .adv_w = 348, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 5440, .adv_w = 348, .box_w = 19, .box_h = 11, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 5545, .adv_w = 348, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 5735, .adv_w = 319, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5969, .adv_w = 498, .box_w = 29, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 6361, .adv_w = 388, .box_w = 25, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6686, .adv_w = 396, .box_w = 22, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6972, .adv_w = 421, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7296, .adv_w = 413, .box_w = 23, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7595, .adv_w = 369, .box_w = 20, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7855, .adv_w = 335, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8089, .adv_w = 434, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8413, .adv_w = 422, .box_w = 22, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8699, .adv_w = 145, .box_w = 5, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8764, .adv_w = 307, .box_w = 17, .box_h = 27, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8994, .adv_w = 408, .box_w = 24, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9306, .adv_w = 340, .box_w = 19, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9553, .adv_w = 517, .box_w = 28, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9917, .adv_w = 420, .box_w = 22, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10203, .adv_w = 445, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 10554, .adv_w = 376, .box_w = 21, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10827, .adv_w = 445, .box_w = 26, .box_h = 29, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 11204, .adv_w = 399, .box_w = 22, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11490, .adv_w = 373, .box_w = 22, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 11787, .adv_w = 355, .box_w = 22, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12073, .adv_w = 420, .box_w = 22, .box_h = 27, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 12370, .adv_w = 377, .box_w = 24, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12682, .adv_w = 546, .box_w = 34, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13124, .adv_w = 379, .box_w = 24, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13436, .adv_w = 394, .box_w = 25, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13761, .adv_w = 366, .box_w = 22, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14047, .adv_w = 192, .box_w = 10, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 14217, .adv_w = 288, .box_w = 16, .box_h = 33, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 14481, .adv_w = 192, .box_w = 10, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 14651, .adv_w = 310, .box_w = 16, .box_h = 13, .ofs_x = 2, .ofs_y = 13},
-    {.bitmap_index = 14755, .adv_w = 288, .box_w = 18, .box_h = 4, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 14791, .adv_w = 192, .box_w = 8, .box_h = 5, .ofs_x = 2, .ofs_y = 21},
-    {.bitmap_index = 14811, .adv_w = 328, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 15000, .adv_w = 344, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 15257, .adv_w = 321, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 15446, .adv_w = 344, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 15703, .adv_w = 325, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 15903, .adv_w = 217, .box_w = 14, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16085, .adv_w = 345, .box_w = 19, .box_h = 29, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 16361, .adv_w = 329, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16582, .adv_w = 156, .box_w = 6, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16660, .adv_w = 158, .box_w = 9, .box_h = 33, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 16809, .adv_w = 315, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17043, .adv_w = 144, .box_w = 5, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17108, .adv_w = 505, .box_w = 28, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17388, .adv_w = 332, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17558, .adv_w = 344, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 17768, .adv_w = 344, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 18025, .adv_w = 344, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 18282, .adv_w = 214, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18402, .adv_w = 300, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 18581, .adv_w = 207, .box_w = 13, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18744, .adv_w = 332, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 18914, .adv_w = 288, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19085, .adv_w = 445, .box_w = 28, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19351, .adv_w = 305, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19532, .adv_w = 299, .box_w = 19, .box_h = 26, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 19779, .adv_w = 289, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19950, .adv_w = 192, .box_w = 12, .box_h = 33, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 20148, .adv_w = 121, .box_w = 4, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 20220, .adv_w = 192, .box_w = 12, .box_h = 33, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 20418, .adv_w = 288, .box_w = 18, .box_h = 6, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 20472, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20472, .adv_w = 193, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 21}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 96, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 176, .range_length = 1, .glyph_id_start = 97,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 2,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t font_en_bold_36 = {
-#else
-lv_font_t font_en_bold_36 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 40,          /*The maximum line height required by the font*/
-    .base_line = 9,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0)
-    .underline_position = -5,
-    .underline_thickness = 3,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if FONT_EN_BOLD_36*/
-
@@ -1,123 +0,0 @@
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-#ifndef LV_ATTRIBUTE_IMG_HAND_LEFT
-#define LV_ATTRIBUTE_IMG_HAND_LEFT
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_HAND_LEFT uint8_t hand_left_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x35, 0x24, 0x8a, 0x24, 0x81, 0x25, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x3a, 0x00, 0xf3, 0x24, 0xe1, 0x24, 0xf1, 0x24, 0xec, 0x24, 0x63, 0x6d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x20, 0x24, 0x6e, 0x24, 0xa8, 0x00, 0xac, 0x24, 0xa1, 0x24, 0x66, 0x25, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x94, 0x24, 0xd1, 0x49, 0x09, 0x24, 0x19, 0x24, 0xad, 0x00, 0xfd, 0x24, 0xb1, 0x25, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x24, 0x7d, 0x24, 0xf4, 0x24, 0xf0, 0x24, 0xb8, 0x00, 0xa4, 0x24, 0xc7, 0x24, 0xfa, 0x24, 0xeb, 0x25, 0x67, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x91, 0x24, 0xd3, 0x6e, 0x07, 0x00, 0x00, 0x6d, 0x03, 0x24, 0x5a, 0x24, 0xea, 0x24, 0xec, 0x24, 0x65, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x92, 0x04, 0x24, 0x95, 0x24, 0xf7, 0x24, 0x7c, 0x25, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1e, 0x24, 0xa7, 0x24, 0xfc, 0x24, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x2d, 0x00, 0xf1, 0x24, 0xbe, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x25, 0x17, 0x24, 0xa9, 0x00, 0xfb, 0x24, 0xbc, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x25, 0x69, 0x24, 0xfa, 0x24, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x03, 0x24, 0x77, 0x25, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x33, 0x24, 0xd1, 0x24, 0xf0, 0x25, 0x70, 0x92, 0x04, 0x00, 0x00, 0x92, 0x02, 0x24, 0x51, 0x24, 0xe3, 0x24, 0xf0, 0x25, 0x70, 0x6e, 0x05, 0x00, 0x00, 
-  0x49, 0x0a, 0x24, 0xe4, 0x24, 0x9a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x49, 0x19, 0x49, 0x4e, 0x49, 0x53, 0x49, 0x53, 0x49, 0x53, 0x49, 0x53, 0x49, 0x53, 0x49, 0x53, 0x49, 0x53, 0x49, 0x53, 0x49, 0x53, 0x49, 0x53, 0x49, 0x5b, 0x24, 0xd1, 0x00, 0xfd, 0x24, 0xc0, 0x25, 0x54, 0x49, 0x17, 0x00, 0x00, 0x24, 0x12, 0x24, 0xa2, 0x00, 0xfa, 0x24, 0xc2, 0x24, 0x20, 
-  0x25, 0x4c, 0x00, 0xfb, 0x24, 0x29, 0x00, 0x00, 0x00, 0x00, 0x24, 0x72, 0x24, 0xf7, 0x24, 0xfc, 0x00, 0xf9, 0x00, 0xf8, 0x00, 0xf9, 0x24, 0xfa, 0x24, 0xfb, 0x24, 0xfb, 0x24, 0xfb, 0x24, 0xfa, 0x24, 0xfc, 0x24, 0xfc, 0x24, 0xfc, 0x24, 0xfd, 0x24, 0xfc, 0x24, 0xfb, 0x24, 0xfd, 0x49, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x4b, 0x24, 0xe5, 0x24, 0xc9, 
-  0x25, 0x7a, 0x24, 0xe2, 0x25, 0x06, 0x00, 0x00, 0x25, 0x13, 0x24, 0xf4, 0x24, 0x73, 0x6e, 0x24, 0x6d, 0x12, 0x6d, 0x0f, 0x6d, 0x12, 0x6e, 0x19, 0x6e, 0x1c, 0x6e, 0x1d, 0x6e, 0x1b, 0x6e, 0x1a, 0x6e, 0x20, 0x92, 0x25, 0x92, 0x24, 0x6e, 0x27, 0x6e, 0x22, 0x6e, 0x1e, 0x92, 0x2d, 0x6e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8e, 0x00, 0xcd, 
-  0x25, 0x89, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1d, 0x00, 0xf9, 0x25, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0x25, 0x66, 0x24, 0xf4, 0x49, 0x12, 0x00, 0x00, 0x49, 0x07, 0x24, 0xcc, 0x24, 0xe3, 0x24, 0xba, 0x24, 0xba, 0x24, 0xba, 0x24, 0xba, 0x24, 0xba, 0x24, 0xba, 0x24, 0xba, 0x24, 0xba, 0x25, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0x49, 0x2e, 0x24, 0xfb, 0x24, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x25, 0x17, 0x24, 0x8f, 0x24, 0xc7, 0x24, 0xc7, 0x24, 0xc7, 0x24, 0xc7, 0x24, 0xc7, 0x24, 0xc7, 0x24, 0xc7, 0x24, 0xda, 0x24, 0xe6, 0x49, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0xff, 0x01, 0x24, 0xba, 0x24, 0xd5, 0x49, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x24, 0x6e, 0x0d, 0x00, 0x00, 0x25, 0x43, 0x00, 0xfa, 0x6d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0x00, 0x00, 0x49, 0x29, 0x24, 0xed, 0x24, 0xbe, 0x25, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x48, 0x24, 0xec, 0x24, 0x87, 0x00, 0x00, 0x49, 0x25, 0x24, 0xfd, 0x25, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x49, 0x47, 0x24, 0xe9, 0x24, 0xe8, 0x24, 0x7e, 0x25, 0x3e, 0x00, 0x30, 0x24, 0x50, 0x24, 0xaf, 0x00, 0xfb, 0x24, 0xcb, 0x49, 0x1a, 0x00, 0x00, 0xff, 0x01, 0x24, 0xf5, 0x25, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x19, 0x24, 0x97, 0x24, 0xed, 0x00, 0xfe, 0x00, 0xfe, 0x24, 0xfd, 0x24, 0xdb, 0x25, 0x7d, 0x49, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd3, 0x24, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x0b, 0x24, 0x22, 0x49, 0x31, 0x25, 0x21, 0x92, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb1, 0x24, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x8e, 0x24, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x61, 0x24, 0xef, 0x49, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0x00, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x3c, 0x24, 0xf8, 0x49, 0x2b, 0x49, 0x15, 0x49, 0x15, 0x49, 0x15, 0x49, 0x15, 0x49, 0x15, 0x49, 0x15, 0x49, 0x15, 0x49, 0x15, 0x49, 0x15, 0x49, 0x15, 0x25, 0x95, 0x00, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x1f, 0x00, 0xfb, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfe, 0x24, 0xfd, 0x24, 0xfc, 0x00, 0xcc, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x65, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x6e, 0x25, 0x4f, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x35, 0xa3, 0x18, 0x8a, 0xc3, 0x18, 0x81, 0x65, 0x29, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x3a, 0x82, 0x10, 0xf3, 0xc3, 0x18, 0xe1, 0xa2, 0x10, 0xf1, 0xa2, 0x10, 0xec, 0x04, 0x21, 0x63, 0xab, 0x5a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0x20, 0xa3, 0x18, 0x6e, 0xa2, 0x10, 0xa8, 0x82, 0x10, 0xac, 0xc3, 0x18, 0xa1, 0xe4, 0x20, 0x66, 0x66, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x18, 0x94, 0xc3, 0x18, 0xd1, 0xc7, 0x39, 0x09, 0x04, 0x21, 0x19, 0xc3, 0x18, 0xad, 0x82, 0x10, 0xfd, 0xc3, 0x18, 0xb1, 0x45, 0x29, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe4, 0x20, 0x7d, 0xa2, 0x10, 0xf4, 0x82, 0x10, 0xf0, 0xa3, 0x18, 0xb8, 0x82, 0x10, 0xa4, 0xa3, 0x18, 0xc7, 0xa2, 0x10, 0xfa, 0xa2, 0x10, 0xeb, 0x24, 0x21, 0x67, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x18, 0x91, 0xe3, 0x18, 0xd3, 0x6e, 0x73, 0x07, 0x00, 0x00, 0x00, 0xab, 0x5a, 0x03, 0x04, 0x21, 0x5a, 0xa2, 0x10, 0xea, 0x82, 0x10, 0xec, 0xe4, 0x20, 0x65, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x10, 0x84, 0x04, 0x82, 0x10, 0x95, 0x82, 0x10, 0xf7, 0xa3, 0x18, 0x7c, 0x45, 0x29, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x1e, 0xc3, 0x18, 0xa7, 0x82, 0x10, 0xfc, 0xc3, 0x18, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x18, 0x2d, 0x82, 0x10, 0xf1, 0xc3, 0x18, 0xbe, 0x86, 0x31, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0x17, 0xc3, 0x18, 0xa9, 0x82, 0x10, 0xfb, 0xc3, 0x18, 0xbc, 0x45, 0x29, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x21, 0x69, 0x82, 0x10, 0xfa, 0xc3, 0x18, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x5a, 0x03, 0xe3, 0x18, 0x77, 0x04, 0x21, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x20, 0x33, 0xa3, 0x18, 0xd1, 0xa2, 0x10, 0xf0, 0x24, 0x21, 0x70, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x10, 0x84, 0x02, 0xe3, 0x18, 0x51, 0x82, 0x10, 0xe3, 0xa2, 0x10, 0xf0, 0x04, 0x21, 0x70, 0x2d, 0x6b, 0x05, 0x00, 0x00, 0x00, 
-  0x6a, 0x52, 0x0a, 0xa3, 0x18, 0xe4, 0xa3, 0x18, 0x9a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x31, 0x19, 0xc7, 0x39, 0x4e, 0x86, 0x31, 0x53, 0x86, 0x31, 0x53, 0x86, 0x31, 0x53, 0x86, 0x31, 0x53, 0x86, 0x31, 0x53, 0x86, 0x31, 0x53, 0x86, 0x31, 0x53, 0x86, 0x31, 0x53, 0x86, 0x31, 0x53, 0x86, 0x31, 0x53, 0x86, 0x31, 0x5b, 0x04, 0x21, 0xd1, 0x82, 0x10, 0xfd, 0xe3, 0x18, 0xc0, 0x66, 0x31, 0x54, 0x6a, 0x52, 0x17, 0x00, 0x00, 0x00, 0xe3, 0x18, 0x12, 0xc3, 0x18, 0xa2, 0x82, 0x10, 0xfa, 0xc3, 0x18, 0xc2, 0x04, 0x21, 0x20, 
-  0x65, 0x29, 0x4c, 0x82, 0x10, 0xfb, 0x04, 0x21, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x72, 0xa2, 0x10, 0xf7, 0x82, 0x10, 0xfc, 0x82, 0x10, 0xf9, 0x82, 0x10, 0xf8, 0x82, 0x10, 0xf9, 0x82, 0x10, 0xfa, 0x82, 0x10, 0xfb, 0x82, 0x10, 0xfb, 0x82, 0x10, 0xfb, 0x82, 0x10, 0xfa, 0x82, 0x10, 0xfc, 0x82, 0x10, 0xfc, 0x82, 0x10, 0xfc, 0x82, 0x10, 0xfd, 0x82, 0x10, 0xfc, 0x82, 0x10, 0xfb, 0xa2, 0x10, 0xfd, 0x49, 0x4a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x4b, 0xa3, 0x18, 0xe5, 0x82, 0x10, 0xc9, 
-  0x25, 0x29, 0x7a, 0x82, 0x10, 0xe2, 0x45, 0x29, 0x06, 0x00, 0x00, 0x00, 0x45, 0x29, 0x13, 0xa2, 0x10, 0xf4, 0x04, 0x21, 0x73, 0x2c, 0x63, 0x24, 0xab, 0x5a, 0x12, 0xab, 0x5a, 0x0f, 0xab, 0x5a, 0x12, 0x2d, 0x6b, 0x19, 0x6e, 0x73, 0x1c, 0x4d, 0x6b, 0x1d, 0x4d, 0x6b, 0x1b, 0x6d, 0x6b, 0x1a, 0x8e, 0x73, 0x20, 0xaf, 0x7b, 0x25, 0x8e, 0x73, 0x24, 0x8e, 0x73, 0x27, 0x8e, 0x73, 0x22, 0x6e, 0x73, 0x1e, 0xcf, 0x7b, 0x2d, 0x6e, 0x73, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8e, 0x82, 0x10, 0xcd, 
-  0x45, 0x29, 0x89, 0x82, 0x10, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0x1d, 0x82, 0x10, 0xf9, 0x24, 0x21, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0x24, 0x21, 0x66, 0xa2, 0x10, 0xf4, 0xc7, 0x39, 0x12, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x07, 0xa3, 0x18, 0xcc, 0xa2, 0x10, 0xe3, 0xe4, 0x20, 0xba, 0x04, 0x21, 0xba, 0x04, 0x21, 0xba, 0x04, 0x21, 0xba, 0x04, 0x21, 0xba, 0x04, 0x21, 0xba, 0x04, 0x21, 0xba, 0x04, 0x21, 0xba, 0x04, 0x21, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0x49, 0x4a, 0x2e, 0x82, 0x10, 0xfb, 0xe4, 0x20, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x17, 0xe3, 0x18, 0x8f, 0xe4, 0x20, 0xc7, 0x04, 0x21, 0xc7, 0xe4, 0x20, 0xc7, 0xe4, 0x20, 0xc7, 0x04, 0x21, 0xc7, 0xe4, 0x20, 0xc7, 0xe4, 0x20, 0xc7, 0xc3, 0x18, 0xda, 0xc3, 0x18, 0xe6, 0x08, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0xff, 0xff, 0x01, 0xe4, 0x20, 0xba, 0xa2, 0x10, 0xd5, 0xc7, 0x39, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x24, 0x0c, 0x63, 0x0d, 0x00, 0x00, 0x00, 0x45, 0x29, 0x43, 0x82, 0x10, 0xfa, 0xcb, 0x5a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0x00, 0x00, 0x00, 0x86, 0x31, 0x29, 0xa2, 0x10, 0xed, 0xe3, 0x18, 0xbe, 0x24, 0x21, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x48, 0x82, 0x10, 0xec, 0xc3, 0x18, 0x87, 0x00, 0x00, 0x00, 0xc7, 0x39, 0x25, 0x82, 0x10, 0xfd, 0x24, 0x21, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x39, 0x47, 0xa2, 0x10, 0xe9, 0xa3, 0x18, 0xe8, 0xc3, 0x18, 0x7e, 0x04, 0x21, 0x3e, 0x61, 0x08, 0x30, 0xe4, 0x20, 0x50, 0xe4, 0x20, 0xaf, 0x82, 0x10, 0xfb, 0xe3, 0x18, 0xcb, 0x29, 0x4a, 0x1a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xa2, 0x10, 0xf5, 0x45, 0x29, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x19, 0xe4, 0x20, 0x97, 0xa2, 0x10, 0xed, 0x82, 0x10, 0xfe, 0x82, 0x10, 0xfe, 0x82, 0x10, 0xfd, 0xa3, 0x18, 0xdb, 0x45, 0x29, 0x7d, 0xc7, 0x39, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x18, 0xd3, 0x04, 0x21, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x62, 0x0b, 0xe4, 0x20, 0x22, 0xc7, 0x39, 0x31, 0x66, 0x31, 0x21, 0x10, 0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x18, 0xb1, 0xa3, 0x18, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x20, 0x8e, 0xa3, 0x18, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x18, 0x61, 0xc3, 0x18, 0xef, 0xa6, 0x31, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x8d, 0x82, 0x10, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x3c, 0x82, 0x10, 0xf8, 0x6a, 0x52, 0x2b, 0x49, 0x4a, 0x15, 0x49, 0x4a, 0x15, 0x49, 0x4a, 0x15, 0x49, 0x4a, 0x15, 0x49, 0x4a, 0x15, 0x49, 0x4a, 0x15, 0x49, 0x4a, 0x15, 0x49, 0x4a, 0x15, 0x49, 0x4a, 0x15, 0x49, 0x4a, 0x15, 0x25, 0x29, 0x95, 0x82, 0x10, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x1f, 0x82, 0x10, 0xfb, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfe, 0xa3, 0x18, 0xfd, 0x82, 0x10, 0xfc, 0x82, 0x10, 0xcc, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x29, 0x65, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x6e, 0x45, 0x29, 0x4f, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x35, 0x18, 0xa3, 0x8a, 0x18, 0xc3, 0x81, 0x29, 0x65, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x3a, 0x10, 0x82, 0xf3, 0x18, 0xc3, 0xe1, 0x10, 0xa2, 0xf1, 0x10, 0xa2, 0xec, 0x21, 0x04, 0x63, 0x5a, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x86, 0x20, 0x18, 0xa3, 0x6e, 0x10, 0xa2, 0xa8, 0x10, 0x82, 0xac, 0x18, 0xc3, 0xa1, 0x20, 0xe4, 0x66, 0x31, 0x66, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa3, 0x94, 0x18, 0xc3, 0xd1, 0x39, 0xc7, 0x09, 0x21, 0x04, 0x19, 0x18, 0xc3, 0xad, 0x10, 0x82, 0xfd, 0x18, 0xc3, 0xb1, 0x29, 0x45, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0xe4, 0x7d, 0x10, 0xa2, 0xf4, 0x10, 0x82, 0xf0, 0x18, 0xa3, 0xb8, 0x10, 0x82, 0xa4, 0x18, 0xa3, 0xc7, 0x10, 0xa2, 0xfa, 0x10, 0xa2, 0xeb, 0x21, 0x24, 0x67, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x91, 0x18, 0xe3, 0xd3, 0x73, 0x6e, 0x07, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x03, 0x21, 0x04, 0x5a, 0x10, 0xa2, 0xea, 0x10, 0x82, 0xec, 0x20, 0xe4, 0x65, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x84, 0x10, 0x04, 0x10, 0x82, 0x95, 0x10, 0x82, 0xf7, 0x18, 0xa3, 0x7c, 0x29, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0x1e, 0x18, 0xc3, 0xa7, 0x10, 0x82, 0xfc, 0x18, 0xc3, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0x2d, 0x10, 0x82, 0xf1, 0x18, 0xc3, 0xbe, 0x31, 0x86, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x65, 0x17, 0x18, 0xc3, 0xa9, 0x10, 0x82, 0xfb, 0x18, 0xc3, 0xbc, 0x29, 0x45, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x21, 0x04, 0x69, 0x10, 0x82, 0xfa, 0x18, 0xc3, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x03, 0x18, 0xe3, 0x77, 0x21, 0x04, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe4, 0x33, 0x18, 0xa3, 0xd1, 0x10, 0xa2, 0xf0, 0x21, 0x24, 0x70, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x84, 0x10, 0x02, 0x18, 0xe3, 0x51, 0x10, 0x82, 0xe3, 0x10, 0xa2, 0xf0, 0x21, 0x04, 0x70, 0x6b, 0x2d, 0x05, 0x00, 0x00, 0x00, 
-  0x52, 0x6a, 0x0a, 0x18, 0xa3, 0xe4, 0x18, 0xa3, 0x9a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x19, 0x39, 0xc7, 0x4e, 0x31, 0x86, 0x53, 0x31, 0x86, 0x53, 0x31, 0x86, 0x53, 0x31, 0x86, 0x53, 0x31, 0x86, 0x53, 0x31, 0x86, 0x53, 0x31, 0x86, 0x53, 0x31, 0x86, 0x53, 0x31, 0x86, 0x53, 0x31, 0x86, 0x53, 0x31, 0x86, 0x5b, 0x21, 0x04, 0xd1, 0x10, 0x82, 0xfd, 0x18, 0xe3, 0xc0, 0x31, 0x66, 0x54, 0x52, 0x6a, 0x17, 0x00, 0x00, 0x00, 0x18, 0xe3, 0x12, 0x18, 0xc3, 0xa2, 0x10, 0x82, 0xfa, 0x18, 0xc3, 0xc2, 0x21, 0x04, 0x20, 
-  0x29, 0x65, 0x4c, 0x10, 0x82, 0xfb, 0x21, 0x04, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x72, 0x10, 0xa2, 0xf7, 0x10, 0x82, 0xfc, 0x10, 0x82, 0xf9, 0x10, 0x82, 0xf8, 0x10, 0x82, 0xf9, 0x10, 0x82, 0xfa, 0x10, 0x82, 0xfb, 0x10, 0x82, 0xfb, 0x10, 0x82, 0xfb, 0x10, 0x82, 0xfa, 0x10, 0x82, 0xfc, 0x10, 0x82, 0xfc, 0x10, 0x82, 0xfc, 0x10, 0x82, 0xfd, 0x10, 0x82, 0xfc, 0x10, 0x82, 0xfb, 0x10, 0xa2, 0xfd, 0x4a, 0x49, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x4b, 0x18, 0xa3, 0xe5, 0x10, 0x82, 0xc9, 
-  0x29, 0x25, 0x7a, 0x10, 0x82, 0xe2, 0x29, 0x45, 0x06, 0x00, 0x00, 0x00, 0x29, 0x45, 0x13, 0x10, 0xa2, 0xf4, 0x21, 0x04, 0x73, 0x63, 0x2c, 0x24, 0x5a, 0xab, 0x12, 0x5a, 0xab, 0x0f, 0x5a, 0xab, 0x12, 0x6b, 0x2d, 0x19, 0x73, 0x6e, 0x1c, 0x6b, 0x4d, 0x1d, 0x6b, 0x4d, 0x1b, 0x6b, 0x6d, 0x1a, 0x73, 0x8e, 0x20, 0x7b, 0xaf, 0x25, 0x73, 0x8e, 0x24, 0x73, 0x8e, 0x27, 0x73, 0x8e, 0x22, 0x73, 0x6e, 0x1e, 0x7b, 0xcf, 0x2d, 0x73, 0x6e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8e, 0x10, 0x82, 0xcd, 
-  0x29, 0x45, 0x89, 0x10, 0x82, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x65, 0x1d, 0x10, 0x82, 0xf9, 0x21, 0x24, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0x21, 0x24, 0x66, 0x10, 0xa2, 0xf4, 0x39, 0xc7, 0x12, 0x00, 0x00, 0x00, 0x4a, 0x49, 0x07, 0x18, 0xa3, 0xcc, 0x10, 0xa2, 0xe3, 0x20, 0xe4, 0xba, 0x21, 0x04, 0xba, 0x21, 0x04, 0xba, 0x21, 0x04, 0xba, 0x21, 0x04, 0xba, 0x21, 0x04, 0xba, 0x21, 0x04, 0xba, 0x21, 0x04, 0xba, 0x21, 0x04, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0x4a, 0x49, 0x2e, 0x10, 0x82, 0xfb, 0x20, 0xe4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x17, 0x18, 0xe3, 0x8f, 0x20, 0xe4, 0xc7, 0x21, 0x04, 0xc7, 0x20, 0xe4, 0xc7, 0x20, 0xe4, 0xc7, 0x21, 0x04, 0xc7, 0x20, 0xe4, 0xc7, 0x20, 0xe4, 0xc7, 0x18, 0xc3, 0xda, 0x18, 0xc3, 0xe6, 0x42, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0xff, 0xff, 0x01, 0x20, 0xe4, 0xba, 0x10, 0xa2, 0xd5, 0x39, 0xc7, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x24, 0x63, 0x0c, 0x0d, 0x00, 0x00, 0x00, 0x29, 0x45, 0x43, 0x10, 0x82, 0xfa, 0x5a, 0xcb, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0x00, 0x00, 0x00, 0x31, 0x86, 0x29, 0x10, 0xa2, 0xed, 0x18, 0xe3, 0xbe, 0x21, 0x24, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0x48, 0x10, 0x82, 0xec, 0x18, 0xc3, 0x87, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x25, 0x10, 0x82, 0xfd, 0x21, 0x24, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xa7, 0x47, 0x10, 0xa2, 0xe9, 0x18, 0xa3, 0xe8, 0x18, 0xc3, 0x7e, 0x21, 0x04, 0x3e, 0x08, 0x61, 0x30, 0x20, 0xe4, 0x50, 0x20, 0xe4, 0xaf, 0x10, 0x82, 0xfb, 0x18, 0xe3, 0xcb, 0x4a, 0x29, 0x1a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x10, 0xa2, 0xf5, 0x29, 0x45, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0x19, 0x20, 0xe4, 0x97, 0x10, 0xa2, 0xed, 0x10, 0x82, 0xfe, 0x10, 0x82, 0xfe, 0x10, 0x82, 0xfd, 0x18, 0xa3, 0xdb, 0x29, 0x45, 0x7d, 0x39, 0xc7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0xd3, 0x21, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xec, 0x0b, 0x20, 0xe4, 0x22, 0x39, 0xc7, 0x31, 0x31, 0x66, 0x21, 0x84, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0xb1, 0x18, 0xa3, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe4, 0x8e, 0x18, 0xa3, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x61, 0x18, 0xc3, 0xef, 0x31, 0xa6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x8d, 0x10, 0x82, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x3c, 0x10, 0x82, 0xf8, 0x52, 0x6a, 0x2b, 0x4a, 0x49, 0x15, 0x4a, 0x49, 0x15, 0x4a, 0x49, 0x15, 0x4a, 0x49, 0x15, 0x4a, 0x49, 0x15, 0x4a, 0x49, 0x15, 0x4a, 0x49, 0x15, 0x4a, 0x49, 0x15, 0x4a, 0x49, 0x15, 0x4a, 0x49, 0x15, 0x29, 0x25, 0x95, 0x10, 0x82, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x1f, 0x10, 0x82, 0xfb, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfe, 0x18, 0xa3, 0xfd, 0x10, 0x82, 0xfc, 0x10, 0x82, 0xcc, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x29, 0x45, 0x65, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x6e, 0x29, 0x45, 0x4f, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x35, 0x16, 0x16, 0x16, 0x8a, 0x18, 0x18, 0x18, 0x81, 0x2c, 0x2c, 0x2c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0x3a, 0x10, 0x10, 0x10, 0xf3, 0x17, 0x17, 0x17, 0xe1, 0x13, 0x13, 0x13, 0xf1, 0x13, 0x13, 0x13, 0xec, 0x1f, 0x1f, 0x1f, 0x63, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x20, 0x15, 0x15, 0x15, 0x6e, 0x14, 0x14, 0x14, 0xa8, 0x10, 0x10, 0x10, 0xac, 0x18, 0x18, 0x18, 0xa1, 0x1e, 0x1e, 0x1e, 0x66, 0x2d, 0x2d, 0x2d, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x94, 0x1a, 0x1a, 0x1a, 0xd1, 0x39, 0x39, 0x39, 0x09, 0x1f, 0x1f, 0x1f, 0x19, 0x19, 0x19, 0x19, 0xad, 0x10, 0x10, 0x10, 0xfd, 0x17, 0x17, 0x17, 0xb1, 0x28, 0x28, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x1d, 0x1d, 0x7d, 0x13, 0x13, 0x13, 0xf4, 0x12, 0x12, 0x12, 0xf0, 0x16, 0x16, 0x16, 0xb8, 0x10, 0x10, 0x10, 0xa4, 0x16, 0x16, 0x16, 0xc7, 0x13, 0x13, 0x13, 0xfa, 0x14, 0x14, 0x14, 0xeb, 0x23, 0x23, 0x23, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x91, 0x1c, 0x1c, 0x1c, 0xd3, 0x6d, 0x6d, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x1f, 0x1f, 0x1f, 0x5a, 0x14, 0x14, 0x14, 0xea, 0x12, 0x12, 0x12, 0xec, 0x1e, 0x1e, 0x1e, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x04, 0x11, 0x11, 0x11, 0x95, 0x11, 0x11, 0x11, 0xf7, 0x15, 0x15, 0x15, 0x7c, 0x27, 0x27, 0x27, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0x1e, 0x1a, 0x1a, 0x1a, 0xa7, 0x11, 0x11, 0x11, 0xfc, 0x19, 0x19, 0x19, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x2d, 0x10, 0x10, 0x10, 0xf1, 0x1a, 0x1a, 0x1a, 0xbe, 0x30, 0x30, 0x30, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x2c, 0x2c, 0x17, 0x18, 0x18, 0x18, 0xa9, 0x10, 0x10, 0x10, 0xfb, 0x18, 0x18, 0x18, 0xbc, 0x2a, 0x2a, 0x2a, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x69, 0x11, 0x11, 0x11, 0xfa, 0x1a, 0x1a, 0x1a, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x1c, 0x1c, 0x1c, 0x77, 0x21, 0x21, 0x21, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x33, 0x16, 0x16, 0x16, 0xd1, 0x13, 0x13, 0x13, 0xf0, 0x24, 0x24, 0x24, 0x70, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x02, 0x1c, 0x1c, 0x1c, 0x51, 0x12, 0x12, 0x12, 0xe3, 0x14, 0x14, 0x14, 0xf0, 0x22, 0x22, 0x22, 0x70, 0x66, 0x66, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 
-  0x4d, 0x4d, 0x4d, 0x0a, 0x15, 0x15, 0x15, 0xe4, 0x16, 0x16, 0x16, 0x9a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x19, 0x38, 0x38, 0x38, 0x4e, 0x31, 0x31, 0x31, 0x53, 0x31, 0x31, 0x31, 0x53, 0x31, 0x31, 0x31, 0x53, 0x31, 0x31, 0x31, 0x53, 0x31, 0x31, 0x31, 0x53, 0x31, 0x31, 0x31, 0x53, 0x31, 0x31, 0x31, 0x53, 0x31, 0x31, 0x31, 0x53, 0x31, 0x31, 0x31, 0x53, 0x31, 0x31, 0x31, 0x53, 0x32, 0x32, 0x32, 0x5b, 0x1f, 0x1f, 0x1f, 0xd1, 0x10, 0x10, 0x10, 0xfd, 0x1b, 0x1b, 0x1b, 0xc0, 0x2e, 0x2e, 0x2e, 0x54, 0x4e, 0x4e, 0x4e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x12, 0x18, 0x18, 0x18, 0xa2, 0x0f, 0x0f, 0x0f, 0xfa, 0x1a, 0x1a, 0x1a, 0xc2, 0x20, 0x20, 0x20, 0x20, 
-  0x2c, 0x2c, 0x2c, 0x4c, 0x10, 0x10, 0x10, 0xfb, 0x1f, 0x1f, 0x1f, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x72, 0x13, 0x13, 0x13, 0xf7, 0x12, 0x12, 0x12, 0xfc, 0x10, 0x10, 0x10, 0xf9, 0x10, 0x10, 0x10, 0xf8, 0x10, 0x10, 0x10, 0xf9, 0x11, 0x11, 0x11, 0xfa, 0x11, 0x11, 0x11, 0xfb, 0x11, 0x11, 0x11, 0xfb, 0x11, 0x11, 0x11, 0xfb, 0x11, 0x11, 0x11, 0xfa, 0x12, 0x12, 0x12, 0xfc, 0x12, 0x12, 0x12, 0xfc, 0x12, 0x12, 0x12, 0xfc, 0x12, 0x12, 0x12, 0xfd, 0x12, 0x12, 0x12, 0xfc, 0x11, 0x11, 0x11, 0xfb, 0x13, 0x13, 0x13, 0xfd, 0x47, 0x47, 0x47, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x4b, 0x15, 0x15, 0x15, 0xe5, 0x12, 0x12, 0x12, 0xc9, 
-  0x26, 0x26, 0x26, 0x7a, 0x12, 0x12, 0x12, 0xe2, 0x2a, 0x2a, 0x2a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x13, 0x13, 0x13, 0x13, 0xf4, 0x1f, 0x1f, 0x1f, 0x73, 0x63, 0x63, 0x63, 0x24, 0x55, 0x55, 0x55, 0x12, 0x55, 0x55, 0x55, 0x0f, 0x55, 0x55, 0x55, 0x12, 0x66, 0x66, 0x66, 0x19, 0x6d, 0x6d, 0x6d, 0x1c, 0x6a, 0x6a, 0x6a, 0x1d, 0x68, 0x68, 0x68, 0x1b, 0x6c, 0x6c, 0x6c, 0x1a, 0x70, 0x70, 0x70, 0x20, 0x75, 0x75, 0x75, 0x25, 0x71, 0x71, 0x71, 0x24, 0x6f, 0x6f, 0x6f, 0x27, 0x70, 0x70, 0x70, 0x22, 0x6e, 0x6e, 0x6e, 0x1e, 0x77, 0x77, 0x77, 0x2d, 0x6d, 0x6d, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8e, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x27, 0x27, 0x27, 0x89, 0x10, 0x10, 0x10, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x2c, 0x2c, 0x1d, 0x10, 0x10, 0x10, 0xf9, 0x23, 0x23, 0x23, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x23, 0x23, 0x23, 0x66, 0x13, 0x13, 0x13, 0xf4, 0x39, 0x39, 0x39, 0x12, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x49, 0x07, 0x16, 0x16, 0x16, 0xcc, 0x13, 0x13, 0x13, 0xe3, 0x1e, 0x1e, 0x1e, 0xba, 0x20, 0x20, 0x20, 0xba, 0x20, 0x20, 0x20, 0xba, 0x20, 0x20, 0x20, 0xba, 0x20, 0x20, 0x20, 0xba, 0x20, 0x20, 0x20, 0xba, 0x20, 0x20, 0x20, 0xba, 0x20, 0x20, 0x20, 0xba, 0x21, 0x21, 0x21, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x48, 0x48, 0x48, 0x2e, 0x11, 0x11, 0x11, 0xfb, 0x1e, 0x1e, 0x1e, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0x21, 0x17, 0x1b, 0x1b, 0x1b, 0x8f, 0x1d, 0x1d, 0x1d, 0xc7, 0x1f, 0x1f, 0x1f, 0xc7, 0x1d, 0x1d, 0x1d, 0xc7, 0x1d, 0x1d, 0x1d, 0xc7, 0x1f, 0x1f, 0x1f, 0xc7, 0x1d, 0x1d, 0x1d, 0xc7, 0x1d, 0x1d, 0x1d, 0xc7, 0x19, 0x19, 0x19, 0xda, 0x17, 0x17, 0x17, 0xe6, 0x40, 0x40, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0xff, 0xff, 0xff, 0x01, 0x1d, 0x1d, 0x1d, 0xba, 0x14, 0x14, 0x14, 0xd5, 0x39, 0x39, 0x39, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0x24, 0x62, 0x62, 0x62, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0x43, 0x10, 0x10, 0x10, 0xfa, 0x59, 0x59, 0x59, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x29, 0x13, 0x13, 0x13, 0xed, 0x1b, 0x1b, 0x1b, 0xbe, 0x24, 0x24, 0x24, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x48, 0x11, 0x11, 0x11, 0xec, 0x1a, 0x1a, 0x1a, 0x87, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x37, 0x25, 0x11, 0x11, 0x11, 0xfd, 0x23, 0x23, 0x23, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x47, 0x14, 0x14, 0x14, 0xe9, 0x15, 0x15, 0x15, 0xe8, 0x18, 0x18, 0x18, 0x7e, 0x21, 0x21, 0x21, 0x3e, 0x0b, 0x0b, 0x0b, 0x30, 0x1d, 0x1d, 0x1d, 0x50, 0x1d, 0x1d, 0x1d, 0xaf, 0x10, 0x10, 0x10, 0xfb, 0x1c, 0x1c, 0x1c, 0xcb, 0x45, 0x45, 0x45, 0x1a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x13, 0x13, 0x13, 0xf5, 0x2a, 0x2a, 0x2a, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x29, 0x29, 0x19, 0x1d, 0x1d, 0x1d, 0x97, 0x14, 0x14, 0x14, 0xed, 0x10, 0x10, 0x10, 0xfe, 0x10, 0x10, 0x10, 0xfe, 0x11, 0x11, 0x11, 0xfd, 0x15, 0x15, 0x15, 0xdb, 0x27, 0x27, 0x27, 0x7d, 0x39, 0x39, 0x39, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0xd3, 0x20, 0x20, 0x20, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x5d, 0x5d, 0x0b, 0x1e, 0x1e, 0x1e, 0x22, 0x39, 0x39, 0x39, 0x31, 0x2e, 0x2e, 0x2e, 0x21, 0x80, 0x80, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x1b, 0xb1, 0x15, 0x15, 0x15, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x1d, 0x8e, 0x15, 0x15, 0x15, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x61, 0x19, 0x19, 0x19, 0xef, 0x33, 0x33, 0x33, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x8d, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x3c, 0x11, 0x11, 0x11, 0xf8, 0x4d, 0x4d, 0x4d, 0x2b, 0x49, 0x49, 0x49, 0x15, 0x49, 0x49, 0x49, 0x15, 0x49, 0x49, 0x49, 0x15, 0x49, 0x49, 0x49, 0x15, 0x49, 0x49, 0x49, 0x15, 0x49, 0x49, 0x49, 0x15, 0x49, 0x49, 0x49, 0x15, 0x49, 0x49, 0x49, 0x15, 0x49, 0x49, 0x49, 0x15, 0x49, 0x49, 0x49, 0x15, 0x26, 0x26, 0x26, 0x95, 0x0f, 0x0f, 0x0f, 0xcd, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x1f, 0x10, 0x10, 0x10, 0xfb, 0x15, 0x15, 0x15, 0xfe, 0x16, 0x16, 0x16, 0xfe, 0x16, 0x16, 0x16, 0xfe, 0x16, 0x16, 0x16, 0xfe, 0x16, 0x16, 0x16, 0xfe, 0x16, 0x16, 0x16, 0xfe, 0x16, 0x16, 0x16, 0xfe, 0x16, 0x16, 0x16, 0xfe, 0x16, 0x16, 0x16, 0xfe, 0x16, 0x16, 0x16, 0xfe, 0x16, 0x16, 0x16, 0xfd, 0x12, 0x12, 0x12, 0xfc, 0x0f, 0x0f, 0x0f, 0xcc, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x28, 0x28, 0x65, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x2a, 0x2a, 0x2a, 0x6e, 0x27, 0x27, 0x27, 0x4f, 
-#endif
-};
-
-const lv_img_dsc_t hand_left = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 30,
-  .header.h = 22,
-  .data_size = 660 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .data = hand_left_map,
-};
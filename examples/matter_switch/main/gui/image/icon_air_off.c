@@ -1,163 +0,0 @@
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-#ifndef LV_ATTRIBUTE_IMG_ICON_AIR_OFF
-#define LV_ATTRIBUTE_IMG_ICON_AIR_OFF
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ICON_AIR_OFF uint8_t icon_air_off_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xb6, 0x60, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0xc0, 0xb6, 0x60, 
-  0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 
-  0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 0xb6, 0x80, 
-  0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 
-  0xb6, 0x70, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x90, 0xb6, 0x60, 0x00, 0x00, 0xb6, 0x30, 0xb6, 0x90, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x90, 0xb6, 0x30, 0x00, 0x00, 0xb6, 0x60, 0xb6, 0x90, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0xb6, 0x80, 0x00, 0x00, 0xb6, 0x40, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0xb6, 0x40, 0x00, 0x00, 0xb6, 0x80, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0xb6, 0x80, 0x00, 0x00, 0xb6, 0x40, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0xb6, 0x40, 0x00, 0x00, 0xb6, 0x80, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x90, 0xb6, 0x60, 0x00, 0x00, 0xb6, 0x30, 0xb6, 0x90, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x90, 0xb6, 0x30, 0x00, 0x00, 0xb6, 0x60, 0xb6, 0x90, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf4, 0xa4, 0x60, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0x60, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 
-  0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0x80, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 
-  0xf4, 0xa4, 0x70, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x90, 0xf4, 0xa4, 0x60, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x30, 0xf4, 0xa4, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x90, 0x14, 0xa5, 0x30, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x60, 0xf4, 0xa4, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa4, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0x80, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x40, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xc0, 0x14, 0xa5, 0x40, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xc0, 0xf4, 0xa4, 0x80, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x40, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xc0, 0x14, 0xa5, 0x40, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x80, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x90, 0xf4, 0xa4, 0x60, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x30, 0xf4, 0xa4, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x90, 0x14, 0xa5, 0x30, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x60, 0xf4, 0xa4, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xa4, 0xf4, 0x60, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0x60, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xc6, 0x38, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 
-  0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0x80, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 
-  0xa4, 0xf4, 0x70, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x90, 0xa4, 0xf4, 0x60, 0x00, 0x00, 0x00, 0xa5, 0x14, 0x30, 0xa4, 0xf4, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x90, 0xa5, 0x14, 0x30, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x60, 0xa4, 0xf4, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xf4, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0x80, 0x00, 0x00, 0x00, 0xa5, 0x14, 0x40, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xc0, 0xa5, 0x14, 0x40, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xc0, 0xa4, 0xf4, 0x80, 0x00, 0x00, 0x00, 0xa5, 0x14, 0x40, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xc0, 0xa5, 0x14, 0x40, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x80, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x90, 0xa4, 0xf4, 0x60, 0x00, 0x00, 0x00, 0xa5, 0x14, 0x30, 0xa4, 0xf4, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x90, 0xa5, 0x14, 0x30, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x60, 0xa4, 0xf4, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9d, 0x9d, 0x9d, 0x60, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9e, 0x9e, 0x9e, 0xc0, 0x9d, 0x9d, 0x9d, 0x60, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 
-  0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 0x9d, 0x9d, 0x9d, 0x80, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 
-  0x9d, 0x9d, 0x9d, 0x70, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0x90, 0x9d, 0x9d, 0x9d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x30, 0x9e, 0x9e, 0x9e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0x90, 0x9f, 0x9f, 0x9f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9d, 0x9d, 0x60, 0x9e, 0x9e, 0x9e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9d, 0x9d, 0x9d, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xc0, 0x9d, 0x9d, 0x9d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x40, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xc0, 0x9f, 0x9f, 0x9f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9d, 0x9d, 0x80, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xc0, 0x9d, 0x9d, 0x9d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x40, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xc0, 0x9f, 0x9f, 0x9f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9d, 0x9d, 0x80, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0x90, 0x9d, 0x9d, 0x9d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x30, 0x9e, 0x9e, 0x9e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0x90, 0x9f, 0x9f, 0x9f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9d, 0x9d, 0x60, 0x9e, 0x9e, 0x9e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t icon_air_off = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 32,
-  .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .data = icon_air_off_map,
-};
@@ -1,163 +0,0 @@
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-#ifndef LV_ATTRIBUTE_IMG_ICON_AIR_ON
-#define LV_ATTRIBUTE_IMG_ICON_AIR_ON
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ICON_AIR_ON uint8_t icon_air_on_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe9, 0x60, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe9, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0xc0, 0xe5, 0x60, 
-  0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 
-  0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe9, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 
-  0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe9, 0x70, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x90, 0xe5, 0x60, 0x00, 0x00, 0xe5, 0x30, 0xe5, 0x90, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x90, 0xe5, 0x30, 0x00, 0x00, 0xe5, 0x60, 0xe5, 0x90, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc0, 0xe5, 0x80, 0x00, 0x00, 0xe5, 0x40, 0xe5, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc0, 0xe5, 0x40, 0x00, 0x00, 0xe5, 0x80, 0xe5, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc0, 0xe9, 0x80, 0x00, 0x00, 0xe9, 0x40, 0xe9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc0, 0xe9, 0x40, 0x00, 0x00, 0xe9, 0x80, 0xe9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x90, 0xe9, 0x60, 0x00, 0x00, 0xe9, 0x30, 0xe9, 0x90, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x90, 0xe9, 0x30, 0x00, 0x00, 0xe9, 0x60, 0xe9, 0x90, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x46, 0xf2, 0x60, 0x26, 0xf2, 0xc0, 0x26, 0xf2, 0xc0, 0x26, 0xf2, 0xc0, 0x07, 0xf2, 0xc0, 0x07, 0xea, 0xc0, 0x07, 0xea, 0xc0, 0xe7, 0xe9, 0xc0, 0xe7, 0xe9, 0xc0, 0xe7, 0xe9, 0xc0, 0xc7, 0xe9, 0xc0, 0xc7, 0xe9, 0xc0, 0xc7, 0xe9, 0xc0, 0xa8, 0xe1, 0xc0, 0xa8, 0xe1, 0xc0, 0xa8, 0xe1, 0xc0, 0x88, 0xe1, 0xc0, 0x88, 0xe1, 0xc0, 0x88, 0xe1, 0xc0, 0x88, 0xe1, 0xc0, 0x68, 0xe1, 0xc0, 0x68, 0xe1, 0xc0, 0x69, 0xd9, 0xc0, 0x49, 0xd9, 0xc0, 0x49, 0xd9, 0xc0, 0x49, 0xd9, 0xc0, 0x49, 0xd9, 0xc0, 0x29, 0xd9, 0xc0, 0x29, 0xd9, 0xc0, 0x29, 0xd9, 0xc0, 0x29, 0xd1, 0xc0, 0x0a, 0xd1, 0x60, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x27, 0xf2, 0xff, 0x07, 0xf2, 0xff, 0x07, 0xea, 0xff, 0x07, 0xea, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xfe, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x13, 0xfd, 0xff, 0x13, 0xfd, 0xff, 0x13, 0xfd, 0xff, 0x13, 0xfd, 0xff, 0x13, 0xfd, 0xff, 0x13, 0xfd, 0xff, 0x50, 0xf4, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x27, 0xf2, 0xff, 0x07, 0xf2, 0xff, 0x07, 0xea, 0xff, 0x07, 0xea, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x27, 0xf2, 0xff, 0x07, 0xf2, 0xff, 0x07, 0xea, 0xff, 0x07, 0xea, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x27, 0xf2, 0xff, 0x07, 0xf2, 0xff, 0x07, 0xea, 0xff, 0x07, 0xea, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x27, 0xf2, 0xff, 0x07, 0xf2, 0xff, 0x07, 0xea, 0xff, 0x07, 0xea, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x27, 0xf2, 0xff, 0x07, 0xf2, 0xff, 0x07, 0xea, 0xff, 0x07, 0xea, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0x80, 0x46, 0xf2, 0x80, 0x26, 0xf2, 0x80, 0x26, 0xf2, 0x80, 0x27, 0xf2, 0x80, 0x07, 0xf2, 0x80, 0x07, 0xea, 0x80, 0x07, 0xea, 0x80, 0xe7, 0xe9, 0x80, 0xe7, 0xe9, 0x80, 0xe7, 0xe9, 0x80, 0xc7, 0xe9, 0x80, 0xc7, 0xe9, 0x80, 0xc8, 0xe9, 0x80, 0xa8, 0xe1, 0x80, 0xa8, 0xe1, 0x80, 0xa8, 0xe1, 0x80, 0x88, 0xe1, 0x80, 0x88, 0xe1, 0x80, 0x88, 0xe1, 0x80, 0x68, 0xe1, 0x80, 0x68, 0xe1, 0x80, 0x69, 0xe1, 0x80, 0x69, 0xd9, 0x80, 0x49, 0xd9, 0x80, 0x49, 0xd9, 0x80, 0x49, 0xd9, 0x80, 0x29, 0xd9, 0x80, 0x29, 0xd9, 0x80, 0x29, 0xd9, 0x80, 0x09, 0xd9, 0x80, 0x0a, 0xd1, 0x80, 
-  0x46, 0xf2, 0x80, 0x46, 0xf2, 0x80, 0x26, 0xf2, 0x80, 0x26, 0xf2, 0x80, 0x27, 0xf2, 0x80, 0x07, 0xf2, 0x80, 0x07, 0xea, 0x80, 0x07, 0xea, 0x80, 0xe7, 0xe9, 0x80, 0xe7, 0xe9, 0x80, 0xe7, 0xe9, 0x80, 0xc7, 0xe9, 0x80, 0xc7, 0xe9, 0x80, 0xc8, 0xe9, 0x80, 0xa8, 0xe1, 0x80, 0xa8, 0xe1, 0x80, 0xa8, 0xe1, 0x80, 0x88, 0xe1, 0x80, 0x88, 0xe1, 0x80, 0x88, 0xe1, 0x80, 0x68, 0xe1, 0x80, 0x68, 0xe1, 0x80, 0x69, 0xe1, 0x80, 0x69, 0xd9, 0x80, 0x49, 0xd9, 0x80, 0x49, 0xd9, 0x80, 0x49, 0xd9, 0x80, 0x29, 0xd9, 0x80, 0x29, 0xd9, 0x80, 0x29, 0xd9, 0x80, 0x09, 0xd9, 0x80, 0x0a, 0xd1, 0x80, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x27, 0xf2, 0xff, 0x07, 0xf2, 0xff, 0x07, 0xea, 0xff, 0x07, 0xea, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x27, 0xf2, 0xff, 0x07, 0xf2, 0xff, 0x07, 0xea, 0xff, 0x07, 0xea, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xe7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc7, 0xe9, 0xff, 0xc8, 0xe9, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0xa8, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x88, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x68, 0xe1, 0xff, 0x69, 0xe1, 0xff, 0x69, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x49, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0xff, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0xff, 
-  0x46, 0xf2, 0x70, 0x46, 0xf2, 0xff, 0x26, 0xf2, 0xff, 0x26, 0xf2, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd1, 0x90, 0x0a, 0xd1, 0x60, 0x00, 0x00, 0x00, 0x0a, 0xd1, 0x30, 0x0a, 0xd1, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd1, 0x90, 0x0a, 0xd1, 0x30, 0x00, 0x00, 0x00, 0x0a, 0xd1, 0x60, 0x0a, 0xd1, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xd9, 0xff, 0x29, 0xd9, 0xff, 0x09, 0xd9, 0xff, 0x0a, 0xd1, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xd9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xd9, 0xc0, 0x49, 0xd9, 0x80, 0x00, 0x00, 0x00, 0x49, 0xd9, 0x40, 0x49, 0xd9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xd9, 0xc0, 0x49, 0xd9, 0x40, 0x00, 0x00, 0x00, 0x49, 0xd9, 0x80, 0x49, 0xd9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xd9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xe1, 0xc0, 0xa8, 0xe1, 0x80, 0x00, 0x00, 0x00, 0xa8, 0xe1, 0x40, 0x88, 0xe1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xe1, 0xc0, 0xa8, 0xe1, 0x40, 0x00, 0x00, 0x00, 0xa8, 0xe1, 0x80, 0x88, 0xe1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xea, 0x90, 0x07, 0xea, 0x60, 0x00, 0x00, 0x00, 0x07, 0xea, 0x30, 0x07, 0xea, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xea, 0x90, 0x07, 0xea, 0x30, 0x00, 0x00, 0x00, 0x07, 0xea, 0x60, 0x07, 0xea, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe9, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf2, 0x46, 0x60, 0xf2, 0x26, 0xc0, 0xf2, 0x26, 0xc0, 0xf2, 0x26, 0xc0, 0xf2, 0x07, 0xc0, 0xea, 0x07, 0xc0, 0xea, 0x07, 0xc0, 0xe9, 0xe7, 0xc0, 0xe9, 0xe7, 0xc0, 0xe9, 0xe7, 0xc0, 0xe9, 0xc7, 0xc0, 0xe9, 0xc7, 0xc0, 0xe9, 0xc7, 0xc0, 0xe1, 0xa8, 0xc0, 0xe1, 0xa8, 0xc0, 0xe1, 0xa8, 0xc0, 0xe1, 0x88, 0xc0, 0xe1, 0x88, 0xc0, 0xe1, 0x88, 0xc0, 0xe1, 0x88, 0xc0, 0xe1, 0x68, 0xc0, 0xe1, 0x68, 0xc0, 0xd9, 0x69, 0xc0, 0xd9, 0x49, 0xc0, 0xd9, 0x49, 0xc0, 0xd9, 0x49, 0xc0, 0xd9, 0x49, 0xc0, 0xd9, 0x29, 0xc0, 0xd9, 0x29, 0xc0, 0xd9, 0x29, 0xc0, 0xd1, 0x29, 0xc0, 0xd1, 0x0a, 0x60, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x27, 0xff, 0xf2, 0x07, 0xff, 0xea, 0x07, 0xff, 0xea, 0x07, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9a, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xfd, 0x13, 0xff, 0xfd, 0x13, 0xff, 0xfd, 0x13, 0xff, 0xfd, 0x13, 0xff, 0xfd, 0x13, 0xff, 0xfd, 0x13, 0xff, 0xf4, 0x50, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x27, 0xff, 0xf2, 0x07, 0xff, 0xea, 0x07, 0xff, 0xea, 0x07, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x27, 0xff, 0xf2, 0x07, 0xff, 0xea, 0x07, 0xff, 0xea, 0x07, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x27, 0xff, 0xf2, 0x07, 0xff, 0xea, 0x07, 0xff, 0xea, 0x07, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x27, 0xff, 0xf2, 0x07, 0xff, 0xea, 0x07, 0xff, 0xea, 0x07, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x27, 0xff, 0xf2, 0x07, 0xff, 0xea, 0x07, 0xff, 0xea, 0x07, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0x80, 0xf2, 0x46, 0x80, 0xf2, 0x26, 0x80, 0xf2, 0x26, 0x80, 0xf2, 0x27, 0x80, 0xf2, 0x07, 0x80, 0xea, 0x07, 0x80, 0xea, 0x07, 0x80, 0xe9, 0xe7, 0x80, 0xe9, 0xe7, 0x80, 0xe9, 0xe7, 0x80, 0xe9, 0xc7, 0x80, 0xe9, 0xc7, 0x80, 0xe9, 0xc8, 0x80, 0xe1, 0xa8, 0x80, 0xe1, 0xa8, 0x80, 0xe1, 0xa8, 0x80, 0xe1, 0x88, 0x80, 0xe1, 0x88, 0x80, 0xe1, 0x88, 0x80, 0xe1, 0x68, 0x80, 0xe1, 0x68, 0x80, 0xe1, 0x69, 0x80, 0xd9, 0x69, 0x80, 0xd9, 0x49, 0x80, 0xd9, 0x49, 0x80, 0xd9, 0x49, 0x80, 0xd9, 0x29, 0x80, 0xd9, 0x29, 0x80, 0xd9, 0x29, 0x80, 0xd9, 0x09, 0x80, 0xd1, 0x0a, 0x80, 
-  0xf2, 0x46, 0x80, 0xf2, 0x46, 0x80, 0xf2, 0x26, 0x80, 0xf2, 0x26, 0x80, 0xf2, 0x27, 0x80, 0xf2, 0x07, 0x80, 0xea, 0x07, 0x80, 0xea, 0x07, 0x80, 0xe9, 0xe7, 0x80, 0xe9, 0xe7, 0x80, 0xe9, 0xe7, 0x80, 0xe9, 0xc7, 0x80, 0xe9, 0xc7, 0x80, 0xe9, 0xc8, 0x80, 0xe1, 0xa8, 0x80, 0xe1, 0xa8, 0x80, 0xe1, 0xa8, 0x80, 0xe1, 0x88, 0x80, 0xe1, 0x88, 0x80, 0xe1, 0x88, 0x80, 0xe1, 0x68, 0x80, 0xe1, 0x68, 0x80, 0xe1, 0x69, 0x80, 0xd9, 0x69, 0x80, 0xd9, 0x49, 0x80, 0xd9, 0x49, 0x80, 0xd9, 0x49, 0x80, 0xd9, 0x29, 0x80, 0xd9, 0x29, 0x80, 0xd9, 0x29, 0x80, 0xd9, 0x09, 0x80, 0xd1, 0x0a, 0x80, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x27, 0xff, 0xf2, 0x07, 0xff, 0xea, 0x07, 0xff, 0xea, 0x07, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x27, 0xff, 0xf2, 0x07, 0xff, 0xea, 0x07, 0xff, 0xea, 0x07, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xe7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc7, 0xff, 0xe9, 0xc8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0xa8, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x88, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x68, 0xff, 0xe1, 0x69, 0xff, 0xd9, 0x69, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x49, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0xff, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0xff, 
-  0xf2, 0x46, 0x70, 0xf2, 0x46, 0xff, 0xf2, 0x26, 0xff, 0xf2, 0x26, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x0a, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x0a, 0x90, 0xd1, 0x0a, 0x60, 0x00, 0x00, 0x00, 0xd1, 0x0a, 0x30, 0xd1, 0x0a, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x0a, 0x90, 0xd1, 0x0a, 0x30, 0x00, 0x00, 0x00, 0xd1, 0x0a, 0x60, 0xd1, 0x0a, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x0a, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x29, 0xff, 0xd9, 0x29, 0xff, 0xd9, 0x09, 0xff, 0xd1, 0x0a, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x49, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x49, 0xc0, 0xd9, 0x49, 0x80, 0x00, 0x00, 0x00, 0xd9, 0x49, 0x40, 0xd9, 0x49, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x49, 0xc0, 0xd9, 0x49, 0x40, 0x00, 0x00, 0x00, 0xd9, 0x49, 0x80, 0xd9, 0x49, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x49, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x88, 0xc0, 0xe1, 0xa8, 0x80, 0x00, 0x00, 0x00, 0xe1, 0xa8, 0x40, 0xe1, 0x88, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x88, 0xc0, 0xe1, 0xa8, 0x40, 0x00, 0x00, 0x00, 0xe1, 0xa8, 0x80, 0xe1, 0x88, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x07, 0x90, 0xea, 0x07, 0x60, 0x00, 0x00, 0x00, 0xea, 0x07, 0x30, 0xea, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x07, 0x90, 0xea, 0x07, 0x30, 0x00, 0x00, 0x00, 0xea, 0x07, 0x60, 0xea, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x30, 0x48, 0xf2, 0x60, 0x32, 0x46, 0xf0, 0xc0, 0x32, 0x45, 0xf0, 0xc0, 0x34, 0x44, 0xef, 0xc0, 0x35, 0x42, 0xee, 0xc0, 0x36, 0x42, 0xec, 0xc0, 0x36, 0x40, 0xec, 0xc0, 0x36, 0x3e, 0xeb, 0xc0, 0x38, 0x3e, 0xea, 0xc0, 0x39, 0x3c, 0xe8, 0xc0, 0x3a, 0x3a, 0xe8, 0xc0, 0x3a, 0x3a, 0xe7, 0xc0, 0x3c, 0x39, 0xe6, 0xc0, 0x3d, 0x36, 0xe4, 0xc0, 0x3e, 0x36, 0xe4, 0xc0, 0x3e, 0x35, 0xe3, 0xc0, 0x40, 0x32, 0xe2, 0xc0, 0x40, 0x32, 0xe2, 0xc0, 0x41, 0x31, 0xe0, 0xc0, 0x42, 0x30, 0xe0, 0xc0, 0x42, 0x2e, 0xdf, 0xc0, 0x44, 0x2d, 0xde, 0xc0, 0x45, 0x2c, 0xdc, 0xc0, 0x46, 0x2a, 0xdc, 0xc0, 0x46, 0x29, 0xdb, 0xc0, 0x48, 0x28, 0xda, 0xc0, 0x49, 0x27, 0xd8, 0xc0, 0x49, 0x25, 0xd8, 0xc0, 0x4a, 0x24, 0xd7, 0xc0, 0x4a, 0x23, 0xd6, 0xc0, 0x4c, 0x23, 0xd4, 0xc0, 0x4d, 0x20, 0xd4, 0x60, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xff, 0x35, 0x43, 0xee, 0xff, 0x36, 0x42, 0xed, 0xff, 0x36, 0x40, 0xec, 0xff, 0x37, 0x3f, 0xeb, 0xff, 0x38, 0x3e, 0xea, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xcf, 0xfa, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x99, 0xa2, 0xf8, 0xff, 0x9a, 0xa2, 0xf7, 0xff, 0x9a, 0xa1, 0xf7, 0xff, 0x9b, 0xa1, 0xf6, 0xff, 0x9b, 0xa0, 0xf6, 0xff, 0x9b, 0x9f, 0xf5, 0xff, 0x83, 0x87, 0xf2, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xff, 0x35, 0x43, 0xee, 0xff, 0x36, 0x42, 0xed, 0xff, 0x36, 0x40, 0xec, 0xff, 0x37, 0x3f, 0xeb, 0xff, 0x38, 0x3e, 0xea, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xff, 0x35, 0x43, 0xee, 0xff, 0x36, 0x42, 0xed, 0xff, 0x36, 0x40, 0xec, 0xff, 0x37, 0x3f, 0xeb, 0xff, 0x38, 0x3e, 0xea, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xff, 0x35, 0x43, 0xee, 0xff, 0x36, 0x42, 0xed, 0xff, 0x36, 0x40, 0xec, 0xff, 0x37, 0x3f, 0xeb, 0xff, 0x38, 0x3e, 0xea, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xff, 0x35, 0x43, 0xee, 0xff, 0x36, 0x42, 0xed, 0xff, 0x36, 0x40, 0xec, 0xff, 0x37, 0x3f, 0xeb, 0xff, 0x38, 0x3e, 0xea, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xff, 0x35, 0x43, 0xee, 0xff, 0x36, 0x42, 0xed, 0xff, 0x36, 0x40, 0xec, 0xff, 0x37, 0x3f, 0xeb, 0xff, 0x38, 0x3e, 0xea, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x32, 0x48, 0xf1, 0x80, 0x32, 0x48, 0xf1, 0x80, 0x34, 0x46, 0xef, 0x80, 0x34, 0x44, 0xef, 0x80, 0x36, 0x44, 0xed, 0x80, 0x36, 0x42, 0xed, 0x80, 0x36, 0x40, 0xeb, 0x80, 0x38, 0x40, 0xeb, 0x80, 0x38, 0x3e, 0xe9, 0x80, 0x3a, 0x3c, 0xe9, 0x80, 0x3a, 0x3c, 0xe7, 0x80, 0x3c, 0x3a, 0xe7, 0x80, 0x3c, 0x3a, 0xe5, 0x80, 0x3e, 0x38, 0xe5, 0x80, 0x3e, 0x36, 0xe3, 0x80, 0x40, 0x36, 0xe3, 0x80, 0x40, 0x34, 0xe1, 0x80, 0x40, 0x32, 0xe1, 0x80, 0x42, 0x32, 0xe1, 0x80, 0x42, 0x30, 0xdf, 0x80, 0x44, 0x2e, 0xdf, 0x80, 0x44, 0x2e, 0xdd, 0x80, 0x46, 0x2c, 0xdd, 0x80, 0x46, 0x2c, 0xdb, 0x80, 0x48, 0x2a, 0xdb, 0x80, 0x48, 0x28, 0xd9, 0x80, 0x4a, 0x28, 0xd9, 0x80, 0x4a, 0x26, 0xd7, 0x80, 0x4a, 0x24, 0xd7, 0x80, 0x4c, 0x24, 0xd5, 0x80, 0x4c, 0x22, 0xd5, 0x80, 0x4e, 0x20, 0xd3, 0x80, 
-  0x32, 0x48, 0xf1, 0x80, 0x32, 0x48, 0xf1, 0x80, 0x34, 0x46, 0xef, 0x80, 0x34, 0x44, 0xef, 0x80, 0x36, 0x44, 0xed, 0x80, 0x36, 0x42, 0xed, 0x80, 0x36, 0x40, 0xeb, 0x80, 0x38, 0x40, 0xeb, 0x80, 0x38, 0x3e, 0xe9, 0x80, 0x3a, 0x3c, 0xe9, 0x80, 0x3a, 0x3c, 0xe7, 0x80, 0x3c, 0x3a, 0xe7, 0x80, 0x3c, 0x3a, 0xe5, 0x80, 0x3e, 0x38, 0xe5, 0x80, 0x3e, 0x36, 0xe3, 0x80, 0x40, 0x36, 0xe3, 0x80, 0x40, 0x34, 0xe1, 0x80, 0x40, 0x32, 0xe1, 0x80, 0x42, 0x32, 0xe1, 0x80, 0x42, 0x30, 0xdf, 0x80, 0x44, 0x2e, 0xdf, 0x80, 0x44, 0x2e, 0xdd, 0x80, 0x46, 0x2c, 0xdd, 0x80, 0x46, 0x2c, 0xdb, 0x80, 0x48, 0x2a, 0xdb, 0x80, 0x48, 0x28, 0xd9, 0x80, 0x4a, 0x28, 0xd9, 0x80, 0x4a, 0x26, 0xd7, 0x80, 0x4a, 0x24, 0xd7, 0x80, 0x4c, 0x24, 0xd5, 0x80, 0x4c, 0x22, 0xd5, 0x80, 0x4e, 0x20, 0xd3, 0x80, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xff, 0x35, 0x43, 0xee, 0xff, 0x36, 0x42, 0xed, 0xff, 0x36, 0x40, 0xec, 0xff, 0x37, 0x3f, 0xeb, 0xff, 0x38, 0x3e, 0xea, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xff, 0x35, 0x43, 0xee, 0xff, 0x36, 0x42, 0xed, 0xff, 0x36, 0x40, 0xec, 0xff, 0x37, 0x3f, 0xeb, 0xff, 0x38, 0x3e, 0xea, 0xff, 0x39, 0x3c, 0xe9, 0xff, 0x3a, 0x3b, 0xe8, 0xff, 0x3b, 0x3a, 0xe7, 0xff, 0x3c, 0x39, 0xe6, 0xff, 0x3d, 0x37, 0xe5, 0xff, 0x3e, 0x36, 0xe4, 0xff, 0x3f, 0x35, 0xe3, 0xff, 0x40, 0x33, 0xe2, 0xff, 0x40, 0x32, 0xe2, 0xff, 0x41, 0x31, 0xe1, 0xff, 0x42, 0x30, 0xe0, 0xff, 0x43, 0x2e, 0xdf, 0xff, 0x44, 0x2d, 0xde, 0xff, 0x45, 0x2c, 0xdd, 0xff, 0x46, 0x2b, 0xdc, 0xff, 0x47, 0x29, 0xdb, 0xff, 0x48, 0x28, 0xda, 0xff, 0x49, 0x27, 0xd9, 0xff, 0x49, 0x25, 0xd8, 0xff, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x31, 0x48, 0xf2, 0xff, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0xff, 
-  0x32, 0x49, 0xf1, 0x70, 0x32, 0x47, 0xf1, 0xff, 0x33, 0x45, 0xf0, 0xff, 0x34, 0x44, 0xef, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x1f, 0xd3, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x20, 0xd3, 0x90, 0x4d, 0x20, 0xd2, 0x60, 0x00, 0x00, 0x00, 0x00, 0x50, 0x20, 0xd4, 0x30, 0x4e, 0x20, 0xd3, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x20, 0xd3, 0x90, 0x50, 0x20, 0xd4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x20, 0xd2, 0x60, 0x4e, 0x20, 0xd3, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x1f, 0xd3, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x24, 0xd7, 0xff, 0x4b, 0x23, 0xd6, 0xff, 0x4c, 0x22, 0xd5, 0xff, 0x4d, 0x20, 0xd4, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x27, 0xd9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x27, 0xd8, 0xc0, 0x48, 0x28, 0xd9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0x28, 0xd7, 0x40, 0x48, 0x27, 0xd8, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x27, 0xd8, 0xc0, 0x48, 0x28, 0xd7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x28, 0xd9, 0x80, 0x48, 0x27, 0xd8, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x27, 0xd9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0xe2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x32, 0xe2, 0xc0, 0x40, 0x34, 0xe1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x34, 0xe3, 0x40, 0x40, 0x32, 0xe2, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x32, 0xe2, 0xc0, 0x40, 0x34, 0xe3, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x34, 0xe1, 0x80, 0x40, 0x32, 0xe2, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0xe2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3e, 0xeb, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0xec, 0x90, 0x38, 0x40, 0xea, 0x60, 0x00, 0x00, 0x00, 0x00, 0x35, 0x40, 0xea, 0x30, 0x37, 0x40, 0xec, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0xec, 0x90, 0x35, 0x40, 0xea, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0xea, 0x60, 0x37, 0x40, 0xec, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3e, 0xeb, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t icon_air_on = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 32,
-  .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .data = icon_air_on_map,
-};
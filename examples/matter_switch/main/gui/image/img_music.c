@@ -1,314 +0,0 @@
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-#ifndef LV_ATTRIBUTE_IMG_IMG_MUSIC
-#define LV_ATTRIBUTE_IMG_IMG_MUSIC
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_IMG_MUSIC uint8_t img_music_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x72, 0xd1, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x72, 0xd1, 
-  0x2a, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xfd, 
-  0x2a, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xfd, 
-  0x2a, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x2a, 0xfc, 
-  0x72, 0xc4, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x92, 0xc4, 
-  0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x4a, 0xff, 0x72, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x4e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x89, 0xff, 0x72, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x72, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x97, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x72, 0xff, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xb7, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xff, 0x97, 0xff, 0x97, 0xff, 0x72, 0xff, 0x4a, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x2a, 0xff, 0x93, 0xff, 0x97, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x72, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x4a, 0xff, 0x69, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x69, 0xff, 0x4a, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xbb, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xbb, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x97, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x93, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0x2a, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x2a, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x89, 0xff, 0x49, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x89, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x72, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x89, 0xff, 0x49, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4a, 0xff, 0x2a, 0xff, 0x4a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x2a, 0xff, 0x4a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x89, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x4a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x89, 0xff, 0x49, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x89, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xff, 0x72, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x89, 0xff, 0x49, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x89, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x89, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x89, 0xff, 0x89, 0xff, 0x4a, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x89, 0xff, 0x49, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x89, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x89, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0x89, 0xff, 0x89, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x89, 0xff, 0x49, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x4a, 0xff, 0x72, 0xff, 0xbb, 0xff, 0x72, 0xff, 0x4a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x6e, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x89, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x89, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x4a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x72, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x4a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x93, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x89, 0xff, 0x49, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x69, 0xff, 0x6a, 0xff, 0x89, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x89, 0xff, 0x6a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x89, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x89, 0xff, 0x97, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x89, 0xff, 0x49, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x89, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x4a, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x89, 0xff, 0x2a, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x2a, 0xff, 0xa9, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0x89, 0xff, 0xa9, 0xff, 0x69, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x4a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4a, 0xff, 0x72, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x2a, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x72, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x4a, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x4a, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x72, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x97, 0xff, 0x72, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x72, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x97, 0xff, 0x72, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x2a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x72, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x2a, 0xff, 0x93, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x2a, 0xff, 0x72, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x97, 0xff, 0x2a, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x4e, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x72, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x49, 0xff, 0x89, 0xff, 0x89, 0xff, 0x49, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x4a, 0xff, 0x89, 0xff, 0x89, 0xff, 0x49, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x72, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x93, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x69, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x93, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x97, 0xff, 0xff, 0xff, 0x97, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x89, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x72, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x72, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x4a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x49, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x89, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x4a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x69, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x4a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x49, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x72, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x72, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x89, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x92, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x92, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x93, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x72, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x72, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x89, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x97, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x97, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x97, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x97, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x72, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x2a, 0xff, 0x6e, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x97, 0xff, 0x6e, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x2a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x2a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x2a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x2a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x2a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x97, 0xff, 0x6e, 0xff, 0x2a, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0x72, 0xff, 0x72, 0xff, 0x93, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0x72, 0xff, 0x72, 0xff, 0x93, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x2a, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x92, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x2a, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x92, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x72, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x2a, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x89, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x89, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x89, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x89, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x2a, 0xff, 0x92, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x69, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0x6a, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x72, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x2a, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x72, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6a, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0x6a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x69, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xb7, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x97, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xa9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xa9, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xb2, 0x63, 0xd1, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0xb2, 0x63, 0xd1, 
-  0xed, 0x21, 0xfd, 0x1a, 0xe7, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x1a, 0xe7, 0xff, 0xed, 0x21, 0xfd, 
-  0xed, 0x21, 0xfd, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0xed, 0x21, 0xfd, 
-  0x0d, 0x22, 0xfc, 0x99, 0xd6, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0x99, 0xd6, 0xff, 0x0d, 0x22, 0xfc, 
-  0x14, 0x74, 0xc4, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0x6e, 0x32, 0xff, 0x4e, 0x32, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0x8f, 0x32, 0xff, 0x4e, 0x2a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0x34, 0x74, 0xc4, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xa5, 0xff, 0x75, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xd6, 0xff, 0x71, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xa5, 0xff, 0x75, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0x0d, 0x22, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xd6, 0xff, 0x71, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xa5, 0xff, 0x75, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xce, 0xff, 0x51, 0x53, 0xff, 0x18, 0xbe, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x58, 0xce, 0xff, 0x8f, 0x32, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x5b, 0xc6, 0xff, 0x5b, 0xc6, 0xff, 0x5b, 0xc6, 0xff, 0x5b, 0xc6, 0xff, 0x5b, 0xc6, 0xff, 0x5b, 0xc6, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xd6, 0xff, 0x71, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xa5, 0xff, 0x75, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xce, 0xff, 0x51, 0x53, 0xff, 0xef, 0x4a, 0xff, 0x2c, 0x52, 0xff, 0x4c, 0x62, 0xff, 0x4c, 0x62, 0xff, 0x4c, 0x62, 0xff, 0x4c, 0x62, 0xff, 0x0c, 0x4a, 0xff, 0xd2, 0x6b, 0xff, 0x8f, 0x32, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xad, 0xff, 0x8f, 0x3a, 0xff, 0xb2, 0x63, 0xff, 0xb2, 0x63, 0xff, 0xb2, 0x63, 0xff, 0xb2, 0x63, 0xff, 0xf0, 0x42, 0xff, 0xb5, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xd6, 0xff, 0x71, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xa5, 0xff, 0x75, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xce, 0xff, 0x51, 0x53, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x92, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x0b, 0x7a, 0xff, 0xd2, 0x6b, 0xff, 0x8f, 0x32, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xad, 0xff, 0x13, 0x74, 0xff, 0xd7, 0xb5, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x56, 0xa5, 0xff, 0xf5, 0x94, 0xff, 0x95, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xd6, 0xff, 0x71, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xa5, 0xff, 0x75, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xce, 0xff, 0x51, 0x53, 0xff, 0x12, 0x7c, 0xff, 0x8e, 0x42, 0xff, 0x8e, 0x42, 0xff, 0x8e, 0x42, 0xff, 0x8e, 0x42, 0xff, 0x8e, 0x42, 0xff, 0x8e, 0x42, 0xff, 0xd4, 0x94, 0xff, 0x8f, 0x32, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xad, 0xff, 0x13, 0x74, 0xff, 0x15, 0x9d, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x53, 0x7c, 0xff, 0xf5, 0x94, 0xff, 0x95, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xd6, 0xff, 0x71, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xbe, 0xff, 0xb2, 0x63, 0xff, 0x10, 0x4b, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb2, 0x63, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0x10, 0x53, 0xff, 0xb2, 0x63, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xf3, 0x6b, 0xff, 0x6e, 0x32, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x0d, 0x22, 0xff, 0x75, 0x7c, 0xff, 0xb5, 0x84, 0xff, 0x92, 0x5b, 0xff, 0xcf, 0x42, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x53, 0x7c, 0xff, 0x50, 0x53, 0xff, 0x31, 0x4b, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0xb5, 0x84, 0xff, 0x14, 0x74, 0xff, 0x8f, 0x3a, 0xff, 0x1a, 0xb6, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0xff, 0xd0, 0x42, 0xff, 0x31, 0x53, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0x6e, 0x3a, 0xff, 0x0b, 0x62, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x62, 0xff, 0x4e, 0x3a, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0x95, 0x84, 0xff, 0x71, 0x5b, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x92, 0x5b, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0x74, 0x7c, 0xff, 0x71, 0x5b, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x71, 0x53, 0xff, 0x34, 0x74, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0xb5, 0x8c, 0xff, 0x95, 0x84, 0xff, 0xd3, 0x6b, 0xff, 0x31, 0x53, 0xff, 0xaf, 0x3a, 0xff, 0x1d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xdf, 0xff, 0xff, 0xaf, 0x3a, 0xff, 0x16, 0x95, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xa2, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x16, 0x95, 0xff, 0xaf, 0x3a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xd9, 0xb5, 0xff, 0x72, 0x5b, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xa2, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x72, 0x5b, 0xff, 0xb9, 0xad, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x95, 0x84, 0xff, 0xd6, 0x8c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x2b, 0x7a, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf6, 0x94, 0xff, 0x75, 0x7c, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x92, 0xff, 0xec, 0x29, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0x0b, 0x6a, 0xff, 0xec, 0x29, 0xff, 0x2b, 0x92, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x77, 0xa5, 0xff, 0x92, 0x5b, 0xff, 0xcf, 0x42, 0xff, 0x8f, 0x3a, 0xff, 0x92, 0x5b, 0xff, 0x37, 0x9d, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x82, 0xff, 0xec, 0x49, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x51, 0xff, 0x2b, 0x82, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xbd, 0xff, 0x13, 0x6c, 0xff, 0xd0, 0x42, 0xff, 0x8f, 0x3a, 0xff, 0x31, 0x53, 0xff, 0xb5, 0x84, 0xff, 0xfc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x31, 0x4b, 0xff, 0x31, 0x53, 0xff, 0x77, 0xa5, 0xff, 0x7a, 0xce, 0xff, 0xbb, 0xd6, 0xff, 0xb8, 0xb5, 0xff, 0xb2, 0x63, 0xff, 0xd0, 0x42, 0xff, 0x5a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x82, 0xff, 0xec, 0x49, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0x2d, 0x4a, 0xff, 0x0d, 0x2a, 0xff, 0x2d, 0x4a, 0xff, 0x2a, 0xaa, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xba, 0xff, 0x2c, 0x5a, 0xff, 0x0d, 0x2a, 0xff, 0x2d, 0x42, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x51, 0xff, 0x2b, 0x82, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x13, 0x74, 0xff, 0x8f, 0x3a, 0xff, 0x16, 0x95, 0xff, 0x5a, 0xc6, 0xff, 0xbb, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x54, 0x7c, 0xff, 0x8f, 0x32, 0xff, 0x98, 0xad, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xaf, 0x3a, 0xff, 0xd6, 0x8c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x77, 0xa5, 0xff, 0x8f, 0x3a, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x82, 0xff, 0xec, 0x49, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xc2, 0xff, 0x0d, 0x32, 0xff, 0xf5, 0x94, 0xff, 0xb9, 0xde, 0xff, 0x15, 0x9d, 0xff, 0x0d, 0x32, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2d, 0x42, 0xff, 0x74, 0x84, 0xff, 0xb9, 0xde, 0xff, 0x96, 0xad, 0xff, 0x0d, 0x2a, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x51, 0xff, 0x2b, 0x82, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd2, 0x63, 0xff, 0xb2, 0x63, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x8f, 0x3a, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x13, 0x74, 0xff, 0x34, 0x74, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xbd, 0xff, 0xd2, 0x6b, 0xff, 0xb2, 0x6b, 0xff, 0x98, 0xad, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd6, 0x8c, 0xff, 0xb2, 0x63, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x82, 0xff, 0xec, 0x49, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0x9a, 0xff, 0xef, 0x52, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0xef, 0x52, 0xff, 0x2b, 0x9a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0x4e, 0x32, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0xf2, 0x73, 0xff, 0x2b, 0x82, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x51, 0xff, 0x2b, 0x82, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x77, 0xa5, 0xff, 0xf0, 0x42, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x13, 0x74, 0xff, 0x91, 0x63, 0xff, 0xf6, 0x94, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3a, 0xc6, 0xff, 0x8f, 0x32, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xe6, 0xff, 0x4e, 0x2a, 0xff, 0xfc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x37, 0x9d, 0xff, 0x2d, 0x32, 0xff, 0x2b, 0x82, 0xff, 0x2b, 0x82, 0xff, 0x2d, 0x3a, 0xff, 0x74, 0x84, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x8f, 0x32, 0xff, 0x9b, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x82, 0xff, 0xec, 0x49, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xa2, 0xff, 0xaf, 0x42, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0xaf, 0x42, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xba, 0xff, 0x2d, 0x2a, 0xff, 0x1a, 0xe7, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x91, 0x63, 0xff, 0x2b, 0x8a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x51, 0xff, 0x2b, 0x82, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x51, 0x53, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x2d, 0x32, 0xff, 0x2b, 0x7a, 0xff, 0x2b, 0x8a, 0xff, 0x2d, 0x52, 0xff, 0x10, 0x53, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xd2, 0x63, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd8, 0xb5, 0xff, 0x51, 0x53, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x2d, 0x2a, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xba, 0xff, 0x0d, 0x2a, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x13, 0x6c, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x82, 0xff, 0xec, 0x49, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2d, 0x42, 0xff, 0xd2, 0x6b, 0xff, 0xb7, 0xb5, 0xff, 0xb1, 0x63, 0xff, 0x2d, 0x4a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x5a, 0xff, 0x50, 0x5b, 0xff, 0xb7, 0xad, 0xff, 0x53, 0x7c, 0xff, 0x2d, 0x32, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x51, 0xff, 0x2b, 0x82, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x0d, 0x22, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x10, 0x53, 0xff, 0x2b, 0x8a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2d, 0x42, 0xff, 0x98, 0xad, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x13, 0x74, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x77, 0xa5, 0xff, 0xf3, 0x6b, 0xff, 0x3d, 0xef, 0xff, 0x9b, 0xce, 0xff, 0x2d, 0x3a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4d, 0x4a, 0xff, 0xf9, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x95, 0x84, 0xff, 0xb5, 0x8c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x82, 0xff, 0xec, 0x49, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xc2, 0xff, 0x2c, 0x72, 0xff, 0x4d, 0x52, 0xff, 0x2c, 0x72, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xc2, 0xff, 0x2b, 0x7a, 0xff, 0x4d, 0x52, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xba, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x51, 0xff, 0x2b, 0x82, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xdb, 0xd6, 0xff, 0x8f, 0x32, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x2e, 0x32, 0xff, 0x4a, 0xba, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2b, 0x72, 0xff, 0x95, 0x84, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xb5, 0xff, 0x51, 0x53, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xb8, 0xad, 0xff, 0x72, 0x5b, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x0d, 0x2a, 0xff, 0x4a, 0xba, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xc2, 0xff, 0x2d, 0x32, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0xf3, 0x6b, 0xff, 0x16, 0x95, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2b, 0x82, 0xff, 0xec, 0x49, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x49, 0xff, 0x0b, 0x82, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x4e, 0x2a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf0, 0x4a, 0xff, 0x2b, 0x92, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4d, 0x52, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x57, 0x9d, 0xff, 0xb2, 0x63, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x2e, 0x2a, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xb5, 0x8c, 0xff, 0x2d, 0x42, 0xff, 0x2b, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2d, 0x4a, 0xff, 0x13, 0x74, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x8f, 0x3a, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x10, 0x53, 0xff, 0x2b, 0x92, 0xff, 0xec, 0x31, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x31, 0xff, 0x2b, 0x92, 0xff, 0x10, 0x53, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x10, 0x4b, 0xff, 0xf9, 0xbd, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xb5, 0xff, 0x2d, 0x32, 0xff, 0x2b, 0x8a, 0xff, 0x2a, 0xa2, 0xff, 0x2c, 0x62, 0xff, 0xcf, 0x4a, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xf3, 0x6b, 0xff, 0xf6, 0x94, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd3, 0x6b, 0xff, 0xb5, 0x84, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x30, 0x53, 0xff, 0x30, 0x53, 0xff, 0x16, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x37, 0x9d, 0xff, 0x31, 0x4b, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x16, 0x9d, 0xff, 0x2d, 0x42, 0xff, 0x2b, 0x8a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x0b, 0x7a, 0xff, 0x2b, 0x8a, 0xff, 0x2d, 0x42, 0xff, 0x16, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x37, 0x9d, 0xff, 0x51, 0x53, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x71, 0x63, 0xff, 0xf0, 0x4a, 0xff, 0x74, 0x84, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x4e, 0x2a, 0xff, 0xdc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x6e, 0x32, 0xff, 0x98, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xb5, 0xff, 0x4e, 0x2a, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x36, 0x9d, 0xff, 0x30, 0x5b, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0xf0, 0x52, 0xff, 0x30, 0x5b, 0xff, 0x36, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x31, 0x53, 0xff, 0x54, 0x7c, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0xaf, 0x3a, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x8f, 0x3a, 0xff, 0xf3, 0x6b, 0xff, 0x19, 0xbe, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3a, 0xc6, 0xff, 0x33, 0x74, 0xff, 0x6e, 0x32, 0xff, 0xf9, 0xbd, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x51, 0x53, 0xff, 0x31, 0x4b, 0xff, 0x98, 0xad, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x9b, 0xce, 0xff, 0xd6, 0x8c, 0xff, 0x4e, 0x2a, 0xff, 0xf6, 0x94, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xf6, 0x94, 0xff, 0xf0, 0x4a, 0xff, 0x2e, 0x2a, 0xff, 0xed, 0x21, 0xff, 0xaf, 0x3a, 0xff, 0x74, 0x84, 0xff, 0xdc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x98, 0xad, 0xff, 0x51, 0x53, 0xff, 0x4e, 0x2a, 0xff, 0xed, 0x19, 0xff, 0x6e, 0x32, 0xff, 0xf3, 0x6b, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0xd5, 0x8c, 0xff, 0xcf, 0x4a, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0xcf, 0x4a, 0xff, 0xd5, 0x8c, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf6, 0x94, 0xff, 0x2d, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2d, 0x4a, 0xff, 0xf6, 0x94, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x10, 0x53, 0xff, 0x2a, 0x9a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xa2, 0xff, 0xf0, 0x52, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x16, 0x95, 0xff, 0x34, 0x74, 0xff, 0xb2, 0x63, 0xff, 0xb2, 0x63, 0xff, 0x34, 0x74, 0xff, 0x16, 0x95, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x9b, 0xd6, 0xff, 0x37, 0x9d, 0xff, 0x54, 0x7c, 0xff, 0xb2, 0x63, 0xff, 0xb2, 0x63, 0xff, 0x33, 0x74, 0xff, 0x16, 0x95, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x57, 0xa5, 0xff, 0xf0, 0x42, 0xff, 0x8f, 0x32, 0xff, 0xf3, 0x6b, 0xff, 0xf6, 0x94, 0xff, 0x77, 0xa5, 0xff, 0x57, 0xa5, 0xff, 0xd6, 0x8c, 0xff, 0xf3, 0x6b, 0xff, 0x6e, 0x32, 0xff, 0xf0, 0x42, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x98, 0xad, 0xff, 0x10, 0x4b, 0xff, 0x6e, 0x32, 0xff, 0xd3, 0x6b, 0xff, 0xf6, 0x94, 0xff, 0x77, 0xa5, 0xff, 0x77, 0xa5, 0xff, 0xf6, 0x94, 0xff, 0x33, 0x74, 0xff, 0x8f, 0x32, 0xff, 0xaf, 0x3a, 0xff, 0x37, 0x9d, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x10, 0x4b, 0xff, 0x10, 0x4b, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd9, 0xb5, 0xff, 0x10, 0x4b, 0xff, 0xf0, 0x4a, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x9b, 0xd6, 0xff, 0x51, 0x53, 0xff, 0xd0, 0x42, 0xff, 0xb8, 0xad, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x51, 0x53, 0xff, 0xcf, 0x42, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xb5, 0xff, 0x6e, 0x32, 0xff, 0x16, 0x95, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0xd9, 0xb5, 0xff, 0xd9, 0xb5, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x37, 0x9d, 0xff, 0x4e, 0x2a, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x39, 0xc6, 0xff, 0x6e, 0x32, 0xff, 0xd5, 0x8c, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xb5, 0xff, 0xd8, 0xb5, 0xff, 0x7a, 0xce, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x77, 0xa5, 0xff, 0x4e, 0x2a, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x4e, 0x2a, 0xff, 0x19, 0xbe, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x54, 0x7c, 0xff, 0x6e, 0x32, 0xff, 0x8f, 0x3a, 0xff, 0x51, 0x53, 0xff, 0x31, 0x53, 0xff, 0x8f, 0x3a, 0xff, 0x6e, 0x32, 0xff, 0x34, 0x74, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x6e, 0x32, 0xff, 0xf9, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5a, 0xce, 0xff, 0x4e, 0x32, 0xff, 0xb8, 0xad, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xdc, 0xde, 0xff, 0x74, 0x84, 0xff, 0x6e, 0x32, 0xff, 0x8f, 0x32, 0xff, 0x51, 0x53, 0xff, 0x51, 0x53, 0xff, 0xaf, 0x3a, 0xff, 0x4e, 0x2a, 0xff, 0x13, 0x74, 0xff, 0x9b, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x6f, 0x32, 0xff, 0x98, 0xad, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0x6e, 0x32, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x6e, 0x32, 0xff, 0x54, 0x7c, 0xff, 0x9b, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x9b, 0xce, 0xff, 0x54, 0x7c, 0xff, 0x4e, 0x2a, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd8, 0xb5, 0xff, 0x6e, 0x32, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xe6, 0xff, 0x8f, 0x3a, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x98, 0xad, 0xff, 0x6e, 0x32, 0xff, 0x13, 0x74, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x95, 0x84, 0xff, 0x4e, 0x2a, 0xff, 0xf6, 0x94, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x4e, 0x32, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd3, 0x6b, 0xff, 0x54, 0x7c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf6, 0x94, 0xff, 0xaf, 0x3a, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0xf9, 0xbd, 0xff, 0xf9, 0xbd, 0xff, 0xdb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0xaf, 0x3a, 0xff, 0xd5, 0x8c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x95, 0x84, 0xff, 0xd2, 0x63, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x54, 0x7c, 0xff, 0xf3, 0x6b, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0x9d, 0xff, 0x8f, 0x32, 0xff, 0x39, 0xbe, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xf9, 0xbd, 0xff, 0xf9, 0xb5, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0xf0, 0x42, 0xff, 0x54, 0x7c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf6, 0x94, 0xff, 0x51, 0x53, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x4e, 0x2a, 0xff, 0xfc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0xd8, 0xb5, 0xff, 0x8f, 0x3a, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x71, 0x5b, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x19, 0xff, 0x71, 0x5b, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x8f, 0x32, 0xff, 0xb8, 0xad, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xe6, 0xff, 0x6e, 0x32, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x2e, 0x2a, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x39, 0xbe, 0xff, 0x6e, 0x32, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x9b, 0xd6, 0xff, 0xb2, 0x63, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x19, 0xff, 0x31, 0x53, 0xff, 0x19, 0xbe, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xcf, 0x42, 0xff, 0x57, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0xaf, 0x3a, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x34, 0x74, 0xff, 0x95, 0x84, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x8f, 0x3a, 0xff, 0xf9, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xbd, 0xff, 0x2e, 0x2a, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0x0d, 0x22, 0xff, 0xd9, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xbd, 0xff, 0x8f, 0x3a, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xd5, 0x8c, 0xff, 0x13, 0x74, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xba, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x95, 0x84, 0xff, 0x13, 0x74, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf0, 0x42, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x3a, 0xc6, 0xff, 0x4e, 0x2a, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0xed, 0x21, 0xff, 0xed, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x6e, 0x32, 0xff, 0xfc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x37, 0x9d, 0xff, 0xb2, 0x63, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x8f, 0x3a, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x77, 0xa5, 0xff, 0x51, 0x53, 0xff, 0x3d, 0xef, 0xff, 0xdc, 0xde, 0xff, 0x4e, 0x2a, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x21, 0xff, 0xec, 0x49, 0xff, 0x2b, 0x82, 0xff, 0x2b, 0x82, 0xff, 0xec, 0x41, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0x2e, 0x2a, 0xff, 0xdb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x71, 0x5b, 0xff, 0x57, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x6e, 0x32, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x2c, 0x62, 0xff, 0x4e, 0x32, 0xff, 0xaf, 0x42, 0xff, 0xaf, 0x42, 0xff, 0xaf, 0x42, 0xff, 0x4e, 0x32, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x10, 0x4b, 0xff, 0xf9, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0xd9, 0xb5, 0xff, 0xd0, 0x42, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x8f, 0x32, 0xff, 0xcd, 0x19, 0xff, 0xec, 0x21, 0xff, 0xec, 0x41, 0xff, 0x2b, 0x82, 0xff, 0x2b, 0x82, 0xff, 0x0c, 0x4a, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0x0d, 0x22, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0xf3, 0x6b, 0xff, 0xf6, 0x94, 0xff, 0x3d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0x2e, 0x2a, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x4e, 0x2a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd2, 0x63, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x95, 0x84, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0x0b, 0x72, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x0b, 0x72, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0x54, 0x7c, 0xff, 0x3d, 0xef, 0xff, 0x57, 0x9d, 0xff, 0xb2, 0x63, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x8f, 0x32, 0xff, 0x9b, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x62, 0xff, 0x56, 0xa5, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x15, 0x95, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xed, 0x21, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x34, 0x74, 0xff, 0xd5, 0x8c, 0xff, 0x3d, 0xef, 0xff, 0xf6, 0x94, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x21, 0xff, 0x0c, 0x62, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x0b, 0x82, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xf3, 0x6b, 0xff, 0x3d, 0xef, 0xff, 0xd8, 0xb5, 0xff, 0x51, 0x53, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf0, 0x42, 0xff, 0x39, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x10, 0x4b, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x42, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0xf0, 0x42, 0xff, 0xcd, 0x19, 0xff, 0xec, 0x29, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x29, 0xff, 0xcd, 0x19, 0xff, 0xcf, 0x42, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x8f, 0x3a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x31, 0x53, 0xff, 0xf9, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x62, 0xff, 0x13, 0x74, 0xff, 0x76, 0xa5, 0xff, 0x76, 0xa5, 0xff, 0x76, 0xa5, 0xff, 0xf2, 0x6b, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0xaf, 0x3a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x31, 0x53, 0xff, 0xf9, 0xbd, 0xff, 0x3d, 0xef, 0xff, 0x51, 0x53, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x21, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x39, 0xff, 0xcd, 0x19, 0xff, 0x4e, 0x2a, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x2e, 0x2a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x92, 0x63, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xb8, 0xad, 0xff, 0x51, 0x53, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x4e, 0x2a, 0xff, 0xfc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x4e, 0x2a, 0xff, 0xcd, 0x19, 0xff, 0xec, 0x49, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x51, 0xff, 0xcd, 0x19, 0xff, 0x0d, 0x22, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x2e, 0x2a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xb2, 0x63, 0xff, 0x98, 0xad, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x2b, 0x92, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x2b, 0x92, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0xf0, 0x42, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xaf, 0x3a, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0xaf, 0x3a, 0xff, 0xcd, 0x19, 0xff, 0xec, 0x39, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x0b, 0x62, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x2e, 0x2a, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x33, 0x74, 0xff, 0x16, 0x95, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd9, 0xb5, 0xff, 0x51, 0x53, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x8f, 0x32, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x8f, 0x3a, 0xff, 0xcd, 0x19, 0xff, 0xec, 0x39, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x41, 0xff, 0xcd, 0x19, 0xff, 0x6e, 0x32, 0xff, 0x3d, 0xef, 0xff, 0xdc, 0xde, 0xff, 0x8f, 0x32, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x72, 0x5b, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0xd0, 0x42, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf0, 0x42, 0xff, 0x3a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x10, 0x4b, 0xff, 0xcd, 0x19, 0xff, 0xec, 0x31, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0xec, 0x51, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x2e, 0x2a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf3, 0x6b, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x8f, 0x3a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x51, 0x53, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0xd2, 0x63, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0x2a, 0xaa, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xaa, 0xff, 0xcd, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xb2, 0x63, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xb5, 0xff, 0x31, 0x53, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf0, 0x42, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x2b, 0x92, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x2b, 0x92, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xc2, 0xff, 0x2c, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x4d, 0x5a, 0xff, 0x2c, 0x62, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xdc, 0xde, 0xff, 0x2e, 0x2a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xb2, 0x63, 0xff, 0x57, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x34, 0x74, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0x2b, 0x9a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0x31, 0x53, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0xd0, 0x42, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x51, 0x53, 0xff, 0xf9, 0xbd, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x0d, 0x22, 0xff, 0xdb, 0xde, 0xff, 0x3d, 0xef, 0xff, 0xd5, 0x8c, 0xff, 0x34, 0x74, 0xff, 0x3d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0xed, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xec, 0x29, 0xff, 0x2b, 0x9a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0x9a, 0xff, 0xec, 0x29, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x54, 0x7c, 0xff, 0xd5, 0x8c, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x2e, 0x2a, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x62, 0xff, 0x13, 0x74, 0xff, 0x76, 0xa5, 0xff, 0x76, 0xa5, 0xff, 0x76, 0xa5, 0xff, 0xf2, 0x6b, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0x2e, 0x32, 0xff, 0x76, 0xa5, 0xff, 0x76, 0xa5, 0xff, 0x76, 0xa5, 0xff, 0x76, 0xa5, 0xff, 0x0d, 0x22, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x6e, 0x32, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x37, 0x9d, 0xff, 0xb2, 0x63, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0x2b, 0x8a, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xa2, 0xff, 0xec, 0x29, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0xd5, 0x8c, 0xff, 0x54, 0x7c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x4e, 0x2a, 0xff, 0xdc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x92, 0x5b, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x6e, 0x32, 0xff, 0xdb, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x54, 0x7c, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x21, 0xff, 0xcd, 0x21, 0xff, 0xec, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0x33, 0x74, 0xff, 0x3d, 0xef, 0xff, 0xdc, 0xde, 0xff, 0x6e, 0x32, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x98, 0xa5, 0xff, 0x92, 0x63, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x62, 0xff, 0x56, 0xa5, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x15, 0x95, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0x6e, 0x3a, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x0d, 0x2a, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x13, 0x6c, 0xff, 0xd5, 0x8c, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x4e, 0x32, 0xff, 0x9b, 0xce, 0xff, 0x3d, 0xef, 0xff, 0xb5, 0x8c, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x21, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x21, 0xff, 0xcd, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xb2, 0x63, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x8f, 0x3a, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xbd, 0xff, 0x31, 0x4b, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x98, 0xa5, 0xff, 0x10, 0x4b, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x74, 0x7c, 0xff, 0xb2, 0x63, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x95, 0x84, 0xff, 0xed, 0x21, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x21, 0xff, 0x74, 0x84, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xd2, 0x63, 0xff, 0x74, 0x7c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x51, 0x53, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x2c, 0x62, 0xff, 0x4e, 0x32, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x4e, 0x32, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0xed, 0x21, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0x8f, 0x42, 0xff, 0xed, 0x21, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf9, 0xb5, 0xff, 0x8f, 0x3a, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xd6, 0x8c, 0xff, 0x51, 0x53, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xd6, 0x8c, 0xff, 0x0d, 0x22, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x19, 0xff, 0x13, 0x74, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x54, 0x7c, 0xff, 0x13, 0x6c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd2, 0x63, 0xff, 0xf6, 0x94, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0xd0, 0x42, 0xff, 0x98, 0xad, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x31, 0x4b, 0xff, 0x34, 0x74, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x9b, 0xd6, 0xff, 0xd5, 0x8c, 0xff, 0xd3, 0x6b, 0xff, 0xd3, 0x6b, 0xff, 0xb5, 0x8c, 0xff, 0x9b, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x54, 0x7c, 0xff, 0x31, 0x4b, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xd9, 0xb5, 0xff, 0xd0, 0x42, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xba, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xaa, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x31, 0x4b, 0xff, 0x16, 0x95, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x71, 0x5b, 0xff, 0xd3, 0x6b, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0xd6, 0x8c, 0xff, 0xd3, 0x6b, 0xff, 0xd2, 0x63, 0xff, 0x95, 0x84, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd6, 0x8c, 0xff, 0xf0, 0x42, 0xff, 0xfc, 0xe6, 0xff, 0x3d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x8f, 0x3a, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd9, 0xb5, 0xff, 0x6e, 0x32, 0xff, 0xdb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x51, 0x53, 0xff, 0x51, 0x53, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x71, 0x5b, 0xff, 0x71, 0x53, 0xff, 0xfc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x8f, 0x3a, 0xff, 0xd8, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xba, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xba, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xb2, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3a, 0xc6, 0xff, 0x4e, 0x32, 0xff, 0x9b, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x92, 0x63, 0xff, 0x10, 0x4b, 0xff, 0x3a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0xb2, 0x63, 0xff, 0x10, 0x4b, 0xff, 0xdb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xd0, 0x42, 0xff, 0x77, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x74, 0x7c, 0xff, 0x10, 0x4b, 0xff, 0xfc, 0xe6, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0xf6, 0x94, 0xff, 0x6e, 0x32, 0xff, 0x51, 0x53, 0xff, 0xd5, 0x8c, 0xff, 0x77, 0xa5, 0xff, 0x77, 0xa5, 0xff, 0xd5, 0x8c, 0xff, 0x51, 0x53, 0xff, 0x6e, 0x32, 0xff, 0xf6, 0x94, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x51, 0x53, 0xff, 0x95, 0x84, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x2c, 0x62, 0xff, 0x2d, 0x2a, 0xff, 0x4e, 0x32, 0xff, 0x4e, 0x32, 0xff, 0x4e, 0x32, 0xff, 0x0d, 0x2a, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xba, 0xff, 0xed, 0x21, 0xff, 0x4e, 0x32, 0xff, 0x4e, 0x32, 0xff, 0x4e, 0x32, 0xff, 0x4e, 0x32, 0xff, 0xed, 0x21, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x2c, 0x62, 0xff, 0x2d, 0x2a, 0xff, 0x4e, 0x32, 0xff, 0x4e, 0x32, 0xff, 0x4e, 0x32, 0xff, 0x2d, 0x2a, 0xff, 0x2c, 0x72, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xd6, 0x8c, 0xff, 0xaf, 0x3a, 0xff, 0xdc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x37, 0x9d, 0xff, 0x6f, 0x32, 0xff, 0x31, 0x4b, 0xff, 0xb5, 0x84, 0xff, 0x57, 0xa5, 0xff, 0x77, 0xa5, 0xff, 0xd6, 0x8c, 0xff, 0x92, 0x5b, 0xff, 0x6e, 0x32, 0xff, 0xd5, 0x8c, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xb2, 0x63, 0xff, 0x13, 0x74, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf3, 0x6b, 0xff, 0xf0, 0x42, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xb8, 0xad, 0xff, 0x74, 0x7c, 0xff, 0xd3, 0x6b, 0xff, 0xd3, 0x6b, 0xff, 0x74, 0x84, 0xff, 0xd8, 0xb5, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x31, 0x4b, 0xff, 0xf3, 0x6b, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x62, 0xff, 0x56, 0xa5, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x15, 0x95, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0x6e, 0x3a, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x0d, 0x2a, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4d, 0x5a, 0xff, 0x76, 0xa5, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0xd5, 0x94, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x74, 0x7c, 0xff, 0xaf, 0x3a, 0xff, 0x7a, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0xd8, 0xb5, 0xff, 0x74, 0x84, 0xff, 0xd3, 0x6b, 0xff, 0xd3, 0x6b, 0xff, 0x74, 0x7c, 0xff, 0xb8, 0xad, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x72, 0x5b, 0xff, 0x92, 0x5b, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xb5, 0x8c, 0xff, 0x4e, 0x2a, 0xff, 0x16, 0x95, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x37, 0x9d, 0xff, 0x6e, 0x32, 0xff, 0xd5, 0x8c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x62, 0xff, 0x53, 0x7c, 0xff, 0xb7, 0xb5, 0xff, 0xb7, 0xb5, 0xff, 0xb7, 0xb5, 0xff, 0x33, 0x74, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0x4e, 0x32, 0xff, 0xb7, 0xb5, 0xff, 0xb7, 0xb5, 0xff, 0xb7, 0xb5, 0xff, 0xb7, 0xb5, 0xff, 0x0d, 0x2a, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4d, 0x5a, 0xff, 0x74, 0x84, 0xff, 0xb7, 0xb5, 0xff, 0xb7, 0xb5, 0xff, 0xb7, 0xb5, 0xff, 0x13, 0x74, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x16, 0x95, 0xff, 0x2e, 0x2a, 0xff, 0xd5, 0x8c, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x77, 0xa5, 0xff, 0x6f, 0x32, 0xff, 0x74, 0x7c, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3a, 0xc6, 0xff, 0x51, 0x53, 0xff, 0x6e, 0x32, 0xff, 0x74, 0x7c, 0xff, 0xf9, 0xb5, 0xff, 0xdc, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xf9, 0xbd, 0xff, 0x74, 0x84, 0xff, 0x8f, 0x3a, 0xff, 0x71, 0x53, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x2b, 0x8a, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x2b, 0x92, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xc2, 0xff, 0x2d, 0x52, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x2d, 0x52, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x2b, 0x82, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x4d, 0x4a, 0xff, 0x2b, 0x92, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x72, 0x5b, 0xff, 0x4e, 0x2a, 0xff, 0x54, 0x7c, 0xff, 0xd8, 0xb5, 0xff, 0xdb, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x19, 0xbe, 0xff, 0x95, 0x84, 0xff, 0xaf, 0x3a, 0xff, 0x31, 0x4b, 0xff, 0x19, 0xbe, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x54, 0x7c, 0xff, 0x10, 0x4b, 0xff, 0x0d, 0x22, 0xff, 0x0d, 0x22, 0xff, 0xcd, 0x19, 0xff, 0x4e, 0x2a, 0xff, 0x10, 0x4b, 0xff, 0x95, 0x84, 0xff, 0x3a, 0xc6, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x74, 0x7c, 0xff, 0x10, 0x4b, 0xff, 0x2e, 0x2a, 0xff, 0x0d, 0x22, 0xff, 0xed, 0x19, 0xff, 0x2e, 0x2a, 0xff, 0xf0, 0x42, 0xff, 0x74, 0x7c, 0xff, 0x19, 0xbe, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x2b, 0x9a, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2b, 0x9a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xc2, 0xff, 0x2c, 0x6a, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2b, 0x92, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2c, 0x62, 0xff, 0x2b, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x62, 0xff, 0xf2, 0x6b, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0xb2, 0x63, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0x2d, 0x32, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x0d, 0x22, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4d, 0x5a, 0xff, 0x12, 0x6c, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0x15, 0x9d, 0xff, 0xb1, 0x63, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x62, 0xff, 0x56, 0xa5, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x15, 0x95, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0x6e, 0x3a, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x0d, 0x2a, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4d, 0x5a, 0xff, 0x76, 0xa5, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0x3b, 0xef, 0xff, 0xd5, 0x94, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x57, 0xa5, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x75, 0x7c, 0xff, 0x37, 0x9d, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x2c, 0x62, 0xff, 0x8e, 0x3a, 0xff, 0x0f, 0x53, 0xff, 0x0f, 0x53, 0xff, 0x0f, 0x53, 0xff, 0x8e, 0x3a, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0xed, 0x21, 0xff, 0x0f, 0x53, 0xff, 0x0f, 0x53, 0xff, 0x0f, 0x53, 0xff, 0x0f, 0x53, 0xff, 0xed, 0x21, 0xff, 0x4a, 0xc2, 0xff, 0x4a, 0xca, 0xff, 0x4c, 0x5a, 0xff, 0xaf, 0x42, 0xff, 0x0f, 0x53, 0xff, 0x0f, 0x53, 0xff, 0x0f, 0x53, 0xff, 0x8e, 0x3a, 0xff, 0x2c, 0x6a, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x37, 0x9d, 0xff, 0x34, 0x74, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x17, 0x95, 0xff, 0x54, 0x7c, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xba, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x4a, 0xba, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xa2, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xb2, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x2a, 0x9a, 0xff, 0x4a, 0xba, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x54, 0x7c, 0xff, 0xf6, 0x94, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x1d, 0xe7, 0xff, 0x6e, 0x32, 0xff, 0xdb, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0x6e, 0x32, 0xff, 0x1d, 0xdf, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x17, 0x95, 0xff, 0xcf, 0x42, 0xff, 0xd8, 0xb5, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xcf, 0x4a, 0xff, 0x2a, 0xa2, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x4a, 0xca, 0xff, 0x2a, 0xaa, 0xff, 0xcf, 0x4a, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xd8, 0xb5, 0xff, 0xcf, 0x42, 0xff, 0xf6, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xb6, 0xff, 0x31, 0x4b, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0xed, 0x29, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xcd, 0x19, 0xff, 0xed, 0x29, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x2e, 0x2a, 0xff, 0x10, 0x4b, 0xff, 0xf9, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x63, 0xb2, 0xd1, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0x63, 0xb2, 0xd1, 
-  0x21, 0xed, 0xfd, 0xe7, 0x1a, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xe7, 0x1a, 0xff, 0x21, 0xed, 0xfd, 
-  0x21, 0xed, 0xfd, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x21, 0xed, 0xfd, 
-  0x22, 0x0d, 0xfc, 0xd6, 0x99, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xd6, 0x99, 0xff, 0x22, 0x0d, 0xfc, 
-  0x74, 0x14, 0xc4, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x32, 0x6e, 0xff, 0x32, 0x4e, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x32, 0x8f, 0xff, 0x2a, 0x4e, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x74, 0x34, 0xc4, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x98, 0xff, 0x7c, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xbc, 0xff, 0x53, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x98, 0xff, 0x7c, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfc, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x22, 0x0d, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xbc, 0xff, 0x53, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x98, 0xff, 0x7c, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x7b, 0xff, 0x53, 0x51, 0xff, 0xbe, 0x18, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0xce, 0x58, 0xff, 0x32, 0x8f, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xc6, 0x5b, 0xff, 0xc6, 0x5b, 0xff, 0xc6, 0x5b, 0xff, 0xc6, 0x5b, 0xff, 0xc6, 0x5b, 0xff, 0xc6, 0x5b, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xbc, 0xff, 0x53, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x98, 0xff, 0x7c, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x7b, 0xff, 0x53, 0x51, 0xff, 0x4a, 0xef, 0xff, 0x52, 0x2c, 0xff, 0x62, 0x4c, 0xff, 0x62, 0x4c, 0xff, 0x62, 0x4c, 0xff, 0x62, 0x4c, 0xff, 0x4a, 0x0c, 0xff, 0x6b, 0xd2, 0xff, 0x32, 0x8f, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xad, 0xb9, 0xff, 0x3a, 0x8f, 0xff, 0x63, 0xb2, 0xff, 0x63, 0xb2, 0xff, 0x63, 0xb2, 0xff, 0x63, 0xb2, 0xff, 0x42, 0xf0, 0xff, 0x84, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xbc, 0xff, 0x53, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x98, 0xff, 0x7c, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x7b, 0xff, 0x53, 0x51, 0xff, 0x4a, 0xcf, 0xff, 0x92, 0x2b, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x7a, 0x0b, 0xff, 0x6b, 0xd2, 0xff, 0x32, 0x8f, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xad, 0xb8, 0xff, 0x74, 0x13, 0xff, 0xb5, 0xd7, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0xa5, 0x56, 0xff, 0x94, 0xf5, 0xff, 0x84, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xbc, 0xff, 0x53, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x98, 0xff, 0x7c, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x7b, 0xff, 0x53, 0x51, 0xff, 0x7c, 0x12, 0xff, 0x42, 0x8e, 0xff, 0x42, 0x8e, 0xff, 0x42, 0x8e, 0xff, 0x42, 0x8e, 0xff, 0x42, 0x8e, 0xff, 0x42, 0x8e, 0xff, 0x94, 0xd4, 0xff, 0x32, 0x8f, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xad, 0xb8, 0xff, 0x74, 0x13, 0xff, 0x9d, 0x15, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x7c, 0x53, 0xff, 0x94, 0xf5, 0xff, 0x84, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xbc, 0xff, 0x53, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x1a, 0xff, 0x63, 0xb2, 0xff, 0x4b, 0x10, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x63, 0xb2, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x53, 0x10, 0xff, 0x63, 0xb2, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x6b, 0xf3, 0xff, 0x32, 0x6e, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x22, 0x0d, 0xff, 0x7c, 0x75, 0xff, 0x84, 0xb5, 0xff, 0x5b, 0x92, 0xff, 0x42, 0xcf, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x7c, 0x53, 0xff, 0x53, 0x50, 0xff, 0x4b, 0x31, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x84, 0xb5, 0xff, 0x74, 0x14, 0xff, 0x3a, 0x8f, 0xff, 0xb6, 0x1a, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xe7, 0x3d, 0xff, 0x42, 0xd0, 0xff, 0x53, 0x31, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x3a, 0x6e, 0xff, 0x62, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x62, 0x0b, 0xff, 0x3a, 0x4e, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x84, 0x95, 0xff, 0x5b, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x5b, 0x92, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x7c, 0x74, 0xff, 0x5b, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x53, 0x71, 0xff, 0x74, 0x34, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x8c, 0xb5, 0xff, 0x84, 0x95, 0xff, 0x6b, 0xd3, 0xff, 0x53, 0x31, 0xff, 0x3a, 0xaf, 0xff, 0xdf, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0x3a, 0xaf, 0xff, 0x95, 0x16, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xa2, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x95, 0x16, 0xff, 0x3a, 0xaf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xb5, 0xd9, 0xff, 0x5b, 0x72, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xa2, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x5b, 0x72, 0xff, 0xad, 0xb9, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x84, 0x95, 0xff, 0x8c, 0xd6, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0x7a, 0x2b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x2b, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x94, 0xf6, 0xff, 0x7c, 0x75, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0x92, 0x2b, 0xff, 0x29, 0xec, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x6a, 0x0b, 0xff, 0x29, 0xec, 0xff, 0x92, 0x2b, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xa5, 0x77, 0xff, 0x5b, 0x92, 0xff, 0x42, 0xcf, 0xff, 0x3a, 0x8f, 0xff, 0x5b, 0x92, 0xff, 0x9d, 0x37, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0x82, 0x2b, 0xff, 0x49, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x51, 0xec, 0xff, 0x82, 0x2b, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xbd, 0xf9, 0xff, 0x6c, 0x13, 0xff, 0x42, 0xd0, 0xff, 0x3a, 0x8f, 0xff, 0x53, 0x31, 0xff, 0x84, 0xb5, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x4b, 0x31, 0xff, 0x53, 0x31, 0xff, 0xa5, 0x77, 0xff, 0xce, 0x7a, 0xff, 0xd6, 0xbb, 0xff, 0xb5, 0xb8, 0xff, 0x63, 0xb2, 0xff, 0x42, 0xd0, 0xff, 0xce, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0x82, 0x2b, 0xff, 0x49, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x4a, 0x2d, 0xff, 0x2a, 0x0d, 0xff, 0x4a, 0x2d, 0xff, 0xaa, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xba, 0x4a, 0xff, 0x5a, 0x2c, 0xff, 0x2a, 0x0d, 0xff, 0x42, 0x2d, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x51, 0xec, 0xff, 0x82, 0x2b, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x74, 0x13, 0xff, 0x3a, 0x8f, 0xff, 0x95, 0x16, 0xff, 0xc6, 0x5a, 0xff, 0xd6, 0xbb, 0xff, 0xbe, 0x19, 0xff, 0x7c, 0x54, 0xff, 0x32, 0x8f, 0xff, 0xad, 0x98, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x3a, 0xaf, 0xff, 0x8c, 0xd6, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x77, 0xff, 0x3a, 0x8f, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0x82, 0x2b, 0xff, 0x49, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0x32, 0x0d, 0xff, 0x94, 0xf5, 0xff, 0xde, 0xb9, 0xff, 0x9d, 0x15, 0xff, 0x32, 0x0d, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x42, 0x2d, 0xff, 0x84, 0x74, 0xff, 0xde, 0xb9, 0xff, 0xad, 0x96, 0xff, 0x2a, 0x0d, 0xff, 0xb2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x51, 0xec, 0xff, 0x82, 0x2b, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x63, 0xd2, 0xff, 0x63, 0xb2, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x5a, 0xff, 0x3a, 0x8f, 0xff, 0xb5, 0xd8, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x74, 0x13, 0xff, 0x74, 0x34, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xbd, 0xf9, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xb2, 0xff, 0xad, 0x98, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xd6, 0xff, 0x63, 0xb2, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0x82, 0x2b, 0xff, 0x49, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x9a, 0x2a, 0xff, 0x52, 0xef, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x52, 0xef, 0xff, 0x9a, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x32, 0x4e, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x73, 0xf2, 0xff, 0x82, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x51, 0xec, 0xff, 0x82, 0x2b, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x77, 0xff, 0x42, 0xf0, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x74, 0x13, 0xff, 0x63, 0x91, 0xff, 0x94, 0xf6, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x3a, 0xff, 0x32, 0x8f, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe6, 0xfc, 0xff, 0x2a, 0x4e, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x37, 0xff, 0x32, 0x2d, 0xff, 0x82, 0x2b, 0xff, 0x82, 0x2b, 0xff, 0x3a, 0x2d, 0xff, 0x84, 0x74, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x32, 0x8f, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0x82, 0x2b, 0xff, 0x49, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xa2, 0x2a, 0xff, 0x42, 0xaf, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x42, 0xaf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xba, 0x4a, 0xff, 0x2a, 0x2d, 0xff, 0xe7, 0x1a, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x63, 0x91, 0xff, 0x8a, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x51, 0xec, 0xff, 0x82, 0x2b, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x51, 0xff, 0xb5, 0xd8, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x5a, 0xff, 0x32, 0x2d, 0xff, 0x7a, 0x2b, 0xff, 0x8a, 0x2b, 0xff, 0x52, 0x2d, 0xff, 0x53, 0x10, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0x63, 0xd2, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xd8, 0xff, 0x53, 0x51, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x2a, 0x2d, 0xff, 0xb2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xba, 0x4a, 0xff, 0x2a, 0x0d, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0x6c, 0x13, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0x82, 0x2b, 0xff, 0x49, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x42, 0x2d, 0xff, 0x6b, 0xd2, 0xff, 0xb5, 0xb7, 0xff, 0x63, 0xb1, 0xff, 0x4a, 0x2d, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x5a, 0x4c, 0xff, 0x5b, 0x50, 0xff, 0xad, 0xb7, 0xff, 0x7c, 0x53, 0xff, 0x32, 0x2d, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x51, 0xec, 0xff, 0x82, 0x2b, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x22, 0x0d, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x10, 0xff, 0x8a, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x42, 0x2d, 0xff, 0xad, 0x98, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x13, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x77, 0xff, 0x6b, 0xf3, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x9b, 0xff, 0x3a, 0x2d, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x4a, 0x4d, 0xff, 0xb5, 0xf9, 0xff, 0xef, 0x3d, 0xff, 0x84, 0x95, 0xff, 0x8c, 0xb5, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0x82, 0x2b, 0xff, 0x49, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0x72, 0x2c, 0xff, 0x52, 0x4d, 0xff, 0x72, 0x2c, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0x7a, 0x2b, 0xff, 0x52, 0x4d, 0xff, 0x6a, 0x2c, 0xff, 0xba, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x51, 0xec, 0xff, 0x82, 0x2b, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xdb, 0xff, 0x32, 0x8f, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x32, 0x2e, 0xff, 0xba, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x72, 0x2b, 0xff, 0x84, 0x95, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xf9, 0xff, 0x53, 0x51, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xad, 0xb8, 0xff, 0x5b, 0x72, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x2a, 0x0d, 0xff, 0xba, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0x32, 0x2d, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0x6b, 0xf3, 0xff, 0x95, 0x16, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0x82, 0x2b, 0xff, 0x49, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x49, 0xec, 0xff, 0x82, 0x0b, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x2a, 0x4e, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xf0, 0xff, 0x92, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x52, 0x4d, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x57, 0xff, 0x63, 0xb2, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x2a, 0x2e, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xb5, 0xff, 0x42, 0x2d, 0xff, 0x9a, 0x2b, 0xff, 0x9a, 0x2a, 0xff, 0x4a, 0x2d, 0xff, 0x74, 0x13, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x3a, 0x8f, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x10, 0xff, 0x92, 0x2b, 0xff, 0x31, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x31, 0xec, 0xff, 0x92, 0x2b, 0xff, 0x53, 0x10, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4b, 0x10, 0xff, 0xbd, 0xf9, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xf9, 0xff, 0x32, 0x2d, 0xff, 0x8a, 0x2b, 0xff, 0xa2, 0x2a, 0xff, 0x62, 0x2c, 0xff, 0x4a, 0xcf, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0x6b, 0xf3, 0xff, 0x94, 0xf6, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x6b, 0xd3, 0xff, 0x84, 0xb5, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x53, 0x30, 0xff, 0x53, 0x30, 0xff, 0x9d, 0x16, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x37, 0xff, 0x4b, 0x31, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x16, 0xff, 0x42, 0x2d, 0xff, 0x8a, 0x2b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x7a, 0x0b, 0xff, 0x8a, 0x2b, 0xff, 0x42, 0x2d, 0xff, 0x9d, 0x16, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x37, 0xff, 0x53, 0x51, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0x63, 0x71, 0xff, 0x4a, 0xf0, 0xff, 0x84, 0x74, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x2a, 0x4e, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x32, 0x6e, 0xff, 0xa5, 0x98, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xf9, 0xff, 0x2a, 0x4e, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x36, 0xff, 0x5b, 0x30, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x52, 0xf0, 0xff, 0x5b, 0x30, 0xff, 0x9d, 0x36, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x31, 0xff, 0x7c, 0x54, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x3a, 0xaf, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x3a, 0x8f, 0xff, 0x6b, 0xf3, 0xff, 0xbe, 0x19, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xc6, 0x3a, 0xff, 0x74, 0x33, 0xff, 0x32, 0x6e, 0xff, 0xbd, 0xf9, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x53, 0x51, 0xff, 0x4b, 0x31, 0xff, 0xad, 0x98, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x9b, 0xff, 0x8c, 0xd6, 0xff, 0x2a, 0x4e, 0xff, 0x94, 0xf6, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x94, 0xf6, 0xff, 0x4a, 0xf0, 0xff, 0x2a, 0x2e, 0xff, 0x21, 0xed, 0xff, 0x3a, 0xaf, 0xff, 0x84, 0x74, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xad, 0x98, 0xff, 0x53, 0x51, 0xff, 0x2a, 0x4e, 0xff, 0x19, 0xed, 0xff, 0x32, 0x6e, 0xff, 0x6b, 0xf3, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0x8c, 0xd5, 0xff, 0x4a, 0xcf, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x4a, 0xcf, 0xff, 0x8c, 0xd5, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x94, 0xf6, 0xff, 0x4a, 0x2d, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0x4a, 0x2d, 0xff, 0x94, 0xf6, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x10, 0xff, 0x9a, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xa2, 0x2a, 0xff, 0x52, 0xf0, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x95, 0x16, 0xff, 0x74, 0x34, 0xff, 0x63, 0xb2, 0xff, 0x63, 0xb2, 0xff, 0x74, 0x34, 0xff, 0x95, 0x16, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0x9b, 0xff, 0x9d, 0x37, 0xff, 0x7c, 0x54, 0xff, 0x63, 0xb2, 0xff, 0x63, 0xb2, 0xff, 0x74, 0x33, 0xff, 0x95, 0x16, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x42, 0xf0, 0xff, 0x32, 0x8f, 0xff, 0x6b, 0xf3, 0xff, 0x94, 0xf6, 0xff, 0xa5, 0x77, 0xff, 0xa5, 0x57, 0xff, 0x8c, 0xd6, 0xff, 0x6b, 0xf3, 0xff, 0x32, 0x6e, 0xff, 0x42, 0xf0, 0xff, 0xa5, 0x77, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xad, 0x98, 0xff, 0x4b, 0x10, 0xff, 0x32, 0x6e, 0xff, 0x6b, 0xd3, 0xff, 0x94, 0xf6, 0xff, 0xa5, 0x77, 0xff, 0xa5, 0x77, 0xff, 0x94, 0xf6, 0xff, 0x74, 0x33, 0xff, 0x32, 0x8f, 0xff, 0x3a, 0xaf, 0xff, 0x9d, 0x37, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x4b, 0x10, 0xff, 0x4b, 0x10, 0xff, 0xb5, 0xd8, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xd9, 0xff, 0x4b, 0x10, 0xff, 0x4a, 0xf0, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0x9b, 0xff, 0x53, 0x51, 0xff, 0x42, 0xd0, 0xff, 0xad, 0xb8, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0x53, 0x51, 0xff, 0x42, 0xcf, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xf9, 0xff, 0x32, 0x6e, 0xff, 0x95, 0x16, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0xb5, 0xd9, 0xff, 0xb5, 0xd9, 0xff, 0xce, 0x7a, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x37, 0xff, 0x2a, 0x4e, 0xff, 0xb5, 0xd8, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x39, 0xff, 0x32, 0x6e, 0xff, 0x8c, 0xd5, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xf9, 0xff, 0xb5, 0xd8, 0xff, 0xce, 0x7a, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x77, 0xff, 0x2a, 0x4e, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0x2a, 0x4e, 0xff, 0xbe, 0x19, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x7c, 0x54, 0xff, 0x32, 0x6e, 0xff, 0x3a, 0x8f, 0xff, 0x53, 0x51, 0xff, 0x53, 0x31, 0xff, 0x3a, 0x8f, 0xff, 0x32, 0x6e, 0xff, 0x74, 0x34, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0x32, 0x6e, 0xff, 0xb5, 0xf9, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x5a, 0xff, 0x32, 0x4e, 0xff, 0xad, 0xb8, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdc, 0xff, 0x84, 0x74, 0xff, 0x32, 0x6e, 0xff, 0x32, 0x8f, 0xff, 0x53, 0x51, 0xff, 0x53, 0x51, 0xff, 0x3a, 0xaf, 0xff, 0x2a, 0x4e, 0xff, 0x74, 0x13, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x5a, 0xff, 0x32, 0x6f, 0xff, 0xad, 0x98, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdb, 0xff, 0x32, 0x6e, 0xff, 0xb5, 0xd8, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x32, 0x6e, 0xff, 0x7c, 0x54, 0xff, 0xd6, 0x9b, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x9b, 0xff, 0x7c, 0x54, 0xff, 0x2a, 0x4e, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xd8, 0xff, 0x32, 0x6e, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe6, 0xfc, 0xff, 0x3a, 0x8f, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xad, 0x98, 0xff, 0x32, 0x6e, 0xff, 0x74, 0x13, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x84, 0x95, 0xff, 0x2a, 0x4e, 0xff, 0x94, 0xf6, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0x32, 0x4e, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x6b, 0xd3, 0xff, 0x7c, 0x54, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x94, 0xf6, 0xff, 0x3a, 0xaf, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdb, 0xff, 0xbd, 0xf9, 0xff, 0xbd, 0xf9, 0xff, 0xd6, 0xdb, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x3a, 0xaf, 0xff, 0x8c, 0xd5, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x84, 0x95, 0xff, 0x63, 0xd2, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x7c, 0x54, 0xff, 0x6b, 0xf3, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x57, 0xff, 0x32, 0x8f, 0xff, 0xbe, 0x39, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xbd, 0xf9, 0xff, 0xb5, 0xf9, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x42, 0xf0, 0xff, 0x7c, 0x54, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x94, 0xf6, 0xff, 0x53, 0x51, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x2a, 0x4e, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xd8, 0xff, 0x3a, 0x8f, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x5b, 0x71, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xed, 0xff, 0x5b, 0x71, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x32, 0x8f, 0xff, 0xad, 0xb8, 0xff, 0xef, 0x3d, 0xff, 0xe6, 0xfc, 0xff, 0x32, 0x6e, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x2a, 0x2e, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0xbe, 0x39, 0xff, 0x32, 0x6e, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0x9b, 0xff, 0x63, 0xb2, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xed, 0xff, 0x53, 0x31, 0xff, 0xbe, 0x19, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x42, 0xcf, 0xff, 0x9d, 0x57, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x3a, 0xaf, 0xff, 0xb5, 0xd8, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x74, 0x34, 0xff, 0x84, 0x95, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x3a, 0x8f, 0xff, 0xb5, 0xf9, 0xff, 0xef, 0x3d, 0xff, 0xbd, 0xf9, 0xff, 0x2a, 0x2e, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x22, 0x0d, 0xff, 0xb5, 0xd9, 0xff, 0xef, 0x3d, 0xff, 0xbd, 0xf9, 0xff, 0x3a, 0x8f, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xd5, 0xff, 0x74, 0x13, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xba, 0x4a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x84, 0x95, 0xff, 0x74, 0x13, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x42, 0xf0, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x3a, 0xff, 0x2a, 0x4e, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0x21, 0xed, 0xff, 0x19, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x5a, 0xff, 0x32, 0x6e, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x37, 0xff, 0x63, 0xb2, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x3a, 0x8f, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x77, 0xff, 0x53, 0x51, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdc, 0xff, 0x2a, 0x4e, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xcd, 0xff, 0x49, 0xec, 0xff, 0x82, 0x2b, 0xff, 0x82, 0x2b, 0xff, 0x41, 0xec, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x2a, 0x2e, 0xff, 0xd6, 0xdb, 0xff, 0xef, 0x3d, 0xff, 0x5b, 0x71, 0xff, 0xa5, 0x57, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x32, 0x6e, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x2c, 0xff, 0x32, 0x4e, 0xff, 0x42, 0xaf, 0xff, 0x42, 0xaf, 0xff, 0x42, 0xaf, 0xff, 0x32, 0x4e, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4b, 0x10, 0xff, 0xb5, 0xf9, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xd9, 0xff, 0x42, 0xd0, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x32, 0x8f, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xec, 0xff, 0x41, 0xec, 0xff, 0x82, 0x2b, 0xff, 0x82, 0x2b, 0xff, 0x4a, 0x0c, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x22, 0x0d, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0x6b, 0xf3, 0xff, 0x94, 0xf6, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdb, 0xff, 0x2a, 0x2e, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x2a, 0x4e, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x63, 0xd2, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0x84, 0x95, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0x72, 0x0b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x72, 0x0b, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x7c, 0x54, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x57, 0xff, 0x63, 0xb2, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x32, 0x8f, 0xff, 0xd6, 0x9b, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x4c, 0xff, 0xa5, 0x56, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x95, 0x15, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x21, 0xed, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0x74, 0x34, 0xff, 0x8c, 0xd5, 0xff, 0xef, 0x3d, 0xff, 0x94, 0xf6, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xcd, 0xff, 0x62, 0x0c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x82, 0x0b, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x6b, 0xf3, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xd8, 0xff, 0x53, 0x51, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x42, 0xf0, 0xff, 0xc6, 0x39, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0x4b, 0x10, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x42, 0xcf, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0x42, 0xf0, 0xff, 0x19, 0xcd, 0xff, 0x29, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x29, 0xec, 0xff, 0x19, 0xcd, 0xff, 0x42, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x3a, 0x8f, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x31, 0xff, 0xb5, 0xf9, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x4c, 0xff, 0x74, 0x13, 0xff, 0xa5, 0x76, 0xff, 0xa5, 0x76, 0xff, 0xa5, 0x76, 0xff, 0x6b, 0xf2, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x3a, 0xaf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x31, 0xff, 0xbd, 0xf9, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x51, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xcd, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x39, 0xec, 0xff, 0x19, 0xcd, 0xff, 0x2a, 0x4e, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x2a, 0x2e, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x63, 0x92, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xad, 0xb8, 0xff, 0x53, 0x51, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x2a, 0x4e, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x3d, 0xff, 0x2a, 0x4e, 0xff, 0x19, 0xcd, 0xff, 0x49, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x51, 0xec, 0xff, 0x19, 0xcd, 0xff, 0x22, 0x0d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x2a, 0x2e, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x63, 0xb2, 0xff, 0xad, 0x98, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x92, 0x2b, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x92, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0x42, 0xf0, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x3a, 0xaf, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0x3a, 0xaf, 0xff, 0x19, 0xcd, 0xff, 0x39, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x0b, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0x2a, 0x2e, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0x74, 0x33, 0xff, 0x95, 0x16, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xd9, 0xff, 0x53, 0x51, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x32, 0x8f, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0x3a, 0x8f, 0xff, 0x19, 0xcd, 0xff, 0x39, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x41, 0xec, 0xff, 0x19, 0xcd, 0xff, 0x32, 0x6e, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdc, 0xff, 0x32, 0x8f, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x5b, 0x72, 0xff, 0xb5, 0xd8, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x5a, 0xff, 0x42, 0xd0, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x42, 0xf0, 0xff, 0xc6, 0x3a, 0xff, 0xef, 0x3d, 0xff, 0x4b, 0x10, 0xff, 0x19, 0xcd, 0xff, 0x31, 0xec, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x51, 0xec, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x2a, 0x2e, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x6b, 0xf3, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x3a, 0x8f, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x51, 0xff, 0xb5, 0xd8, 0xff, 0xef, 0x3d, 0xff, 0x63, 0xd2, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0xaa, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x4a, 0xff, 0x21, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x63, 0xb2, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xf9, 0xff, 0x53, 0x31, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x42, 0xf0, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x92, 0x2b, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x92, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0x5a, 0x2c, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x5a, 0x4d, 0xff, 0x62, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdc, 0xff, 0x2a, 0x2e, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x63, 0xb2, 0xff, 0xa5, 0x57, 0xff, 0xef, 0x3d, 0xff, 0x74, 0x34, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0x9a, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x53, 0x31, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x42, 0xd0, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x51, 0xff, 0xbd, 0xf9, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x22, 0x0d, 0xff, 0xde, 0xdb, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xd5, 0xff, 0x74, 0x34, 0xff, 0xef, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0x19, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x29, 0xec, 0xff, 0x9a, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x9a, 0x2a, 0xff, 0x29, 0xec, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0xb5, 0xd8, 0xff, 0xef, 0x3d, 0xff, 0x7c, 0x54, 0xff, 0x8c, 0xd5, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x2a, 0x2e, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x4c, 0xff, 0x74, 0x13, 0xff, 0xa5, 0x76, 0xff, 0xa5, 0x76, 0xff, 0xa5, 0x76, 0xff, 0x6b, 0xf2, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x32, 0x2e, 0xff, 0xa5, 0x76, 0xff, 0xa5, 0x76, 0xff, 0xa5, 0x76, 0xff, 0xa5, 0x76, 0xff, 0x22, 0x0d, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x32, 0x6e, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x37, 0xff, 0x63, 0xb2, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0x8a, 0x2b, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xa2, 0x2a, 0xff, 0x29, 0xec, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xd5, 0xff, 0x7c, 0x54, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x2a, 0x4e, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x5b, 0x92, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x32, 0x6e, 0xff, 0xde, 0xdb, 0xff, 0xef, 0x3d, 0xff, 0x7c, 0x54, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0x21, 0xcd, 0xff, 0x21, 0xcd, 0xff, 0x21, 0xec, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x74, 0x33, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdc, 0xff, 0x32, 0x6e, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x98, 0xff, 0x63, 0x92, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x4c, 0xff, 0xa5, 0x56, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x95, 0x15, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x3a, 0x6e, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x2a, 0x0d, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x6c, 0x13, 0xff, 0x8c, 0xd5, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x32, 0x4e, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xb5, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xcd, 0xff, 0x21, 0xed, 0xff, 0x21, 0xcd, 0xff, 0x21, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x63, 0xb2, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x3a, 0x8f, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xbd, 0xf9, 0xff, 0x4b, 0x31, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x98, 0xff, 0x4b, 0x10, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x7c, 0x74, 0xff, 0x63, 0xb2, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x84, 0x95, 0xff, 0x21, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x21, 0xed, 0xff, 0x84, 0x74, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x63, 0xd2, 0xff, 0x7c, 0x74, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x53, 0x51, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x2c, 0xff, 0x32, 0x4e, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x32, 0x4e, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x21, 0xed, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x42, 0x8f, 0xff, 0x21, 0xed, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xf9, 0xff, 0x3a, 0x8f, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xd6, 0xff, 0x53, 0x51, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xd6, 0xff, 0x22, 0x0d, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xed, 0xff, 0x74, 0x13, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0x7c, 0x54, 0xff, 0x6c, 0x13, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x63, 0xd2, 0xff, 0x94, 0xf6, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0x42, 0xd0, 0xff, 0xad, 0x98, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x4b, 0x31, 0xff, 0x74, 0x34, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0x9b, 0xff, 0x8c, 0xd5, 0xff, 0x6b, 0xd3, 0xff, 0x6b, 0xd3, 0xff, 0x8c, 0xb5, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x7c, 0x54, 0xff, 0x4b, 0x31, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xd9, 0xff, 0x42, 0xd0, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xba, 0x4a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x4a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xb2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4b, 0x31, 0xff, 0x95, 0x16, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0x5b, 0x71, 0xff, 0x6b, 0xd3, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x8c, 0xd6, 0xff, 0x6b, 0xd3, 0xff, 0x63, 0xd2, 0xff, 0x84, 0x95, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xd6, 0xff, 0x42, 0xf0, 0xff, 0xe6, 0xfc, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x5a, 0xff, 0x3a, 0x8f, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xd9, 0xff, 0x32, 0x6e, 0xff, 0xd6, 0xdb, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x53, 0x51, 0xff, 0x53, 0x51, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x5b, 0x71, 0xff, 0x53, 0x71, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x3a, 0x8f, 0xff, 0xb5, 0xd8, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xba, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xba, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x3a, 0xff, 0x32, 0x4e, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x63, 0x92, 0xff, 0x4b, 0x10, 0xff, 0xc6, 0x3a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x63, 0xb2, 0xff, 0x4b, 0x10, 0xff, 0xd6, 0xdb, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x42, 0xd0, 0xff, 0xa5, 0x77, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x7c, 0x74, 0xff, 0x4b, 0x10, 0xff, 0xe6, 0xfc, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x94, 0xf6, 0xff, 0x32, 0x6e, 0xff, 0x53, 0x51, 0xff, 0x8c, 0xd5, 0xff, 0xa5, 0x77, 0xff, 0xa5, 0x77, 0xff, 0x8c, 0xd5, 0xff, 0x53, 0x51, 0xff, 0x32, 0x6e, 0xff, 0x94, 0xf6, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x53, 0x51, 0xff, 0x84, 0x95, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x2c, 0xff, 0x2a, 0x2d, 0xff, 0x32, 0x4e, 0xff, 0x32, 0x4e, 0xff, 0x32, 0x4e, 0xff, 0x2a, 0x0d, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xba, 0x4a, 0xff, 0x21, 0xed, 0xff, 0x32, 0x4e, 0xff, 0x32, 0x4e, 0xff, 0x32, 0x4e, 0xff, 0x32, 0x4e, 0xff, 0x21, 0xed, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x2c, 0xff, 0x2a, 0x2d, 0xff, 0x32, 0x4e, 0xff, 0x32, 0x4e, 0xff, 0x32, 0x4e, 0xff, 0x2a, 0x2d, 0xff, 0x72, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xd6, 0xff, 0x3a, 0xaf, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x37, 0xff, 0x32, 0x6f, 0xff, 0x4b, 0x31, 0xff, 0x84, 0xb5, 0xff, 0xa5, 0x57, 0xff, 0xa5, 0x77, 0xff, 0x8c, 0xd6, 0xff, 0x5b, 0x92, 0xff, 0x32, 0x6e, 0xff, 0x8c, 0xd5, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x63, 0xb2, 0xff, 0x74, 0x13, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x6b, 0xf3, 0xff, 0x42, 0xf0, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xad, 0xb8, 0xff, 0x7c, 0x74, 0xff, 0x6b, 0xd3, 0xff, 0x6b, 0xd3, 0xff, 0x84, 0x74, 0xff, 0xb5, 0xd8, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x4b, 0x31, 0xff, 0x6b, 0xf3, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x4c, 0xff, 0xa5, 0x56, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x95, 0x15, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x3a, 0x6e, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x2a, 0x0d, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x5a, 0x4d, 0xff, 0xa5, 0x76, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x94, 0xd5, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x7c, 0x74, 0xff, 0x3a, 0xaf, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xb5, 0xd8, 0xff, 0x84, 0x74, 0xff, 0x6b, 0xd3, 0xff, 0x6b, 0xd3, 0xff, 0x7c, 0x74, 0xff, 0xad, 0xb8, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0x5b, 0x72, 0xff, 0x5b, 0x92, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x8c, 0xb5, 0xff, 0x2a, 0x4e, 0xff, 0x95, 0x16, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x9d, 0x37, 0xff, 0x32, 0x6e, 0xff, 0x8c, 0xd5, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x4c, 0xff, 0x7c, 0x53, 0xff, 0xb5, 0xb7, 0xff, 0xb5, 0xb7, 0xff, 0xb5, 0xb7, 0xff, 0x74, 0x33, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x32, 0x4e, 0xff, 0xb5, 0xb7, 0xff, 0xb5, 0xb7, 0xff, 0xb5, 0xb7, 0xff, 0xb5, 0xb7, 0xff, 0x2a, 0x0d, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x5a, 0x4d, 0xff, 0x84, 0x74, 0xff, 0xb5, 0xb7, 0xff, 0xb5, 0xb7, 0xff, 0xb5, 0xb7, 0xff, 0x74, 0x13, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x95, 0x16, 0xff, 0x2a, 0x2e, 0xff, 0x8c, 0xd5, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xa5, 0x77, 0xff, 0x32, 0x6f, 0xff, 0x7c, 0x74, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x3a, 0xff, 0x53, 0x51, 0xff, 0x32, 0x6e, 0xff, 0x7c, 0x74, 0xff, 0xb5, 0xf9, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xbd, 0xf9, 0xff, 0x84, 0x74, 0xff, 0x3a, 0x8f, 0xff, 0x53, 0x71, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x8a, 0x2b, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x92, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0x52, 0x2d, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x52, 0x2d, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x82, 0x2b, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x4a, 0x4d, 0xff, 0x92, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x5b, 0x72, 0xff, 0x2a, 0x4e, 0xff, 0x7c, 0x54, 0xff, 0xb5, 0xd8, 0xff, 0xde, 0xdb, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xbe, 0x19, 0xff, 0x84, 0x95, 0xff, 0x3a, 0xaf, 0xff, 0x4b, 0x31, 0xff, 0xbe, 0x19, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xc6, 0x5a, 0xff, 0x7c, 0x54, 0xff, 0x4b, 0x10, 0xff, 0x22, 0x0d, 0xff, 0x22, 0x0d, 0xff, 0x19, 0xcd, 0xff, 0x2a, 0x4e, 0xff, 0x4b, 0x10, 0xff, 0x84, 0x95, 0xff, 0xc6, 0x3a, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x7c, 0x74, 0xff, 0x4b, 0x10, 0xff, 0x2a, 0x2e, 0xff, 0x22, 0x0d, 0xff, 0x19, 0xed, 0xff, 0x2a, 0x2e, 0xff, 0x42, 0xf0, 0xff, 0x7c, 0x74, 0xff, 0xbe, 0x19, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x9a, 0x2b, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x9a, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xc2, 0x4a, 0xff, 0x6a, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x92, 0x2b, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0x62, 0x2c, 0xff, 0xa2, 0x2b, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x4c, 0xff, 0x6b, 0xf2, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x63, 0xb2, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x32, 0x2d, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x22, 0x0d, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x5a, 0x4d, 0xff, 0x6c, 0x12, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x15, 0xff, 0x63, 0xb1, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x4c, 0xff, 0xa5, 0x56, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x95, 0x15, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x3a, 0x6e, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x2a, 0x0d, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x5a, 0x4d, 0xff, 0xa5, 0x76, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0xef, 0x3b, 0xff, 0x94, 0xd5, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0x57, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x7c, 0x75, 0xff, 0x9d, 0x37, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0x62, 0x2c, 0xff, 0x3a, 0x8e, 0xff, 0x53, 0x0f, 0xff, 0x53, 0x0f, 0xff, 0x53, 0x0f, 0xff, 0x3a, 0x8e, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x21, 0xed, 0xff, 0x53, 0x0f, 0xff, 0x53, 0x0f, 0xff, 0x53, 0x0f, 0xff, 0x53, 0x0f, 0xff, 0x21, 0xed, 0xff, 0xc2, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0x5a, 0x4c, 0xff, 0x42, 0xaf, 0xff, 0x53, 0x0f, 0xff, 0x53, 0x0f, 0xff, 0x53, 0x0f, 0xff, 0x3a, 0x8e, 0xff, 0x6a, 0x2c, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x9d, 0x37, 0xff, 0x74, 0x34, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0x95, 0x17, 0xff, 0x7c, 0x54, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xba, 0x4a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0xba, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xa2, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xb2, 0x4a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0x9a, 0x2a, 0xff, 0xba, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x7c, 0x54, 0xff, 0x94, 0xf6, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xe7, 0x1d, 0xff, 0x32, 0x6e, 0xff, 0xde, 0xdb, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdb, 0xff, 0x32, 0x6e, 0xff, 0xdf, 0x1d, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x95, 0x17, 0xff, 0x42, 0xcf, 0xff, 0xb5, 0xd8, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x4a, 0xcf, 0xff, 0xa2, 0x2a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x4a, 0xff, 0xaa, 0x2a, 0xff, 0x4a, 0xcf, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xb5, 0xd8, 0xff, 0x42, 0xcf, 0xff, 0x94, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x1a, 0xff, 0x4b, 0x31, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x29, 0xed, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x19, 0xcd, 0xff, 0x29, 0xed, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x2a, 0x2e, 0xff, 0x4b, 0x10, 0xff, 0xb5, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x91, 0x73, 0x5d, 0xd1, 0x68, 0x3d, 0x1e, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x68, 0x3d, 0x1e, 0xff, 0x92, 0x75, 0x5f, 0xd1, 
-  0x69, 0x3e, 0x1f, 0xfd, 0xd2, 0xdf, 0xe1, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd2, 0xdf, 0xe1, 0xff, 0x69, 0x3e, 0x1f, 0xfd, 
-  0x69, 0x3d, 0x1e, 0xfd, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0x69, 0x3d, 0x1e, 0xfd, 
-  0x6a, 0x40, 0x20, 0xfc, 0xca, 0xd1, 0xd0, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xcf, 0xd9, 0xda, 0xff, 0xca, 0xd1, 0xd0, 0xff, 0x6a, 0x40, 0x21, 0xfc, 
-  0x9d, 0x82, 0x6d, 0xc4, 0x7a, 0x55, 0x39, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x73, 0x4d, 0x31, 0xff, 0x71, 0x4a, 0x2e, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x76, 0x50, 0x34, 0xff, 0x6f, 0x47, 0x2b, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x78, 0x53, 0x38, 0xff, 0x7a, 0x55, 0x39, 0xff, 0xa0, 0x85, 0x71, 0xc4, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb1, 0xa4, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd5, 0xce, 0xff, 0x8c, 0x6b, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb1, 0xa4, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xdb, 0xd5, 0xff, 0x68, 0x3d, 0x1e, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x6c, 0x42, 0x24, 0xff, 0xf7, 0xf5, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd5, 0xce, 0xff, 0x8c, 0x6b, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb1, 0xa4, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xce, 0xc6, 0xff, 0x87, 0x6a, 0x54, 0xff, 0xbd, 0xbf, 0xba, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xc4, 0xc8, 0xc6, 0xff, 0x75, 0x4f, 0x33, 0xff, 0xf2, 0xee, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf6, 0xf4, 0xff, 0xd6, 0xca, 0xc2, 0xff, 0xd6, 0xca, 0xc2, 0xff, 0xd6, 0xca, 0xc2, 0xff, 0xd6, 0xca, 0xc2, 0xff, 0xd6, 0xca, 0xc2, 0xff, 0xd6, 0xca, 0xc2, 0xff, 0xf1, 0xed, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd5, 0xce, 0xff, 0x8c, 0x6b, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb1, 0xa4, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xce, 0xc6, 0xff, 0x87, 0x6a, 0x54, 0xff, 0x7a, 0x5b, 0x4b, 0xff, 0x63, 0x44, 0x51, 0xff, 0x62, 0x47, 0x61, 0xff, 0x62, 0x47, 0x61, 0xff, 0x62, 0x47, 0x61, 0xff, 0x62, 0x47, 0x61, 0xff, 0x64, 0x42, 0x46, 0xff, 0x8e, 0x78, 0x6a, 0xff, 0x75, 0x4f, 0x33, 0xff, 0xf2, 0xee, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xb5, 0xa9, 0xff, 0x77, 0x52, 0x37, 0xff, 0x8e, 0x75, 0x60, 0xff, 0x8e, 0x75, 0x60, 0xff, 0x8e, 0x75, 0x60, 0xff, 0x8e, 0x75, 0x60, 0xff, 0x7e, 0x5d, 0x43, 0xff, 0xab, 0x93, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd5, 0xce, 0xff, 0x8c, 0x6b, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb1, 0xa4, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xce, 0xc6, 0xff, 0x87, 0x6a, 0x54, 0xff, 0x79, 0x5a, 0x4b, 0xff, 0x56, 0x44, 0x8e, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x59, 0x42, 0x7a, 0xff, 0x8d, 0x77, 0x6a, 0xff, 0x75, 0x4f, 0x33, 0xff, 0xf2, 0xee, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xb3, 0xa6, 0xff, 0x97, 0x82, 0x70, 0xff, 0xb9, 0xb9, 0xb3, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xae, 0xa8, 0x9e, 0xff, 0xa7, 0x9d, 0x92, 0xff, 0xa9, 0x91, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd5, 0xce, 0xff, 0x8c, 0x6b, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb1, 0xa4, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xce, 0xc6, 0xff, 0x87, 0x6a, 0x54, 0xff, 0x94, 0x81, 0x76, 0xff, 0x73, 0x51, 0x41, 0xff, 0x73, 0x51, 0x41, 0xff, 0x73, 0x51, 0x41, 0xff, 0x73, 0x51, 0x41, 0xff, 0x73, 0x51, 0x41, 0xff, 0x73, 0x51, 0x41, 0xff, 0xa3, 0x9a, 0x90, 0xff, 0x75, 0x4f, 0x33, 0xff, 0xf2, 0xee, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xb3, 0xa6, 0xff, 0x97, 0x82, 0x70, 0xff, 0xab, 0xa2, 0x98, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x9b, 0x8a, 0x7b, 0xff, 0xa7, 0x9d, 0x92, 0xff, 0xa9, 0x91, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd5, 0xce, 0xff, 0x8c, 0x6b, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xfb, 0xff, 0xcf, 0xc1, 0xb7, 0xff, 0x93, 0x75, 0x5e, 0xff, 0x84, 0x60, 0x47, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0x93, 0x75, 0x61, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x83, 0x62, 0x4d, 0xff, 0x94, 0x75, 0x61, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0x9b, 0x7e, 0x69, 0xff, 0x73, 0x4d, 0x31, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x6b, 0x42, 0x23, 0xff, 0xa6, 0x8d, 0x7b, 0xff, 0xac, 0x95, 0x84, 0xff, 0x91, 0x72, 0x5b, 0xff, 0x7a, 0x59, 0x3f, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x99, 0x88, 0x78, 0xff, 0x84, 0x67, 0x51, 0xff, 0x86, 0x65, 0x4c, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0xac, 0x95, 0x84, 0xff, 0x9d, 0x82, 0x6e, 0xff, 0x79, 0x52, 0x36, 0xff, 0xcd, 0xbf, 0xb4, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe3, 0xdf, 0xff, 0x7d, 0x58, 0x3e, 0xff, 0x86, 0x65, 0x4d, 0xff, 0x9d, 0x84, 0x72, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0x71, 0x4b, 0x38, 0xff, 0x5c, 0x41, 0x62, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5b, 0x40, 0x64, 0xff, 0x70, 0x4a, 0x37, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xa8, 0x91, 0x81, 0xff, 0x8c, 0x6c, 0x56, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8e, 0x6f, 0x59, 0xff, 0xaa, 0x95, 0x86, 0xff, 0xab, 0x96, 0x87, 0xff, 0xa4, 0x8c, 0x7c, 0xff, 0x8b, 0x6c, 0x55, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x8b, 0x6b, 0x54, 0xff, 0x9e, 0x85, 0x74, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xab, 0x96, 0x87, 0xff, 0xa8, 0x92, 0x82, 0xff, 0x95, 0x79, 0x65, 0xff, 0x86, 0x65, 0x4d, 0xff, 0x7b, 0x56, 0x3b, 0xff, 0xe7, 0xe0, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xfb, 0xfa, 0xfa, 0xff, 0x7b, 0x56, 0x3b, 0xff, 0xb2, 0xa0, 0x93, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb2, 0xa0, 0x93, 0xff, 0x79, 0x53, 0x37, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xc9, 0xb9, 0xae, 0xff, 0x8d, 0x6e, 0x57, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x8d, 0x6e, 0x58, 0xff, 0xc6, 0xb6, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xaa, 0x92, 0x80, 0xff, 0xae, 0x9a, 0x8c, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x59, 0x43, 0x78, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x5a, 0x42, 0x76, 0xff, 0x59, 0x43, 0x78, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xaf, 0x9c, 0x8e, 0xff, 0xa6, 0x8c, 0x7a, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x55, 0x44, 0x92, 0xff, 0x64, 0x3b, 0x29, 0xff, 0x5b, 0x40, 0x69, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5a, 0x41, 0x6b, 0xff, 0x5b, 0x40, 0x69, 0xff, 0x64, 0x3c, 0x2a, 0xff, 0x55, 0x44, 0x92, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0xbb, 0xac, 0xa2, 0xff, 0x8e, 0x70, 0x5a, 0xff, 0x7c, 0x57, 0x3d, 0xff, 0x78, 0x52, 0x36, 0xff, 0x8f, 0x71, 0x5b, 0xff, 0xb5, 0xa4, 0x98, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x58, 0x43, 0x7f, 0xff, 0x5f, 0x3e, 0x4c, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4e, 0xff, 0x57, 0x43, 0x7e, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc9, 0xbe, 0xb7, 0xff, 0x99, 0x7f, 0x6c, 0xff, 0x7d, 0x59, 0x3f, 0xff, 0x77, 0x51, 0x36, 0xff, 0x87, 0x66, 0x4e, 0xff, 0xa8, 0x93, 0x84, 0xff, 0xde, 0xdb, 0xd9, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd9, 0xd4, 0xd1, 0xff, 0x85, 0x64, 0x4c, 0xff, 0x86, 0x65, 0x4d, 0xff, 0xbc, 0xae, 0xa3, 0xff, 0xd4, 0xcd, 0xc9, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xc2, 0xb6, 0xad, 0xff, 0x90, 0x73, 0x5d, 0xff, 0x7e, 0x5a, 0x40, 0xff, 0xd1, 0xca, 0xc5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x58, 0x43, 0x7f, 0xff, 0x5f, 0x3e, 0x4c, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x47, 0xad, 0xff, 0x66, 0x46, 0x4a, 0xff, 0x68, 0x40, 0x27, 0xff, 0x66, 0x46, 0x4b, 0xff, 0x51, 0x46, 0xab, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x48, 0xb8, 0xff, 0x64, 0x46, 0x55, 0xff, 0x68, 0x40, 0x28, 0xff, 0x68, 0x45, 0x41, 0xff, 0x53, 0x46, 0x9d, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4f, 0xff, 0x57, 0x43, 0x7e, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe3, 0xe2, 0xe1, 0xff, 0x9c, 0x82, 0x6f, 0xff, 0x78, 0x52, 0x36, 0xff, 0xb2, 0xa0, 0x93, 0xff, 0xcf, 0xc7, 0xc1, 0xff, 0xda, 0xd6, 0xd3, 0xff, 0xcb, 0xc1, 0xbb, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x76, 0x4f, 0x33, 0xff, 0xbe, 0xb0, 0xa6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe0, 0xde, 0xdc, 0xff, 0x7a, 0x55, 0x3a, 0xff, 0xad, 0x9a, 0x8c, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xbc, 0xad, 0xa3, 0xff, 0x77, 0x51, 0x36, 0xff, 0xd8, 0xd3, 0xd0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x58, 0x43, 0x7f, 0xff, 0x5f, 0x3e, 0x4c, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4f, 0x48, 0xc1, 0xff, 0x69, 0x42, 0x30, 0xff, 0xa7, 0x9e, 0x93, 0xff, 0xcc, 0xd6, 0xd6, 0xff, 0xa9, 0xa0, 0x96, 0xff, 0x68, 0x41, 0x30, 0xff, 0x4f, 0x48, 0xc1, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x67, 0x44, 0x44, 0xff, 0x9d, 0x8d, 0x82, 0xff, 0xcc, 0xd6, 0xd6, 0xff, 0xb4, 0xb1, 0xaa, 0xff, 0x69, 0x42, 0x2a, 0xff, 0x51, 0x48, 0xb3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4f, 0xff, 0x57, 0x43, 0x7e, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x94, 0x78, 0x64, 0xff, 0x91, 0x74, 0x5e, 0xff, 0xe3, 0xe2, 0xe1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd0, 0xc9, 0xc3, 0xff, 0x78, 0x52, 0x36, 0xff, 0xc4, 0xb8, 0xaf, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x9b, 0x81, 0x6e, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc7, 0xbd, 0xb5, 0xff, 0x93, 0x78, 0x69, 0xff, 0x91, 0x75, 0x65, 0xff, 0xbf, 0xb2, 0xa8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xae, 0x9a, 0x8c, 0xff, 0x91, 0x74, 0x5e, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x58, 0x43, 0x7f, 0xff, 0x5f, 0x3e, 0x4c, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x54, 0x45, 0x99, 0xff, 0x7b, 0x5d, 0x4f, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0x7b, 0x5e, 0x4f, 0xff, 0x55, 0x45, 0x9a, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x51, 0x47, 0xb3, 0xff, 0x6e, 0x47, 0x33, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0x90, 0x7c, 0x6f, 0xff, 0x58, 0x43, 0x80, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4f, 0xff, 0x57, 0x43, 0x7e, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xbb, 0xac, 0xa2, 0xff, 0x7f, 0x5c, 0x42, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd4, 0xce, 0xca, 0xff, 0x9b, 0x81, 0x73, 0xff, 0x8b, 0x6f, 0x60, 0xff, 0xb0, 0x9e, 0x93, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcd, 0xc4, 0xbe, 0xff, 0x76, 0x4f, 0x33, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe0, 0xde, 0xdd, 0xff, 0x71, 0x49, 0x2c, 0xff, 0xde, 0xdb, 0xda, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb5, 0xa5, 0x9a, 0xff, 0x6a, 0x44, 0x33, 0xff, 0x58, 0x43, 0x80, 0xff, 0x57, 0x43, 0x82, 0xff, 0x6a, 0x44, 0x39, 0xff, 0xa1, 0x8b, 0x7d, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0x76, 0x50, 0x34, 0xff, 0xd5, 0xcf, 0xca, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x58, 0x43, 0x7f, 0xff, 0x5f, 0x3e, 0x4c, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x53, 0x45, 0xa0, 0xff, 0x75, 0x55, 0x43, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0x76, 0x54, 0x44, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x48, 0xb9, 0xff, 0x6b, 0x43, 0x2c, 0xff, 0xd3, 0xe0, 0xe3, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0x88, 0x70, 0x64, 0xff, 0x56, 0x43, 0x8a, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4f, 0xff, 0x57, 0x43, 0x7e, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x88, 0x67, 0x4f, 0xff, 0xc4, 0xb8, 0xaf, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcf, 0xc7, 0xc2, 0xff, 0x6c, 0x44, 0x2d, 0xff, 0x5b, 0x44, 0x75, 0xff, 0x57, 0x44, 0x88, 0xff, 0x65, 0x45, 0x4e, 0xff, 0x80, 0x5f, 0x4e, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x93, 0x77, 0x62, 0xff, 0xb6, 0xa6, 0x9a, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc3, 0xb7, 0xae, 0xff, 0x88, 0x68, 0x50, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0x6b, 0x43, 0x2b, 0xff, 0x51, 0x47, 0xb0, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x48, 0xba, 0xff, 0x6a, 0x42, 0x2a, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x99, 0x7f, 0x6c, 0xff, 0xbb, 0xac, 0xa1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x58, 0x43, 0x7f, 0xff, 0x5f, 0x3e, 0x4c, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x48, 0xc5, 0xff, 0x67, 0x44, 0x43, 0xff, 0x8f, 0x79, 0x6b, 0xff, 0xb7, 0xb4, 0xad, 0xff, 0x8a, 0x74, 0x64, 0xff, 0x67, 0x45, 0x47, 0xff, 0x4e, 0x48, 0xc5, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x63, 0x47, 0x5c, 0xff, 0x83, 0x68, 0x57, 0xff, 0xb6, 0xb4, 0xac, 0xff, 0x98, 0x87, 0x79, 0xff, 0x6a, 0x44, 0x34, 0xff, 0x4f, 0x48, 0xbf, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4f, 0xff, 0x57, 0x43, 0x7e, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0x6c, 0x42, 0x24, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x82, 0x62, 0x52, 0xff, 0x57, 0x44, 0x8a, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc6, 0xff, 0x67, 0x44, 0x44, 0xff, 0xbe, 0xb0, 0xa6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xba, 0xaa, 0x9f, 0xff, 0x9a, 0x80, 0x6d, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xbb, 0xac, 0xa1, 0xff, 0x96, 0x7b, 0x67, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd6, 0xd0, 0xcc, 0xff, 0x6a, 0x45, 0x36, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x6a, 0x49, 0x4c, 0xff, 0xc6, 0xbb, 0xb3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa6, 0x90, 0x80, 0xff, 0xaa, 0x95, 0x86, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x58, 0x43, 0x7f, 0xff, 0x5f, 0x3e, 0x4c, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x48, 0xbd, 0xff, 0x5e, 0x45, 0x70, 0xff, 0x66, 0x48, 0x52, 0xff, 0x5d, 0x45, 0x74, 0xff, 0x4f, 0x48, 0xc0, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc4, 0xff, 0x5b, 0x45, 0x7b, 0xff, 0x66, 0x48, 0x52, 0xff, 0x5f, 0x46, 0x6a, 0xff, 0x50, 0x48, 0xb9, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4f, 0xff, 0x57, 0x43, 0x7e, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdb, 0xd7, 0xd4, 0xff, 0x76, 0x50, 0x34, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x6e, 0x45, 0x2d, 0xff, 0x50, 0x48, 0xb9, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5b, 0x43, 0x73, 0xff, 0xa7, 0x91, 0x83, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc6, 0xbb, 0xb3, 0xff, 0x8a, 0x6a, 0x53, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc1, 0xb5, 0xab, 0xff, 0x8d, 0x6e, 0x58, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe3, 0xe2, 0xe1, 0xff, 0x6a, 0x42, 0x28, 0xff, 0x51, 0x47, 0xb6, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4f, 0x49, 0xc3, 0xff, 0x6a, 0x43, 0x2f, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x97, 0x7c, 0x69, 0xff, 0xb3, 0xa1, 0x94, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x58, 0x43, 0x80, 0xff, 0x5f, 0x3e, 0x4a, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4c, 0xff, 0x57, 0x42, 0x7f, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdf, 0xdd, 0xdb, 0xff, 0x6f, 0x47, 0x29, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7e, 0x5c, 0x4c, 0xff, 0x55, 0x44, 0x94, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x66, 0x47, 0x52, 0xff, 0xbc, 0xae, 0xa3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa8, 0x9c, 0xff, 0x92, 0x76, 0x61, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdf, 0xdc, 0xda, 0xff, 0x6e, 0x45, 0x27, 0xff, 0xe1, 0xdf, 0xde, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa9, 0x95, 0x88, 0xff, 0x68, 0x45, 0x3d, 0xff, 0x55, 0x44, 0x96, 0xff, 0x54, 0x45, 0x9b, 0xff, 0x67, 0x46, 0x4a, 0xff, 0x99, 0x81, 0x73, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0x78, 0x52, 0x36, 0xff, 0xd1, 0xca, 0xc4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x81, 0x61, 0x53, 0xff, 0x55, 0x44, 0x90, 0xff, 0x63, 0x3b, 0x2e, 0xff, 0x60, 0x3e, 0x46, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x48, 0xff, 0x60, 0x3e, 0x46, 0xff, 0x64, 0x3c, 0x2d, 0xff, 0x56, 0x44, 0x91, 0xff, 0x80, 0x60, 0x51, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x81, 0x5f, 0x45, 0xff, 0xc7, 0xbd, 0xb5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc6, 0xbb, 0xb3, 0xff, 0x6a, 0x43, 0x2e, 0xff, 0x57, 0x43, 0x87, 0xff, 0x54, 0x46, 0xa1, 0xff, 0x60, 0x44, 0x64, 0xff, 0x7a, 0x57, 0x45, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x96, 0x7b, 0x67, 0xff, 0xb0, 0x9d, 0x90, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x95, 0x7a, 0x65, 0xff, 0xa8, 0x93, 0x84, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb9, 0xa9, 0x9f, 0xff, 0x82, 0x63, 0x53, 0xff, 0x83, 0x63, 0x54, 0xff, 0xb3, 0xa2, 0x97, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb6, 0xa6, 0x9a, 0xff, 0x85, 0x64, 0x4c, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb3, 0xa1, 0x96, 0xff, 0x69, 0x44, 0x3e, 0xff, 0x56, 0x44, 0x8b, 0xff, 0x59, 0x42, 0x79, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x77, 0xff, 0x59, 0x42, 0x79, 0xff, 0x56, 0x43, 0x8c, 0xff, 0x69, 0x44, 0x3e, 0xff, 0xb2, 0xa0, 0x95, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb5, 0xa5, 0x99, 0xff, 0x88, 0x68, 0x51, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc9, 0xc0, 0xb9, 0xff, 0x8a, 0x6d, 0x5e, 0xff, 0x7d, 0x5c, 0x4c, 0xff, 0xa2, 0x8c, 0x7f, 0xff, 0xe1, 0xdf, 0xde, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd4, 0xce, 0xca, 0xff, 0x71, 0x49, 0x2c, 0xff, 0xdd, 0xd9, 0xd7, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xda, 0xd6, 0xd3, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xbd, 0xaf, 0xa4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc7, 0xbc, 0xb4, 0xff, 0x71, 0x49, 0x2c, 0xff, 0xd0, 0xc9, 0xc3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xb4, 0xa4, 0x99, 0xff, 0x84, 0x65, 0x57, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x7e, 0x5d, 0x4e, 0xff, 0x83, 0x65, 0x57, 0xff, 0xb4, 0xa3, 0x98, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x86, 0x65, 0x4d, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0x78, 0x53, 0x37, 0xff, 0xb6, 0xa6, 0x9a, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0x77, 0x50, 0x35, 0xff, 0x96, 0x7b, 0x67, 0xff, 0xc9, 0xc0, 0xb9, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xce, 0xc5, 0xbf, 0xff, 0x9c, 0x83, 0x71, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xc7, 0xbd, 0xb5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe0, 0xde, 0xdc, 0xff, 0x8a, 0x6a, 0x53, 0xff, 0x85, 0x64, 0x4c, 0xff, 0xbf, 0xb2, 0xa8, 0xff, 0xe2, 0xe0, 0xdf, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd5, 0xcf, 0xca, 0xff, 0xad, 0x9a, 0x8c, 0xff, 0x71, 0x48, 0x2b, 0xff, 0xb0, 0x9d, 0x8f, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe1, 0xdf, 0xde, 0xff, 0xae, 0x9b, 0x8d, 0xff, 0x81, 0x5e, 0x45, 0xff, 0x6d, 0x43, 0x25, 0xff, 0x69, 0x3e, 0x1e, 0xff, 0x7b, 0x56, 0x3b, 0xff, 0xa4, 0x8e, 0x7d, 0xff, 0xdd, 0xda, 0xd8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xbe, 0xb0, 0xa6, 0xff, 0x88, 0x68, 0x51, 0xff, 0x71, 0x49, 0x2c, 0xff, 0x67, 0x3c, 0x1c, 0xff, 0x74, 0x4d, 0x30, 0xff, 0x97, 0x7c, 0x69, 0xff, 0xd2, 0xcb, 0xc6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xab, 0x97, 0x8b, 0xff, 0x7c, 0x5a, 0x4b, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x76, 0x51, 0x41, 0xff, 0x7c, 0x5a, 0x4b, 0xff, 0xab, 0x97, 0x8b, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xae, 0x9b, 0x90, 0xff, 0x68, 0x45, 0x45, 0xff, 0x54, 0x46, 0x9e, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x54, 0x45, 0x9f, 0xff, 0x67, 0x45, 0x46, 0xff, 0xad, 0x9b, 0x8f, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x80, 0x60, 0x51, 0xff, 0x54, 0x46, 0x9c, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x54, 0x45, 0x9f, 0xff, 0x7e, 0x5e, 0x4f, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xb3, 0xa1, 0x94, 0xff, 0x9f, 0x86, 0x74, 0xff, 0x91, 0x74, 0x5f, 0xff, 0x92, 0x75, 0x60, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xb3, 0xa1, 0x94, 0xff, 0xd4, 0xcd, 0xc9, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd7, 0xd2, 0xce, 0xff, 0xb5, 0xa4, 0x98, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x92, 0x75, 0x60, 0xff, 0x92, 0x74, 0x5f, 0xff, 0x9c, 0x83, 0x71, 0xff, 0xb1, 0x9f, 0x92, 0xff, 0xd0, 0xc8, 0xc2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xb9, 0xa9, 0x9e, 0xff, 0x80, 0x5c, 0x43, 0xff, 0x76, 0x50, 0x34, 0xff, 0x97, 0x7c, 0x69, 0xff, 0xb0, 0x9d, 0x90, 0xff, 0xba, 0xac, 0xa1, 0xff, 0xba, 0xaa, 0x9f, 0xff, 0xad, 0x9a, 0x8c, 0xff, 0x99, 0x7e, 0x6b, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0x7e, 0x5b, 0x41, 0xff, 0xba, 0xab, 0xa0, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xbe, 0xb0, 0xa6, 0xff, 0x84, 0x62, 0x4a, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0x95, 0x7a, 0x65, 0xff, 0xb0, 0x9d, 0x8f, 0xff, 0xba, 0xab, 0xa0, 0xff, 0xbb, 0xac, 0xa1, 0xff, 0xae, 0x9b, 0x8d, 0xff, 0x9c, 0x83, 0x70, 0xff, 0x76, 0x50, 0x34, 0xff, 0x7b, 0x56, 0x3c, 0xff, 0xb5, 0xa4, 0x98, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0x83, 0x62, 0x49, 0xff, 0x83, 0x62, 0x49, 0xff, 0xc4, 0xb8, 0xb0, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xc5, 0xba, 0xb2, 0xff, 0x82, 0x60, 0x47, 0xff, 0x81, 0x5e, 0x45, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd7, 0xd2, 0xce, 0xff, 0x89, 0x69, 0x52, 0xff, 0x7e, 0x5a, 0x40, 0xff, 0xc0, 0xb3, 0xa9, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc9, 0xc0, 0xb9, 0xff, 0x87, 0x67, 0x4f, 0xff, 0x7c, 0x57, 0x3d, 0xff, 0xcf, 0xc7, 0xc1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc6, 0xbb, 0xb3, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xb3, 0xa1, 0x94, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xc5, 0xba, 0xb2, 0xff, 0xc5, 0xb9, 0xb1, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xb5, 0xa4, 0x98, 0xff, 0x6f, 0x47, 0x29, 0xff, 0xc4, 0xb8, 0xb0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcc, 0xc4, 0xbd, 0xff, 0x74, 0x4d, 0x30, 0xff, 0xab, 0x97, 0x88, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd5, 0xd0, 0xcb, 0xff, 0xc6, 0xbb, 0xb3, 0xff, 0xc4, 0xb8, 0xb0, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xbc, 0xae, 0xa3, 0xff, 0x6f, 0x47, 0x29, 0xff, 0xbc, 0xae, 0xa3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcb, 0xc1, 0xbb, 0xff, 0x71, 0x49, 0x2c, 0xff, 0xc9, 0xbf, 0xb8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x72, 0x4b, 0x2e, 0xff, 0x78, 0x52, 0x36, 0xff, 0x88, 0x68, 0x50, 0xff, 0x86, 0x65, 0x4d, 0xff, 0x78, 0x52, 0x36, 0xff, 0x72, 0x4b, 0x2e, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xca, 0xc0, 0xb9, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xc6, 0xbb, 0xb3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd1, 0xca, 0xc5, 0xff, 0x72, 0x4a, 0x2d, 0xff, 0xc2, 0xb5, 0xac, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdd, 0xd9, 0xd7, 0xff, 0xa4, 0x8e, 0x7d, 0xff, 0x74, 0x4d, 0x31, 0xff, 0x76, 0x4f, 0x33, 0xff, 0x88, 0x67, 0x4f, 0xff, 0x87, 0x67, 0x4f, 0xff, 0x79, 0x54, 0x39, 0xff, 0x70, 0x47, 0x2a, 0xff, 0x9b, 0x81, 0x6e, 0xff, 0xd6, 0xd0, 0xcc, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcf, 0xc7, 0xc2, 0xff, 0x75, 0x4e, 0x32, 0xff, 0xbf, 0xb1, 0xa7, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdc, 0xd9, 0xd6, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xc4, 0xb8, 0xaf, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb9, 0xa9, 0x9e, 0xff, 0x72, 0x4b, 0x2e, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0xd6, 0xd1, 0xcd, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd5, 0xd0, 0xcb, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0x71, 0x48, 0x2b, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc4, 0xb8, 0xaf, 0xff, 0x73, 0x4c, 0x2f, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe0, 0xde, 0xdd, 0xff, 0x78, 0x52, 0x36, 0xff, 0xbb, 0xac, 0xa1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xbf, 0xb2, 0xa9, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0x9c, 0x82, 0x70, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd8, 0xd3, 0xd0, 0xff, 0xa7, 0x91, 0x82, 0xff, 0x71, 0x48, 0x2b, 0xff, 0xaf, 0x9c, 0x8e, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcb, 0xc2, 0xbb, 0xff, 0x72, 0x4a, 0x2d, 0xff, 0xd4, 0xcd, 0xc9, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x96, 0x7a, 0x66, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb0, 0x9d, 0x8f, 0xff, 0x7a, 0x55, 0x3a, 0xff, 0xd2, 0xcb, 0xc6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdb, 0xd8, 0xd5, 0xff, 0xc7, 0xbd, 0xb5, 0xff, 0xc7, 0xbd, 0xb5, 0xff, 0xdb, 0xd7, 0xd4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0x79, 0x53, 0x38, 0xff, 0xab, 0x97, 0x89, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa6, 0x90, 0x80, 0xff, 0x93, 0x77, 0x62, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x97, 0x7c, 0x68, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa8, 0x9c, 0xff, 0x76, 0x50, 0x34, 0xff, 0xcc, 0xc3, 0xbc, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xde, 0xdc, 0xda, 0xff, 0xc9, 0xbe, 0xb7, 0xff, 0xc7, 0xbc, 0xb4, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd8, 0xd3, 0xd0, 0xff, 0x7f, 0x5c, 0x42, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb0, 0x9d, 0x90, 0xff, 0x89, 0x69, 0x52, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0x71, 0x49, 0x2c, 0xff, 0xe0, 0xde, 0xdc, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc4, 0xb8, 0xb0, 0xff, 0x77, 0x50, 0x35, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd2, 0xcb, 0xc6, 0xff, 0x8c, 0x6d, 0x56, 0xff, 0x68, 0x3c, 0x1d, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x67, 0x3c, 0x1c, 0xff, 0x8b, 0x6b, 0x55, 0xff, 0xd0, 0xc9, 0xc3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xda, 0xd6, 0xd3, 0xff, 0x76, 0x4f, 0x33, 0xff, 0xc1, 0xb4, 0xab, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe0, 0xde, 0xdd, 0xff, 0x73, 0x4c, 0x2f, 0xff, 0xcf, 0xc7, 0xc2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xda, 0xd6, 0xd3, 0xff, 0x6e, 0x45, 0x27, 0xff, 0xda, 0xd6, 0xd3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcc, 0xc3, 0xbc, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xd4, 0xcd, 0xc9, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd6, 0xd1, 0xcd, 0xff, 0x92, 0x74, 0x5f, 0xff, 0x69, 0x3e, 0x1e, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x67, 0x3b, 0x1b, 0xff, 0x86, 0x65, 0x4d, 0xff, 0xcb, 0xc2, 0xbb, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdf, 0xdd, 0xdb, 0xff, 0x7c, 0x57, 0x3d, 0xff, 0xb8, 0xa8, 0x9c, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0x79, 0x54, 0x39, 0xff, 0xc4, 0xb9, 0xb1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xa5, 0x8f, 0x7e, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0x78, 0x52, 0x36, 0xff, 0xc6, 0xbb, 0xb3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc7, 0xbd, 0xb5, 0xff, 0x6d, 0x44, 0x26, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3b, 0x24, 0xff, 0x65, 0x3b, 0x22, 0xff, 0x66, 0x3a, 0x1b, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x6c, 0x42, 0x24, 0xff, 0xc5, 0xb9, 0xb1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc7, 0xbd, 0xb5, 0xff, 0x77, 0x50, 0x35, 0xff, 0xe3, 0xe2, 0xe1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xab, 0x97, 0x88, 0xff, 0x9c, 0x82, 0x70, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4f, 0x48, 0xbb, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x4f, 0x48, 0xbd, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa8, 0x92, 0x83, 0xff, 0x9a, 0x80, 0x6d, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x80, 0x5d, 0x44, 0xff, 0xba, 0xac, 0xa1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xce, 0xc6, 0xc0, 0xff, 0x70, 0x47, 0x2a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3b, 0x22, 0xff, 0x65, 0x3b, 0x24, 0xff, 0x66, 0x3b, 0x1b, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x69, 0x3e, 0x1f, 0xff, 0xbc, 0xae, 0xa3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd1, 0xca, 0xc4, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xde, 0xdb, 0xda, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb5, 0xa4, 0x98, 0xff, 0x91, 0x74, 0x5f, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x78, 0x52, 0x36, 0xff, 0xd0, 0xc9, 0xc3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xbc, 0xad, 0xa3, 0xff, 0x88, 0x68, 0x51, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdd, 0xd9, 0xd7, 0xff, 0x70, 0x47, 0x2a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3a, 0x22, 0xff, 0x60, 0x3d, 0x45, 0xff, 0x58, 0x44, 0x84, 0xff, 0x58, 0x43, 0x81, 0xff, 0x60, 0x3e, 0x44, 0xff, 0x65, 0x3b, 0x21, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x6e, 0x45, 0x27, 0xff, 0xdb, 0xd7, 0xd4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x8b, 0x6b, 0x55, 0xff, 0xba, 0xaa, 0x9f, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd4, 0xcd, 0xc9, 0xff, 0x73, 0x4c, 0x2f, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x61, 0x46, 0x61, 0xff, 0x70, 0x4a, 0x34, 0xff, 0x75, 0x53, 0x41, 0xff, 0x75, 0x53, 0x41, 0xff, 0x75, 0x53, 0x41, 0xff, 0x6f, 0x49, 0x31, 0xff, 0x5f, 0x45, 0x69, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x82, 0x5f, 0x46, 0xff, 0xc6, 0xbb, 0xb3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc5, 0xba, 0xb2, 0xff, 0x7d, 0x59, 0x3f, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe2, 0xe0, 0xdf, 0xff, 0x76, 0x50, 0x34, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x64, 0x3b, 0x22, 0xff, 0x61, 0x3d, 0x3e, 0xff, 0x58, 0x43, 0x81, 0xff, 0x58, 0x44, 0x84, 0xff, 0x5f, 0x3f, 0x4c, 0xff, 0x66, 0x3b, 0x20, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x6b, 0x41, 0x22, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x97, 0x7b, 0x67, 0xff, 0xb0, 0x9e, 0x90, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdc, 0xd9, 0xd6, 0xff, 0x6d, 0x44, 0x26, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0x6f, 0x47, 0x29, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x94, 0x78, 0x64, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa6, 0x8f, 0x7f, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3b, 0x21, 0xff, 0x5a, 0x41, 0x6e, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5a, 0x42, 0x70, 0xff, 0x65, 0x3b, 0x21, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb7, 0xa7, 0x9b, 0xff, 0x91, 0x74, 0x5e, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x76, 0x50, 0x34, 0xff, 0xd7, 0xd2, 0xce, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x63, 0x47, 0x5f, 0xff, 0xae, 0xa7, 0x9d, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xa9, 0x9f, 0x94, 0xff, 0x61, 0x46, 0x67, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0x69, 0x3e, 0x1f, 0xff, 0xe3, 0xe2, 0xe1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xab, 0x97, 0x89, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb0, 0x9e, 0x90, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3a, 0x1f, 0xff, 0x5d, 0x40, 0x5e, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x58, 0x42, 0x7e, 0xff, 0x65, 0x3b, 0x21, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x97, 0x7c, 0x68, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc3, 0xb7, 0xae, 0xff, 0x88, 0x67, 0x4f, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x80, 0x5d, 0x44, 0xff, 0xcc, 0xc4, 0xbd, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc9, 0xbf, 0xb8, 0xff, 0x83, 0x62, 0x49, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7c, 0x58, 0x3e, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7f, 0x5c, 0x42, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x64, 0x3b, 0x28, 0xff, 0x4e, 0x49, 0xc5, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc5, 0xff, 0x63, 0x3b, 0x2a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x7c, 0x57, 0x3d, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd4, 0xce, 0xca, 0xff, 0x78, 0x52, 0x36, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x86, 0x65, 0x4d, 0xff, 0xc6, 0xbb, 0xb3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x63, 0x47, 0x5f, 0xff, 0x96, 0x82, 0x71, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x61, 0x46, 0x67, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0x79, 0x53, 0x38, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x86, 0x65, 0x4d, 0xff, 0xc7, 0xbd, 0xb5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x8a, 0x6a, 0x53, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3a, 0x22, 0xff, 0x4f, 0x48, 0xc1, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x62, 0x3c, 0x35, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x71, 0x49, 0x2c, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdf, 0xdd, 0xdb, 0xff, 0x6e, 0x44, 0x26, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x90, 0x72, 0x5d, 0xff, 0xbc, 0xad, 0xa3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc1, 0xb5, 0xab, 0xff, 0x8a, 0x6a, 0x53, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x71, 0x49, 0x2c, 0xff, 0xde, 0xdb, 0xd9, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x71, 0x48, 0x2b, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x60, 0x3e, 0x4a, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4d, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x6c, 0x42, 0x24, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe1, 0xdf, 0xde, 0xff, 0x6e, 0x44, 0x26, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x91, 0x74, 0x5f, 0xff, 0xbd, 0xaf, 0xa5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x58, 0x46, 0x8f, 0xff, 0x65, 0x48, 0x55, 0xff, 0x65, 0x48, 0x55, 0xff, 0x65, 0x48, 0x55, 0xff, 0x65, 0x48, 0x55, 0xff, 0x65, 0x48, 0x55, 0xff, 0x56, 0x46, 0x94, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcb, 0xc2, 0xbb, 0xff, 0x7f, 0x5c, 0x42, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x56, 0x3b, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x56, 0x3b, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x62, 0x3d, 0x3b, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5c, 0x3f, 0x5f, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x6d, 0x43, 0x25, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x9c, 0x83, 0x70, 0xff, 0xb3, 0xa1, 0x94, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc5, 0xb9, 0xb1, 0xff, 0x87, 0x67, 0x4f, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x76, 0x4f, 0x33, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x77, 0x51, 0x36, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x61, 0x3d, 0x3a, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x60, 0x3d, 0x3e, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdd, 0xd9, 0xd7, 0xff, 0x76, 0x50, 0x34, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x8d, 0x6e, 0x58, 0xff, 0xc4, 0xb9, 0xb1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcf, 0xc7, 0xc1, 0xff, 0x7d, 0x59, 0x3e, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7f, 0x5c, 0x42, 0xff, 0xce, 0xc6, 0xc0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x81, 0x5f, 0x45, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x63, 0x3c, 0x2e, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5f, 0x3e, 0x4e, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x69, 0x3e, 0x1f, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x6e, 0x45, 0x27, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x97, 0x7c, 0x68, 0xff, 0xba, 0xac, 0xa1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0x78, 0x52, 0x36, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x89, 0x69, 0x52, 0xff, 0xc4, 0xb8, 0xb0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x94, 0x77, 0x63, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3b, 0x21, 0xff, 0x53, 0x46, 0xa5, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x47, 0xaa, 0xff, 0x65, 0x3a, 0x20, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x91, 0x74, 0x5e, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc7, 0xbc, 0xb4, 0xff, 0x87, 0x66, 0x4e, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x80, 0x5c, 0x43, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x57, 0x46, 0x8e, 0xff, 0x66, 0x48, 0x55, 0xff, 0x66, 0x48, 0x55, 0xff, 0x66, 0x48, 0x55, 0xff, 0x66, 0x48, 0x55, 0xff, 0x66, 0x48, 0x55, 0xff, 0x57, 0x46, 0x94, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4f, 0x48, 0xbf, 0xff, 0x63, 0x45, 0x5b, 0xff, 0x66, 0x48, 0x55, 0xff, 0x66, 0x48, 0x55, 0xff, 0x66, 0x48, 0x55, 0xff, 0x66, 0x48, 0x55, 0xff, 0x62, 0x45, 0x5e, 0xff, 0x4e, 0x49, 0xc5, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdd, 0xd9, 0xd7, 0xff, 0x6e, 0x45, 0x26, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x92, 0x76, 0x61, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3b, 0x22, 0xff, 0x55, 0x45, 0x99, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x47, 0xb4, 0xff, 0x65, 0x3b, 0x21, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x86, 0x65, 0x4d, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0x7d, 0x59, 0x3e, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x8a, 0x6a, 0x53, 0xff, 0xc8, 0xbe, 0xb6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0x6c, 0x42, 0x24, 0xff, 0xdc, 0xd9, 0xd6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xab, 0x97, 0x89, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcb, 0xc1, 0xbb, 0xff, 0x67, 0x3b, 0x1b, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x64, 0x3b, 0x25, 0xff, 0x55, 0x45, 0x95, 0xff, 0x4e, 0x48, 0xc5, 0xff, 0x4e, 0x48, 0xc5, 0xff, 0x54, 0x45, 0x97, 0xff, 0x64, 0x3b, 0x27, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0xc4, 0xb9, 0xb1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xab, 0x97, 0x88, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe2, 0xe0, 0xdf, 0xff, 0x6e, 0x45, 0x27, 0xff, 0xe3, 0xe2, 0xe1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x63, 0x47, 0x5f, 0xff, 0x95, 0x82, 0x72, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x61, 0x46, 0x67, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x51, 0x48, 0xb0, 0xff, 0x6d, 0x46, 0x2e, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0xb1, 0xab, 0xa3, 0xff, 0x69, 0x3f, 0x24, 0xff, 0x4f, 0x48, 0xbe, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x73, 0x4c, 0x2f, 0xff, 0xd2, 0xcb, 0xc6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb5, 0xa5, 0x99, 0xff, 0x92, 0x75, 0x60, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0x68, 0x3d, 0x1e, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3b, 0x23, 0xff, 0x56, 0x44, 0x8c, 0xff, 0x4f, 0x49, 0xc4, 0xff, 0x4e, 0x49, 0xc6, 0xff, 0x53, 0x46, 0x9d, 0xff, 0x63, 0x3b, 0x2b, 0xff, 0x66, 0x3a, 0x1b, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0xbc, 0xae, 0xa3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xab, 0x97, 0x89, 0xff, 0xa1, 0x89, 0x78, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x70, 0x47, 0x2a, 0xff, 0xdd, 0xd9, 0xd7, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x8f, 0x71, 0x5c, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0x72, 0x4b, 0x2e, 0xff, 0xdc, 0xd9, 0xd6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3b, 0x22, 0xff, 0x66, 0x3a, 0x1f, 0xff, 0x66, 0x3a, 0x1e, 0xff, 0x64, 0x3b, 0x22, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x9c, 0x83, 0x70, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdd, 0xda, 0xd8, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xd8, 0xd3, 0xd0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xbd, 0xaf, 0xa4, 0xff, 0x90, 0x72, 0x5d, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x63, 0x47, 0x5f, 0xff, 0xae, 0xa7, 0x9d, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xa9, 0x9f, 0x94, 0xff, 0x61, 0x46, 0x67, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x51, 0x48, 0xb0, 0xff, 0x70, 0x4c, 0x38, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0x6a, 0x42, 0x29, 0xff, 0x4f, 0x48, 0xbe, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x99, 0x7f, 0x6c, 0xff, 0xac, 0x98, 0x8a, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdf, 0xdc, 0xda, 0xff, 0x72, 0x4a, 0x2d, 0xff, 0xd5, 0xcf, 0xca, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa9, 0x95, 0x85, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x65, 0x3a, 0x22, 0xff, 0x65, 0x3b, 0x1f, 0xff, 0x66, 0x3a, 0x1e, 0xff, 0x65, 0x3a, 0x23, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x91, 0x74, 0x5f, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0x77, 0x51, 0x36, 0xff, 0xd1, 0xca, 0xc4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc7, 0xbd, 0xb5, 0xff, 0x85, 0x64, 0x4c, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xbd, 0xaf, 0xa4, 0xff, 0x81, 0x5f, 0x45, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa4, 0x8d, 0x7c, 0xff, 0x92, 0x74, 0x5f, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xa6, 0x90, 0x80, 0xff, 0x69, 0x3e, 0x1e, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x69, 0x3e, 0x1e, 0xff, 0xa4, 0x8e, 0x7d, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x94, 0x78, 0x64, 0xff, 0xa3, 0x8b, 0x7b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x88, 0x68, 0x51, 0xff, 0xbb, 0xac, 0xa1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x61, 0x46, 0x61, 0xff, 0x6f, 0x4a, 0x33, 0xff, 0x75, 0x52, 0x41, 0xff, 0x75, 0x52, 0x41, 0xff, 0x75, 0x52, 0x41, 0xff, 0x6e, 0x48, 0x31, 0xff, 0x5f, 0x45, 0x69, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x47, 0xb4, 0xff, 0x67, 0x3c, 0x20, 0xff, 0x75, 0x52, 0x41, 0xff, 0x75, 0x52, 0x41, 0xff, 0x75, 0x52, 0x41, 0xff, 0x75, 0x52, 0x41, 0xff, 0x67, 0x3c, 0x1e, 0xff, 0x4f, 0x48, 0xc0, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc7, 0xbc, 0xb4, 0xff, 0x78, 0x52, 0x36, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xad, 0x9a, 0x8c, 0xff, 0x88, 0x67, 0x4f, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xae, 0x9a, 0x8c, 0xff, 0x6b, 0x41, 0x22, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x67, 0x3c, 0x1c, 0xff, 0x9c, 0x82, 0x70, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x99, 0x7f, 0x6c, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x93, 0x77, 0x62, 0xff, 0xb0, 0x9e, 0x90, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0x7d, 0x59, 0x3e, 0xff, 0xbd, 0xaf, 0xa5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0x85, 0x64, 0x4c, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd6, 0xd1, 0xcd, 0xff, 0xab, 0x97, 0x88, 0xff, 0x95, 0x79, 0x65, 0xff, 0x95, 0x79, 0x65, 0xff, 0xaa, 0x95, 0x86, 0xff, 0xd5, 0xd0, 0xcb, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0x85, 0x64, 0x4c, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc5, 0xba, 0xb2, 0xff, 0x7d, 0x59, 0x3e, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x48, 0xbc, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x50, 0x48, 0xbd, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x47, 0xa9, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x46, 0xa4, 0xff, 0x52, 0x47, 0xad, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x85, 0x64, 0x4c, 0xff, 0xb3, 0xa1, 0x94, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0x8c, 0x6d, 0x57, 0xff, 0x95, 0x7a, 0x65, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xae, 0x9a, 0x8c, 0xff, 0x96, 0x7a, 0x66, 0xff, 0x94, 0x78, 0x64, 0xff, 0xa7, 0x91, 0x82, 0xff, 0xd2, 0xcb, 0xc6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xad, 0x99, 0x8b, 0xff, 0x7e, 0x5b, 0x41, 0xff, 0xe0, 0xde, 0xdd, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcf, 0xc7, 0xc1, 0xff, 0x77, 0x51, 0x36, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xc5, 0xba, 0xb2, 0xff, 0x74, 0x4d, 0x31, 0xff, 0xdb, 0xd7, 0xd4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdf, 0xdc, 0xda, 0xff, 0x89, 0x69, 0x52, 0xff, 0x89, 0x69, 0x52, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd4, 0xcd, 0xc9, 0xff, 0x8b, 0x6b, 0x55, 0xff, 0x8a, 0x6b, 0x54, 0xff, 0xde, 0xdc, 0xda, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xde, 0xdb, 0xd9, 0xff, 0x78, 0x52, 0x36, 0xff, 0xc4, 0xb8, 0xb0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4f, 0x48, 0xc1, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x4f, 0x49, 0xc3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x48, 0xb6, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x50, 0x47, 0xb7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4f, 0x48, 0xc0, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x52, 0x47, 0xaf, 0xff, 0x4e, 0x48, 0xc3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcd, 0xc4, 0xbe, 0xff, 0x72, 0x4a, 0x2d, 0xff, 0xd5, 0xd0, 0xcb, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0x90, 0x72, 0x5d, 0xff, 0x82, 0x60, 0x47, 0xff, 0xce, 0xc6, 0xc0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd8, 0xd3, 0xd0, 0xff, 0x92, 0x75, 0x60, 0xff, 0x83, 0x62, 0x49, 0xff, 0xdb, 0xd7, 0xd4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe2, 0xe0, 0xdf, 0xff, 0x7e, 0x5a, 0x40, 0xff, 0xba, 0xab, 0xa0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa3, 0x8c, 0x7c, 0xff, 0x83, 0x60, 0x47, 0xff, 0xe0, 0xde, 0xdd, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xb0, 0x9e, 0x90, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0x88, 0x68, 0x51, 0xff, 0xab, 0x97, 0x88, 0xff, 0xba, 0xab, 0xa0, 0xff, 0xba, 0xac, 0xa1, 0xff, 0xab, 0x97, 0x88, 0xff, 0x8a, 0x6a, 0x53, 0xff, 0x73, 0x4c, 0x2f, 0xff, 0xb0, 0x9e, 0x91, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe2, 0xe0, 0xdf, 0xff, 0x88, 0x68, 0x50, 0xff, 0xa6, 0x90, 0x80, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x61, 0x45, 0x63, 0xff, 0x6b, 0x44, 0x2b, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x6b, 0x42, 0x29, 0xff, 0x5e, 0x44, 0x6b, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x48, 0xb6, 0xff, 0x67, 0x3c, 0x1d, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x67, 0x3c, 0x1e, 0xff, 0x4f, 0x48, 0xc1, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x62, 0x46, 0x5e, 0xff, 0x6c, 0x44, 0x2c, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x6e, 0x49, 0x34, 0xff, 0x6a, 0x43, 0x28, 0xff, 0x5d, 0x44, 0x6f, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xad, 0x9a, 0x8c, 0xff, 0x7b, 0x56, 0x3c, 0xff, 0xdd, 0xda, 0xd8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xb5, 0xa5, 0x99, 0xff, 0x75, 0x4e, 0x32, 0xff, 0x85, 0x64, 0x4c, 0xff, 0xa9, 0x94, 0x84, 0xff, 0xba, 0xaa, 0x9f, 0xff, 0xbb, 0xac, 0xa2, 0xff, 0xad, 0x99, 0x8b, 0xff, 0x8d, 0x6f, 0x59, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xab, 0x97, 0x89, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0x90, 0x73, 0x5d, 0xff, 0x9c, 0x82, 0x70, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x99, 0x7e, 0x6b, 0xff, 0x7f, 0x5c, 0x42, 0xff, 0xd9, 0xd4, 0xd1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xc0, 0xb3, 0xaa, 0xff, 0xa2, 0x8b, 0x7a, 0xff, 0x95, 0x79, 0x65, 0xff, 0x96, 0x7a, 0x66, 0xff, 0xa4, 0x8e, 0x7d, 0xff, 0xc4, 0xb8, 0xaf, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xda, 0xd5, 0xd2, 0xff, 0x85, 0x64, 0x4c, 0xff, 0x97, 0x7c, 0x69, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x63, 0x47, 0x5f, 0xff, 0xae, 0xa7, 0x9d, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xa9, 0x9f, 0x94, 0xff, 0x61, 0x46, 0x67, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x51, 0x48, 0xb0, 0xff, 0x70, 0x4c, 0x38, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0x6a, 0x42, 0x29, 0xff, 0x4f, 0x48, 0xbe, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x66, 0x48, 0x5a, 0xff, 0xb2, 0xac, 0xa4, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xa5, 0x9a, 0x8d, 0xff, 0x5e, 0x44, 0x6b, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa2, 0x8b, 0x7a, 0xff, 0x79, 0x54, 0x39, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe4, 0xe3, 0xff, 0xc4, 0xb8, 0xaf, 0xff, 0xa4, 0x8e, 0x7d, 0xff, 0x95, 0x7a, 0x65, 0xff, 0x95, 0x7a, 0x65, 0xff, 0xa3, 0x8b, 0x7b, 0xff, 0xc0, 0xb3, 0xaa, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xde, 0xdb, 0xd9, 0xff, 0x8d, 0x6e, 0x57, 0xff, 0x8f, 0x71, 0x5b, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xab, 0x96, 0x87, 0xff, 0x70, 0x47, 0x2a, 0xff, 0xb2, 0xa0, 0x93, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe3, 0xe2, 0xff, 0xb6, 0xa5, 0x99, 0xff, 0x72, 0x4b, 0x2e, 0xff, 0xab, 0x97, 0x89, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x63, 0x47, 0x5f, 0xff, 0x9a, 0x89, 0x7a, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0x97, 0x84, 0x74, 0xff, 0x61, 0x46, 0x67, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x51, 0x48, 0xb0, 0xff, 0x6d, 0x47, 0x30, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0x69, 0x40, 0x25, 0xff, 0x4f, 0x48, 0xbe, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x66, 0x48, 0x5a, 0xff, 0x9e, 0x8e, 0x7f, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0xb8, 0xb6, 0xb0, 0xff, 0x95, 0x81, 0x6f, 0xff, 0x5e, 0x44, 0x6b, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb2, 0xa0, 0x93, 0xff, 0x6e, 0x45, 0x27, 0xff, 0xab, 0x97, 0x89, 0xff, 0xe2, 0xe0, 0xdf, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xba, 0xac, 0xa1, 0xff, 0x75, 0x4e, 0x32, 0xff, 0xa3, 0x8c, 0x7c, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xce, 0xc6, 0xc0, 0xff, 0x88, 0x67, 0x4f, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xa3, 0x8b, 0x7b, 0xff, 0xc7, 0xbc, 0xb4, 0xff, 0xdd, 0xd9, 0xd7, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xde, 0xdb, 0xda, 0xff, 0xc9, 0xbe, 0xb7, 0xff, 0xa4, 0x8e, 0x7d, 0xff, 0x78, 0x52, 0x36, 0xff, 0x8a, 0x6b, 0x54, 0xff, 0xcf, 0xc7, 0xc2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x59, 0x46, 0x87, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x58, 0x46, 0x8d, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4f, 0x48, 0xbe, 0xff, 0x65, 0x46, 0x4e, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x65, 0x46, 0x52, 0xff, 0x4f, 0x49, 0xc4, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x5b, 0x46, 0x82, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x68, 0x49, 0x4a, 0xff, 0x57, 0x46, 0x90, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0x8d, 0x6e, 0x57, 0xff, 0x71, 0x48, 0x2b, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xc4, 0xb8, 0xb0, 0xff, 0xdb, 0xd8, 0xd5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe0, 0xde, 0xdc, 0xff, 0xca, 0xc1, 0xba, 0xff, 0xa7, 0x91, 0x82, 0xff, 0x7b, 0x56, 0x3c, 0xff, 0x85, 0x63, 0x4b, 0xff, 0xc9, 0xc0, 0xb9, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xcf, 0xc7, 0xc2, 0xff, 0xa1, 0x89, 0x78, 0xff, 0x83, 0x60, 0x47, 0xff, 0x6b, 0x41, 0x22, 0xff, 0x6b, 0x41, 0x22, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x71, 0x48, 0x2b, 0xff, 0x81, 0x5f, 0x45, 0xff, 0xa6, 0x90, 0x80, 0xff, 0xce, 0xc6, 0xc0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0xa4, 0x8d, 0x7c, 0xff, 0x84, 0x62, 0x4a, 0xff, 0x6d, 0x43, 0x25, 0xff, 0x6a, 0x40, 0x21, 0xff, 0x67, 0x3b, 0x1b, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x7e, 0x5b, 0x41, 0xff, 0xa2, 0x8b, 0x7a, 0xff, 0xca, 0xc1, 0xba, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe2, 0xe0, 0xdf, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x55, 0x46, 0x95, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x55, 0x46, 0x9a, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4f, 0x49, 0xc2, 0xff, 0x5f, 0x45, 0x66, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x5e, 0x44, 0x6a, 0xff, 0x4e, 0x48, 0xc5, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x57, 0x46, 0x93, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x61, 0x46, 0x61, 0xff, 0x55, 0x46, 0x9d, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0xe2, 0xe0, 0xdf, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x63, 0x47, 0x5f, 0xff, 0x91, 0x7c, 0x69, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0x8e, 0x76, 0x63, 0xff, 0x61, 0x46, 0x67, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x51, 0x48, 0xb0, 0xff, 0x6c, 0x45, 0x2d, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0x68, 0x3f, 0x23, 0xff, 0x4f, 0x48, 0xbe, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x66, 0x48, 0x5a, 0xff, 0x93, 0x7f, 0x6c, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0xa9, 0xa0, 0x95, 0xff, 0x8c, 0x74, 0x60, 0xff, 0x5e, 0x44, 0x6b, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa5, 0x8b, 0x78, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x63, 0x47, 0x5f, 0xff, 0xae, 0xa7, 0x9d, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xa9, 0x9f, 0x94, 0xff, 0x61, 0x46, 0x67, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x51, 0x48, 0xb0, 0xff, 0x70, 0x4c, 0x38, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0x6a, 0x42, 0x29, 0xff, 0x4f, 0x48, 0xbe, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x66, 0x48, 0x5a, 0xff, 0xb2, 0xac, 0xa4, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xa5, 0x9a, 0x8d, 0xff, 0x5e, 0x44, 0x6b, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb8, 0xa9, 0x9d, 0xff, 0xa0, 0x85, 0x71, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xa6, 0x8c, 0x7a, 0xff, 0xb6, 0xa5, 0x99, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x62, 0x46, 0x60, 0xff, 0x74, 0x51, 0x3c, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x73, 0x4f, 0x39, 0xff, 0x5f, 0x44, 0x67, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x51, 0x47, 0xb3, 0xff, 0x68, 0x3d, 0x22, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x67, 0x3c, 0x1e, 0xff, 0x4f, 0x48, 0xbf, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x64, 0x47, 0x5b, 0xff, 0x75, 0x53, 0x3d, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x7c, 0x5f, 0x4f, 0xff, 0x72, 0x4f, 0x38, 0xff, 0x5d, 0x44, 0x6c, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xb7, 0xa6, 0x9b, 0xff, 0xa1, 0x86, 0x73, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xb7, 0xa2, 0x93, 0xff, 0xa2, 0x8a, 0x79, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x50, 0x48, 0xb6, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x50, 0x47, 0xb7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x53, 0x46, 0x9d, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x53, 0x46, 0xa1, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x51, 0x48, 0xb3, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x54, 0x45, 0x99, 0xff, 0x50, 0x48, 0xb9, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0xb3, 0x9d, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xe8, 0xe2, 0xdd, 0xff, 0x74, 0x4c, 0x2f, 0xff, 0xdb, 0xd8, 0xd5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xdc, 0xd9, 0xd6, 0xff, 0x73, 0x4b, 0x2e, 0xff, 0xe6, 0xdf, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xa1, 0x92, 0xff, 0x7c, 0x57, 0x3d, 0xff, 0xc4, 0xb9, 0xb1, 0xff, 0xe3, 0xe2, 0xe1, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x7b, 0x58, 0x49, 0xff, 0x53, 0x46, 0xa3, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x4e, 0x49, 0xc7, 0xff, 0x52, 0x46, 0xa7, 0xff, 0x79, 0x57, 0x46, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe3, 0xe2, 0xe1, 0xff, 0xc4, 0xb9, 0xb1, 0xff, 0x7c, 0x57, 0x3d, 0xff, 0xb2, 0x9c, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xbf, 0xb4, 0xff, 0x86, 0x63, 0x4a, 0xff, 0x6d, 0x43, 0x25, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x67, 0x3e, 0x26, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x66, 0x3a, 0x1a, 0xff, 0x68, 0x3e, 0x25, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6f, 0x46, 0x28, 0xff, 0x6d, 0x43, 0x25, 0xff, 0x84, 0x62, 0x48, 0xff, 0xcc, 0xbd, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 
-#endif
-};
-
-const lv_img_dsc_t img_music = {
-  .header.always_zero = 0,
-  .header.w = 99,
-  .header.h = 70,
-  .data_size = 6930 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_music_map,
-};
@@ -1,139 +0,0 @@
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_MEDIA_ON
-#define LV_ATTRIBUTE_IMG_MEDIA_ON
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_MEDIA_ON uint8_t media_on_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0x00, 0x00, 0xe5, 0x77, 0xe5, 0xe7, 0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf4, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xa4, 0xe1, 0x07, 
-  0xe5, 0x68, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xfb, 0xe5, 0xff, 0xe5, 0xf3, 0xe5, 0xef, 0xe5, 0xf4, 0xe5, 0xff, 0xe5, 0xf7, 0xe5, 0xef, 0xe5, 0xf3, 0xe5, 0xff, 0xe5, 0xf8, 0xe5, 0xef, 0xe5, 0xf0, 0xe5, 0xff, 0xe5, 0xfc, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xa7, 
-  0xe5, 0xd3, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x0f, 0x00, 0x00, 0xe5, 0xbb, 0xe5, 0xff, 0xe5, 0x34, 0x00, 0x00, 0xe5, 0x73, 0xe5, 0xff, 0xe5, 0x80, 0x00, 0x00, 0xe5, 0x48, 0xe5, 0xff, 0xe5, 0xa7, 0x00, 0x00, 0xe5, 0x23, 0xe5, 0xff, 0xe5, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xe3, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x0f, 0x00, 0x00, 0xe5, 0xbb, 0xe5, 0xff, 0xe5, 0x34, 0x00, 0x00, 0xe5, 0x7c, 0xe5, 0xff, 0xe5, 0x80, 0x00, 0x00, 0xe5, 0x48, 0xe5, 0xff, 0xe5, 0xa7, 0x00, 0x00, 0xe5, 0x23, 0xe5, 0xff, 0xe5, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xeb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xdf, 0xe5, 0xdc, 0xe5, 0xf7, 0xe5, 0xff, 0xe5, 0xe3, 0xe5, 0xdc, 0xe5, 0xf3, 0xe5, 0xff, 0xe5, 0xef, 0xe5, 0xdc, 0xe5, 0xe7, 0xe5, 0xff, 0xe5, 0xf3, 0xe5, 0xdc, 0xe5, 0xe3, 0xe5, 0xff, 0xe5, 0xf8, 0xe5, 0xdc, 0xe5, 0xdc, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xf4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xfb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xeb, 0xe5, 0x93, 0xe5, 0xeb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xfc, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6f, 0x00, 0x00, 0xe5, 0x0c, 0xe5, 0x78, 0xe5, 0xeb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0f, 0xe5, 0x90, 0xe5, 0xfc, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x33, 0xe5, 0xd3, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x57, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x33, 0xe5, 0xd0, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xfc, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0f, 0xe5, 0x90, 0xe5, 0xfc, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xfc, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6f, 0x00, 0x00, 0xe5, 0x0b, 0xe5, 0x77, 0xe5, 0xeb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xfb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xe8, 0xe5, 0x90, 0xe5, 0xe8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xf4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xeb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xdf, 0xe5, 0xdc, 0xe5, 0xf7, 0xe5, 0xff, 0xe5, 0xe4, 0xe5, 0xe0, 0xe5, 0xf7, 0xe5, 0xff, 0xe5, 0xef, 0xe5, 0xdc, 0xe5, 0xe7, 0xe5, 0xff, 0xe5, 0xf3, 0xe5, 0xdc, 0xe5, 0xe3, 0xe5, 0xff, 0xe5, 0xf8, 0xe5, 0xdc, 0xe5, 0xdc, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xe3, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x0f, 0x00, 0x00, 0xe5, 0xbb, 0xe5, 0xff, 0xe5, 0x34, 0x00, 0x00, 0xe5, 0x7c, 0xe5, 0xff, 0xe5, 0x80, 0x00, 0x00, 0xe5, 0x48, 0xe5, 0xff, 0xe5, 0xa7, 0x00, 0x00, 0xe5, 0x23, 0xe5, 0xff, 0xe5, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0xd4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x0f, 0x00, 0x00, 0xe5, 0xbb, 0xe5, 0xff, 0xe5, 0x34, 0x00, 0x00, 0xe5, 0x73, 0xe5, 0xff, 0xe5, 0x80, 0x00, 0x00, 0xe5, 0x48, 0xe5, 0xff, 0xe5, 0xa7, 0x00, 0x00, 0xe5, 0x23, 0xe5, 0xff, 0xe5, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 
-  0xe5, 0x6b, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xfb, 0xe5, 0xff, 0xe5, 0xf3, 0xe5, 0xef, 0xe5, 0xf4, 0xe5, 0xff, 0xe5, 0xf7, 0xe5, 0xef, 0xe5, 0xf3, 0xe5, 0xff, 0xe5, 0xf8, 0xe5, 0xef, 0xe5, 0xf0, 0xe5, 0xff, 0xe5, 0xfc, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xa8, 
-  0xe0, 0x00, 0xe5, 0x7c, 0xe5, 0xe7, 0xe5, 0xf7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xfc, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xa7, 0xe5, 0x07, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0x00, 0x00, 0x00, 0xa7, 0xf0, 0x77, 0xa7, 0xf0, 0xe7, 0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf4, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xa4, 0x05, 0xf8, 0x07, 
-  0xa7, 0xf0, 0x68, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xfb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf3, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xf4, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf7, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xf3, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xf0, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xfc, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xa7, 
-  0xa7, 0xf0, 0xd3, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0x87, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0xbb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x34, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x73, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x80, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x48, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xa7, 0x00, 0x00, 0x00, 0xc7, 0xf0, 0x23, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xe3, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0x87, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0xbb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x34, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x7c, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x80, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x48, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xa7, 0x00, 0x00, 0x00, 0xc7, 0xf0, 0x23, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xeb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xdf, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xf7, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xe3, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xf3, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xe7, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf3, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xe3, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xf4, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xfb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xeb, 0xa7, 0xf0, 0x93, 0xa7, 0xf0, 0xeb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xfc, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x6f, 0x00, 0x00, 0x00, 0xa8, 0xe8, 0x0c, 0xa7, 0xf0, 0x78, 0xa7, 0xf0, 0xeb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xf0, 0x0f, 0xa7, 0xf0, 0x90, 0xa7, 0xf0, 0xfc, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x33, 0xa7, 0xf0, 0xd3, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x57, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x33, 0xa7, 0xf0, 0xd0, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xfc, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xf0, 0x0f, 0xa7, 0xf0, 0x90, 0xa7, 0xf0, 0xfc, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xfc, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x6f, 0x00, 0x00, 0x00, 0xc6, 0xe8, 0x0b, 0xa7, 0xf0, 0x77, 0xa7, 0xf0, 0xeb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xfb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xe8, 0xa7, 0xf0, 0x90, 0xa7, 0xf0, 0xe8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xf4, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xeb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xdf, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xf7, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xe4, 0xa7, 0xf0, 0xe0, 0xa7, 0xf0, 0xf7, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xe7, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf3, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xe3, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xdc, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xe3, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0x87, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0xbb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x34, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x7c, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x80, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x48, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xa7, 0x00, 0x00, 0x00, 0xc7, 0xf0, 0x23, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0xd4, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0x87, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0xbb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x34, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x73, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0x80, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0x48, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xa7, 0x00, 0x00, 0x00, 0xc7, 0xf0, 0x23, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 
-  0xa7, 0xf0, 0x6b, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xfb, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf3, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xf4, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf7, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xf3, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xf8, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xf0, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xfc, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xa8, 
-  0x00, 0xf8, 0x00, 0xa7, 0xf0, 0x7c, 0xa7, 0xf0, 0xe7, 0xa7, 0xf0, 0xf7, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xff, 0xa7, 0xf0, 0xfc, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xef, 0xa7, 0xf0, 0xa7, 0x29, 0xf9, 0x07, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0xf0, 0xa7, 0x77, 0xf0, 0xa7, 0xe7, 0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf4, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xa4, 0xf8, 0x05, 0x07, 
-  0xf0, 0xa7, 0x68, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xfb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf3, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xf4, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf7, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xf3, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xf0, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xfc, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xa7, 
-  0xf0, 0xa7, 0xd3, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0x87, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0xbb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x34, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x73, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x80, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x48, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xa7, 0x00, 0x00, 0x00, 0xf0, 0xc7, 0x23, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xe3, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0x87, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0xbb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x34, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x7c, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x80, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x48, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xa7, 0x00, 0x00, 0x00, 0xf0, 0xc7, 0x23, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xeb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xdf, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xf7, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xe3, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xf3, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xe7, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf3, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xe3, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xf4, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xfb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xeb, 0xf0, 0xa7, 0x93, 0xf0, 0xa7, 0xeb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xfc, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x6f, 0x00, 0x00, 0x00, 0xe8, 0xa8, 0x0c, 0xf0, 0xa7, 0x78, 0xf0, 0xa7, 0xeb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x86, 0x0f, 0xf0, 0xa7, 0x90, 0xf0, 0xa7, 0xfc, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x33, 0xf0, 0xa7, 0xd3, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x57, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x33, 0xf0, 0xa7, 0xd0, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xfc, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x87, 0x0f, 0xf0, 0xa7, 0x90, 0xf0, 0xa7, 0xfc, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xfc, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x6f, 0x00, 0x00, 0x00, 0xe8, 0xc6, 0x0b, 0xf0, 0xa7, 0x77, 0xf0, 0xa7, 0xeb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xfb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xe8, 0xf0, 0xa7, 0x90, 0xf0, 0xa7, 0xe8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xf4, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xeb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xdf, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xf7, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xe4, 0xf0, 0xa7, 0xe0, 0xf0, 0xa7, 0xf7, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xe7, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf3, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xe3, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xdc, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xe3, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0x87, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0xbb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x34, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x7c, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x80, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x48, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xa7, 0x00, 0x00, 0x00, 0xf0, 0xc7, 0x23, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0xd4, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0x87, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0xbb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x34, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x73, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0x80, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0x48, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xa7, 0x00, 0x00, 0x00, 0xf0, 0xc7, 0x23, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 
-  0xf0, 0xa7, 0x6b, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xfb, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf3, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xf4, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf7, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xf3, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xf8, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xf0, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xfc, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xa8, 
-  0xf8, 0x00, 0x00, 0xf0, 0xa7, 0x7c, 0xf0, 0xa7, 0xe7, 0xf0, 0xa7, 0xf7, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xff, 0xf0, 0xa7, 0xfc, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xef, 0xf0, 0xa7, 0xa7, 0xf9, 0x29, 0x07, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x38, 0x15, 0xf0, 0x77, 0x37, 0x15, 0xf0, 0xe7, 0x37, 0x16, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xf4, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x38, 0x16, 0xf0, 0xa4, 0x2b, 0x00, 0xff, 0x07, 
-  0x38, 0x16, 0xf0, 0x68, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xfb, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xf3, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xf4, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xf7, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xf3, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x16, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xf0, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xfc, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xa7, 
-  0x38, 0x15, 0xf0, 0xd3, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x12, 0xed, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x37, 0x15, 0xf0, 0xbb, 0x37, 0x15, 0xf0, 0xff, 0x35, 0x13, 0xf1, 0x34, 0x00, 0x00, 0x00, 0x00, 0x38, 0x14, 0xef, 0x73, 0x37, 0x15, 0xf0, 0xff, 0x38, 0x16, 0xef, 0x80, 0x00, 0x00, 0x00, 0x00, 0x38, 0x15, 0xf1, 0x48, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x16, 0xf0, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x35, 0x17, 0xf0, 0x23, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x16, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xe3, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x12, 0xed, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x37, 0x15, 0xf0, 0xbb, 0x37, 0x15, 0xf0, 0xff, 0x35, 0x13, 0xf1, 0x34, 0x00, 0x00, 0x00, 0x00, 0x38, 0x15, 0xf1, 0x7c, 0x37, 0x15, 0xf0, 0xff, 0x38, 0x16, 0xef, 0x80, 0x00, 0x00, 0x00, 0x00, 0x38, 0x15, 0xf1, 0x48, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x16, 0xf0, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x35, 0x17, 0xf0, 0x23, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x16, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xeb, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xdf, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xf7, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xe3, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xf3, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xe7, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xf3, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xe3, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xf4, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x36, 0x15, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x16, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xfb, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf0, 0xeb, 0x36, 0x15, 0xef, 0x93, 0x37, 0x15, 0xf0, 0xeb, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xfc, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x38, 0x15, 0xf1, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0xea, 0x0c, 0x37, 0x15, 0xf0, 0x78, 0x37, 0x15, 0xf0, 0xeb, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf1, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x11, 0xee, 0x0f, 0x37, 0x15, 0xef, 0x90, 0x37, 0x15, 0xf0, 0xfc, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf1, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x14, 0xf0, 0x33, 0x37, 0x15, 0xf0, 0xd3, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf1, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x15, 0xf0, 0x57, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf1, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x14, 0xf0, 0x33, 0x37, 0x15, 0xf0, 0xd0, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xfc, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf1, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x12, 0xed, 0x0f, 0x37, 0x15, 0xef, 0x90, 0x37, 0x15, 0xf0, 0xfc, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xfc, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x38, 0x15, 0xf1, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x17, 0xe8, 0x0b, 0x36, 0x16, 0xf0, 0x77, 0x37, 0x15, 0xf0, 0xeb, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xfb, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xe8, 0x37, 0x15, 0xef, 0x90, 0x37, 0x15, 0xf0, 0xe8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x16, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x36, 0x15, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xf4, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xeb, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xdf, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xf7, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xe4, 0x37, 0x14, 0xf0, 0xe0, 0x37, 0x15, 0xf0, 0xf7, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xe7, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xf3, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xe3, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xdc, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf0, 0xe3, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x12, 0xed, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x37, 0x15, 0xf0, 0xbb, 0x37, 0x15, 0xf0, 0xff, 0x35, 0x13, 0xf1, 0x34, 0x00, 0x00, 0x00, 0x00, 0x37, 0x14, 0xf1, 0x7c, 0x37, 0x15, 0xf0, 0xff, 0x38, 0x16, 0xef, 0x80, 0x00, 0x00, 0x00, 0x00, 0x38, 0x15, 0xf1, 0x48, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x16, 0xf0, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x35, 0x17, 0xf0, 0x23, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x16, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x14, 0xf1, 0xd4, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x12, 0xed, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x37, 0x15, 0xf0, 0xbb, 0x37, 0x15, 0xf0, 0xff, 0x35, 0x13, 0xf1, 0x34, 0x00, 0x00, 0x00, 0x00, 0x38, 0x14, 0xef, 0x73, 0x37, 0x15, 0xf0, 0xff, 0x38, 0x16, 0xef, 0x80, 0x00, 0x00, 0x00, 0x00, 0x38, 0x15, 0xf1, 0x48, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x16, 0xf0, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x35, 0x17, 0xf0, 0x23, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x16, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 
-  0x37, 0x15, 0xf1, 0x6b, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xfb, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xf3, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xf4, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xf7, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xf3, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x16, 0xf0, 0xf8, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xf0, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xfc, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x36, 0x15, 0xf0, 0xa8, 
-  0x00, 0x00, 0xff, 0x00, 0x38, 0x15, 0xf1, 0x7c, 0x37, 0x15, 0xef, 0xe7, 0x37, 0x15, 0xf0, 0xf7, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xff, 0x37, 0x15, 0xf0, 0xfc, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xef, 0x37, 0x15, 0xf0, 0xa7, 0x49, 0x24, 0xff, 0x07, 
-#endif
-};
-
-const lv_img_dsc_t media_on = {
-  .header.always_zero = 0,
-  .header.w = 25,
-  .header.h = 25,
-  .data_size = 625 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = media_on_map,
-};
-
@@ -1,238 +0,0 @@
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-#ifndef LV_ATTRIBUTE_IMG_MIC_LOGO
-#define LV_ATTRIBUTE_IMG_MIC_LOGO
-#endif
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_MIC_LOGO uint8_t mic_logo_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1c, 0xe9, 0x7b, 0xe9, 0xc7, 0xe9, 0xe8, 0xe9, 0xf9, 0xe9, 0xe3, 0xe9, 0xb2, 0xe9, 0x62, 0xe8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x03, 0xe9, 0x80, 0xe9, 0xf6, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe0, 0xe9, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0xb2, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfd, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x9a, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfe, 0xe9, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x48, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xeb, 0xe9, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1e, 0xe9, 0xfe, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x5b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x76, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0x02, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xe0, 0x02, 
-  0xe9, 0xd2, 0xe9, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xcd, 0xe9, 0xd0, 
-  0xe9, 0xff, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfb, 0xe9, 0xff, 
-  0xe9, 0xff, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfb, 0xe9, 0xff, 
-  0xe9, 0xff, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfb, 0xe9, 0xff, 
-  0xe9, 0xff, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfb, 0xe9, 0xff, 
-  0xe9, 0xff, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfb, 0xe9, 0xff, 
-  0xe9, 0xff, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfb, 0xe9, 0xff, 
-  0xe9, 0xfe, 0xe9, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x81, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfc, 0xe9, 0xfe, 
-  0xe9, 0xee, 0xe9, 0xff, 0xe9, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x22, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x10, 0xe9, 0xff, 0xe9, 0xec, 
-  0xe9, 0xd6, 0xe9, 0xff, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x51, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfa, 0xe9, 0x09, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2a, 0xe9, 0xff, 0xe9, 0xd4, 
-  0xe9, 0xba, 0xe9, 0xff, 0xe9, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0xf9, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x4e, 0xe9, 0xff, 0xe9, 0xb9, 
-  0xe9, 0x79, 0xe9, 0xff, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xac, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x9a, 0xe9, 0xff, 0xe9, 0x76, 
-  0xe9, 0x2f, 0xe9, 0xff, 0xe9, 0xe4, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x29, 0xe9, 0xfa, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0xed, 0x03, 0xe9, 0xe6, 0xe9, 0xff, 0xe9, 0x2d, 
-  0xe0, 0x01, 0xe9, 0xd4, 0xe9, 0xff, 0xe9, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x6b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf3, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x63, 0xe9, 0xff, 0xe9, 0xd2, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0x55, 0xe9, 0xff, 0xe9, 0xe1, 0xe8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x77, 0xe9, 0xfd, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xeb, 0xe9, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x09, 0xe9, 0xe3, 0xe9, 0xff, 0xe9, 0x52, 0x00, 0x00, 
-  0x00, 0x00, 0xe0, 0x02, 0xe9, 0xce, 0xe9, 0xff, 0xe9, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x43, 0xe9, 0xd2, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfe, 0xe9, 0xaa, 0xe9, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x9f, 0xe9, 0xff, 0xe9, 0xca, 0xe0, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0x29, 0xe9, 0xf3, 0xe9, 0xff, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xe9, 0x3f, 0xe9, 0x89, 0xe9, 0xae, 0xe9, 0xbc, 0xe9, 0xa4, 0xe9, 0x77, 0xe9, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x71, 0xe9, 0xff, 0xe9, 0xf2, 0xe9, 0x26, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x58, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0x82, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xe9, 0x84, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x5f, 0xe9, 0xfa, 0xe9, 0xff, 0xe9, 0xb3, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x25, 0xe9, 0xb5, 0xe9, 0xff, 0xe9, 0xfa, 0xe9, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x49, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xf9, 0xe9, 0x94, 0xe9, 0x37, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xe9, 0x37, 0xe9, 0x95, 0xe9, 0xfa, 0xe9, 0xff, 0xe9, 0xeb, 0xe9, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x14, 0xe9, 0x9d, 0xe9, 0xfe, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe4, 0xe9, 0xb1, 0xe9, 0x95, 0xe9, 0x83, 0xe9, 0x95, 0xe9, 0xb1, 0xe9, 0xe4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfe, 0xe9, 0x9c, 0xe9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x29, 0xe9, 0x8a, 0xe9, 0xe6, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe6, 0xe9, 0x89, 0xe9, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xe9, 0x24, 0xe9, 0x50, 0xe9, 0xb6, 0xe9, 0xff, 0xe9, 0xb6, 0xe9, 0x50, 0xe9, 0x23, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7e, 0xe9, 0xff, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7e, 0xe9, 0xff, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7e, 0xe9, 0xff, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7e, 0xe9, 0xff, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7e, 0xe9, 0xff, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x4e, 0xe9, 0xfa, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x4b, 0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe4, 0xe9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe1, 0x1c, 0xa6, 0xe9, 0x7b, 0xa6, 0xe9, 0xc7, 0xa6, 0xe9, 0xe8, 0xa6, 0xe9, 0xf9, 0xa6, 0xe9, 0xe3, 0xa5, 0xe9, 0xb2, 0xc5, 0xe9, 0x62, 0x04, 0xe2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xfa, 0x03, 0xa6, 0xe9, 0x80, 0xa6, 0xe9, 0xf6, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xe0, 0xa5, 0xe9, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd9, 0x07, 0xa5, 0xe9, 0xb2, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfd, 0xc6, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x9a, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfe, 0xa5, 0xe9, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x48, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa5, 0xe9, 0xeb, 0xa6, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xc7, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x1e, 0xa6, 0xe9, 0xfe, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x5b, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x76, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc5, 0xe9, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xf8, 0x02, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x00, 0xf8, 0x02, 
-  0xa6, 0xe9, 0xd2, 0xa6, 0xe9, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xcd, 0xa6, 0xe9, 0xd0, 
-  0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xfb, 0xa6, 0xe9, 0xff, 
-  0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xfb, 0xa6, 0xe9, 0xff, 
-  0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xfb, 0xa6, 0xe9, 0xff, 
-  0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xfb, 0xa6, 0xe9, 0xff, 
-  0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xfb, 0xa6, 0xe9, 0xff, 
-  0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xfb, 0xa6, 0xe9, 0xff, 
-  0xa6, 0xe9, 0xfe, 0xa6, 0xe9, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x81, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xfc, 0xa6, 0xe9, 0xfe, 
-  0xa6, 0xe9, 0xee, 0xa6, 0xe9, 0xff, 0xc4, 0xf1, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x6f, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xf1, 0x10, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xec, 
-  0xa6, 0xe9, 0xd6, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x51, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfa, 0xc7, 0xe1, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x2a, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xd4, 
-  0xa6, 0xe9, 0xba, 0xa6, 0xe9, 0xff, 0xa5, 0xe9, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf1, 0x0f, 0xa6, 0xe9, 0xf9, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x4e, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xb9, 
-  0xc5, 0xe9, 0x79, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xac, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x9a, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0x76, 
-  0xa5, 0xe9, 0x2f, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xe4, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x29, 0xa6, 0xe9, 0xfa, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xd3, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xfa, 0x03, 0xa6, 0xe9, 0xe6, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x2d, 
-  0x00, 0xf8, 0x01, 0xa6, 0xe9, 0xd4, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x6b, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xf3, 0xa6, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x63, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xd2, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa6, 0xe9, 0x55, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xe1, 0x04, 0xe2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x77, 0xa6, 0xe9, 0xfd, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa5, 0xe9, 0xeb, 0xa6, 0xe9, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xe1, 0x09, 0xa6, 0xe9, 0xe3, 0xa6, 0xe9, 0xff, 0xa5, 0xe9, 0x52, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0x02, 0xa6, 0xe9, 0xce, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x43, 0xa6, 0xe9, 0xd2, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfe, 0xa6, 0xe9, 0xaa, 0xa5, 0xe9, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x9f, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xca, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x29, 0xa6, 0xe9, 0xf3, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x02, 0xa6, 0xe9, 0x3f, 0xa6, 0xe9, 0x89, 0xa6, 0xe9, 0xae, 0xa6, 0xe9, 0xbc, 0xa6, 0xe9, 0xa4, 0xa6, 0xe9, 0x77, 0xa6, 0xe9, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x71, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xf2, 0xa6, 0xe9, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x58, 0xa6, 0xe9, 0xfe, 0xa6, 0xe9, 0xfe, 0xc6, 0xe9, 0x82, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0xa5, 0xe9, 0x84, 0xa6, 0xe9, 0xfe, 0xa6, 0xe9, 0xfe, 0xa5, 0xe9, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x5f, 0xa6, 0xe9, 0xfa, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xb3, 0xc5, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x25, 0xa6, 0xe9, 0xb5, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfa, 0xc5, 0xe9, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x49, 0xa6, 0xe9, 0xec, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xf9, 0xa6, 0xe9, 0x94, 0xc6, 0xe9, 0x37, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0xc6, 0xe9, 0x37, 0xc5, 0xe9, 0x95, 0xa6, 0xe9, 0xfa, 0xa6, 0xe9, 0xff, 0xa5, 0xe9, 0xeb, 0xa6, 0xe9, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x14, 0xa6, 0xe9, 0x9d, 0xa6, 0xe9, 0xfe, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xe4, 0xa6, 0xe9, 0xb1, 0xc5, 0xe9, 0x95, 0xc6, 0xe9, 0x83, 0xc5, 0xe9, 0x95, 0xa6, 0xe9, 0xb1, 0xa6, 0xe9, 0xe4, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xfe, 0xa6, 0xe9, 0x9c, 0xa5, 0xe1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x29, 0xa5, 0xe9, 0x8a, 0xa6, 0xe9, 0xe6, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xe6, 0xa6, 0xe9, 0x89, 0xc5, 0xe9, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x02, 0xc5, 0xe9, 0x24, 0xa6, 0xe9, 0x50, 0xc6, 0xe9, 0xb6, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0xb6, 0xa6, 0xe9, 0x50, 0xa5, 0xe9, 0x23, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x7e, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x7e, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x7e, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x7e, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x7e, 0xa6, 0xe9, 0xff, 0xc6, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x4e, 0xa6, 0xe9, 0xfa, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xe8, 0xa6, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x4b, 0xa6, 0xe9, 0xf8, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xff, 0xa6, 0xe9, 0xe4, 0xa5, 0xe1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc6, 0x1c, 0xe9, 0xa6, 0x7b, 0xe9, 0xa6, 0xc7, 0xe9, 0xa6, 0xe8, 0xe9, 0xa6, 0xf9, 0xe9, 0xa6, 0xe3, 0xe9, 0xa5, 0xb2, 0xe9, 0xc5, 0x62, 0xe2, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xab, 0x03, 0xe9, 0xa6, 0x80, 0xe9, 0xa6, 0xf6, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xe0, 0xe9, 0xa5, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x24, 0x07, 0xe9, 0xa5, 0xb2, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfd, 0xe9, 0xc6, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x9a, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfe, 0xe9, 0xa5, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x48, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa5, 0xeb, 0xf1, 0xa6, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xc7, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x1e, 0xe9, 0xa6, 0xfe, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x5b, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xf1, 0xa6, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x76, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc5, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf8, 0x00, 0x02, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xf8, 0x00, 0x02, 
-  0xe9, 0xa6, 0xd2, 0xe9, 0xa6, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xcd, 0xe9, 0xa6, 0xd0, 
-  0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xfb, 0xe9, 0xa6, 0xff, 
-  0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xfb, 0xe9, 0xa6, 0xff, 
-  0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xfb, 0xe9, 0xa6, 0xff, 
-  0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xfb, 0xe9, 0xa6, 0xff, 
-  0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xfb, 0xe9, 0xa6, 0xff, 
-  0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xfb, 0xe9, 0xa6, 0xff, 
-  0xe9, 0xa6, 0xfe, 0xe9, 0xa6, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x81, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xfc, 0xe9, 0xa6, 0xfe, 
-  0xe9, 0xa6, 0xee, 0xe9, 0xa6, 0xff, 0xf1, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x6f, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x86, 0x10, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xec, 
-  0xe9, 0xa6, 0xd6, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x51, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfa, 0xe1, 0xc7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x2a, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xd4, 
-  0xe9, 0xa6, 0xba, 0xe9, 0xa6, 0xff, 0xe9, 0xa5, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xa6, 0x0f, 0xe9, 0xa6, 0xf9, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x4e, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xb9, 
-  0xe9, 0xc5, 0x79, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xac, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x9a, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0x76, 
-  0xe9, 0xa5, 0x2f, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xe4, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x29, 0xe9, 0xa6, 0xfa, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xd3, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xab, 0x03, 0xe9, 0xa6, 0xe6, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x2d, 
-  0xf8, 0x00, 0x01, 0xe9, 0xa6, 0xd4, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x6b, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xf3, 0xe9, 0xa6, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x63, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xd2, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xe9, 0xa6, 0x55, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xe1, 0xe2, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x77, 0xe9, 0xa6, 0xfd, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa5, 0xeb, 0xe9, 0xa6, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc7, 0x09, 0xe9, 0xa6, 0xe3, 0xe9, 0xa6, 0xff, 0xe9, 0xa5, 0x52, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xe9, 0xa6, 0xce, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x43, 0xe9, 0xa6, 0xd2, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfe, 0xe9, 0xa6, 0xaa, 0xe9, 0xa5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x9f, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xca, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x29, 0xe9, 0xa6, 0xf3, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xe9, 0xa6, 0x3f, 0xe9, 0xa6, 0x89, 0xe9, 0xa6, 0xae, 0xe9, 0xa6, 0xbc, 0xe9, 0xa6, 0xa4, 0xe9, 0xa6, 0x77, 0xe9, 0xa6, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x71, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xf2, 0xe9, 0xa6, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x58, 0xe9, 0xa6, 0xfe, 0xe9, 0xa6, 0xfe, 0xe9, 0xc6, 0x82, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xe9, 0xa5, 0x84, 0xe9, 0xa6, 0xfe, 0xe9, 0xa6, 0xfe, 0xe9, 0xa5, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x5f, 0xe9, 0xa6, 0xfa, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xb3, 0xe9, 0xc5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x25, 0xe9, 0xa6, 0xb5, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfa, 0xe9, 0xc5, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x49, 0xe9, 0xa6, 0xec, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xf9, 0xe9, 0xa6, 0x94, 0xe9, 0xc6, 0x37, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xe9, 0xc6, 0x37, 0xe9, 0xc5, 0x95, 0xe9, 0xa6, 0xfa, 0xe9, 0xa6, 0xff, 0xe9, 0xa5, 0xeb, 0xe9, 0xa6, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x14, 0xe9, 0xa6, 0x9d, 0xe9, 0xa6, 0xfe, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xe4, 0xe9, 0xa6, 0xb1, 0xe9, 0xc5, 0x95, 0xe9, 0xc6, 0x83, 0xe9, 0xc5, 0x95, 0xe9, 0xa6, 0xb1, 0xe9, 0xa6, 0xe4, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xfe, 0xe9, 0xa6, 0x9c, 0xe1, 0xa5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x29, 0xe9, 0xa5, 0x8a, 0xe9, 0xa6, 0xe6, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xe6, 0xe9, 0xa6, 0x89, 0xe9, 0xc5, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xe9, 0xc5, 0x24, 0xe9, 0xa6, 0x50, 0xe9, 0xc6, 0xb6, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0xb6, 0xe9, 0xa6, 0x50, 0xe9, 0xa5, 0x23, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x7e, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x7e, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x7e, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x7e, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x7e, 0xe9, 0xa6, 0xff, 0xe9, 0xc6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x4e, 0xe9, 0xa6, 0xfa, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xe8, 0xe9, 0xa6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x4b, 0xe9, 0xa6, 0xf8, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xff, 0xe9, 0xa6, 0xe4, 0xe1, 0xa5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x37, 0xe4, 0x1c, 0x2e, 0x36, 0xe8, 0x7b, 0x2d, 0x36, 0xe8, 0xc7, 0x2d, 0x36, 0xe8, 0xe8, 0x2d, 0x36, 0xe8, 0xf9, 0x2d, 0x36, 0xe9, 0xe3, 0x2c, 0x36, 0xe8, 0xb2, 0x2c, 0x37, 0xe8, 0x62, 0x20, 0x40, 0xdf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xff, 0x03, 0x2e, 0x36, 0xe7, 0x80, 0x2d, 0x36, 0xe8, 0xf6, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x36, 0xe8, 0xe0, 0x2c, 0x36, 0xe7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xdb, 0x07, 0x2c, 0x36, 0xe8, 0xb2, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfd, 0x2e, 0x37, 0xe8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x37, 0xe8, 0x9a, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfe, 0x2c, 0x35, 0xe7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x35, 0xea, 0x48, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2c, 0x36, 0xe8, 0xeb, 0x33, 0x33, 0xee, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe8, 0xc7, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x36, 0xe8, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x33, 0xe6, 0x1e, 0x2d, 0x36, 0xe8, 0xfe, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe9, 0x5b, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x33, 0x33, 0xee, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe7, 0x76, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2c, 0x38, 0xe6, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 
-  0x2d, 0x35, 0xe8, 0xd2, 0x2d, 0x36, 0xe8, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe9, 0xcd, 0x2d, 0x36, 0xe8, 0xd0, 
-  0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe8, 0xfb, 0x2d, 0x36, 0xe8, 0xff, 
-  0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe8, 0xfb, 0x2d, 0x36, 0xe8, 0xff, 
-  0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe8, 0xfb, 0x2d, 0x36, 0xe8, 0xff, 
-  0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe8, 0xfb, 0x2d, 0x36, 0xe8, 0xff, 
-  0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe8, 0xfb, 0x2d, 0x36, 0xe8, 0xff, 
-  0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe8, 0xfb, 0x2d, 0x36, 0xe8, 0xff, 
-  0x2d, 0x36, 0xe8, 0xfe, 0x2d, 0x36, 0xe8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x81, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2f, 0x34, 0xe7, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe8, 0xfc, 0x2d, 0x36, 0xe8, 0xfe, 
-  0x2d, 0x36, 0xe9, 0xee, 0x2d, 0x36, 0xe8, 0xff, 0x24, 0x37, 0xed, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x37, 0xe8, 0x6f, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x34, 0xe8, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xef, 0x10, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xec, 
-  0x2d, 0x36, 0xe8, 0xd6, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x34, 0xe5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe9, 0x51, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfa, 0x39, 0x39, 0xe3, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x37, 0xe7, 0x2a, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xd4, 
-  0x2d, 0x35, 0xe8, 0xba, 0x2d, 0x36, 0xe8, 0xff, 0x2c, 0x36, 0xe8, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xee, 0x0f, 0x2d, 0x36, 0xe8, 0xf9, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x38, 0xe8, 0x4e, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xb9, 
-  0x2c, 0x37, 0xe8, 0x79, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x36, 0xe7, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xac, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x36, 0xe7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x37, 0xe8, 0x9a, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe7, 0x76, 
-  0x2b, 0x36, 0xe9, 0x2f, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xe4, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x38, 0xe6, 0x29, 0x2d, 0x36, 0xe8, 0xfa, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xd3, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xff, 0x03, 0x2d, 0x36, 0xe8, 0xe6, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x39, 0xe8, 0x2d, 
-  0x00, 0x00, 0xff, 0x01, 0x2d, 0x36, 0xe8, 0xd4, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x37, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x37, 0xe7, 0x6b, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xf3, 0x2e, 0x34, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe8, 0x63, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x35, 0xe8, 0xd2, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe7, 0x55, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xe1, 0x20, 0x40, 0xdf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe7, 0x77, 0x2d, 0x36, 0xe8, 0xfd, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2c, 0x36, 0xe8, 0xeb, 0x2e, 0x36, 0xe6, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0xe3, 0x09, 0x2d, 0x36, 0xe9, 0xe3, 0x2d, 0x36, 0xe8, 0xff, 0x2c, 0x35, 0xe9, 0x52, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x2d, 0x36, 0xe7, 0xce, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x35, 0xe8, 0x43, 0x2d, 0x35, 0xe8, 0xd2, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfe, 0x2d, 0x36, 0xe9, 0xaa, 0x2a, 0x33, 0xe6, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x37, 0xe9, 0x9f, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xca, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x38, 0xe6, 0x29, 0x2d, 0x36, 0xe8, 0xf3, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x37, 0xe8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x2d, 0x35, 0xe7, 0x3f, 0x2d, 0x36, 0xe9, 0x89, 0x2d, 0x36, 0xe8, 0xae, 0x2d, 0x36, 0xe8, 0xbc, 0x2d, 0x36, 0xe8, 0xa4, 0x2d, 0x36, 0xe7, 0x77, 0x2f, 0x36, 0xeb, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe8, 0x71, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xf2, 0x2f, 0x36, 0xeb, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x37, 0xe8, 0x58, 0x2d, 0x36, 0xe8, 0xfe, 0x2d, 0x36, 0xe8, 0xfe, 0x2d, 0x37, 0xe7, 0x82, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x2c, 0x36, 0xe8, 0x84, 0x2d, 0x36, 0xe8, 0xfe, 0x2d, 0x36, 0xe8, 0xfe, 0x2c, 0x35, 0xe7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x36, 0xe7, 0x5f, 0x2d, 0x36, 0xe8, 0xfa, 0x2d, 0x36, 0xe8, 0xff, 0x2e, 0x36, 0xe8, 0xb3, 0x2a, 0x39, 0xea, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x37, 0xea, 0x25, 0x2d, 0x36, 0xe8, 0xb5, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfa, 0x2c, 0x37, 0xe9, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x34, 0xe7, 0x49, 0x2d, 0x36, 0xe8, 0xec, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xf9, 0x2d, 0x35, 0xe9, 0x94, 0x2e, 0x38, 0xe8, 0x37, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x2e, 0x38, 0xe8, 0x37, 0x2c, 0x37, 0xe9, 0x95, 0x2d, 0x36, 0xe8, 0xfa, 0x2d, 0x36, 0xe8, 0xff, 0x2c, 0x36, 0xe8, 0xeb, 0x2f, 0x36, 0xe9, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xe6, 0x14, 0x2d, 0x36, 0xe8, 0x9d, 0x2d, 0x36, 0xe8, 0xfe, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xe4, 0x2d, 0x35, 0xe8, 0xb1, 0x2c, 0x37, 0xe9, 0x95, 0x2d, 0x37, 0xe8, 0x83, 0x2c, 0x37, 0xe9, 0x95, 0x2d, 0x35, 0xe8, 0xb1, 0x2d, 0x36, 0xe8, 0xe4, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xfe, 0x2e, 0x36, 0xe8, 0x9c, 0x28, 0x36, 0xe4, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x38, 0xe6, 0x29, 0x2c, 0x36, 0xe9, 0x8a, 0x2d, 0x36, 0xe8, 0xe6, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xe6, 0x2d, 0x36, 0xe9, 0x89, 0x2c, 0x38, 0xe6, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x2a, 0x39, 0xea, 0x24, 0x2d, 0x36, 0xe9, 0x50, 0x2d, 0x37, 0xe9, 0xb6, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x37, 0xe9, 0xb6, 0x2d, 0x36, 0xe9, 0x50, 0x2c, 0x33, 0xe9, 0x23, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x37, 0xe9, 0x7e, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x37, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x37, 0xe9, 0x7e, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x37, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x37, 0xe9, 0x7e, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x37, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x37, 0xe9, 0x7e, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x37, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x37, 0xe9, 0x7e, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x37, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x38, 0xe8, 0x4e, 0x2d, 0x36, 0xe8, 0xfa, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xe8, 0x33, 0x33, 0xe6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe7, 0x4b, 0x2d, 0x36, 0xe8, 0xf8, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xff, 0x2d, 0x36, 0xe8, 0xe4, 0x28, 0x36, 0xe4, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t mic_logo = {
-  .header.always_zero = 0,
-  .header.w = 29,
-  .header.h = 51,
-  .data_size = 1479 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = mic_logo_map,
-};
@@ -1,131 +0,0 @@
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_MUTE_OFF
-#define LV_ATTRIBUTE_IMG_MUTE_OFF
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_MUTE_OFF uint8_t mute_off_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe5, 0x6b, 0xe5, 0xdc, 0xe5, 0xfb, 0xe5, 0xd4, 0xe1, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x9c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0x37, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xf8, 0xe1, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0x7b, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x57, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0x88, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x68, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0x88, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x68, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0x88, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x68, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0x88, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x68, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0x88, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x68, 0x00, 0x00, 0x00, 0x00, 
-  0xe4, 0x60, 0x00, 0x00, 0xe8, 0x88, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x68, 0x00, 0x00, 0xe1, 0x60, 
-  0xe8, 0xe3, 0x00, 0x00, 0xe8, 0x88, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x68, 0x00, 0x00, 0xe1, 0xe3, 
-  0xe8, 0xe3, 0x00, 0x00, 0xe8, 0x88, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x68, 0x00, 0x00, 0xe1, 0xe3, 
-  0xe8, 0xe3, 0x00, 0x00, 0xe8, 0x88, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x68, 0x00, 0x00, 0xe1, 0xe3, 
-  0xe4, 0xe3, 0x00, 0x00, 0xe8, 0x7b, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0x58, 0x00, 0x00, 0xe1, 0xe4, 
-  0xe8, 0xcc, 0xe5, 0x1c, 0xe8, 0x38, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0xf8, 0xe1, 0x1b, 0xe1, 0x20, 0xe1, 0xcc, 
-  0xe8, 0x7c, 0xe5, 0x7c, 0x00, 0x00, 0xe5, 0xa0, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe1, 0xff, 0xe1, 0x7f, 0x00, 0x00, 0xe1, 0x7f, 0xe1, 0x7b, 
-  0xe4, 0x10, 0xe4, 0xdc, 0xe5, 0x28, 0xe0, 0x03, 0xe5, 0x70, 0xe5, 0xe3, 0xe5, 0xff, 0xe5, 0xd8, 0xe1, 0x58, 0x00, 0x00, 0xe1, 0x28, 0xe1, 0xdc, 0xe1, 0x10, 
-  0x00, 0x00, 0xe4, 0x40, 0xe5, 0xdb, 0xe5, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x38, 0xe1, 0xd8, 0xe1, 0x40, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe5, 0x37, 0xe5, 0xd3, 0xe5, 0xaf, 0xe5, 0x67, 0xe5, 0x4f, 0xe5, 0x67, 0xe5, 0xb0, 0xe1, 0xd0, 0xe1, 0x34, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe5, 0x44, 0xe5, 0x84, 0xe5, 0xf4, 0xe5, 0x84, 0xe5, 0x44, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe5, 0xcb, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xef, 0xe5, 0xfc, 0xe5, 0xef, 0xe5, 0xef, 0xe1, 0xef, 0xe1, 0xab, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x25, 0xf9, 0x6b, 0x06, 0xf9, 0xdc, 0xc6, 0xf0, 0xfb, 0x87, 0xf0, 0xd4, 0x68, 0xe8, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xf9, 0x9c, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xf9, 0x37, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xf8, 0x09, 0xe8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x7b, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe8, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x88, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe0, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x88, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe0, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x88, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe0, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x88, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe0, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x88, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe0, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x84, 0xf9, 0x60, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x88, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe0, 0x68, 0x00, 0x00, 0x00, 0x29, 0xe8, 0x60, 
-  0x84, 0xf9, 0xe3, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x88, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe0, 0x68, 0x00, 0x00, 0x00, 0x09, 0xe8, 0xe3, 
-  0x84, 0xf9, 0xe3, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x88, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe0, 0x68, 0x00, 0x00, 0x00, 0x09, 0xe8, 0xe3, 
-  0x84, 0xf9, 0xe3, 0x00, 0x00, 0x00, 0x83, 0xf9, 0x88, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe0, 0x68, 0x00, 0x00, 0x00, 0x09, 0xe8, 0xe3, 
-  0x84, 0xf9, 0xe3, 0x00, 0x00, 0x00, 0x84, 0xf9, 0x7b, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xff, 0x09, 0xe8, 0x58, 0x00, 0x00, 0x00, 0x09, 0xe8, 0xe4, 
-  0x84, 0xf9, 0xcc, 0x64, 0xf9, 0x1c, 0x83, 0xf9, 0x38, 0x64, 0xf9, 0xff, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0xf8, 0x0a, 0xe0, 0x1b, 0x49, 0xe8, 0x20, 0x29, 0xe8, 0xcc, 
-  0x84, 0xf9, 0x7c, 0x64, 0xf9, 0x7c, 0x00, 0x00, 0x00, 0x64, 0xf9, 0xa0, 0x25, 0xf9, 0xff, 0x06, 0xf9, 0xff, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xff, 0x68, 0xe8, 0xff, 0x29, 0xe8, 0x7f, 0x00, 0x00, 0x00, 0x29, 0xe8, 0x7f, 0x09, 0xe8, 0x7b, 
-  0x64, 0xf9, 0x10, 0x64, 0xf9, 0xdc, 0x25, 0xf9, 0x28, 0x00, 0xf8, 0x03, 0x25, 0xf9, 0x70, 0x06, 0xf9, 0xe3, 0xc6, 0xf0, 0xff, 0x87, 0xf0, 0xd8, 0x68, 0xe8, 0x58, 0x00, 0x00, 0x00, 0x68, 0xe8, 0x28, 0x29, 0xe8, 0xdc, 0x0a, 0xe0, 0x10, 
-  0x00, 0x00, 0x00, 0x64, 0xf9, 0x40, 0x45, 0xf9, 0xdb, 0x25, 0xf9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xf0, 0x38, 0x68, 0xe8, 0xd8, 0x49, 0xe8, 0x40, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xf9, 0x37, 0x25, 0xf9, 0xd3, 0x05, 0xf9, 0xaf, 0xe6, 0xf8, 0x67, 0xc6, 0xf0, 0x4f, 0xa7, 0xf0, 0x67, 0x87, 0xf0, 0xb0, 0x68, 0xe8, 0xd0, 0x48, 0xe8, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0x05, 0xf9, 0x44, 0xe6, 0xf0, 0x84, 0xc6, 0xf0, 0xf4, 0xa7, 0xf0, 0x84, 0xa7, 0xe8, 0x44, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xf0, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xf0, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xf9, 0xcb, 0x25, 0xf9, 0xef, 0x05, 0xf9, 0xef, 0xe6, 0xf0, 0xef, 0xc6, 0xf0, 0xfc, 0xa7, 0xf0, 0xef, 0x87, 0xf0, 0xef, 0x68, 0xe8, 0xef, 0x68, 0xe8, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf9, 0x25, 0x6b, 0xf9, 0x06, 0xdc, 0xf0, 0xc6, 0xfb, 0xf0, 0x87, 0xd4, 0xe8, 0x68, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x64, 0x9c, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa3, 0x37, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xf8, 0xe8, 0x09, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x7b, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe8, 0x09, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x88, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe0, 0x09, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x88, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe0, 0x09, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x88, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe0, 0x09, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x88, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe0, 0x09, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x88, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe0, 0x09, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf9, 0x84, 0x60, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x88, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe0, 0x09, 0x68, 0x00, 0x00, 0x00, 0xe8, 0x29, 0x60, 
-  0xf9, 0x84, 0xe3, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x88, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe0, 0x09, 0x68, 0x00, 0x00, 0x00, 0xe8, 0x09, 0xe3, 
-  0xf9, 0x84, 0xe3, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x88, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe0, 0x09, 0x68, 0x00, 0x00, 0x00, 0xe8, 0x09, 0xe3, 
-  0xf9, 0x84, 0xe3, 0x00, 0x00, 0x00, 0xf9, 0x83, 0x88, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe0, 0x09, 0x68, 0x00, 0x00, 0x00, 0xe8, 0x09, 0xe3, 
-  0xf9, 0x84, 0xe3, 0x00, 0x00, 0x00, 0xf9, 0x84, 0x7b, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xff, 0xe8, 0x09, 0x58, 0x00, 0x00, 0x00, 0xe8, 0x09, 0xe4, 
-  0xf9, 0x84, 0xcc, 0xf9, 0x64, 0x1c, 0xf9, 0x83, 0x38, 0xf9, 0x64, 0xff, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0xf8, 0xe0, 0x0a, 0x1b, 0xe8, 0x49, 0x20, 0xe8, 0x29, 0xcc, 
-  0xf9, 0x84, 0x7c, 0xf9, 0x64, 0x7c, 0x00, 0x00, 0x00, 0xf9, 0x64, 0xa0, 0xf9, 0x25, 0xff, 0xf9, 0x06, 0xff, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xff, 0xe8, 0x68, 0xff, 0xe8, 0x29, 0x7f, 0x00, 0x00, 0x00, 0xe8, 0x29, 0x7f, 0xe8, 0x09, 0x7b, 
-  0xf9, 0x64, 0x10, 0xf9, 0x64, 0xdc, 0xf9, 0x25, 0x28, 0xf8, 0x00, 0x03, 0xf9, 0x25, 0x70, 0xf9, 0x06, 0xe3, 0xf0, 0xc6, 0xff, 0xf0, 0x87, 0xd8, 0xe8, 0x68, 0x58, 0x00, 0x00, 0x00, 0xe8, 0x68, 0x28, 0xe8, 0x29, 0xdc, 0xe0, 0x0a, 0x10, 
-  0x00, 0x00, 0x00, 0xf9, 0x64, 0x40, 0xf9, 0x45, 0xdb, 0xf9, 0x25, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x68, 0x38, 0xe8, 0x68, 0xd8, 0xe8, 0x49, 0x40, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x25, 0x37, 0xf9, 0x25, 0xd3, 0xf9, 0x05, 0xaf, 0xf8, 0xe6, 0x67, 0xf0, 0xc6, 0x4f, 0xf0, 0xa7, 0x67, 0xf0, 0x87, 0xb0, 0xe8, 0x68, 0xd0, 0xe8, 0x48, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xf9, 0x05, 0x44, 0xf0, 0xe6, 0x84, 0xf0, 0xc6, 0xf4, 0xf0, 0xa7, 0x84, 0xe8, 0xa7, 0x44, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xc6, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xc6, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x45, 0xcb, 0xf9, 0x25, 0xef, 0xf9, 0x05, 0xef, 0xf0, 0xe6, 0xef, 0xf0, 0xc6, 0xfc, 0xf0, 0xa7, 0xef, 0xf0, 0x87, 0xef, 0xe8, 0x68, 0xef, 0xe8, 0x68, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x29, 0x24, 0xf8, 0x6b, 0x2e, 0x1f, 0xf5, 0xdc, 0x34, 0x1a, 0xf2, 0xfb, 0x3a, 0x12, 0xef, 0xd4, 0x41, 0x0c, 0xec, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2b, 0xfc, 0x9c, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x34, 0xff, 0x37, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xf8, 0x4a, 0x00, 0xea, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x32, 0xff, 0x7b, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe5, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x88, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x88, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x88, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x88, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x88, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x1d, 0x30, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x88, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x48, 0x03, 0xe7, 0x60, 
-  0x1e, 0x31, 0xfe, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x88, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x49, 0x02, 0xe6, 0xe3, 
-  0x1e, 0x31, 0xfe, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x88, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x49, 0x02, 0xe6, 0xe3, 
-  0x1e, 0x31, 0xfe, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x32, 0xff, 0x88, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4c, 0x00, 0xe4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x49, 0x02, 0xe6, 0xe3, 
-  0x1e, 0x30, 0xfe, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x32, 0xff, 0x7b, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xff, 0x4b, 0x00, 0xe5, 0x58, 0x00, 0x00, 0x00, 0x00, 0x49, 0x02, 0xe6, 0xe4, 
-  0x1e, 0x31, 0xfe, 0xcc, 0x23, 0x2c, 0xff, 0x1c, 0x1b, 0x32, 0xff, 0x38, 0x22, 0x2b, 0xfc, 0xff, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x46, 0x06, 0xe8, 0xf8, 0x4e, 0x00, 0xe2, 0x1b, 0x48, 0x08, 0xe7, 0x20, 0x49, 0x03, 0xe6, 0xcc, 
-  0x1f, 0x31, 0xff, 0x7c, 0x21, 0x2b, 0xfd, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x21, 0x2b, 0xfc, 0xa0, 0x28, 0x25, 0xf8, 0xff, 0x2e, 0x1f, 0xf5, 0xff, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xff, 0x40, 0x0c, 0xeb, 0xff, 0x47, 0x06, 0xe9, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x46, 0x06, 0xe9, 0x7f, 0x49, 0x02, 0xe6, 0x7b, 
-  0x1e, 0x2d, 0xff, 0x10, 0x20, 0x2c, 0xfc, 0xdc, 0x26, 0x26, 0xf9, 0x28, 0x00, 0x00, 0xff, 0x03, 0x29, 0x24, 0xf8, 0x70, 0x2e, 0x1f, 0xf5, 0xe3, 0x34, 0x19, 0xf2, 0xff, 0x3a, 0x12, 0xef, 0xd8, 0x40, 0x0c, 0xeb, 0x58, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0c, 0xec, 0x28, 0x46, 0x06, 0xe8, 0xdc, 0x50, 0x00, 0xdf, 0x10, 
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0x2b, 0xfb, 0x40, 0x25, 0x28, 0xfa, 0xdb, 0x2b, 0x26, 0xfa, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0e, 0xed, 0x38, 0x42, 0x0b, 0xea, 0xd8, 0x48, 0x08, 0xe7, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0xfa, 0x37, 0x29, 0x24, 0xf8, 0xd3, 0x2c, 0x22, 0xf6, 0xaf, 0x30, 0x1e, 0xf5, 0x67, 0x34, 0x1a, 0xf2, 0x4f, 0x37, 0x14, 0xf0, 0x67, 0x3b, 0x11, 0xee, 0xb0, 0x3e, 0x0d, 0xeb, 0xd0, 0x40, 0x0a, 0xeb, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2c, 0x21, 0xf8, 0x44, 0x30, 0x1d, 0xf3, 0x84, 0x34, 0x19, 0xf2, 0xf4, 0x36, 0x15, 0xf0, 0x84, 0x3c, 0x13, 0xec, 0x44, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x19, 0xf2, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x19, 0xf2, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x28, 0xfa, 0xcb, 0x29, 0x26, 0xf8, 0xef, 0x2c, 0x21, 0xf6, 0xef, 0x30, 0x1d, 0xf4, 0xef, 0x34, 0x19, 0xf2, 0xfc, 0x37, 0x15, 0xf0, 0xef, 0x3b, 0x11, 0xee, 0xef, 0x3e, 0x0d, 0xec, 0xef, 0x42, 0x0b, 0xea, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t mute_off = {
-  .header.always_zero = 0,
-  .header.w = 13,
-  .header.h = 23,
-  .data_size = 299 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = mute_off_map,
-};
-
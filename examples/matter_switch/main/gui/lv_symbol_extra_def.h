@@ -1,1881 +0,0 @@
-#ifndef LV_SYMBOL_EXTRA_DEF_H
-#define LV_SYMBOL_EXTRA_DEF_H
-/* clang-format off */
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#define LV_SYMBOL_EXTRA_WIFI_MIN  "\xef\x9a\xaa" /*63146, 0xF6AA*/
-#define LV_SYMBOL_EXTRA_WIFI_MID  "\xef\x9a\xab" /*63147, 0xF6AB*/
-#define LV_SYMBOL_EXTRA_WIFI_OFF  "\xef\x9a\xac" /*63148, 0xF6AC*/
-#define LV_SYMBOL_EXTRA_WIFI_MAX  "\xef\x87\xab" /*61931, 0xF1EB*/
-
-/* Generate by Excel */
-#define LV_SYMBOL_EXTRA_GLASS_MARTINI   "\xef\x80\x80"
-#define LV_SYMBOL_EXTRA_MUSIC           "\xef\x80\x81"
-#define LV_SYMBOL_EXTRA_SEARCH          "\xef\x80\x82"
-#define LV_SYMBOL_EXTRA_HEART           "\xef\x80\x84"
-#define LV_SYMBOL_EXTRA_STAR            "\xef\x80\x85"
-#define LV_SYMBOL_EXTRA_USER            "\xef\x80\x87"
-#define LV_SYMBOL_EXTRA_FILM            "\xef\x80\x88"
-#define LV_SYMBOL_EXTRA_TH_LARGE        "\xef\x80\x89"
-#define LV_SYMBOL_EXTRA_TH              "\xef\x80\x8A"
-#define LV_SYMBOL_EXTRA_TH_LIST         "\xef\x80\x8B"
-#define LV_SYMBOL_EXTRA_CHECK           "\xef\x80\x8C"
-#define LV_SYMBOL_EXTRA_TIMES           "\xef\x80\x8D"
-#define LV_SYMBOL_EXTRA_SEARCH_PLUS     "\xef\x80\x8E"
-#define LV_SYMBOL_EXTRA_SEARCH_MINUS    "\xef\x80\x90"
-#define LV_SYMBOL_EXTRA_POWER_OFF       "\xef\x80\x91"
-#define LV_SYMBOL_EXTRA_SIGNAL          "\xef\x80\x92"
-#define LV_SYMBOL_EXTRA_COG             "\xef\x80\x93"
-#define LV_SYMBOL_EXTRA_HOME            "\xef\x80\x95"
-#define LV_SYMBOL_EXTRA_CLOCK           "\xef\x80\x97"
-#define LV_SYMBOL_EXTRA_ROAD            "\xef\x80\x98"
-#define LV_SYMBOL_EXTRA_DOWNLOAD        "\xef\x80\x99"
-#define LV_SYMBOL_EXTRA_INBOX           "\xef\x80\x9C"
-#define LV_SYMBOL_EXTRA_REDO            "\xef\x80\x9E"
-#define LV_SYMBOL_EXTRA_SYNC            "\xef\x80\xA1"
-#define LV_SYMBOL_EXTRA_LIST_ALT        "\xef\x80\xA2"
-#define LV_SYMBOL_EXTRA_LOCK            "\xef\x80\xA3"
-#define LV_SYMBOL_EXTRA_FLAG            "\xef\x80\xA4"
-#define LV_SYMBOL_EXTRA_HEADPHONES      "\xef\x80\xA5"
-#define LV_SYMBOL_EXTRA_VOLUME_OFF      "\xef\x80\xA6"
-#define LV_SYMBOL_EXTRA_VOLUME_DOWN     "\xef\x80\xA7"
-#define LV_SYMBOL_EXTRA_VOLUME_UP       "\xef\x80\xA8"
-#define LV_SYMBOL_EXTRA_QRCODE          "\xef\x80\xA9"
-#define LV_SYMBOL_EXTRA_BARCODE         "\xef\x80\xAA"
-#define LV_SYMBOL_EXTRA_TAG             "\xef\x80\xAB"
-#define LV_SYMBOL_EXTRA_TAGS            "\xef\x80\xAC"
-#define LV_SYMBOL_EXTRA_BOOK            "\xef\x80\xAD"
-#define LV_SYMBOL_EXTRA_BOOKMARK        "\xef\x80\xAE"
-#define LV_SYMBOL_EXTRA_PRINT           "\xef\x80\xAF"
-#define LV_SYMBOL_EXTRA_CAMERA          "\xef\x80\xB0"
-#define LV_SYMBOL_EXTRA_FONT            "\xef\x80\xB1"
-#define LV_SYMBOL_EXTRA_BOLD            "\xef\x80\xB2"
-#define LV_SYMBOL_EXTRA_ITALIC          "\xef\x80\xB3"
-#define LV_SYMBOL_EXTRA_TEXT_HEIGHT     "\xef\x80\xB4"
-#define LV_SYMBOL_EXTRA_TEXT_WIDTH      "\xef\x80\xB5"
-#define LV_SYMBOL_EXTRA_ALIGN_LEFT      "\xef\x80\xB6"
-#define LV_SYMBOL_EXTRA_ALIGN_CENTER    "\xef\x80\xB7"
-#define LV_SYMBOL_EXTRA_ALIGN_RIGHT     "\xef\x80\xB8"
-#define LV_SYMBOL_EXTRA_ALIGN_JUSTIFY   "\xef\x80\xB9"
-#define LV_SYMBOL_EXTRA_LIST            "\xef\x80\xBA"
-#define LV_SYMBOL_EXTRA_OUTDENT         "\xef\x80\xBB"
-#define LV_SYMBOL_EXTRA_INDENT          "\xef\x80\xBC"
-#define LV_SYMBOL_EXTRA_VIDEO           "\xef\x80\xBD"
-#define LV_SYMBOL_EXTRA_IMAGE           "\xef\x80\xBE"
-#define LV_SYMBOL_EXTRA_PENCIL          "\xef\x81\x80"
-#define LV_SYMBOL_EXTRA_MAP_MARKER      "\xef\x81\x81"
-#define LV_SYMBOL_EXTRA_ADJUST          "\xef\x81\x82"
-#define LV_SYMBOL_EXTRA_TINT            "\xef\x81\x83"
-#define LV_SYMBOL_EXTRA_EDIT            "\xef\x81\x84"
-#define LV_SYMBOL_EXTRA_ARROWS          "\xef\x81\x87"
-#define LV_SYMBOL_EXTRA_STEP_BACKWARD   "\xef\x81\x88"
-#define LV_SYMBOL_EXTRA_FAST_BACKWARD   "\xef\x81\x89"
-#define LV_SYMBOL_EXTRA_BACKWARD        "\xef\x81\x8A"
-#define LV_SYMBOL_EXTRA_PLAY            "\xef\x81\x8B"
-#define LV_SYMBOL_EXTRA_PAUSE           "\xef\x81\x8C"
-#define LV_SYMBOL_EXTRA_STOP            "\xef\x81\x8D"
-#define LV_SYMBOL_EXTRA_FORWARD         "\xef\x81\x8E"
-#define LV_SYMBOL_EXTRA_FAST_FORWARD    "\xef\x81\x90"
-#define LV_SYMBOL_EXTRA_STEP_FORWARD    "\xef\x81\x91"
-#define LV_SYMBOL_EXTRA_EJECT           "\xef\x81\x92"
-#define LV_SYMBOL_EXTRA_CHEVRON_LEFT    "\xef\x81\x93"
-#define LV_SYMBOL_EXTRA_CHEVRON_RIGHT   "\xef\x81\x94"
-#define LV_SYMBOL_EXTRA_PLUS_CIRCLE     "\xef\x81\x95"
-#define LV_SYMBOL_EXTRA_MINUS_CIRCLE    "\xef\x81\x96"
-#define LV_SYMBOL_EXTRA_TIMES_CIRCLE    "\xef\x81\x97"
-#define LV_SYMBOL_EXTRA_CHECK_CIRCLE    "\xef\x81\x98"
-#define LV_SYMBOL_EXTRA_QUESTION_CIRCLE "\xef\x81\x99"
-#define LV_SYMBOL_EXTRA_INFO_CIRCLE     "\xef\x81\x9A"
-#define LV_SYMBOL_EXTRA_CROSSHAIRS      "\xef\x81\x9B"
-#define LV_SYMBOL_EXTRA_BAN             "\xef\x81\x9E"
-#define LV_SYMBOL_EXTRA_ARROW_LEFT      "\xef\x81\xA0"
-#define LV_SYMBOL_EXTRA_ARROW_RIGHT     "\xef\x81\xA1"
-#define LV_SYMBOL_EXTRA_ARROW_UP        "\xef\x81\xA2"
-#define LV_SYMBOL_EXTRA_ARROW_DOWN      "\xef\x81\xA3"
-#define LV_SYMBOL_EXTRA_SHARE           "\xef\x81\xA4"
-#define LV_SYMBOL_EXTRA_EXPAND          "\xef\x81\xA5"
-#define LV_SYMBOL_EXTRA_COMPRESS        "\xef\x81\xA6"
-#define LV_SYMBOL_EXTRA_PLUS            "\xef\x81\xA7"
-#define LV_SYMBOL_EXTRA_MINUS           "\xef\x81\xA8"
-#define LV_SYMBOL_EXTRA_ASTERISK        "\xef\x81\xA9"
-#define LV_SYMBOL_EXTRA_EXCLAMATION_CIRCLE  "\xef\x81\xAA"
-#define LV_SYMBOL_EXTRA_GIFT            "\xef\x81\xAB"
-#define LV_SYMBOL_EXTRA_LEAF            "\xef\x81\xAC"
-#define LV_SYMBOL_EXTRA_FIRE            "\xef\x81\xAD"
-#define LV_SYMBOL_EXTRA_EYE             "\xef\x81\xAE"
-#define LV_SYMBOL_EXTRA_EYE_SLASH       "\xef\x81\xB0"
-#define LV_SYMBOL_EXTRA_EXCLAMATION_TRIANGLE    "\xef\x81\xB1"
-#define LV_SYMBOL_EXTRA_PLANE    "\xef\x81\xB2"
-#define LV_SYMBOL_EXTRA_CALENDAR_ALT    "\xef\x81\xB3"
-#define LV_SYMBOL_EXTRA_RANDOM    "\xef\x81\xB4"
-#define LV_SYMBOL_EXTRA_COMMENT    "\xef\x81\xB5"
-#define LV_SYMBOL_EXTRA_MAGNET    "\xef\x81\xB6"
-#define LV_SYMBOL_EXTRA_CHEVRON_UP    "\xef\x81\xB7"
-#define LV_SYMBOL_EXTRA_CHEVRON_DOWN    "\xef\x81\xB8"
-#define LV_SYMBOL_EXTRA_RETWEET    "\xef\x81\xB9"
-#define LV_SYMBOL_EXTRA_SHOPPING_CART    "\xef\x81\xBA"
-#define LV_SYMBOL_EXTRA_FOLDER    "\xef\x81\xBB"
-#define LV_SYMBOL_EXTRA_FOLDER_OPEN    "\xef\x81\xBC"
-#define LV_SYMBOL_EXTRA_ARROWS_V    "\xef\x81\xBD"
-#define LV_SYMBOL_EXTRA_ARROWS_H    "\xef\x81\xBE"
-#define LV_SYMBOL_EXTRA_CHART_BAR    "\xef\x82\x80"
-#define LV_SYMBOL_EXTRA_CAMERA_RETRO    "\xef\x82\x83"
-#define LV_SYMBOL_EXTRA_KEY    "\xef\x82\x84"
-#define LV_SYMBOL_EXTRA_COGS    "\xef\x82\x85"
-#define LV_SYMBOL_EXTRA_COMMENTS    "\xef\x82\x86"
-#define LV_SYMBOL_EXTRA_STAR_HALF    "\xef\x82\x89"
-#define LV_SYMBOL_EXTRA_SIGN_OUT    "\xef\x82\x8B"
-#define LV_SYMBOL_EXTRA_THUMBTACK    "\xef\x82\x8D"
-#define LV_SYMBOL_EXTRA_EXTERNAL_LINK    "\xef\x82\x8E"
-#define LV_SYMBOL_EXTRA_SIGN_IN    "\xef\x82\x90"
-#define LV_SYMBOL_EXTRA_TROPHY    "\xef\x82\x91"
-#define LV_SYMBOL_EXTRA_UPLOAD    "\xef\x82\x93"
-#define LV_SYMBOL_EXTRA_LEMON    "\xef\x82\x94"
-#define LV_SYMBOL_EXTRA_PHONE    "\xef\x82\x95"
-#define LV_SYMBOL_EXTRA_PHONE_SQUARE    "\xef\x82\x98"
-#define LV_SYMBOL_EXTRA_UNLOCK    "\xef\x82\x9C"
-#define LV_SYMBOL_EXTRA_CREDIT_CARD    "\xef\x82\x9D"
-#define LV_SYMBOL_EXTRA_RSS    "\xef\x82\x9E"
-#define LV_SYMBOL_EXTRA_HDD    "\xef\x82\xA0"
-#define LV_SYMBOL_EXTRA_BULLHORN    "\xef\x82\xA1"
-#define LV_SYMBOL_EXTRA_CERTIFICATE    "\xef\x82\xA3"
-#define LV_SYMBOL_EXTRA_HAND_POINT_RIGHT    "\xef\x82\xA4"
-#define LV_SYMBOL_EXTRA_HAND_POINT_LEFT    "\xef\x82\xA5"
-#define LV_SYMBOL_EXTRA_HAND_POINT_UP    "\xef\x82\xA6"
-#define LV_SYMBOL_EXTRA_HAND_POINT_DOWN    "\xef\x82\xA7"
-#define LV_SYMBOL_EXTRA_ARROW_CIRCLE_LEFT    "\xef\x82\xA8"
-#define LV_SYMBOL_EXTRA_ARROW_CIRCLE_RIGHT    "\xef\x82\xA9"
-#define LV_SYMBOL_EXTRA_ARROW_CIRCLE_UP    "\xef\x82\xAA"
-#define LV_SYMBOL_EXTRA_ARROW_CIRCLE_DOWN    "\xef\x82\xAB"
-#define LV_SYMBOL_EXTRA_GLOBE    "\xef\x82\xAC"
-#define LV_SYMBOL_EXTRA_WRENCH    "\xef\x82\xAD"
-#define LV_SYMBOL_EXTRA_TASKS    "\xef\x82\xAE"
-#define LV_SYMBOL_EXTRA_FILTER    "\xef\x82\xB0"
-#define LV_SYMBOL_EXTRA_BRIEFCASE    "\xef\x82\xB1"
-#define LV_SYMBOL_EXTRA_ARROWS_ALT    "\xef\x82\xB2"
-#define LV_SYMBOL_EXTRA_USERS    "\xef\x83\x80"
-#define LV_SYMBOL_EXTRA_LINK    "\xef\x83\x81"
-#define LV_SYMBOL_EXTRA_CLOUD    "\xef\x83\x82"
-#define LV_SYMBOL_EXTRA_FLASK    "\xef\x83\x83"
-#define LV_SYMBOL_EXTRA_CUT    "\xef\x83\x84"
-#define LV_SYMBOL_EXTRA_COPY    "\xef\x83\x85"
-#define LV_SYMBOL_EXTRA_PAPERCLIP    "\xef\x83\x86"
-#define LV_SYMBOL_EXTRA_SAVE    "\xef\x83\x87"
-#define LV_SYMBOL_EXTRA_SQUARE    "\xef\x83\x88"
-#define LV_SYMBOL_EXTRA_BARS    "\xef\x83\x89"
-#define LV_SYMBOL_EXTRA_LIST_UL    "\xef\x83\x8A"
-#define LV_SYMBOL_EXTRA_LIST_OL    "\xef\x83\x8B"
-#define LV_SYMBOL_EXTRA_STRIKETHROUGH    "\xef\x83\x8C"
-#define LV_SYMBOL_EXTRA_UNDERLINE    "\xef\x83\x8D"
-#define LV_SYMBOL_EXTRA_TABLE    "\xef\x83\x8E"
-#define LV_SYMBOL_EXTRA_MAGIC    "\xef\x83\x90"
-#define LV_SYMBOL_EXTRA_TRUCK    "\xef\x83\x91"
-#define LV_SYMBOL_EXTRA_MONEY_BILL    "\xef\x83\x96"
-#define LV_SYMBOL_EXTRA_CARET_DOWN    "\xef\x83\x97"
-#define LV_SYMBOL_EXTRA_CARET_UP    "\xef\x83\x98"
-#define LV_SYMBOL_EXTRA_CARET_LEFT    "\xef\x83\x99"
-#define LV_SYMBOL_EXTRA_CARET_RIGHT    "\xef\x83\x9A"
-#define LV_SYMBOL_EXTRA_COLUMNS    "\xef\x83\x9B"
-#define LV_SYMBOL_EXTRA_SORT    "\xef\x83\x9C"
-#define LV_SYMBOL_EXTRA_SORT_DOWN    "\xef\x83\x9D"
-#define LV_SYMBOL_EXTRA_SORT_UP    "\xef\x83\x9E"
-#define LV_SYMBOL_EXTRA_ENVELOPE    "\xef\x83\xA0"
-#define LV_SYMBOL_EXTRA_UNDO    "\xef\x83\xA2"
-#define LV_SYMBOL_EXTRA_GAVEL    "\xef\x83\xA3"
-#define LV_SYMBOL_EXTRA_TACHOMETER    "\xef\x83\xA4"
-#define LV_SYMBOL_EXTRA_BOLT    "\xef\x83\xA7"
-#define LV_SYMBOL_EXTRA_SITEMAP    "\xef\x83\xA8"
-#define LV_SYMBOL_EXTRA_UMBRELLA    "\xef\x83\xA9"
-#define LV_SYMBOL_EXTRA_PASTE    "\xef\x83\xAA"
-#define LV_SYMBOL_EXTRA_LIGHTBULB    "\xef\x83\xAB"
-#define LV_SYMBOL_EXTRA_EXCHANGE    "\xef\x83\xAC"
-#define LV_SYMBOL_EXTRA_CLOUD_DOWNLOAD    "\xef\x83\xAD"
-#define LV_SYMBOL_EXTRA_CLOUD_UPLOAD    "\xef\x83\xAE"
-#define LV_SYMBOL_EXTRA_USER_MD    "\xef\x83\xB0"
-#define LV_SYMBOL_EXTRA_STETHOSCOPE    "\xef\x83\xB1"
-#define LV_SYMBOL_EXTRA_SUITCASE    "\xef\x83\xB2"
-#define LV_SYMBOL_EXTRA_BELL    "\xef\x83\xB3"
-#define LV_SYMBOL_EXTRA_COFFEE    "\xef\x83\xB4"
-#define LV_SYMBOL_EXTRA_HOSPITAL    "\xef\x83\xB8"
-#define LV_SYMBOL_EXTRA_AMBULANCE    "\xef\x83\xB9"
-#define LV_SYMBOL_EXTRA_MEDKIT    "\xef\x83\xBA"
-#define LV_SYMBOL_EXTRA_FIGHTER_JET    "\xef\x83\xBB"
-#define LV_SYMBOL_EXTRA_BEER    "\xef\x83\xBC"
-#define LV_SYMBOL_EXTRA_H_SQUARE    "\xef\x83\xBD"
-#define LV_SYMBOL_EXTRA_PLUS_SQUARE    "\xef\x83\xBE"
-#define LV_SYMBOL_EXTRA_ANGLE_DOUBLE_LEFT    "\xef\x84\x80"
-#define LV_SYMBOL_EXTRA_ANGLE_DOUBLE_RIGHT    "\xef\x84\x81"
-#define LV_SYMBOL_EXTRA_ANGLE_DOUBLE_UP    "\xef\x84\x82"
-#define LV_SYMBOL_EXTRA_ANGLE_DOUBLE_DOWN    "\xef\x84\x83"
-#define LV_SYMBOL_EXTRA_ANGLE_LEFT    "\xef\x84\x84"
-#define LV_SYMBOL_EXTRA_ANGLE_RIGHT    "\xef\x84\x85"
-#define LV_SYMBOL_EXTRA_ANGLE_UP    "\xef\x84\x86"
-#define LV_SYMBOL_EXTRA_ANGLE_DOWN    "\xef\x84\x87"
-#define LV_SYMBOL_EXTRA_DESKTOP    "\xef\x84\x88"
-#define LV_SYMBOL_EXTRA_LAPTOP    "\xef\x84\x89"
-#define LV_SYMBOL_EXTRA_TABLET    "\xef\x84\x8A"
-#define LV_SYMBOL_EXTRA_MOBILE    "\xef\x84\x8B"
-#define LV_SYMBOL_EXTRA_QUOTE_LEFT    "\xef\x84\x8D"
-#define LV_SYMBOL_EXTRA_QUOTE_RIGHT    "\xef\x84\x8E"
-#define LV_SYMBOL_EXTRA_SPINNER    "\xef\x84\x90"
-#define LV_SYMBOL_EXTRA_CIRCLE    "\xef\x84\x91"
-#define LV_SYMBOL_EXTRA_SMILE    "\xef\x84\x98"
-#define LV_SYMBOL_EXTRA_FROWN    "\xef\x84\x99"
-#define LV_SYMBOL_EXTRA_MEH    "\xef\x84\x9A"
-#define LV_SYMBOL_EXTRA_GAMEPAD    "\xef\x84\x9B"
-#define LV_SYMBOL_EXTRA_KEYBOARD    "\xef\x84\x9C"
-#define LV_SYMBOL_EXTRA_FLAG_CHECKERED    "\xef\x84\x9E"
-#define LV_SYMBOL_EXTRA_TERMINAL    "\xef\x84\xA0"
-#define LV_SYMBOL_EXTRA_CODE    "\xef\x84\xA1"
-#define LV_SYMBOL_EXTRA_REPLY_ALL    "\xef\x84\xA2"
-#define LV_SYMBOL_EXTRA_LOCATION_ARROW    "\xef\x84\xA4"
-#define LV_SYMBOL_EXTRA_CROP    "\xef\x84\xA5"
-#define LV_SYMBOL_EXTRA_CODE_BRANCH    "\xef\x84\xA6"
-#define LV_SYMBOL_EXTRA_UNLINK    "\xef\x84\xA7"
-#define LV_SYMBOL_EXTRA_QUESTION    "\xef\x84\xA8"
-#define LV_SYMBOL_EXTRA_INFO    "\xef\x84\xA9"
-#define LV_SYMBOL_EXTRA_EXCLAMATION    "\xef\x84\xAA"
-#define LV_SYMBOL_EXTRA_SUPERSCRIPT    "\xef\x84\xAB"
-#define LV_SYMBOL_EXTRA_SUBSCRIPT    "\xef\x84\xAC"
-#define LV_SYMBOL_EXTRA_ERASER    "\xef\x84\xAD"
-#define LV_SYMBOL_EXTRA_PUZZLE_PIECE    "\xef\x84\xAE"
-#define LV_SYMBOL_EXTRA_MICROPHONE    "\xef\x84\xB0"
-#define LV_SYMBOL_EXTRA_MICROPHONE_SLASH    "\xef\x84\xB1"
-#define LV_SYMBOL_EXTRA_SHIELD    "\xef\x84\xB2"
-#define LV_SYMBOL_EXTRA_CALENDAR    "\xef\x84\xB3"
-#define LV_SYMBOL_EXTRA_FIRE_EXTINGUISHER    "\xef\x84\xB4"
-#define LV_SYMBOL_EXTRA_ROCKET    "\xef\x84\xB5"
-#define LV_SYMBOL_EXTRA_CHEVRON_CIRCLE_LEFT    "\xef\x84\xB7"
-#define LV_SYMBOL_EXTRA_CHEVRON_CIRCLE_RIGHT    "\xef\x84\xB8"
-#define LV_SYMBOL_EXTRA_CHEVRON_CIRCLE_UP    "\xef\x84\xB9"
-#define LV_SYMBOL_EXTRA_CHEVRON_CIRCLE_DOWN    "\xef\x84\xBA"
-#define LV_SYMBOL_EXTRA_ANCHOR    "\xef\x84\xBD"
-#define LV_SYMBOL_EXTRA_UNLOCK_ALT    "\xef\x84\xBE"
-#define LV_SYMBOL_EXTRA_BULLSEYE    "\xef\x85\x80"
-#define LV_SYMBOL_EXTRA_ELLIPSIS_H    "\xef\x85\x81"
-#define LV_SYMBOL_EXTRA_ELLIPSIS_V    "\xef\x85\x82"
-#define LV_SYMBOL_EXTRA_RSS_SQUARE    "\xef\x85\x83"
-#define LV_SYMBOL_EXTRA_PLAY_CIRCLE    "\xef\x85\x84"
-#define LV_SYMBOL_EXTRA_TICKET    "\xef\x85\x85"
-#define LV_SYMBOL_EXTRA_MINUS_SQUARE    "\xef\x85\x86"
-#define LV_SYMBOL_EXTRA_LEVEL_UP    "\xef\x85\x88"
-#define LV_SYMBOL_EXTRA_LEVEL_DOWN    "\xef\x85\x89"
-#define LV_SYMBOL_EXTRA_CHECK_SQUARE    "\xef\x85\x8A"
-#define LV_SYMBOL_EXTRA_PEN_SQUARE    "\xef\x85\x8B"
-#define LV_SYMBOL_EXTRA_EXTERNAL_LINK_SQUARE    "\xef\x85\x8C"
-#define LV_SYMBOL_EXTRA_SHARE_SQUARE    "\xef\x85\x8D"
-#define LV_SYMBOL_EXTRA_COMPASS    "\xef\x85\x8E"
-#define LV_SYMBOL_EXTRA_CARET_SQUARE_DOWN    "\xef\x85\x90"
-#define LV_SYMBOL_EXTRA_CARET_SQUARE_UP    "\xef\x85\x91"
-#define LV_SYMBOL_EXTRA_CARET_SQUARE_RIGHT    "\xef\x85\x92"
-#define LV_SYMBOL_EXTRA_EURO_SIGN    "\xef\x85\x93"
-#define LV_SYMBOL_EXTRA_POUND_SIGN    "\xef\x85\x94"
-#define LV_SYMBOL_EXTRA_DOLLAR_SIGN    "\xef\x85\x95"
-#define LV_SYMBOL_EXTRA_RUPEE_SIGN    "\xef\x85\x96"
-#define LV_SYMBOL_EXTRA_YEN_SIGN    "\xef\x85\x97"
-#define LV_SYMBOL_EXTRA_RUBLE_SIGN    "\xef\x85\x98"
-#define LV_SYMBOL_EXTRA_WON_SIGN    "\xef\x85\x99"
-#define LV_SYMBOL_EXTRA_FILE    "\xef\x85\x9B"
-#define LV_SYMBOL_EXTRA_FILE_ALT    "\xef\x85\x9C"
-#define LV_SYMBOL_EXTRA_SORT_ALPHA_DOWN    "\xef\x85\x9D"
-#define LV_SYMBOL_EXTRA_SORT_ALPHA_UP    "\xef\x85\x9E"
-#define LV_SYMBOL_EXTRA_SORT_AMOUNT_DOWN    "\xef\x85\xA0"
-#define LV_SYMBOL_EXTRA_SORT_AMOUNT_UP    "\xef\x85\xA1"
-#define LV_SYMBOL_EXTRA_SORT_NUMERIC_DOWN    "\xef\x85\xA2"
-#define LV_SYMBOL_EXTRA_SORT_NUMERIC_UP    "\xef\x85\xA3"
-#define LV_SYMBOL_EXTRA_THUMBS_UP    "\xef\x85\xA4"
-#define LV_SYMBOL_EXTRA_THUMBS_DOWN    "\xef\x85\xA5"
-#define LV_SYMBOL_EXTRA_LONG_ARROW_DOWN    "\xef\x85\xB5"
-#define LV_SYMBOL_EXTRA_LONG_ARROW_UP    "\xef\x85\xB6"
-#define LV_SYMBOL_EXTRA_LONG_ARROW_LEFT    "\xef\x85\xB7"
-#define LV_SYMBOL_EXTRA_LONG_ARROW_RIGHT    "\xef\x85\xB8"
-#define LV_SYMBOL_EXTRA_FEMALE    "\xef\x86\x82"
-#define LV_SYMBOL_EXTRA_MALE    "\xef\x86\x83"
-#define LV_SYMBOL_EXTRA_SUN    "\xef\x86\x85"
-#define LV_SYMBOL_EXTRA_MOON    "\xef\x86\x86"
-#define LV_SYMBOL_EXTRA_ARCHIVE    "\xef\x86\x87"
-#define LV_SYMBOL_EXTRA_BUG    "\xef\x86\x88"
-#define LV_SYMBOL_EXTRA_CARET_SQUARE_LEFT    "\xef\x86\x91"
-#define LV_SYMBOL_EXTRA_DOT_CIRCLE    "\xef\x86\x92"
-#define LV_SYMBOL_EXTRA_WHEELCHAIR    "\xef\x86\x93"
-#define LV_SYMBOL_EXTRA_LIRA_SIGN    "\xef\x86\x95"
-#define LV_SYMBOL_EXTRA_SPACE_SHUTTLE    "\xef\x86\x97"
-#define LV_SYMBOL_EXTRA_ENVELOPE_SQUARE    "\xef\x86\x99"
-#define LV_SYMBOL_EXTRA_UNIVERSITY    "\xef\x86\x9C"
-#define LV_SYMBOL_EXTRA_GRADUATION_CAP    "\xef\x86\x9D"
-#define LV_SYMBOL_EXTRA_LANGUAGE    "\xef\x86\xAB"
-#define LV_SYMBOL_EXTRA_FAX    "\xef\x86\xAC"
-#define LV_SYMBOL_EXTRA_BUILDING    "\xef\x86\xAD"
-#define LV_SYMBOL_EXTRA_CHILD    "\xef\x86\xAE"
-#define LV_SYMBOL_EXTRA_PAW    "\xef\x86\xB0"
-#define LV_SYMBOL_EXTRA_CUBE    "\xef\x86\xB2"
-#define LV_SYMBOL_EXTRA_CUBES    "\xef\x86\xB3"
-#define LV_SYMBOL_EXTRA_RECYCLE    "\xef\x86\xB8"
-#define LV_SYMBOL_EXTRA_CAR    "\xef\x86\xB9"
-#define LV_SYMBOL_EXTRA_TAXI    "\xef\x86\xBA"
-#define LV_SYMBOL_EXTRA_TREE    "\xef\x86\xBB"
-#define LV_SYMBOL_EXTRA_DATABASE    "\xef\x87\x80"
-#define LV_SYMBOL_EXTRA_FILE_PDF    "\xef\x87\x81"
-#define LV_SYMBOL_EXTRA_FILE_WORD    "\xef\x87\x82"
-#define LV_SYMBOL_EXTRA_FILE_EXCEL    "\xef\x87\x83"
-#define LV_SYMBOL_EXTRA_FILE_POWERPOINT    "\xef\x87\x84"
-#define LV_SYMBOL_EXTRA_FILE_IMAGE    "\xef\x87\x85"
-#define LV_SYMBOL_EXTRA_FILE_ARCHIVE    "\xef\x87\x86"
-#define LV_SYMBOL_EXTRA_FILE_AUDIO    "\xef\x87\x87"
-#define LV_SYMBOL_EXTRA_FILE_VIDEO    "\xef\x87\x88"
-#define LV_SYMBOL_EXTRA_FILE_CODE    "\xef\x87\x89"
-#define LV_SYMBOL_EXTRA_LIFE_RING    "\xef\x87\x8D"
-#define LV_SYMBOL_EXTRA_CIRCLE_NOTCH    "\xef\x87\x8E"
-#define LV_SYMBOL_EXTRA_PAPER_PLANE    "\xef\x87\x98"
-#define LV_SYMBOL_EXTRA_HISTORY    "\xef\x87\x9A"
-#define LV_SYMBOL_EXTRA_HEADING    "\xef\x87\x9C"
-#define LV_SYMBOL_EXTRA_PARAGRAPH    "\xef\x87\x9D"
-#define LV_SYMBOL_EXTRA_SLIDERS_H    "\xef\x87\x9E"
-#define LV_SYMBOL_EXTRA_SHARE_ALT    "\xef\x87\xA0"
-#define LV_SYMBOL_EXTRA_SHARE_ALT_SQUARE    "\xef\x87\xA1"
-#define LV_SYMBOL_EXTRA_BOMB    "\xef\x87\xA2"
-#define LV_SYMBOL_EXTRA_FUTBOL    "\xef\x87\xA3"
-#define LV_SYMBOL_EXTRA_TTY    "\xef\x87\xA4"
-#define LV_SYMBOL_EXTRA_BINOCULARS    "\xef\x87\xA5"
-#define LV_SYMBOL_EXTRA_PLUG    "\xef\x87\xA6"
-#define LV_SYMBOL_EXTRA_NEWSPAPER    "\xef\x87\xAA"
-#define LV_SYMBOL_EXTRA_WIFI    "\xef\x87\xAB"
-#define LV_SYMBOL_EXTRA_CALCULATOR    "\xef\x87\xAC"
-#define LV_SYMBOL_EXTRA_BELL_SLASH    "\xef\x87\xB6"
-#define LV_SYMBOL_EXTRA_TRASH    "\xef\x87\xB8"
-#define LV_SYMBOL_EXTRA_COPYRIGHT    "\xef\x87\xB9"
-#define LV_SYMBOL_EXTRA_AT    "\xef\x87\xBA"
-#define LV_SYMBOL_EXTRA_EYE_DROPPER    "\xef\x87\xBB"
-#define LV_SYMBOL_EXTRA_PAINT_BRUSH    "\xef\x87\xBC"
-#define LV_SYMBOL_EXTRA_BIRTHDAY_CAKE    "\xef\x87\xBD"
-#define LV_SYMBOL_EXTRA_CHART_AREA    "\xef\x87\xBE"
-#define LV_SYMBOL_EXTRA_CHART_PIE    "\xef\x88\x80"
-#define LV_SYMBOL_EXTRA_CHART_LINE    "\xef\x88\x81"
-#define LV_SYMBOL_EXTRA_TOGGLE_OFF    "\xef\x88\x84"
-#define LV_SYMBOL_EXTRA_TOGGLE_ON    "\xef\x88\x85"
-#define LV_SYMBOL_EXTRA_BICYCLE    "\xef\x88\x86"
-#define LV_SYMBOL_EXTRA_BUS    "\xef\x88\x87"
-#define LV_SYMBOL_EXTRA_CLOSED_CAPTIONING    "\xef\x88\x8A"
-#define LV_SYMBOL_EXTRA_SHEKEL_SIGN    "\xef\x88\x8B"
-#define LV_SYMBOL_EXTRA_CART_PLUS    "\xef\x88\x97"
-#define LV_SYMBOL_EXTRA_CART_ARROW_DOWN    "\xef\x88\x98"
-#define LV_SYMBOL_EXTRA_DIAMOND    "\xef\x88\x99"
-#define LV_SYMBOL_EXTRA_SHIP    "\xef\x88\x9A"
-#define LV_SYMBOL_EXTRA_USER_SECRET    "\xef\x88\x9B"
-#define LV_SYMBOL_EXTRA_MOTORCYCLE    "\xef\x88\x9C"
-#define LV_SYMBOL_EXTRA_STREET_VIEW    "\xef\x88\x9D"
-#define LV_SYMBOL_EXTRA_HEARTBEAT    "\xef\x88\x9E"
-#define LV_SYMBOL_EXTRA_VENUS    "\xef\x88\xA1"
-#define LV_SYMBOL_EXTRA_MARS    "\xef\x88\xA2"
-#define LV_SYMBOL_EXTRA_MERCURY    "\xef\x88\xA3"
-#define LV_SYMBOL_EXTRA_TRANSGENDER    "\xef\x88\xA4"
-#define LV_SYMBOL_EXTRA_TRANSGENDER_ALT    "\xef\x88\xA5"
-#define LV_SYMBOL_EXTRA_VENUS_DOUBLE    "\xef\x88\xA6"
-#define LV_SYMBOL_EXTRA_MARS_DOUBLE    "\xef\x88\xA7"
-#define LV_SYMBOL_EXTRA_VENUS_MARS    "\xef\x88\xA8"
-#define LV_SYMBOL_EXTRA_MARS_STROKE    "\xef\x88\xA9"
-#define LV_SYMBOL_EXTRA_MARS_STROKE_V    "\xef\x88\xAA"
-#define LV_SYMBOL_EXTRA_MARS_STROKE_H    "\xef\x88\xAB"
-#define LV_SYMBOL_EXTRA_NEUTER    "\xef\x88\xAC"
-#define LV_SYMBOL_EXTRA_GENDERLESS    "\xef\x88\xAD"
-#define LV_SYMBOL_EXTRA_SERVER    "\xef\x88\xB3"
-#define LV_SYMBOL_EXTRA_USER_PLUS    "\xef\x88\xB4"
-#define LV_SYMBOL_EXTRA_USER_TIMES    "\xef\x88\xB5"
-#define LV_SYMBOL_EXTRA_BED    "\xef\x88\xB6"
-#define LV_SYMBOL_EXTRA_TRAIN    "\xef\x88\xB8"
-#define LV_SYMBOL_EXTRA_SUBWAY    "\xef\x88\xB9"
-#define LV_SYMBOL_EXTRA_BATTERY_FULL    "\xef\x89\x80"
-#define LV_SYMBOL_EXTRA_BATTERY_THREE_QUARTERS    "\xef\x89\x81"
-#define LV_SYMBOL_EXTRA_BATTERY_HALF    "\xef\x89\x82"
-#define LV_SYMBOL_EXTRA_BATTERY_QUARTER    "\xef\x89\x83"
-#define LV_SYMBOL_EXTRA_BATTERY_EMPTY    "\xef\x89\x84"
-#define LV_SYMBOL_EXTRA_MOUSE_POINTER    "\xef\x89\x85"
-#define LV_SYMBOL_EXTRA_I_CURSOR    "\xef\x89\x86"
-#define LV_SYMBOL_EXTRA_OBJECT_GROUP    "\xef\x89\x87"
-#define LV_SYMBOL_EXTRA_OBJECT_UNGROUP    "\xef\x89\x88"
-#define LV_SYMBOL_EXTRA_STICKY_NOTE    "\xef\x89\x89"
-#define LV_SYMBOL_EXTRA_CLONE    "\xef\x89\x8D"
-#define LV_SYMBOL_EXTRA_BALANCE_SCALE    "\xef\x89\x8E"
-#define LV_SYMBOL_EXTRA_HOURGLASS_START    "\xef\x89\x91"
-#define LV_SYMBOL_EXTRA_HOURGLASS_HALF    "\xef\x89\x92"
-#define LV_SYMBOL_EXTRA_HOURGLASS_END    "\xef\x89\x93"
-#define LV_SYMBOL_EXTRA_HOURGLASS    "\xef\x89\x94"
-#define LV_SYMBOL_EXTRA_HAND_ROCK    "\xef\x89\x95"
-#define LV_SYMBOL_EXTRA_HAND_PAPER    "\xef\x89\x96"
-#define LV_SYMBOL_EXTRA_HAND_SCISSORS    "\xef\x89\x97"
-#define LV_SYMBOL_EXTRA_HAND_LIZARD    "\xef\x89\x98"
-#define LV_SYMBOL_EXTRA_HAND_SPOCK    "\xef\x89\x99"
-#define LV_SYMBOL_EXTRA_HAND_POINTER    "\xef\x89\x9A"
-#define LV_SYMBOL_EXTRA_HAND_PEACE    "\xef\x89\x9B"
-#define LV_SYMBOL_EXTRA_TRADEMARK    "\xef\x89\x9C"
-#define LV_SYMBOL_EXTRA_REGISTERED    "\xef\x89\x9D"
-#define LV_SYMBOL_EXTRA_TV    "\xef\x89\xAC"
-#define LV_SYMBOL_EXTRA_CALENDAR_PLUS    "\xef\x89\xB1"
-#define LV_SYMBOL_EXTRA_CALENDAR_MINUS    "\xef\x89\xB2"
-#define LV_SYMBOL_EXTRA_CALENDAR_TIMES    "\xef\x89\xB3"
-#define LV_SYMBOL_EXTRA_CALENDAR_CHECK    "\xef\x89\xB4"
-#define LV_SYMBOL_EXTRA_INDUSTRY    "\xef\x89\xB5"
-#define LV_SYMBOL_EXTRA_MAP_PIN    "\xef\x89\xB6"
-#define LV_SYMBOL_EXTRA_MAP_SIGNS    "\xef\x89\xB7"
-#define LV_SYMBOL_EXTRA_MAP    "\xef\x89\xB9"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT    "\xef\x89\xBA"
-#define LV_SYMBOL_EXTRA_PAUSE_CIRCLE    "\xef\x8A\x8B"
-#define LV_SYMBOL_EXTRA_STOP_CIRCLE    "\xef\x8A\x8D"
-#define LV_SYMBOL_EXTRA_SHOPPING_BAG    "\xef\x8A\x90"
-#define LV_SYMBOL_EXTRA_SHOPPING_BASKET    "\xef\x8A\x91"
-#define LV_SYMBOL_EXTRA_HASHTAG    "\xef\x8A\x92"
-#define LV_SYMBOL_EXTRA_PERCENT    "\xef\x8A\x95"
-#define LV_SYMBOL_EXTRA_UNIVERSAL_ACCESS    "\xef\x8A\x9A"
-#define LV_SYMBOL_EXTRA_BLIND    "\xef\x8A\x9D"
-#define LV_SYMBOL_EXTRA_AUDIO_DESCRIPTION    "\xef\x8A\x9E"
-#define LV_SYMBOL_EXTRA_PHONE_VOLUME    "\xef\x8A\xA0"
-#define LV_SYMBOL_EXTRA_BRAILLE    "\xef\x8A\xA1"
-#define LV_SYMBOL_EXTRA_ASSISTIVE_LISTENING_SYSTEMS    "\xef\x8A\xA2"
-#define LV_SYMBOL_EXTRA_AMERICAN_SIGN_LANGUAGE_INTERPRETING    "\xef\x8A\xA3"
-#define LV_SYMBOL_EXTRA_DEAF    "\xef\x8A\xA4"
-#define LV_SYMBOL_EXTRA_SIGN_LANGUAGE    "\xef\x8A\xA7"
-#define LV_SYMBOL_EXTRA_LOW_VISION    "\xef\x8A\xA8"
-#define LV_SYMBOL_EXTRA_HANDSHAKE    "\xef\x8A\xB5"
-#define LV_SYMBOL_EXTRA_ENVELOPE_OPEN    "\xef\x8A\xB6"
-#define LV_SYMBOL_EXTRA_ADDRESS_BOOK    "\xef\x8A\xB9"
-#define LV_SYMBOL_EXTRA_ADDRESS_CARD    "\xef\x8A\xBB"
-#define LV_SYMBOL_EXTRA_USER_CIRCLE    "\xef\x8A\xBD"
-#define LV_SYMBOL_EXTRA_ID_BADGE    "\xef\x8B\x81"
-#define LV_SYMBOL_EXTRA_ID_CARD    "\xef\x8B\x82"
-#define LV_SYMBOL_EXTRA_THERMOMETER_FULL    "\xef\x8B\x87"
-#define LV_SYMBOL_EXTRA_THERMOMETER_THREE_QUARTERS    "\xef\x8B\x88"
-#define LV_SYMBOL_EXTRA_THERMOMETER_HALF    "\xef\x8B\x89"
-#define LV_SYMBOL_EXTRA_THERMOMETER_QUARTER    "\xef\x8B\x8A"
-#define LV_SYMBOL_EXTRA_THERMOMETER_EMPTY    "\xef\x8B\x8B"
-#define LV_SYMBOL_EXTRA_SHOWER    "\xef\x8B\x8C"
-#define LV_SYMBOL_EXTRA_BATH    "\xef\x8B\x8D"
-#define LV_SYMBOL_EXTRA_PODCAST    "\xef\x8B\x8E"
-#define LV_SYMBOL_EXTRA_WINDOW_MAXIMIZE    "\xef\x8B\x90"
-#define LV_SYMBOL_EXTRA_WINDOW_MINIMIZE    "\xef\x8B\x91"
-#define LV_SYMBOL_EXTRA_WINDOW_RESTORE    "\xef\x8B\x92"
-#define LV_SYMBOL_EXTRA_TIMES_SQUARE    "\xef\x8B\x93"
-#define LV_SYMBOL_EXTRA_MICROCHIP    "\xef\x8B\x9B"
-#define LV_SYMBOL_EXTRA_SNOWFLAKE    "\xef\x8B\x9C"
-#define LV_SYMBOL_EXTRA_WATCH    "\xef\x8B\xA1"
-#define LV_SYMBOL_EXTRA_VOLUME_SLASH    "\xef\x8B\xA2"
-#define LV_SYMBOL_EXTRA_UTENSIL_FORK    "\xef\x8B\xA3"
-#define LV_SYMBOL_EXTRA_UTENSIL_KNIFE    "\xef\x8B\xA4"
-#define LV_SYMBOL_EXTRA_UTENSIL_SPOON    "\xef\x8B\xA5"
-#define LV_SYMBOL_EXTRA_UTENSILS_ALT    "\xef\x8B\xA6"
-#define LV_SYMBOL_EXTRA_UTENSILS    "\xef\x8B\xA7"
-#define LV_SYMBOL_EXTRA_USD_CIRCLE    "\xef\x8B\xA8"
-#define LV_SYMBOL_EXTRA_USD_SQUARE    "\xef\x8B\xA9"
-#define LV_SYMBOL_EXTRA_UNDO_ALT    "\xef\x8B\xAA"
-#define LV_SYMBOL_EXTRA_TROPHY_ALT    "\xef\x8B\xAB"
-#define LV_SYMBOL_EXTRA_TRIANGLE    "\xef\x8B\xAC"
-#define LV_SYMBOL_EXTRA_TRASH_ALT    "\xef\x8B\xAD"
-#define LV_SYMBOL_EXTRA_TIMES_HEXAGON    "\xef\x8B\xAE"
-#define LV_SYMBOL_EXTRA_TIMES_OCTAGON    "\xef\x8B\xB0"
-#define LV_SYMBOL_EXTRA_SYNC_ALT    "\xef\x8B\xB1"
-#define LV_SYMBOL_EXTRA_STOPWATCH    "\xef\x8B\xB2"
-#define LV_SYMBOL_EXTRA_STAR_EXCLAMATION    "\xef\x8B\xB3"
-#define LV_SYMBOL_EXTRA_SPADE    "\xef\x8B\xB4"
-#define LV_SYMBOL_EXTRA_SIGN_OUT_ALT    "\xef\x8B\xB5"
-#define LV_SYMBOL_EXTRA_SIGN_IN_ALT    "\xef\x8B\xB6"
-#define LV_SYMBOL_EXTRA_SHIELD_CHECK    "\xef\x8B\xB7"
-#define LV_SYMBOL_EXTRA_SCRUBBER    "\xef\x8B\xB8"
-#define LV_SYMBOL_EXTRA_REDO_ALT    "\xef\x8B\xB9"
-#define LV_SYMBOL_EXTRA_RECTANGLE_LANDSCAPE    "\xef\x8B\xBA"
-#define LV_SYMBOL_EXTRA_RECTANGLE_PORTRAIT    "\xef\x8B\xBB"
-#define LV_SYMBOL_EXTRA_RECTANGLE_WIDE    "\xef\x8B\xBC"
-#define LV_SYMBOL_EXTRA_QUESTION_SQUARE    "\xef\x8B\xBD"
-#define LV_SYMBOL_EXTRA_POO    "\xef\x8B\xBE"
-#define LV_SYMBOL_EXTRA_PLUS_HEXAGON    "\xef\x8C\x80"
-#define LV_SYMBOL_EXTRA_PLUS_OCTAGON    "\xef\x8C\x81"
-#define LV_SYMBOL_EXTRA_IMAGES    "\xef\x8C\x82"
-#define LV_SYMBOL_EXTRA_PENCIL_ALT    "\xef\x8C\x83"
-#define LV_SYMBOL_EXTRA_PEN    "\xef\x8C\x84"
-#define LV_SYMBOL_EXTRA_PEN_ALT    "\xef\x8C\x85"
-#define LV_SYMBOL_EXTRA_OCTAGON    "\xef\x8C\x86"
-#define LV_SYMBOL_EXTRA_MINUS_HEXAGON    "\xef\x8C\x87"
-#define LV_SYMBOL_EXTRA_MINUS_OCTAGON    "\xef\x8C\x88"
-#define LV_SYMBOL_EXTRA_LONG_ARROW_ALT_DOWN    "\xef\x8C\x89"
-#define LV_SYMBOL_EXTRA_LONG_ARROW_ALT_LEFT    "\xef\x8C\x8A"
-#define LV_SYMBOL_EXTRA_LONG_ARROW_ALT_RIGHT    "\xef\x8C\x8B"
-#define LV_SYMBOL_EXTRA_LONG_ARROW_ALT_UP    "\xef\x8C\x8C"
-#define LV_SYMBOL_EXTRA_LOCK_ALT    "\xef\x8C\x8D"
-#define LV_SYMBOL_EXTRA_JACK_O_LANTERN    "\xef\x8C\x8E"
-#define LV_SYMBOL_EXTRA_INFO_SQUARE    "\xef\x8C\x8F"
-#define LV_SYMBOL_EXTRA_INBOX_IN    "\xef\x8C\x90"
-#define LV_SYMBOL_EXTRA_INBOX_OUT    "\xef\x8C\x91"
-#define LV_SYMBOL_EXTRA_HEXAGON    "\xef\x8C\x92"
-#define LV_SYMBOL_EXTRA_H1    "\xef\x8C\x93"
-#define LV_SYMBOL_EXTRA_H2    "\xef\x8C\x94"
-#define LV_SYMBOL_EXTRA_H3    "\xef\x8C\x95"
-#define LV_SYMBOL_EXTRA_FILE_CHECK    "\xef\x8C\x96"
-#define LV_SYMBOL_EXTRA_FILE_TIMES    "\xef\x8C\x97"
-#define LV_SYMBOL_EXTRA_FILE_MINUS    "\xef\x8C\x98"
-#define LV_SYMBOL_EXTRA_FILE_PLUS    "\xef\x8C\x99"
-#define LV_SYMBOL_EXTRA_FILE_EXCLAMATION    "\xef\x8C\x9A"
-#define LV_SYMBOL_EXTRA_FILE_EDIT    "\xef\x8C\x9C"
-#define LV_SYMBOL_EXTRA_EXPAND_ARROWS    "\xef\x8C\x9D"
-#define LV_SYMBOL_EXTRA_EXPAND_ARROWS_ALT    "\xef\x8C\x9E"
-#define LV_SYMBOL_EXTRA_EXPAND_WIDE    "\xef\x8C\xA0"
-#define LV_SYMBOL_EXTRA_EXCLAMATION_SQUARE    "\xef\x8C\xA1"
-#define LV_SYMBOL_EXTRA_CHEVRON_DOUBLE_DOWN    "\xef\x8C\xA2"
-#define LV_SYMBOL_EXTRA_CHEVRON_DOUBLE_LEFT    "\xef\x8C\xA3"
-#define LV_SYMBOL_EXTRA_CHEVRON_DOUBLE_RIGHT    "\xef\x8C\xA4"
-#define LV_SYMBOL_EXTRA_CHEVRON_DOUBLE_UP    "\xef\x8C\xA5"
-#define LV_SYMBOL_EXTRA_COMPRESS_WIDE    "\xef\x8C\xA6"
-#define LV_SYMBOL_EXTRA_CLUB    "\xef\x8C\xA7"
-#define LV_SYMBOL_EXTRA_CLIPBOARD    "\xef\x8C\xA8"
-#define LV_SYMBOL_EXTRA_CHEVRON_SQUARE_DOWN    "\xef\x8C\xA9"
-#define LV_SYMBOL_EXTRA_CHEVRON_SQUARE_LEFT    "\xef\x8C\xAA"
-#define LV_SYMBOL_EXTRA_CHEVRON_SQUARE_RIGHT    "\xef\x8C\xAB"
-#define LV_SYMBOL_EXTRA_CHEVRON_SQUARE_UP    "\xef\x8C\xAC"
-#define LV_SYMBOL_EXTRA_CARET_CIRCLE_DOWN    "\xef\x8C\xAD"
-#define LV_SYMBOL_EXTRA_CARET_CIRCLE_LEFT    "\xef\x8C\xAE"
-#define LV_SYMBOL_EXTRA_CARET_CIRCLE_RIGHT    "\xef\x8C\xB0"
-#define LV_SYMBOL_EXTRA_CARET_CIRCLE_UP    "\xef\x8C\xB1"
-#define LV_SYMBOL_EXTRA_CAMERA_ALT    "\xef\x8C\xB2"
-#define LV_SYMBOL_EXTRA_CALENDAR_EDIT    "\xef\x8C\xB3"
-#define LV_SYMBOL_EXTRA_CALENDAR_EXCLAMATION    "\xef\x8C\xB4"
-#define LV_SYMBOL_EXTRA_BADGE    "\xef\x8C\xB5"
-#define LV_SYMBOL_EXTRA_BADGE_CHECK    "\xef\x8C\xB6"
-#define LV_SYMBOL_EXTRA_ARROWS_ALT_H    "\xef\x8C\xB7"
-#define LV_SYMBOL_EXTRA_ARROWS_ALT_V    "\xef\x8C\xB8"
-#define LV_SYMBOL_EXTRA_ARROW_SQUARE_DOWN    "\xef\x8C\xB9"
-#define LV_SYMBOL_EXTRA_ARROW_SQUARE_LEFT    "\xef\x8C\xBA"
-#define LV_SYMBOL_EXTRA_ARROW_SQUARE_RIGHT    "\xef\x8C\xBB"
-#define LV_SYMBOL_EXTRA_ARROW_SQUARE_UP    "\xef\x8C\xBC"
-#define LV_SYMBOL_EXTRA_ARROW_TO_BOTTOM    "\xef\x8C\xBD"
-#define LV_SYMBOL_EXTRA_ARROW_TO_LEFT    "\xef\x8C\xBE"
-#define LV_SYMBOL_EXTRA_ARROW_TO_RIGHT    "\xef\x8D\x80"
-#define LV_SYMBOL_EXTRA_ARROW_TO_TOP    "\xef\x8D\x81"
-#define LV_SYMBOL_EXTRA_ARROW_FROM_BOTTOM    "\xef\x8D\x82"
-#define LV_SYMBOL_EXTRA_ARROW_FROM_LEFT    "\xef\x8D\x83"
-#define LV_SYMBOL_EXTRA_ARROW_FROM_RIGHT    "\xef\x8D\x84"
-#define LV_SYMBOL_EXTRA_ARROW_FROM_TOP    "\xef\x8D\x85"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_FROM_BOTTOM    "\xef\x8D\x86"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_FROM_LEFT    "\xef\x8D\x87"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_FROM_RIGHT    "\xef\x8D\x88"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_FROM_TOP    "\xef\x8D\x89"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_TO_BOTTOM    "\xef\x8D\x8A"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_TO_LEFT    "\xef\x8D\x8B"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_TO_RIGHT    "\xef\x8D\x8C"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_TO_TOP    "\xef\x8D\x8D"
-#define LV_SYMBOL_EXTRA_ALARM_CLOCK    "\xef\x8D\x8E"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_SQUARE_DOWN    "\xef\x8D\x90"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_SQUARE_LEFT    "\xef\x8D\x91"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_SQUARE_RIGHT    "\xef\x8D\x92"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_SQUARE_UP    "\xef\x8D\x93"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_DOWN    "\xef\x8D\x94"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_LEFT    "\xef\x8D\x95"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_RIGHT    "\xef\x8D\x96"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_UP    "\xef\x8D\x97"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_CIRCLE_DOWN    "\xef\x8D\x98"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_CIRCLE_LEFT    "\xef\x8D\x99"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_CIRCLE_RIGHT    "\xef\x8D\x9A"
-#define LV_SYMBOL_EXTRA_ARROW_ALT_CIRCLE_UP    "\xef\x8D\x9B"
-#define LV_SYMBOL_EXTRA_EXTERNAL_LINK_ALT    "\xef\x8D\x9D"
-#define LV_SYMBOL_EXTRA_EXTERNAL_LINK_SQUARE_ALT    "\xef\x8D\xA0"
-#define LV_SYMBOL_EXTRA_RETWEET_ALT    "\xef\x8D\xA1"
-#define LV_SYMBOL_EXTRA_EXCHANGE_ALT    "\xef\x8D\xA2"
-#define LV_SYMBOL_EXTRA_REPEAT    "\xef\x8D\xA3"
-#define LV_SYMBOL_EXTRA_REPEAT_ALT    "\xef\x8D\xA4"
-#define LV_SYMBOL_EXTRA_REPEAT_1    "\xef\x8D\xA5"
-#define LV_SYMBOL_EXTRA_REPEAT_1_ALT    "\xef\x8D\xA6"
-#define LV_SYMBOL_EXTRA_SHARE_ALL    "\xef\x8D\xA7"
-#define LV_SYMBOL_EXTRA_BATTERY_BOLT    "\xef\x8D\xB6"
-#define LV_SYMBOL_EXTRA_BATTERY_SLASH    "\xef\x8D\xB7"
-#define LV_SYMBOL_EXTRA_BROWSER    "\xef\x8D\xBE"
-#define LV_SYMBOL_EXTRA_CLOUD_DOWNLOAD_ALT    "\xef\x8E\x81"
-#define LV_SYMBOL_EXTRA_CLOUD_UPLOAD_ALT    "\xef\x8E\x82"
-#define LV_SYMBOL_EXTRA_CODE_COMMIT    "\xef\x8E\x86"
-#define LV_SYMBOL_EXTRA_CODE_MERGE    "\xef\x8E\x87"
-#define LV_SYMBOL_EXTRA_CREDIT_CARD_BLANK    "\xef\x8E\x89"
-#define LV_SYMBOL_EXTRA_CREDIT_CARD_FRONT    "\xef\x8E\x8A"
-#define LV_SYMBOL_EXTRA_DESKTOP_ALT    "\xef\x8E\x90"
-#define LV_SYMBOL_EXTRA_ELLIPSIS_H_ALT    "\xef\x8E\x9B"
-#define LV_SYMBOL_EXTRA_ELLIPSIS_V_ALT    "\xef\x8E\x9C"
-#define LV_SYMBOL_EXTRA_FILM_ALT    "\xef\x8E\xA0"
-#define LV_SYMBOL_EXTRA_GEM    "\xef\x8E\xA5"
-#define LV_SYMBOL_EXTRA_INDUSTRY_ALT    "\xef\x8E\xB3"
-#define LV_SYMBOL_EXTRA_LEVEL_DOWN_ALT    "\xef\x8E\xBE"
-#define LV_SYMBOL_EXTRA_LEVEL_UP_ALT    "\xef\x8E\xBF"
-#define LV_SYMBOL_EXTRA_LOCK_OPEN    "\xef\x8F\x81"
-#define LV_SYMBOL_EXTRA_LOCK_OPEN_ALT    "\xef\x8F\x82"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_ALT    "\xef\x8F\x85"
-#define LV_SYMBOL_EXTRA_MICROPHONE_ALT    "\xef\x8F\x89"
-#define LV_SYMBOL_EXTRA_MOBILE_ALT    "\xef\x8F\x8D"
-#define LV_SYMBOL_EXTRA_MOBILE_ANDROID    "\xef\x8F\x8E"
-#define LV_SYMBOL_EXTRA_MOBILE_ANDROID_ALT    "\xef\x8F\x8F"
-#define LV_SYMBOL_EXTRA_MONEY_BILL_ALT    "\xef\x8F\x91"
-#define LV_SYMBOL_EXTRA_PHONE_SLASH    "\xef\x8F\x9D"
-#define LV_SYMBOL_EXTRA_PLANE_ALT    "\xef\x8F\x9E"
-#define LV_SYMBOL_EXTRA_PORTRAIT    "\xef\x8F\xA0"
-#define LV_SYMBOL_EXTRA_REPLY    "\xef\x8F\xA5"
-#define LV_SYMBOL_EXTRA_SHIELD_ALT    "\xef\x8F\xAD"
-#define LV_SYMBOL_EXTRA_SLIDERS_H_SQUARE    "\xef\x8F\xB0"
-#define LV_SYMBOL_EXTRA_SLIDERS_V    "\xef\x8F\xB1"
-#define LV_SYMBOL_EXTRA_SLIDERS_V_SQUARE    "\xef\x8F\xB2"
-#define LV_SYMBOL_EXTRA_SPINNER_THIRD    "\xef\x8F\xB4"
-#define LV_SYMBOL_EXTRA_TABLET_ALT    "\xef\x8F\xBA"
-#define LV_SYMBOL_EXTRA_TABLET_ANDROID    "\xef\x8F\xBB"
-#define LV_SYMBOL_EXTRA_TABLET_ANDROID_ALT    "\xef\x8F\xBC"
-#define LV_SYMBOL_EXTRA_TACHOMETER_ALT    "\xef\x8F\xBD"
-#define LV_SYMBOL_EXTRA_TICKET_ALT    "\xef\x8F\xBF"
-#define LV_SYMBOL_EXTRA_TREE_ALT    "\xef\x90\x80"
-#define LV_SYMBOL_EXTRA_TV_RETRO    "\xef\x90\x81"
-#define LV_SYMBOL_EXTRA_USER_ALT    "\xef\x90\x86"
-#define LV_SYMBOL_EXTRA_WINDOW    "\xef\x90\x8E"
-#define LV_SYMBOL_EXTRA_WINDOW_ALT    "\xef\x90\x8F"
-#define LV_SYMBOL_EXTRA_WINDOW_CLOSE    "\xef\x90\x90"
-#define LV_SYMBOL_EXTRA_COMPRESS_ALT    "\xef\x90\xA2"
-#define LV_SYMBOL_EXTRA_EXPAND_ALT    "\xef\x90\xA4"
-#define LV_SYMBOL_EXTRA_BASEBALL    "\xef\x90\xB2"
-#define LV_SYMBOL_EXTRA_BASEBALL_BALL    "\xef\x90\xB3"
-#define LV_SYMBOL_EXTRA_BASKETBALL_BALL    "\xef\x90\xB4"
-#define LV_SYMBOL_EXTRA_BASKETBALL_HOOP    "\xef\x90\xB5"
-#define LV_SYMBOL_EXTRA_BOWLING_BALL    "\xef\x90\xB6"
-#define LV_SYMBOL_EXTRA_BOWLING_PINS    "\xef\x90\xB7"
-#define LV_SYMBOL_EXTRA_BOXING_GLOVE    "\xef\x90\xB8"
-#define LV_SYMBOL_EXTRA_CHESS    "\xef\x90\xB9"
-#define LV_SYMBOL_EXTRA_CHESS_BISHOP    "\xef\x90\xBA"
-#define LV_SYMBOL_EXTRA_CHESS_BISHOP_ALT    "\xef\x90\xBB"
-#define LV_SYMBOL_EXTRA_CHESS_BOARD    "\xef\x90\xBC"
-#define LV_SYMBOL_EXTRA_CHESS_CLOCK    "\xef\x90\xBD"
-#define LV_SYMBOL_EXTRA_CHESS_CLOCK_ALT    "\xef\x90\xBE"
-#define LV_SYMBOL_EXTRA_CHESS_KING    "\xef\x90\xBF"
-#define LV_SYMBOL_EXTRA_CHESS_KING_ALT    "\xef\x91\x80"
-#define LV_SYMBOL_EXTRA_CHESS_KNIGHT    "\xef\x91\x81"
-#define LV_SYMBOL_EXTRA_CHESS_KNIGHT_ALT    "\xef\x91\x82"
-#define LV_SYMBOL_EXTRA_CHESS_PAWN    "\xef\x91\x83"
-#define LV_SYMBOL_EXTRA_CHESS_PAWN_ALT    "\xef\x91\x84"
-#define LV_SYMBOL_EXTRA_CHESS_QUEEN    "\xef\x91\x85"
-#define LV_SYMBOL_EXTRA_CHESS_QUEEN_ALT    "\xef\x91\x86"
-#define LV_SYMBOL_EXTRA_CHESS_ROOK    "\xef\x91\x87"
-#define LV_SYMBOL_EXTRA_CHESS_ROOK_ALT    "\xef\x91\x88"
-#define LV_SYMBOL_EXTRA_CRICKET    "\xef\x91\x89"
-#define LV_SYMBOL_EXTRA_CURLING    "\xef\x91\x8A"
-#define LV_SYMBOL_EXTRA_DUMBBELL    "\xef\x91\x8B"
-#define LV_SYMBOL_EXTRA_FIELD_HOCKEY    "\xef\x91\x8C"
-#define LV_SYMBOL_EXTRA_FOOTBALL_BALL    "\xef\x91\x8E"
-#define LV_SYMBOL_EXTRA_FOOTBALL_HELMET    "\xef\x91\x8F"
-#define LV_SYMBOL_EXTRA_GOLF_BALL    "\xef\x91\x90"
-#define LV_SYMBOL_EXTRA_GOLF_CLUB    "\xef\x91\x91"
-#define LV_SYMBOL_EXTRA_HOCKEY_PUCK    "\xef\x91\x93"
-#define LV_SYMBOL_EXTRA_HOCKEY_STICKS    "\xef\x91\x94"
-#define LV_SYMBOL_EXTRA_LUCHADOR    "\xef\x91\x95"
-#define LV_SYMBOL_EXTRA_PENNANT    "\xef\x91\x96"
-#define LV_SYMBOL_EXTRA_QUIDDITCH    "\xef\x91\x98"
-#define LV_SYMBOL_EXTRA_RACQUET    "\xef\x91\x9A"
-#define LV_SYMBOL_EXTRA_SHUTTLECOCK    "\xef\x91\x9B"
-#define LV_SYMBOL_EXTRA_SQUARE_FULL    "\xef\x91\x9C"
-#define LV_SYMBOL_EXTRA_TABLE_TENNIS    "\xef\x91\x9D"
-#define LV_SYMBOL_EXTRA_TENNIS_BALL    "\xef\x91\x9E"
-#define LV_SYMBOL_EXTRA_VOLLEYBALL_BALL    "\xef\x91\x9F"
-#define LV_SYMBOL_EXTRA_WHISTLE    "\xef\x91\xA0"
-#define LV_SYMBOL_EXTRA_ALLERGIES    "\xef\x91\xA1"
-#define LV_SYMBOL_EXTRA_BAND_AID    "\xef\x91\xA2"
-#define LV_SYMBOL_EXTRA_BARCODE_ALT    "\xef\x91\xA3"
-#define LV_SYMBOL_EXTRA_BARCODE_READ    "\xef\x91\xA4"
-#define LV_SYMBOL_EXTRA_BARCODE_SCAN    "\xef\x91\xA5"
-#define LV_SYMBOL_EXTRA_BOX    "\xef\x91\xA6"
-#define LV_SYMBOL_EXTRA_BOX_CHECK    "\xef\x91\xA7"
-#define LV_SYMBOL_EXTRA_BOXES    "\xef\x91\xA8"
-#define LV_SYMBOL_EXTRA_BRIEFCASE_MEDICAL    "\xef\x91\xA9"
-#define LV_SYMBOL_EXTRA_BURN    "\xef\x91\xAA"
-#define LV_SYMBOL_EXTRA_CAPSULES    "\xef\x91\xAB"
-#define LV_SYMBOL_EXTRA_CLIPBOARD_CHECK    "\xef\x91\xAC"
-#define LV_SYMBOL_EXTRA_CLIPBOARD_LIST    "\xef\x91\xAD"
-#define LV_SYMBOL_EXTRA_CONVEYOR_BELT    "\xef\x91\xAE"
-#define LV_SYMBOL_EXTRA_CONVEYOR_BELT_ALT    "\xef\x91\xAF"
-#define LV_SYMBOL_EXTRA_DIAGNOSES    "\xef\x91\xB0"
-#define LV_SYMBOL_EXTRA_DNA    "\xef\x91\xB1"
-#define LV_SYMBOL_EXTRA_DOLLY    "\xef\x91\xB2"
-#define LV_SYMBOL_EXTRA_DOLLY_EMPTY    "\xef\x91\xB3"
-#define LV_SYMBOL_EXTRA_DOLLY_FLATBED    "\xef\x91\xB4"
-#define LV_SYMBOL_EXTRA_DOLLY_FLATBED_ALT    "\xef\x91\xB5"
-#define LV_SYMBOL_EXTRA_DOLLY_FLATBED_EMPTY    "\xef\x91\xB6"
-#define LV_SYMBOL_EXTRA_FILE_MEDICAL    "\xef\x91\xB7"
-#define LV_SYMBOL_EXTRA_FILE_MEDICAL_ALT    "\xef\x91\xB8"
-#define LV_SYMBOL_EXTRA_FIRST_AID    "\xef\x91\xB9"
-#define LV_SYMBOL_EXTRA_FORKLIFT    "\xef\x91\xBA"
-#define LV_SYMBOL_EXTRA_HAND_HOLDING_BOX    "\xef\x91\xBB"
-#define LV_SYMBOL_EXTRA_HAND_RECEIVING    "\xef\x91\xBC"
-#define LV_SYMBOL_EXTRA_HOSPITAL_ALT    "\xef\x91\xBD"
-#define LV_SYMBOL_EXTRA_HOSPITAL_SYMBOL    "\xef\x91\xBE"
-#define LV_SYMBOL_EXTRA_ID_CARD_ALT    "\xef\x91\xBF"
-#define LV_SYMBOL_EXTRA_INVENTORY    "\xef\x92\x80"
-#define LV_SYMBOL_EXTRA_NOTES_MEDICAL    "\xef\x92\x81"
-#define LV_SYMBOL_EXTRA_PALLET    "\xef\x92\x82"
-#define LV_SYMBOL_EXTRA_PALLET_ALT    "\xef\x92\x83"
-#define LV_SYMBOL_EXTRA_PILLS    "\xef\x92\x84"
-#define LV_SYMBOL_EXTRA_PRESCRIPTION_BOTTLE    "\xef\x92\x85"
-#define LV_SYMBOL_EXTRA_PRESCRIPTION_BOTTLE_ALT    "\xef\x92\x86"
-#define LV_SYMBOL_EXTRA_PROCEDURES    "\xef\x92\x87"
-#define LV_SYMBOL_EXTRA_SCANNER    "\xef\x92\x88"
-#define LV_SYMBOL_EXTRA_SCANNER_KEYBOARD    "\xef\x92\x89"
-#define LV_SYMBOL_EXTRA_SCANNER_TOUCHSCREEN    "\xef\x92\x8A"
-#define LV_SYMBOL_EXTRA_SHIPPING_FAST    "\xef\x92\x8B"
-#define LV_SYMBOL_EXTRA_SHIPPING_TIMED    "\xef\x92\x8C"
-#define LV_SYMBOL_EXTRA_SMOKING    "\xef\x92\x8D"
-#define LV_SYMBOL_EXTRA_SYRINGE    "\xef\x92\x8E"
-#define LV_SYMBOL_EXTRA_TABLET_RUGGED    "\xef\x92\x8F"
-#define LV_SYMBOL_EXTRA_TABLETS    "\xef\x92\x90"
-#define LV_SYMBOL_EXTRA_THERMOMETER    "\xef\x92\x91"
-#define LV_SYMBOL_EXTRA_VIAL    "\xef\x92\x92"
-#define LV_SYMBOL_EXTRA_VIALS    "\xef\x92\x93"
-#define LV_SYMBOL_EXTRA_WAREHOUSE    "\xef\x92\x94"
-#define LV_SYMBOL_EXTRA_WAREHOUSE_ALT    "\xef\x92\x95"
-#define LV_SYMBOL_EXTRA_WEIGHT    "\xef\x92\x96"
-#define LV_SYMBOL_EXTRA_X_RAY    "\xef\x92\x97"
-#define LV_SYMBOL_EXTRA_BLANKET    "\xef\x92\x98"
-#define LV_SYMBOL_EXTRA_BOOK_HEART    "\xef\x92\x99"
-#define LV_SYMBOL_EXTRA_BOX_ALT    "\xef\x92\x9A"
-#define LV_SYMBOL_EXTRA_BOX_FRAGILE    "\xef\x92\x9B"
-#define LV_SYMBOL_EXTRA_BOX_FULL    "\xef\x92\x9C"
-#define LV_SYMBOL_EXTRA_BOX_HEART    "\xef\x92\x9D"
-#define LV_SYMBOL_EXTRA_BOX_OPEN    "\xef\x92\x9E"
-#define LV_SYMBOL_EXTRA_BOX_UP    "\xef\x92\x9F"
-#define LV_SYMBOL_EXTRA_BOX_USD    "\xef\x92\xA0"
-#define LV_SYMBOL_EXTRA_BOXES_ALT    "\xef\x92\xA1"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_CHECK    "\xef\x92\xA2"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_DOTS    "\xef\x92\xA3"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_EDIT    "\xef\x92\xA4"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_EXCLAMATION    "\xef\x92\xA5"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_LINES    "\xef\x92\xA6"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_MINUS    "\xef\x92\xA7"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_PLUS    "\xef\x92\xA8"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_SLASH    "\xef\x92\xA9"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_SMILE    "\xef\x92\xAA"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_TIMES    "\xef\x92\xAB"
-#define LV_SYMBOL_EXTRA_COMMENT_CHECK    "\xef\x92\xAC"
-#define LV_SYMBOL_EXTRA_COMMENT_DOTS    "\xef\x92\xAD"
-#define LV_SYMBOL_EXTRA_COMMENT_EDIT    "\xef\x92\xAE"
-#define LV_SYMBOL_EXTRA_COMMENT_EXCLAMATION    "\xef\x92\xAF"
-#define LV_SYMBOL_EXTRA_COMMENT_LINES    "\xef\x92\xB0"
-#define LV_SYMBOL_EXTRA_COMMENT_MINUS    "\xef\x92\xB1"
-#define LV_SYMBOL_EXTRA_COMMENT_PLUS    "\xef\x92\xB2"
-#define LV_SYMBOL_EXTRA_COMMENT_SLASH    "\xef\x92\xB3"
-#define LV_SYMBOL_EXTRA_COMMENT_SMILE    "\xef\x92\xB4"
-#define LV_SYMBOL_EXTRA_COMMENT_TIMES    "\xef\x92\xB5"
-#define LV_SYMBOL_EXTRA_COMMENTS_ALT    "\xef\x92\xB6"
-#define LV_SYMBOL_EXTRA_CONTAINER_STORAGE    "\xef\x92\xB7"
-#define LV_SYMBOL_EXTRA_COUCH    "\xef\x92\xB8"
-#define LV_SYMBOL_EXTRA_DONATE    "\xef\x92\xB9"
-#define LV_SYMBOL_EXTRA_DOVE    "\xef\x92\xBA"
-#define LV_SYMBOL_EXTRA_FRAGILE    "\xef\x92\xBB"
-#define LV_SYMBOL_EXTRA_HAND_HEART    "\xef\x92\xBC"
-#define LV_SYMBOL_EXTRA_HAND_HOLDING    "\xef\x92\xBD"
-#define LV_SYMBOL_EXTRA_HAND_HOLDING_HEART    "\xef\x92\xBE"
-#define LV_SYMBOL_EXTRA_HAND_HOLDING_SEEDLING    "\xef\x92\xBF"
-#define LV_SYMBOL_EXTRA_HAND_HOLDING_USD    "\xef\x93\x80"
-#define LV_SYMBOL_EXTRA_HAND_HOLDING_WATER    "\xef\x93\x81"
-#define LV_SYMBOL_EXTRA_HANDS    "\xef\x93\x82"
-#define LV_SYMBOL_EXTRA_HANDS_HEART    "\xef\x93\x83"
-#define LV_SYMBOL_EXTRA_HANDS_HELPING    "\xef\x93\x84"
-#define LV_SYMBOL_EXTRA_HANDS_USD    "\xef\x93\x85"
-#define LV_SYMBOL_EXTRA_HANDSHAKE_ALT    "\xef\x93\x86"
-#define LV_SYMBOL_EXTRA_HEART_CIRCLE    "\xef\x93\x87"
-#define LV_SYMBOL_EXTRA_HEART_SQUARE    "\xef\x93\x88"
-#define LV_SYMBOL_EXTRA_HOME_HEART    "\xef\x93\x89"
-#define LV_SYMBOL_EXTRA_LAMP    "\xef\x93\x8A"
-#define LV_SYMBOL_EXTRA_LEAF_HEART    "\xef\x93\x8B"
-#define LV_SYMBOL_EXTRA_LOVESEAT    "\xef\x93\x8C"
-#define LV_SYMBOL_EXTRA_PARACHUTE_BOX    "\xef\x93\x8D"
-#define LV_SYMBOL_EXTRA_PEOPLE_CARRY    "\xef\x93\x8E"
-#define LV_SYMBOL_EXTRA_PERSON_CARRY    "\xef\x93\x8F"
-#define LV_SYMBOL_EXTRA_PERSON_DOLLY    "\xef\x93\x90"
-#define LV_SYMBOL_EXTRA_PERSON_DOLLY_EMPTY    "\xef\x93\x91"
-#define LV_SYMBOL_EXTRA_PHONE_PLUS    "\xef\x93\x92"
-#define LV_SYMBOL_EXTRA_PIGGY_BANK    "\xef\x93\x93"
-#define LV_SYMBOL_EXTRA_RAMP_LOADING    "\xef\x93\x94"
-#define LV_SYMBOL_EXTRA_RIBBON    "\xef\x93\x96"
-#define LV_SYMBOL_EXTRA_ROUTE    "\xef\x93\x97"
-#define LV_SYMBOL_EXTRA_SEEDLING    "\xef\x93\x98"
-#define LV_SYMBOL_EXTRA_SIGN    "\xef\x93\x99"
-#define LV_SYMBOL_EXTRA_SMILE_WINK    "\xef\x93\x9A"
-#define LV_SYMBOL_EXTRA_TAPE    "\xef\x93\x9B"
-#define LV_SYMBOL_EXTRA_TRUCK_CONTAINER    "\xef\x93\x9C"
-#define LV_SYMBOL_EXTRA_TRUCK_COUCH    "\xef\x93\x9D"
-#define LV_SYMBOL_EXTRA_TRUCK_LOADING    "\xef\x93\x9E"
-#define LV_SYMBOL_EXTRA_TRUCK_MOVING    "\xef\x93\x9F"
-#define LV_SYMBOL_EXTRA_TRUCK_RAMP    "\xef\x93\xA0"
-#define LV_SYMBOL_EXTRA_VIDEO_PLUS    "\xef\x93\xA1"
-#define LV_SYMBOL_EXTRA_VIDEO_SLASH    "\xef\x93\xA2"
-#define LV_SYMBOL_EXTRA_WINE_GLASS    "\xef\x93\xA3"
-#define LV_SYMBOL_EXTRA_FONT_AWESOME_LOGO_FULL    "\xef\x93\xA6"
-#define LV_SYMBOL_EXTRA_USER_ALT_SLASH    "\xef\x93\xBA"
-#define LV_SYMBOL_EXTRA_USER_ASTRONAUT    "\xef\x93\xBB"
-#define LV_SYMBOL_EXTRA_USER_CHECK    "\xef\x93\xBC"
-#define LV_SYMBOL_EXTRA_USER_CLOCK    "\xef\x93\xBD"
-#define LV_SYMBOL_EXTRA_USER_COG    "\xef\x93\xBE"
-#define LV_SYMBOL_EXTRA_USER_EDIT    "\xef\x93\xBF"
-#define LV_SYMBOL_EXTRA_USER_FRIENDS    "\xef\x94\x80"
-#define LV_SYMBOL_EXTRA_USER_GRADUATE    "\xef\x94\x81"
-#define LV_SYMBOL_EXTRA_USER_LOCK    "\xef\x94\x82"
-#define LV_SYMBOL_EXTRA_USER_MINUS    "\xef\x94\x83"
-#define LV_SYMBOL_EXTRA_USER_NINJA    "\xef\x94\x84"
-#define LV_SYMBOL_EXTRA_USER_SHIELD    "\xef\x94\x85"
-#define LV_SYMBOL_EXTRA_USER_SLASH    "\xef\x94\x86"
-#define LV_SYMBOL_EXTRA_USER_TAG    "\xef\x94\x87"
-#define LV_SYMBOL_EXTRA_USER_TIE    "\xef\x94\x88"
-#define LV_SYMBOL_EXTRA_USERS_COG    "\xef\x94\x89"
-#define LV_SYMBOL_EXTRA_BALANCE_SCALE_LEFT    "\xef\x94\x95"
-#define LV_SYMBOL_EXTRA_BALANCE_SCALE_RIGHT    "\xef\x94\x96"
-#define LV_SYMBOL_EXTRA_BLENDER    "\xef\x94\x97"
-#define LV_SYMBOL_EXTRA_BOOK_OPEN    "\xef\x94\x98"
-#define LV_SYMBOL_EXTRA_BROADCAST_TOWER    "\xef\x94\x99"
-#define LV_SYMBOL_EXTRA_BROOM    "\xef\x94\x9A"
-#define LV_SYMBOL_EXTRA_CHALKBOARD    "\xef\x94\x9B"
-#define LV_SYMBOL_EXTRA_CHALKBOARD_TEACHER    "\xef\x94\x9C"
-#define LV_SYMBOL_EXTRA_CHURCH    "\xef\x94\x9D"
-#define LV_SYMBOL_EXTRA_COINS    "\xef\x94\x9E"
-#define LV_SYMBOL_EXTRA_COMPACT_DISC    "\xef\x94\x9F"
-#define LV_SYMBOL_EXTRA_CROW    "\xef\x94\xA0"
-#define LV_SYMBOL_EXTRA_CROWN    "\xef\x94\xA1"
-#define LV_SYMBOL_EXTRA_DICE    "\xef\x94\xA2"
-#define LV_SYMBOL_EXTRA_DICE_FIVE    "\xef\x94\xA3"
-#define LV_SYMBOL_EXTRA_DICE_FOUR    "\xef\x94\xA4"
-#define LV_SYMBOL_EXTRA_DICE_ONE    "\xef\x94\xA5"
-#define LV_SYMBOL_EXTRA_DICE_SIX    "\xef\x94\xA6"
-#define LV_SYMBOL_EXTRA_DICE_THREE    "\xef\x94\xA7"
-#define LV_SYMBOL_EXTRA_DICE_TWO    "\xef\x94\xA8"
-#define LV_SYMBOL_EXTRA_DIVIDE    "\xef\x94\xA9"
-#define LV_SYMBOL_EXTRA_DOOR_CLOSED    "\xef\x94\xAA"
-#define LV_SYMBOL_EXTRA_DOOR_OPEN    "\xef\x94\xAB"
-#define LV_SYMBOL_EXTRA_EQUALS    "\xef\x94\xAC"
-#define LV_SYMBOL_EXTRA_FEATHER    "\xef\x94\xAD"
-#define LV_SYMBOL_EXTRA_FROG    "\xef\x94\xAE"
-#define LV_SYMBOL_EXTRA_GAS_PUMP    "\xef\x94\xAF"
-#define LV_SYMBOL_EXTRA_GLASSES    "\xef\x94\xB0"
-#define LV_SYMBOL_EXTRA_GREATER_THAN    "\xef\x94\xB1"
-#define LV_SYMBOL_EXTRA_GREATER_THAN_EQUAL    "\xef\x94\xB2"
-#define LV_SYMBOL_EXTRA_HELICOPTER    "\xef\x94\xB3"
-#define LV_SYMBOL_EXTRA_INFINITY    "\xef\x94\xB4"
-#define LV_SYMBOL_EXTRA_KIWI_BIRD    "\xef\x94\xB5"
-#define LV_SYMBOL_EXTRA_LESS_THAN    "\xef\x94\xB6"
-#define LV_SYMBOL_EXTRA_LESS_THAN_EQUAL    "\xef\x94\xB7"
-#define LV_SYMBOL_EXTRA_MEMORY    "\xef\x94\xB8"
-#define LV_SYMBOL_EXTRA_MICROPHONE_ALT_SLASH    "\xef\x94\xB9"
-#define LV_SYMBOL_EXTRA_MONEY_BILL_WAVE    "\xef\x94\xBA"
-#define LV_SYMBOL_EXTRA_MONEY_BILL_WAVE_ALT    "\xef\x94\xBB"
-#define LV_SYMBOL_EXTRA_MONEY_CHECK    "\xef\x94\xBC"
-#define LV_SYMBOL_EXTRA_MONEY_CHECK_ALT    "\xef\x94\xBD"
-#define LV_SYMBOL_EXTRA_NOT_EQUAL    "\xef\x94\xBE"
-#define LV_SYMBOL_EXTRA_PALETTE    "\xef\x94\xBF"
-#define LV_SYMBOL_EXTRA_PARKING    "\xef\x95\x80"
-#define LV_SYMBOL_EXTRA_PERCENTAGE    "\xef\x95\x81"
-#define LV_SYMBOL_EXTRA_PROJECT_DIAGRAM    "\xef\x95\x82"
-#define LV_SYMBOL_EXTRA_RECEIPT    "\xef\x95\x83"
-#define LV_SYMBOL_EXTRA_ROBOT    "\xef\x95\x84"
-#define LV_SYMBOL_EXTRA_RULER    "\xef\x95\x85"
-#define LV_SYMBOL_EXTRA_RULER_COMBINED    "\xef\x95\x86"
-#define LV_SYMBOL_EXTRA_RULER_HORIZONTAL    "\xef\x95\x87"
-#define LV_SYMBOL_EXTRA_RULER_VERTICAL    "\xef\x95\x88"
-#define LV_SYMBOL_EXTRA_SCHOOL    "\xef\x95\x89"
-#define LV_SYMBOL_EXTRA_SCREWDRIVER    "\xef\x95\x8A"
-#define LV_SYMBOL_EXTRA_SHOE_PRINTS    "\xef\x95\x8B"
-#define LV_SYMBOL_EXTRA_SKULL    "\xef\x95\x8C"
-#define LV_SYMBOL_EXTRA_SMOKING_BAN    "\xef\x95\x8D"
-#define LV_SYMBOL_EXTRA_STORE    "\xef\x95\x8E"
-#define LV_SYMBOL_EXTRA_STORE_ALT    "\xef\x95\x8F"
-#define LV_SYMBOL_EXTRA_STREAM    "\xef\x95\x90"
-#define LV_SYMBOL_EXTRA_STROOPWAFEL    "\xef\x95\x91"
-#define LV_SYMBOL_EXTRA_TOOLBOX    "\xef\x95\x92"
-#define LV_SYMBOL_EXTRA_TSHIRT    "\xef\x95\x93"
-#define LV_SYMBOL_EXTRA_WALKING    "\xef\x95\x94"
-#define LV_SYMBOL_EXTRA_WALLET    "\xef\x95\x95"
-#define LV_SYMBOL_EXTRA_ANGRY    "\xef\x95\x96"
-#define LV_SYMBOL_EXTRA_ARCHWAY    "\xef\x95\x97"
-#define LV_SYMBOL_EXTRA_ATLAS    "\xef\x95\x98"
-#define LV_SYMBOL_EXTRA_AWARD    "\xef\x95\x99"
-#define LV_SYMBOL_EXTRA_BACKSPACE    "\xef\x95\x9A"
-#define LV_SYMBOL_EXTRA_BEZIER_CURVE    "\xef\x95\x9B"
-#define LV_SYMBOL_EXTRA_BONG    "\xef\x95\x9C"
-#define LV_SYMBOL_EXTRA_BRUSH    "\xef\x95\x9D"
-#define LV_SYMBOL_EXTRA_BUS_ALT    "\xef\x95\x9E"
-#define LV_SYMBOL_EXTRA_CANNABIS    "\xef\x95\x9F"
-#define LV_SYMBOL_EXTRA_CHECK_DOUBLE    "\xef\x95\xA0"
-#define LV_SYMBOL_EXTRA_COCKTAIL    "\xef\x95\xA1"
-#define LV_SYMBOL_EXTRA_CONCIERGE_BELL    "\xef\x95\xA2"
-#define LV_SYMBOL_EXTRA_COOKIE    "\xef\x95\xA3"
-#define LV_SYMBOL_EXTRA_COOKIE_BITE    "\xef\x95\xA4"
-#define LV_SYMBOL_EXTRA_CROP_ALT    "\xef\x95\xA5"
-#define LV_SYMBOL_EXTRA_DIGITAL_TACHOGRAPH    "\xef\x95\xA6"
-#define LV_SYMBOL_EXTRA_DIZZY    "\xef\x95\xA7"
-#define LV_SYMBOL_EXTRA_DRAFTING_COMPASS    "\xef\x95\xA8"
-#define LV_SYMBOL_EXTRA_DRUM    "\xef\x95\xA9"
-#define LV_SYMBOL_EXTRA_DRUM_STEELPAN    "\xef\x95\xAA"
-#define LV_SYMBOL_EXTRA_FEATHER_ALT    "\xef\x95\xAB"
-#define LV_SYMBOL_EXTRA_FILE_CONTRACT    "\xef\x95\xAC"
-#define LV_SYMBOL_EXTRA_FILE_DOWNLOAD    "\xef\x95\xAD"
-#define LV_SYMBOL_EXTRA_FILE_EXPORT    "\xef\x95\xAE"
-#define LV_SYMBOL_EXTRA_FILE_IMPORT    "\xef\x95\xAF"
-#define LV_SYMBOL_EXTRA_FILE_INVOICE    "\xef\x95\xB0"
-#define LV_SYMBOL_EXTRA_FILE_INVOICE_DOLLAR    "\xef\x95\xB1"
-#define LV_SYMBOL_EXTRA_FILE_PRESCRIPTION    "\xef\x95\xB2"
-#define LV_SYMBOL_EXTRA_FILE_SIGNATURE    "\xef\x95\xB3"
-#define LV_SYMBOL_EXTRA_FILE_UPLOAD    "\xef\x95\xB4"
-#define LV_SYMBOL_EXTRA_FILL    "\xef\x95\xB5"
-#define LV_SYMBOL_EXTRA_FILL_DRIP    "\xef\x95\xB6"
-#define LV_SYMBOL_EXTRA_FINGERPRINT    "\xef\x95\xB7"
-#define LV_SYMBOL_EXTRA_FISH    "\xef\x95\xB8"
-#define LV_SYMBOL_EXTRA_FLUSHED    "\xef\x95\xB9"
-#define LV_SYMBOL_EXTRA_FROWN_OPEN    "\xef\x95\xBA"
-#define LV_SYMBOL_EXTRA_GLASS_MARTINI_ALT    "\xef\x95\xBB"
-#define LV_SYMBOL_EXTRA_GLOBE_AFRICA    "\xef\x95\xBC"
-#define LV_SYMBOL_EXTRA_GLOBE_AMERICAS    "\xef\x95\xBD"
-#define LV_SYMBOL_EXTRA_GLOBE_ASIA    "\xef\x95\xBE"
-#define LV_SYMBOL_EXTRA_GRIMACE    "\xef\x95\xBF"
-#define LV_SYMBOL_EXTRA_GRIN    "\xef\x96\x80"
-#define LV_SYMBOL_EXTRA_GRIN_ALT    "\xef\x96\x81"
-#define LV_SYMBOL_EXTRA_GRIN_BEAM    "\xef\x96\x82"
-#define LV_SYMBOL_EXTRA_GRIN_BEAM_SWEAT    "\xef\x96\x83"
-#define LV_SYMBOL_EXTRA_GRIN_HEARTS    "\xef\x96\x84"
-#define LV_SYMBOL_EXTRA_GRIN_SQUINT    "\xef\x96\x85"
-#define LV_SYMBOL_EXTRA_GRIN_SQUINT_TEARS    "\xef\x96\x86"
-#define LV_SYMBOL_EXTRA_GRIN_STARS    "\xef\x96\x87"
-#define LV_SYMBOL_EXTRA_GRIN_TEARS    "\xef\x96\x88"
-#define LV_SYMBOL_EXTRA_GRIN_TONGUE    "\xef\x96\x89"
-#define LV_SYMBOL_EXTRA_GRIN_TONGUE_SQUINT    "\xef\x96\x8A"
-#define LV_SYMBOL_EXTRA_GRIN_TONGUE_WINK    "\xef\x96\x8B"
-#define LV_SYMBOL_EXTRA_GRIN_WINK    "\xef\x96\x8C"
-#define LV_SYMBOL_EXTRA_GRIP_HORIZONTAL    "\xef\x96\x8D"
-#define LV_SYMBOL_EXTRA_GRIP_VERTICAL    "\xef\x96\x8E"
-#define LV_SYMBOL_EXTRA_HEADPHONES_ALT    "\xef\x96\x8F"
-#define LV_SYMBOL_EXTRA_HEADSET    "\xef\x96\x90"
-#define LV_SYMBOL_EXTRA_HIGHLIGHTER    "\xef\x96\x91"
-#define LV_SYMBOL_EXTRA_HOT_TUB    "\xef\x96\x93"
-#define LV_SYMBOL_EXTRA_HOTEL    "\xef\x96\x94"
-#define LV_SYMBOL_EXTRA_JOINT    "\xef\x96\x95"
-#define LV_SYMBOL_EXTRA_KISS    "\xef\x96\x96"
-#define LV_SYMBOL_EXTRA_KISS_BEAM    "\xef\x96\x97"
-#define LV_SYMBOL_EXTRA_KISS_WINK_HEART    "\xef\x96\x98"
-#define LV_SYMBOL_EXTRA_LAUGH    "\xef\x96\x99"
-#define LV_SYMBOL_EXTRA_LAUGH_BEAM    "\xef\x96\x9A"
-#define LV_SYMBOL_EXTRA_LAUGH_SQUINT    "\xef\x96\x9B"
-#define LV_SYMBOL_EXTRA_LAUGH_WINK    "\xef\x96\x9C"
-#define LV_SYMBOL_EXTRA_LUGGAGE_CART    "\xef\x96\x9D"
-#define LV_SYMBOL_EXTRA_MAP_MARKED    "\xef\x96\x9F"
-#define LV_SYMBOL_EXTRA_MAP_MARKED_ALT    "\xef\x96\xA0"
-#define LV_SYMBOL_EXTRA_MARKER    "\xef\x96\xA1"
-#define LV_SYMBOL_EXTRA_MEDAL    "\xef\x96\xA2"
-#define LV_SYMBOL_EXTRA_MEH_BLANK    "\xef\x96\xA4"
-#define LV_SYMBOL_EXTRA_MEH_ROLLING_EYES    "\xef\x96\xA5"
-#define LV_SYMBOL_EXTRA_MONUMENT    "\xef\x96\xA6"
-#define LV_SYMBOL_EXTRA_MORTAR_PESTLE    "\xef\x96\xA7"
-#define LV_SYMBOL_EXTRA_PAINT_BRUSH_ALT    "\xef\x96\xA9"
-#define LV_SYMBOL_EXTRA_PAINT_ROLLER    "\xef\x96\xAA"
-#define LV_SYMBOL_EXTRA_PASSPORT    "\xef\x96\xAB"
-#define LV_SYMBOL_EXTRA_PEN_FANCY    "\xef\x96\xAC"
-#define LV_SYMBOL_EXTRA_PEN_NIB    "\xef\x96\xAD"
-#define LV_SYMBOL_EXTRA_PENCIL_RULER    "\xef\x96\xAE"
-#define LV_SYMBOL_EXTRA_PLANE_ARRIVAL    "\xef\x96\xAF"
-#define LV_SYMBOL_EXTRA_PLANE_DEPARTURE    "\xef\x96\xB0"
-#define LV_SYMBOL_EXTRA_PRESCRIPTION    "\xef\x96\xB1"
-#define LV_SYMBOL_EXTRA_SAD_CRY    "\xef\x96\xB3"
-#define LV_SYMBOL_EXTRA_SAD_TEAR    "\xef\x96\xB4"
-#define LV_SYMBOL_EXTRA_SHUTTLE_VAN    "\xef\x96\xB6"
-#define LV_SYMBOL_EXTRA_SIGNATURE    "\xef\x96\xB7"
-#define LV_SYMBOL_EXTRA_SMILE_BEAM    "\xef\x96\xB8"
-#define LV_SYMBOL_EXTRA_SMILE_PLUS    "\xef\x96\xB9"
-#define LV_SYMBOL_EXTRA_SOLAR_PANEL    "\xef\x96\xBA"
-#define LV_SYMBOL_EXTRA_SPA    "\xef\x96\xBB"
-#define LV_SYMBOL_EXTRA_SPLOTCH    "\xef\x96\xBC"
-#define LV_SYMBOL_EXTRA_SPRAY_CAN    "\xef\x96\xBD"
-#define LV_SYMBOL_EXTRA_STAMP    "\xef\x96\xBF"
-#define LV_SYMBOL_EXTRA_STAR_HALF_ALT    "\xef\x97\x80"
-#define LV_SYMBOL_EXTRA_SUITCASE_ROLLING    "\xef\x97\x81"
-#define LV_SYMBOL_EXTRA_SURPRISE    "\xef\x97\x82"
-#define LV_SYMBOL_EXTRA_SWATCHBOOK    "\xef\x97\x83"
-#define LV_SYMBOL_EXTRA_SWIMMER    "\xef\x97\x84"
-#define LV_SYMBOL_EXTRA_SWIMMING_POOL    "\xef\x97\x85"
-#define LV_SYMBOL_EXTRA_TINT_SLASH    "\xef\x97\x87"
-#define LV_SYMBOL_EXTRA_TIRED    "\xef\x97\x88"
-#define LV_SYMBOL_EXTRA_TOOTH    "\xef\x97\x89"
-#define LV_SYMBOL_EXTRA_UMBRELLA_BEACH    "\xef\x97\x8A"
-#define LV_SYMBOL_EXTRA_VECTOR_SQUARE    "\xef\x97\x8B"
-#define LV_SYMBOL_EXTRA_WEIGHT_HANGING    "\xef\x97\x8D"
-#define LV_SYMBOL_EXTRA_WINE_GLASS_ALT    "\xef\x97\x8E"
-#define LV_SYMBOL_EXTRA_AIR_FRESHENER    "\xef\x97\x90"
-#define LV_SYMBOL_EXTRA_APPLE_ALT    "\xef\x97\x91"
-#define LV_SYMBOL_EXTRA_ATOM    "\xef\x97\x92"
-#define LV_SYMBOL_EXTRA_ATOM_ALT    "\xef\x97\x93"
-#define LV_SYMBOL_EXTRA_BACKPACK    "\xef\x97\x94"
-#define LV_SYMBOL_EXTRA_BELL_SCHOOL    "\xef\x97\x95"
-#define LV_SYMBOL_EXTRA_BELL_SCHOOL_SLASH    "\xef\x97\x96"
-#define LV_SYMBOL_EXTRA_BONE    "\xef\x97\x97"
-#define LV_SYMBOL_EXTRA_BONE_BREAK    "\xef\x97\x98"
-#define LV_SYMBOL_EXTRA_BOOK_ALT    "\xef\x97\x99"
-#define LV_SYMBOL_EXTRA_BOOK_READER    "\xef\x97\x9A"
-#define LV_SYMBOL_EXTRA_BOOKS    "\xef\x97\x9B"
-#define LV_SYMBOL_EXTRA_BRAIN    "\xef\x97\x9C"
-#define LV_SYMBOL_EXTRA_BUS_SCHOOL    "\xef\x97\x9D"
-#define LV_SYMBOL_EXTRA_CAR_ALT    "\xef\x97\x9E"
-#define LV_SYMBOL_EXTRA_CAR_BATTERY    "\xef\x97\x9F"
-#define LV_SYMBOL_EXTRA_CAR_BUMP    "\xef\x97\xA0"
-#define LV_SYMBOL_EXTRA_CAR_CRASH    "\xef\x97\xA1"
-#define LV_SYMBOL_EXTRA_CAR_GARAGE    "\xef\x97\xA2"
-#define LV_SYMBOL_EXTRA_CAR_MECHANIC    "\xef\x97\xA3"
-#define LV_SYMBOL_EXTRA_CAR_SIDE    "\xef\x97\xA4"
-#define LV_SYMBOL_EXTRA_CAR_TILT    "\xef\x97\xA5"
-#define LV_SYMBOL_EXTRA_CAR_WASH    "\xef\x97\xA6"
-#define LV_SYMBOL_EXTRA_CHARGING_STATION    "\xef\x97\xA7"
-#define LV_SYMBOL_EXTRA_CLIPBOARD_PRESCRIPTION    "\xef\x97\xA8"
-#define LV_SYMBOL_EXTRA_COMPASS_SLASH    "\xef\x97\xA9"
-#define LV_SYMBOL_EXTRA_DIPLOMA    "\xef\x97\xAA"
-#define LV_SYMBOL_EXTRA_DIRECTIONS    "\xef\x97\xAB"
-#define LV_SYMBOL_EXTRA_DO_NOT_ENTER    "\xef\x97\xAC"
-#define LV_SYMBOL_EXTRA_DRAW_CIRCLE    "\xef\x97\xAD"
-#define LV_SYMBOL_EXTRA_DRAW_POLYGON    "\xef\x97\xAE"
-#define LV_SYMBOL_EXTRA_DRAW_SQUARE    "\xef\x97\xAF"
-#define LV_SYMBOL_EXTRA_EAR    "\xef\x97\xB0"
-#define LV_SYMBOL_EXTRA_ENGINE_WARNING    "\xef\x97\xB2"
-#define LV_SYMBOL_EXTRA_FILE_CERTIFICATE    "\xef\x97\xB3"
-#define LV_SYMBOL_EXTRA_GAS_PUMP_SLASH    "\xef\x97\xB4"
-#define LV_SYMBOL_EXTRA_GLASSES_ALT    "\xef\x97\xB5"
-#define LV_SYMBOL_EXTRA_GLOBE_STAND    "\xef\x97\xB6"
-#define LV_SYMBOL_EXTRA_HEART_RATE    "\xef\x97\xB8"
-#define LV_SYMBOL_EXTRA_INHALER    "\xef\x97\xB9"
-#define LV_SYMBOL_EXTRA_KIDNEYS    "\xef\x97\xBB"
-#define LV_SYMBOL_EXTRA_LAPTOP_CODE    "\xef\x97\xBC"
-#define LV_SYMBOL_EXTRA_LAYER_GROUP    "\xef\x97\xBD"
-#define LV_SYMBOL_EXTRA_LAYER_MINUS    "\xef\x97\xBE"
-#define LV_SYMBOL_EXTRA_LAYER_PLUS    "\xef\x97\xBF"
-#define LV_SYMBOL_EXTRA_LIPS    "\xef\x98\x80"
-#define LV_SYMBOL_EXTRA_LOCATION    "\xef\x98\x81"
-#define LV_SYMBOL_EXTRA_LOCATION_CIRCLE    "\xef\x98\x82"
-#define LV_SYMBOL_EXTRA_LOCATION_SLASH    "\xef\x98\x83"
-#define LV_SYMBOL_EXTRA_LUNGS    "\xef\x98\x84"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_ALT_SLASH    "\xef\x98\x85"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_CHECK    "\xef\x98\x86"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_EDIT    "\xef\x98\x87"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_EXCLAMATION    "\xef\x98\x88"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_MINUS    "\xef\x98\x89"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_PLUS    "\xef\x98\x8A"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_QUESTION    "\xef\x98\x8B"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_SLASH    "\xef\x98\x8C"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_SMILE    "\xef\x98\x8D"
-#define LV_SYMBOL_EXTRA_MAP_MARKER_TIMES    "\xef\x98\x8E"
-#define LV_SYMBOL_EXTRA_MICROSCOPE    "\xef\x98\x90"
-#define LV_SYMBOL_EXTRA_MONITOR_HEART_RATE    "\xef\x98\x91"
-#define LV_SYMBOL_EXTRA_OIL_CAN    "\xef\x98\x93"
-#define LV_SYMBOL_EXTRA_OIL_TEMP    "\xef\x98\x94"
-#define LV_SYMBOL_EXTRA_PARKING_CIRCLE    "\xef\x98\x95"
-#define LV_SYMBOL_EXTRA_PARKING_CIRCLE_SLASH    "\xef\x98\x96"
-#define LV_SYMBOL_EXTRA_PARKING_SLASH    "\xef\x98\x97"
-#define LV_SYMBOL_EXTRA_PENCIL_PAINTBRUSH    "\xef\x98\x98"
-#define LV_SYMBOL_EXTRA_POOP    "\xef\x98\x99"
-#define LV_SYMBOL_EXTRA_ROUTE_HIGHWAY    "\xef\x98\x9A"
-#define LV_SYMBOL_EXTRA_ROUTE_INTERSTATE    "\xef\x98\x9B"
-#define LV_SYMBOL_EXTRA_RULER_TRIANGLE    "\xef\x98\x9C"
-#define LV_SYMBOL_EXTRA_SCALPEL    "\xef\x98\x9D"
-#define LV_SYMBOL_EXTRA_SCALPEL_PATH    "\xef\x98\x9E"
-#define LV_SYMBOL_EXTRA_SHAPES    "\xef\x98\x9F"
-#define LV_SYMBOL_EXTRA_SKELETON    "\xef\x98\xA0"
-#define LV_SYMBOL_EXTRA_STAR_OF_LIFE    "\xef\x98\xA1"
-#define LV_SYMBOL_EXTRA_STEERING_WHEEL    "\xef\x98\xA2"
-#define LV_SYMBOL_EXTRA_STOMACH    "\xef\x98\xA3"
-#define LV_SYMBOL_EXTRA_TACHOMETER_ALT_AVERAGE    "\xef\x98\xA4"
-#define LV_SYMBOL_EXTRA_TACHOMETER_ALT_FAST    "\xef\x98\xA5"
-#define LV_SYMBOL_EXTRA_TACHOMETER_ALT_FASTEST    "\xef\x98\xA6"
-#define LV_SYMBOL_EXTRA_TACHOMETER_ALT_SLOW    "\xef\x98\xA7"
-#define LV_SYMBOL_EXTRA_TACHOMETER_ALT_SLOWEST    "\xef\x98\xA8"
-#define LV_SYMBOL_EXTRA_TACHOMETER_AVERAGE    "\xef\x98\xA9"
-#define LV_SYMBOL_EXTRA_TACHOMETER_FAST    "\xef\x98\xAA"
-#define LV_SYMBOL_EXTRA_TACHOMETER_FASTEST    "\xef\x98\xAB"
-#define LV_SYMBOL_EXTRA_TACHOMETER_SLOW    "\xef\x98\xAC"
-#define LV_SYMBOL_EXTRA_TACHOMETER_SLOWEST    "\xef\x98\xAD"
-#define LV_SYMBOL_EXTRA_TEETH    "\xef\x98\xAE"
-#define LV_SYMBOL_EXTRA_TEETH_OPEN    "\xef\x98\xAF"
-#define LV_SYMBOL_EXTRA_THEATER_MASKS    "\xef\x98\xB0"
-#define LV_SYMBOL_EXTRA_TIRE    "\xef\x98\xB1"
-#define LV_SYMBOL_EXTRA_TIRE_FLAT    "\xef\x98\xB2"
-#define LV_SYMBOL_EXTRA_TIRE_PRESSURE_WARNING    "\xef\x98\xB3"
-#define LV_SYMBOL_EXTRA_TIRE_RUGGED    "\xef\x98\xB4"
-#define LV_SYMBOL_EXTRA_TOOTHBRUSH    "\xef\x98\xB5"
-#define LV_SYMBOL_EXTRA_TRAFFIC_CONE    "\xef\x98\xB6"
-#define LV_SYMBOL_EXTRA_TRAFFIC_LIGHT    "\xef\x98\xB7"
-#define LV_SYMBOL_EXTRA_TRAFFIC_LIGHT_GO    "\xef\x98\xB8"
-#define LV_SYMBOL_EXTRA_TRAFFIC_LIGHT_SLOW    "\xef\x98\xB9"
-#define LV_SYMBOL_EXTRA_TRAFFIC_LIGHT_STOP    "\xef\x98\xBA"
-#define LV_SYMBOL_EXTRA_TRUCK_MONSTER    "\xef\x98\xBB"
-#define LV_SYMBOL_EXTRA_TRUCK_PICKUP    "\xef\x98\xBC"
-#define LV_SYMBOL_EXTRA_USERS_CLASS    "\xef\x98\xBD"
-#define LV_SYMBOL_EXTRA_WATCH_FITNESS    "\xef\x98\xBE"
-#define LV_SYMBOL_EXTRA_ABACUS    "\xef\x99\x80"
-#define LV_SYMBOL_EXTRA_AD    "\xef\x99\x81"
-#define LV_SYMBOL_EXTRA_ANALYTICS    "\xef\x99\x83"
-#define LV_SYMBOL_EXTRA_ANKH    "\xef\x99\x84"
-#define LV_SYMBOL_EXTRA_BADGE_DOLLAR    "\xef\x99\x85"
-#define LV_SYMBOL_EXTRA_BADGE_PERCENT    "\xef\x99\x86"
-#define LV_SYMBOL_EXTRA_BIBLE    "\xef\x99\x87"
-#define LV_SYMBOL_EXTRA_BULLSEYE_ARROW    "\xef\x99\x88"
-#define LV_SYMBOL_EXTRA_BULLSEYE_POINTER    "\xef\x99\x89"
-#define LV_SYMBOL_EXTRA_BUSINESS_TIME    "\xef\x99\x8A"
-#define LV_SYMBOL_EXTRA_CABINET_FILING    "\xef\x99\x8B"
-#define LV_SYMBOL_EXTRA_CALCULATOR_ALT    "\xef\x99\x8C"
-#define LV_SYMBOL_EXTRA_CHART_LINE_DOWN    "\xef\x99\x8D"
-#define LV_SYMBOL_EXTRA_CHART_PIE_ALT    "\xef\x99\x8E"
-#define LV_SYMBOL_EXTRA_CITY    "\xef\x99\x8F"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_DOLLAR    "\xef\x99\x90"
-#define LV_SYMBOL_EXTRA_COMMENT_DOLLAR    "\xef\x99\x91"
-#define LV_SYMBOL_EXTRA_COMMENTS_ALT_DOLLAR    "\xef\x99\x92"
-#define LV_SYMBOL_EXTRA_COMMENTS_DOLLAR    "\xef\x99\x93"
-#define LV_SYMBOL_EXTRA_CROSS    "\xef\x99\x94"
-#define LV_SYMBOL_EXTRA_DHARMACHAKRA    "\xef\x99\x95"
-#define LV_SYMBOL_EXTRA_EMPTY_SET    "\xef\x99\x96"
-#define LV_SYMBOL_EXTRA_ENVELOPE_OPEN_DOLLAR    "\xef\x99\x97"
-#define LV_SYMBOL_EXTRA_ENVELOPE_OPEN_TEXT    "\xef\x99\x98"
-#define LV_SYMBOL_EXTRA_FILE_CHART_LINE    "\xef\x99\x99"
-#define LV_SYMBOL_EXTRA_FILE_CHART_PIE    "\xef\x99\x9A"
-#define LV_SYMBOL_EXTRA_FILE_SPREADSHEET    "\xef\x99\x9B"
-#define LV_SYMBOL_EXTRA_FILE_USER    "\xef\x99\x9C"
-#define LV_SYMBOL_EXTRA_FOLDER_MINUS    "\xef\x99\x9D"
-#define LV_SYMBOL_EXTRA_FOLDER_PLUS    "\xef\x99\x9E"
-#define LV_SYMBOL_EXTRA_FOLDER_TIMES    "\xef\x99\x9F"
-#define LV_SYMBOL_EXTRA_FOLDERS    "\xef\x99\xA0"
-#define LV_SYMBOL_EXTRA_FUNCTION    "\xef\x99\xA1"
-#define LV_SYMBOL_EXTRA_FUNNEL_DOLLAR    "\xef\x99\xA2"
-#define LV_SYMBOL_EXTRA_GIFT_CARD    "\xef\x99\xA3"
-#define LV_SYMBOL_EXTRA_GOPURAM    "\xef\x99\xA4"
-#define LV_SYMBOL_EXTRA_HAMSA    "\xef\x99\xA5"
-#define LV_SYMBOL_EXTRA_BAHAI    "\xef\x99\xA6"
-#define LV_SYMBOL_EXTRA_INTEGRAL    "\xef\x99\xA7"
-#define LV_SYMBOL_EXTRA_INTERSECTION    "\xef\x99\xA8"
-#define LV_SYMBOL_EXTRA_JEDI    "\xef\x99\xA9"
-#define LV_SYMBOL_EXTRA_JOURNAL_WHILLS    "\xef\x99\xAA"
-#define LV_SYMBOL_EXTRA_KAABA    "\xef\x99\xAB"
-#define LV_SYMBOL_EXTRA_KEYNOTE    "\xef\x99\xAC"
-#define LV_SYMBOL_EXTRA_KHANDA    "\xef\x99\xAD"
-#define LV_SYMBOL_EXTRA_LAMBDA    "\xef\x99\xAE"
-#define LV_SYMBOL_EXTRA_LANDMARK    "\xef\x99\xAF"
-#define LV_SYMBOL_EXTRA_LIGHTBULB_DOLLAR    "\xef\x99\xB0"
-#define LV_SYMBOL_EXTRA_LIGHTBULB_EXCLAMATION    "\xef\x99\xB1"
-#define LV_SYMBOL_EXTRA_LIGHTBULB_ON    "\xef\x99\xB2"
-#define LV_SYMBOL_EXTRA_LIGHTBULB_SLASH    "\xef\x99\xB3"
-#define LV_SYMBOL_EXTRA_MAIL_BULK    "\xef\x99\xB4"
-#define LV_SYMBOL_EXTRA_MEGAPHONE    "\xef\x99\xB5"
-#define LV_SYMBOL_EXTRA_MENORAH    "\xef\x99\xB6"
-#define LV_SYMBOL_EXTRA_MIND_SHARE    "\xef\x99\xB7"
-#define LV_SYMBOL_EXTRA_MOSQUE    "\xef\x99\xB8"
-#define LV_SYMBOL_EXTRA_OM    "\xef\x99\xB9"
-#define LV_SYMBOL_EXTRA_OMEGA    "\xef\x99\xBA"
-#define LV_SYMBOL_EXTRA_PASTAFARIANISM    "\xef\x99\xBB"
-#define LV_SYMBOL_EXTRA_PEACE    "\xef\x99\xBC"
-#define LV_SYMBOL_EXTRA_PHONE_OFFICE    "\xef\x99\xBD"
-#define LV_SYMBOL_EXTRA_PI    "\xef\x99\xBE"
-#define LV_SYMBOL_EXTRA_PLACE_OF_WORSHIP    "\xef\x99\xBF"
-#define LV_SYMBOL_EXTRA_PODIUM    "\xef\x9A\x80"
-#define LV_SYMBOL_EXTRA_POLL    "\xef\x9A\x81"
-#define LV_SYMBOL_EXTRA_POLL_H    "\xef\x9A\x82"
-#define LV_SYMBOL_EXTRA_PRAY    "\xef\x9A\x83"
-#define LV_SYMBOL_EXTRA_PRAYING_HANDS    "\xef\x9A\x84"
-#define LV_SYMBOL_EXTRA_PRESENTATION    "\xef\x9A\x85"
-#define LV_SYMBOL_EXTRA_PRINT_SLASH    "\xef\x9A\x86"
-#define LV_SYMBOL_EXTRA_QURAN    "\xef\x9A\x87"
-#define LV_SYMBOL_EXTRA_SEARCH_DOLLAR    "\xef\x9A\x88"
-#define LV_SYMBOL_EXTRA_SEARCH_LOCATION    "\xef\x9A\x89"
-#define LV_SYMBOL_EXTRA_SHREDDER    "\xef\x9A\x8A"
-#define LV_SYMBOL_EXTRA_SIGMA    "\xef\x9A\x8B"
-#define LV_SYMBOL_EXTRA_SIGNAL_1    "\xef\x9A\x8C"
-#define LV_SYMBOL_EXTRA_SIGNAL_2    "\xef\x9A\x8D"
-#define LV_SYMBOL_EXTRA_SIGNAL_3    "\xef\x9A\x8E"
-#define LV_SYMBOL_EXTRA_SIGNAL_4    "\xef\x9A\x8F"
-#define LV_SYMBOL_EXTRA_SIGNAL_ALT    "\xef\x9A\x90"
-#define LV_SYMBOL_EXTRA_SIGNAL_ALT_1    "\xef\x9A\x91"
-#define LV_SYMBOL_EXTRA_SIGNAL_ALT_2    "\xef\x9A\x92"
-#define LV_SYMBOL_EXTRA_SIGNAL_ALT_3    "\xef\x9A\x93"
-#define LV_SYMBOL_EXTRA_SIGNAL_ALT_SLASH    "\xef\x9A\x94"
-#define LV_SYMBOL_EXTRA_SIGNAL_SLASH    "\xef\x9A\x95"
-#define LV_SYMBOL_EXTRA_SOCKS    "\xef\x9A\x96"
-#define LV_SYMBOL_EXTRA_SQUARE_ROOT    "\xef\x9A\x97"
-#define LV_SYMBOL_EXTRA_SQUARE_ROOT_ALT    "\xef\x9A\x98"
-#define LV_SYMBOL_EXTRA_STAR_AND_CRESCENT    "\xef\x9A\x99"
-#define LV_SYMBOL_EXTRA_STAR_OF_DAVID    "\xef\x9A\x9A"
-#define LV_SYMBOL_EXTRA_SYNAGOGUE    "\xef\x9A\x9B"
-#define LV_SYMBOL_EXTRA_TALLY    "\xef\x9A\x9C"
-#define LV_SYMBOL_EXTRA_THETA    "\xef\x9A\x9E"
-#define LV_SYMBOL_EXTRA_TILDE    "\xef\x9A\x9F"
-#define LV_SYMBOL_EXTRA_TORAH    "\xef\x9A\xA0"
-#define LV_SYMBOL_EXTRA_TORII_GATE    "\xef\x9A\xA1"
-#define LV_SYMBOL_EXTRA_UNION    "\xef\x9A\xA2"
-#define LV_SYMBOL_EXTRA_USER_CHART    "\xef\x9A\xA3"
-#define LV_SYMBOL_EXTRA_USER_CROWN    "\xef\x9A\xA4"
-#define LV_SYMBOL_EXTRA_USERS_CROWN    "\xef\x9A\xA5"
-#define LV_SYMBOL_EXTRA_VALUE_ABSOLUTE    "\xef\x9A\xA6"
-#define LV_SYMBOL_EXTRA_VIHARA    "\xef\x9A\xA7"
-#define LV_SYMBOL_EXTRA_VOLUME    "\xef\x9A\xA8"
-#define LV_SYMBOL_EXTRA_VOLUME_MUTE    "\xef\x9A\xA9"
-#define LV_SYMBOL_EXTRA_WIFI_1    "\xef\x9A\xAA"
-#define LV_SYMBOL_EXTRA_WIFI_2    "\xef\x9A\xAB"
-#define LV_SYMBOL_EXTRA_WIFI_SLASH    "\xef\x9A\xAC"
-#define LV_SYMBOL_EXTRA_YIN_YANG    "\xef\x9A\xAD"
-#define LV_SYMBOL_EXTRA_ACORN    "\xef\x9A\xAE"
-#define LV_SYMBOL_EXTRA_ALICORN    "\xef\x9A\xB0"
-#define LV_SYMBOL_EXTRA_APPLE_CRATE    "\xef\x9A\xB1"
-#define LV_SYMBOL_EXTRA_AXE    "\xef\x9A\xB2"
-#define LV_SYMBOL_EXTRA_AXE_BATTLE    "\xef\x9A\xB3"
-#define LV_SYMBOL_EXTRA_BADGER_HONEY    "\xef\x9A\xB4"
-#define LV_SYMBOL_EXTRA_BAT    "\xef\x9A\xB5"
-#define LV_SYMBOL_EXTRA_BLENDER_PHONE    "\xef\x9A\xB6"
-#define LV_SYMBOL_EXTRA_BOOK_DEAD    "\xef\x9A\xB7"
-#define LV_SYMBOL_EXTRA_BOOK_SPELLS    "\xef\x9A\xB8"
-#define LV_SYMBOL_EXTRA_BOW_ARROW    "\xef\x9A\xB9"
-#define LV_SYMBOL_EXTRA_CAMPFIRE    "\xef\x9A\xBA"
-#define LV_SYMBOL_EXTRA_CAMPGROUND    "\xef\x9A\xBB"
-#define LV_SYMBOL_EXTRA_CANDLE_HOLDER    "\xef\x9A\xBC"
-#define LV_SYMBOL_EXTRA_CANDY_CORN    "\xef\x9A\xBD"
-#define LV_SYMBOL_EXTRA_CAT    "\xef\x9A\xBE"
-#define LV_SYMBOL_EXTRA_CAULDRON    "\xef\x9A\xBF"
-#define LV_SYMBOL_EXTRA_CHAIR    "\xef\x9B\x80"
-#define LV_SYMBOL_EXTRA_CHAIR_OFFICE    "\xef\x9B\x81"
-#define LV_SYMBOL_EXTRA_CLAW_MARKS    "\xef\x9B\x82"
-#define LV_SYMBOL_EXTRA_CLOUD_MOON    "\xef\x9B\x83"
-#define LV_SYMBOL_EXTRA_CLOUD_SUN    "\xef\x9B\x84"
-#define LV_SYMBOL_EXTRA_COFFEE_TOGO    "\xef\x9B\x85"
-#define LV_SYMBOL_EXTRA_COFFIN    "\xef\x9B\x86"
-#define LV_SYMBOL_EXTRA_CORN    "\xef\x9B\x87"
-#define LV_SYMBOL_EXTRA_COW    "\xef\x9B\x88"
-#define LV_SYMBOL_EXTRA_DAGGER    "\xef\x9B\x8B"
-#define LV_SYMBOL_EXTRA_DICE_D10    "\xef\x9B\x8D"
-#define LV_SYMBOL_EXTRA_DICE_D12    "\xef\x9B\x8E"
-#define LV_SYMBOL_EXTRA_DICE_D20    "\xef\x9B\x8F"
-#define LV_SYMBOL_EXTRA_DICE_D4    "\xef\x9B\x90"
-#define LV_SYMBOL_EXTRA_DICE_D6    "\xef\x9B\x91"
-#define LV_SYMBOL_EXTRA_DICE_D8    "\xef\x9B\x92"
-#define LV_SYMBOL_EXTRA_DOG    "\xef\x9B\x93"
-#define LV_SYMBOL_EXTRA_DOG_LEASHED    "\xef\x9B\x94"
-#define LV_SYMBOL_EXTRA_DRAGON    "\xef\x9B\x95"
-#define LV_SYMBOL_EXTRA_DRUMSTICK    "\xef\x9B\x96"
-#define LV_SYMBOL_EXTRA_DRUMSTICK_BITE    "\xef\x9B\x97"
-#define LV_SYMBOL_EXTRA_DUCK    "\xef\x9B\x98"
-#define LV_SYMBOL_EXTRA_DUNGEON    "\xef\x9B\x99"
-#define LV_SYMBOL_EXTRA_ELEPHANT    "\xef\x9B\x9A"
-#define LV_SYMBOL_EXTRA_EYE_EVIL    "\xef\x9B\x9B"
-#define LV_SYMBOL_EXTRA_FILE_CSV    "\xef\x9B\x9D"
-#define LV_SYMBOL_EXTRA_FIST_RAISED    "\xef\x9B\x9E"
-#define LV_SYMBOL_EXTRA_FLAME    "\xef\x9B\x9F"
-#define LV_SYMBOL_EXTRA_FLASK_POISON    "\xef\x9B\xA0"
-#define LV_SYMBOL_EXTRA_FLASK_POTION    "\xef\x9B\xA1"
-#define LV_SYMBOL_EXTRA_GHOST    "\xef\x9B\xA2"
-#define LV_SYMBOL_EXTRA_HAMMER    "\xef\x9B\xA3"
-#define LV_SYMBOL_EXTRA_HAMMER_WAR    "\xef\x9B\xA4"
-#define LV_SYMBOL_EXTRA_HAND_HOLDING_MAGIC    "\xef\x9B\xA5"
-#define LV_SYMBOL_EXTRA_HANUKIAH    "\xef\x9B\xA6"
-#define LV_SYMBOL_EXTRA_HAT_WITCH    "\xef\x9B\xA7"
-#define LV_SYMBOL_EXTRA_HAT_WIZARD    "\xef\x9B\xA8"
-#define LV_SYMBOL_EXTRA_HEAD_SIDE    "\xef\x9B\xA9"
-#define LV_SYMBOL_EXTRA_HEAD_VR    "\xef\x9B\xAA"
-#define LV_SYMBOL_EXTRA_HELMET_BATTLE    "\xef\x9B\xAB"
-#define LV_SYMBOL_EXTRA_HIKING    "\xef\x9B\xAC"
-#define LV_SYMBOL_EXTRA_HIPPO    "\xef\x9B\xAD"
-#define LV_SYMBOL_EXTRA_HOCKEY_MASK    "\xef\x9B\xAE"
-#define LV_SYMBOL_EXTRA_HOOD_CLOAK    "\xef\x9B\xAF"
-#define LV_SYMBOL_EXTRA_HORSE    "\xef\x9B\xB0"
-#define LV_SYMBOL_EXTRA_HOUSE_DAMAGE    "\xef\x9B\xB1"
-#define LV_SYMBOL_EXTRA_HRYVNIA    "\xef\x9B\xB2"
-#define LV_SYMBOL_EXTRA_KEY_SKELETON    "\xef\x9B\xB3"
-#define LV_SYMBOL_EXTRA_KITE    "\xef\x9B\xB4"
-#define LV_SYMBOL_EXTRA_KNIFE_KITCHEN    "\xef\x9B\xB5"
-#define LV_SYMBOL_EXTRA_LEAF_MAPLE    "\xef\x9B\xB6"
-#define LV_SYMBOL_EXTRA_LEAF_OAK    "\xef\x9B\xB7"
-#define LV_SYMBOL_EXTRA_MACE    "\xef\x9B\xB8"
-#define LV_SYMBOL_EXTRA_MANDOLIN    "\xef\x9B\xB9"
-#define LV_SYMBOL_EXTRA_MASK    "\xef\x9B\xBA"
-#define LV_SYMBOL_EXTRA_MONKEY    "\xef\x9B\xBB"
-#define LV_SYMBOL_EXTRA_MOUNTAIN    "\xef\x9B\xBC"
-#define LV_SYMBOL_EXTRA_MOUNTAINS    "\xef\x9B\xBD"
-#define LV_SYMBOL_EXTRA_NARWHAL    "\xef\x9B\xBE"
-#define LV_SYMBOL_EXTRA_NETWORK_WIRED    "\xef\x9B\xBF"
-#define LV_SYMBOL_EXTRA_OTTER    "\xef\x9C\x80"
-#define LV_SYMBOL_EXTRA_PAW_ALT    "\xef\x9C\x81"
-#define LV_SYMBOL_EXTRA_PAW_CLAWS    "\xef\x9C\x82"
-#define LV_SYMBOL_EXTRA_PEGASUS    "\xef\x9C\x83"
-#define LV_SYMBOL_EXTRA_PIE    "\xef\x9C\x85"
-#define LV_SYMBOL_EXTRA_PIG    "\xef\x9C\x86"
-#define LV_SYMBOL_EXTRA_PUMPKIN    "\xef\x9C\x87"
-#define LV_SYMBOL_EXTRA_RABBIT    "\xef\x9C\x88"
-#define LV_SYMBOL_EXTRA_RABBIT_FAST    "\xef\x9C\x89"
-#define LV_SYMBOL_EXTRA_RAM    "\xef\x9C\x8A"
-#define LV_SYMBOL_EXTRA_RING    "\xef\x9C\x8B"
-#define LV_SYMBOL_EXTRA_RUNNING    "\xef\x9C\x8C"
-#define LV_SYMBOL_EXTRA_SCARECROW    "\xef\x9C\x8D"
-#define LV_SYMBOL_EXTRA_SCROLL    "\xef\x9C\x8E"
-#define LV_SYMBOL_EXTRA_SCROLL_OLD    "\xef\x9C\x8F"
-#define LV_SYMBOL_EXTRA_SCYTHE    "\xef\x9C\x90"
-#define LV_SYMBOL_EXTRA_SHEEP    "\xef\x9C\x91"
-#define LV_SYMBOL_EXTRA_SHIELD_CROSS    "\xef\x9C\x92"
-#define LV_SYMBOL_EXTRA_SHOVEL    "\xef\x9C\x93"
-#define LV_SYMBOL_EXTRA_SKULL_CROSSBONES    "\xef\x9C\x94"
-#define LV_SYMBOL_EXTRA_SLASH    "\xef\x9C\x95"
-#define LV_SYMBOL_EXTRA_SNAKE    "\xef\x9C\x96"
-#define LV_SYMBOL_EXTRA_SPIDER    "\xef\x9C\x97"
-#define LV_SYMBOL_EXTRA_SPIDER_BLACK_WIDOW    "\xef\x9C\x98"
-#define LV_SYMBOL_EXTRA_SPIDER_WEB    "\xef\x9C\x99"
-#define LV_SYMBOL_EXTRA_SQUIRREL    "\xef\x9C\x9A"
-#define LV_SYMBOL_EXTRA_STAFF    "\xef\x9C\x9B"
-#define LV_SYMBOL_EXTRA_SWORD    "\xef\x9C\x9C"
-#define LV_SYMBOL_EXTRA_SWORDS    "\xef\x9C\x9D"
-#define LV_SYMBOL_EXTRA_TOILET_PAPER    "\xef\x9C\x9E"
-#define LV_SYMBOL_EXTRA_TOILET_PAPER_ALT    "\xef\x9C\x9F"
-#define LV_SYMBOL_EXTRA_TOMBSTONE    "\xef\x9C\xA0"
-#define LV_SYMBOL_EXTRA_TOMBSTONE_ALT    "\xef\x9C\xA1"
-#define LV_SYMBOL_EXTRA_TRACTOR    "\xef\x9C\xA2"
-#define LV_SYMBOL_EXTRA_TREASURE_CHEST    "\xef\x9C\xA3"
-#define LV_SYMBOL_EXTRA_TREES    "\xef\x9C\xA4"
-#define LV_SYMBOL_EXTRA_TURKEY    "\xef\x9C\xA5"
-#define LV_SYMBOL_EXTRA_TURTLE    "\xef\x9C\xA6"
-#define LV_SYMBOL_EXTRA_UNICORN    "\xef\x9C\xA7"
-#define LV_SYMBOL_EXTRA_USER_INJURED    "\xef\x9C\xA8"
-#define LV_SYMBOL_EXTRA_VR_CARDBOARD    "\xef\x9C\xA9"
-#define LV_SYMBOL_EXTRA_WAND    "\xef\x9C\xAA"
-#define LV_SYMBOL_EXTRA_WAND_MAGIC    "\xef\x9C\xAB"
-#define LV_SYMBOL_EXTRA_WHALE    "\xef\x9C\xAC"
-#define LV_SYMBOL_EXTRA_WHEAT    "\xef\x9C\xAD"
-#define LV_SYMBOL_EXTRA_WIND    "\xef\x9C\xAE"
-#define LV_SYMBOL_EXTRA_WINE_BOTTLE    "\xef\x9C\xAF"
-#define LV_SYMBOL_EXTRA_BALLOT    "\xef\x9C\xB2"
-#define LV_SYMBOL_EXTRA_BALLOT_CHECK    "\xef\x9C\xB3"
-#define LV_SYMBOL_EXTRA_BOOTH_CURTAIN    "\xef\x9C\xB4"
-#define LV_SYMBOL_EXTRA_BOX_BALLOT    "\xef\x9C\xB5"
-#define LV_SYMBOL_EXTRA_CALENDAR_STAR    "\xef\x9C\xB6"
-#define LV_SYMBOL_EXTRA_CLIPBOARD_LIST_CHECK    "\xef\x9C\xB7"
-#define LV_SYMBOL_EXTRA_CLOUD_DRIZZLE    "\xef\x9C\xB8"
-#define LV_SYMBOL_EXTRA_CLOUD_HAIL    "\xef\x9C\xB9"
-#define LV_SYMBOL_EXTRA_CLOUD_HAIL_MIXED    "\xef\x9C\xBA"
-#define LV_SYMBOL_EXTRA_CLOUD_MEATBALL    "\xef\x9C\xBB"
-#define LV_SYMBOL_EXTRA_CLOUD_MOON_RAIN    "\xef\x9C\xBC"
-#define LV_SYMBOL_EXTRA_CLOUD_RAIN    "\xef\x9C\xBD"
-#define LV_SYMBOL_EXTRA_CLOUD_RAINBOW    "\xef\x9C\xBE"
-#define LV_SYMBOL_EXTRA_CLOUD_SHOWERS    "\xef\x9C\xBF"
-#define LV_SYMBOL_EXTRA_CLOUD_SHOWERS_HEAVY    "\xef\x9D\x80"
-#define LV_SYMBOL_EXTRA_CLOUD_SLEET    "\xef\x9D\x81"
-#define LV_SYMBOL_EXTRA_CLOUD_SNOW    "\xef\x9D\x82"
-#define LV_SYMBOL_EXTRA_CLOUD_SUN_RAIN    "\xef\x9D\x83"
-#define LV_SYMBOL_EXTRA_CLOUDS    "\xef\x9D\x84"
-#define LV_SYMBOL_EXTRA_CLOUDS_MOON    "\xef\x9D\x85"
-#define LV_SYMBOL_EXTRA_CLOUDS_SUN    "\xef\x9D\x86"
-#define LV_SYMBOL_EXTRA_DEMOCRAT    "\xef\x9D\x87"
-#define LV_SYMBOL_EXTRA_DEWPOINT    "\xef\x9D\x88"
-#define LV_SYMBOL_EXTRA_ECLIPSE    "\xef\x9D\x89"
-#define LV_SYMBOL_EXTRA_ECLIPSE_ALT    "\xef\x9D\x8A"
-#define LV_SYMBOL_EXTRA_FIRE_SMOKE    "\xef\x9D\x8B"
-#define LV_SYMBOL_EXTRA_FLAG_ALT    "\xef\x9D\x8C"
-#define LV_SYMBOL_EXTRA_FLAG_USA        "\xef\x9D\x8D"
-#define LV_SYMBOL_EXTRA_FOG             "\xef\x9D\x8E"
-#define LV_SYMBOL_EXTRA_HOUSE_FLOOD     "\xef\x9D\x8F"
-#define LV_SYMBOL_EXTRA_HUMIDITY        "\xef\x9D\x90"
-#define LV_SYMBOL_EXTRA_HURRICANE       "\xef\x9D\x91"
-#define LV_SYMBOL_EXTRA_LANDMARK_ALT    "\xef\x9D\x92"
-#define LV_SYMBOL_EXTRA_METEOR          "\xef\x9D\x93"
-#define LV_SYMBOL_EXTRA_MOON_CLOUD      "\xef\x9D\x94"
-#define LV_SYMBOL_EXTRA_MOON_STARS      "\xef\x9D\x95"
-#define LV_SYMBOL_EXTRA_PERSON_BOOTH    "\xef\x9D\x96"
-#define LV_SYMBOL_EXTRA_PERSON_SIGN     "\xef\x9D\x97"
-#define LV_SYMBOL_EXTRA_PODIUM_STAR     "\xef\x9D\x98"
-#define LV_SYMBOL_EXTRA_POLL_PEOPLE     "\xef\x9D\x99"
-#define LV_SYMBOL_EXTRA_POO_STORM       "\xef\x9D\x9A"
-#define LV_SYMBOL_EXTRA_RAINBOW         "\xef\x9D\x9B"
-#define LV_SYMBOL_EXTRA_RAINDROPS       "\xef\x9D\x9C"
-#define LV_SYMBOL_EXTRA_APP             "\xef\x9D\x9D"
-#define LV_SYMBOL_EXTRA_REPUBLICAN      "\xef\x9D\x9E"
-#define LV_SYMBOL_EXTRA_SMOG            "\xef\x9D\x9F"
-#define LV_SYMBOL_EXTRA_SMOKE           "\xef\x9D\xA0"
-#define LV_SYMBOL_EXTRA_SNOW_BLOWING    "\xef\x9D\xA1"
-#define LV_SYMBOL_EXTRA_STARS           "\xef\x9D\xA2"
-#define LV_SYMBOL_EXTRA_SUN_CLOUD       "\xef\x9D\xA3"
-#define LV_SYMBOL_EXTRA_SUN_DUST        "\xef\x9D\xA4"
-#define LV_SYMBOL_EXTRA_SUN_HAZE        "\xef\x9D\xA5"
-#define LV_SYMBOL_EXTRA_SUNRISE         "\xef\x9D\xA6"
-#define LV_SYMBOL_EXTRA_SUNSET          "\xef\x9D\xA7"
-#define LV_SYMBOL_EXTRA_TEMPERATURE_FRIGID  "\xef\x9D\xA8"
-#define LV_SYMBOL_EXTRA_TEMPERATURE_HIGH    "\xef\x9D\xA9"
-#define LV_SYMBOL_EXTRA_TEMPERATURE_HOT "\xef\x9D\xAA"
-#define LV_SYMBOL_EXTRA_TEMPERATURE_LOW "\xef\x9D\xAB"
-#define LV_SYMBOL_EXTRA_THUNDERSTORM        "\xef\x9D\xAC"
-#define LV_SYMBOL_EXTRA_THUNDERSTORM_MOON   "\xef\x9D\xAD"
-#define LV_SYMBOL_EXTRA_THUNDERSTORM_SUN    "\xef\x9D\xAE"
-#define LV_SYMBOL_EXTRA_TORNADO         "\xef\x9D\xAF"
-#define LV_SYMBOL_EXTRA_VOLCANO         "\xef\x9D\xB0"
-#define LV_SYMBOL_EXTRA_VOTE_NAY        "\xef\x9D\xB1"
-#define LV_SYMBOL_EXTRA_VOTE_YEA        "\xef\x9D\xB2"
-#define LV_SYMBOL_EXTRA_WATER           "\xef\x9D\xB3"
-#define LV_SYMBOL_EXTRA_WATER_LOWER     "\xef\x9D\xB4"
-#define LV_SYMBOL_EXTRA_WATER_RISE      "\xef\x9D\xB5"
-#define LV_SYMBOL_EXTRA_WIND_WARNING    "\xef\x9D\xB6"
-#define LV_SYMBOL_EXTRA_WINDSOCK        "\xef\x9D\xB7"
-#define LV_SYMBOL_EXTRA_ANGEL           "\xef\x9D\xB9"
-#define LV_SYMBOL_EXTRA_BABY            "\xef\x9D\xBC"
-#define LV_SYMBOL_EXTRA_BABY_CARRIAGE   "\xef\x9D\xBD"
-#define LV_SYMBOL_EXTRA_BALL_PILE       "\xef\x9D\xBE"
-#define LV_SYMBOL_EXTRA_BELLS           "\xef\x9D\xBF"
-#define LV_SYMBOL_EXTRA_BIOHAZARD       "\xef\x9E\x80"
-#define LV_SYMBOL_EXTRA_BLOG            "\xef\x9E\x81"
-#define LV_SYMBOL_EXTRA_BOOT            "\xef\x9E\x82"
-#define LV_SYMBOL_EXTRA_CALENDAR_DAY    "\xef\x9E\x83"
-#define LV_SYMBOL_EXTRA_CALENDAR_WEEK   "\xef\x9E\x84"
-#define LV_SYMBOL_EXTRA_CANDY_CANE      "\xef\x9E\x86"
-#define LV_SYMBOL_EXTRA_CARROT          "\xef\x9E\x87"
-#define LV_SYMBOL_EXTRA_CASH_REGISTER   "\xef\x9E\x88"
-#define LV_SYMBOL_EXTRA_CHART_NETWORK   "\xef\x9E\x8A"
-#define LV_SYMBOL_EXTRA_CHIMNEY         "\xef\x9E\x8B"
-#define LV_SYMBOL_EXTRA_COMPRESS_ARROWS_ALT    "\xef\x9E\x8C"
-#define LV_SYMBOL_EXTRA_DEER            "\xef\x9E\x8E"
-#define LV_SYMBOL_EXTRA_DEER_RUDOLPH    "\xef\x9E\x8F"
-#define LV_SYMBOL_EXTRA_DREIDEL         "\xef\x9E\x92"
-#define LV_SYMBOL_EXTRA_DUMPSTER        "\xef\x9E\x93"
-#define LV_SYMBOL_EXTRA_DUMPSTER_FIRE   "\xef\x9E\x94"
-#define LV_SYMBOL_EXTRA_EAR_MUFFS       "\xef\x9E\x95"
-#define LV_SYMBOL_EXTRA_ETHERNET        "\xef\x9E\x96"
-#define LV_SYMBOL_EXTRA_FIREPLACE       "\xef\x9E\x9A"
-#define LV_SYMBOL_EXTRA_FROSTY_HEAD     "\xef\x9E\x9B"
-#define LV_SYMBOL_EXTRA_GIFTS           "\xef\x9E\x9C"
-#define LV_SYMBOL_EXTRA_GINGERBREAD_MAN "\xef\x9E\x9D"
-#define LV_SYMBOL_EXTRA_GLASS_CHAMPAGNE "\xef\x9E\x9E"
-#define LV_SYMBOL_EXTRA_GLASS_CHEERS    "\xef\x9E\x9F"
-#define LV_SYMBOL_EXTRA_GLASS_WHISKEY   "\xef\x9E\xA0"
-#define LV_SYMBOL_EXTRA_GLASS_WHISKEY_ROCKS "\xef\x9E\xA1"
-#define LV_SYMBOL_EXTRA_GLOBE_EUROPE    "\xef\x9E\xA2"
-#define LV_SYMBOL_EXTRA_GLOBE_SNOW      "\xef\x9E\xA3"
-#define LV_SYMBOL_EXTRA_GRIP_LINES      "\xef\x9E\xA4"
-#define LV_SYMBOL_EXTRA_GRIP_LINES_VERTICAL "\xef\x9E\xA5"
-#define LV_SYMBOL_EXTRA_GUITAR          "\xef\x9E\xA6"
-#define LV_SYMBOL_EXTRA_HAT_SANTA       "\xef\x9E\xA7"
-#define LV_SYMBOL_EXTRA_HAT_WINTER      "\xef\x9E\xA8"
-#define LV_SYMBOL_EXTRA_HEART_BROKEN    "\xef\x9E\xA9"
-#define LV_SYMBOL_EXTRA_HOLLY_BERRY     "\xef\x9E\xAA"
-#define LV_SYMBOL_EXTRA_HORSE_HEAD      "\xef\x9E\xAB"
-#define LV_SYMBOL_EXTRA_ICE_SKATE       "\xef\x9E\xAC"
-#define LV_SYMBOL_EXTRA_ICICLES         "\xef\x9E\xAD"
-#define LV_SYMBOL_EXTRA_IGLOO           "\xef\x9E\xAE"
-#define LV_SYMBOL_EXTRA_LIGHTS_HOLIDAY  "\xef\x9E\xB2"
-#define LV_SYMBOL_EXTRA_MISTLETOE       "\xef\x9E\xB4"
-#define LV_SYMBOL_EXTRA_MITTEN    "\xef\x9E\xB5"
-#define LV_SYMBOL_EXTRA_MUG_HOT    "\xef\x9E\xB6"
-#define LV_SYMBOL_EXTRA_MUG_MARSHMALLOWS    "\xef\x9E\xB7"
-#define LV_SYMBOL_EXTRA_ORNAMENT    "\xef\x9E\xB8"
-#define LV_SYMBOL_EXTRA_RADIATION    "\xef\x9E\xB9"
-#define LV_SYMBOL_EXTRA_RADIATION_ALT    "\xef\x9E\xBA"
-#define LV_SYMBOL_EXTRA_RESTROOM    "\xef\x9E\xBD"
-#define LV_SYMBOL_EXTRA_RV    "\xef\x9E\xBE"
-#define LV_SYMBOL_EXTRA_SATELLITE    "\xef\x9E\xBF"
-#define LV_SYMBOL_EXTRA_SATELLITE_DISH    "\xef\x9F\x80"
-#define LV_SYMBOL_EXTRA_SCARF    "\xef\x9F\x81"
-#define LV_SYMBOL_EXTRA_SD_CARD    "\xef\x9F\x82"
-#define LV_SYMBOL_EXTRA_SHOVEL_SNOW    "\xef\x9F\x83"
-#define LV_SYMBOL_EXTRA_SIM_CARD    "\xef\x9F\x84"
-#define LV_SYMBOL_EXTRA_SKATING    "\xef\x9F\x85"
-#define LV_SYMBOL_EXTRA_SKI_JUMP    "\xef\x9F\x87"
-#define LV_SYMBOL_EXTRA_SKI_LIFT    "\xef\x9F\x88"
-#define LV_SYMBOL_EXTRA_SKIING    "\xef\x9F\x89"
-#define LV_SYMBOL_EXTRA_SKIING_NORDIC    "\xef\x9F\x8A"
-#define LV_SYMBOL_EXTRA_SLEDDING    "\xef\x9F\x8B"
-#define LV_SYMBOL_EXTRA_SLEIGH    "\xef\x9F\x8C"
-#define LV_SYMBOL_EXTRA_SMS    "\xef\x9F\x8D"
-#define LV_SYMBOL_EXTRA_SNOWBOARDING    "\xef\x9F\x8E"
-#define LV_SYMBOL_EXTRA_SNOWFLAKES    "\xef\x9F\x8F"
-#define LV_SYMBOL_EXTRA_SNOWMAN    "\xef\x9F\x90"
-#define LV_SYMBOL_EXTRA_SNOWMOBILE    "\xef\x9F\x91"
-#define LV_SYMBOL_EXTRA_SNOWPLOW    "\xef\x9F\x92"
-#define LV_SYMBOL_EXTRA_STAR_CHRISTMAS    "\xef\x9F\x94"
-#define LV_SYMBOL_EXTRA_STOCKING    "\xef\x9F\x95"
-#define LV_SYMBOL_EXTRA_TENGE    "\xef\x9F\x97"
-#define LV_SYMBOL_EXTRA_TOILET    "\xef\x9F\x98"
-#define LV_SYMBOL_EXTRA_TOOLS    "\xef\x9F\x99"
-#define LV_SYMBOL_EXTRA_TRAM    "\xef\x9F\x9A"
-#define LV_SYMBOL_EXTRA_TREE_CHRISTMAS    "\xef\x9F\x9B"
-#define LV_SYMBOL_EXTRA_TREE_DECORATED    "\xef\x9F\x9C"
-#define LV_SYMBOL_EXTRA_TREE_LARGE    "\xef\x9F\x9D"
-#define LV_SYMBOL_EXTRA_TRUCK_PLOW    "\xef\x9F\x9E"
-#define LV_SYMBOL_EXTRA_WREATH    "\xef\x9F\xA2"
-#define LV_SYMBOL_EXTRA_FIRE_ALT    "\xef\x9F\xA4"
-#define LV_SYMBOL_EXTRA_BACON    "\xef\x9F\xA5"
-#define LV_SYMBOL_EXTRA_BOOK_MEDICAL    "\xef\x9F\xA6"
-#define LV_SYMBOL_EXTRA_BOOK_USER    "\xef\x9F\xA7"
-#define LV_SYMBOL_EXTRA_BOOKS_MEDICAL    "\xef\x9F\xA8"
-#define LV_SYMBOL_EXTRA_BRACKETS    "\xef\x9F\xA9"
-#define LV_SYMBOL_EXTRA_BRACKETS_CURLY    "\xef\x9F\xAA"
-#define LV_SYMBOL_EXTRA_BREAD_LOAF    "\xef\x9F\xAB"
-#define LV_SYMBOL_EXTRA_BREAD_SLICE    "\xef\x9F\xAC"
-#define LV_SYMBOL_EXTRA_BURRITO    "\xef\x9F\xAD"
-#define LV_SYMBOL_EXTRA_CHART_SCATTER    "\xef\x9F\xAE"
-#define LV_SYMBOL_EXTRA_CHEESE    "\xef\x9F\xAF"
-#define LV_SYMBOL_EXTRA_CHEESE_SWISS    "\xef\x9F\xB0"
-#define LV_SYMBOL_EXTRA_CHEESEBURGER    "\xef\x9F\xB1"
-#define LV_SYMBOL_EXTRA_CLINIC_MEDICAL    "\xef\x9F\xB2"
-#define LV_SYMBOL_EXTRA_CLIPBOARD_USER    "\xef\x9F\xB3"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_MEDICAL    "\xef\x9F\xB4"
-#define LV_SYMBOL_EXTRA_COMMENT_MEDICAL    "\xef\x9F\xB5"
-#define LV_SYMBOL_EXTRA_CROISSANT    "\xef\x9F\xB6"
-#define LV_SYMBOL_EXTRA_CRUTCH    "\xef\x9F\xB7"
-#define LV_SYMBOL_EXTRA_CRUTCHES    "\xef\x9F\xB8"
-#define LV_SYMBOL_EXTRA_DEBUG    "\xef\x9F\xB9"
-#define LV_SYMBOL_EXTRA_DISEASE    "\xef\x9F\xBA"
-#define LV_SYMBOL_EXTRA_EGG    "\xef\x9F\xBB"
-#define LV_SYMBOL_EXTRA_EGG_FRIED    "\xef\x9F\xBC"
-#define LV_SYMBOL_EXTRA_FILES_MEDICAL    "\xef\x9F\xBD"
-#define LV_SYMBOL_EXTRA_FISH_COOKED    "\xef\x9F\xBE"
-#define LV_SYMBOL_EXTRA_FLOWER    "\xef\x9F\xBF"
-#define LV_SYMBOL_EXTRA_FLOWER_DAFFODIL    "\xef\xA0\x80"
-#define LV_SYMBOL_EXTRA_FLOWER_TULIP    "\xef\xA0\x81"
-#define LV_SYMBOL_EXTRA_FOLDER_TREE    "\xef\xA0\x82"
-#define LV_SYMBOL_EXTRA_FRENCH_FRIES    "\xef\xA0\x83"
-#define LV_SYMBOL_EXTRA_GLASS    "\xef\xA0\x84"
-#define LV_SYMBOL_EXTRA_HAMBURGER    "\xef\xA0\x85"
-#define LV_SYMBOL_EXTRA_HAND_MIDDLE_FINGER    "\xef\xA0\x86"
-#define LV_SYMBOL_EXTRA_HARD_HAT    "\xef\xA0\x87"
-#define LV_SYMBOL_EXTRA_HEAD_SIDE_BRAIN    "\xef\xA0\x88"
-#define LV_SYMBOL_EXTRA_HEAD_SIDE_MEDICAL    "\xef\xA0\x89"
-#define LV_SYMBOL_EXTRA_HOME_ALT    "\xef\xA0\x8A"
-#define LV_SYMBOL_EXTRA_HOME_LG    "\xef\xA0\x8B"
-#define LV_SYMBOL_EXTRA_HOME_LG_ALT    "\xef\xA0\x8C"
-#define LV_SYMBOL_EXTRA_HOSPITAL_USER    "\xef\xA0\x8D"
-#define LV_SYMBOL_EXTRA_HOSPITALS    "\xef\xA0\x8E"
-#define LV_SYMBOL_EXTRA_HOTDOG    "\xef\xA0\x8F"
-#define LV_SYMBOL_EXTRA_ICE_CREAM    "\xef\xA0\x90"
-#define LV_SYMBOL_EXTRA_ISLAND_TROPICAL    "\xef\xA0\x91"
-#define LV_SYMBOL_EXTRA_LAPTOP_MEDICAL    "\xef\xA0\x92"
-#define LV_SYMBOL_EXTRA_MAILBOX    "\xef\xA0\x93"
-#define LV_SYMBOL_EXTRA_MEAT    "\xef\xA0\x94"
-#define LV_SYMBOL_EXTRA_PAGER    "\xef\xA0\x95"
-#define LV_SYMBOL_EXTRA_PEPPER_HOT    "\xef\xA0\x96"
-#define LV_SYMBOL_EXTRA_PIZZA    "\xef\xA0\x97"
-#define LV_SYMBOL_EXTRA_PIZZA_SLICE    "\xef\xA0\x98"
-#define LV_SYMBOL_EXTRA_POPCORN    "\xef\xA0\x99"
-#define LV_SYMBOL_EXTRA_PRINT_SEARCH    "\xef\xA0\x9A"
-#define LV_SYMBOL_EXTRA_RINGS_WEDDING    "\xef\xA0\x9B"
-#define LV_SYMBOL_EXTRA_SACK    "\xef\xA0\x9C"
-#define LV_SYMBOL_EXTRA_SACK_DOLLAR    "\xef\xA0\x9D"
-#define LV_SYMBOL_EXTRA_SALAD    "\xef\xA0\x9E"
-#define LV_SYMBOL_EXTRA_SANDWICH    "\xef\xA0\x9F"
-#define LV_SYMBOL_EXTRA_SAUSAGE    "\xef\xA0\xA0"
-#define LV_SYMBOL_EXTRA_SHISH_KEBAB    "\xef\xA0\xA1"
-#define LV_SYMBOL_EXTRA_SICKLE    "\xef\xA0\xA2"
-#define LV_SYMBOL_EXTRA_SOUP    "\xef\xA0\xA3"
-#define LV_SYMBOL_EXTRA_STEAK    "\xef\xA0\xA4"
-#define LV_SYMBOL_EXTRA_STRETCHER    "\xef\xA0\xA5"
-#define LV_SYMBOL_EXTRA_TACO    "\xef\xA0\xA6"
-#define LV_SYMBOL_EXTRA_TANAKH    "\xef\xA0\xA7"
-#define LV_SYMBOL_EXTRA_TASKS_ALT    "\xef\xA0\xA8"
-#define LV_SYMBOL_EXTRA_TRASH_RESTORE    "\xef\xA0\xA9"
-#define LV_SYMBOL_EXTRA_TRASH_RESTORE_ALT    "\xef\xA0\xAA"
-#define LV_SYMBOL_EXTRA_TREE_PALM    "\xef\xA0\xAB"
-#define LV_SYMBOL_EXTRA_USER_HARD_HAT    "\xef\xA0\xAC"
-#define LV_SYMBOL_EXTRA_USER_HEADSET    "\xef\xA0\xAD"
-#define LV_SYMBOL_EXTRA_USER_MD_CHAT    "\xef\xA0\xAE"
-#define LV_SYMBOL_EXTRA_USER_NURSE    "\xef\xA0\xAF"
-#define LV_SYMBOL_EXTRA_USERS_MEDICAL    "\xef\xA0\xB0"
-#define LV_SYMBOL_EXTRA_WALKER    "\xef\xA0\xB1"
-#define LV_SYMBOL_EXTRA_WEBCAM    "\xef\xA0\xB2"
-#define LV_SYMBOL_EXTRA_WEBCAM_SLASH    "\xef\xA0\xB3"
-#define LV_SYMBOL_EXTRA_WAVE_SQUARE    "\xef\xA0\xBE"
-#define LV_SYMBOL_EXTRA_ALARM_EXCLAMATION    "\xef\xA1\x83"
-#define LV_SYMBOL_EXTRA_ALARM_PLUS    "\xef\xA1\x84"
-#define LV_SYMBOL_EXTRA_ALARM_SNOOZE    "\xef\xA1\x85"
-#define LV_SYMBOL_EXTRA_ALIGN_SLASH    "\xef\xA1\x86"
-#define LV_SYMBOL_EXTRA_BAGS_SHOPPING    "\xef\xA1\x87"
-#define LV_SYMBOL_EXTRA_BELL_EXCLAMATION    "\xef\xA1\x88"
-#define LV_SYMBOL_EXTRA_BELL_PLUS    "\xef\xA1\x89"
-#define LV_SYMBOL_EXTRA_BIKING    "\xef\xA1\x8A"
-#define LV_SYMBOL_EXTRA_BIKING_MOUNTAIN    "\xef\xA1\x8B"
-#define LV_SYMBOL_EXTRA_BORDER_ALL    "\xef\xA1\x8C"
-#define LV_SYMBOL_EXTRA_BORDER_BOTTOM    "\xef\xA1\x8D"
-#define LV_SYMBOL_EXTRA_BORDER_INNER    "\xef\xA1\x8E"
-#define LV_SYMBOL_EXTRA_BORDER_LEFT    "\xef\xA1\x8F"
-#define LV_SYMBOL_EXTRA_BORDER_NONE    "\xef\xA1\x90"
-#define LV_SYMBOL_EXTRA_BORDER_OUTER    "\xef\xA1\x91"
-#define LV_SYMBOL_EXTRA_BORDER_RIGHT    "\xef\xA1\x92"
-#define LV_SYMBOL_EXTRA_BORDER_STYLE    "\xef\xA1\x93"
-#define LV_SYMBOL_EXTRA_BORDER_STYLE_ALT    "\xef\xA1\x94"
-#define LV_SYMBOL_EXTRA_BORDER_TOP    "\xef\xA1\x95"
-#define LV_SYMBOL_EXTRA_BRING_FORWARD    "\xef\xA1\x96"
-#define LV_SYMBOL_EXTRA_BRING_FRONT    "\xef\xA1\x97"
-#define LV_SYMBOL_EXTRA_BURGER_SODA    "\xef\xA1\x98"
-#define LV_SYMBOL_EXTRA_CAR_BUILDING    "\xef\xA1\x99"
-#define LV_SYMBOL_EXTRA_CAR_BUS    "\xef\xA1\x9A"
-#define LV_SYMBOL_EXTRA_CARS    "\xef\xA1\x9B"
-#define LV_SYMBOL_EXTRA_COIN    "\xef\xA1\x9C"
-#define LV_SYMBOL_EXTRA_CONSTRUCTION    "\xef\xA1\x9D"
-#define LV_SYMBOL_EXTRA_DIGGING    "\xef\xA1\x9E"
-#define LV_SYMBOL_EXTRA_DRONE    "\xef\xA1\x9F"
-#define LV_SYMBOL_EXTRA_DRONE_ALT    "\xef\xA1\xA0"
-#define LV_SYMBOL_EXTRA_DRYER    "\xef\xA1\xA1"
-#define LV_SYMBOL_EXTRA_DRYER_ALT    "\xef\xA1\xA2"
-#define LV_SYMBOL_EXTRA_FAN    "\xef\xA1\xA3"
-#define LV_SYMBOL_EXTRA_FARM    "\xef\xA1\xA4"
-#define LV_SYMBOL_EXTRA_FILE_SEARCH    "\xef\xA1\xA5"
-#define LV_SYMBOL_EXTRA_FONT_CASE    "\xef\xA1\xA6"
-#define LV_SYMBOL_EXTRA_GAME_BOARD    "\xef\xA1\xA7"
-#define LV_SYMBOL_EXTRA_GAME_BOARD_ALT    "\xef\xA1\xA8"
-#define LV_SYMBOL_EXTRA_GLASS_CITRUS    "\xef\xA1\xA9"
-#define LV_SYMBOL_EXTRA_H4    "\xef\xA1\xAA"
-#define LV_SYMBOL_EXTRA_HAT_CHEF    "\xef\xA1\xAB"
-#define LV_SYMBOL_EXTRA_HORIZONTAL_RULE    "\xef\xA1\xAC"
-#define LV_SYMBOL_EXTRA_ICONS    "\xef\xA1\xAD"
-#define LV_SYMBOL_EXTRA_ICONS_ALT    "\xef\xA1\xAE"
-#define LV_SYMBOL_EXTRA_KERNING    "\xef\xA1\xAF"
-#define LV_SYMBOL_EXTRA_LINE_COLUMNS    "\xef\xA1\xB0"
-#define LV_SYMBOL_EXTRA_LINE_HEIGHT    "\xef\xA1\xB1"
-#define LV_SYMBOL_EXTRA_MONEY_CHECK_EDIT    "\xef\xA1\xB2"
-#define LV_SYMBOL_EXTRA_MONEY_CHECK_EDIT_ALT    "\xef\xA1\xB3"
-#define LV_SYMBOL_EXTRA_MUG    "\xef\xA1\xB4"
-#define LV_SYMBOL_EXTRA_MUG_TEA    "\xef\xA1\xB5"
-#define LV_SYMBOL_EXTRA_OVERLINE    "\xef\xA1\xB6"
-#define LV_SYMBOL_EXTRA_PAGE_BREAK    "\xef\xA1\xB7"
-#define LV_SYMBOL_EXTRA_PARAGRAPH_RTL    "\xef\xA1\xB8"
-#define LV_SYMBOL_EXTRA_PHONE_ALT    "\xef\xA1\xB9"
-#define LV_SYMBOL_EXTRA_PHONE_LAPTOP    "\xef\xA1\xBA"
-#define LV_SYMBOL_EXTRA_PHONE_SQUARE_ALT    "\xef\xA1\xBB"
-#define LV_SYMBOL_EXTRA_PHOTO_VIDEO    "\xef\xA1\xBC"
-#define LV_SYMBOL_EXTRA_REMOVE_FORMAT    "\xef\xA1\xBD"
-#define LV_SYMBOL_EXTRA_SEND_BACK    "\xef\xA1\xBE"
-#define LV_SYMBOL_EXTRA_SEND_BACKWARD    "\xef\xA1\xBF"
-#define LV_SYMBOL_EXTRA_SNOOZE    "\xef\xA2\x80"
-#define LV_SYMBOL_EXTRA_SORT_ALPHA_DOWN_ALT    "\xef\xA2\x81"
-#define LV_SYMBOL_EXTRA_SORT_ALPHA_UP_ALT    "\xef\xA2\x82"
-#define LV_SYMBOL_EXTRA_SORT_ALT    "\xef\xA2\x83"
-#define LV_SYMBOL_EXTRA_SORT_AMOUNT_DOWN_ALT    "\xef\xA2\x84"
-#define LV_SYMBOL_EXTRA_SORT_AMOUNT_UP_ALT    "\xef\xA2\x85"
-#define LV_SYMBOL_EXTRA_SORT_NUMERIC_DOWN_ALT    "\xef\xA2\x86"
-#define LV_SYMBOL_EXTRA_SORT_NUMERIC_UP_ALT    "\xef\xA2\x87"
-#define LV_SYMBOL_EXTRA_SORT_SHAPES_DOWN    "\xef\xA2\x88"
-#define LV_SYMBOL_EXTRA_SORT_SHAPES_DOWN_ALT    "\xef\xA2\x89"
-#define LV_SYMBOL_EXTRA_SORT_SHAPES_UP    "\xef\xA2\x8A"
-#define LV_SYMBOL_EXTRA_SORT_SHAPES_UP_ALT    "\xef\xA2\x8B"
-#define LV_SYMBOL_EXTRA_SORT_SIZE_DOWN    "\xef\xA2\x8C"
-#define LV_SYMBOL_EXTRA_SORT_SIZE_DOWN_ALT    "\xef\xA2\x8D"
-#define LV_SYMBOL_EXTRA_SORT_SIZE_UP    "\xef\xA2\x8E"
-#define LV_SYMBOL_EXTRA_SORT_SIZE_UP_ALT    "\xef\xA2\x8F"
-#define LV_SYMBOL_EXTRA_SPARKLES    "\xef\xA2\x90"
-#define LV_SYMBOL_EXTRA_SPELL_CHECK    "\xef\xA2\x91"
-#define LV_SYMBOL_EXTRA_SUNGLASSES    "\xef\xA2\x92"
-#define LV_SYMBOL_EXTRA_TEXT    "\xef\xA2\x93"
-#define LV_SYMBOL_EXTRA_TEXT_SIZE    "\xef\xA2\x94"
-#define LV_SYMBOL_EXTRA_TRASH_UNDO    "\xef\xA2\x95"
-#define LV_SYMBOL_EXTRA_TRASH_UNDO_ALT    "\xef\xA2\x96"
-#define LV_SYMBOL_EXTRA_VOICEMAIL    "\xef\xA2\x97"
-#define LV_SYMBOL_EXTRA_WASHER    "\xef\xA2\x98"
-#define LV_SYMBOL_EXTRA_WAVE_SINE    "\xef\xA2\x99"
-#define LV_SYMBOL_EXTRA_WAVE_TRIANGLE    "\xef\xA2\x9A"
-#define LV_SYMBOL_EXTRA_WIND_TURBINE    "\xef\xA2\x9B"
-#define LV_SYMBOL_EXTRA_BORDER_CENTER_H    "\xef\xA2\x9C"
-#define LV_SYMBOL_EXTRA_BORDER_CENTER_V    "\xef\xA2\x9D"
-#define LV_SYMBOL_EXTRA_ALBUM    "\xef\xA2\x9F"
-#define LV_SYMBOL_EXTRA_ALBUM_COLLECTION    "\xef\xA2\xA0"
-#define LV_SYMBOL_EXTRA_AMP_GUITAR    "\xef\xA2\xA1"
-#define LV_SYMBOL_EXTRA_BADGE_SHERIFF    "\xef\xA2\xA2"
-#define LV_SYMBOL_EXTRA_BANJO    "\xef\xA2\xA3"
-#define LV_SYMBOL_EXTRA_BETAMAX    "\xef\xA2\xA4"
-#define LV_SYMBOL_EXTRA_BOOMBOX    "\xef\xA2\xA5"
-#define LV_SYMBOL_EXTRA_CACTUS    "\xef\xA2\xA7"
-#define LV_SYMBOL_EXTRA_CAMCORDER    "\xef\xA2\xA8"
-#define LV_SYMBOL_EXTRA_CAMERA_MOVIE    "\xef\xA2\xA9"
-#define LV_SYMBOL_EXTRA_CAMERA_POLAROID    "\xef\xA2\xAA"
-#define LV_SYMBOL_EXTRA_CASSETTE_TAPE    "\xef\xA2\xAB"
-#define LV_SYMBOL_EXTRA_CCTV    "\xef\xA2\xAC"
-#define LV_SYMBOL_EXTRA_CLARINET    "\xef\xA2\xAD"
-#define LV_SYMBOL_EXTRA_CLOUD_MUSIC    "\xef\xA2\xAE"
-#define LV_SYMBOL_EXTRA_COMMENT_ALT_MUSIC    "\xef\xA2\xAF"
-#define LV_SYMBOL_EXTRA_COMMENT_MUSIC    "\xef\xA2\xB0"
-#define LV_SYMBOL_EXTRA_COMPUTER_CLASSIC    "\xef\xA2\xB1"
-#define LV_SYMBOL_EXTRA_COMPUTER_SPEAKER    "\xef\xA2\xB2"
-#define LV_SYMBOL_EXTRA_COWBELL    "\xef\xA2\xB3"
-#define LV_SYMBOL_EXTRA_COWBELL_MORE    "\xef\xA2\xB4"
-#define LV_SYMBOL_EXTRA_DISC_DRIVE    "\xef\xA2\xB5"
-#define LV_SYMBOL_EXTRA_FILE_MUSIC    "\xef\xA2\xB6"
-#define LV_SYMBOL_EXTRA_FILM_CANISTER    "\xef\xA2\xB7"
-#define LV_SYMBOL_EXTRA_FLASHLIGHT    "\xef\xA2\xB8"
-#define LV_SYMBOL_EXTRA_FLUTE    "\xef\xA2\xB9"
-#define LV_SYMBOL_EXTRA_FLUX_CAPACITOR    "\xef\xA2\xBA"
-#define LV_SYMBOL_EXTRA_GAME_CONSOLE_HANDHELD    "\xef\xA2\xBB"
-#define LV_SYMBOL_EXTRA_GAMEPAD_ALT    "\xef\xA2\xBC"
-#define LV_SYMBOL_EXTRA_GRAMOPHONE    "\xef\xA2\xBD"
-#define LV_SYMBOL_EXTRA_GUITAR_ELECTRIC    "\xef\xA2\xBE"
-#define LV_SYMBOL_EXTRA_GUITARS    "\xef\xA2\xBF"
-#define LV_SYMBOL_EXTRA_HAT_COWBOY    "\xef\xA3\x80"
-#define LV_SYMBOL_EXTRA_HAT_COWBOY_SIDE    "\xef\xA3\x81"
-#define LV_SYMBOL_EXTRA_HEAD_SIDE_HEADPHONES    "\xef\xA3\x82"
-#define LV_SYMBOL_EXTRA_HORSE_SADDLE    "\xef\xA3\x83"
-#define LV_SYMBOL_EXTRA_IMAGE_POLAROID    "\xef\xA3\x84"
-#define LV_SYMBOL_EXTRA_JOYSTICK    "\xef\xA3\x85"
-#define LV_SYMBOL_EXTRA_JUG    "\xef\xA3\x86"
-#define LV_SYMBOL_EXTRA_KAZOO    "\xef\xA3\x87"
-#define LV_SYMBOL_EXTRA_LASSO    "\xef\xA3\x88"
-#define LV_SYMBOL_EXTRA_LIST_MUSIC    "\xef\xA3\x89"
-#define LV_SYMBOL_EXTRA_MICROPHONE_STAND    "\xef\xA3\x8B"
-#define LV_SYMBOL_EXTRA_MOUSE    "\xef\xA3\x8C"
-#define LV_SYMBOL_EXTRA_MOUSE_ALT    "\xef\xA3\x8D"
-#define LV_SYMBOL_EXTRA_MP3_PLAYER    "\xef\xA3\x8E"
-#define LV_SYMBOL_EXTRA_MUSIC_ALT    "\xef\xA3\x8F"
-#define LV_SYMBOL_EXTRA_MUSIC_ALT_SLASH    "\xef\xA3\x90"
-#define LV_SYMBOL_EXTRA_MUSIC_SLASH    "\xef\xA3\x91"
-#define LV_SYMBOL_EXTRA_PHONE_ROTARY    "\xef\xA3\x93"
-#define LV_SYMBOL_EXTRA_PIANO    "\xef\xA3\x94"
-#define LV_SYMBOL_EXTRA_PIANO_KEYBOARD    "\xef\xA3\x95"
-#define LV_SYMBOL_EXTRA_PROJECTOR    "\xef\xA3\x96"
-#define LV_SYMBOL_EXTRA_RADIO    "\xef\xA3\x97"
-#define LV_SYMBOL_EXTRA_RADIO_ALT    "\xef\xA3\x98"
-#define LV_SYMBOL_EXTRA_RECORD_VINYL    "\xef\xA3\x99"
-#define LV_SYMBOL_EXTRA_ROUTER    "\xef\xA3\x9A"
-#define LV_SYMBOL_EXTRA_SAX_HOT    "\xef\xA3\x9B"
-#define LV_SYMBOL_EXTRA_SAXOPHONE    "\xef\xA3\x9C"
-#define LV_SYMBOL_EXTRA_SIGNAL_STREAM    "\xef\xA3\x9D"
-#define LV_SYMBOL_EXTRA_SKULL_COW    "\xef\xA3\x9E"
-#define LV_SYMBOL_EXTRA_SPEAKER    "\xef\xA3\x9F"
-#define LV_SYMBOL_EXTRA_SPEAKERS    "\xef\xA3\xA0"
-#define LV_SYMBOL_EXTRA_TRIANGLE_MUSIC    "\xef\xA3\xA2"
-#define LV_SYMBOL_EXTRA_TRUMPET    "\xef\xA3\xA3"
-#define LV_SYMBOL_EXTRA_TURNTABLE    "\xef\xA3\xA4"
-#define LV_SYMBOL_EXTRA_TV_ALT    "\xef\xA3\xA5"
-#define LV_SYMBOL_EXTRA_TV_MUSIC    "\xef\xA3\xA6"
-#define LV_SYMBOL_EXTRA_TYPEWRITER    "\xef\xA3\xA7"
-#define LV_SYMBOL_EXTRA_USB_DRIVE    "\xef\xA3\xA9"
-#define LV_SYMBOL_EXTRA_USER_COWBOY    "\xef\xA3\xAA"
-#define LV_SYMBOL_EXTRA_USER_MUSIC    "\xef\xA3\xAB"
-#define LV_SYMBOL_EXTRA_VHS    "\xef\xA3\xAC"
-#define LV_SYMBOL_EXTRA_VIOLIN    "\xef\xA3\xAD"
-#define LV_SYMBOL_EXTRA_WAGON_COVERED    "\xef\xA3\xAE"
-#define LV_SYMBOL_EXTRA_WALKIE_TALKIE    "\xef\xA3\xAF"
-#define LV_SYMBOL_EXTRA_WATCH_CALCULATOR    "\xef\xA3\xB0"
-#define LV_SYMBOL_EXTRA_WAVEFORM    "\xef\xA3\xB1"
-#define LV_SYMBOL_EXTRA_WAVEFORM_PATH    "\xef\xA3\xB2"
-#define LV_SYMBOL_EXTRA_SCANNER_IMAGE    "\xef\xA3\xB3"
-#define LV_SYMBOL_EXTRA_AIR_CONDITIONER    "\xef\xA3\xB4"
-#define LV_SYMBOL_EXTRA_ALIEN    "\xef\xA3\xB5"
-#define LV_SYMBOL_EXTRA_ALIEN_MONSTER    "\xef\xA3\xB6"
-#define LV_SYMBOL_EXTRA_BED_ALT    "\xef\xA3\xB7"
-#define LV_SYMBOL_EXTRA_BED_BUNK    "\xef\xA3\xB8"
-#define LV_SYMBOL_EXTRA_BED_EMPTY    "\xef\xA3\xB9"
-#define LV_SYMBOL_EXTRA_BELL_ON    "\xef\xA3\xBA"
-#define LV_SYMBOL_EXTRA_BLINDS    "\xef\xA3\xBB"
-#define LV_SYMBOL_EXTRA_BLINDS_OPEN    "\xef\xA3\xBC"
-#define LV_SYMBOL_EXTRA_BLINDS_RAISED    "\xef\xA3\xBD"
-#define LV_SYMBOL_EXTRA_CAMERA_HOME    "\xef\xA3\xBE"
-#define LV_SYMBOL_EXTRA_CARAVAN    "\xef\xA3\xBF"
-#define LV_SYMBOL_EXTRA_CARAVAN_ALT    "\xef\xA4\x80"
-#define LV_SYMBOL_EXTRA_CAT_SPACE    "\xef\xA4\x81"
-#define LV_SYMBOL_EXTRA_COFFEE_POT    "\xef\xA4\x82"
-#define LV_SYMBOL_EXTRA_COMET    "\xef\xA4\x83"
-#define LV_SYMBOL_EXTRA_FAN_TABLE    "\xef\xA4\x84"
-#define LV_SYMBOL_EXTRA_FAUCET    "\xef\xA4\x85"
-#define LV_SYMBOL_EXTRA_FAUCET_DRIP    "\xef\xA4\x86"
-#define LV_SYMBOL_EXTRA_GALAXY    "\xef\xA4\x88"
-#define LV_SYMBOL_EXTRA_GARAGE    "\xef\xA4\x89"
-#define LV_SYMBOL_EXTRA_GARAGE_CAR    "\xef\xA4\x8A"
-#define LV_SYMBOL_EXTRA_GARAGE_OPEN    "\xef\xA4\x8B"
-#define LV_SYMBOL_EXTRA_HEAT    "\xef\xA4\x8C"
-#define LV_SYMBOL_EXTRA_HOUSE    "\xef\xA4\x8D"
-#define LV_SYMBOL_EXTRA_HOUSE_DAY    "\xef\xA4\x8E"
-#define LV_SYMBOL_EXTRA_HOUSE_LEAVE    "\xef\xA4\x8F"
-#define LV_SYMBOL_EXTRA_HOUSE_NIGHT    "\xef\xA4\x90"
-#define LV_SYMBOL_EXTRA_HOUSE_RETURN    "\xef\xA4\x91"
-#define LV_SYMBOL_EXTRA_HOUSE_SIGNAL    "\xef\xA4\x92"
-#define LV_SYMBOL_EXTRA_LAMP_DESK    "\xef\xA4\x94"
-#define LV_SYMBOL_EXTRA_LAMP_FLOOR    "\xef\xA4\x95"
-#define LV_SYMBOL_EXTRA_LIGHT_CEILING    "\xef\xA4\x96"
-#define LV_SYMBOL_EXTRA_LIGHT_SWITCH    "\xef\xA4\x97"
-#define LV_SYMBOL_EXTRA_LIGHT_SWITCH_OFF    "\xef\xA4\x98"
-#define LV_SYMBOL_EXTRA_LIGHT_SWITCH_ON    "\xef\xA4\x99"
-#define LV_SYMBOL_EXTRA_MICROWAVE    "\xef\xA4\x9B"
-#define LV_SYMBOL_EXTRA_OUTLET    "\xef\xA4\x9C"
-#define LV_SYMBOL_EXTRA_OVEN    "\xef\xA4\x9D"
-#define LV_SYMBOL_EXTRA_PLANET_MOON    "\xef\xA4\x9F"
-#define LV_SYMBOL_EXTRA_PLANET_RINGED    "\xef\xA4\xA0"
-#define LV_SYMBOL_EXTRA_POLICE_BOX    "\xef\xA4\xA1"
-#define LV_SYMBOL_EXTRA_PORTAL_ENTER    "\xef\xA4\xA2"
-#define LV_SYMBOL_EXTRA_PORTAL_EXIT    "\xef\xA4\xA3"
-#define LV_SYMBOL_EXTRA_RADAR    "\xef\xA4\xA4"
-#define LV_SYMBOL_EXTRA_RAYGUN    "\xef\xA4\xA5"
-#define LV_SYMBOL_EXTRA_REFRIGERATOR    "\xef\xA4\xA6"
-#define LV_SYMBOL_EXTRA_ROCKET_LAUNCH    "\xef\xA4\xA7"
-#define LV_SYMBOL_EXTRA_SENSOR    "\xef\xA4\xA8"
-#define LV_SYMBOL_EXTRA_SENSOR_ALERT    "\xef\xA4\xA9"
-#define LV_SYMBOL_EXTRA_SENSOR_FIRE    "\xef\xA4\xAA"
-#define LV_SYMBOL_EXTRA_SENSOR_ON    "\xef\xA4\xAB"
-#define LV_SYMBOL_EXTRA_SENSOR_SMOKE    "\xef\xA4\xAC"
-#define LV_SYMBOL_EXTRA_SIREN    "\xef\xA4\xAD"
-#define LV_SYMBOL_EXTRA_SIREN_ON    "\xef\xA4\xAE"
-#define LV_SYMBOL_EXTRA_SOLAR_SYSTEM    "\xef\xA4\xAF"
-#define LV_SYMBOL_EXTRA_SORT_CIRCLE    "\xef\xA4\xB0"
-#define LV_SYMBOL_EXTRA_SORT_CIRCLE_DOWN    "\xef\xA4\xB1"
-#define LV_SYMBOL_EXTRA_SORT_CIRCLE_UP    "\xef\xA4\xB2"
-#define LV_SYMBOL_EXTRA_SPACE_STATION_MOON    "\xef\xA4\xB3"
-#define LV_SYMBOL_EXTRA_SPACE_STATION_MOON_ALT    "\xef\xA4\xB4"
-#define LV_SYMBOL_EXTRA_SPRINKLER    "\xef\xA4\xB5"
-#define LV_SYMBOL_EXTRA_STAR_SHOOTING    "\xef\xA4\xB6"
-#define LV_SYMBOL_EXTRA_STARFIGHTER    "\xef\xA4\xB7"
-#define LV_SYMBOL_EXTRA_STARFIGHTER_ALT    "\xef\xA4\xB8"
-#define LV_SYMBOL_EXTRA_STARSHIP    "\xef\xA4\xB9"
-#define LV_SYMBOL_EXTRA_STARSHIP_FREIGHTER    "\xef\xA4\xBA"
-#define LV_SYMBOL_EXTRA_SWORD_LASER    "\xef\xA4\xBB"
-#define LV_SYMBOL_EXTRA_SWORD_LASER_ALT    "\xef\xA4\xBC"
-#define LV_SYMBOL_EXTRA_SWORDS_LASER    "\xef\xA4\xBD"
-#define LV_SYMBOL_EXTRA_TELESCOPE    "\xef\xA4\xBE"
-#define LV_SYMBOL_EXTRA_TEMPERATURE_DOWN    "\xef\xA4\xBF"
-#define LV_SYMBOL_EXTRA_TEMPERATURE_UP    "\xef\xA5\x80"
-#define LV_SYMBOL_EXTRA_TRAILER    "\xef\xA5\x81"
-#define LV_SYMBOL_EXTRA_TRANSPORTER    "\xef\xA5\x82"
-#define LV_SYMBOL_EXTRA_TRANSPORTER_1    "\xef\xA5\x83"
-#define LV_SYMBOL_EXTRA_TRANSPORTER_2    "\xef\xA5\x84"
-#define LV_SYMBOL_EXTRA_TRANSPORTER_3    "\xef\xA5\x85"
-#define LV_SYMBOL_EXTRA_TRANSPORTER_EMPTY    "\xef\xA5\x86"
-#define LV_SYMBOL_EXTRA_UFO    "\xef\xA5\x87"
-#define LV_SYMBOL_EXTRA_UFO_BEAM    "\xef\xA5\x88"
-#define LV_SYMBOL_EXTRA_USER_ALIEN    "\xef\xA5\x8A"
-#define LV_SYMBOL_EXTRA_USER_ROBOT    "\xef\xA5\x8B"
-#define LV_SYMBOL_EXTRA_USER_VISOR    "\xef\xA5\x8C"
-#define LV_SYMBOL_EXTRA_VACUUM    "\xef\xA5\x8D"
-#define LV_SYMBOL_EXTRA_VACUUM_ROBOT    "\xef\xA5\x8E"
-#define LV_SYMBOL_EXTRA_WINDOW_FRAME    "\xef\xA5\x8F"
-#define LV_SYMBOL_EXTRA_WINDOW_FRAME_OPEN    "\xef\xA5\x90"
-#define LV_SYMBOL_EXTRA_COFFIN_CROSS    "\xef\xA5\x91"
-#define LV_SYMBOL_EXTRA_FOLDER_DOWNLOAD    "\xef\xA5\x93"
-#define LV_SYMBOL_EXTRA_FOLDER_UPLOAD    "\xef\xA5\x94"
-#define LV_SYMBOL_EXTRA_USER_UNLOCK    "\xef\xA5\x98"
-#define LV_SYMBOL_EXTRA_BACTERIA    "\xef\xA5\x99"
-#define LV_SYMBOL_EXTRA_BACTERIUM    "\xef\xA5\x9A"
-#define LV_SYMBOL_EXTRA_BOX_TISSUE    "\xef\xA5\x9B"
-#define LV_SYMBOL_EXTRA_HAND_HOLDING_MEDICAL    "\xef\xA5\x9C"
-#define LV_SYMBOL_EXTRA_HAND_SPARKLES    "\xef\xA5\x9D"
-#define LV_SYMBOL_EXTRA_HANDS_WASH    "\xef\xA5\x9E"
-#define LV_SYMBOL_EXTRA_HANDSHAKE_ALT_SLASH    "\xef\xA5\x9F"
-#define LV_SYMBOL_EXTRA_HANDSHAKE_SLASH "\xef\xA5\xA0"
-#define LV_SYMBOL_EXTRA_HEAD_SIDE_COUGH "\xef\xA5\xA1"
-#define LV_SYMBOL_EXTRA_HEAD_SIDE_COUGH_SLASH    "\xef\xA5\xA2"
-#define LV_SYMBOL_EXTRA_HEAD_SIDE_MASK  "\xef\xA5\xA3"
-#define LV_SYMBOL_EXTRA_HEAD_SIDE_VIRUS "\xef\xA5\xA4"
-#define LV_SYMBOL_EXTRA_HOUSE_USER      "\xef\xA5\xA5"
-#define LV_SYMBOL_EXTRA_LAPTOP_HOUSE    "\xef\xA5\xA6"
-#define LV_SYMBOL_EXTRA_LUNGS_VIRUS     "\xef\xA5\xA7"
-#define LV_SYMBOL_EXTRA_PEOPLE_ARROWS    "\xef\xA5\xA8"
-#define LV_SYMBOL_EXTRA_PLANE_SLASH     "\xef\xA5\xA9"
-#define LV_SYMBOL_EXTRA_PUMP_MEDICAL    "\xef\xA5\xAA"
-#define LV_SYMBOL_EXTRA_PUMP_SOAP       "\xef\xA5\xAB"
-#define LV_SYMBOL_EXTRA_SHIELD_VIRUS    "\xef\xA5\xAC"
-#define LV_SYMBOL_EXTRA_SINK            "\xef\xA5\xAD"
-#define LV_SYMBOL_EXTRA_SOAP            "\xef\xA5\xAE"
-#define LV_SYMBOL_EXTRA_STOPWATCH_20    "\xef\xA5\xAF"
-#define LV_SYMBOL_EXTRA_STORE_ALT_SLASH "\xef\xA5\xB0"
-#define LV_SYMBOL_EXTRA_STORE_SLASH     "\xef\xA5\xB1"
-#define LV_SYMBOL_EXTRA_TOILET_PAPER_SLASH  "\xef\xA5\xB2"
-#define LV_SYMBOL_EXTRA_USERS_SLASH     "\xef\xA5\xB3"
-#define LV_SYMBOL_EXTRA_VIRUS           "\xef\xA5\xB4"
-#define LV_SYMBOL_EXTRA_VIRUS_SLASH     "\xef\xA5\xB5"
-#define LV_SYMBOL_EXTRA_VIRUSES         "\xef\xA5\xB6"
-
-/* Extra fonts difined by users */
-#define LV_SYMBOL_EXTRA_HOME_SOLID      "\xef\xA6\xA0"
-#define LV_SYMBOL_EXTRA_MUSIC_SOLID     "\xef\xA6\xA5"
-#define LV_SYMBOL_EXTRA_SETTING_SOLID   "\xef\xA6\xA2"
-#define LV_SYMBOL_EXTRA_APP_SOLID       "\xef\xA6\xA3"
-#define LV_SYMBOL_EXTRA_WIFI_SOLID      "\xef\xA6\xA4"
-#define LV_SYMBOL_EXTRA_CLOUD_CHECK     "\xef\xa5\xb7"
-
-#ifdef __cplusplus
-} /* extern "C" */
-#endif
-
-
-#endif /*LV_SYMBOL_EXTRA_DEF_H*/
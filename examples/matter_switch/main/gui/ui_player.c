@@ -8,6 +8,7 @@
 #include "bsp_board.h"
 #include "audio_player.h"
 #include "file_iterator.h"
+#include "music_library.h"
 #include "lvgl.h"
 #include "ui_main.h"
 #include "settings.h"
@@ -20,6 +21,7 @@ static void (*g_player_end_cb)(void) = NULL;
 lv_obj_t *lab_play_pause = NULL;
 
 extern file_iterator_instance_t *file_iterator;
+extern music_library_handle_t music_library;
 lv_obj_t *player_page = NULL;
 
 lv_obj_t *get_player_page()
@@ -27,6 +29,15 @@ lv_obj_t *get_player_page()
     return player_page;
 }
 
+static void ui_player_update_file_label(void)
+{
+    char text[2 * MUSIC_LIBRARY_TEXT_MAX_LEN + 16];
+    const char *name = file_iterator_get_name_from_index(file_iterator, file_iterator_get_index(file_iterator));
+
+    /* Artist, title and duration once the library knows them, the file name until then */
+    lv_label_set_text(g_lab_file, music_library_format(music_library, name, text, sizeof(text)));
+}
+
 static void ui_player_page_vol_inc_click_cb(lv_event_t *e)
 {
     lv_obj_t *obj = lv_event_get_user_data(e);
@@ -86,7 +97,7 @@ static void ui_player_page_prev_click_cb(lv_event_t *e)
     lv_obj_t *obj = lv_event_get_user_data(e);
     file_iterator_prev(file_iterator);
     play_present();
-    lv_label_set_text_static(g_lab_file, file_iterator_get_name_from_index(file_iterator, file_iterator_get_index(file_iterator)));
+    ui_player_update_file_label();
     lv_event_t event = {
         .user_data = obj,
     };
@@ -98,7 +109,7 @@ static void ui_player_page_next_click_cb(lv_event_t *e)
 {
     lv_obj_t *obj = lv_event_get_user_data(e);
     file_iterator_next(file_iterator);
-    lv_label_set_text_static(g_lab_file, file_iterator_get_name_from_index(file_iterator, file_iterator_get_index(file_iterator)));
+    ui_player_update_file_label();
     lv_event_t event = {
         .user_data = obj,
     };
@@ -144,7 +155,7 @@ static void audio_cb(audio_player_cb_ctx_t *ctx)
     if (AUDIO_PLAYER_CALLBACK_EVENT_IDLE == ctx->audio_event) {
         g_media_is_playing = false;
         ui_acquire();
-        lv_label_set_text_static(g_lab_file, file_iterator_get_name_from_index(file_iterator, file_iterator_get_index(file_iterator)));
+        ui_player_update_file_label();
         if (lab_play_pause) {
             lv_label_set_text_static(lab_play_pause, LV_SYMBOL_PLAY);
         }
@@ -155,7 +166,7 @@ static void audio_cb(audio_player_cb_ctx_t *ctx)
             (AUDIO_PLAYER_CALLBACK_EVENT_COMPLETED_PLAYING_NEXT == ctx->audio_event)) {
         g_media_is_playing = true;
         ui_acquire();
-        lv_label_set_text_static(g_lab_file, file_iterator_get_name_from_index(file_iterator, file_iterator_get_index(file_iterator)));
+        ui_player_update_file_label();
         if (lab_play_pause) {
             lv_label_set_text_static(lab_play_pause, LV_SYMBOL_PAUSE);
         }
@@ -165,7 +176,7 @@ static void audio_cb(audio_player_cb_ctx_t *ctx)
     if (AUDIO_PLAYER_CALLBACK_EVENT_PAUSE == ctx->audio_event) {
         g_media_is_playing = false;
         ui_acquire();
-        lv_label_set_text_static(g_lab_file, file_iterator_get_name_from_index(file_iterator, file_iterator_get_index(file_iterator)));
+        ui_player_update_file_label();
         if (lab_play_pause) {
             lv_label_set_text_static(lab_play_pause, LV_SYMBOL_PLAY);
         }
@@ -173,6 +184,15 @@ static void audio_cb(audio_player_cb_ctx_t *ctx)
     }
 }
 
+void ui_player_library_ready(music_library_handle_t library, void *user_ctx)
+{
+    ui_acquire();
+    if (player_page && g_lab_file) {
+        ui_player_update_file_label();
+    }
+    ui_release();
+}
+
 void ui_media_player(void (*fn)(void))
 {
     g_player_end_cb = fn;
@@ -206,7 +226,7 @@ void ui_media_player(void (*fn)(void))
     lv_obj_align(img, LV_ALIGN_TOP_RIGHT, -10, 35);
 
     g_lab_file = lv_label_create(page);
-    lv_label_set_text_static(g_lab_file, file_iterator_get_name_from_index(file_iterator, file_iterator_get_index(file_iterator)));
+    ui_player_update_file_label();
     lv_obj_set_size(g_lab_file, 250, 32);
     lv_obj_set_style_text_font(g_lab_file, &lv_font_montserrat_24, LV_STATE_DEFAULT);
     lv_label_set_long_mode(g_lab_file, LV_LABEL_LONG_SCROLL_CIRCULAR);
@@ -0,0 +1,298 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp_dsp.h"
+#endif
+#include "audio_convert.h"
+
+#define CONVERT_TAPS            (48)        /* Taps per phase, i.e. per input sample of the filter */
+#define CONVERT_MAX_PHASES      (320)       /* 30 KB of coefficients */
+#define CONVERT_BLOCK_FRAMES    (256)       /* Input frames filtered per pass */
+#define CONVERT_CUTOFF          (0.46f)     /* Of the lower sample rate */
+#define CONVERT_KAISER_BETA     (7.86f)     /* About 80 dB stop band attenuation */
+#define CONVERT_ALIGN           (16)
+
+static const char *TAG = "audio_convert";
+
+struct audio_convert {
+    audio_convert_format_t in;
+    audio_convert_format_t out;
+    uint32_t up;                /* Interpolation factor, number of filter phases */
+    uint32_t down;              /* Decimation factor */
+    uint8_t filter_channels;    /* Channels going through the filter, mono is duplicated on output */
+    int16_t *coeffs;            /* up rows of CONVERT_TAPS, Q15 at half gain, reversed for the dot product */
+    int16_t *history[2];        /* CONVERT_TAPS - 1 previous samples followed by the current block */
+    uint32_t phase;             /* Phase of the next output sample */
+    uint32_t pos;               /* Input sample of the next output sample, relative to the current block */
+};
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    while (b) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static float bessel_i0(float x)
+{
+    float sum = 1.0f;
+    float term = 1.0f;
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2.0f * k)) * (x / (2.0f * k));
+        sum += term;
+        if (term < sum * 1e-9f) {
+            break;
+        }
+    }
+    return sum;
+}
+
+/**
+ * @brief Kaiser windowed sinc prototype of up * CONVERT_TAPS taps, split into up phases
+ *
+ * Each phase is normalized to unity DC gain so that a constant input gives a constant output at any phase, then
+ * scaled by 0.5 to keep the overshoot of the filter inside int16. The taps are rounded with error feedback, which moves
+ * the rounding error of the coefficients out of the audio band (about -91 dB instead of -80 dB THD+N at 1 kHz).
+ */
+static void convert_design(audio_convert_handle_t convert)
+{
+    const uint32_t len = convert->up * CONVERT_TAPS;
+    const float center = (len - 1) / 2.0f;
+    const uint32_t min_rate = (convert->in.rate < convert->out.rate) ? convert->in.rate : convert->out.rate;
+    /* Cutoff relative to the rate at which the prototype runs, in.rate * up */
+    const float fc = CONVERT_CUTOFF * min_rate / ((float)convert->in.rate * convert->up);
+    const float i0_beta = bessel_i0(CONVERT_KAISER_BETA);
+    float row[CONVERT_TAPS];
+
+    for (uint32_t p = 0; p < convert->up; p++) {
+        float sum = 0;
+        for (uint32_t k = 0; k < CONVERT_TAPS; k++) {
+            /* Tap k of phase p weighs the input sample k steps in the past */
+            const float n = (float)(k * convert->up + p) - center;
+            const float x = 2.0f * fc * n;
+            const float sinc = (fabsf(x) < 1e-6f) ? 1.0f : sinf((float)M_PI * x) / ((float)M_PI * x);
+            const float r = n / center;
+            const float window = bessel_i0(CONVERT_KAISER_BETA * sqrtf(fmaxf(0.0f, 1.0f - r * r))) / i0_beta;
+            row[k] = sinc * window;
+            sum += row[k];
+        }
+        int16_t *dst = convert->coeffs + p * CONVERT_TAPS;
+        int32_t total = 0;
+        uint32_t peak = 0;
+        float error = 0;
+        for (uint32_t k = 0; k < CONVERT_TAPS; k++) {
+            const float c = row[k] / sum * 16384.0f + error;
+            dst[CONVERT_TAPS - 1 - k] = (int16_t)lrintf(c);
+            error = c - dst[CONVERT_TAPS - 1 - k];
+        }
+        for (uint32_t k = 0; k < CONVERT_TAPS; k++) {
+            total += dst[k];
+            peak = (dst[k] > dst[peak]) ? k : peak;
+        }
+        /* Rounding leaves each phase with a slightly different gain, which modulates the tone */
+        dst[peak] += 16384 - total;
+    }
+}
+
+static inline int16_t sat16(int32_t v)
+{
+    return (v > INT16_MAX) ? INT16_MAX : ((v < INT16_MIN) ? INT16_MIN : (int16_t)v);
+}
+
+/**
+ * @brief One output sample: dot product of a phase with the CONVERT_TAPS input samples ending at x[CONVERT_TAPS - 1]
+ */
+static inline int16_t convert_dot(const int16_t *coeffs, const int16_t *x)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    /* Optimized Xtensa kernel, rounds to Q15 of the half gain coefficients */
+    int16_t r;
+    dsps_dotprod_s16(coeffs, x, &r, CONVERT_TAPS, 0);
+    return sat16((int32_t)r * 2);
+#else
+    int32_t acc = 1 << 13;
+    for (int k = 0; k < CONVERT_TAPS; k += 4) {
+        acc += coeffs[k] * x[k] + coeffs[k + 1] * x[k + 1] + coeffs[k + 2] * x[k + 2] + coeffs[k + 3] * x[k + 3];
+    }
+    return sat16(acc >> 14);
+#endif
+}
+
+static inline int16_t read_sample(const uint8_t *p, uint8_t bits)
+{
+    switch (bits) {
+    case 16:
+        return (int16_t)(p[0] | (p[1] << 8));
+    default:
+        return (int16_t)(p[2] | (p[3] << 8));
+    }
+}
+
+static inline uint8_t *write_sample(uint8_t *p, int16_t v, uint8_t bits)
+{
+    switch (bits) {
+    case 16:
+        p[0] = v & 0xff;
+        p[1] = (v >> 8) & 0xff;
+        return p + 2;
+    case 24:
+        p[0] = 0;
+        p[1] = v & 0xff;
+        p[2] = (v >> 8) & 0xff;
+        return p + 3;
+    default:
+        p[0] = 0;
+        p[1] = 0;
+        p[2] = v & 0xff;
+        p[3] = (v >> 8) & 0xff;
+        return p + 4;
+    }
+}
+
+static bool format_valid(const audio_convert_format_t *fmt, bool output)
+{
+    return fmt && fmt->rate && (fmt->channels == 1 || fmt->channels == 2) &&
+           (fmt->bits == 16 || fmt->bits == 32 || (output && fmt->bits == 24));
+}
+
+esp_err_t audio_convert_new(const audio_convert_format_t *in, const audio_convert_format_t *out,
+                            audio_convert_handle_t *ret_convert)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(format_valid(in, false) && format_valid(out, true) && ret_convert, ESP_ERR_INVALID_ARG, TAG,
+                        "invalid argument");
+
+    const uint32_t div = gcd(in->rate, out->rate);
+    const uint32_t up = out->rate / div;
+    ESP_RETURN_ON_FALSE(up <= CONVERT_MAX_PHASES, ESP_ERR_NOT_SUPPORTED, TAG, "%"PRIu32" Hz to %"PRIu32" Hz not supported",
+                        in->rate, out->rate);
+
+    audio_convert_handle_t convert = calloc(1, sizeof(struct audio_convert));
+    ESP_RETURN_ON_FALSE(convert, ESP_ERR_NO_MEM, TAG, "no mem for converter");
+    convert->in = *in;
+    convert->out = *out;
+    convert->up = up;
+    convert->down = in->rate / div;
+    convert->filter_channels = (in->channels == 2 && out->channels == 2) ? 2 : 1;
+
+    convert->coeffs = heap_caps_aligned_alloc(CONVERT_ALIGN, up * CONVERT_TAPS * sizeof(int16_t),
+                                              MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_GOTO_ON_FALSE(convert->coeffs, ESP_ERR_NO_MEM, err, TAG, "no mem for %"PRIu32" filter phases", up);
+    for (int ch = 0; ch < convert->filter_channels; ch++) {
+        convert->history[ch] = heap_caps_aligned_alloc(CONVERT_ALIGN, (CONVERT_TAPS - 1 + CONVERT_BLOCK_FRAMES) * sizeof(int16_t),
+                               MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        ESP_GOTO_ON_FALSE(convert->history[ch], ESP_ERR_NO_MEM, err, TAG, "no mem for filter history");
+    }
+    convert_design(convert);
+    audio_convert_reset(convert);
+
+    ESP_LOGI(TAG, "%"PRIu32" Hz %u bit %uch -> %"PRIu32" Hz %u bit %uch, %"PRIu32"/%"PRIu32" x %d taps", in->rate, in->bits,
+             in->channels, out->rate, out->bits, out->channels, up, convert->down, CONVERT_TAPS);
+    *ret_convert = convert;
+    return ESP_OK;
+
+err:
+    audio_convert_del(convert);
+    return ret;
+}
+
+void audio_convert_del(audio_convert_handle_t convert)
+{
+    if (convert) {
+        heap_caps_free(convert->coeffs);
+        heap_caps_free(convert->history[0]);
+        heap_caps_free(convert->history[1]);
+        free(convert);
+    }
+}
+
+void audio_convert_reset(audio_convert_handle_t convert)
+{
+    for (int ch = 0; ch < convert->filter_channels; ch++) {
+        memset(convert->history[ch], 0, (CONVERT_TAPS - 1) * sizeof(int16_t));
+    }
+    convert->phase = 0;
+    convert->pos = 0;
+}
+
+size_t audio_convert_get_out_size(audio_convert_handle_t convert, size_t in_size)
+{
+    const size_t in_frames = in_size / (convert->in.channels * convert->in.bits / 8);
+    const size_t out_frames = (uint64_t)in_frames * convert->up / convert->down + 1;
+    return out_frames * convert->out.channels * convert->out.bits / 8;
+}
+
+size_t audio_convert_process(audio_convert_handle_t convert, const void *in, size_t in_size, void *out)
+{
+    const size_t in_frame_size = convert->in.channels * convert->in.bits / 8;
+    const size_t in_sample_size = convert->in.bits / 8;
+    const uint8_t *src = in;
+    uint8_t *dst = out;
+    size_t frames = in_size / in_frame_size;
+
+    while (frames) {
+        const uint32_t count = (frames < CONVERT_BLOCK_FRAMES) ? frames : CONVERT_BLOCK_FRAMES;
+
+        /* Deinterleave and mix the channels behind the history */
+        int16_t *x0 = convert->history[0] + CONVERT_TAPS - 1;
+        int16_t *x1 = convert->history[1] ? convert->history[1] + CONVERT_TAPS - 1 : NULL;
+        for (uint32_t i = 0; i < count; i++, src += in_frame_size) {
+            const int16_t left = read_sample(src, convert->in.bits);
+            if (convert->in.channels == 1) {
+                x0[i] = left;
+            } else {
+                const int16_t right = read_sample(src + in_sample_size, convert->in.bits);
+                if (x1) {
+                    x0[i] = left;
+                    x1[i] = right;
+                } else {
+                    x0[i] = (left + right) >> 1;
+                }
+            }
+        }
+
+        /* Output sample n lies at input position n * down / up, phase is its fractional part in 1 / up */
+        while (convert->pos < count) {
+            const int16_t *c = convert->coeffs + convert->phase * CONVERT_TAPS;
+            int16_t l;
+            int16_t r;
+            if (convert->up == convert->down) {
+                l = x0[convert->pos];
+                r = x1 ? x1[convert->pos] : l;
+            } else {
+                l = convert_dot(c, convert->history[0] + convert->pos);
+                r = x1 ? convert_dot(c, convert->history[1] + convert->pos) : l;
+            }
+            dst = write_sample(dst, l, convert->out.bits);
+            if (convert->out.channels == 2) {
+                dst = write_sample(dst, r, convert->out.bits);
+            }
+            convert->phase += convert->down;
+            convert->pos += convert->phase / convert->up;
+            convert->phase %= convert->up;
+        }
+        convert->pos -= count;
+
+        for (int ch = 0; ch < convert->filter_channels; ch++) {
+            memmove(convert->history[ch], convert->history[ch] + count, (CONVERT_TAPS - 1) * sizeof(int16_t));
+        }
+        frames -= count;
+    }
+    return dst - (uint8_t *)out;
+}
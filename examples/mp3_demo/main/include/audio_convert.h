@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief PCM format conversion: sample rate, channels and bit depth
+ *
+ * The rate is converted by a fixed-point polyphase FIR, the ratio is reduced to up / down (e.g. 160 / 147 from
+ * 44.1 kHz to 48 kHz) and each output sample is one dot product of 48 taps per channel. On ESP32-S3 the dot products
+ * use the optimized esp-dsp kernel.
+ */
+typedef struct audio_convert *audio_convert_handle_t;
+
+typedef struct {
+    uint32_t rate;          /*!< Sample rate in Hz */
+    uint8_t bits;           /*!< 16, 24 (packed, 3 bytes) or 32 */
+    uint8_t channels;       /*!< 1 or 2, interleaved */
+} audio_convert_format_t;
+
+/**
+ * @brief Create a converter
+ *
+ * @param in: Input format
+ * @param out: Output format
+ * @param ret_convert: Output converter handle
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NOT_SUPPORTED: Rate ratio with a too large filter bank (e.g. 11025 Hz to 48000 Hz)
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t audio_convert_new(const audio_convert_format_t *in, const audio_convert_format_t *out,
+                            audio_convert_handle_t *ret_convert);
+
+/**
+ * @brief Delete a converter
+ *
+ * @param convert: Converter handle
+ */
+void audio_convert_del(audio_convert_handle_t convert);
+
+/**
+ * @brief Get the largest output a conversion of in_size bytes can produce
+ *
+ * @param convert: Converter handle
+ * @param in_size: Input size in bytes
+ *
+ * @return Output buffer size in bytes
+ */
+size_t audio_convert_get_out_size(audio_convert_handle_t convert, size_t in_size);
+
+/**
+ * @brief Convert a buffer, the filter state carries over to the next call
+ *
+ * @param convert: Converter handle
+ * @param in: Input samples, whole frames
+ * @param in_size: Input size in bytes
+ * @param out: Output buffer, at least `audio_convert_get_out_size(in_size)` bytes
+ *
+ * @return Number of bytes written to out
+ */
+size_t audio_convert_process(audio_convert_handle_t convert, const void *in, size_t in_size, void *out);
+
+/**
+ * @brief Clear the filter state, e.g. before another stream
+ *
+ * @param convert: Converter handle
+ */
+void audio_convert_reset(audio_convert_handle_t convert);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "file_iterator.h"
+#include "music_library.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,6 +19,18 @@ extern "C" {
  */
 void ui_audio_start(file_iterator_instance_t *i);
 
+/**
+ * @brief Rebuild the music list with the track metadata, called once the music library is indexed
+ *
+ */
+void ui_audio_library_ready(music_library_handle_t library, void *user_ctx);
+
+/**
+ * @brief Select the track the playlist continued with, called from the player task
+ *
+ */
+void ui_audio_track_changed(const char *path, void *user_ctx);
+
 /**
  * @brief get system volume
  *
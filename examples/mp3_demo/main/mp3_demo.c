@@ -4,14 +4,20 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+#include <stdlib.h>
 #include "audio_player.h"
+#include "audio_playlist.h"
+#include "audio_convert.h"
 #include "bsp/esp-bsp.h"
 #include "esp_check.h"
 #include "esp_log.h"
 #include "file_iterator.h"
 #include "ui_audio.h"
 #include "bsp_board.h"
+#include "bsp_display_profile.h"
+#include "bsp_read_stream.h"
 #include "esp_spiffs.h"
+#include "freertos/semphr.h"
 #include "usb/usb_host.h"
 #include "usb/uac_host.h"
 #include "audio_player.h"
@@ -24,6 +30,8 @@ static const char *TAG = "mp3_demo";
 #define UAC_TASK_PRIORITY       5
 #define USER_TASK_PRIORITY      2
 #define SPIFFS_BASE             "/spiffs"
+#define MUSIC_DIR               SPIFFS_BASE "/mp3"
+#define MUSIC_CACHE_PATH        SPIFFS_BASE "/music_lib.bin"
 #define MP3_FILE_NAME           "/For_Elise.mp3"
 #define DEFAULT_VOLUME          60
 
@@ -34,6 +42,19 @@ static audio_player_config_t player_config = {0};
 static FILE *s_fp = NULL;
 static void uac_device_callback(uac_host_device_handle_t uac_device_handle, const uac_host_device_event_t event, void *arg);
 static file_iterator_instance_t *file_iterator = NULL;
+static music_library_handle_t s_music_library = NULL;
+
+/* The USB stream stays at the native format of the speaker, the player output is converted to it */
+static audio_convert_format_t s_player_format;
+static audio_convert_format_t s_usb_native_format;
+static audio_convert_format_t s_usb_stream_format;
+/* The converter and the player format are changed by the UAC task on connection and by the player task */
+static SemaphoreHandle_t s_convert_lock = NULL;
+static audio_convert_handle_t s_convert = NULL;
+static audio_convert_format_t s_convert_in;
+static audio_convert_format_t s_convert_out;
+static uint8_t *s_convert_buf = NULL;
+static size_t s_convert_buf_size = 0;
 
 /**
  * @brief event group
@@ -101,7 +122,26 @@ static esp_err_t _audio_player_write_fn(void *audio_buffer, size_t len, size_t *
             return ESP_ERR_INVALID_STATE;
         }
         *bytes_written = 0;
-        esp_err_t ret = uac_host_device_write(s_audio_player_handle, audio_buffer, len, timeout_ms);
+        uint8_t *data = audio_buffer;
+        size_t size = len;
+        /* Only this task resizes the output buffer, the lock is not held while the USB write waits */
+        xSemaphoreTake(s_convert_lock, portMAX_DELAY);
+        if (s_convert) {
+            size_t out_size = audio_convert_get_out_size(s_convert, len);
+            if (out_size > s_convert_buf_size) {
+                uint8_t *buf = realloc(s_convert_buf, out_size);
+                if (!buf) {
+                    xSemaphoreGive(s_convert_lock);
+                    return ESP_ERR_NO_MEM;
+                }
+                s_convert_buf = buf;
+                s_convert_buf_size = out_size;
+            }
+            size = audio_convert_process(s_convert, audio_buffer, len, s_convert_buf);
+            data = s_convert_buf;
+        }
+        xSemaphoreGive(s_convert_lock);
+        ret = uac_host_device_write(s_audio_player_handle, data, size, timeout_ms);
         if (ret == ESP_OK) {
             *bytes_written = len;
         }
@@ -110,28 +150,128 @@ static esp_err_t _audio_player_write_fn(void *audio_buffer, size_t len, size_t *
     return ret;
 }
 
+static bool _format_equal(const audio_convert_format_t *a, const audio_convert_format_t *b)
+{
+    return (a->rate == b->rate) && (a->bits == b->bits) && (a->channels == b->channels);
+}
+
+/**
+ * @brief Convert the player format to the native format of the speaker, restart the stream only if that is not possible
+ */
+static esp_err_t _usb_output_update(uac_host_device_handle_t handle)
+{
+    xSemaphoreTake(s_convert_lock, portMAX_DELAY);
+    audio_convert_format_t target = s_usb_native_format;
+    const bool convert = s_player_format.rate && !_format_equal(&s_player_format, &s_usb_native_format);
+
+    /* The next track in the same format keeps the converter, its filter bank is not designed again */
+    if (!s_convert || !_format_equal(&s_player_format, &s_convert_in) ||
+            !_format_equal(&s_usb_native_format, &s_convert_out)) {
+        audio_convert_del(s_convert);
+        s_convert = NULL;
+        if (convert && (ESP_OK == audio_convert_new(&s_player_format, &s_usb_native_format, &s_convert))) {
+            s_convert_in = s_player_format;
+            s_convert_out = s_usb_native_format;
+        }
+    }
+    if (convert && !s_convert) {
+        target = s_player_format;
+    }
+    const bool restart = !_format_equal(&target, &s_usb_stream_format);
+    if (restart && s_convert) {
+        audio_convert_reset(s_convert);
+    }
+    xSemaphoreGive(s_convert_lock);
+    if (!restart) {
+        return ESP_OK;
+    }
+
+    ESP_LOGI(TAG, "Re-config: speaker rate %"PRIu32", bits %u, mode %s", target.rate, target.bits,
+             target.channels == 1 ? "MONO" : (target.channels == 2 ? "STEREO" : "INVALID"));
+    if (s_usb_stream_format.rate) {
+        ESP_ERROR_CHECK(uac_host_device_stop(handle));
+    }
+    const uac_host_stream_config_t stm_config = {
+        .channels = target.channels,
+        .bit_resolution = target.bits,
+        .sample_freq = target.rate,
+    };
+    esp_err_t ret = uac_host_device_start(handle, &stm_config);
+    s_usb_stream_format = (ESP_OK == ret) ? target : (audio_convert_format_t) {0};
+    return ret;
+}
+
+static bool _usb_alt_supports(const uac_host_dev_alt_param_t *alt, uint32_t rate)
+{
+    if (alt->sample_freq_type == 0) {
+        return (rate >= alt->sample_freq_lower) && (rate <= alt->sample_freq_upper);
+    }
+    for (size_t i = 0; (i < alt->sample_freq_type) && (i < sizeof(alt->sample_freq) / sizeof(alt->sample_freq[0])); i++) {
+        if (alt->sample_freq[i] == rate) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Pick the native format of the speaker, 48 kHz or 44.1 kHz stereo 16 bit
+ */
+static void _usb_select_native_format(uac_host_device_handle_t handle, uint8_t alt_num, audio_convert_format_t *format)
+{
+    static const uint32_t rates[] = {48000, 44100};
+
+    *format = (audio_convert_format_t) {
+        .rate = 48000, .bits = 16, .channels = 2,
+    };
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+        for (uint8_t i = 1; i <= alt_num; i++) {
+            uac_host_dev_alt_param_t alt;
+            if ((ESP_OK == uac_host_get_device_alt_param(handle, i, &alt)) && (alt.bit_resolution == 16) &&
+                    (alt.channels == 2) && _usb_alt_supports(&alt, rates[r])) {
+                format->rate = rates[r];
+                return;
+            }
+        }
+    }
+}
+
 static esp_err_t _audio_player_std_clock(uint32_t rate, uint32_t bits_cfg, i2s_slot_mode_t ch)
 {
     esp_err_t ret = ESP_OK;
 
+    xSemaphoreTake(s_convert_lock, portMAX_DELAY);
+    s_player_format = (audio_convert_format_t) {
+        .rate = rate, .bits = bits_cfg, .channels = ch,
+    };
+    xSemaphoreGive(s_convert_lock);
     if (audio_player_type == AUDIO_PLAYER_I2S) {
         ret = bsp_codec_set_fs(rate, bits_cfg, ch);
     } else {
         if (s_audio_player_handle == NULL) {
             return ESP_ERR_INVALID_STATE;
         }
-        ESP_LOGI(TAG, "Re-config: speaker rate %"PRIu32", bits %"PRIu32", mode %s", rate, bits_cfg, ch == 1 ? "MONO" : (ch == 2 ? "STEREO" : "INVALID"));
-        ESP_ERROR_CHECK(uac_host_device_stop(s_audio_player_handle));
-        const uac_host_stream_config_t stm_config = {
-            .channels = ch,
-            .bit_resolution = bits_cfg,
-            .sample_freq = rate,
-        };
-        ret = uac_host_device_start(s_audio_player_handle, &stm_config);
+        ret = _usb_output_update(s_audio_player_handle);
     }
     return ret;
 }
 
+static FILE *_playlist_open_track(const char *path)
+{
+    FILE *fp = bsp_read_stream_fopen(path, NULL);
+    return fp ? fp : fopen(path, "rb");
+}
+
+static bool _playlist_next_track(const char *current, char *next, size_t size, void *user_ctx)
+{
+    size_t count = file_iterator_get_count(file_iterator);
+    if (!count) {
+        return false;
+    }
+    size_t index = (file_iterator_get_index(file_iterator) + 1) % count;
+    return file_iterator_get_full_path_from_index(file_iterator, index, next, size) > 0;
+}
+
 static void _audio_player_callback(audio_player_cb_ctx_t *ctx)
 {
     ESP_LOGI(TAG, "ctx->audio_event = %d", ctx->audio_event);
@@ -143,7 +283,7 @@ static void _audio_player_callback(audio_player_cb_ctx_t *ctx)
         }
         ESP_ERROR_CHECK(uac_host_device_suspend(s_audio_player_handle));
         ESP_LOGI(TAG, "Play in loop");
-        s_fp = fopen(SPIFFS_BASE MP3_FILE_NAME, "rb");
+        s_fp = audio_playlist_open(MUSIC_DIR MP3_FILE_NAME);
         if (s_fp) {
             ESP_LOGI(TAG, "Playing '%s'", MP3_FILE_NAME);
             audio_player_play(s_fp);
@@ -275,15 +415,12 @@ static void uac_lib_task(void *arg)
                     ESP_ERROR_CHECK(uac_host_get_device_info(uac_device_handle, &dev_info));
                     ESP_LOGI(TAG, "UAC Device connected: SPK");
                     uac_host_printf_device_param(uac_device_handle);
-                    const uac_host_stream_config_t stm_config = {
-                        .channels = 2,
-                        .bit_resolution = 16,
-                        .sample_freq = 48000,
-                    };
-                    ESP_ERROR_CHECK(uac_host_device_start(uac_device_handle, &stm_config));
+                    _usb_select_native_format(uac_device_handle, dev_info.iface_alt_num, &s_usb_native_format);
+                    s_usb_stream_format = (audio_convert_format_t) {0};
+                    ESP_ERROR_CHECK(_usb_output_update(uac_device_handle));
                     s_audio_player_handle = uac_device_handle;
                     uac_host_device_set_volume(s_audio_player_handle, get_sys_volume());
-                    s_fp = fopen(SPIFFS_BASE MP3_FILE_NAME, "rb");
+                    s_fp = audio_playlist_open(MUSIC_DIR MP3_FILE_NAME);
                     if (s_fp) {
                         ESP_LOGI(TAG, "Playing '%s'", MP3_FILE_NAME);
                         audio_player_play(s_fp);
@@ -335,22 +472,25 @@ uac_host_device_handle_t get_audio_player_handle(void)
     return s_audio_player_handle;
 }
 
+music_library_handle_t get_music_library(void)
+{
+    return s_music_library;
+}
+
 void app_main(void)
 {
     s_event_queue = xQueueCreate(10, sizeof(s_event_queue_t));
     assert(s_event_queue != NULL);
+    s_convert_lock = xSemaphoreCreateMutex();
+    assert(s_convert_lock != NULL);
     /* Initialize I2C (for touch and audio) */
     bsp_i2c_init();
 
     /* Initialize display and LVGL */
     bsp_display_cfg_t cfg = {
         .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
-        .buffer_size = BSP_LCD_H_RES * CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,
-        .double_buffer = 0,
-        .flags = {
-            .buff_dma = true,
-        }
     };
+    bsp_display_profile_apply(NULL, &cfg);
     bsp_display_start_with_config(&cfg);
 
     /* Set display brightness to 100% */
@@ -358,16 +498,41 @@ void app_main(void)
 
     bsp_spiffs_mount();
 
-    file_iterator = file_iterator_new(SPIFFS_BASE);
+    file_iterator = file_iterator_new(MUSIC_DIR);
     assert(file_iterator != NULL);
 
+    /* Titles and durations come from the cache at once, new files are parsed in the background */
+    const music_library_config_t library_config = {
+        .path = MUSIC_DIR,
+        .suffix = ".mp3",
+        .cache_path = MUSIC_CACHE_PATH,     /* Outside of the listed directory */
+        .task_priority = USER_TASK_PRIORITY,
+        .task_core = 0,
+        .ready_cb = ui_audio_library_ready,
+    };
+    if (ESP_OK != music_library_new(&library_config, &s_music_library)) {
+        ESP_LOGW(TAG, "Music library not available, showing file names");
+    }
+
     /* Configure I2S peripheral and Power Amplifier */
     bsp_board_init();
 
+    /* The next track is opened while the current one plays and joins the same stream */
+    const audio_playlist_config_t playlist_config = {
+        .write_fn = _audio_player_write_fn,
+        .clk_set_fn = _audio_player_std_clock,
+        .open_fn = _playlist_open_track,
+        .next_cb = _playlist_next_track,
+        .track_cb = ui_audio_track_changed,
+        .task_priority = USER_TASK_PRIORITY,
+        .task_core = 0,
+    };
+    ESP_ERROR_CHECK(audio_playlist_init(&playlist_config));
+
     /* Initialize audio player, the default configuration is set to play through the USB headset. */
     player_config.mute_fn = _audio_player_mute_fn;
-    player_config.write_fn = _audio_player_write_fn;
-    player_config.clk_set_fn = _audio_player_std_clock;
+    player_config.write_fn = audio_playlist_write;
+    player_config.clk_set_fn = audio_playlist_clk_set;
     player_config.priority = 1;
 
     ESP_ERROR_CHECK(audio_player_new(player_config));
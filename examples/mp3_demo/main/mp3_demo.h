@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "music_library.h"
+
 /** Major version number (X.x.x) */
 #define MP3_DEMO_VERSION_MAJOR 0
 /** Minor version number (x.X.x) */
@@ -30,6 +32,12 @@ audio_player_t get_audio_player_type(void);
  */
 uac_host_device_handle_t get_audio_player_handle(void);
 
+/**
+ * @brief get music library handle, NULL if the library could not be created
+ *
+ */
+music_library_handle_t get_music_library(void);
+
 /**
  * Macro to convert version number into an integer
  *
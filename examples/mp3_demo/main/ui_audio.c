@@ -6,7 +6,9 @@
 
 #include "lvgl.h"
 #include "audio_player.h"
+#include "audio_playlist.h"
 #include "file_iterator.h"
+#include "music_library.h"
 #include "esp_err.h"
 #include "esp_log.h"
 #include "bsp_board.h"
@@ -26,6 +28,7 @@ static lv_obj_t *g_focus_last_obj = NULL;
 #endif
 static lv_group_t *g_btn_op_group = NULL;
 static file_iterator_instance_t *file_iterator;
+static lv_obj_t *s_music_list = NULL;
 static uint8_t g_sys_volume;
 static button_style_t g_btn_styles;
 
@@ -72,7 +75,7 @@ static void play_index(int index)
         return;
     }
 
-    FILE *fp = fopen(filename, "rb");
+    FILE *fp = audio_playlist_open(filename);
     if (fp) {
         ESP_LOGI(TAG, "Playing '%s'", filename);
         audio_player_play(fp);
@@ -265,9 +268,16 @@ static void volume_slider_cb(lv_event_t *event)
     ESP_LOGI(TAG, "volume '%d'", volume);
 }
 
+static const char *track_text(size_t index, char *buf, size_t size)
+{
+    /* Artist, title and duration once the library knows them, the file name until then */
+    return music_library_format(get_music_library(), file_iterator_get_name_from_index(file_iterator, index), buf, size);
+}
+
 static void build_file_list(lv_obj_t *music_list)
 {
     lv_obj_t *label_title = (lv_obj_t *) music_list->user_data;
+    char text[2 * MUSIC_LIBRARY_TEXT_MAX_LEN + 16];
 
     bsp_display_lock(0);
     lv_dropdown_clear_options(music_list);
@@ -278,13 +288,13 @@ static void build_file_list(lv_obj_t *music_list)
         const char *file_name = file_iterator_get_name_from_index(file_iterator, i);
         if (NULL != file_name) {
             bsp_display_lock(0);
-            lv_dropdown_add_option(music_list, file_name, i);
+            lv_dropdown_add_option(music_list, track_text(i, text, sizeof(text)), i);
             bsp_display_unlock();
         } else {
+            size_t index = file_iterator_get_index(file_iterator);
             bsp_display_lock(0);
-            lv_dropdown_set_selected(music_list, 0);
-            lv_label_set_text_static(label_title,
-                                     file_iterator_get_name_from_index(file_iterator, 0));
+            lv_dropdown_set_selected(music_list, index);
+            lv_label_set_text(label_title, track_text(index, text, sizeof(text)));
             bsp_display_unlock();
             break;
         }
@@ -292,6 +302,32 @@ static void build_file_list(lv_obj_t *music_list)
     }
 }
 
+void ui_audio_library_ready(music_library_handle_t library, void *user_ctx)
+{
+    /* The UI is created with the display locked, so the list is either built after this or rebuilt here */
+    bsp_display_lock(0);
+    if (s_music_list) {
+        build_file_list(s_music_list);
+    }
+    bsp_display_unlock();
+}
+
+void ui_audio_track_changed(const char *path, void *user_ctx)
+{
+    file_iterator_next(file_iterator);
+
+    bsp_display_lock(0);
+    if (s_music_list) {
+        lv_obj_t *label_title = (lv_obj_t *) s_music_list->user_data;
+        size_t index = file_iterator_get_index(file_iterator);
+        char text[2 * MUSIC_LIBRARY_TEXT_MAX_LEN + 16];
+
+        lv_dropdown_set_selected(s_music_list, index);
+        lv_label_set_text(label_title, track_text(index, text, sizeof(text)));
+    }
+    bsp_display_unlock();
+}
+
 static void audio_callback(audio_player_cb_ctx_t *ctx)
 {
     lv_obj_t *music_list = (lv_obj_t *) ctx->user_ctx;
@@ -306,12 +342,12 @@ static void audio_callback(audio_player_cb_ctx_t *ctx)
     }
 
     size_t index = file_iterator_get_index(file_iterator);
+    char text[2 * MUSIC_LIBRARY_TEXT_MAX_LEN + 16];
 
     lv_dropdown_set_selected(music_list, index);
 
     bsp_display_lock(0);
-    lv_label_set_text_static(label_title,
-                             file_iterator_get_name_from_index(file_iterator, index));
+    lv_label_set_text(label_title, track_text(index, text, sizeof(text)));
 
     if ((ctx->audio_event == AUDIO_PLAYER_CALLBACK_EVENT_PLAYING) ||
             (ctx->audio_event == AUDIO_PLAYER_CALLBACK_EVENT_COMPLETED_PLAYING_NEXT)) {
@@ -471,6 +507,7 @@ void ui_audio_start(file_iterator_instance_t *i)
     lv_obj_add_event_cb(music_list, music_list_cb, LV_EVENT_VALUE_CHANGED, NULL);
 
     build_file_list(music_list);
+    s_music_list = music_list;
     audio_player_callback_register(audio_callback, (void *) music_list);
 
     // initiate playback
@@ -12,242 +12,35 @@
 
 static const char *TAG = "esp_schedule";
 
-#define SECONDS_TILL_2020 ((2020 - 1970) * 365 * 24 * 3600)
-#define SECONDS_IN_DAY (60 * 60 * 24)
-
 static bool init_done = false;
 
-static int esp_schedule_get_no_of_days(esp_schedule_trigger_t *trigger, struct tm *current_time, struct tm *schedule_time)
-{
-    /* for day, monday = 0, sunday = 6. */
-    int next_day = 0;
-    /* struct tm has tm_wday with sunday as 0. Whereas we have monday as 0. Converting struct tm to our format */
-    int today = ((current_time->tm_wday + 7 - 1) % 7);
-
-    esp_schedule_days_t today_bit = 1 << today;
-    uint8_t repeat_days = trigger->day.repeat_days;
-    int current_seconds = (current_time->tm_hour * 60 + current_time->tm_min) * 60 + current_time->tm_sec;
-    int schedule_seconds = (schedule_time->tm_hour * 60 + schedule_time->tm_min) * 60;
-
-    /* Handling for one time schedule */
-    if (repeat_days == ESP_SCHEDULE_DAY_ONCE) {
-        if (schedule_seconds > current_seconds) {
-            /* The schedule is today and is yet to go off */
-            return 0;
-        } else {
-            /* The schedule is tomorrow */
-            return 1;
-        }
-    }
-
-    /* Handling for repeating schedules */
-    /* Check if it is today */
-    if ((repeat_days & today_bit)) {
-        if (schedule_seconds > current_seconds) {
-            /* The schedule is today and is yet to go off. */
-            return 0;
-        }
-    }
-    /* Check if it is this week or next week */
-    if ((repeat_days & (today_bit ^ 0xFF)) > today_bit) {
-        /* Next schedule is yet to come in this week */
-        next_day = ffs(repeat_days & (0xFF << (today + 1))) - 1;
-        return (next_day - today);
-    } else {
-        /* First scheduled day of the next week */
-        next_day = ffs(repeat_days) - 1;
-        if (next_day == today) {
-            /* Same day, next week */
-            return 7;
-        }
-        return (7 - today + next_day);
-    }
-
-    ESP_LOGE(TAG, "No of days could not be found. This should not happen.");
-    return 0;
-}
-
-static uint8_t esp_schedule_get_next_month(esp_schedule_trigger_t *trigger, struct tm *current_time, struct tm *schedule_time)
+static uint32_t esp_schedule_get_next_schedule_time_diff(esp_schedule_t *schedule, time_t now, esp_err_t *err)
 {
-    int current_seconds = (current_time->tm_hour * 60 + current_time->tm_min) * 60 + current_time->tm_sec;
-    int schedule_seconds = (schedule_time->tm_hour * 60 + schedule_time->tm_min) * 60;
-    /* +1 is because struct tm has months starting from 0, whereas we have them starting from 1 */
-    uint8_t current_month = current_time->tm_mon + 1;
-    /* -1 because month_bit starts from 0b1. So for January, it should be 1 << 0. And current_month starts from 1. */
-    uint16_t current_month_bit = 1 << (current_month - 1);
-    uint8_t next_schedule_month = 0;
-    uint16_t repeat_months = trigger->date.repeat_months;
-
-    /* Check if month is not specified */
-    if (repeat_months == ESP_SCHEDULE_MONTH_ONCE) {
-        if (trigger->date.day == current_time->tm_mday) {
-            /* The schedule day is same. Check if time has already passed */
-            if (schedule_seconds > current_seconds) {
-                /* The schedule is today and is yet to go off */
-                return current_month;
-            } else {
-                /* Today's time has passed */
-                return (current_month + 1);
-            }
-        } else if (trigger->date.day > current_time->tm_mday) {
-            /* The day is yet to come in this month */
-            return current_month;
-        } else {
-            /* The day has passed in the current month */
-            return (current_month + 1);
-        }
-    }
-
-    /* Check if schedule is not this year itself, it is in future. */
-    if (trigger->date.year > (current_time->tm_year + 1900)) {
-        /* Find first schedule month of next year */
-        next_schedule_month = ffs(repeat_months);
-        /* Year will be handled by the caller. So no need to add any additional months */
-        return next_schedule_month;
-    }
-
-    /* Check if schedule is this month and is yet to come */
-    if (current_month_bit & repeat_months) {
-        if (trigger->date.day == current_time->tm_mday) {
-            /* The schedule day is same. Check if time has already passed */
-            if (schedule_seconds > current_seconds) {
-                /* The schedule is today and is yet to go off */
-                return current_month;
-            }
-        }
-        if (trigger->date.day > current_time->tm_mday) {
-            /* The day is yet to come in this month */
-            return current_month;
-        }
-    }
-
-    /* Check if schedule is this year */
-    if ((repeat_months & (current_month_bit ^ 0xFFFF)) > current_month_bit) {
-        /* Next schedule month is yet to come in this year */
-        next_schedule_month = ffs(repeat_months & (0xFFFF << (current_month)));
-        return next_schedule_month;
-    }
-
-    /* Check if schedule is for this year and does not repeat */
-    if (!trigger->date.repeat_every_year) {
-        if (trigger->date.year <= (current_time->tm_year + 1900)) {
-            ESP_LOGE(TAG, "Schedule does not repeat next year, but get_next_month has been called.");
-            return 0;
-        }
-    }
-
-    /* Schedule is not this year */
-    /* Find first schedule month of next year */
-    next_schedule_month = ffs(repeat_months);
-    /* +12 because the schedule is next year */
-    return (next_schedule_month + 12);
-}
-
-static uint16_t esp_schedule_get_next_year(esp_schedule_trigger_t *trigger, struct tm *current_time, struct tm *schedule_time)
-{
-    uint16_t current_year = current_time->tm_year + 1900;
-    uint16_t schedule_year = trigger->date.year;
-    if (schedule_year > current_year) {
-        return schedule_year;
-    }
-    /* If the schedule is set to repeat_every_year, we return the current year */
-    /* If the schedule has already passed in this year, we still return current year, as the additional months will be handled in get_next_month */
-    return current_year;
-}
-
-static uint32_t esp_schedule_get_next_schedule_time_diff(const char *schedule_name, esp_schedule_trigger_t *trigger)
-{
-    struct tm current_time, schedule_time;
-    time_t now;
+    struct tm schedule_time;
     char time_str[64];
-    int32_t time_diff;
+    time_t next_time = 0;
 
-    /* Get current time */
-    time(&now);
-    /* Handling ESP_SCHEDULE_TYPE_RELATIVE first since it doesn't require any
-     * computation based on days, hours, minutes, etc.
-     */
-    if (trigger->type == ESP_SCHEDULE_TYPE_RELATIVE) {
-        /* If next scheduled time is already set, just compute the difference
-         * between current time and next scheduled time and return that diff.
-         */
-        time_t target;
-        if (trigger->next_scheduled_time_utc > 0) {
-            target = (time_t)trigger->next_scheduled_time_utc;
-            time_diff = difftime(target, now);
-        } else {
-            target = now + (time_t)trigger->relative_seconds;
-            time_diff = trigger->relative_seconds;
-        }
-        localtime_r(&target, &schedule_time);
-        trigger->next_scheduled_time_utc = mktime(&schedule_time);
-        /* Print schedule time */
-        memset(time_str, 0, sizeof(time_str));
-        strftime(time_str, sizeof(time_str), "%c %z[%Z]", &schedule_time);
-        ESP_LOGI(TAG, "Schedule %s will be active on: %s. DST: %s", schedule_name, time_str, schedule_time.tm_isdst ? "Yes" : "No");
-        return time_diff;
-    }
-    localtime_r(&now, &current_time);
-
-    /* Get schedule time */
-    localtime_r(&now, &schedule_time);
-    schedule_time.tm_sec = 0;
-    schedule_time.tm_min = trigger->minutes;
-    schedule_time.tm_hour = trigger->hours;
-    mktime(&schedule_time);
-
-    /* Adjust schedule day */
-    if (trigger->type == ESP_SCHEDULE_TYPE_DAYS_OF_WEEK) {
-        int no_of_days = 0;
-        no_of_days = esp_schedule_get_no_of_days(trigger, &current_time, &schedule_time);
-        schedule_time.tm_sec += no_of_days * SECONDS_IN_DAY;
-    }
-    if (trigger->type == ESP_SCHEDULE_TYPE_DATE) {
-        schedule_time.tm_mday = trigger->date.day;
-        schedule_time.tm_mon = esp_schedule_get_next_month(trigger, &current_time, &schedule_time) - 1;
-        schedule_time.tm_year = esp_schedule_get_next_year(trigger, &current_time, &schedule_time) - 1900;
-        if (schedule_time.tm_mon < 0) {
-            ESP_LOGE(TAG, "Invalid month found: %d. Setting it to next month.", schedule_time.tm_mon);
-            schedule_time.tm_mon = current_time.tm_mon + 1;
-        }
-        if (schedule_time.tm_mon >= 12) {
-            schedule_time.tm_year += schedule_time.tm_mon / 12;
-            schedule_time.tm_mon = schedule_time.tm_mon % 12;
-        }
-    }
-    mktime(&schedule_time);
-
-    /* Adjust time according to DST */
-    time_t dst_adjust = 0;
-    if (!current_time.tm_isdst && schedule_time.tm_isdst) {
-        dst_adjust = -3600;
-    } else if (current_time.tm_isdst && !schedule_time.tm_isdst ) {
-        dst_adjust = 3600;
+    *err = esp_schedule_get_next_time(&schedule->trigger, &schedule->validity, now, &next_time);
+    if (*err != ESP_OK) {
+        return 0;
     }
-    ESP_LOGD(TAG, "DST adjust seconds: %lld", (long long) dst_adjust);
-    schedule_time.tm_sec += dst_adjust;
-    mktime(&schedule_time);
 
     /* Print schedule time */
+    localtime_r(&next_time, &schedule_time);
     memset(time_str, 0, sizeof(time_str));
     strftime(time_str, sizeof(time_str), "%c %z[%Z]", &schedule_time);
-    ESP_LOGI(TAG, "Schedule %s will be active on: %s. DST: %s", schedule_name, time_str, schedule_time.tm_isdst ? "Yes" : "No");
-
-    /* Calculate difference */
-    time_diff = difftime((mktime(&schedule_time)), mktime(&current_time));
+    ESP_LOGI(TAG, "Schedule %s will be active on: %s. DST: %s", schedule->name, time_str, schedule_time.tm_isdst ? "Yes" : "No");
 
     /* For one time schedules to check for expiry after a reboot. If NVS is enabled, this should be stored in NVS. */
-    trigger->next_scheduled_time_utc = mktime(&schedule_time);
+    schedule->trigger.next_scheduled_time_utc = next_time;
 
-    return time_diff;
+    return (uint32_t)(next_time - now);
 }
 
 static bool esp_schedule_is_expired(esp_schedule_trigger_t *trigger)
 {
     time_t current_timestamp = 0;
-    struct tm current_time = {0};
     time(&current_timestamp);
-    localtime_r(&current_timestamp, &current_time);
 
     if (trigger->type == ESP_SCHEDULE_TYPE_RELATIVE) {
         if (trigger->next_scheduled_time_utc > 0 && trigger->next_scheduled_time_utc <= current_timestamp) {
@@ -279,21 +72,13 @@ static bool esp_schedule_is_expired(esp_schedule_trigger_t *trigger)
         if (trigger->date.repeat_every_year == true) {
             return false;
         }
-
-        struct tm schedule_time = {0};
-        localtime_r(&current_timestamp, &schedule_time);
-        schedule_time.tm_sec = 0;
-        schedule_time.tm_min = trigger->minutes;
-        schedule_time.tm_hour = trigger->hours;
-        schedule_time.tm_mday = trigger->date.day;
-        /* For expiry, just check the last month of the repeat_months. */
-        /* '-1' because struct tm has months starting from 0 and we have months starting from 1. */
-        schedule_time.tm_mon = fls(trigger->date.repeat_months) - 1;
-        /* '-1900' because struct tm has number of years after 1900 */
-        schedule_time.tm_year = trigger->date.year - 1900;
-        time_t schedule_timestamp = mktime(&schedule_time);
-
-        if (schedule_timestamp < current_timestamp) {
+        if (trigger->next_scheduled_time_utc > current_timestamp) {
+            /* The next trigger is still to come. No need to go through the calendar. */
+            return false;
+        }
+        /* The schedule has expired if there is no trigger left in its year */
+        time_t next_time;
+        if (esp_schedule_get_next_time(trigger, NULL, current_timestamp, &next_time) == ESP_ERR_NOT_FOUND) {
             return true;
         }
     } else {
@@ -305,36 +90,46 @@ static bool esp_schedule_is_expired(esp_schedule_trigger_t *trigger)
 
 static void esp_schedule_stop_timer(esp_schedule_t *schedule)
 {
-    xTimerStop(schedule->timer, portMAX_DELAY);
+    esp_schedule_timer_remove(schedule);
 }
 
-static void esp_schedule_start_timer(esp_schedule_t *schedule)
+esp_err_t esp_schedule_update_next_time(esp_schedule_t *schedule)
 {
     time_t current_time = 0;
     time(&current_time);
     if (current_time < SECONDS_TILL_2020) {
         ESP_LOGE(TAG, "Time is not updated");
-        return;
+        return ESP_ERR_INVALID_STATE;
     }
 
-    schedule->next_scheduled_time_diff = esp_schedule_get_next_schedule_time_diff(schedule->name, &schedule->trigger);
+    esp_err_t err;
+    schedule->next_scheduled_time_diff = esp_schedule_get_next_schedule_time_diff(schedule, current_time, &err);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Schedule %s will not be triggered again", schedule->name);
+        return err;
+    }
     ESP_LOGI(TAG, "Starting a timer for %"PRIu32" seconds for schedule %s", schedule->next_scheduled_time_diff, schedule->name);
 
     if (schedule->timestamp_cb) {
         schedule->timestamp_cb((esp_schedule_handle_t)schedule, schedule->trigger.next_scheduled_time_utc, schedule->priv_data);
     }
-
-    xTimerStop(schedule->timer, portMAX_DELAY);
-    xTimerChangePeriod(schedule->timer, (schedule->next_scheduled_time_diff * 1000) / portTICK_PERIOD_MS, portMAX_DELAY);
+    return ESP_OK;
 }
 
-static void esp_schedule_common_timer_cb(TimerHandle_t timer)
+static void esp_schedule_start_timer(esp_schedule_t *schedule)
 {
-    void *priv_data = pvTimerGetTimerID(timer);
-    if (priv_data == NULL) {
+    esp_err_t err = esp_schedule_update_next_time(schedule);
+    if (err == ESP_ERR_NOT_FOUND) {
+        /* Expired, or past the end of its validity */
+        esp_schedule_timer_remove(schedule);
         return;
     }
-    esp_schedule_t *schedule = (esp_schedule_t *)priv_data;
+    /* If the time is not synced yet, the schedule is still queued and its next time gets computed after the sync */
+    esp_schedule_timer_add(schedule, err == ESP_OK);
+}
+
+void esp_schedule_process(esp_schedule_t *schedule)
+{
     time_t now;
     time(&now);
     struct tm validity_time;
@@ -345,8 +140,8 @@ static void esp_schedule_common_timer_cb(TimerHandle_t timer)
             localtime_r(&schedule->validity.start_time, &validity_time);
             strftime(time_str, sizeof(time_str), "%c %z[%Z]", &validity_time);
             ESP_LOGW(TAG, "Schedule %s skipped. It will be active only after: %s. DST: %s.", schedule->name, time_str, validity_time.tm_isdst ? "Yes" : "No");
-            /* TODO: Start the timer such that the next time it triggeres, it will be within the valid window.
-             * Currently, it will just keep triggering and then get skipped if not in valid range.
+            /* The next trigger time is always computed inside the validity window, so this only happens if the time
+             * was changed after the timer was started. Restarting picks the first trigger inside the window.
              */
             goto restart_schedule;
         }
@@ -374,20 +169,18 @@ restart_schedule:
     esp_schedule_start_timer(schedule);
 }
 
-static void esp_schedule_delete_timer(esp_schedule_t *schedule)
-{
-    xTimerDelete(schedule->timer, portMAX_DELAY);
-}
-
 static void esp_schedule_create_timer(esp_schedule_t *schedule)
 {
     if (esp_schedule_nvs_is_enabled()) {
         /* This is just used for calculating next_scheduled_time_utc for ESP_SCHEDULE_DAY_ONCE (in case of ESP_SCHEDULE_TYPE_DAYS_OF_WEEK) or for ESP_SCHEDULE_MONTH_ONCE (in case of ESP_SCHEDULE_TYPE_DATE), and only used when NVS is enabled. And if NVS is enabled, time will already be synced and the time will be correctly calculated. */
-        schedule->next_scheduled_time_diff = esp_schedule_get_next_schedule_time_diff(schedule->name, &schedule->trigger);
+        time_t now;
+        esp_err_t err;
+        time(&now);
+        schedule->next_scheduled_time_diff = esp_schedule_get_next_schedule_time_diff(schedule, now, &err);
     }
 
-    /* Temporarily setting the timer for 1 (anything greater than 0) tick. This will get changed when xTimerChangePeriod() is called. */
-    schedule->timer = xTimerCreate("schedule", 1, pdFALSE, (void *)schedule, esp_schedule_common_timer_cb);
+    /* All schedules share a single timer. The schedule only gets an entry in the timer heap once it is enabled. */
+    schedule->heap_index = ESP_SCHEDULE_NOT_ARMED;
 }
 
 esp_err_t esp_schedule_get(esp_schedule_handle_t handle, esp_schedule_config_t *schedule_config)
@@ -500,10 +293,7 @@ esp_err_t esp_schedule_delete(esp_schedule_handle_t handle)
     }
     esp_schedule_t *schedule = (esp_schedule_t *)handle;
     ESP_LOGI(TAG, "Deleting schedule %s", schedule->name);
-    if (schedule->timer) {
-        esp_schedule_stop_timer(schedule);
-        esp_schedule_delete_timer(schedule);
-    }
+    esp_schedule_stop_timer(schedule);
     esp_schedule_nvs_remove(schedule);
     free(schedule);
     return ESP_OK;
@@ -530,6 +320,7 @@ esp_schedule_handle_t esp_schedule_create(esp_schedule_config_t *schedule_config
         return NULL;
     }
     strlcpy(schedule->name, schedule_config->name, sizeof(schedule->name));
+    schedule->heap_index = ESP_SCHEDULE_NOT_ARMED;
 
     esp_schedule_set(schedule, schedule_config);
 
@@ -538,6 +329,21 @@ esp_schedule_handle_t esp_schedule_create(esp_schedule_config_t *schedule_config
     return (esp_schedule_handle_t)schedule;
 }
 
+esp_err_t esp_schedule_batch_begin(void)
+{
+    return esp_schedule_nvs_batch_begin();
+}
+
+esp_err_t esp_schedule_batch_end(void)
+{
+    return esp_schedule_nvs_batch_end();
+}
+
+void esp_schedule_time_changed(void)
+{
+    esp_schedule_timer_resync();
+}
+
 esp_schedule_handle_t *esp_schedule_init(bool enable_nvs, char *nvs_partition, uint8_t *schedule_count)
 {
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
@@ -556,6 +362,10 @@ esp_schedule_handle_t *esp_schedule_init(bool enable_nvs, char *nvs_partition, u
     }
 #endif
 
+    if (esp_schedule_timer_init() != ESP_OK) {
+        return NULL;
+    }
+
     if (!enable_nvs) {
         return NULL;
     }
@@ -575,12 +385,13 @@ esp_schedule_handle_t *esp_schedule_init(bool enable_nvs, char *nvs_partition, u
         return NULL;
     }
     ESP_LOGI(TAG, "Schedules found in NVS: %"PRIu8, *schedule_count);
-    /* Start/Delete the schedules */
+    /* Start/Delete the schedules. Deleting expired schedules only updates NVS once, at the end. */
+    esp_schedule_nvs_batch_begin();
     esp_schedule_t *schedule = NULL;
     for (size_t handle_count = 0; handle_count < *schedule_count; handle_count++) {
         schedule = (esp_schedule_t *)handle_list[handle_count];
         schedule->trigger_cb = NULL;
-        schedule->timer = NULL;
+        schedule->heap_index = ESP_SCHEDULE_NOT_ARMED;
         /* Check for ONCE and expired schedules and delete them. */
         if (esp_schedule_is_expired(&schedule->trigger)) {
             /* This schedule has already expired. */
@@ -595,6 +406,7 @@ esp_schedule_handle_t *esp_schedule_init(bool enable_nvs, char *nvs_partition, u
         esp_schedule_create_timer(schedule);
         esp_schedule_start_timer(schedule);
     }
+    esp_schedule_nvs_batch_end();
     init_done = true;
     return handle_list;
 }
@@ -10,11 +10,18 @@
 #include <freertos/timers.h>
 #include <esp_schedule.h>
 
+#define SECONDS_TILL_2020 ((2020 - 1970) * 365 * 24 * 3600)
+
+/** heap_index value for a schedule which is not armed in the timer heap */
+#define ESP_SCHEDULE_NOT_ARMED (-1)
+
 typedef struct esp_schedule {
     char name[MAX_SCHEDULE_NAME_LEN + 1];
     esp_schedule_trigger_t trigger;
     uint32_t next_scheduled_time_diff;
-    TimerHandle_t timer;
+    /* Position in the timer heap. This replaces the per-schedule TimerHandle_t and has the same size, so the
+     * layout of the schedule blobs already stored in NVS does not change. */
+    int32_t heap_index;
     esp_schedule_trigger_cb_t trigger_cb;
     esp_schedule_timestamp_cb_t timestamp_cb;
     void *priv_data;
@@ -26,3 +33,15 @@ esp_err_t esp_schedule_nvs_remove(esp_schedule_t *schedule);
 esp_schedule_handle_t *esp_schedule_nvs_get_all(uint8_t *schedule_count);
 bool esp_schedule_nvs_is_enabled(void);
 esp_err_t esp_schedule_nvs_init(char *nvs_partition);
+esp_err_t esp_schedule_nvs_batch_begin(void);
+esp_err_t esp_schedule_nvs_batch_end(void);
+
+/* Implemented in esp_schedule.c, called by the timer backend */
+esp_err_t esp_schedule_update_next_time(esp_schedule_t *schedule);
+void esp_schedule_process(esp_schedule_t *schedule);
+
+/* Single timer backend (esp_schedule_timer.c) */
+esp_err_t esp_schedule_timer_init(void);
+esp_err_t esp_schedule_timer_add(esp_schedule_t *schedule, bool time_valid);
+void esp_schedule_timer_remove(esp_schedule_t *schedule);
+void esp_schedule_timer_resync(void);
@@ -7,6 +7,7 @@
 
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "freertos/FreeRTOS.h"
 #include <freertos/queue.h>
@@ -15,6 +16,7 @@
 #include "esp_err.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_timer.h"
 
 #include "driver/gpio.h"
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
@@ -30,7 +32,18 @@
 #include "app_humidity.h"
 
 #define APP_HUMIDITY_MAX_WATCHERS (5)
-#define APP_HUMIDITY_MAX_DEBOUNCE (5)
+#define APP_HUMIDITY_EVENT_QUEUE_LEN (8)
+
+/* The sensor is sampled by an esp_timer: a short burst of reads every period, instead of a busy task */
+#define APP_HUMIDITY_SAMPLE_PERIOD_MS (250)
+#define APP_HUMIDITY_OVERSAMPLE (4)
+/* First order IIR low pass in Q8 fixed point, alpha = 1 / (1 << shift). 3 gives a time constant of ~2 s. */
+#define APP_HUMIDITY_IIR_SHIFT (3)
+#define APP_HUMIDITY_IIR_FRAC_BITS (8)
+/* Watchers are notified only when the value moved at least this much from the last reported one */
+#define APP_HUMIDITY_REPORT_HYSTERESIS (2)
+/* The lower threshold re-arms only once the humidity rose this much above it */
+#define APP_HUMIDITY_THRESHOLD_HYSTERESIS (3)
 
 
 #define DEFAULT_VREF    1100
@@ -43,6 +56,11 @@ typedef struct {
     void *args;
 } watcher_t;
 
+typedef enum {
+    APP_HUMIDITY_EVENT_CHANGED,
+    APP_HUMIDITY_EVENT_BELOW_THRESHOLD,
+} app_humidity_event_t;
+
 typedef struct {
     //adc pin
     gpio_num_t gpio_num;
@@ -61,8 +79,16 @@ typedef struct {
 #endif
     //value
     int humidity;
+    int32_t filtered_q;
+    bool filter_ready;
+    //threshold
+    int lower_threshold;
+    bool below_threshold;
     //cb
     watcher_t watchers[APP_HUMIDITY_MAX_WATCHERS];
+    watcher_t threshold_watchers[APP_HUMIDITY_MAX_WATCHERS];
+    QueueHandle_t event_queue;
+    esp_timer_handle_t sample_timer;
     TaskHandle_t  task_handle;
 } app_humidity_t;
 
@@ -180,8 +206,6 @@ static esp_err_t app_humidity_drive_init(app_humidity_t *ref)
 
 static int voltage2humidity(int v)
 {
-    int h;
-    float p;
     int max_h = 84;
     int min_h = 1;
 
@@ -190,39 +214,87 @@ static int voltage2humidity(int v)
 
     /*all these magic numbers come from measurement by hands*/
     if (v <= min_v) {
-        h = max_h;
-        p = 1;
+        return max_h;
     } else if (v >= max_v) {
-        h = min_h;
-        p = 0.01;
-    } else {
-        p = 1.0 - 1.0 * (v - min_v) / (max_v - min_v);
-        h = (int)(p * (max_h - min_h));
+        return min_h;
     }
-    //ESP_LOGI(TAG, "v %dmv p %f h %d%%",v,p,h);
-    return h;
+    return (max_h - min_h) * (max_v - v) / (max_v - min_v);
 }
 
-static int app_humidity_drive_read_value(app_humidity_t *ref)
+/* Average of a short burst of raw reads, or -1 if the ADC is busy (ADC2 is shared with Wi-Fi) */
+static int app_humidity_drive_read_raw(app_humidity_t *ref)
 {
     uint32_t adc_reading = 0;
-#define NO_OF_SAMPLES 64
+    int samples = 0;
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
     int adc_raw = 0;
-    for (int i = 0; i < NO_OF_SAMPLES; i++) {
-        adc_oneshot_read(ref->adc1_handle, ref->adc_channel, &adc_raw);
-        adc_reading += adc_raw;
+    for (int i = 0; i < APP_HUMIDITY_OVERSAMPLE; i++) {
+        if (adc_oneshot_read(ref->adc1_handle, ref->adc_channel, &adc_raw) == ESP_OK) {
+            adc_reading += adc_raw;
+            samples++;
+        }
     }
 #else
-    for (int i = 0; i < NO_OF_SAMPLES; i++) {
+    for (int i = 0; i < APP_HUMIDITY_OVERSAMPLE; i++) {
         adc_reading += adc1_get_raw(ref->adc_channel);
+        samples++;
     }
 #endif
-    adc_reading /= NO_OF_SAMPLES;
-#undef NO_OF_SAMPLES
+    return samples ? (int)(adc_reading / samples) : -1;
+}
+
+static void app_humidity_post_event(app_humidity_t *ref, app_humidity_event_t event)
+{
+    if (xQueueSend(ref->event_queue, &event, 0) != pdPASS) {
+        /* Watchers read the latest value anyway, so a dropped change event is not lost information */
+        ESP_LOGD(TAG, "event queue full, drop event %d", event);
+    }
+}
+
+static void app_humidity_sample_cb(void *args)
+{
+    app_humidity_t *ref = args;
+    int raw = app_humidity_drive_read_raw(ref);
+    if (raw < 0) {
+        return;
+    }
+
+    int32_t sample_q = raw << APP_HUMIDITY_IIR_FRAC_BITS;
+    bool first_sample = !ref->filter_ready;
+    if (first_sample) {
+        ref->filtered_q = sample_q;
+        ref->filter_ready = true;
+    } else {
+        ref->filtered_q += (sample_q - ref->filtered_q) >> APP_HUMIDITY_IIR_SHIFT;
+    }
+    int filtered_raw = ref->filtered_q >> APP_HUMIDITY_IIR_FRAC_BITS;
+    int value = voltage2humidity(filtered_raw * APP_HUMIDITY_ADC_MAX_INPUT_V / 4095);
+
+    if (first_sample || abs(value - ref->humidity) >= APP_HUMIDITY_REPORT_HYSTERESIS) {
+        ref->humidity = value;
+        app_humidity_post_event(ref, APP_HUMIDITY_EVENT_CHANGED);
+    }
 
-    //return esp_adc_cal_raw_to_voltage(adc_reading, ref->adc_chars);
-    return voltage2humidity(adc_reading * APP_HUMIDITY_ADC_MAX_INPUT_V / 4095);
+    /* Threshold crossings are checked on every filtered sample, not only on reported changes */
+    int threshold = ref->lower_threshold;
+    if (threshold > 0) {
+        if (!ref->below_threshold && value <= threshold) {
+            ref->below_threshold = true;
+            ref->humidity = value;
+            app_humidity_post_event(ref, APP_HUMIDITY_EVENT_BELOW_THRESHOLD);
+        } else if (ref->below_threshold && value >= threshold + APP_HUMIDITY_THRESHOLD_HYSTERESIS) {
+            ref->below_threshold = false;
+        }
+    }
+}
+
+static void app_humidity_notify(watcher_t *watchers)
+{
+    for (int i = 0; i < APP_HUMIDITY_MAX_WATCHERS; i++) {
+        if (watchers[i].cb) {
+            watchers[i].cb(watchers[i].args);
+        }
+    }
 }
 
 static void humidity_task(void *pvParam)
@@ -241,37 +313,33 @@ static void humidity_task(void *pvParam)
 #endif
     app_humidity_drive_init(ref);
 
-    //init
-    int debounce_cnt = 0;
-    int cur_humidity = app_humidity_drive_read_value(ref);
     vTaskDelay(pdMS_TO_TICKS(5000));//wait ui
 
+    const esp_timer_create_args_t timer_args = {
+        .callback = app_humidity_sample_cb,
+        .arg = ref,
+        .name = "RH sample",
+        .skip_unhandled_events = true,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &ref->sample_timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(ref->sample_timer, APP_HUMIDITY_SAMPLE_PERIOD_MS * 1000));
+
+    /* Watchers run here, and this task only wakes up on meaningful changes */
     for (;;) {
-        int value = app_humidity_drive_read_value(ref);
-        //ESP_LOGI(TAG, "==>h %d%%",value);
-
-        if (value != cur_humidity) {
-            cur_humidity = value;
-            debounce_cnt = 0;
-        } else {
-            debounce_cnt++;
-
-            if (debounce_cnt > APP_HUMIDITY_MAX_DEBOUNCE) {
-                //we got a stable humidity
-                if (cur_humidity != ref->humidity) {
-                    ref->humidity = cur_humidity;
-
-                    for (int i = 0; i < APP_HUMIDITY_MAX_WATCHERS; i++) {
-                        if (ref->watchers[i].cb) {
-                            ref->watchers[i].cb(ref->watchers[i].args);
-                        }
-                    }
-                } else {
-                    debounce_cnt = 0;
-                }
-            }
+        app_humidity_event_t event;
+        if (xQueueReceive(ref->event_queue, &event, portMAX_DELAY) != pdPASS) {
+            continue;
+        }
+        switch (event) {
+        case APP_HUMIDITY_EVENT_CHANGED:
+            app_humidity_notify(ref->watchers);
+            break;
+        case APP_HUMIDITY_EVENT_BELOW_THRESHOLD:
+            ESP_LOGI(TAG, "humidity %d%% below %d%%", ref->humidity, ref->lower_threshold);
+            app_humidity_notify(ref->watchers);
+            app_humidity_notify(ref->threshold_watchers);
+            break;
         }
-        vTaskDelay(pdMS_TO_TICKS(1000));
     }
 }
 
@@ -280,6 +348,9 @@ esp_err_t app_humidity_init(void)
     app_humidity_t *ref = humidity_ref();
     ESP_RETURN_ON_FALSE(ref->task_handle == NULL, ESP_FAIL, TAG, "already init");
 
+    ref->event_queue = xQueueCreate(APP_HUMIDITY_EVENT_QUEUE_LEN, sizeof(app_humidity_event_t));
+    ESP_RETURN_ON_FALSE(ref->event_queue, ESP_ERR_NO_MEM, TAG, "create event queue failed");
+
     BaseType_t ret_val = xTaskCreatePinnedToCore(
                              (TaskFunction_t)        humidity_task,
                              (const char *const)    "RH Task",
@@ -295,30 +366,54 @@ int app_humidity_get_value(void)
 {
     return humidity_ref()->humidity;
 }
-esp_err_t app_humidity_add_watcher(app_humidity_cb_t cb, void *args)
+static esp_err_t watcher_add(watcher_t *watchers, app_humidity_cb_t cb, void *args)
 {
-    app_humidity_t *ref = humidity_ref();
-
     for (int i = 0; i < APP_HUMIDITY_MAX_WATCHERS; i++) {
-        if (ref->watchers[i].cb == NULL) {
-            ref->watchers[i].cb = cb;
-            ref->watchers[i].args = args;
+        if (watchers[i].cb == NULL) {
+            watchers[i].cb = cb;
+            watchers[i].args = args;
             return ESP_OK;
         }
     }
     return ESP_FAIL;
 }
 
-esp_err_t app_humidity_del_watcher(app_humidity_cb_t cb, void *args)
+static esp_err_t watcher_del(watcher_t *watchers, app_humidity_cb_t cb)
 {
-    app_humidity_t *ref = humidity_ref();
-
     for (int i = 0; i < APP_HUMIDITY_MAX_WATCHERS; i++) {
-        if (ref->watchers[i].cb == cb) {
-            ref->watchers[i].cb = NULL;
-            ref->watchers[i].args = NULL;
+        if (watchers[i].cb == cb) {
+            watchers[i].cb = NULL;
+            watchers[i].args = NULL;
             return ESP_OK;
         }
     }
     return ESP_FAIL;
 }
+
+esp_err_t app_humidity_add_watcher(app_humidity_cb_t cb, void *args)
+{
+    return watcher_add(humidity_ref()->watchers, cb, args);
+}
+
+esp_err_t app_humidity_del_watcher(app_humidity_cb_t cb, void *args)
+{
+    return watcher_del(humidity_ref()->watchers, cb);
+}
+
+esp_err_t app_humidity_add_threshold_watcher(app_humidity_cb_t cb, void *args)
+{
+    return watcher_add(humidity_ref()->threshold_watchers, cb, args);
+}
+
+esp_err_t app_humidity_del_threshold_watcher(app_humidity_cb_t cb, void *args)
+{
+    return watcher_del(humidity_ref()->threshold_watchers, cb);
+}
+
+void app_humidity_set_lower_threshold(int humidity)
+{
+    app_humidity_t *ref = humidity_ref();
+    ref->lower_threshold = humidity;
+    /* Re-evaluate against the new threshold on the next sample */
+    ref->below_threshold = false;
+}
@@ -19,6 +19,16 @@ esp_err_t app_humidity_init(void);
 esp_err_t app_humidity_add_watcher(app_humidity_cb_t cb, void *args);
 esp_err_t app_humidity_del_watcher(app_humidity_cb_t cb, void *args);
 int  app_humidity_get_value(void);
+
+/**
+ * @brief threshold watchers
+ *
+ * Called once each time the filtered humidity falls to or below the lower threshold.
+ * The threshold re-arms after the humidity rose a few percent above it again. 0 disables the threshold.
+ */
+esp_err_t app_humidity_add_threshold_watcher(app_humidity_cb_t cb, void *args);
+esp_err_t app_humidity_del_threshold_watcher(app_humidity_cb_t cb, void *args);
+void app_humidity_set_lower_threshold(int humidity);
 #ifdef __cplusplus
 }
 #endif
@@ -133,7 +133,8 @@ static void pump_task(void *pvParam)
     ESP_ERROR_CHECK(app_pump_drive_init(ref));
     app_pump_drive_set(ref, 0);
 
-    //app_humidity_add_watcher(app_pump_auto_watering, NULL);
+    app_humidity_set_lower_threshold(ref->lower_humidity);
+    app_humidity_add_threshold_watcher(app_pump_auto_watering, NULL);
     struct cb_entry *entry;
 
     for (;;) {
@@ -302,6 +303,7 @@ int app_pump_get_lower_humidity(void)
 int app_pump_set_lower_humidity(int min)
 {
     pump_ref()->lower_humidity = min;
+    app_humidity_set_lower_threshold(min);
     app_nvs_set_lower_humidity(min);
     return 0;
 }
@@ -1,934 +0,0 @@
-/*******************************************************************************
- * Size: 14 px
- * Bpp: 4
- * Opts: 
- ******************************************************************************/
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef FONT_EN_14
-#define FONT_EN_14 1
-#endif
-
-#if FONT_EN_14
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xd7, 0xd7, 0xd7, 0xd7, 0xc6, 0xb5, 0x93, 0x82,
-    0x0, 0xa6, 0xf9,
-
-    /* U+0022 "\"" */
-    0x77, 0x87, 0x77, 0x87, 0x77, 0x87, 0x67, 0x76,
-
-    /* U+0023 "#" */
-    0x0, 0x4b, 0x9, 0x60, 0x0, 0x69, 0xb, 0x40,
-    0x0, 0x86, 0xd, 0x20, 0x2e, 0xff, 0xef, 0xe4,
-    0x1, 0xc4, 0x2e, 0x10, 0x0, 0xe1, 0x2c, 0x0,
-    0x0, 0xf0, 0x4b, 0x0, 0x7e, 0xfe, 0xff, 0xd0,
-    0x5, 0xc1, 0x97, 0x10, 0x5, 0x90, 0xa4, 0x0,
-    0x8, 0x70, 0xc2, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x7, 0x40, 0x0, 0x2, 0xcf, 0xf8, 0x0,
-    0xe, 0xa9, 0x8d, 0x70, 0x4f, 0x7, 0x44, 0xd0,
-    0x4f, 0x7, 0x40, 0x0, 0x1e, 0xca, 0x40, 0x0,
-    0x2, 0xaf, 0xfa, 0x10, 0x0, 0x7, 0x9d, 0xd0,
-    0x22, 0x7, 0x41, 0xf3, 0x7b, 0x7, 0x40, 0xf4,
-    0x2f, 0x68, 0x57, 0xe0, 0x5, 0xff, 0xfe, 0x30,
-    0x0, 0x9, 0x60, 0x0, 0x0, 0x3, 0x20, 0x0,
-
-    /* U+0025 "%" */
-    0xb, 0xdc, 0x10, 0x0, 0x3e, 0x10, 0x7a, 0x8,
-    0x90, 0x0, 0xd5, 0x0, 0xa6, 0x4, 0xb0, 0x8,
-    0xa0, 0x0, 0xa6, 0x4, 0xb0, 0x3e, 0x10, 0x0,
-    0x7a, 0x9, 0x70, 0xd4, 0x0, 0x0, 0x9, 0xda,
-    0x9, 0x90, 0xad, 0x90, 0x0, 0x0, 0x4d, 0x8,
-    0x90, 0xa7, 0x0, 0x1, 0xe3, 0xb, 0x40, 0x6a,
-    0x0, 0xa, 0x80, 0xb, 0x40, 0x6a, 0x0, 0x5d,
-    0x0, 0x8, 0x80, 0xa6, 0x1, 0xe3, 0x0, 0x1,
-    0xbd, 0xa0,
-
-    /* U+0026 "&" */
-    0x0, 0x7e, 0xe7, 0x0, 0x0, 0x2, 0xf5, 0x4f,
-    0x30, 0x0, 0x4, 0xe0, 0xe, 0x50, 0x0, 0x0,
-    0xe6, 0x6e, 0x10, 0x0, 0x0, 0x7f, 0xe3, 0x0,
-    0x0, 0x4, 0xed, 0xd0, 0x13, 0x0, 0x2f, 0x50,
-    0xd9, 0x8a, 0x0, 0x7c, 0x0, 0x2f, 0xe6, 0x0,
-    0x7d, 0x0, 0x7, 0xf4, 0x0, 0x2f, 0x82, 0x5e,
-    0xcd, 0x0, 0x5, 0xdf, 0xd6, 0xd, 0xa0,
-
-    /* U+0027 "'" */
-    0x86, 0x86, 0x86, 0x76,
-
-    /* U+0028 "(" */
-    0x0, 0x78, 0x1, 0xe1, 0x7, 0xa0, 0xc, 0x50,
-    0xf, 0x20, 0x3f, 0x0, 0x4f, 0x0, 0x4f, 0x0,
-    0x3f, 0x0, 0xf, 0x20, 0xc, 0x50, 0x6, 0xa0,
-    0x0, 0xd1, 0x0, 0x68,
-
-    /* U+0029 ")" */
-    0xd, 0x10, 0x6, 0x80, 0x1, 0xe0, 0x0, 0xb6,
-    0x0, 0x8a, 0x0, 0x6d, 0x0, 0x5e, 0x0, 0x5e,
-    0x0, 0x6d, 0x0, 0x8a, 0x0, 0xb6, 0x1, 0xf1,
-    0x6, 0xa0, 0xd, 0x10,
-
-    /* U+002A "*" */
-    0x0, 0xb0, 0x6, 0x8d, 0x95, 0x8, 0xf6, 0x0,
-    0xc3, 0xb0, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x4, 0xa0, 0x0, 0x0, 0x4, 0xa0, 0x0,
-    0x0, 0x4, 0xa0, 0x0, 0x0, 0x4, 0xa0, 0x0,
-    0x4e, 0xef, 0xfe, 0xea, 0x1, 0x15, 0xb1, 0x11,
-    0x0, 0x4, 0xa0, 0x0, 0x0, 0x4, 0xa0, 0x0,
-
-    /* U+002C "," */
-    0x97, 0xdb, 0x1a, 0xa3, 0x0,
-
-    /* U+002D "-" */
-    0x0, 0x0, 0x4, 0xff, 0xfc, 0x3, 0x33, 0x20,
-
-    /* U+002E "." */
-    0x97, 0xdb,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x4b, 0x0, 0x0, 0xa5, 0x0, 0x1,
-    0xe0, 0x0, 0x6, 0x90, 0x0, 0xc, 0x30, 0x0,
-    0x2d, 0x0, 0x0, 0x87, 0x0, 0x0, 0xe1, 0x0,
-    0x4, 0xb0, 0x0, 0xb, 0x50, 0x0, 0x1e, 0x0,
-    0x0,
-
-    /* U+0030 "0" */
-    0x1, 0xae, 0xe8, 0x0, 0xb, 0xc3, 0x4e, 0x70,
-    0x1f, 0x30, 0x6, 0xe0, 0x4f, 0x0, 0x2, 0xf1,
-    0x6d, 0x0, 0x1, 0xf2, 0x6d, 0x0, 0x1, 0xf3,
-    0x6d, 0x0, 0x1, 0xf2, 0x4f, 0x0, 0x2, 0xf1,
-    0x1f, 0x30, 0x6, 0xe0, 0xb, 0xc3, 0x4e, 0x80,
-    0x1, 0xaf, 0xe8, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x1f, 0x2, 0xbf, 0xbf, 0xff, 0x11, 0x4f,
-    0x0, 0x3f, 0x0, 0x3f, 0x0, 0x3f, 0x0, 0x3f,
-    0x0, 0x3f, 0x0, 0x3f, 0x0, 0x3f,
-
-    /* U+0032 "2" */
-    0x2, 0xbf, 0xe7, 0x0, 0xcb, 0x35, 0xe7, 0x3f,
-    0x10, 0x7, 0xc4, 0xc0, 0x0, 0x6d, 0x0, 0x0,
-    0xb, 0xa0, 0x0, 0x9, 0xe2, 0x0, 0x1c, 0xe3,
-    0x0, 0x3e, 0xa1, 0x0, 0xe, 0x70, 0x0, 0x5,
-    0xd2, 0x22, 0x21, 0x9f, 0xff, 0xff, 0xd0,
-
-    /* U+0033 "3" */
-    0x2, 0xbf, 0xd6, 0x0, 0xc, 0xa3, 0x5f, 0x50,
-    0x2f, 0x10, 0xa, 0x90, 0x3a, 0x0, 0x9, 0xa0,
-    0x0, 0x0, 0x3f, 0x40, 0x0, 0xe, 0xfb, 0x0,
-    0x0, 0x2, 0x4c, 0xb0, 0x22, 0x0, 0x3, 0xf1,
-    0x7c, 0x0, 0x4, 0xf0, 0x2f, 0x83, 0x4d, 0xa0,
-    0x4, 0xcf, 0xe8, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x6d, 0x0, 0x0, 0x1, 0xed, 0x0,
-    0x0, 0xb, 0x8d, 0x0, 0x0, 0x6a, 0x4d, 0x0,
-    0x1, 0xd1, 0x4d, 0x0, 0xa, 0x60, 0x4d, 0x0,
-    0x5b, 0x0, 0x4d, 0x0, 0x9f, 0xff, 0xff, 0xf3,
-    0x12, 0x22, 0x5e, 0x20, 0x0, 0x0, 0x4d, 0x0,
-    0x0, 0x0, 0x4d, 0x0,
-
-    /* U+0035 "5" */
-    0x6, 0xff, 0xff, 0x90, 0x8, 0x92, 0x22, 0x10,
-    0xb, 0x60, 0x0, 0x0, 0xd, 0x30, 0x0, 0x0,
-    0xf, 0x9e, 0xd8, 0x0, 0x2f, 0x83, 0x5e, 0x80,
-    0x1, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x2, 0xf1,
-    0x6c, 0x0, 0x5, 0xf0, 0x1f, 0x93, 0x5e, 0x80,
-    0x3, 0xcf, 0xe8, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x8e, 0xfa, 0x0, 0x8, 0xd4, 0x3d, 0x90,
-    0xe, 0x30, 0x4, 0xc0, 0x3e, 0x0, 0x0, 0x0,
-    0x5c, 0x6d, 0xea, 0x10, 0x7e, 0xc4, 0x4d, 0xb0,
-    0x7f, 0x20, 0x3, 0xf1, 0x5f, 0x0, 0x0, 0xf3,
-    0x2f, 0x20, 0x3, 0xf1, 0xb, 0xc3, 0x4d, 0xa0,
-    0x1, 0xaf, 0xfa, 0x10,
-
-    /* U+0037 "7" */
-    0x4f, 0xff, 0xff, 0xf2, 0x13, 0x33, 0x38, 0xc0,
-    0x0, 0x0, 0x1d, 0x20, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x2, 0xf0, 0x0, 0x0, 0xa, 0x90, 0x0,
-    0x0, 0x1f, 0x40, 0x0, 0x0, 0x5e, 0x0, 0x0,
-    0x0, 0xaa, 0x0, 0x0, 0x0, 0xc8, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x1, 0xae, 0xe8, 0x0, 0xa, 0xc3, 0x4e, 0x60,
-    0xf, 0x40, 0x8, 0xb0, 0xf, 0x30, 0x7, 0xc0,
-    0xa, 0xb1, 0x2d, 0x60, 0x2, 0xff, 0xfd, 0x0,
-    0x1e, 0xa3, 0x4c, 0xc0, 0x5e, 0x0, 0x2, 0xf2,
-    0x5e, 0x0, 0x2, 0xf1, 0x1e, 0xa3, 0x3c, 0xc0,
-    0x3, 0xbf, 0xea, 0x10,
-
-    /* U+0039 "9" */
-    0x2, 0xbf, 0xe7, 0x0, 0xe, 0x92, 0x5f, 0x60,
-    0x5e, 0x0, 0x8, 0xc0, 0x7c, 0x0, 0x5, 0xf0,
-    0x6e, 0x0, 0x7, 0xf1, 0x1f, 0x80, 0x3d, 0xf2,
-    0x5, 0xef, 0xe6, 0xf1, 0x0, 0x1, 0x3, 0xf0,
-    0x2c, 0x0, 0x8, 0xb0, 0xe, 0x92, 0x5f, 0x40,
-    0x3, 0xcf, 0xe6, 0x0,
-
-    /* U+003A ":" */
-    0xdb, 0x97, 0x0, 0x0, 0x0, 0x0, 0x97, 0xdb,
-
-    /* U+003B ";" */
-    0xdb, 0x97, 0x0, 0x0, 0x0, 0x0, 0x97, 0xdb,
-    0x1a, 0xa3, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x26, 0x0, 0x0, 0x2a, 0xd5,
-    0x0, 0x3b, 0xd5, 0x0, 0x2b, 0xd5, 0x0, 0x0,
-    0x4f, 0x70, 0x0, 0x0, 0x1, 0x8e, 0x81, 0x0,
-    0x0, 0x1, 0x8e, 0x81, 0x0, 0x0, 0x1, 0x8a,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0x4e, 0xee, 0xee, 0xea, 0x1, 0x11, 0x11, 0x11,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xee, 0xee, 0xea,
-    0x1, 0x11, 0x11, 0x11,
-
-    /* U+003E ">" */
-    0x35, 0x0, 0x0, 0x0, 0x1a, 0xd5, 0x0, 0x0,
-    0x0, 0x2a, 0xd6, 0x0, 0x0, 0x0, 0x2a, 0xd5,
-    0x0, 0x0, 0x4, 0xd9, 0x0, 0x4, 0xcb, 0x40,
-    0x5, 0xdb, 0x30, 0x0, 0x5b, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x1, 0xaf, 0xe8, 0x0, 0xac, 0x34, 0xe7, 0x1f,
-    0x20, 0x7, 0xc1, 0x90, 0x0, 0x7c, 0x0, 0x0,
-    0x1e, 0x70, 0x0, 0xc, 0xb0, 0x0, 0x7, 0xd0,
-    0x0, 0x0, 0xb7, 0x0, 0x0, 0x4, 0x20, 0x0,
-    0x0, 0xa6, 0x0, 0x0, 0xf, 0x90, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x6, 0xcd, 0xda, 0x30, 0x0, 0xb, 0x91,
-    0x0, 0x3d, 0x50, 0x8, 0x90, 0x7d, 0xc4, 0x7e,
-    0x11, 0xe0, 0x7d, 0x37, 0xf5, 0x96, 0x4a, 0xe,
-    0x30, 0xf, 0x16, 0x86, 0x94, 0xc0, 0x1, 0xd0,
-    0x87, 0x4a, 0x5a, 0x0, 0x78, 0xd, 0x21, 0xe3,
-    0xe0, 0x2e, 0x57, 0x80, 0x8, 0x97, 0xd9, 0x6d,
-    0x76, 0x0, 0xb, 0x91, 0x0, 0x2b, 0x60, 0x0,
-    0x6, 0xcd, 0xdb, 0x30, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0xb,
-    0xfc, 0x0, 0x0, 0x0, 0x1, 0xf9, 0xf2, 0x0,
-    0x0, 0x0, 0x6f, 0xe, 0x80, 0x0, 0x0, 0xc,
-    0xa0, 0x9d, 0x0, 0x0, 0x2, 0xf5, 0x4, 0xf3,
-    0x0, 0x0, 0x7f, 0x0, 0xf, 0x90, 0x0, 0xd,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xf6, 0x33, 0x36,
-    0xf4, 0x0, 0x9d, 0x0, 0x0, 0xd, 0xa0, 0xe,
-    0x70, 0x0, 0x0, 0x7f, 0x0,
-
-    /* U+0042 "B" */
-    0xef, 0xff, 0xfd, 0x60, 0xe8, 0x33, 0x39, 0xf3,
-    0xe6, 0x0, 0x0, 0xe8, 0xe6, 0x0, 0x0, 0xd7,
-    0xe6, 0x0, 0x16, 0xf1, 0xef, 0xff, 0xff, 0x80,
-    0xe8, 0x33, 0x36, 0xe8, 0xe6, 0x0, 0x0, 0x7e,
-    0xe6, 0x0, 0x0, 0x7d, 0xe8, 0x33, 0x35, 0xe8,
-    0xef, 0xff, 0xfe, 0x80,
-
-    /* U+0043 "C" */
-    0x0, 0x1a, 0xef, 0xd6, 0x0, 0x2, 0xeb, 0x53,
-    0x7e, 0x90, 0xb, 0xc0, 0x0, 0x4, 0xf2, 0x1f,
-    0x40, 0x0, 0x0, 0x62, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10,
-    0x0, 0x0, 0x21, 0x2f, 0x40, 0x0, 0x0, 0xe6,
-    0xc, 0xc0, 0x0, 0x5, 0xf1, 0x2, 0xfb, 0x53,
-    0x7f, 0x80, 0x0, 0x2a, 0xef, 0xd6, 0x0,
-
-    /* U+0044 "D" */
-    0xef, 0xff, 0xea, 0x30, 0xe, 0x83, 0x34, 0xaf,
-    0x30, 0xe6, 0x0, 0x0, 0xbd, 0xe, 0x60, 0x0,
-    0x4, 0xf2, 0xe6, 0x0, 0x0, 0x1f, 0x4e, 0x60,
-    0x0, 0x0, 0xf4, 0xe6, 0x0, 0x0, 0x1f, 0x3e,
-    0x60, 0x0, 0x5, 0xf1, 0xe6, 0x0, 0x0, 0xcb,
-    0xe, 0x83, 0x35, 0xcf, 0x20, 0xef, 0xff, 0xea,
-    0x20, 0x0,
-
-    /* U+0045 "E" */
-    0xef, 0xff, 0xff, 0xf0, 0xe8, 0x33, 0x33, 0x30,
-    0xe6, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x90,
-    0xe8, 0x33, 0x33, 0x10, 0xe6, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0, 0xe8, 0x33, 0x33, 0x30,
-    0xef, 0xff, 0xff, 0xf0,
-
-    /* U+0046 "F" */
-    0xef, 0xff, 0xff, 0xae, 0x83, 0x33, 0x32, 0xe6,
-    0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf0, 0xe8, 0x33, 0x33,
-    0xe, 0x60, 0x0, 0x0, 0xe6, 0x0, 0x0, 0xe,
-    0x60, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x19, 0xef, 0xd8, 0x10, 0x1, 0xec, 0x53,
-    0x6d, 0xc0, 0xa, 0xd0, 0x0, 0x1, 0xf5, 0x1f,
-    0x50, 0x0, 0x0, 0x43, 0x4f, 0x10, 0x0, 0x0,
-    0x0, 0x5f, 0x0, 0xa, 0xff, 0xfc, 0x5f, 0x0,
-    0x2, 0x33, 0x9c, 0x1f, 0x40, 0x0, 0x0, 0xac,
-    0xb, 0xc0, 0x0, 0x2, 0xfc, 0x1, 0xec, 0x53,
-    0x6e, 0xcc, 0x0, 0x19, 0xef, 0xc5, 0x3c,
-
-    /* U+0048 "H" */
-    0xe6, 0x0, 0x0, 0x5f, 0xe, 0x60, 0x0, 0x5,
-    0xf0, 0xe6, 0x0, 0x0, 0x5f, 0xe, 0x60, 0x0,
-    0x5, 0xf0, 0xe6, 0x0, 0x0, 0x5f, 0xe, 0xff,
-    0xff, 0xff, 0xf0, 0xe8, 0x33, 0x33, 0x7f, 0xe,
-    0x60, 0x0, 0x5, 0xf0, 0xe6, 0x0, 0x0, 0x5f,
-    0xe, 0x60, 0x0, 0x5, 0xf0, 0xe6, 0x0, 0x0,
-    0x5f, 0x0,
-
-    /* U+0049 "I" */
-    0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7,
-    0xd7, 0xd7, 0xd7,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x2f, 0x20, 0x0, 0x2, 0xf2, 0x0,
-    0x0, 0x2f, 0x20, 0x0, 0x2, 0xf2, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2f,
-    0x28, 0x80, 0x2, 0xf2, 0x9b, 0x0, 0x3f, 0x15,
-    0xf6, 0x4c, 0xd0, 0x7, 0xef, 0xb2, 0x0,
-
-    /* U+004B "K" */
-    0xe6, 0x0, 0x1, 0xdb, 0xe, 0x60, 0x1, 0xdc,
-    0x0, 0xe6, 0x0, 0xcc, 0x0, 0xe, 0x60, 0xbd,
-    0x10, 0x0, 0xe6, 0xaf, 0x30, 0x0, 0xe, 0xee,
-    0xdb, 0x0, 0x0, 0xee, 0x23, 0xf5, 0x0, 0xe,
-    0x60, 0x9, 0xe1, 0x0, 0xe6, 0x0, 0xe, 0xb0,
-    0xe, 0x60, 0x0, 0x4f, 0x50, 0xe6, 0x0, 0x0,
-    0x9e, 0x10,
-
-    /* U+004C "L" */
-    0xe6, 0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0xe6,
-    0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0xe, 0x60, 0x0, 0x0, 0xe6, 0x0, 0x0,
-    0xe, 0x60, 0x0, 0x0, 0xe6, 0x0, 0x0, 0xe,
-    0x83, 0x33, 0x32, 0xef, 0xff, 0xff, 0xb0,
-
-    /* U+004D "M" */
-    0xef, 0x10, 0x0, 0x0, 0xef, 0x1e, 0xf7, 0x0,
-    0x0, 0x4f, 0xf1, 0xeb, 0xc0, 0x0, 0x9, 0xbf,
-    0x1e, 0x6f, 0x20, 0x0, 0xe6, 0xf1, 0xe6, 0xb7,
-    0x0, 0x4d, 0x3f, 0x1e, 0x65, 0xd0, 0xa, 0x83,
-    0xf1, 0xe6, 0xf, 0x20, 0xf3, 0x3f, 0x1e, 0x60,
-    0xa7, 0x4d, 0x3, 0xf1, 0xe6, 0x5, 0xda, 0x80,
-    0x3f, 0x1e, 0x60, 0xf, 0xf2, 0x3, 0xf1, 0xe6,
-    0x0, 0xad, 0x0, 0x3f, 0x10,
-
-    /* U+004E "N" */
-    0xec, 0x0, 0x0, 0x3f, 0xe, 0xf5, 0x0, 0x3,
-    0xf0, 0xec, 0xe0, 0x0, 0x3f, 0xe, 0x5d, 0x80,
-    0x3, 0xf0, 0xe5, 0x4f, 0x20, 0x3f, 0xe, 0x50,
-    0xab, 0x3, 0xf0, 0xe5, 0x1, 0xf5, 0x3f, 0xe,
-    0x50, 0x7, 0xd4, 0xf0, 0xe5, 0x0, 0xd, 0xbf,
-    0xe, 0x50, 0x0, 0x4f, 0xf0, 0xe5, 0x0, 0x0,
-    0xbf, 0x0,
-
-    /* U+004F "O" */
-    0x0, 0x19, 0xef, 0xd6, 0x0, 0x0, 0x2e, 0xc5,
-    0x37, 0xeb, 0x0, 0xc, 0xb0, 0x0, 0x2, 0xf6,
-    0x2, 0xf3, 0x0, 0x0, 0x9, 0xc0, 0x6f, 0x0,
-    0x0, 0x0, 0x5f, 0x7, 0xe0, 0x0, 0x0, 0x3,
-    0xf1, 0x6f, 0x0, 0x0, 0x0, 0x5f, 0x2, 0xf3,
-    0x0, 0x0, 0x9, 0xc0, 0xc, 0xb0, 0x0, 0x2,
-    0xf6, 0x0, 0x2e, 0xc5, 0x37, 0xeb, 0x0, 0x0,
-    0x19, 0xef, 0xd6, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xef, 0xff, 0xfd, 0x50, 0xe8, 0x33, 0x4a, 0xf2,
-    0xe6, 0x0, 0x0, 0xe7, 0xe6, 0x0, 0x0, 0xd7,
-    0xe6, 0x0, 0x7, 0xf3, 0xef, 0xff, 0xff, 0x80,
-    0xe8, 0x33, 0x20, 0x0, 0xe6, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x19, 0xef, 0xd6, 0x0, 0x0, 0x2e, 0xc5,
-    0x37, 0xeb, 0x0, 0xc, 0xb0, 0x0, 0x2, 0xf6,
-    0x2, 0xf3, 0x0, 0x0, 0x9, 0xc0, 0x6f, 0x0,
-    0x0, 0x0, 0x5f, 0x7, 0xe0, 0x0, 0x0, 0x3,
-    0xf1, 0x6f, 0x0, 0x0, 0x0, 0x5f, 0x2, 0xf3,
-    0x0, 0x1, 0x9, 0xc0, 0xc, 0xb0, 0x2, 0xe6,
-    0xf6, 0x0, 0x2e, 0xc5, 0x3b, 0xfd, 0x0, 0x0,
-    0x19, 0xef, 0xd8, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x40,
-
-    /* U+0052 "R" */
-    0xef, 0xff, 0xfe, 0x80, 0xe, 0x83, 0x33, 0x6f,
-    0x70, 0xe6, 0x0, 0x0, 0x9c, 0xe, 0x60, 0x0,
-    0x9, 0xb0, 0xe6, 0x0, 0x4, 0xe6, 0xe, 0xff,
-    0xff, 0xf9, 0x0, 0xe8, 0x33, 0x37, 0xf3, 0xe,
-    0x60, 0x0, 0xd, 0x80, 0xe6, 0x0, 0x0, 0xaa,
-    0xe, 0x60, 0x0, 0x9, 0xb0, 0xe6, 0x0, 0x0,
-    0x7e, 0x0,
-
-    /* U+0053 "S" */
-    0x0, 0x8d, 0xfd, 0x70, 0x0, 0xbd, 0x53, 0x6e,
-    0x90, 0x1f, 0x40, 0x0, 0x6f, 0x1, 0xf5, 0x0,
-    0x0, 0x50, 0xa, 0xfa, 0x51, 0x0, 0x0, 0x6,
-    0xbe, 0xfc, 0x40, 0x0, 0x0, 0x3, 0xaf, 0x35,
-    0x90, 0x0, 0x0, 0xe8, 0x4f, 0x20, 0x0, 0xe,
-    0x70, 0xce, 0x63, 0x4b, 0xe1, 0x0, 0x7d, 0xfe,
-    0xa2, 0x0,
-
-    /* U+0054 "T" */
-    0xff, 0xff, 0xff, 0xff, 0x3, 0x33, 0xbc, 0x33,
-    0x30, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x0, 0xab,
-    0x0, 0x0, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x0,
-    0xab, 0x0, 0x0, 0x0, 0xa, 0xb0, 0x0, 0x0,
-    0x0, 0xab, 0x0, 0x0, 0x0, 0xa, 0xb0, 0x0,
-    0x0, 0x0, 0xab, 0x0, 0x0, 0x0, 0xa, 0xb0,
-    0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xf5, 0x0, 0x0, 0x4f, 0x1f, 0x50, 0x0, 0x4,
-    0xf1, 0xf5, 0x0, 0x0, 0x4f, 0x1f, 0x50, 0x0,
-    0x4, 0xf1, 0xf5, 0x0, 0x0, 0x4f, 0x1f, 0x50,
-    0x0, 0x4, 0xf1, 0xf5, 0x0, 0x0, 0x4f, 0x1e,
-    0x70, 0x0, 0x5, 0xf0, 0xbc, 0x0, 0x0, 0xad,
-    0x4, 0xfa, 0x44, 0x9f, 0x50, 0x4, 0xcf, 0xfd,
-    0x50, 0x0,
-
-    /* U+0056 "V" */
-    0xd, 0x90, 0x0, 0x0, 0xe6, 0x8, 0xd0, 0x0,
-    0x4, 0xf1, 0x3, 0xf2, 0x0, 0x8, 0xc0, 0x0,
-    0xe7, 0x0, 0xd, 0x70, 0x0, 0x9c, 0x0, 0x2f,
-    0x20, 0x0, 0x4f, 0x10, 0x7c, 0x0, 0x0, 0xe,
-    0x50, 0xc7, 0x0, 0x0, 0x9, 0xa1, 0xf2, 0x0,
-    0x0, 0x4, 0xf6, 0xd0, 0x0, 0x0, 0x0, 0xfe,
-    0x80, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0,
-
-    /* U+0057 "W" */
-    0xba, 0x0, 0x5, 0xf5, 0x0, 0xa, 0xa7, 0xd0,
-    0x0, 0x9f, 0x90, 0x0, 0xd6, 0x3f, 0x10, 0xd,
-    0x9c, 0x0, 0x1f, 0x30, 0xf4, 0x1, 0xf2, 0xf0,
-    0x4, 0xe0, 0xc, 0x70, 0x5b, 0xd, 0x40, 0x8b,
-    0x0, 0x8b, 0x9, 0x70, 0x98, 0xc, 0x70, 0x5,
-    0xe0, 0xd3, 0x6, 0xc0, 0xf3, 0x0, 0x1f, 0x3f,
-    0x0, 0x2f, 0x3f, 0x0, 0x0, 0xda, 0xb0, 0x0,
-    0xea, 0xb0, 0x0, 0x9, 0xf7, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x6f, 0x30, 0x0, 0x6f, 0x30, 0x0,
-
-    /* U+0058 "X" */
-    0x8, 0xf1, 0x0, 0x6, 0xf1, 0x0, 0xda, 0x0,
-    0x1f, 0x60, 0x0, 0x4f, 0x30, 0xac, 0x0, 0x0,
-    0xa, 0xc4, 0xf3, 0x0, 0x0, 0x1, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x3,
-    0xfd, 0xc0, 0x0, 0x0, 0xd, 0x92, 0xf6, 0x0,
-    0x0, 0x7e, 0x10, 0x8e, 0x10, 0x2, 0xf6, 0x0,
-    0xe, 0xa0, 0xb, 0xc0, 0x0, 0x5, 0xf4,
-
-    /* U+0059 "Y" */
-    0xad, 0x0, 0x0, 0xb, 0xc0, 0x1f, 0x70, 0x0,
-    0x4f, 0x20, 0x7, 0xf1, 0x0, 0xd9, 0x0, 0x0,
-    0xd9, 0x6, 0xe1, 0x0, 0x0, 0x4f, 0x4e, 0x60,
-    0x0, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x2,
-    0xf4, 0x0, 0x0, 0x0, 0x1, 0xf3, 0x0, 0x0,
-    0x0, 0x1, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x0, 0x1, 0xf3, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x3f, 0xff, 0xff, 0xff, 0x10, 0x33, 0x33, 0x3c,
-    0xd0, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0x2,
-    0xf6, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x9e, 0x10, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0,
-    0x1e, 0x80, 0x0, 0x0, 0xb, 0xc0, 0x0, 0x0,
-    0x7, 0xf5, 0x33, 0x33, 0x30, 0xbf, 0xff, 0xff,
-    0xff, 0x40,
-
-    /* U+005B "[" */
-    0xff, 0xaf, 0x20, 0xf2, 0xf, 0x20, 0xf2, 0xf,
-    0x20, 0xf2, 0xf, 0x20, 0xf2, 0xf, 0x20, 0xf2,
-    0xf, 0x20, 0xf2, 0xf, 0xfa,
-
-    /* U+005C "\\" */
-    0x1e, 0x0, 0x0, 0xb, 0x50, 0x0, 0x4, 0xb0,
-    0x0, 0x0, 0xe1, 0x0, 0x0, 0x87, 0x0, 0x0,
-    0x2d, 0x0, 0x0, 0xc, 0x30, 0x0, 0x6, 0x90,
-    0x0, 0x1, 0xe0, 0x0, 0x0, 0xa5, 0x0, 0x0,
-    0x4b,
-
-    /* U+005D "]" */
-    0xff, 0xa0, 0x8a, 0x8, 0xa0, 0x8a, 0x8, 0xa0,
-    0x8a, 0x8, 0xa0, 0x8a, 0x8, 0xa0, 0x8a, 0x8,
-    0xa0, 0x8a, 0x8, 0xaf, 0xfa,
-
-    /* U+005E "^" */
-    0x0, 0x2, 0x60, 0x0, 0x0, 0xb, 0xe2, 0x0,
-    0x0, 0x3c, 0x69, 0x0, 0x0, 0xa4, 0xd, 0x10,
-    0x2, 0xd0, 0x7, 0x80, 0x9, 0x60, 0x0, 0xd0,
-    0x1d, 0x0, 0x0, 0x87,
-
-    /* U+005F "_" */
-    0xcc, 0xcc, 0xcc, 0xc0,
-
-    /* U+0060 "`" */
-    0xc, 0x80, 0x1, 0xd2,
-
-    /* U+0061 "a" */
-    0x3, 0xcf, 0xea, 0x0, 0xe, 0x82, 0x4e, 0x70,
-    0x18, 0x0, 0xa, 0x80, 0x0, 0x59, 0xcf, 0x90,
-    0x1e, 0xa5, 0x3a, 0x90, 0x6d, 0x0, 0xb, 0x90,
-    0x6f, 0x43, 0x8f, 0xa0, 0xa, 0xfe, 0x95, 0xf4,
-
-    /* U+0062 "b" */
-    0x1f, 0x20, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x0, 0x1f, 0x6d, 0xfd, 0x40,
-    0x1f, 0xe5, 0x39, 0xf1, 0x1f, 0x60, 0x0, 0xc8,
-    0x1f, 0x20, 0x0, 0x8b, 0x1f, 0x20, 0x0, 0x8b,
-    0x1f, 0x60, 0x0, 0xc9, 0x1f, 0xe5, 0x38, 0xf2,
-    0x1f, 0x5c, 0xfd, 0x40,
-
-    /* U+0063 "c" */
-    0x1, 0xbf, 0xea, 0x10, 0xc, 0xc3, 0x3c, 0xa0,
-    0x3f, 0x10, 0x3, 0x90, 0x6d, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x0, 0x0, 0x4f, 0x10, 0x4, 0xe0,
-    0xd, 0xb3, 0x4d, 0x80, 0x2, 0xbf, 0xe9, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x0, 0xd5,
-    0x0, 0x0, 0x0, 0xd5, 0x2, 0xbf, 0xe6, 0xd5,
-    0xd, 0xc3, 0x4c, 0xf5, 0x4f, 0x10, 0x2, 0xf5,
-    0x6d, 0x0, 0x0, 0xd5, 0x6c, 0x0, 0x0, 0xd5,
-    0x4f, 0x0, 0x1, 0xf5, 0xc, 0xa1, 0x1a, 0xf5,
-    0x1, 0xbf, 0xe9, 0xd5,
-
-    /* U+0065 "e" */
-    0x1, 0xaf, 0xe8, 0x0, 0xc, 0xa3, 0x4d, 0x80,
-    0x3e, 0x0, 0x3, 0xe0, 0x6f, 0xff, 0xff, 0xf2,
-    0x6d, 0x22, 0x22, 0x20, 0x3f, 0x10, 0x2, 0xb0,
-    0xc, 0xc3, 0x3c, 0x90, 0x1, 0xbf, 0xe9, 0x0,
-
-    /* U+0066 "f" */
-    0x2, 0xdf, 0x20, 0x8c, 0x30, 0x9, 0x90, 0xd,
-    0xff, 0xf0, 0x1a, 0xa1, 0x0, 0x99, 0x0, 0x9,
-    0x90, 0x0, 0x99, 0x0, 0x9, 0x90, 0x0, 0x99,
-    0x0, 0x9, 0x90, 0x0,
-
-    /* U+0067 "g" */
-    0x1, 0xbf, 0xe5, 0xf2, 0xc, 0xb3, 0x4d, 0xf2,
-    0x3f, 0x10, 0x4, 0xf2, 0x6d, 0x0, 0x1, 0xf2,
-    0x7d, 0x0, 0x1, 0xf2, 0x4f, 0x0, 0x5, 0xf2,
-    0xd, 0xb3, 0x5d, 0xf2, 0x2, 0xbf, 0xd4, 0xf1,
-    0x3, 0x0, 0x3, 0xf0, 0xf, 0x71, 0x2c, 0x90,
-    0x4, 0xcf, 0xe9, 0x0,
-
-    /* U+0068 "h" */
-    0x1f, 0x10, 0x0, 0x1, 0xf1, 0x0, 0x0, 0x1f,
-    0x10, 0x0, 0x1, 0xf5, 0xdf, 0xc2, 0x1f, 0xd4,
-    0x3c, 0xa1, 0xf4, 0x0, 0x5d, 0x1f, 0x10, 0x4,
-    0xe1, 0xf1, 0x0, 0x4e, 0x1f, 0x10, 0x4, 0xe1,
-    0xf1, 0x0, 0x4e, 0x1f, 0x10, 0x4, 0xe0,
-
-    /* U+0069 "i" */
-    0xf, 0x20, 0x91, 0x0, 0x0, 0xf2, 0xf, 0x20,
-    0xf2, 0xf, 0x20, 0xf2, 0xf, 0x20, 0xf2, 0xf,
-    0x20,
-
-    /* U+006A "j" */
-    0x0, 0xf2, 0x0, 0x91, 0x0, 0x0, 0x0, 0xf2,
-    0x0, 0xf2, 0x0, 0xf2, 0x0, 0xf2, 0x0, 0xf2,
-    0x0, 0xf2, 0x0, 0xf2, 0x0, 0xf2, 0x0, 0xf2,
-    0x4, 0xf1, 0x3f, 0x90,
-
-    /* U+006B "k" */
-    0xf, 0x20, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0,
-    0xf, 0x20, 0x0, 0x0, 0xf, 0x20, 0x2e, 0x90,
-    0xf, 0x21, 0xd9, 0x0, 0xf, 0x3d, 0x90, 0x0,
-    0xf, 0xef, 0x80, 0x0, 0xf, 0x95, 0xf2, 0x0,
-    0xf, 0x20, 0xbb, 0x0, 0xf, 0x20, 0x2f, 0x50,
-    0xf, 0x20, 0x8, 0xe0,
-
-    /* U+006C "l" */
-    0xf, 0x20, 0xf2, 0xf, 0x20, 0xf2, 0xf, 0x20,
-    0xf2, 0xf, 0x20, 0xf2, 0xf, 0x20, 0xf2, 0xf,
-    0x20,
-
-    /* U+006D "m" */
-    0x1f, 0x5d, 0xfb, 0x2b, 0xfd, 0x40, 0x1f, 0xb1,
-    0x1e, 0xf4, 0x7, 0xe0, 0x1f, 0x30, 0xa, 0xa0,
-    0x2, 0xf0, 0x1f, 0x10, 0xa, 0x90, 0x2, 0xf0,
-    0x1f, 0x10, 0xa, 0x90, 0x2, 0xf0, 0x1f, 0x10,
-    0xa, 0x90, 0x2, 0xf0, 0x1f, 0x10, 0xa, 0x90,
-    0x2, 0xf0, 0x1f, 0x10, 0xa, 0x90, 0x2, 0xf0,
-
-    /* U+006E "n" */
-    0x1f, 0x4d, 0xfc, 0x21, 0xfb, 0x10, 0xaa, 0x1f,
-    0x40, 0x5, 0xd1, 0xf1, 0x0, 0x4e, 0x1f, 0x10,
-    0x4, 0xe1, 0xf1, 0x0, 0x4e, 0x1f, 0x10, 0x4,
-    0xe1, 0xf1, 0x0, 0x4e,
-
-    /* U+006F "o" */
-    0x1, 0xaf, 0xfa, 0x10, 0xc, 0xc4, 0x3c, 0xc0,
-    0x4f, 0x10, 0x1, 0xf4, 0x6d, 0x0, 0x0, 0xc7,
-    0x6d, 0x0, 0x0, 0xc7, 0x4f, 0x10, 0x1, 0xf4,
-    0xc, 0xc4, 0x3c, 0xc0, 0x1, 0xaf, 0xfa, 0x10,
-
-    /* U+0070 "p" */
-    0x1f, 0x7d, 0xfd, 0x40, 0x1f, 0xd2, 0x6, 0xf1,
-    0x1f, 0x50, 0x0, 0xb8, 0x1f, 0x20, 0x0, 0x8b,
-    0x1f, 0x20, 0x0, 0x8b, 0x1f, 0x60, 0x0, 0xc9,
-    0x1f, 0xe5, 0x38, 0xf2, 0x1f, 0x5c, 0xfd, 0x40,
-    0x1f, 0x20, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x2, 0xbf, 0xe6, 0xd5, 0xd, 0xb3, 0x4c, 0xf5,
-    0x4f, 0x10, 0x2, 0xf5, 0x6d, 0x0, 0x0, 0xd5,
-    0x6d, 0x0, 0x0, 0xd5, 0x4f, 0x10, 0x1, 0xf5,
-    0xc, 0xc3, 0x3c, 0xf5, 0x1, 0xbf, 0xe7, 0xd5,
-    0x0, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x0, 0xd5,
-    0x0, 0x0, 0x0, 0xd5,
-
-    /* U+0072 "r" */
-    0x2f, 0x2c, 0xa2, 0xfd, 0x72, 0x2f, 0x60, 0x2,
-    0xf2, 0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f,
-    0x0, 0x2, 0xf0, 0x0,
-
-    /* U+0073 "s" */
-    0x6, 0xdf, 0xd4, 0x3, 0xf5, 0x28, 0xf0, 0x5e,
-    0x10, 0x6, 0x10, 0xbf, 0xb7, 0x20, 0x0, 0x27,
-    0xcf, 0x34, 0x60, 0x0, 0xc8, 0x4f, 0x62, 0x4e,
-    0x50, 0x6d, 0xfd, 0x70,
-
-    /* U+0074 "t" */
-    0xa, 0x80, 0xa, 0x80, 0xef, 0xff, 0x1a, 0x91,
-    0xa, 0x80, 0xa, 0x80, 0xa, 0x80, 0xa, 0x80,
-    0x9, 0xa2, 0x4, 0xef,
-
-    /* U+0075 "u" */
-    0x1f, 0x10, 0x4, 0xe1, 0xf1, 0x0, 0x4e, 0x1f,
-    0x10, 0x4, 0xe1, 0xf1, 0x0, 0x4e, 0x1f, 0x10,
-    0x4, 0xe1, 0xf1, 0x0, 0x7e, 0xd, 0x70, 0x3d,
-    0xe0, 0x4d, 0xfc, 0x6e,
-
-    /* U+0076 "v" */
-    0xaa, 0x0, 0x9, 0xa4, 0xf0, 0x0, 0xe4, 0xe,
-    0x40, 0x2f, 0x0, 0x99, 0x7, 0xa0, 0x4, 0xe0,
-    0xc4, 0x0, 0xe, 0x4f, 0x0, 0x0, 0x9d, 0xa0,
-    0x0, 0x4, 0xf5, 0x0,
-
-    /* U+0077 "w" */
-    0x9a, 0x0, 0x7f, 0x10, 0xf, 0x35, 0xe0, 0xa,
-    0xf5, 0x3, 0xe0, 0xf, 0x20, 0xe9, 0x80, 0x7a,
-    0x0, 0xb6, 0x1e, 0x3c, 0xb, 0x50, 0x7, 0xa5,
-    0xa0, 0xf0, 0xf1, 0x0, 0x2e, 0x86, 0xc, 0x7c,
-    0x0, 0x0, 0xde, 0x30, 0x8e, 0x70, 0x0, 0x9,
-    0xf0, 0x5, 0xf3, 0x0,
-
-    /* U+0078 "x" */
-    0x5f, 0x20, 0xe, 0x70, 0xa, 0xc0, 0x9c, 0x0,
-    0x1, 0xe9, 0xf2, 0x0, 0x0, 0x6f, 0x80, 0x0,
-    0x0, 0x9f, 0xd0, 0x0, 0x4, 0xf2, 0xe8, 0x0,
-    0xd, 0x70, 0x5f, 0x20, 0x8d, 0x0, 0xb, 0xc0,
-
-    /* U+0079 "y" */
-    0xb9, 0x0, 0x8, 0xb5, 0xe0, 0x0, 0xd5, 0xf,
-    0x40, 0x2f, 0x0, 0x99, 0x7, 0xa0, 0x3, 0xe0,
-    0xc4, 0x0, 0xd, 0x5e, 0x0, 0x0, 0x8e, 0x90,
-    0x0, 0x2, 0xf3, 0x0, 0x0, 0x4d, 0x0, 0x0,
-    0x3c, 0x70, 0x0, 0x2f, 0xb0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x6f, 0xff, 0xff, 0x30, 0x22, 0x2b, 0xb0, 0x0,
-    0x5, 0xe1, 0x0, 0x2, 0xf4, 0x0, 0x0, 0xc8,
-    0x0, 0x0, 0x9c, 0x0, 0x0, 0x4f, 0x42, 0x22,
-    0xa, 0xff, 0xff, 0xf6,
-
-    /* U+007B "{" */
-    0x0, 0x9e, 0x40, 0x1f, 0x10, 0x2, 0xf0, 0x0,
-    0x2f, 0x0, 0x3, 0xf0, 0x0, 0x8c, 0x0, 0x4f,
-    0x20, 0x0, 0xaa, 0x0, 0x3, 0xe0, 0x0, 0x2f,
-    0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x1, 0xf1,
-    0x0, 0x8, 0xe4,
-
-    /* U+007C "|" */
-    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-
-    /* U+007D "}" */
-    0x9e, 0x40, 0x6, 0xc0, 0x4, 0xd0, 0x4, 0xd0,
-    0x4, 0xd0, 0x2, 0xf2, 0x0, 0x8f, 0x0, 0xe6,
-    0x4, 0xe0, 0x4, 0xd0, 0x4, 0xd0, 0x4, 0xd0,
-    0x6, 0xb0, 0x9e, 0x40,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xec, 0x60, 0x73,
-    0x9, 0x2, 0x9e, 0xa0, 0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 62, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 58, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11, .adv_w = 95, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 19, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 63, .adv_w = 125, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 119, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 185, .adv_w = 141, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 240, .adv_w = 62, .box_w = 2, .box_h = 4, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 244, .adv_w = 58, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 272, .adv_w = 58, .box_w = 4, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 300, .adv_w = 79, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 313, .adv_w = 134, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 345, .adv_w = 62, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 350, .adv_w = 87, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 358, .adv_w = 62, .box_w = 2, .box_h = 2, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 360, .adv_w = 75, .box_w = 6, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 393, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 437, .adv_w = 125, .box_w = 4, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 459, .adv_w = 125, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 498, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 542, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 586, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 630, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 674, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 718, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 762, .adv_w = 125, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 806, .adv_w = 62, .box_w = 2, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 814, .adv_w = 62, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 825, .adv_w = 134, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 861, .adv_w = 134, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 881, .adv_w = 134, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 917, .adv_w = 125, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 956, .adv_w = 179, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1017, .adv_w = 145, .box_w = 11, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1078, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1122, .adv_w = 162, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1177, .adv_w = 158, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1227, .adv_w = 137, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1271, .adv_w = 129, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1310, .adv_w = 170, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1365, .adv_w = 162, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1415, .adv_w = 58, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1426, .adv_w = 116, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1465, .adv_w = 149, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1515, .adv_w = 125, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1554, .adv_w = 195, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1615, .adv_w = 162, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1665, .adv_w = 170, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1726, .adv_w = 145, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1770, .adv_w = 170, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1836, .adv_w = 153, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1886, .adv_w = 145, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1936, .adv_w = 129, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1986, .adv_w = 162, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2036, .adv_w = 137, .box_w = 10, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2091, .adv_w = 207, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2163, .adv_w = 137, .box_w = 10, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2218, .adv_w = 145, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2273, .adv_w = 137, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2323, .adv_w = 58, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 2344, .adv_w = 75, .box_w = 6, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2377, .adv_w = 58, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2398, .adv_w = 134, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 2426, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2430, .adv_w = 50, .box_w = 4, .box_h = 2, .ofs_x = -1, .ofs_y = 9},
-    {.bitmap_index = 2434, .adv_w = 120, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2466, .adv_w = 133, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2510, .adv_w = 120, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2542, .adv_w = 133, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2586, .adv_w = 120, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2618, .adv_w = 66, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2646, .adv_w = 129, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2690, .adv_w = 125, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2729, .adv_w = 50, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2746, .adv_w = 50, .box_w = 4, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 2774, .adv_w = 116, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2818, .adv_w = 50, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2835, .adv_w = 191, .box_w = 12, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2883, .adv_w = 125, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2911, .adv_w = 129, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2943, .adv_w = 133, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2987, .adv_w = 133, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3031, .adv_w = 75, .box_w = 5, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3051, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3079, .adv_w = 71, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3099, .adv_w = 125, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3127, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3155, .adv_w = 170, .box_w = 11, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3199, .adv_w = 116, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3231, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3270, .adv_w = 108, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3298, .adv_w = 75, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3333, .adv_w = 50, .box_w = 2, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 3348, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3376, .adv_w = 134, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 2}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    34, 55,
-    34, 87,
-    39, 13,
-    39, 15,
-    39, 34,
-    45, 55,
-    49, 13,
-    49, 15,
-    49, 34,
-    51, 55,
-    53, 13,
-    53, 14,
-    53, 15,
-    53, 27,
-    53, 28,
-    55, 13,
-    55, 14,
-    55, 15,
-    55, 27,
-    55, 28,
-    55, 34,
-    55, 66,
-    55, 70,
-    55, 74,
-    55, 80,
-    55, 83,
-    55, 86,
-    55, 90,
-    56, 13,
-    56, 15,
-    56, 27,
-    56, 28,
-    58, 13,
-    58, 14,
-    58, 15,
-    58, 27,
-    58, 28,
-    58, 81,
-    58, 82,
-    58, 87,
-    71, 71,
-    83, 13,
-    83, 14,
-    83, 15,
-    83, 82,
-    87, 13,
-    87, 15,
-    88, 13,
-    88, 15,
-    90, 13,
-    90, 15
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    -10, -4, -35, -35, -12, -21, -40, -40,
-    -17, -4, -25, -29, -25, -25, -25, -29,
-    -12, -29, -10, -10, -10, -12, -12, -4,
-    -12, -8, -8, -4, -17, -17, -4, -4,
-    -31, -25, -31, -21, -21, -17, -21, -12,
-    -4, -21, -12, -21, -4, -17, -17, -12,
-    -12, -17, -17
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 51,
-    .glyph_ids_size = 0
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
-    .kern_scale = 16,
-    .cmap_num = 1,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t font_en_14 = {
-#else
-lv_font_t font_en_14 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 15,          /*The maximum line height required by the font*/
-    .base_line = 3,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -1,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if FONT_EN_14*/
-
@@ -1,1630 +0,0 @@
-/*******************************************************************************
- * Size: 24 px
- * Bpp: 4
- * Opts: 
- ******************************************************************************/
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef FONT_EN_24
-#define FONT_EN_24 1
-#endif
-
-#if FONT_EN_24
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4,
-    0xf, 0xf4, 0xf, 0xf3, 0xf, 0xf2, 0xd, 0xf1,
-    0xc, 0xf0, 0xb, 0xe0, 0xa, 0xd0, 0x8, 0xc0,
-    0x7, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xb5,
-    0x3f, 0xf7, 0x3f, 0xf7,
-
-    /* U+0022 "\"" */
-    0x6f, 0x40, 0xf9, 0x6f, 0x40, 0xf9, 0x6f, 0x40,
-    0xf9, 0x6f, 0x40, 0xf9, 0x6f, 0x40, 0xf9, 0x6f,
-    0x40, 0xf9, 0x25, 0x10, 0x53,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x4f, 0x60, 0x9, 0xf0, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x7f,
-    0x20, 0xd, 0xc0, 0x0, 0x0, 0x9, 0xf0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x1f, 0x90,
-    0x0, 0x0, 0xd, 0xd0, 0x3, 0xf7, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x6a, 0xbf,
-    0xda, 0xad, 0xfb, 0xa5, 0x0, 0x3, 0xf6, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x5f, 0x40, 0xb, 0xe0,
-    0x0, 0x0, 0x7, 0xf2, 0x0, 0xdc, 0x0, 0x2,
-    0xaa, 0xdf, 0xba, 0xaf, 0xea, 0x90, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xeb, 0x0,
-    0x4f, 0x50, 0x0, 0x0, 0x1f, 0x90, 0x6, 0xf3,
-    0x0, 0x0, 0x3, 0xf7, 0x0, 0x9f, 0x10, 0x0,
-    0x0, 0x5f, 0x50, 0xb, 0xf0, 0x0, 0x0, 0x7,
-    0xf2, 0x0, 0xdc, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x72, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0x5, 0xcf,
-    0xff, 0xb3, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x4, 0xff, 0x70, 0xf6, 0x7f, 0xf2,
-    0x0, 0xaf, 0x90, 0xf, 0x50, 0x8f, 0x90, 0xd,
-    0xf5, 0x0, 0xf5, 0x1, 0xdc, 0x0, 0xdf, 0x50,
-    0xf, 0x50, 0x0, 0x0, 0xb, 0xfc, 0x0, 0xf5,
-    0x0, 0x0, 0x0, 0x5f, 0xfe, 0x7f, 0x50, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xfe, 0x93, 0x0, 0x0,
-    0x0, 0x17, 0xcf, 0xff, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0xf9, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0xf,
-    0x50, 0x5f, 0xf4, 0x25, 0x30, 0x0, 0xf5, 0x0,
-    0xbf, 0x84, 0xfc, 0x0, 0xf, 0x50, 0x9, 0xf8,
-    0xf, 0xf2, 0x0, 0xf5, 0x0, 0xbf, 0x60, 0xaf,
-    0xd2, 0xf, 0x50, 0x5f, 0xf1, 0x1, 0xdf, 0xfa,
-    0xfc, 0xcf, 0xf6, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x26, 0xf9, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x72, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x1, 0xaf, 0xfc, 0x30, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0xd, 0xf8, 0x7e, 0xf2, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x5f, 0x70, 0x5, 0xf9,
-    0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0xfc, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x0,
-    0xbf, 0x10, 0x0, 0xee, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0xee, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0xfc,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0x50,
-    0x3, 0xf8, 0x1, 0xef, 0x20, 0x0, 0x0, 0x0,
-    0x1f, 0xe3, 0x3d, 0xf1, 0xa, 0xf6, 0x4, 0xdf,
-    0xfc, 0x30, 0x4, 0xef, 0xff, 0x50, 0x6f, 0xa0,
-    0x1f, 0xe6, 0x6f, 0xe1, 0x0, 0x3, 0x30, 0x2,
-    0xfe, 0x10, 0x8f, 0x40, 0x6, 0xf7, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0xcf, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0xee, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0,
-    0xee, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x1e, 0xf2,
-    0x0, 0x0, 0xcf, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x8f, 0x40, 0x7, 0xf4,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x1f, 0xe7,
-    0x8f, 0xd0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xcf, 0xfa, 0x10,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x5c, 0xfe, 0xa2, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xef, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0xdf, 0x80, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x8d, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xbf, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfc, 0xef, 0x80, 0x2, 0x41, 0x0,
-    0x4, 0xff, 0x70, 0x4f, 0xf5, 0xc, 0xf3, 0x0,
-    0xd, 0xf7, 0x0, 0x6, 0xff, 0x3f, 0xf0, 0x0,
-    0x2f, 0xf1, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0xa, 0xff, 0x40, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x7, 0xff, 0xa0, 0x0,
-    0xa, 0xfe, 0x50, 0x1, 0x8f, 0xee, 0xf7, 0x0,
-    0x1, 0xdf, 0xff, 0xef, 0xfe, 0x34, 0xff, 0x40,
-    0x0, 0x8, 0xdf, 0xfd, 0x81, 0x0, 0x8f, 0xe2,
-
-    /* U+0027 "'" */
-    0x7f, 0x27, 0xf2, 0x7f, 0x27, 0xf2, 0x7f, 0x27,
-    0xf2, 0x25, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x6, 0xf3, 0x0, 0x1e, 0xa0, 0x0, 0xaf,
-    0x20, 0x1, 0xfc, 0x0, 0x7, 0xf6, 0x0, 0xe,
-    0xf1, 0x0, 0x2f, 0xd0, 0x0, 0x6f, 0xa0, 0x0,
-    0x9f, 0x70, 0x0, 0xbf, 0x60, 0x0, 0xcf, 0x50,
-    0x0, 0xdf, 0x40, 0x0, 0xcf, 0x50, 0x0, 0xbf,
-    0x60, 0x0, 0x9f, 0x70, 0x0, 0x5f, 0xa0, 0x0,
-    0x1f, 0xe0, 0x0, 0xd, 0xf1, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0xec, 0x0, 0x0, 0x8f, 0x20, 0x0,
-    0xe, 0xa0, 0x0, 0x6, 0xf3,
-
-    /* U+0029 ")" */
-    0xe, 0x90, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x0, 0xef, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x7f, 0x90, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x3f, 0xe0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x2, 0xff, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x7f, 0x90,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0xdf, 0x10, 0x0,
-    0x3f, 0xb0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x7f, 0x30, 0x0, 0xe, 0x90, 0x0,
-    0x0,
-
-    /* U+002A "*" */
-    0x0, 0x7, 0xd0, 0x0, 0x1, 0x7, 0xd0, 0x1,
-    0x3f, 0xaa, 0xd7, 0xda, 0x4, 0xaf, 0xfd, 0x71,
-    0x0, 0x4f, 0xda, 0x0, 0x1, 0xe8, 0x2f, 0x60,
-    0x1, 0xa0, 0x6, 0x60,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xaa, 0xaa,
-    0xdf, 0xaa, 0xaa, 0xa2, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0xb, 0xb7, 0xf, 0xfa, 0xf, 0xfa, 0x0, 0xa9,
-    0x1, 0xe5, 0xd, 0xb0, 0x5, 0x0,
-
-    /* U+002D "-" */
-    0xcf, 0xff, 0xff, 0xf2, 0xcf, 0xff, 0xff, 0xf2,
-
-    /* U+002E "." */
-    0xb, 0xb7, 0xf, 0xfa, 0xf, 0xfa,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x2a, 0xef, 0xeb, 0x50, 0x0, 0x3, 0xff,
-    0xfd, 0xef, 0xf7, 0x0, 0xc, 0xfb, 0x10, 0x7,
-    0xff, 0x20, 0x5f, 0xf1, 0x0, 0x0, 0xbf, 0xa0,
-    0x9f, 0x90, 0x0, 0x0, 0x4f, 0xf0, 0xcf, 0x50,
-    0x0, 0x0, 0xf, 0xf1, 0xef, 0x40, 0x0, 0x0,
-    0xe, 0xf3, 0xff, 0x30, 0x0, 0x0, 0xd, 0xf4,
-    0xff, 0x20, 0x0, 0x0, 0xd, 0xf5, 0xff, 0x20,
-    0x0, 0x0, 0xd, 0xf5, 0xff, 0x30, 0x0, 0x0,
-    0xd, 0xf5, 0xef, 0x40, 0x0, 0x0, 0xe, 0xf4,
-    0xcf, 0x50, 0x0, 0x0, 0xf, 0xf2, 0x9f, 0x90,
-    0x0, 0x0, 0x4f, 0xe0, 0x5f, 0xf1, 0x0, 0x0,
-    0xbf, 0xa0, 0xd, 0xfb, 0x10, 0x7, 0xff, 0x30,
-    0x3, 0xff, 0xfd, 0xff, 0xf7, 0x0, 0x0, 0x19,
-    0xdf, 0xeb, 0x40, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x7, 0xf8, 0x0,
-    0x2, 0xff, 0x80, 0x27, 0xff, 0xf8, 0xef, 0xff,
-    0xff, 0x89, 0xaa, 0xad, 0xf8, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x8, 0xf8,
-
-    /* U+0032 "2" */
-    0x0, 0x2, 0xae, 0xfe, 0xa3, 0x0, 0x0, 0x5f,
-    0xff, 0xdf, 0xff, 0x60, 0x2, 0xff, 0x80, 0x0,
-    0x9f, 0xf3, 0x8, 0xfc, 0x0, 0x0, 0xb, 0xf9,
-    0xd, 0xf5, 0x0, 0x0, 0x6, 0xfc, 0xe, 0xf2,
-    0x0, 0x0, 0x5, 0xfd, 0x5, 0x50, 0x0, 0x0,
-    0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf6,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xd0, 0x0, 0x0,
-    0x0, 0x3d, 0xfe, 0x20, 0x0, 0x0, 0x7, 0xff,
-    0xd2, 0x0, 0x0, 0x2, 0xcf, 0xf8, 0x0, 0x0,
-    0x0, 0x2e, 0xfc, 0x20, 0x0, 0x0, 0x1, 0xef,
-    0x90, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfd, 0xdd, 0xdd, 0xdd, 0xd9, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0033 "3" */
-    0x0, 0x3, 0xbe, 0xfe, 0xa2, 0x0, 0x0, 0x5,
-    0xff, 0xfd, 0xff, 0xf4, 0x0, 0x1, 0xff, 0x70,
-    0x1, 0xaf, 0xe0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
-    0xef, 0x50, 0xc, 0xf5, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0xdf, 0x20, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0xf8, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x8b, 0xdf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x28, 0x70,
-    0x0, 0x0, 0x0, 0xff, 0x33, 0xff, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0xf, 0xf5, 0x0, 0x0, 0x5,
-    0xff, 0x0, 0x9f, 0xe4, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0xbf, 0xff, 0xef, 0xff, 0xa0, 0x0, 0x0,
-    0x6c, 0xef, 0xeb, 0x40, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x10, 0x0, 0x0, 0x0, 0xd, 0xde,
-    0xf1, 0x0, 0x0, 0x0, 0x8, 0xf3, 0xdf, 0x10,
-    0x0, 0x0, 0x3, 0xf9, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x7f,
-    0x40, 0xd, 0xf1, 0x0, 0x0, 0x2f, 0xa0, 0x0,
-    0xdf, 0x10, 0x0, 0xc, 0xe1, 0x0, 0xd, 0xf1,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0xdf, 0x10, 0x2,
-    0xfb, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x54, 0xdd, 0xdd, 0xdd,
-    0xdf, 0xfd, 0xd4, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x6,
-    0xfe, 0xdd, 0xdd, 0xdd, 0x30, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x5b, 0xdc, 0x92, 0x0, 0x0, 0x5f, 0xef,
-    0xff, 0xff, 0xf6, 0x0, 0x8, 0xff, 0x71, 0x3,
-    0xbf, 0xf4, 0x0, 0x69, 0x30, 0x0, 0x0, 0xbf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x21, 0xff, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0xe, 0xf6, 0x0, 0x0, 0x9,
-    0xfc, 0x0, 0x7f, 0xf6, 0x0, 0x8, 0xff, 0x30,
-    0x0, 0xaf, 0xff, 0xdf, 0xff, 0x60, 0x0, 0x0,
-    0x5b, 0xff, 0xea, 0x30, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x5c, 0xef, 0xd8, 0x0, 0x0, 0x0,
-    0xaf, 0xfe, 0xef, 0xfc, 0x0, 0x0, 0x7f, 0xd3,
-    0x0, 0x3e, 0xf7, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x5f, 0xc0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x66,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf1, 0x28, 0xcd, 0xa5, 0x0, 0x0, 0xff, 0x4f,
-    0xff, 0xff, 0xfb, 0x0, 0xf, 0xfe, 0xd4, 0x1,
-    0x6f, 0xf8, 0x1, 0xff, 0xf2, 0x0, 0x0, 0x6f,
-    0xf0, 0xf, 0xf9, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0xff, 0x60, 0x0, 0x0, 0xc, 0xf6, 0xd, 0xf6,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0xaf, 0x90, 0x0,
-    0x0, 0xe, 0xf4, 0x5, 0xfe, 0x10, 0x0, 0x5,
-    0xff, 0x0, 0xd, 0xfc, 0x20, 0x4, 0xef, 0x80,
-    0x0, 0x2e, 0xff, 0xee, 0xff, 0xb0, 0x0, 0x0,
-    0x19, 0xdf, 0xec, 0x60, 0x0,
-
-    /* U+0037 "7" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xec, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x1, 0xee,
-    0x10, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xb0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x1, 0x9e, 0xfe, 0xb4, 0x0, 0x0, 0x3,
-    0xef, 0xfe, 0xff, 0xf7, 0x0, 0x0, 0xdf, 0xb1,
-    0x0, 0x7f, 0xf2, 0x0, 0x4f, 0xf1, 0x0, 0x0,
-    0xbf, 0x80, 0x6, 0xfc, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x8f, 0xa0, 0x1,
-    0xff, 0x20, 0x0, 0xd, 0xf5, 0x0, 0x8, 0xfd,
-    0x40, 0x2a, 0xfc, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfc, 0x10, 0x0, 0x6, 0xff, 0xfe, 0xff, 0xfb,
-    0x10, 0x5, 0xff, 0x80, 0x0, 0x5e, 0xfb, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x3f, 0xf2, 0xf, 0xf2,
-    0x0, 0x0, 0x0, 0xdf, 0x50, 0xff, 0x30, 0x0,
-    0x0, 0xe, 0xf5, 0xd, 0xf8, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x6f, 0xf7, 0x0, 0x4, 0xef, 0xb0,
-    0x0, 0x9f, 0xff, 0xef, 0xff, 0xc1, 0x0, 0x0,
-    0x4a, 0xef, 0xfc, 0x60, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x3, 0xae, 0xfe, 0x92, 0x0, 0x0, 0x7,
-    0xff, 0xed, 0xff, 0xf4, 0x0, 0x4, 0xff, 0x60,
-    0x1, 0xaf, 0xe0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0xdf, 0x70, 0xf, 0xf3, 0x0, 0x0, 0x6, 0xfc,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x2f,
-    0xf0, 0x0, 0x0, 0x4, 0xff, 0x20, 0xff, 0x30,
-    0x0, 0x0, 0x7f, 0xf3, 0xb, 0xfb, 0x0, 0x0,
-    0x1e, 0xff, 0x30, 0x4f, 0xfa, 0x20, 0x3c, 0xfe,
-    0xf3, 0x0, 0x7f, 0xff, 0xff, 0xf4, 0xef, 0x20,
-    0x0, 0x39, 0xcc, 0x92, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfd, 0x0, 0x57, 0x20, 0x0,
-    0x0, 0x7f, 0x90, 0xa, 0xf8, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x4f, 0xf6, 0x0, 0x1b, 0xfc, 0x0,
-    0x0, 0x9f, 0xff, 0xef, 0xfe, 0x20, 0x0, 0x0,
-    0x5b, 0xff, 0xd8, 0x10, 0x0,
-
-    /* U+003A ":" */
-    0xf, 0xfa, 0xf, 0xfa, 0xb, 0xb7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xb7, 0xf, 0xfa,
-    0xf, 0xfa,
-
-    /* U+003B ";" */
-    0xf, 0xfa, 0xf, 0xfa, 0xb, 0xb7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xb7, 0xf, 0xfa,
-    0xf, 0xfa, 0x0, 0xa9, 0x1, 0xe5, 0xd, 0xb0,
-    0x6, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xf4, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xd6, 0x0, 0x0, 0x0, 0x7e, 0xfc,
-    0x50, 0x0, 0x0, 0x18, 0xff, 0xb4, 0x0, 0x0,
-    0x2, 0x9f, 0xfa, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xa2, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xaf, 0xfa, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xb3, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8e, 0xfc, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa2, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-
-    /* U+003E ">" */
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe8,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x7e, 0xfc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xe2, 0x0, 0x0, 0x0, 0x7e,
-    0xfd, 0x60, 0x0, 0x0, 0x18, 0xef, 0xc4, 0x0,
-    0x0, 0x2, 0x9f, 0xfb, 0x30, 0x0, 0x0, 0x9,
-    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x18, 0xdf, 0xeb, 0x40, 0x0, 0x2e, 0xff,
-    0xef, 0xff, 0x70, 0xd, 0xfa, 0x10, 0x7, 0xff,
-    0x34, 0xfe, 0x0, 0x0, 0xb, 0xf9, 0x9f, 0x80,
-    0x0, 0x0, 0x7f, 0xb9, 0xe6, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0,
-    0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x5f,
-    0xf4, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
-    0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x5, 0xb7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xba, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xd9, 0x40, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xc8, 0x66, 0x8d, 0xfb,
-    0x10, 0x0, 0x0, 0x4f, 0xd4, 0x0, 0x0, 0x0,
-    0x5e, 0xe2, 0x0, 0x2, 0xfd, 0x10, 0x5, 0x99,
-    0x40, 0x25, 0xed, 0x0, 0xc, 0xf2, 0x2, 0xdf,
-    0xff, 0xf5, 0xea, 0x5f, 0x70, 0x4f, 0x70, 0xd,
-    0xf8, 0x11, 0xcf, 0xf5, 0xe, 0xd0, 0xaf, 0x10,
-    0x9f, 0x80, 0x0, 0x2f, 0xf1, 0xa, 0xf0, 0xdc,
-    0x1, 0xfe, 0x0, 0x0, 0xf, 0xc0, 0x9, 0xf0,
-    0xfb, 0x5, 0xf8, 0x0, 0x0, 0x1f, 0x70, 0xa,
-    0xf0, 0xea, 0x8, 0xf4, 0x0, 0x0, 0x6f, 0x30,
-    0xe, 0xb0, 0xdc, 0x8, 0xf4, 0x0, 0x0, 0xee,
-    0x0, 0x5f, 0x50, 0x9f, 0x6, 0xf8, 0x0, 0x9,
-    0xfa, 0x0, 0xdb, 0x0, 0x4f, 0x70, 0xef, 0x96,
-    0xbe, 0xfb, 0x2c, 0xd1, 0x0, 0xc, 0xe2, 0x4e,
-    0xff, 0xc1, 0xcf, 0xf9, 0x15, 0x20, 0x2, 0xfd,
-    0x10, 0x32, 0x0, 0x3, 0x10, 0xcd, 0x0, 0x0,
-    0x4f, 0xe4, 0x0, 0x0, 0x0, 0x4d, 0xd2, 0x0,
-    0x0, 0x2, 0xcf, 0xd8, 0x66, 0x8d, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x4, 0xad, 0xff, 0xd9, 0x30,
-    0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x2a, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x4f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10,
-    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0xef, 0x90, 0x0, 0x0, 0x6, 0xff,
-    0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0x10, 0x0,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x30, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf9,
-
-    /* U+0042 "B" */
-    0x2f, 0xff, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x3, 0xaf, 0xf3, 0x2, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xef, 0x80, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0xa, 0xf9, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x1e, 0xf4, 0x2, 0xff, 0x20, 0x0,
-    0x0, 0x3c, 0xfa, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x1,
-    0x6e, 0xfa, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x4f, 0xf1, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x42, 0xff, 0x20, 0x0, 0x0, 0x0, 0xf,
-    0xf4, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x12, 0xff, 0x20, 0x0, 0x0, 0x15, 0xef, 0xa0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x80, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xa4, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0xbf, 0xf8, 0x20, 0x2, 0x8f, 0xfd, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0,
-    0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x91,
-    0xaf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe4,
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0,
-    0x9, 0xff, 0x30, 0x0, 0x0, 0x4, 0xff, 0x50,
-    0x0, 0xdf, 0xf8, 0x20, 0x2, 0x8f, 0xfb, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfd, 0xa3, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x2f, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x16, 0xef, 0xf2, 0x2, 0xff,
-    0x20, 0x0, 0x0, 0x1, 0xdf, 0xd0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x42, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd2, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xd2, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x9, 0xfb, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x72, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f,
-    0xf2, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x2e, 0xfa,
-    0x2, 0xff, 0x20, 0x0, 0x2, 0x8f, 0xfe, 0x10,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x2,
-    0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0046 "F" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x39, 0xde, 0xfe, 0xb7, 0x10, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x0, 0xaf, 0xf9, 0x30, 0x2, 0x6d, 0xff, 0x50,
-    0x6, 0xff, 0x50, 0x0, 0x0, 0x0, 0xaf, 0xe0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5, 0x63,
-    0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x50, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfb,
-    0xff, 0x50, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfb,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb,
-    0x6, 0xff, 0x50, 0x0, 0x0, 0x1, 0xdf, 0xfb,
-    0x0, 0xaf, 0xfa, 0x30, 0x1, 0x6e, 0xfc, 0xfb,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfb,
-    0x0, 0x0, 0x28, 0xdf, 0xfd, 0x93, 0x0, 0xdb,
-
-    /* U+0048 "H" */
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x72,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x2f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x72, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x72, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xd, 0xf7, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x72, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x72, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xd, 0xf7, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x72, 0xff, 0x20, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x72, 0xff, 0x20, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x72,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xd, 0xf7,
-
-    /* U+0049 "I" */
-    0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4,
-    0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4,
-    0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4,
-    0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf4,
-    0xf, 0xf4, 0xf, 0xf4,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x91, 0x32, 0x0, 0x0,
-    0xb, 0xf9, 0x7f, 0xd0, 0x0, 0x0, 0xbf, 0x96,
-    0xfe, 0x0, 0x0, 0xc, 0xf8, 0x4f, 0xf2, 0x0,
-    0x0, 0xff, 0x60, 0xef, 0xc2, 0x1, 0xaf, 0xf1,
-    0x5, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x3, 0xae,
-    0xfe, 0xb4, 0x0,
-
-    /* U+004B "K" */
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xff, 0x50,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x9, 0xff, 0x50, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x8, 0xff, 0x50, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0,
-    0x2f, 0xf2, 0x7, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x2f, 0xf2, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf8, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf6, 0x9f, 0xf2, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x60, 0xd, 0xfc, 0x0, 0x0, 0x0,
-    0x2f, 0xf6, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x3, 0xff, 0xa0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x10,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x2, 0xff, 0xb0,
-
-    /* U+004C "L" */
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3,
-
-    /* U+004D "M" */
-    0x1f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x1f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x1f, 0xfc, 0xf4, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0xff, 0x1f, 0xf6, 0xfa, 0x0,
-    0x0, 0x0, 0xc, 0xf6, 0xff, 0x1f, 0xf1, 0xff,
-    0x0, 0x0, 0x0, 0x1f, 0xe2, 0xff, 0x1f, 0xf1,
-    0xaf, 0x50, 0x0, 0x0, 0x7f, 0x82, 0xff, 0x1f,
-    0xf1, 0x4f, 0xb0, 0x0, 0x0, 0xdf, 0x22, 0xff,
-    0x1f, 0xf1, 0xe, 0xf1, 0x0, 0x3, 0xfd, 0x2,
-    0xff, 0x1f, 0xf1, 0x8, 0xf6, 0x0, 0x8, 0xf7,
-    0x2, 0xff, 0x1f, 0xf1, 0x3, 0xfc, 0x0, 0xe,
-    0xf1, 0x2, 0xff, 0x1f, 0xf1, 0x0, 0xdf, 0x20,
-    0x4f, 0xb0, 0x2, 0xff, 0x1f, 0xf1, 0x0, 0x7f,
-    0x80, 0x9f, 0x60, 0x2, 0xff, 0x1f, 0xf1, 0x0,
-    0x2f, 0xd0, 0xff, 0x0, 0x2, 0xff, 0x1f, 0xf1,
-    0x0, 0xc, 0xf8, 0xfa, 0x0, 0x2, 0xff, 0x1f,
-    0xf1, 0x0, 0x6, 0xff, 0xf5, 0x0, 0x2, 0xff,
-    0x1f, 0xf1, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x2,
-    0xff, 0x1f, 0xf1, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x2, 0xff,
-
-    /* U+004E "N" */
-    0x2f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x82,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x2f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xaf, 0x82, 0xff,
-    0xef, 0x60, 0x0, 0x0, 0xa, 0xf8, 0x2f, 0xf5,
-    0xff, 0x10, 0x0, 0x0, 0xaf, 0x82, 0xff, 0xb,
-    0xfa, 0x0, 0x0, 0xa, 0xf8, 0x2f, 0xf0, 0x2f,
-    0xf4, 0x0, 0x0, 0xaf, 0x82, 0xff, 0x0, 0x7f,
-    0xd0, 0x0, 0xa, 0xf8, 0x2f, 0xf0, 0x0, 0xdf,
-    0x80, 0x0, 0xaf, 0x82, 0xff, 0x0, 0x4, 0xff,
-    0x20, 0xa, 0xf8, 0x2f, 0xf0, 0x0, 0xa, 0xfc,
-    0x0, 0xaf, 0x82, 0xff, 0x0, 0x0, 0x1e, 0xf6,
-    0xa, 0xf8, 0x2f, 0xf0, 0x0, 0x0, 0x6f, 0xe1,
-    0xaf, 0x82, 0xff, 0x0, 0x0, 0x0, 0xcf, 0x9a,
-    0xf8, 0x2f, 0xf0, 0x0, 0x0, 0x2, 0xff, 0xdf,
-    0x82, 0xff, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf8,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x82,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xea, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0xc, 0xff, 0x93, 0x0, 0x27,
-    0xff, 0xe2, 0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0,
-    0x0, 0x2e, 0xfc, 0x0, 0x2, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x50, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf4, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf2, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf0, 0x7, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x2, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x9f,
-    0xf4, 0x0, 0x0, 0x0, 0x2e, 0xfc, 0x0, 0x0,
-    0xc, 0xff, 0x93, 0x0, 0x27, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xea, 0x50,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x2f, 0xff, 0xff, 0xff, 0xfe, 0xa3, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x2f, 0xf2,
-    0x0, 0x0, 0x15, 0xdf, 0xe0, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x2f, 0xf6, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0xa, 0xf9, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xf5,
-    0x2f, 0xf2, 0x0, 0x0, 0x15, 0xef, 0xe0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x2f, 0xff,
-    0xff, 0xff, 0xfd, 0xa2, 0x0, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xea, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0xc, 0xff, 0x93, 0x0, 0x27,
-    0xff, 0xe2, 0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0,
-    0x0, 0x2e, 0xfc, 0x0, 0x2, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x60, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf4, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf0, 0x7, 0xfd, 0x0, 0x0,
-    0x0, 0x10, 0x0, 0xaf, 0xc0, 0x2, 0xff, 0x60,
-    0x0, 0x1, 0xdc, 0x12, 0xff, 0x50, 0x0, 0x9f,
-    0xf4, 0x0, 0x1, 0xbf, 0xed, 0xfc, 0x0, 0x0,
-    0xc, 0xff, 0x93, 0x0, 0x2d, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xea, 0x43,
-    0xef, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x1, 0x7f, 0xf8, 0x2, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x9f, 0xe0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x12, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x2f, 0xf1, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x2, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0xa0, 0x2f, 0xf2, 0x0, 0x0,
-    0x13, 0xaf, 0xf2, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc3, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x60, 0x2, 0xff, 0x20, 0x0, 0x0, 0x8,
-    0xff, 0x30, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8f,
-    0xb0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xff, 0x12,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x1f, 0xf7,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x6b, 0xef, 0xfc, 0x81, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0xdf, 0xd5, 0x10, 0x15, 0xdf, 0xf2, 0x0, 0x5f,
-    0xf1, 0x0, 0x0, 0x1, 0xef, 0x90, 0x8, 0xfb,
-    0x0, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x8f, 0xd0,
-    0x0, 0x0, 0x0, 0x27, 0x60, 0x4, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfa,
-    0x63, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
-    0xfe, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x37, 0xae,
-    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8f, 0xfe, 0x10, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf6, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x90, 0xef, 0x50, 0x0, 0x0, 0x0, 0xa,
-    0xf9, 0x9, 0xfd, 0x10, 0x0, 0x0, 0x1, 0xff,
-    0x50, 0x1e, 0xfe, 0x72, 0x0, 0x27, 0xef, 0xc0,
-    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x5, 0xbe, 0xff, 0xda, 0x40, 0x0,
-
-    /* U+0054 "T" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x83,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x83, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x83, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xb, 0xf8, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x83, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xf8, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x83, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0xf8, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x83, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0xef, 0x70, 0x0, 0x0, 0x0, 0x1f,
-    0xf4, 0x9, 0xfe, 0x20, 0x0, 0x0, 0xa, 0xfe,
-    0x0, 0x2f, 0xfe, 0x61, 0x0, 0x3b, 0xff, 0x60,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x17, 0xbe, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+0056 "V" */
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x8f, 0xd0, 0x0, 0x0, 0x1, 0xff, 0x30,
-    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x6, 0xfd, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x2, 0xff, 0x10, 0x0, 0x5f, 0xd0, 0x0,
-    0x0, 0x0, 0xdf, 0x60, 0x0, 0xaf, 0x70, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x2f, 0xf1, 0x4, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf5, 0xa, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x4f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xdf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x9f, 0xb0, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0,
-    0x0, 0x7, 0xfc, 0x5f, 0xe0, 0x0, 0x0, 0x8,
-    0xff, 0xb0, 0x0, 0x0, 0xb, 0xf8, 0x1f, 0xf2,
-    0x0, 0x0, 0xc, 0xff, 0xf0, 0x0, 0x0, 0xe,
-    0xf4, 0xd, 0xf6, 0x0, 0x0, 0xf, 0xdc, 0xf3,
-    0x0, 0x0, 0x2f, 0xf0, 0x9, 0xf9, 0x0, 0x0,
-    0x4f, 0x98, 0xf7, 0x0, 0x0, 0x6f, 0xc0, 0x5,
-    0xfd, 0x0, 0x0, 0x8f, 0x54, 0xfb, 0x0, 0x0,
-    0xaf, 0x80, 0x2, 0xff, 0x10, 0x0, 0xcf, 0x10,
-    0xff, 0x0, 0x0, 0xdf, 0x40, 0x0, 0xef, 0x40,
-    0x1, 0xfc, 0x0, 0xbf, 0x30, 0x1, 0xff, 0x0,
-    0x0, 0xaf, 0x80, 0x5, 0xf8, 0x0, 0x7f, 0x70,
-    0x5, 0xfc, 0x0, 0x0, 0x6f, 0xb0, 0x9, 0xf4,
-    0x0, 0x3f, 0xb0, 0x8, 0xf8, 0x0, 0x0, 0x2f,
-    0xf0, 0xd, 0xf0, 0x0, 0xf, 0xf0, 0xc, 0xf4,
-    0x0, 0x0, 0xe, 0xf3, 0x1f, 0xc0, 0x0, 0xb,
-    0xf3, 0xf, 0xf0, 0x0, 0x0, 0xa, 0xf6, 0x5f,
-    0x70, 0x0, 0x7, 0xf8, 0x4f, 0xc0, 0x0, 0x0,
-    0x6, 0xfa, 0x9f, 0x30, 0x0, 0x3, 0xfc, 0x7f,
-    0x80, 0x0, 0x0, 0x2, 0xfd, 0xdf, 0x0, 0x0,
-    0x0, 0xef, 0xcf, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xfb, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x6f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf3, 0x0,
-    0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8f, 0xe1,
-    0x0, 0xbf, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x50,
-    0x0, 0x1f, 0xf8, 0x0, 0x0, 0xc, 0xfb, 0x0,
-    0x0, 0x6, 0xff, 0x20, 0x0, 0x7f, 0xf1, 0x0,
-    0x0, 0x0, 0xcf, 0xc0, 0x1, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x2f, 0xf6, 0xb, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x6f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xef, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0x2f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf1, 0x8, 0xff, 0x20, 0x0,
-    0x0, 0x2, 0xff, 0x60, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0xc, 0xfc, 0x0, 0x0, 0x4f, 0xf6, 0x0,
-    0x0, 0x6f, 0xf2, 0x0, 0x0, 0xa, 0xff, 0x10,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x1, 0xef, 0xb0,
-    0xb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-
-    /* U+0059 "Y" */
-    0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf3,
-    0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xef, 0x90,
-    0x6, 0xff, 0x40, 0x0, 0x0, 0x8, 0xfe, 0x0,
-    0x0, 0xcf, 0xd0, 0x0, 0x0, 0x2f, 0xf5, 0x0,
-    0x0, 0x2f, 0xf7, 0x0, 0x0, 0xbf, 0xb0, 0x0,
-    0x0, 0x8, 0xff, 0x10, 0x5, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xdf, 0xa0, 0xd, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0x7f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfd, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+005B "[" */
-    0x4f, 0xff, 0xf3, 0x4f, 0xea, 0xa2, 0x4f, 0xa0,
-    0x0, 0x4f, 0xa0, 0x0, 0x4f, 0xa0, 0x0, 0x4f,
-    0xa0, 0x0, 0x4f, 0xa0, 0x0, 0x4f, 0xa0, 0x0,
-    0x4f, 0xa0, 0x0, 0x4f, 0xa0, 0x0, 0x4f, 0xa0,
-    0x0, 0x4f, 0xa0, 0x0, 0x4f, 0xa0, 0x0, 0x4f,
-    0xa0, 0x0, 0x4f, 0xa0, 0x0, 0x4f, 0xa0, 0x0,
-    0x4f, 0xa0, 0x0, 0x4f, 0xa0, 0x0, 0x4f, 0xa0,
-    0x0, 0x4f, 0xa0, 0x0, 0x4f, 0xa0, 0x0, 0x4f,
-    0xea, 0xa2, 0x4f, 0xff, 0xf3,
-
-    /* U+005C "\\" */
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0xd,
-    0xd0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x10, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0,
-    0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0,
-    0x8, 0xf3,
-
-    /* U+005D "]" */
-    0xff, 0xff, 0x7a, 0xad, 0xf7, 0x0, 0x7f, 0x70,
-    0x7, 0xf7, 0x0, 0x7f, 0x70, 0x7, 0xf7, 0x0,
-    0x7f, 0x70, 0x7, 0xf7, 0x0, 0x7f, 0x70, 0x7,
-    0xf7, 0x0, 0x7f, 0x70, 0x7, 0xf7, 0x0, 0x7f,
-    0x70, 0x7, 0xf7, 0x0, 0x7f, 0x70, 0x7, 0xf7,
-    0x0, 0x7f, 0x70, 0x7, 0xf7, 0x0, 0x7f, 0x70,
-    0x7, 0xf7, 0x0, 0x7f, 0x7a, 0xad, 0xf7, 0xff,
-    0xff, 0x70,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x5, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xce, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x93, 0xf7,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0xb, 0xe0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0xbe, 0x0, 0x0, 0x1f, 0x90,
-    0x0, 0x3, 0xf7, 0x0, 0x8, 0xf2, 0x0, 0x0,
-    0xb, 0xe0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x3f,
-    0x70, 0x8f, 0x20, 0x0, 0x0, 0x0, 0xbe, 0x0,
-
-    /* U+005F "_" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33,
-
-    /* U+0060 "`" */
-    0x28, 0x81, 0x0, 0xa, 0xfa, 0x0, 0x0, 0xbf,
-    0x30, 0x0, 0xc, 0xd0,
-
-    /* U+0061 "a" */
-    0x0, 0x5, 0xbe, 0xff, 0xc7, 0x0, 0x0, 0x9,
-    0xff, 0xfd, 0xff, 0xfa, 0x0, 0x4, 0xff, 0x50,
-    0x0, 0x6f, 0xf1, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0xdf, 0x30, 0x1, 0x21, 0x0, 0x0, 0x1e, 0xf4,
-    0x0, 0x0, 0x2, 0x58, 0xae, 0xff, 0x40, 0x0,
-    0x6e, 0xff, 0xfd, 0x9d, 0xf4, 0x0, 0x9f, 0xe6,
-    0x20, 0x0, 0xcf, 0x40, 0xf, 0xf4, 0x0, 0x0,
-    0xd, 0xf4, 0x1, 0xff, 0x10, 0x0, 0x2, 0xff,
-    0x40, 0xf, 0xf8, 0x0, 0x4, 0xef, 0xf4, 0x0,
-    0x9f, 0xff, 0xef, 0xfc, 0xaf, 0xe7, 0x0, 0x6c,
-    0xff, 0xc7, 0x3, 0xef, 0x60,
-
-    /* U+0062 "b" */
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x19, 0xef, 0xeb, 0x40, 0x0, 0x6f,
-    0xbe, 0xff, 0xdf, 0xff, 0x70, 0x6, 0xff, 0xf5,
-    0x0, 0x8, 0xff, 0x40, 0x6f, 0xf6, 0x0, 0x0,
-    0xa, 0xfc, 0x6, 0xfe, 0x0, 0x0, 0x0, 0x2f,
-    0xf1, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0xef, 0x46,
-    0xf9, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x6f, 0xb0,
-    0x0, 0x0, 0x0, 0xef, 0x46, 0xfe, 0x0, 0x0,
-    0x0, 0x2f, 0xf2, 0x6f, 0xf6, 0x0, 0x0, 0x9,
-    0xfd, 0x6, 0xff, 0xf5, 0x0, 0x6, 0xff, 0x50,
-    0x6f, 0xbd, 0xff, 0xdf, 0xff, 0x80, 0x6, 0xfa,
-    0x8, 0xdf, 0xeb, 0x50, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x2, 0x9e, 0xff, 0xc6, 0x0, 0x0, 0x4,
-    0xff, 0xfe, 0xef, 0xfc, 0x0, 0x1, 0xef, 0xa1,
-    0x0, 0x3e, 0xf8, 0x0, 0x8f, 0xc0, 0x0, 0x0,
-    0x5f, 0xe0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x44,
-    0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf5, 0x0, 0x0,
-    0x0, 0xdd, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x6f,
-    0xc0, 0x2, 0xff, 0x90, 0x0, 0x5f, 0xf5, 0x0,
-    0x5, 0xff, 0xfd, 0xff, 0xf9, 0x0, 0x0, 0x3,
-    0xae, 0xff, 0xb5, 0x0, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xa0, 0x0, 0x2a, 0xef, 0xe9, 0x16, 0xfa, 0x0,
-    0x5f, 0xff, 0xde, 0xff, 0x9f, 0xa0, 0x2f, 0xf9,
-    0x10, 0x3, 0xdf, 0xfa, 0x9, 0xfc, 0x0, 0x0,
-    0x2, 0xff, 0xa0, 0xef, 0x50, 0x0, 0x0, 0xb,
-    0xfa, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x7f, 0xa1,
-    0xff, 0x10, 0x0, 0x0, 0x6, 0xfa, 0x1f, 0xf2,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0xef, 0x50, 0x0,
-    0x0, 0xa, 0xfa, 0x9, 0xfd, 0x0, 0x0, 0x2,
-    0xff, 0xa0, 0x1f, 0xfa, 0x10, 0x3, 0xdf, 0xfa,
-    0x0, 0x4f, 0xff, 0xee, 0xff, 0x9f, 0xa0, 0x0,
-    0x2a, 0xef, 0xeb, 0x36, 0xfa,
-
-    /* U+0065 "e" */
-    0x0, 0x1, 0x8d, 0xfe, 0xb3, 0x0, 0x0, 0x3,
-    0xef, 0xfe, 0xff, 0xf7, 0x0, 0x1, 0xef, 0x80,
-    0x0, 0x7f, 0xf2, 0x0, 0x8f, 0x90, 0x0, 0x0,
-    0x6f, 0xb0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0xff,
-    0x1, 0xff, 0xdd, 0xdd, 0xdd, 0xdf, 0xf3, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x45, 0x0, 0x8f, 0xa0, 0x0, 0x0, 0x3f,
-    0xd0, 0x1, 0xef, 0x91, 0x0, 0x3d, 0xf6, 0x0,
-    0x4, 0xff, 0xfe, 0xef, 0xfa, 0x0, 0x0, 0x2,
-    0x9d, 0xff, 0xc6, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x5, 0xcf, 0xe1, 0x0, 0x3f, 0xfe, 0xe2,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0xbf, 0xff, 0xff, 0xd0,
-    0x9d, 0xff, 0xed, 0xa0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0xaf, 0x60, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x2, 0x9e, 0xfe, 0x91, 0xbf, 0x30, 0x4,
-    0xff, 0xfd, 0xff, 0xdb, 0xf3, 0x1, 0xff, 0x90,
-    0x0, 0x5f, 0xff, 0x30, 0x8f, 0xc0, 0x0, 0x0,
-    0x8f, 0xf3, 0xd, 0xf5, 0x0, 0x0, 0x1, 0xff,
-    0x30, 0xff, 0x20, 0x0, 0x0, 0xe, 0xf3, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0xdf, 0x31, 0xff, 0x10,
-    0x0, 0x0, 0xe, 0xf3, 0xe, 0xf5, 0x0, 0x0,
-    0x2, 0xff, 0x30, 0xaf, 0xb0, 0x0, 0x0, 0x9f,
-    0xf3, 0x2, 0xff, 0x90, 0x0, 0x6f, 0xff, 0x30,
-    0x6, 0xff, 0xfd, 0xff, 0xbb, 0xf3, 0x0, 0x3,
-    0xae, 0xfd, 0x70, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x6, 0xb5, 0x0, 0x0, 0x4,
-    0xfd, 0x0, 0x5f, 0xe3, 0x0, 0x2, 0xdf, 0x60,
-    0x0, 0xaf, 0xfd, 0xbc, 0xff, 0xa0, 0x0, 0x0,
-    0x5b, 0xef, 0xeb, 0x60, 0x0,
-
-    /* U+0068 "h" */
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0x18, 0xdf, 0xea,
-    0x20, 0x7f, 0xad, 0xfe, 0xef, 0xfe, 0x7, 0xff,
-    0xd3, 0x0, 0x2e, 0xf7, 0x7f, 0xf3, 0x0, 0x0,
-    0x6f, 0xa7, 0xfc, 0x0, 0x0, 0x3, 0xfc, 0x7f,
-    0xa0, 0x0, 0x0, 0x3f, 0xd7, 0xf9, 0x0, 0x0,
-    0x3, 0xfd, 0x7f, 0x90, 0x0, 0x0, 0x3f, 0xd7,
-    0xf9, 0x0, 0x0, 0x3, 0xfd, 0x7f, 0x90, 0x0,
-    0x0, 0x3f, 0xd7, 0xf9, 0x0, 0x0, 0x3, 0xfd,
-    0x7f, 0x90, 0x0, 0x0, 0x3f, 0xd7, 0xf9, 0x0,
-    0x0, 0x3, 0xfd,
-
-    /* U+0069 "i" */
-    0x5f, 0xb5, 0xfb, 0x38, 0x60, 0x0, 0x0, 0x5,
-    0xfb, 0x5f, 0xb5, 0xfb, 0x5f, 0xb5, 0xfb, 0x5f,
-    0xb5, 0xfb, 0x5f, 0xb5, 0xfb, 0x5f, 0xb5, 0xfb,
-    0x5f, 0xb5, 0xfb,
-
-    /* U+006A "j" */
-    0x0, 0x5f, 0xb0, 0x5, 0xfb, 0x0, 0x38, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0,
-    0x5f, 0xb0, 0x5, 0xfb, 0x0, 0x5f, 0xb0, 0x5,
-    0xfb, 0x0, 0x5f, 0xb0, 0x5, 0xfb, 0x0, 0x5f,
-    0xb0, 0x5, 0xfb, 0x0, 0x5f, 0xb0, 0x5, 0xfb,
-    0x0, 0x5f, 0xb0, 0x5, 0xfb, 0x0, 0x5f, 0xb0,
-    0x5, 0xfb, 0x0, 0x8f, 0x94, 0xdf, 0xf5, 0x5f,
-    0xe7, 0x0,
-
-    /* U+006B "k" */
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0x3, 0xef, 0x90, 0x5f, 0xb0, 0x0, 0x3e,
-    0xf8, 0x0, 0x5f, 0xb0, 0x3, 0xef, 0x70, 0x0,
-    0x5f, 0xb0, 0x3e, 0xf7, 0x0, 0x0, 0x5f, 0xb3,
-    0xef, 0x70, 0x0, 0x0, 0x5f, 0xde, 0xff, 0xa0,
-    0x0, 0x0, 0x5f, 0xff, 0x8f, 0xf4, 0x0, 0x0,
-    0x5f, 0xf5, 0x9, 0xfe, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0xef, 0x90, 0x0, 0x5f, 0xb0, 0x0, 0x5f,
-    0xf3, 0x0, 0x5f, 0xb0, 0x0, 0xb, 0xfd, 0x0,
-    0x5f, 0xb0, 0x0, 0x1, 0xff, 0x70, 0x5f, 0xb0,
-    0x0, 0x0, 0x7f, 0xf2,
-
-    /* U+006C "l" */
-    0x5f, 0xb5, 0xfb, 0x5f, 0xb5, 0xfb, 0x5f, 0xb5,
-    0xfb, 0x5f, 0xb5, 0xfb, 0x5f, 0xb5, 0xfb, 0x5f,
-    0xb5, 0xfb, 0x5f, 0xb5, 0xfb, 0x5f, 0xb5, 0xfb,
-    0x5f, 0xb5, 0xfb,
-
-    /* U+006D "m" */
-    0x7f, 0x71, 0x9e, 0xfe, 0x80, 0x5, 0xcf, 0xfc,
-    0x50, 0x7f, 0x8d, 0xfe, 0xff, 0xf9, 0x8f, 0xfe,
-    0xff, 0xf5, 0x7f, 0xfd, 0x20, 0x7, 0xff, 0xf8,
-    0x0, 0xb, 0xfc, 0x7f, 0xf2, 0x0, 0x0, 0xef,
-    0xa0, 0x0, 0x4, 0xfe, 0x7f, 0xb0, 0x0, 0x0,
-    0xcf, 0x50, 0x0, 0x2, 0xff, 0x7f, 0x90, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0x1, 0xff, 0x7f, 0x90,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x1, 0xff, 0x7f,
-    0x90, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x1, 0xff,
-    0x7f, 0x90, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x1,
-    0xff, 0x7f, 0x90, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x1, 0xff, 0x7f, 0x90, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x1, 0xff, 0x7f, 0x90, 0x0, 0x0, 0xcf,
-    0x40, 0x0, 0x1, 0xff, 0x7f, 0x90, 0x0, 0x0,
-    0xcf, 0x40, 0x0, 0x1, 0xff,
-
-    /* U+006E "n" */
-    0x7f, 0x70, 0x8d, 0xfe, 0xa2, 0x7, 0xf8, 0xdf,
-    0xee, 0xff, 0xe0, 0x7f, 0xfd, 0x30, 0x2, 0xef,
-    0x77, 0xff, 0x30, 0x0, 0x6, 0xfa, 0x7f, 0xc0,
-    0x0, 0x0, 0x3f, 0xc7, 0xfa, 0x0, 0x0, 0x3,
-    0xfd, 0x7f, 0x90, 0x0, 0x0, 0x3f, 0xd7, 0xf9,
-    0x0, 0x0, 0x3, 0xfd, 0x7f, 0x90, 0x0, 0x0,
-    0x3f, 0xd7, 0xf9, 0x0, 0x0, 0x3, 0xfd, 0x7f,
-    0x90, 0x0, 0x0, 0x3f, 0xd7, 0xf9, 0x0, 0x0,
-    0x3, 0xfd, 0x7f, 0x90, 0x0, 0x0, 0x3f, 0xd0,
-
-    /* U+006F "o" */
-    0x0, 0x1, 0x9d, 0xff, 0xc7, 0x0, 0x0, 0x4,
-    0xff, 0xfe, 0xef, 0xfd, 0x10, 0x1, 0xef, 0xb2,
-    0x0, 0x3d, 0xfc, 0x0, 0x8f, 0xd0, 0x0, 0x0,
-    0x2f, 0xf5, 0xe, 0xf5, 0x0, 0x0, 0x0, 0x9f,
-    0xa1, 0xff, 0x10, 0x0, 0x0, 0x5, 0xfd, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0xff, 0x10,
-    0x0, 0x0, 0x5, 0xfd, 0xe, 0xf5, 0x0, 0x0,
-    0x0, 0x9f, 0xa0, 0x9f, 0xc0, 0x0, 0x0, 0x1f,
-    0xf5, 0x1, 0xef, 0xb2, 0x0, 0x3d, 0xfc, 0x0,
-    0x4, 0xff, 0xfe, 0xef, 0xfd, 0x10, 0x0, 0x1,
-    0x9d, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x6f, 0xa1, 0x9e, 0xfe, 0xb4, 0x0, 0x6, 0xfb,
-    0xef, 0xfd, 0xff, 0xf7, 0x0, 0x6f, 0xff, 0x50,
-    0x0, 0x8f, 0xf4, 0x6, 0xff, 0x60, 0x0, 0x0,
-    0xaf, 0xc0, 0x6f, 0xe0, 0x0, 0x0, 0x2, 0xff,
-    0x16, 0xfb, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x6f,
-    0x90, 0x0, 0x0, 0x0, 0xdf, 0x56, 0xfb, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x6f, 0xe0, 0x0, 0x0,
-    0x2, 0xff, 0x26, 0xff, 0x60, 0x0, 0x0, 0x9f,
-    0xd0, 0x6f, 0xff, 0x50, 0x0, 0x6f, 0xf5, 0x6,
-    0xfb, 0xdf, 0xfd, 0xff, 0xf8, 0x0, 0x6f, 0xa0,
-    0x8d, 0xfe, 0xb5, 0x0, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x2, 0xae, 0xfe, 0x91, 0x6f, 0xa0, 0x5,
-    0xff, 0xfd, 0xef, 0xf9, 0xfa, 0x2, 0xff, 0x91,
-    0x0, 0x3d, 0xff, 0xa0, 0x9f, 0xc0, 0x0, 0x0,
-    0x2f, 0xfa, 0xe, 0xf5, 0x0, 0x0, 0x0, 0xbf,
-    0xa1, 0xff, 0x20, 0x0, 0x0, 0x7, 0xfa, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x6f, 0xa1, 0xff, 0x20,
-    0x0, 0x0, 0x7, 0xfa, 0xe, 0xf5, 0x0, 0x0,
-    0x0, 0xaf, 0xa0, 0x9f, 0xd0, 0x0, 0x0, 0x2f,
-    0xfa, 0x1, 0xff, 0xa1, 0x0, 0x3d, 0xff, 0xa0,
-    0x4, 0xff, 0xfe, 0xef, 0xf9, 0xfa, 0x0, 0x2,
-    0xae, 0xfe, 0xb3, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa,
-
-    /* U+0072 "r" */
-    0x8f, 0x60, 0x5c, 0xe8, 0xf6, 0x8f, 0xff, 0x8f,
-    0xaf, 0xc6, 0x48, 0xff, 0xa0, 0x0, 0x8f, 0xf0,
-    0x0, 0x8, 0xfb, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x29, 0xdf, 0xec, 0x60, 0x0, 0x4, 0xff,
-    0xfe, 0xff, 0xfd, 0x0, 0xc, 0xfa, 0x0, 0x3,
-    0xef, 0x60, 0xf, 0xf3, 0x0, 0x0, 0x6e, 0x90,
-    0xc, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfc, 0x95, 0x10, 0x0, 0x0, 0x29, 0xdf, 0xff,
-    0xfa, 0x10, 0x0, 0x0, 0x1, 0x59, 0xff, 0xd0,
-    0x3, 0x20, 0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf0,
-    0x0, 0x0, 0xf, 0xf3, 0xd, 0xfa, 0x10, 0x0,
-    0x7f, 0xf0, 0x3, 0xff, 0xfe, 0xef, 0xff, 0x60,
-    0x0, 0x29, 0xdf, 0xfd, 0x92, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x58, 0x30, 0x0, 0xa, 0xf6, 0x0, 0x0,
-    0xaf, 0x60, 0x0, 0xa, 0xf6, 0x0, 0xcf, 0xff,
-    0xff, 0xda, 0xdf, 0xfe, 0xdb, 0x0, 0xaf, 0x60,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0xaf, 0x60, 0x0, 0xa,
-    0xf6, 0x0, 0x0, 0xaf, 0x60, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0xaf, 0x70, 0x0, 0x8, 0xff, 0xdb,
-    0x0, 0x1a, 0xef, 0xd0,
-
-    /* U+0075 "u" */
-    0x7f, 0x90, 0x0, 0x0, 0x3f, 0xd7, 0xf9, 0x0,
-    0x0, 0x3, 0xfd, 0x7f, 0x90, 0x0, 0x0, 0x3f,
-    0xd7, 0xf9, 0x0, 0x0, 0x3, 0xfd, 0x7f, 0x90,
-    0x0, 0x0, 0x3f, 0xd7, 0xf9, 0x0, 0x0, 0x3,
-    0xfd, 0x7f, 0x90, 0x0, 0x0, 0x3f, 0xd7, 0xf9,
-    0x0, 0x0, 0x4, 0xfd, 0x7f, 0x90, 0x0, 0x0,
-    0x6f, 0xd5, 0xfb, 0x0, 0x0, 0xd, 0xfd, 0x2f,
-    0xf6, 0x0, 0x1a, 0xff, 0xd0, 0x9f, 0xff, 0xef,
-    0xf5, 0xfd, 0x0, 0x8d, 0xfe, 0xb3, 0x1f, 0xd0,
-
-    /* U+0076 "v" */
-    0x7f, 0xc0, 0x0, 0x0, 0xa, 0xf7, 0x2f, 0xf1,
-    0x0, 0x0, 0xe, 0xf2, 0xc, 0xf6, 0x0, 0x0,
-    0x4f, 0xc0, 0x6, 0xfb, 0x0, 0x0, 0x9f, 0x60,
-    0x1, 0xff, 0x10, 0x0, 0xef, 0x10, 0x0, 0xbf,
-    0x60, 0x3, 0xfb, 0x0, 0x0, 0x5f, 0xb0, 0x8,
-    0xf6, 0x0, 0x0, 0xf, 0xf0, 0xd, 0xf1, 0x0,
-    0x0, 0xa, 0xf5, 0x2f, 0xb0, 0x0, 0x0, 0x4,
-    0xfa, 0x7f, 0x50, 0x0, 0x0, 0x0, 0xef, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x7f, 0xc0, 0x0, 0x1, 0xff, 0x50, 0x0, 0x7,
-    0xfa, 0x2f, 0xf1, 0x0, 0x5, 0xff, 0x90, 0x0,
-    0xb, 0xf5, 0xd, 0xf5, 0x0, 0x9, 0xff, 0xd0,
-    0x0, 0xf, 0xf0, 0x8, 0xf9, 0x0, 0xc, 0xea,
-    0xf1, 0x0, 0x3f, 0xb0, 0x3, 0xfd, 0x0, 0xf,
-    0xa6, 0xf5, 0x0, 0x8f, 0x60, 0x0, 0xef, 0x10,
-    0x4f, 0x62, 0xf9, 0x0, 0xcf, 0x10, 0x0, 0x9f,
-    0x50, 0x8f, 0x20, 0xed, 0x0, 0xfc, 0x0, 0x0,
-    0x4f, 0xa0, 0xce, 0x0, 0xaf, 0x14, 0xf8, 0x0,
-    0x0, 0xf, 0xe0, 0xfa, 0x0, 0x7f, 0x58, 0xf3,
-    0x0, 0x0, 0xa, 0xf6, 0xf7, 0x0, 0x3f, 0x9d,
-    0xe0, 0x0, 0x0, 0x6, 0xfd, 0xf3, 0x0, 0xf,
-    0xdf, 0x90, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xb0,
-    0x0, 0x7, 0xff, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x2f, 0xf7, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x6f,
-    0xf2, 0x0, 0xc, 0xf9, 0x0, 0x0, 0xbf, 0xc0,
-    0x7, 0xfd, 0x0, 0x0, 0x1, 0xef, 0x72, 0xff,
-    0x30, 0x0, 0x0, 0x4, 0xff, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfe, 0xf7, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x4f,
-    0xf2, 0x0, 0x0, 0x6, 0xfe, 0x0, 0xaf, 0xc0,
-    0x0, 0x2, 0xff, 0x40, 0x1, 0xef, 0x80, 0x0,
-    0xcf, 0xa0, 0x0, 0x5, 0xff, 0x30, 0x7f, 0xe1,
-    0x0, 0x0, 0xb, 0xfd, 0x0,
-
-    /* U+0079 "y" */
-    0x9f, 0xa0, 0x0, 0x0, 0x8, 0xfa, 0x3f, 0xf0,
-    0x0, 0x0, 0xd, 0xf4, 0xd, 0xf5, 0x0, 0x0,
-    0x2f, 0xe0, 0x7, 0xfb, 0x0, 0x0, 0x8f, 0x80,
-    0x1, 0xff, 0x10, 0x0, 0xdf, 0x20, 0x0, 0xbf,
-    0x60, 0x2, 0xfc, 0x0, 0x0, 0x5f, 0xb0, 0x8,
-    0xf6, 0x0, 0x0, 0xe, 0xf1, 0xd, 0xf0, 0x0,
-    0x0, 0x8, 0xf6, 0x2f, 0xa0, 0x0, 0x0, 0x2,
-    0xfc, 0x7f, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xee,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
-    0x9, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x80, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xdd, 0xdd,
-    0xdd, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0x0, 0x0,
-    0x2, 0xef, 0x40, 0x0, 0x0, 0x0, 0xcf, 0x70,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0,
-    0x6f, 0xd1, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0x6, 0xff, 0xdd, 0xdd,
-    0xdd, 0xdd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+007B "{" */
-    0x0, 0x8, 0xef, 0x60, 0x6, 0xfc, 0x73, 0x0,
-    0xbf, 0x30, 0x0, 0xd, 0xf1, 0x0, 0x0, 0xdf,
-    0x10, 0x0, 0xd, 0xf1, 0x0, 0x0, 0xdf, 0x10,
-    0x0, 0xd, 0xf1, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x1c, 0xf7, 0x0, 0xd, 0xf8,
-    0x0, 0x0, 0xaf, 0xe2, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0xdf, 0x10, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0xd, 0xf1, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x7, 0xfc, 0x73, 0x0, 0x8, 0xff,
-    0x60,
-
-    /* U+007C "|" */
-    0x18, 0x32, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x72,
-    0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2f,
-    0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x72, 0xf7,
-    0x2f, 0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x72,
-    0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x70,
-
-    /* U+007D "}" */
-    0x6f, 0xe8, 0x0, 0x3, 0x7d, 0xf5, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0x8, 0xfb, 0x10, 0x0,
-    0x9, 0xfd, 0x0, 0x2, 0xdf, 0xa0, 0x0, 0xbf,
-    0x70, 0x0, 0xf, 0xf0, 0x0, 0x1, 0xfd, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x3f,
-    0xb0, 0x3, 0x7c, 0xf6, 0x0, 0x6f, 0xe8, 0x0,
-    0x0,
-
-    /* U+007E "~" */
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xf9, 0x20, 0x0, 0xa6, 0xe, 0xc5, 0x8e, 0xf9,
-    0x37, 0xf6, 0x2e, 0x10, 0x0, 0x8f, 0xff, 0x90,
-    0x1, 0x0, 0x0, 0x1, 0x42, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 107, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 99, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36, .adv_w = 164, .box_w = 6, .box_h = 7, .ofs_x = 2, .ofs_y = 11},
-    {.bitmap_index = 57, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 174, .adv_w = 214, .box_w = 13, .box_h = 23, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 324, .adv_w = 384, .box_w = 20, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 504, .adv_w = 242, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 648, .adv_w = 107, .box_w = 3, .box_h = 7, .ofs_x = 2, .ofs_y = 11},
-    {.bitmap_index = 659, .adv_w = 99, .box_w = 6, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 728, .adv_w = 99, .box_w = 7, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 809, .adv_w = 135, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 11},
-    {.bitmap_index = 837, .adv_w = 230, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 922, .adv_w = 107, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 936, .adv_w = 149, .box_w = 8, .box_h = 2, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 944, .adv_w = 107, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 950, .adv_w = 128, .box_w = 10, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1040, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1148, .adv_w = 214, .box_w = 7, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1211, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1319, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1436, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1553, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1670, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1787, .adv_w = 214, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1895, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2012, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2129, .adv_w = 107, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2155, .adv_w = 107, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2189, .adv_w = 230, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 2280, .adv_w = 230, .box_w = 13, .box_h = 7, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 2326, .adv_w = 230, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 2417, .adv_w = 214, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2516, .adv_w = 307, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2678, .adv_w = 249, .box_w = 17, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2831, .adv_w = 263, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2966, .adv_w = 277, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3110, .adv_w = 270, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3245, .adv_w = 235, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3362, .adv_w = 220, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3479, .adv_w = 291, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3623, .adv_w = 277, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3758, .adv_w = 99, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3794, .adv_w = 199, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3893, .adv_w = 256, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4037, .adv_w = 214, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4154, .adv_w = 334, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4316, .adv_w = 277, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4451, .adv_w = 292, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4613, .adv_w = 249, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4739, .adv_w = 292, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4919, .adv_w = 263, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5054, .adv_w = 249, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5189, .adv_w = 220, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5315, .adv_w = 277, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5450, .adv_w = 235, .box_w = 16, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5594, .adv_w = 356, .box_w = 22, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5792, .adv_w = 235, .box_w = 16, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5936, .adv_w = 249, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6080, .adv_w = 235, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6215, .adv_w = 99, .box_w = 6, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 6284, .adv_w = 128, .box_w = 10, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6374, .adv_w = 99, .box_w = 5, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 6432, .adv_w = 230, .box_w = 13, .box_h = 11, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 6504, .adv_w = 192, .box_w = 12, .box_h = 3, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 6522, .adv_w = 85, .box_w = 6, .box_h = 4, .ofs_x = -1, .ofs_y = 14},
-    {.bitmap_index = 6534, .adv_w = 206, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6619, .adv_w = 228, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6736, .adv_w = 206, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6821, .adv_w = 228, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6938, .adv_w = 206, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7023, .adv_w = 114, .box_w = 8, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7095, .adv_w = 220, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 7212, .adv_w = 214, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7311, .adv_w = 85, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7338, .adv_w = 85, .box_w = 5, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 7396, .adv_w = 199, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7504, .adv_w = 85, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7531, .adv_w = 328, .box_w = 18, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7648, .adv_w = 214, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7720, .adv_w = 220, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7805, .adv_w = 228, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 7922, .adv_w = 228, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8039, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8085, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8163, .adv_w = 121, .box_w = 7, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8223, .adv_w = 214, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8295, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8373, .adv_w = 291, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8490, .adv_w = 199, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8575, .adv_w = 192, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8683, .adv_w = 184, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8755, .adv_w = 128, .box_w = 7, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 8836, .adv_w = 85, .box_w = 3, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 8874, .adv_w = 128, .box_w = 7, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8955, .adv_w = 230, .box_w = 12, .box_h = 5, .ofs_x = 1, .ofs_y = 4}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    34, 55,
-    34, 87,
-    39, 13,
-    39, 15,
-    39, 34,
-    45, 55,
-    49, 13,
-    49, 15,
-    49, 34,
-    51, 55,
-    53, 13,
-    53, 14,
-    53, 15,
-    53, 27,
-    53, 28,
-    55, 13,
-    55, 14,
-    55, 15,
-    55, 27,
-    55, 28,
-    55, 34,
-    55, 66,
-    55, 70,
-    55, 74,
-    55, 80,
-    55, 83,
-    55, 86,
-    55, 90,
-    56, 13,
-    56, 15,
-    56, 27,
-    56, 28,
-    58, 13,
-    58, 14,
-    58, 15,
-    58, 27,
-    58, 28,
-    58, 81,
-    58, 82,
-    58, 87,
-    71, 71,
-    83, 13,
-    83, 14,
-    83, 15,
-    83, 82,
-    87, 13,
-    87, 15,
-    88, 13,
-    88, 15,
-    90, 13,
-    90, 15
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    -18, -7, -60, -60, -21, -35, -69, -69,
-    -28, -7, -43, -50, -43, -43, -43, -50,
-    -21, -50, -18, -18, -18, -21, -21, -7,
-    -21, -14, -14, -7, -28, -28, -7, -7,
-    -53, -43, -53, -35, -35, -28, -35, -21,
-    -7, -35, -21, -35, -7, -28, -28, -21,
-    -21, -28, -28
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 51,
-    .glyph_ids_size = 0
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
-    .kern_scale = 16,
-    .cmap_num = 1,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t font_en_24 = {
-#else
-lv_font_t font_en_24 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 25,          /*The maximum line height required by the font*/
-    .base_line = 5,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if FONT_EN_24*/
-
@@ -21,6 +21,7 @@
 
 #include "bsp_board.h"
 #include "bsp/esp-bsp.h"
+#include "bsp_display_profile.h"
 
 #include "lvgl.h"
 #include "gui/ui_main.h"
@@ -85,12 +86,8 @@ void app_main(void)
 
     bsp_display_cfg_t cfg = {
         .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
-        .buffer_size = BSP_LCD_H_RES * CONFIG_BSP_LCD_DRAW_BUF_HEIGHT,
-        .double_buffer = 0,
-        .flags = {
-            .buff_dma = true,
-        }
     };
+    bsp_display_profile_apply(NULL, &cfg);
     bsp_display_start_with_config(&cfg);
     bsp_board_init();
     ESP_ERROR_CHECK(bsp_spiffs_mount());
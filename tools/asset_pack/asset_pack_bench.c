@@ -0,0 +1,232 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "asset_pack.h"
+
+#define BENCH_PARTITION     "assets"
+#define BENCH_LOOKUPS       (1000000)
+
+/* Room for a name and the character making it a miss */
+typedef char bench_name_t[sizeof(((asset_pack_entry_t *)0)->name) + 1];
+
+static const char *s_type_names[] = {"?", "image", "pcm", "file"};
+static volatile uint32_t s_sink;
+
+static int64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* The lookup of manifest version 1, a scan of every name */
+static const asset_pack_entry_t *linear_find(const char *name)
+{
+    for (size_t i = 0; i < asset_pack_count(); i++) {
+        const asset_pack_entry_t *entry = asset_pack_get(i);
+        if (0 == strcmp(entry->name, name)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static double lookup_ns(const asset_pack_entry_t *(*find)(const char *), const bench_name_t *names, size_t count,
+                        size_t rounds, size_t *found)
+{
+    *found = 0;
+    int64_t start = now_ns();
+    for (size_t r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < count; i++) {
+            *found += (NULL != find(names[i]));
+        }
+    }
+    return (double)(now_ns() - start) / (rounds * count);
+}
+
+static void bench_lookup(size_t lookups)
+{
+    size_t count = asset_pack_count();
+    bench_name_t *hits = calloc(count, sizeof(bench_name_t));
+    bench_name_t *misses = calloc(count, sizeof(bench_name_t));
+    size_t found;
+
+    if (!hits || !misses) {
+        fprintf(stderr, "no mem\n");
+        exit(1);
+    }
+    /* Misses share the name up to their last character, the worst case of a comparison */
+    for (size_t i = 0; i < count; i++) {
+        strcpy(hits[i], asset_pack_get(i)->name);
+        snprintf(misses[i], sizeof(misses[i]), "%s~", hits[i]);
+    }
+    size_t rounds = (lookups + count - 1) / count;
+
+    printf("\nLookup of %u names, %u rounds\n", (unsigned)count, (unsigned)rounds);
+    printf("  %-16s %10s %10s\n", "", "hit ns", "miss ns");
+    double hit = lookup_ns(asset_pack_find, hits, count, rounds, &found);
+    if (found != rounds * count) {
+        fprintf(stderr, "asset_pack_find missed %u names\n", (unsigned)(rounds * count - found));
+        exit(1);
+    }
+    double miss = lookup_ns(asset_pack_find, misses, count, rounds, &found);
+    printf("  %-16s %10.1f %10.1f\n", "binary search", hit, miss);
+    hit = lookup_ns(linear_find, hits, count, rounds, &found);
+    miss = lookup_ns(linear_find, misses, count, rounds, &found);
+    printf("  %-16s %10.1f %10.1f\n", "linear scan", hit, miss);
+
+    free(hits);
+    free(misses);
+}
+
+/* Get the data of an asset as the firmware would, the bytes copied on the way to the caller */
+static const void *acquire(const asset_pack_entry_t *entry, size_t *copied, lv_img_dsc_t *img)
+{
+    const void *data = asset_pack_map(entry->name, NULL);
+
+    *copied = 0;
+    if (data) {
+        return data;
+    }
+    if (ASSET_PACK_TYPE_IMAGE == entry->type) {
+        if (ESP_OK != asset_pack_image_load(entry->name, img)) {
+            return NULL;
+        }
+        *copied = entry->size;
+        return img->data;
+    }
+    if (ASSET_PACK_TYPE_PCM == entry->type) {
+        const uint8_t *pcm = NULL;
+        if (ESP_OK != asset_pack_pcm_load(entry->name, &pcm, NULL)) {
+            return NULL;
+        }
+        *copied = entry->size;
+        return pcm;
+    }
+    FILE *fp = asset_pack_open(entry->name, NULL);
+    uint8_t *buf = malloc(entry->stored_size ? entry->stored_size : 1);
+    if (!fp || !buf || (entry->stored_size != fread(buf, 1, entry->stored_size, fp))) {
+        free(buf);
+        buf = NULL;
+    }
+    if (fp) {
+        fclose(fp);
+    }
+    *copied = entry->stored_size;
+    return buf;
+}
+
+static void bench_access(void)
+{
+    uint64_t total_ns = 0;
+    size_t total_copied = 0;
+
+    printf("\n  %-32s %-6s %-4s %9s %9s %10s %10s\n", "name", "type", "enc", "bytes", "copied", "get us",
+           "read us");
+    for (size_t i = 0; i < asset_pack_count(); i++) {
+        const asset_pack_entry_t *entry = asset_pack_get(i);
+        lv_img_dsc_t img;
+        size_t copied;
+
+        int64_t start = now_ns();
+        const uint8_t *data = acquire(entry, &copied, &img);
+        int64_t got = now_ns();
+        if (!data) {
+            fprintf(stderr, "%s: not readable\n", entry->name);
+            exit(1);
+        }
+        /* Touch every byte, what playing or drawing the asset costs at least */
+        size_t len = copied ? copied : entry->stored_size;
+        uint32_t sum = 0;
+        for (size_t k = 0; k < len; k++) {
+            sum += data[k];
+        }
+        int64_t read = now_ns();
+        s_sink += sum;
+        asset_pack_free(data);
+
+        printf("  %-32s %-6s %-4s %9" PRIu32 " %9u %10.1f %10.1f\n", entry->name,
+               s_type_names[entry->type < 4 ? entry->type : 0], entry->encoding ? "rle" : "raw", entry->size,
+               (unsigned)copied, (got - start) / 1000.0, (read - got) / 1000.0);
+        total_ns += got - start;
+        total_copied += copied;
+    }
+    printf("  %-32s %-6s %-4s %9s %9u %10.1f\n", "total", "", "", "", (unsigned)total_copied, total_ns / 1000.0);
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-n <lookups>] [-l] [-v] <image.bin | converted directory>\n", name);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    size_t lookups = BENCH_LOOKUPS;
+    bool list = false;
+    struct stat st;
+    esp_err_t ret;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:lv")) != -1) {
+        switch (opt) {
+        case 'n':
+            lookups = strtoul(optarg, NULL, 0);
+            break;
+        case 'l':
+            list = true;
+            break;
+        case 'v':
+            port_log_level = ESP_LOG_DEBUG;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if ((optind != argc - 1) || !lookups || stat(argv[optind], &st)) {
+        usage(argv[0]);
+    }
+
+    /* A directory as asset_pack_create_partition_image() creates it, or a flat image mapped like the partition */
+    if (S_ISDIR(st.st_mode)) {
+        ret = asset_pack_init(argv[optind]);
+    } else {
+        ret = port_partition_set_file(BENCH_PARTITION, argv[optind]);
+        if (ESP_OK == ret) {
+            ret = asset_pack_init_partition(BENCH_PARTITION);
+        }
+    }
+    if (ESP_OK != ret) {
+        fprintf(stderr, "%s: %s\n", argv[optind], esp_err_to_name(ret));
+        return 1;
+    }
+    printf("%s: %u assets, %s\n", argv[optind], (unsigned)asset_pack_count(),
+           S_ISDIR(st.st_mode) ? "read from files" : "mapped");
+
+    if (list) {
+        for (size_t i = 0; i < asset_pack_count(); i++) {
+            const asset_pack_entry_t *entry = asset_pack_get(i);
+            printf("  %-32s %-6s %8" PRIu32 " bytes at %8" PRIu32 ", %s\n", entry->name,
+                   s_type_names[entry->type < 4 ? entry->type : 0], entry->stored_size, entry->offset, entry->file);
+        }
+    }
+    if (asset_pack_count()) {
+        bench_lookup(lookups);
+        bench_access();
+    }
+    return 0;
+}
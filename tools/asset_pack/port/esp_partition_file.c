@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "port_compat.h"
+
+#define PORT_SECTOR_SIZE    (4096)
+
+static struct {
+    esp_partition_t partition;
+    int fd;
+    const void *map;
+} s_port = {
+    .fd = -1,
+};
+
+static const char *TAG = "port_partition";
+
+esp_err_t port_partition_set_file(const char *label, const char *path)
+{
+    struct stat st;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        ESP_LOGE(TAG, "open %s failed", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (fstat(fd, &st) || !st.st_size || (st.st_size > UINT32_MAX - PORT_SECTOR_SIZE)) {
+        close(fd);
+        ESP_LOGE(TAG, "%s is empty or too large", path);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (s_port.fd >= 0) {
+        close(s_port.fd);
+    }
+    s_port.fd = fd;
+    s_port.partition.type = ESP_PARTITION_TYPE_DATA;
+    s_port.partition.subtype = ESP_PARTITION_SUBTYPE_ANY;
+    s_port.partition.size = (st.st_size + PORT_SECTOR_SIZE - 1) & ~(PORT_SECTOR_SIZE - 1);
+    strlcpy(s_port.partition.label, label, sizeof(s_port.partition.label));
+    return ESP_OK;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label)
+{
+    if ((s_port.fd < 0) || (type != s_port.partition.type) || (label && strcmp(label, s_port.partition.label))) {
+        return NULL;
+    }
+    return &s_port.partition;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle)
+{
+    if ((partition != &s_port.partition) || offset || (size != partition->size) || s_port.map) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    /* The file ends within the last page, which reads as zeros past it, the image header gives its size */
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, s_port.fd, 0);
+    if (MAP_FAILED == map) {
+        ESP_LOGE(TAG, "mmap failed");
+        return ESP_FAIL;
+    }
+    s_port.map = map;
+    *out_ptr = map;
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+    if (s_port.map) {
+        munmap((void *)s_port.map, s_port.partition.size);
+        s_port.map = NULL;
+    }
+}
@@ -0,0 +1,297 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "audio_convert.h"
+
+#define BENCH_SECONDS       (10)
+#define BENCH_CHUNK_FRAMES  (1152)      /* One MPEG-1 layer III frame, as the player writes it */
+#define BENCH_TONE_LEVEL    (0.891)     /* -1 dBFS */
+#define BENCH_SETTLE_FRAMES (64)        /* Input frames, past the 48 taps of the filter */
+#define BENCH_DC_LEVEL      (12000)
+
+typedef struct {
+    audio_convert_format_t in;
+    audio_convert_format_t out;
+    double max_thd_n_db;            /* At 1 kHz */
+    double max_thd_n_high_db;       /* At 0.35 of the lower rate, near the top of the pass band */
+} bench_case_t;
+
+#define FMT(r, b, c)        { .rate = (r), .bits = (b), .channels = (c) }
+
+/* The first two are the conversions of the USB speaker output, CD rate files to a 48 kHz speaker and back */
+static const bench_case_t s_cases[] = {
+    { FMT(44100, 16, 2), FMT(48000, 16, 2), -80.0, -70.0 },
+    { FMT(48000, 16, 2), FMT(44100, 16, 2), -80.0, -70.0 },
+    { FMT(48000, 16, 2), FMT(48000, 16, 2), -95.0, -95.0 },
+    { FMT(44100, 16, 1), FMT(48000, 16, 2), -80.0, -70.0 },
+    { FMT(44100, 32, 2), FMT(48000, 16, 2), -80.0, -70.0 },
+    { FMT(44100, 16, 2), FMT(48000, 24, 2), -80.0, -70.0 },
+    { FMT(44100, 16, 2), FMT(48000, 32, 2), -80.0, -70.0 },
+    { FMT(32000, 16, 2), FMT(48000, 16, 2), -80.0, -70.0 },
+    { FMT(22050, 16, 2), FMT(48000, 16, 2), -80.0, -70.0 },
+    { FMT(16000, 16, 1), FMT(48000, 16, 2), -80.0, -70.0 },
+};
+
+static int s_failures;
+static uint32_t s_seed = 1;
+
+static uint32_t bench_rand(void)
+{
+    /* xorshift32, the same chunk sizes on every host */
+    s_seed ^= s_seed << 13;
+    s_seed ^= s_seed >> 17;
+    s_seed ^= s_seed << 5;
+    return s_seed;
+}
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void check(bool ok, const char *what)
+{
+    if (!ok) {
+        printf("  %-52s FAIL\n", what);
+        s_failures++;
+    }
+}
+
+static size_t frame_size(const audio_convert_format_t *fmt)
+{
+    return fmt->channels * fmt->bits / 8;
+}
+
+/* A tone of the given frequency on every channel, or a constant if freq_hz is 0 */
+static uint8_t *make_input(const audio_convert_format_t *fmt, size_t frames, double freq_hz, int32_t dc)
+{
+    uint8_t *buf = malloc(frames * frame_size(fmt));
+    if (!buf) {
+        fprintf(stderr, "no mem\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < frames; i++) {
+        const int32_t v = freq_hz ? (int32_t)lrint(BENCH_TONE_LEVEL * 32767.0 * sin(2.0 * M_PI * freq_hz * i / fmt->rate))
+                          : dc;
+        for (int ch = 0; ch < fmt->channels; ch++) {
+            uint8_t *p = buf + i * frame_size(fmt) + ch * fmt->bits / 8;
+            if (16 == fmt->bits) {
+                p[0] = v & 0xff;
+                p[1] = (v >> 8) & 0xff;
+            } else {
+                const uint32_t w = (uint32_t)v << 16;
+                memcpy(p, &w, sizeof(w));
+            }
+        }
+    }
+    return buf;
+}
+
+static double read_output(const uint8_t *p, uint8_t bits)
+{
+    switch (bits) {
+    case 16:
+        return (int16_t)(p[0] | (p[1] << 8)) / 32768.0;
+    case 24:
+        return (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 24) / 2147483648.0;
+    default:
+        return (int32_t)((uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24) / 2147483648.0;
+    }
+}
+
+/*
+ * Convert frames of input in chunks, of chunk_frames or random sizes if 0. Returns the output and its size, and adds
+ * the time spent converting to *us.
+ */
+static uint8_t *run(audio_convert_handle_t convert, const audio_convert_format_t *in, const uint8_t *in_buf,
+                    size_t frames, size_t chunk_frames, size_t *out_size, double *us)
+{
+    const size_t in_frame = frame_size(in);
+    size_t max_out = 0;
+    uint8_t *out = NULL;
+    size_t produced = 0;
+    double elapsed = 0;
+
+    for (size_t done = 0; done < frames;) {
+        size_t n = chunk_frames ? chunk_frames : 1 + bench_rand() % 2000;
+        n = (n < frames - done) ? n : frames - done;
+        /* Each call may produce one frame more than its share */
+        const size_t need = produced + audio_convert_get_out_size(convert, n * in_frame);
+        if (need > max_out) {
+            max_out = need + need / 2;
+            out = realloc(out, max_out);
+            if (!out) {
+                fprintf(stderr, "no mem\n");
+                exit(1);
+            }
+        }
+        const double start = now_us();
+        produced += audio_convert_process(convert, in_buf + done * in_frame, n * in_frame, out + produced);
+        elapsed += now_us() - start;
+        done += n;
+    }
+    *out_size = produced;
+    if (us) {
+        *us += elapsed;
+    }
+    return out;
+}
+
+/* Least squares fit of the tone on the first channel, the residual is distortion and noise */
+static double thd_n_db(const audio_convert_format_t *out, const uint8_t *buf, size_t size, size_t settle,
+                       double freq_hz, double *gain)
+{
+    const size_t frames = size / frame_size(out);
+    double ss = 0, sc = 0, cc = 0, sy = 0, cy = 0, yy = 0;
+
+    for (size_t i = settle; i < frames; i++) {
+        const double w = 2.0 * M_PI * freq_hz * i / out->rate;
+        const double s = sin(w);
+        const double c = cos(w);
+        const double y = read_output(buf + i * frame_size(out), out->bits);
+        ss += s * s;
+        sc += s * c;
+        cc += c * c;
+        sy += s * y;
+        cy += c * y;
+        yy += y * y;
+    }
+    const double det = ss * cc - sc * sc;
+    const double a = (sy * cc - cy * sc) / det;
+    const double b = (cy * ss - sy * sc) / det;
+    const double signal = a * sy + b * cy;
+    const double noise = yy - signal;
+    *gain = sqrt(a * a + b * b) / BENCH_TONE_LEVEL;
+    return 10.0 * log10((noise > 0 ? noise : 1e-20) / signal);
+}
+
+static bool same_output(const uint8_t *a, size_t a_size, const uint8_t *b, size_t b_size)
+{
+    return (a_size == b_size) && (0 == memcmp(a, b, a_size));
+}
+
+static void bench_case(const bench_case_t *c)
+{
+    audio_convert_handle_t convert;
+    const audio_convert_format_t *in = &c->in;
+    const audio_convert_format_t *out = &c->out;
+    const uint32_t min_rate = (in->rate < out->rate) ? in->rate : out->rate;
+    const size_t frames = in->rate * BENCH_SECONDS;
+    const size_t settle = (size_t)BENCH_SETTLE_FRAMES * out->rate / in->rate;
+    size_t size, size2;
+    double us = 0;
+    double gain, gain_high;
+    char what[96];
+
+    double start = now_us();
+    if (ESP_OK != audio_convert_new(in, out, &convert)) {
+        printf("  %6u %2u %u  -> %6u %2u %u  create failed: FAIL\n", in->rate, in->bits, in->channels, out->rate,
+               out->bits, out->channels);
+        s_failures++;
+        return;
+    }
+    const double create_us = now_us() - start;
+
+    /* Quality, at 1 kHz and near the top of the pass band */
+    uint8_t *tone = make_input(in, frames, 1000, 0);
+    uint8_t *res = run(convert, in, tone, frames, BENCH_CHUNK_FRAMES, &size, &us);
+    const double thd_n = thd_n_db(out, res, size, settle, 1000, &gain);
+    const double high_hz = 0.35 * min_rate;
+    uint8_t *tone_high = make_input(in, in->rate, high_hz, 0);
+    audio_convert_reset(convert);
+    uint8_t *res_high = run(convert, in, tone_high, in->rate, BENCH_CHUNK_FRAMES, &size2, NULL);
+    const double thd_n_high = thd_n_db(out, res_high, size2, settle, high_hz, &gain_high);
+    const size_t out_samples = size / frame_size(out) * out->channels;
+
+    printf("  %6u %2u %u  -> %6u %2u %u  %7.1f %7.1f dB %+6.2f dB %6.2f ns %8.0f us\n", in->rate, in->bits, in->channels,
+           out->rate, out->bits, out->channels, thd_n, thd_n_high, 20 * log10(gain_high), us * 1e3 / out_samples,
+           create_us);
+    snprintf(what, sizeof(what), "THD+N at 1 kHz under %.0f dB", c->max_thd_n_db);
+    check(thd_n < c->max_thd_n_db, what);
+    snprintf(what, sizeof(what), "THD+N at %.0f Hz under %.0f dB", high_hz, c->max_thd_n_high_db);
+    check(thd_n_high < c->max_thd_n_high_db, what);
+    check(fabs(20 * log10(gain)) < 0.05 && fabs(20 * log10(gain_high)) < 0.5, "pass band gain");
+
+    /* One frame out per frame in times the ratio, give or take the frame in flight */
+    const double expected = (double)frames * out->rate / in->rate;
+    check(fabs((double)(size / frame_size(out)) - expected) <= 1.0, "output length follows the rate ratio");
+
+    /* The filter state carries over between calls: chunk sizes do not change the output */
+    audio_convert_reset(convert);
+    uint8_t *res_random = run(convert, in, tone, frames, 0, &size2, NULL);
+    check(same_output(res, size, res_random, size2), "random chunk sizes give the same output");
+    free(res_random);
+
+    /* A constant passes through exactly, at every filter phase */
+    uint8_t *dc = make_input(in, in->rate / 10, 0, BENCH_DC_LEVEL);
+    audio_convert_reset(convert);
+    uint8_t *res_dc = run(convert, in, dc, in->rate / 10, BENCH_CHUNK_FRAMES, &size2, NULL);
+    bool exact = true;
+    for (size_t i = settle * out->channels; i < size2 / (out->bits / 8); i++) {
+        exact &= (lrint(read_output(res_dc + i * (out->bits / 8), out->bits) * 32768.0) == BENCH_DC_LEVEL);
+    }
+    check(exact, "constant input gives the same constant");
+    free(res_dc);
+    free(dc);
+
+    free(res_high);
+    free(tone_high);
+    free(res);
+    free(tone);
+    audio_convert_del(convert);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+        case 'v':
+            port_log_level = ESP_LOG_INFO;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+
+#if CONFIG_IDF_TARGET_ESP32S3
+    printf("Dot products of the ESP32-S3 kernel (esp-dsp reference)\n");
+#else
+    printf("Dot products in C\n");
+#endif
+    printf("  input           output            THD+N   high      high gain   per sample   create\n");
+    for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+        bench_case(&s_cases[i]);
+    }
+
+    /* The filter bank would not fit: the player keeps the stream at the file rate instead */
+    audio_convert_handle_t convert;
+    const esp_log_level_t log_level = port_log_level;
+    const audio_convert_format_t rate_11k = FMT(11025, 16, 2);
+    const audio_convert_format_t rate_48k = FMT(48000, 16, 2);
+    const audio_convert_format_t mono_24 = FMT(48000, 24, 1);
+    port_log_level = ESP_LOG_NONE;
+    check(ESP_ERR_NOT_SUPPORTED == audio_convert_new(&rate_11k, &rate_48k, &convert), "11025 Hz to 48 kHz not supported");
+    check(ESP_ERR_INVALID_ARG == audio_convert_new(&mono_24, &rate_48k, &convert), "24 bit input rejected");
+    port_log_level = log_level;
+
+    printf("%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,21 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_dsp.h"
+
+/* As dsps_dotprod_s16_ansi(), the reference the optimized kernels of esp-dsp are tested against */
+esp_err_t dsps_dotprod_s16(const int16_t *src1, const int16_t *src2, int16_t *dest, int len, int8_t shift)
+{
+    int64_t acc = 0x7fff >> shift;
+
+    for (int i = 0; i < len; i++) {
+        acc += (int32_t)src1[i] * (int32_t)src2[i];
+    }
+    const int final_shift = shift - 15;
+    acc = (final_shift > 0) ? (acc << final_shift) : (acc >> -final_shift);
+    *dest = (int16_t)acc;
+    return ESP_OK;
+}
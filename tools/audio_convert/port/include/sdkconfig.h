@@ -0,0 +1,9 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/* CONFIG_IDF_TARGET_ESP32S3 comes from the build, for the esp-dsp kernel of convert_bench_s3 */
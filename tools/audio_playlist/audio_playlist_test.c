@@ -0,0 +1,430 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define _GNU_SOURCE     /* fopencookie */
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "audio_playlist.h"
+
+#define TEST_PATH_MAX_LEN       (64)
+#define TEST_MAX_ORDER          (4)
+
+/* MPEG 1 layer III, 128 kbit/s, stereo */
+#define FRAME_HEADER_44K        "\xff\xfb\x90\x00"
+#define FRAME_HEADER_48K        "\xff\xfb\x94\x00"
+#define FRAME_SIZE_44K          (417)
+#define FRAME_SIZE_48K          (384)
+#define FRAME_SAMPLES           (1152)
+#define FRAME_RATE_HZ           (44100)
+#define FRAME_PCM_BYTES         (FRAME_SAMPLES * 2 * 2)
+
+/* What the output keeps buffered once a write returns, as the I2S DMA buffers */
+#define OUTPUT_LEAD_MS          (50)
+/* Time the player takes to start the decoder of a track started from the idle event */
+#define RESTART_MS              (300)
+
+typedef enum {
+    TRACK_A,
+    TRACK_B,
+    TRACK_C,
+    TRACK_48K,
+    TRACK_SHORT,
+    TRACK_NUM,
+} track_id_t;
+
+typedef struct {
+    char path[TEST_PATH_MAX_LEN];
+    uint8_t *data;                  /* Whole file */
+    size_t size;
+    size_t audio_start;             /* After the ID3v2 tag and the Info frame */
+    size_t audio_end;               /* Before the ID3v1 tag */
+} track_t;
+
+static track_t s_tracks[TRACK_NUM];
+static int s_order[TEST_MAX_ORDER];
+static int s_order_len;
+static char s_changed[TEST_PATH_MAX_LEN];
+static int s_changes;
+
+static uint32_t s_out_rate;
+static int64_t s_out_end_us;
+static uint32_t s_clk_calls;
+
+static SemaphoreHandle_t s_files_lock;
+static int s_files_open;
+
+static int s_failures;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-56s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+/*
+ * An MP3 file as LAME writes it: an ID3v2 tag, an Info frame, the audio frames and an ID3v1 tag. The body of every
+ * frame tells its track and its index, so that a byte of the stream shows where it comes from.
+ */
+static void track_write(const char *dir, int id, bool rate_48k, int frames)
+{
+    track_t *track = &s_tracks[id];
+    const char *header = rate_48k ? FRAME_HEADER_48K : FRAME_HEADER_44K;
+    size_t frame_size = rate_48k ? FRAME_SIZE_48K : FRAME_SIZE_44K;
+    uint8_t id3v2[10 + 10 + 1 + 5] = {'I', 'D', '3', 3, 0, 0, 0, 0, 0, 16, 'T', 'I', 'T', '2', 0, 0, 0, 6, 0, 0, 0};
+    uint8_t id3v1[128] = {'T', 'A', 'G'};
+
+    memcpy(&id3v2[21], "Title", 5);
+    snprintf(track->path, sizeof(track->path), "%s/track%d.mp3", dir, id);
+    track->size = sizeof(id3v2) + (frames + 1) * frame_size + sizeof(id3v1);
+    track->data = calloc(1, track->size);
+    if (!track->data) {
+        fprintf(stderr, "no mem\n");
+        exit(1);
+    }
+
+    uint8_t *p = track->data;
+    memcpy(p, id3v2, sizeof(id3v2));
+    p += sizeof(id3v2);
+    /* The Info frame, after the 32 byte side information of a stereo MPEG 1 frame: frames and bytes */
+    memcpy(p, header, 4);
+    memcpy(&p[4 + 32], "Info", 4);
+    put_be32(&p[4 + 32 + 4], 0x03);
+    put_be32(&p[4 + 32 + 8], frames);
+    put_be32(&p[4 + 32 + 12], frames * frame_size);
+    p += frame_size;
+    track->audio_start = p - track->data;
+    for (int i = 0; i < frames; i++, p += frame_size) {
+        memcpy(p, header, 4);
+        for (size_t j = 4; j < frame_size; j++) {
+            p[j] = (id * 61 + i * 7 + j) % 0xff;
+        }
+    }
+    track->audio_end = p - track->data;
+    memcpy(p, id3v1, sizeof(id3v1));
+
+    FILE *fp = fopen(track->path, "wb");
+    if (!fp || (1 != fwrite(track->data, track->size, 1, fp))) {
+        perror(track->path);
+        exit(1);
+    }
+    fclose(fp);
+}
+
+static void order_set(int count, const int *ids)
+{
+    s_order_len = count;
+    memcpy(s_order, ids, count * sizeof(int));
+}
+
+static bool next_cb(const char *current, char *next, size_t size, void *user_ctx)
+{
+    for (int i = 0; i + 1 < s_order_len; i++) {
+        if (0 == strcmp(current, s_tracks[s_order[i]].path)) {
+            snprintf(next, size, "%s", s_tracks[s_order[i + 1]].path);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void track_cb(const char *path, void *user_ctx)
+{
+    snprintf(s_changed, sizeof(s_changed), "%s", path);
+    s_changes++;
+}
+
+/* The output plays in real time, a write waits while more than OUTPUT_LEAD_MS is buffered */
+static esp_err_t output_write(void *audio_buffer, size_t len, size_t *bytes_written, uint32_t timeout_ms)
+{
+    int64_t now = esp_timer_get_time();
+
+    if (s_out_end_us > now + OUTPUT_LEAD_MS * 1000) {
+        vTaskDelay(pdMS_TO_TICKS((s_out_end_us - now) / 1000 - OUTPUT_LEAD_MS));
+        now = esp_timer_get_time();
+    }
+    s_out_end_us = ((s_out_end_us > now) ? s_out_end_us : now) + (int64_t)len / 4 * 1000000 / s_out_rate;
+    *bytes_written = len;
+    return ESP_OK;
+}
+
+static esp_err_t output_clk_set(uint32_t rate, uint32_t bits_cfg, i2s_slot_mode_t ch)
+{
+    s_out_rate = rate;
+    s_out_end_us = esp_timer_get_time();
+    s_clk_calls++;
+    return ESP_OK;
+}
+
+/* Files opened through the playlist, counted to find the ones never closed */
+static ssize_t file_read(void *cookie, char *buf, size_t size)
+{
+    return fread(buf, 1, size, (FILE *)cookie);
+}
+
+static int file_seek(void *cookie, off_t *offset, int whence)
+{
+    if (fseek((FILE *)cookie, *offset, whence)) {
+        return -1;
+    }
+    *offset = ftell((FILE *)cookie);
+    return 0;
+}
+
+static int file_close(void *cookie)
+{
+    xSemaphoreTake(s_files_lock, portMAX_DELAY);
+    s_files_open--;
+    xSemaphoreGive(s_files_lock);
+    return fclose((FILE *)cookie);
+}
+
+static FILE *file_open(const char *path)
+{
+    const cookie_io_functions_t functions = {
+        .read = file_read,
+        .seek = file_seek,
+        .close = file_close,
+    };
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        return NULL;
+    }
+    xSemaphoreTake(s_files_lock, portMAX_DELAY);
+    s_files_open++;
+    xSemaphoreGive(s_files_lock);
+    return fopencookie(fp, "rb", functions);
+}
+
+static int files_open(void)
+{
+    /* The playlist task closes the finished tracks */
+    vTaskDelay(pdMS_TO_TICKS(50));
+    xSemaphoreTake(s_files_lock, portMAX_DELAY);
+    int count = s_files_open;
+    xSemaphoreGive(s_files_lock);
+    return count;
+}
+
+/* Read the stream as the player does, writing a frame of PCM for each frame of MP3 if `decode` */
+static size_t play(FILE *fp, uint8_t *out, size_t size, bool decode)
+{
+    static uint8_t pcm[FRAME_PCM_BYTES];
+    uint8_t buf[FRAME_SIZE_44K];
+    size_t total = 0;
+    size_t n;
+
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        if (out && (total + n <= size)) {
+            memcpy(out + total, buf, n);
+        }
+        total += n;
+        if (decode) {
+            size_t written;
+            audio_playlist_write(pcm, sizeof(pcm), &written, portMAX_DELAY);
+        }
+    }
+    return total;
+}
+
+static void test_chain(void)
+{
+    const int order[] = {TRACK_A, TRACK_B, TRACK_C, TRACK_48K};
+    audio_playlist_stats_t before;
+    audio_playlist_stats_t stats;
+    size_t expected_size = s_tracks[TRACK_A].audio_end;
+
+    audio_playlist_get_stats(&before);
+    for (int i = TRACK_B; i <= TRACK_C; i++) {
+        expected_size += s_tracks[i].audio_end - s_tracks[i].audio_start;
+    }
+    uint8_t *expected = malloc(expected_size);
+    uint8_t *read = malloc(expected_size + 1);
+    if (!expected || !read) {
+        fprintf(stderr, "no mem\n");
+        exit(1);
+    }
+    /* The first track whole up to its ID3v1 tag, for the tags read by the player, then the audio frames only */
+    size_t offset = s_tracks[TRACK_A].audio_end;
+    memcpy(expected, s_tracks[TRACK_A].data, offset);
+    for (int i = TRACK_B; i <= TRACK_C; i++) {
+        size_t len = s_tracks[i].audio_end - s_tracks[i].audio_start;
+        memcpy(expected + offset, s_tracks[i].data + s_tracks[i].audio_start, len);
+        offset += len;
+    }
+
+    order_set(4, order);
+    s_changes = 0;
+    FILE *fp = audio_playlist_open(s_tracks[TRACK_A].path);
+    check(fp, "stream opened");
+    if (!fp) {
+        return;
+    }
+    size_t size = play(fp, read, expected_size + 1, false);
+    fclose(fp);
+    audio_playlist_get_stats(&stats);
+    check((size == expected_size) && !memcmp(read, expected, size),
+          "three tracks chained byte for byte, without their tags");
+    check((2 == s_changes) && !strcmp(s_changed, s_tracks[TRACK_C].path), "track callback at each change");
+    check(2 == stats.gapless - before.gapless, "48 kHz track declined, the stream ends");
+    check(0 == files_open(), "every track closed");
+    free(expected);
+    free(read);
+}
+
+static void test_chained_gap(void)
+{
+    const int order[] = {TRACK_A, TRACK_B};
+    audio_playlist_stats_t before;
+    audio_playlist_stats_t stats;
+
+    audio_playlist_get_stats(&before);
+    order_set(2, order);
+    FILE *fp = audio_playlist_open(s_tracks[TRACK_A].path);
+    audio_playlist_clk_set(FRAME_RATE_HZ, 16, I2S_SLOT_MODE_STEREO);
+    play(fp, NULL, 0, true);
+    fclose(fp);
+    audio_playlist_get_stats(&stats);
+    check(1 == stats.gapless - before.gapless, "chained change");
+    check((1 == stats.reclocks - before.reclocks) && (1 == s_clk_calls), "output clocked once");
+    /* A scheduling delay of the host beyond the lead of the output would show as a gap */
+    check(0 == stats.last_gap_samples, "no gap counted");
+    printf("  %-24s %6" PRIu32 " samples\n", "chained change gap", stats.last_gap_samples);
+}
+
+static void test_idle_gap(void)
+{
+    const int order_short[] = {TRACK_SHORT};
+    const int order_b[] = {TRACK_B};
+    audio_playlist_stats_t before;
+    audio_playlist_stats_t stats;
+    char what[80];
+
+    order_set(1, order_short);
+    FILE *fp = audio_playlist_open(s_tracks[TRACK_SHORT].path);
+    audio_playlist_clk_set(FRAME_RATE_HZ, 16, I2S_SLOT_MODE_STEREO);
+    play(fp, NULL, 0, true);
+    fclose(fp);
+
+    /* The idle event starts the next track, the player restarts its decoder */
+    audio_playlist_get_stats(&before);
+    vTaskDelay(pdMS_TO_TICKS(RESTART_MS));
+    order_set(1, order_b);
+    fp = audio_playlist_open(s_tracks[TRACK_B].path);
+    audio_playlist_clk_set(FRAME_RATE_HZ, 16, I2S_SLOT_MODE_STEREO);
+    play(fp, NULL, 0, true);
+    fclose(fp);
+    audio_playlist_get_stats(&stats);
+    check((1 == stats.skipped_reclocks - before.skipped_reclocks) && (stats.reclocks == before.reclocks),
+          "clock request with the running format skipped");
+    /* The restart less what the output still played, the lead and at most one more frame, plus host scheduling */
+    uint32_t min = (RESTART_MS - 2 * OUTPUT_LEAD_MS) * FRAME_RATE_HZ / 1000;
+    uint32_t max = (RESTART_MS + OUTPUT_LEAD_MS) * FRAME_RATE_HZ / 1000;
+    snprintf(what, sizeof(what), "gap of the decoder restart, %" PRIu32 " to %" PRIu32 " samples", min, max);
+    check((stats.last_gap_samples >= min) && (stats.last_gap_samples <= max), what);
+    check(stats.max_gap_samples >= stats.last_gap_samples, "largest gap kept");
+    printf("  %-24s %6" PRIu32 " samples, %" PRIu32 " ms\n", "idle change gap", stats.last_gap_samples,
+           stats.last_gap_samples * 1000 / FRAME_RATE_HZ);
+}
+
+static void test_close(void)
+{
+    const int order[] = {TRACK_A, TRACK_B};
+    uint8_t buf[100];
+
+    order_set(2, order);
+    FILE *fp = audio_playlist_open(s_tracks[TRACK_A].path);
+    fread(buf, 1, sizeof(buf), fp);
+    /* Long enough for the playlist task to prepare the next track */
+    vTaskDelay(pdMS_TO_TICKS(100));
+    check(2 == files_open(), "next track prepared");
+    fclose(fp);
+    check(0 == files_open(), "closing the stream closes the next track");
+
+    fp = audio_playlist_open(s_tracks[TRACK_A].path);
+    fclose(fp);
+    check(0 == files_open(), "closing while the next track is prepared");
+
+    check(!audio_playlist_open("/nonexistent/track.mp3"), "missing track");
+}
+
+int main(int argc, char **argv)
+{
+    audio_playlist_config_t config = {
+        .write_fn = output_write,
+        .clk_set_fn = output_clk_set,
+        .open_fn = file_open,
+        .next_cb = next_cb,
+        .track_cb = track_cb,
+        .task_priority = 2,
+        .task_core = tskNO_AFFINITY,
+    };
+    audio_playlist_stats_t stats;
+    char dir[] = "/tmp/audio_playlist_test.XXXXXX";
+    bool verbose = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    /* The missing track logs errors on purpose */
+    port_log_level = verbose ? ESP_LOG_INFO : ESP_LOG_NONE;
+
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    track_write(dir, TRACK_A, false, 45);
+    track_write(dir, TRACK_B, false, 50);
+    track_write(dir, TRACK_C, false, 42);
+    track_write(dir, TRACK_48K, true, 45);
+    track_write(dir, TRACK_SHORT, false, 8);
+    s_files_lock = xSemaphoreCreateMutex();
+
+    printf("Initialization\n");
+    check(ESP_ERR_INVALID_STATE == audio_playlist_get_stats(&stats), "no statistics before");
+    check(ESP_OK == audio_playlist_init(&config), "initialized");
+    check(ESP_ERR_INVALID_STATE == audio_playlist_init(&config), "initialized once only");
+    printf("\nChained tracks\n");
+    test_chain();
+    printf("\nOutput starvation\n");
+    test_chained_gap();
+    test_idle_gap();
+    printf("\nClose\n");
+    test_close();
+
+    for (int i = 0; i < TRACK_NUM; i++) {
+        unlink(s_tracks[i].path);
+        free(s_tracks[i].data);
+    }
+    rmdir(dir);
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,371 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "bsp_board.h"
+#include "bsp_storage.h"
+#include "bsp_board_priv.h"
+
+#define TEST_RATE           (16000)
+#define TEST_MIC_FRAMES     (TEST_RATE * 6 / 10)    /* 0.6 s of mono input */
+#define TEST_CHUNK_FRAMES   (480)                   /* 30 ms, as the feed task reads */
+#define TEST_READ_CHUNKS    (34)                    /* 1.02 s, past the end of the input */
+#define TEST_PLAY_CHUNKS    (10)                    /* 0.3 s of stereo playback */
+#define TEST_LATE_MS        (200)                   /* Longer than the 90 ms I2S DMA buffer */
+
+static int s_failures;
+static char s_dir[] = "/tmp/bsp_linux_test.XXXXXX";
+static int s_button_events[BSP_BUTTON_NUM][BUTTON_EVENT_MAX];
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-56s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+static const char *test_path(const char *name)
+{
+    static char path[4][256];
+    static int next;
+    char *p = path[next++ % 4];
+    snprintf(p, sizeof(path[0]), "%s/%s", s_dir, name);
+    return p;
+}
+
+static void put_le(uint8_t *p, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++) {
+        p[i] = value >> (8 * i);
+    }
+}
+
+static uint32_t get_le(const uint8_t *p, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--) {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+static int16_t mic_sample(size_t frame)
+{
+    return (int16_t)(frame * 7);
+}
+
+/* A mono WAV input, with a chunk before the format as some recorders write */
+static void write_mic(const char *path)
+{
+    uint8_t header[12 + 8 + 4 + 8 + 16 + 8];
+    uint8_t *p = header;
+    memcpy(p, "RIFF", 4);
+    put_le(p + 4, sizeof(header) - 8 + TEST_MIC_FRAMES * 2, 4);
+    memcpy(p + 8, "WAVE", 4);
+    p += 12;
+    memcpy(p, "LIST", 4);
+    put_le(p + 4, 4, 4);
+    memcpy(p + 8, "INFO", 4);
+    p += 12;
+    memcpy(p, "fmt ", 4);
+    put_le(p + 4, 16, 4);
+    put_le(p + 8, 1, 2);
+    put_le(p + 10, 1, 2);
+    put_le(p + 12, TEST_RATE, 4);
+    put_le(p + 16, TEST_RATE * 2, 4);
+    put_le(p + 20, 2, 2);
+    put_le(p + 22, 16, 2);
+    p += 24;
+    memcpy(p, "data", 4);
+    put_le(p + 4, TEST_MIC_FRAMES * 2, 4);
+
+    FILE *fp = fopen(path, "wb");
+    fwrite(header, 1, sizeof(header), fp);
+    for (size_t i = 0; i < TEST_MIC_FRAMES; i++) {
+        uint8_t sample[2];
+        put_le(sample, (uint16_t)mic_sample(i), 2);
+        fwrite(sample, 1, sizeof(sample), fp);
+    }
+    fclose(fp);
+}
+
+static void write_text(const char *path, const char *text)
+{
+    FILE *fp = fopen(path, "w");
+    fputs(text, fp);
+    fclose(fp);
+}
+
+static void button_cb(void *button_handle, void *usr_data)
+{
+    const int id = (int)(intptr_t)usr_data;
+    s_button_events[id / BUTTON_EVENT_MAX][id % BUTTON_EVENT_MAX]++;
+}
+
+static void test_mic(void)
+{
+    int16_t buf[TEST_CHUNK_FRAMES * 2];
+    size_t bytes_read = 0;
+    bool data_ok = true;
+    bool silence_ok = true;
+
+    printf("\nMicrophone, mono WAV input read as 16 kHz stereo\n");
+    const double start = now_s();
+    for (size_t c = 0; c < TEST_READ_CHUNKS; c++) {
+        bsp_i2s_read(buf, sizeof(buf), &bytes_read, portMAX_DELAY);
+        for (size_t i = 0; i < TEST_CHUNK_FRAMES; i++) {
+            const size_t frame = c * TEST_CHUNK_FRAMES + i;
+            const int16_t want = (frame < TEST_MIC_FRAMES) ? mic_sample(frame) : 0;
+            data_ok &= (frame >= TEST_MIC_FRAMES) || ((buf[2 * i] == want) && (buf[2 * i + 1] == want));
+            silence_ok &= (frame < TEST_MIC_FRAMES) || (!buf[2 * i] && !buf[2 * i + 1]);
+        }
+    }
+    /* The first chunk is due at once, the others once their last sample was captured */
+    const double elapsed = now_s() - start;
+    const double expected = (TEST_READ_CHUNKS - 1) * (double)TEST_CHUNK_FRAMES / TEST_RATE;
+
+    bsp_linux_audio_stats_t stats;
+    bsp_linux_get_audio_stats(false, &stats);
+    check(bytes_read == sizeof(buf), "every read returns the full chunk");
+    check(data_ok, "samples of the input on both channels");
+    check(silence_ok && stats.eof, "silence and end of input after it");
+    char what[96];
+    snprintf(what, sizeof(what), "paced at the sample rate, %.3f s for %.3f s", elapsed, expected);
+    check((elapsed > expected - 0.02) && (elapsed < expected + 0.25), what);
+    check((0 == stats.overruns) && (TEST_READ_CHUNKS == stats.calls), "no overrun while read in time");
+
+    vTaskDelay(pdMS_TO_TICKS(TEST_LATE_MS));
+    bsp_i2s_read(buf, sizeof(buf), &bytes_read, portMAX_DELAY);
+    bsp_linux_get_audio_stats(false, &stats);
+    /* Late by the delay, less the chunk which was being captured meanwhile */
+    const uint32_t late_us = TEST_LATE_MS * 1000 - TEST_CHUNK_FRAMES * 1000000 / TEST_RATE;
+    check((1 == stats.overruns) && (stats.max_late_us >= late_us) && (stats.max_late_us < late_us + 50000),
+          "a late read is an overrun");
+
+    /* A stopped codec is no overrun */
+    bsp_codec_dev_stop();
+    vTaskDelay(pdMS_TO_TICKS(TEST_LATE_MS));
+    bsp_codec_dev_resume();
+    bsp_i2s_read(buf, sizeof(buf), &bytes_read, portMAX_DELAY);
+    bsp_linux_get_audio_stats(false, &stats);
+    check(1 == stats.overruns, "no overrun across stop and resume");
+}
+
+static bool check_wav(const char *path, uint32_t rate, uint32_t channels, uint32_t frames, int16_t (*sample)(size_t, int))
+{
+    FILE *fp = fopen(path, "rb");
+    if (NULL == fp) {
+        return false;
+    }
+    uint8_t header[44];
+    bool ok = (sizeof(header) == fread(header, 1, sizeof(header), fp));
+    ok = ok && !memcmp(header, "RIFF", 4) && !memcmp(header + 8, "WAVEfmt ", 8) && !memcmp(header + 36, "data", 4);
+    ok = ok && (get_le(header + 22, 2) == channels) && (get_le(header + 24, 4) == rate) && (get_le(header + 34, 2) == 16);
+    ok = ok && (get_le(header + 40, 4) == frames * channels * 2) && (get_le(header + 4, 4) == 36 + frames * channels * 2);
+    for (size_t i = 0; ok && (i < frames); i++) {
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            uint8_t s[2];
+            ok = (sizeof(s) == fread(s, 1, sizeof(s), fp)) && ((int16_t)get_le(s, 2) == sample(i, ch));
+        }
+    }
+    uint8_t extra;
+    ok = ok && (0 == fread(&extra, 1, 1, fp));
+    fclose(fp);
+    return ok;
+}
+
+static int16_t play_sample(size_t frame, int ch)
+{
+    return (int16_t)((frame * 13 + ch * 1000) % 20000 - 10000);
+}
+
+static int16_t half_play_sample(size_t frame, int ch)
+{
+    return play_sample(frame, ch) * 50 / 100;
+}
+
+static int16_t zero_sample(size_t frame, int ch)
+{
+    return 0;
+}
+
+static void test_speaker(void)
+{
+    int16_t buf[TEST_CHUNK_FRAMES * 2];
+    size_t bytes_written = 0;
+    int volume = 0;
+
+    printf("\nSpeaker\n");
+    bsp_codec_volume_set(50, &volume);
+    const double start = now_s();
+    for (size_t c = 0; c < TEST_PLAY_CHUNKS; c++) {
+        for (size_t i = 0; i < TEST_CHUNK_FRAMES; i++) {
+            buf[2 * i] = play_sample(c * TEST_CHUNK_FRAMES + i, 0);
+            buf[2 * i + 1] = play_sample(c * TEST_CHUNK_FRAMES + i, 1);
+        }
+        bsp_i2s_write(buf, sizeof(buf), &bytes_written, portMAX_DELAY);
+    }
+    /* Data is taken once it fits in the DMA buffer of 1440 frames */
+    const double elapsed = now_s() - start;
+    const double expected = (TEST_PLAY_CHUNKS * TEST_CHUNK_FRAMES - 1440.0) / TEST_RATE;
+    char what[96];
+    snprintf(what, sizeof(what), "paced at the sample rate, %.3f s for %.3f s", elapsed, expected);
+    check((elapsed > expected - 0.02) && (elapsed < expected + 0.25), what);
+
+    /* A new format starts a new file, muted here */
+    memset(buf, 0x55, sizeof(buf));
+    bsp_codec_set_fs(22050, 16, I2S_SLOT_MODE_MONO);
+    bsp_codec_mute_set(true);
+    bsp_i2s_write(buf, TEST_CHUNK_FRAMES * sizeof(int16_t), &bytes_written, portMAX_DELAY);
+    bsp_codec_mute_set(false);
+    bsp_linux_audio_close();
+
+    bsp_linux_audio_stats_t stats;
+    bsp_linux_get_audio_stats(true, &stats);
+    check((50 == volume) && check_wav(test_path("speaker.wav"), TEST_RATE, 2, TEST_PLAY_CHUNKS * TEST_CHUNK_FRAMES,
+                                      half_play_sample), "WAV output at half volume");
+    check(check_wav(test_path("speaker_1.wav"), 22050, 1, TEST_CHUNK_FRAMES, zero_sample),
+          "new format in a new WAV file, muted");
+    check((TEST_PLAY_CHUNKS + 1 == stats.calls) && (0 == stats.overruns), "no overrun while written in time");
+}
+
+static void test_script(void)
+{
+    bsp_bottom_property_t *bottom = bsp_board_get_sensor_handle();
+    float temperature = 0, humidity = 0;
+
+    printf("\nScript\n");
+    check(1 == s_button_events[BSP_BUTTON_MAIN][BUTTON_PRESS_DOWN] &&
+          1 == s_button_events[BSP_BUTTON_MAIN][BUTTON_PRESS_UP] &&
+          1 == s_button_events[BSP_BUTTON_MAIN][BUTTON_SINGLE_CLICK], "click: press down, press up, single click");
+    check(1 == s_button_events[BSP_BUTTON_CONFIG][BUTTON_DOUBLE_CLICK] &&
+          0 == s_button_events[BSP_BUTTON_CONFIG][BUTTON_SINGLE_CLICK], "double click");
+    check(0 == s_button_events[BSP_BUTTON_MAIN][BUTTON_LONG_PRESS_START], "removed callback not called");
+    check(BOTTOM_ID_SENSOR == bottom->get_bottom_id(), "bottom attached");
+    check((ESP_OK == bottom->get_humiture(&temperature, &humidity)) && (25.5f == temperature) && (40.0f == humidity),
+          "humiture of the sensor bottom");
+    check(!bottom->get_radar_status(), "radar off until enabled");
+    bottom->set_radar_enable(true);
+    check(bottom->get_radar_status(), "radar level once enabled");
+    check(bottom->get_sleep_mode(), "sleep mode");
+}
+
+static void test_sdcard(void)
+{
+    bsp_sdcard_config_t config = BSP_SDCARD_CONFIG_DEFAULT();
+    struct stat st;
+
+    printf("\nSD card\n");
+    config.mount_point = test_path("mnt");
+    config.max_files = 0;
+    check(ESP_ERR_INVALID_ARG == bsp_sdcard_init_with_config(&config), "invalid config rejected");
+    config.max_files = 5;
+    check(ESP_OK == bsp_sdcard_init_with_config(&config), "mounted");
+    write_text(test_path("mnt/note.txt"), "box");
+    check(0 == stat(test_path("card/note.txt"), &st), "file written at the mount point is in the directory");
+    check(ESP_OK == bsp_sdcard_deinit((char *)config.mount_point) && (0 != lstat(config.mount_point, &st)),
+          "unmounted, mount point removed");
+}
+
+static void remove_dir(const char *path)
+{
+    DIR *p_dir = opendir(path);
+    struct dirent *p_dirent;
+    char name[512];
+    while (p_dir && (p_dirent = readdir(p_dir)) != NULL) {
+        if (strcmp(p_dirent->d_name, ".") && strcmp(p_dirent->d_name, "..")) {
+            snprintf(name, sizeof(name), "%s/%s", path, p_dirent->d_name);
+            (p_dirent->d_type == DT_DIR) ? remove_dir(name) : (void)unlink(name);
+        }
+    }
+    if (p_dir) {
+        closedir(p_dir);
+    }
+    rmdir(path);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+        case 'v':
+            port_log_level = ESP_LOG_DEBUG;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (!mkdtemp(s_dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    /* Events land while the audio tests run, the bottom is attached after the first humiture check */
+    write_mic(test_path("mic.wav"));
+    write_text(test_path("script.txt"),
+               "# ms event\n"
+               "100 button main click\n"
+               "150 button config double_click\n"
+               "160 button main long_press_start\n"
+               "300 bottom sensor\n"
+               "300 humiture 25.5 40\n"
+               "350 radar 1\n"
+               "400 sleep 1\n");
+    setenv("BSP_LINUX_MIC", test_path("mic.wav"), 1);
+    setenv("BSP_LINUX_SPEAKER", test_path("speaker.wav"), 1);
+    setenv("BSP_LINUX_SCRIPT", test_path("script.txt"), 1);
+    setenv("BSP_LINUX_SDCARD", test_path("card"), 1);
+    setenv("BSP_LINUX_REALTIME", "1", 1);
+
+    printf("Linux host BSP in %s\n", s_dir);
+    if (ESP_OK != bsp_board_init()) {
+        return 1;
+    }
+    const int events[] = {BUTTON_PRESS_DOWN, BUTTON_PRESS_UP, BUTTON_SINGLE_CLICK, BUTTON_DOUBLE_CLICK,
+                          BUTTON_LONG_PRESS_START
+                         };
+    for (int btn = 0; btn < BSP_BUTTON_NUM; btn++) {
+        for (size_t i = 0; i < sizeof(events) / sizeof(events[0]); i++) {
+            bsp_btn_register_callback(btn, events[i], button_cb, (void *)(intptr_t)(btn * BUTTON_EVENT_MAX + events[i]));
+        }
+    }
+    bsp_btn_rm_event_callback(BSP_BUTTON_MAIN, BUTTON_LONG_PRESS_START);
+
+    float temperature, humidity;
+    printf("\nBoard\n");
+    check(0 == strcmp("LINUX_HOST", bsp_board_get_info()->name), "board name");
+    check(ESP_FAIL == bsp_board_get_sensor_handle()->get_humiture(&temperature, &humidity),
+          "no humiture before the bottom is attached");
+
+    test_mic();
+    test_speaker();
+    test_script();
+    test_sdcard();
+
+    remove_dir(s_dir);
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,15 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/* The defaults of the "Linux Host Configuration" menu, the test sets the environment variables */
+#define CONFIG_IDF_TARGET_LINUX     1
+#define CONFIG_BSP_LINUX_MIC        "mic.wav"
+#define CONFIG_BSP_LINUX_SPEAKER    "speaker.wav"
+#define CONFIG_BSP_LINUX_SCRIPT     ""
+#define CONFIG_BSP_LINUX_SDCARD     "sdcard"
+#define CONFIG_BSP_LINUX_REALTIME   1
@@ -0,0 +1,255 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "bsp_power.h"
+
+#define TEST_HOOKS          (5)
+#define TEST_MAX_HOOKS      (12)        /* POWER_MAX_HOOKS of bsp_power.c */
+/* Margin over the longest chain, for the scheduling of the host */
+#define TEST_MARGIN_MS      (60)
+
+/* The hooks of the sensor bottom sleep path, with synthetic resume times */
+typedef enum {
+    HOOK_PM,
+    HOOK_DISPLAY,
+    HOOK_BUTTON,
+    HOOK_CODEC,
+    HOOK_LVGL,
+} hook_id_t;
+
+typedef struct {
+    const char *name;
+    uint32_t resume_ms;
+    int deps[2];                        /* -1 terminated */
+    bsp_power_milestone_t milestone;
+    bsp_power_hook_handle_t handle;
+    esp_err_t suspend_result;
+    esp_err_t resume_result;
+    int64_t start_us;
+    int64_t done_us;
+} hook_t;
+
+static hook_t s_hooks[TEST_HOOKS] = {
+    [HOOK_PM] = { "pm", 20, {-1}, BSP_POWER_MILESTONE_NONE },
+    [HOOK_DISPLAY] = { "display", 100, {HOOK_PM, -1}, BSP_POWER_MILESTONE_NONE },
+    [HOOK_BUTTON] = { "button", 10, {HOOK_PM, -1}, BSP_POWER_MILESTONE_NONE },
+    [HOOK_CODEC] = { "codec", 80, {HOOK_PM, -1}, BSP_POWER_MILESTONE_AUDIO_READY },
+    [HOOK_LVGL] = { "lvgl", 60, {HOOK_DISPLAY, -1}, BSP_POWER_MILESTONE_FIRST_FRAME },
+};
+
+static SemaphoreHandle_t s_lock;
+static int s_suspended[TEST_HOOKS];
+static int s_suspend_count;
+static int s_failures;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-56s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+static esp_err_t hook_suspend(void *user_ctx)
+{
+    hook_t *hook = (hook_t *)user_ctx;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_suspend_count < TEST_HOOKS) {
+        s_suspended[s_suspend_count++] = hook - s_hooks;
+    }
+    xSemaphoreGive(s_lock);
+    return hook->suspend_result;
+}
+
+static esp_err_t hook_resume(void *user_ctx)
+{
+    hook_t *hook = (hook_t *)user_ctx;
+
+    hook->start_us = esp_timer_get_time();
+    vTaskDelay(pdMS_TO_TICKS(hook->resume_ms));
+    hook->done_us = esp_timer_get_time();
+    return hook->resume_result;
+}
+
+static void register_hooks(void)
+{
+    bool ok = true;
+
+    for (int i = 0; i < TEST_HOOKS; i++) {
+        bsp_power_hook_config_t config = {
+            .name = s_hooks[i].name,
+            .suspend = hook_suspend,
+            .resume = hook_resume,
+            .user_ctx = &s_hooks[i],
+            .milestone = s_hooks[i].milestone,
+        };
+        for (int d = 0; s_hooks[i].deps[d] >= 0; d++) {
+            config.depends_on[d] = s_hooks[s_hooks[i].deps[d]].handle;
+        }
+        ok &= (ESP_OK == bsp_power_register_hook(&config, &s_hooks[i].handle));
+    }
+    check(ok, "sensor bottom hooks registered");
+}
+
+static uint32_t longest_chain_ms(int id)
+{
+    uint32_t longest = 0;
+
+    for (int d = 0; s_hooks[id].deps[d] >= 0; d++) {
+        uint32_t chain = longest_chain_ms(s_hooks[id].deps[d]);
+        longest = (chain > longest) ? chain : longest;
+    }
+    return longest + s_hooks[id].resume_ms;
+}
+
+static bool deps_done_before_start(void)
+{
+    for (int i = 0; i < TEST_HOOKS; i++) {
+        for (int d = 0; s_hooks[i].deps[d] >= 0; d++) {
+            if (s_hooks[s_hooks[i].deps[d]].done_us > s_hooks[i].start_us) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void test_suspend(void)
+{
+    bool reversed = true;
+
+    s_suspend_count = 0;
+    check(ESP_OK == bsp_power_suspend(), "suspend");
+    for (int i = 0; i < TEST_HOOKS; i++) {
+        reversed &= (s_suspend_count == TEST_HOOKS) && (s_suspended[i] == TEST_HOOKS - 1 - i);
+    }
+    check(reversed, "dependents suspended before their dependencies");
+}
+
+static void test_resume(void)
+{
+    bsp_power_wake_stats_t stats;
+    uint32_t sum_ms = 0;
+    uint32_t chain_ms = longest_chain_ms(HOOK_LVGL);
+    char what[80];
+
+    for (int i = 0; i < TEST_HOOKS; i++) {
+        sum_ms += s_hooks[i].resume_ms;
+    }
+    check(ESP_OK == bsp_power_resume(0), "resume");
+    check(deps_done_before_start(), "every hook resumed after its dependencies");
+    bsp_power_get_wake_stats(&stats);
+    snprintf(what, sizeof(what), "total of the longest chain, %" PRIu32 " ms, not the sum, %" PRIu32 " ms",
+             chain_ms, sum_ms);
+    check((stats.last_total_us >= chain_ms * 1000) && (stats.last_total_us < (chain_ms + TEST_MARGIN_MS) * 1000),
+          what);
+    printf("  %-24s %6" PRIu32 " ms\n", "resume", stats.last_total_us / 1000);
+
+    uint32_t frame_us = stats.last_us[BSP_POWER_MILESTONE_FIRST_FRAME];
+    uint32_t audio_us = stats.last_us[BSP_POWER_MILESTONE_AUDIO_READY];
+    check((frame_us >= chain_ms * 1000) && (frame_us <= stats.last_total_us), "first frame after lvgl resumed");
+    check((audio_us >= longest_chain_ms(HOOK_CODEC) * 1000) && (audio_us < frame_us),
+          "audio ready after the codec, before the first frame");
+    printf("  %-24s %6" PRIu32 " ms\n  %-24s %6" PRIu32 " ms\n", "first frame", frame_us / 1000, "audio ready",
+           audio_us / 1000);
+
+    /* A wake up reported 50 ms before the call, as the radar interrupt timestamp */
+    check(ESP_OK == bsp_power_resume(esp_timer_get_time() - 50000), "resume from an earlier wake up");
+    bsp_power_get_wake_stats(&stats);
+    check(stats.last_us[BSP_POWER_MILESTONE_FIRST_FRAME] >= (chain_ms + 50) * 1000,
+          "latencies measured from the wake up");
+    check((2 == stats.wakes) && (stats.max_us[BSP_POWER_MILESTONE_FIRST_FRAME] >=
+                                 stats.last_us[BSP_POWER_MILESTONE_FIRST_FRAME]), "wakes counted, worst kept");
+}
+
+static void test_failures(void)
+{
+    s_hooks[HOOK_DISPLAY].resume_result = ESP_ERR_TIMEOUT;
+    s_hooks[HOOK_LVGL].done_us = 0;
+    check(ESP_ERR_TIMEOUT == bsp_power_resume(0), "failed resume returns the error");
+    check(s_hooks[HOOK_LVGL].done_us && deps_done_before_start(), "dependents of the failed hook resumed");
+    s_hooks[HOOK_DISPLAY].resume_result = ESP_OK;
+
+    s_hooks[HOOK_CODEC].suspend_result = ESP_ERR_INVALID_STATE;
+    s_hooks[HOOK_PM].suspend_result = ESP_FAIL;
+    s_suspend_count = 0;
+    check(ESP_ERR_INVALID_STATE == bsp_power_suspend(), "failed suspend returns the first error");
+    check(TEST_HOOKS == s_suspend_count, "the other hooks suspended");
+    s_hooks[HOOK_CODEC].suspend_result = ESP_OK;
+    s_hooks[HOOK_PM].suspend_result = ESP_OK;
+}
+
+static void test_invalid(void)
+{
+    bsp_power_hook_config_t config = { .name = "orphan" };
+    bsp_power_hook_handle_t hook = NULL;
+    esp_err_t err = ESP_OK;
+    int count = TEST_HOOKS;
+
+    config.depends_on[0] = (bsp_power_hook_handle_t)&config;
+    check(ESP_ERR_INVALID_ARG == bsp_power_register_hook(&config, NULL), "dependency not registered");
+    config = (bsp_power_hook_config_t) {
+        .milestone = BSP_POWER_MILESTONE_MAX,
+    };
+    check(ESP_ERR_INVALID_ARG == bsp_power_register_hook(&config, NULL), "hook without a name");
+    check(ESP_ERR_INVALID_ARG == bsp_power_register_hook(NULL, NULL), "no configuration");
+
+    /* Hooks without callbacks, they change nothing but the count */
+    config = (bsp_power_hook_config_t) {
+        .name = "empty",
+    };
+    while ((ESP_OK == (err = bsp_power_register_hook(&config, &hook))) && (count < 2 * TEST_MAX_HOOKS)) {
+        count++;
+    }
+    check((ESP_ERR_NO_MEM == err) && (TEST_MAX_HOOKS == count), "registration beyond the table rejected");
+    check(ESP_OK == bsp_power_resume(0), "hooks without callbacks resumed");
+}
+
+int main(int argc, char **argv)
+{
+    bsp_power_wake_stats_t stats;
+    bool verbose = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    /* The failing hooks log warnings on purpose */
+    port_log_level = verbose ? ESP_LOG_DEBUG : ESP_LOG_NONE;
+    s_lock = xSemaphoreCreateMutex();
+
+    printf("Before registration\n");
+    check(ESP_ERR_INVALID_STATE == bsp_power_get_wake_stats(&stats), "no statistics");
+    check(ESP_ERR_INVALID_STATE == bsp_power_resume(0), "nothing to resume");
+    printf("\nSensor bottom hooks\n");
+    register_hooks();
+    test_suspend();
+    test_resume();
+    printf("\nFailing hooks\n");
+    test_failures();
+    printf("\nInvalid arguments\n");
+    test_invalid();
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,252 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "dir_index.h"
+
+#define BENCH_FILES         (4500)
+#define BENCH_LOOKUPS       (100000)
+#define BENCH_RUNS          (20)
+#define LEGACY_NAME_MAX     (127)
+
+static int s_failures;
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-44s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+static void touch(const char *dir, const char *name)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        perror(path);
+        exit(1);
+    }
+    fclose(fp);
+}
+
+/*
+ * The file table as file_manager builds it: a pointer array and one fixed size name buffer per file, filled by a
+ * second pass over the directory. Returns the number of allocations.
+ */
+static size_t legacy_table(const char *path, char ***list_out, size_t *count_out, size_t *bytes)
+{
+    DIR *p_dir = opendir(path);
+    struct dirent *p_dirent;
+    size_t count = 0;
+
+    while ((p_dirent = readdir(p_dir)) != NULL) {
+        count += (p_dirent->d_type == DT_REG);
+    }
+    rewinddir(p_dir);
+    char **list = calloc(count, sizeof(char *));
+    for (size_t i = 0; i < count; i++) {
+        list[i] = malloc(LEGACY_NAME_MAX);
+    }
+    size_t index = 0;
+    while ((p_dirent = readdir(p_dir)) != NULL && index < count) {
+        if (p_dirent->d_type == DT_REG) {
+            /* Cut to the fixed size, as the table of file_manager.c does */
+            size_t len = strnlen(p_dirent->d_name, LEGACY_NAME_MAX - 1);
+            memcpy(list[index], p_dirent->d_name, len);
+            list[index][len] = '\0';
+            index++;
+        }
+    }
+    closedir(p_dir);
+    *list_out = list;
+    *count_out = index;
+    *bytes = count * (sizeof(char *) + LEGACY_NAME_MAX);
+    return count + 1;
+}
+
+static void legacy_free(char **list, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        free(list[i]);
+    }
+    free(list);
+}
+
+static double time_refresh(dir_index_handle_t index, bool *changed)
+{
+    double start = now_us();
+    if (ESP_OK != dir_index_refresh(index, changed)) {
+        fprintf(stderr, "refresh failed\n");
+        exit(1);
+    }
+    return now_us() - start;
+}
+
+int main(int argc, char **argv)
+{
+    int files = BENCH_FILES;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:v")) != -1) {
+        switch (opt) {
+        case 'n':
+            files = atoi(optarg);
+            break;
+        case 'v':
+            port_log_level = ESP_LOG_DEBUG;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n <files>] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (files < 2) {
+        fprintf(stderr, "at least 2 files\n");
+        return 2;
+    }
+
+    char dir[] = "/tmp/dir_index_bench.XXXXXX";
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    /* Mostly mp3 files with a name length typical of music, and a few others */
+    char name[128];
+    for (int i = 0; i < files; i++) {
+        snprintf(name, sizeof(name), "%04d - Artist %d - Track title %d.%s", (i * 7919) % files, i % 97, i,
+                 (i % 10) ? "mp3" : "MP3");
+        touch(dir, name);
+    }
+    touch(dir, "cover.jpg");
+    touch(dir, "notes.mp3.bak");
+    mkdir(strcat(strcpy(name, dir), "/folder.mp3"), 0755);
+    printf("%d mp3 files in %s\n", files, dir);
+
+    /* The listing file_manager used to build */
+    char **list;
+    size_t list_count, list_bytes;
+    double legacy_us = 0;
+    size_t allocs = 0;
+    for (int r = 0; r < BENCH_RUNS; r++) {
+        double start = now_us();
+        allocs = legacy_table(dir, &list, &list_count, &list_bytes);
+        legacy_us += now_us() - start;
+        if (r < BENCH_RUNS - 1) {
+            legacy_free(list, list_count);
+        }
+    }
+
+    const dir_index_config_t config = {
+        .path = dir,
+        .suffix = ".mp3",
+        .sort = true,
+    };
+    dir_index_handle_t index;
+    bool changed = false;
+    if (ESP_OK != dir_index_new(&config, &index)) {
+        return 1;
+    }
+    double first_us = time_refresh(index, &changed);
+    bool first_changed = changed;
+    double same_us = 0;
+    bool any_changed = false;
+    for (int r = 0; r < BENCH_RUNS; r++) {
+        same_us += time_refresh(index, &changed);
+        any_changed |= changed;
+    }
+
+    printf("\nScan, mean of %d\n", BENCH_RUNS);
+    printf("  file table, one buffer per name %10.0f us %8zu bytes %6zu allocations\n", legacy_us / BENCH_RUNS,
+           list_bytes, allocs);
+    /* The handle, path, suffix, name pool, entries and name order */
+    printf("  index, first scan and sort      %10.0f us %8zu bytes %6d allocations\n", first_us,
+           dir_index_get_mem_size(index), 6);
+    printf("  index, rescan, unchanged        %10.0f us\n", same_us / BENCH_RUNS);
+
+    /* Lookups by name, as the player does for the file it plays */
+    double start = now_us();
+    size_t found = 0;
+    for (int i = 0; i < BENCH_LOOKUPS; i++) {
+        const char *wanted = dir_index_get_name(index, (i * 7919u) % files);
+        for (size_t j = 0; j < list_count; j++) {
+            if (0 == strcasecmp(list[j], wanted)) {
+                found++;
+                break;
+            }
+        }
+    }
+    double linear_us = now_us() - start;
+    start = now_us();
+    size_t found_index = 0;
+    for (int i = 0; i < BENCH_LOOKUPS; i++) {
+        found_index += (dir_index_find(index, dir_index_get_name(index, (i * 7919u) % files)) >= 0);
+    }
+    double find_us = now_us() - start;
+    printf("\nLookup by name, %d lookups\n", BENCH_LOOKUPS);
+    printf("  linear scan of the file table   %10.3f us per lookup\n", linear_us / BENCH_LOOKUPS);
+    printf("  index binary search             %10.3f us per lookup\n", find_us / BENCH_LOOKUPS);
+
+    printf("\nChecks\n");
+    check(first_changed, "first scan reports a change");
+    check(!any_changed, "unchanged directory reports no change");
+    check(dir_index_count(index) == (size_t)files, "only regular files ending with .mp3 indexed");
+    check(dir_index_find(index, "notes.mp3.bak") < 0 && dir_index_find(index, "folder.mp3") < 0,
+          "\"notes.mp3.bak\" and the directory \"folder.mp3\" left out");
+    check(found == BENCH_LOOKUPS && found_index == found, "every name found by both lookups");
+
+    bool sorted = true;
+    for (size_t i = 1; i < dir_index_count(index); i++) {
+        sorted &= strcasecmp(dir_index_get_sorted_name(index, i - 1), dir_index_get_sorted_name(index, i)) <= 0;
+    }
+    check(sorted, "name order sorted");
+
+    /* Renaming a file keeps the count, and on FATFS the directory modification time */
+    char from[512], to[512];
+    snprintf(from, sizeof(from), "%s/%s", dir, dir_index_get_sorted_name(index, 0));
+    snprintf(to, sizeof(to), "%s/zzz renamed.mp3", dir);
+    rename(from, to);
+    time_refresh(index, &changed);
+    check(changed && dir_index_find(index, "zzz renamed.mp3") == (int)files - 1, "rename seen, name order updated");
+    unlink(to);
+    time_refresh(index, &changed);
+    check(changed && dir_index_count(index) == (size_t)files - 1, "removed file seen");
+    touch(dir, "ZZZ new.mp3");
+    time_refresh(index, &changed);
+    check(changed && dir_index_find(index, "zzz NEW.mp3") >= 0, "added file seen, found case insensitively");
+
+    dir_index_del(index);
+    legacy_free(list, list_count);
+
+    /* Remove the test directory */
+    DIR *p_dir = opendir(dir);
+    struct dirent *p_dirent;
+    while ((p_dirent = readdir(p_dir)) != NULL) {
+        if (p_dirent->d_name[0] != '.') {
+            snprintf(from, sizeof(from), "%s/%s", dir, p_dirent->d_name);
+            (p_dirent->d_type == DT_DIR) ? rmdir(from) : unlink(from);
+        }
+    }
+    closedir(p_dir);
+    rmdir(dir);
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,388 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "esp_err.h"
+#include "esp_schedule.h"
+
+#define TEST_FIRST_YEAR     2023
+#define TEST_YEARS          10
+#define TEST_ALL_MONTHS     0xfff
+/* Wider than any UTC offset and DST change, so that a search around a wall time sees all instants showing it */
+#define TEST_SPAN           (26 * 3600)
+#define CET                 "CET-1CEST,M3.5.0,M10.5.0/3"
+
+typedef struct {
+    const char *name;
+    const char *tz;
+} test_zone_t;
+
+static const test_zone_t s_zones[] = {
+    {"UTC", "UTC0"},
+    {"Berlin", CET},
+    {"New York", "EST5EDT,M3.2.0,M11.1.0"},
+    {"Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3"},
+    {"Lord Howe", "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0"},
+    {"Kolkata", "IST-5:30"},
+    /* DST changes at midnight, a skipped or repeated midnight moves the day */
+    {"Santiago", "<-04>4<-03>,M9.1.6/24,M4.1.6/24"},
+};
+
+/* Trigger times next to the DST changes of the zones above, and a few others */
+static const uint8_t s_times[][2] = {
+    {0, 0}, {0, 15}, {0, 30}, {1, 0}, {1, 59}, {2, 0}, {2, 15}, {2, 30}, {2, 59}, {3, 0}, {3, 30}, {12, 0}, {23, 0}, {23, 59},
+};
+
+static uint32_t s_seed = 1;
+static int s_failures;
+static int s_checks;
+static bool s_verbose;
+
+static uint32_t test_rand(void)
+{
+    /* xorshift32, the same cases on every host */
+    s_seed ^= s_seed << 13;
+    s_seed ^= s_seed >> 17;
+    s_seed ^= s_seed << 5;
+    return s_seed;
+}
+
+/* Wall time as seconds since 1970-01-01 00:00, without a time zone */
+static int64_t test_wall(int year, int month, int day, int hours, int minutes)
+{
+    struct tm tm = {
+        .tm_year = year - 1900,
+        .tm_mon = month - 1,
+        .tm_mday = day,
+        .tm_hour = hours,
+        .tm_min = minutes,
+    };
+    return timegm(&tm);
+}
+
+static int64_t test_wall_at(time_t utc)
+{
+    struct tm tm;
+    localtime_r(&utc, &tm);
+    return timegm(&tm);
+}
+
+/*
+ * First instant at which the clock shows the wall time. When it never does, because the clock skips it, the wall time
+ * moved forward by the skipped span. Searched minute by minute around DST changes, as the C library sees them.
+ */
+static time_t test_wall_to_utc(int64_t wall)
+{
+    struct tm before, after;
+    time_t t_before = wall - TEST_SPAN;
+    time_t t_after = wall + TEST_SPAN;
+    localtime_r(&t_before, &before);
+    localtime_r(&t_after, &after);
+    if (before.tm_gmtoff == after.tm_gmtoff) {
+        return wall - before.tm_gmtoff;
+    }
+    for (time_t t = t_before; t <= t_after; t += 60) {
+        if (test_wall_at(t) == wall) {
+            return t;
+        }
+    }
+    return test_wall_to_utc(wall + after.tm_gmtoff - before.tm_gmtoff);
+}
+
+/* Reference of esp_schedule_get_next_time(), walking the local calendar one day at a time */
+static esp_err_t test_next_time(const esp_schedule_trigger_t *trigger, time_t after, time_t *next_time)
+{
+    struct tm tm;
+    localtime_r(&after, &tm);
+    int year = tm.tm_year + 1900;
+    int last_year = INT32_MAX;
+    int max_days = 9 * 366;
+    uint16_t months = trigger->date.repeat_months & TEST_ALL_MONTHS;
+
+    if (trigger->type == ESP_SCHEDULE_TYPE_DAYS_OF_WEEK) {
+        max_days = 9;
+    } else if (months == ESP_SCHEDULE_MONTH_ONCE) {
+        months = TEST_ALL_MONTHS;
+    } else if (!trigger->date.repeat_every_year) {
+        last_year = trigger->date.year ? trigger->date.year : year;
+    }
+    /* Start the day before, a wall time of the day before can still be ahead after the clock went back */
+    int64_t day = test_wall(year, tm.tm_mon + 1, tm.tm_mday, 0, 0) - 24 * 3600;
+    if (trigger->type == ESP_SCHEDULE_TYPE_DATE && trigger->date.year > year) {
+        day = test_wall(trigger->date.year, 1, 1, 0, 0);
+    }
+    for (int i = 0; i <= max_days; i++, day += 24 * 3600) {
+        time_t t = day;
+        gmtime_r(&t, &tm);
+        if (tm.tm_year + 1900 > last_year) {
+            break;
+        }
+        if (trigger->type == ESP_SCHEDULE_TYPE_DAYS_OF_WEEK) {
+            /* tm_wday counts from sunday, repeat_days from monday */
+            int day_of_week = (tm.tm_wday + 6) % 7;
+            if (trigger->day.repeat_days != ESP_SCHEDULE_DAY_ONCE && !(trigger->day.repeat_days & (1 << day_of_week))) {
+                continue;
+            }
+        } else if (tm.tm_mday != trigger->date.day || !(months & (1 << tm.tm_mon))
+                   || tm.tm_year + 1900 < trigger->date.year) {
+            continue;
+        }
+        time_t candidate = test_wall_to_utc(day + (trigger->hours * 60 + trigger->minutes) * 60);
+        if (candidate > after) {
+            *next_time = candidate;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+static void test_describe(char *buf, size_t size, const esp_schedule_trigger_t *trigger)
+{
+    if (trigger->type == ESP_SCHEDULE_TYPE_DAYS_OF_WEEK) {
+        snprintf(buf, size, "%02u:%02u days 0x%02x", trigger->hours, trigger->minutes, trigger->day.repeat_days);
+    } else {
+        snprintf(buf, size, "%02u:%02u day %u months 0x%03x year %u%s", trigger->hours, trigger->minutes,
+                 trigger->date.day, trigger->date.repeat_months, trigger->date.year,
+                 trigger->date.repeat_every_year ? " every year" : "");
+    }
+}
+
+static void test_format(char *buf, size_t size, esp_err_t err, time_t t)
+{
+    struct tm tm;
+    if (err != ESP_OK) {
+        snprintf(buf, size, "%s", esp_err_to_name(err));
+        return;
+    }
+    localtime_r(&t, &tm);
+    strftime(buf, size, "%Y-%m-%d %H:%M %Z", &tm);
+}
+
+static bool test_compare(const char *zone, const esp_schedule_trigger_t *trigger, time_t after,
+                         esp_err_t err, time_t next, esp_err_t expected_err, time_t expected)
+{
+    s_checks++;
+    if (err == expected_err && (err != ESP_OK || next == expected)) {
+        return true;
+    }
+    if (++s_failures <= 20) {
+        char what[64], from[40], got[40], want[40];
+        test_describe(what, sizeof(what), trigger);
+        test_format(from, sizeof(from), ESP_OK, after);
+        test_format(got, sizeof(got), err, next);
+        test_format(want, sizeof(want), expected_err, expected);
+        printf("  FAIL %s, %s, after %s: %s, expected %s\n", zone, what, from, got, want);
+    }
+    return false;
+}
+
+/* Follows a trigger from occurrence to occurrence over the test years, each one checked against the reference */
+static void test_walk(const char *zone, const esp_schedule_trigger_t *trigger, time_t start, time_t end)
+{
+    time_t after = start;
+    while (after < end) {
+        time_t next = 0, expected = 0;
+        esp_err_t err = esp_schedule_get_next_time(trigger, NULL, after, &next);
+        esp_err_t expected_err = test_next_time(trigger, after, &expected);
+        if (!test_compare(zone, trigger, after, err, next, expected_err, expected) || err != ESP_OK) {
+            return;
+        }
+        /* Just before the occurrence, it is still the next one */
+        if (next - 1 > after) {
+            time_t again = 0;
+            err = esp_schedule_get_next_time(trigger, NULL, next - 1, &again);
+            if (!test_compare(zone, trigger, next - 1, err, again, ESP_OK, next)) {
+                return;
+            }
+        }
+        after = next;
+    }
+}
+
+static void test_random_walks(const char *zone, time_t start, time_t end, int count)
+{
+    esp_schedule_trigger_t trigger;
+    for (int i = 0; i < count; i++) {
+        memset(&trigger, 0, sizeof(trigger));
+        trigger.hours = test_rand() % 24;
+        trigger.minutes = test_rand() % 60;
+        if (test_rand() % 2) {
+            trigger.type = ESP_SCHEDULE_TYPE_DAYS_OF_WEEK;
+            trigger.day.repeat_days = test_rand() % (ESP_SCHEDULE_DAY_EVERYDAY + 1);
+        } else {
+            trigger.type = ESP_SCHEDULE_TYPE_DATE;
+            trigger.date.day = 1 + test_rand() % 31;
+            trigger.date.repeat_months = test_rand() % (TEST_ALL_MONTHS + 1);
+            trigger.date.repeat_every_year = test_rand() % 2;
+            trigger.date.year = (test_rand() % 2) ? TEST_FIRST_YEAR + test_rand() % TEST_YEARS : 0;
+        }
+        test_walk(zone, &trigger, start + test_rand() % (365 * 24 * 3600), end);
+    }
+}
+
+/* Every time next to a DST change, every day of week and every day of month, over the test years */
+static void test_zone(const test_zone_t *zone, int random_walks)
+{
+    time_t start = test_wall(TEST_FIRST_YEAR, 1, 1, 0, 0);
+    time_t end = test_wall(TEST_FIRST_YEAR + TEST_YEARS, 1, 1, 0, 0);
+    esp_schedule_trigger_t trigger;
+    int failures = s_failures;
+    int checks = s_checks;
+
+    setenv("TZ", zone->tz, 1);
+    tzset();
+    for (size_t t = 0; t < sizeof(s_times) / sizeof(s_times[0]); t++) {
+        memset(&trigger, 0, sizeof(trigger));
+        trigger.type = ESP_SCHEDULE_TYPE_DAYS_OF_WEEK;
+        trigger.hours = s_times[t][0];
+        trigger.minutes = s_times[t][1];
+        test_walk(zone->name, &trigger, start, end);
+        trigger.day.repeat_days = ESP_SCHEDULE_DAY_EVERYDAY;
+        test_walk(zone->name, &trigger, start, end);
+        for (int d = 0; d < 7; d++) {
+            trigger.day.repeat_days = 1 << d;
+            test_walk(zone->name, &trigger, start, end);
+        }
+
+        memset(&trigger.day, 0, sizeof(trigger.day));
+        trigger.type = ESP_SCHEDULE_TYPE_DATE;
+        trigger.date.repeat_months = TEST_ALL_MONTHS;
+        trigger.date.repeat_every_year = true;
+        for (int d = 1; d <= 31; d++) {
+            trigger.date.day = d;
+            test_walk(zone->name, &trigger, start, end);
+        }
+    }
+    /* 2100 is not a leap year */
+    trigger.date.repeat_months = ESP_SCHEDULE_MONTH_FEBRUARY | ESP_SCHEDULE_MONTH_MARCH;
+    for (int d = 28; d <= 31; d++) {
+        trigger.date.day = d;
+        test_walk(zone->name, &trigger, test_wall(2096, 1, 1, 0, 0), test_wall(2105, 1, 1, 0, 0));
+    }
+    test_random_walks(zone->name, start, end, random_walks);
+    printf("  %-10s %9d checks, %d failed\n", zone->name, s_checks - checks, s_failures - failures);
+}
+
+typedef struct {
+    const char *what;
+    const char *tz;
+    esp_schedule_trigger_t trigger;
+    esp_schedule_validity_t validity;
+    int64_t after;
+    esp_err_t err;
+    int64_t next;
+} test_case_t;
+
+#define DAYS(h, m, days)   .trigger = {.type = ESP_SCHEDULE_TYPE_DAYS_OF_WEEK, .hours = h, .minutes = m, .day = {days}}
+#define DATE(h, m, ...)     .trigger = {.type = ESP_SCHEDULE_TYPE_DATE, .hours = h, .minutes = m, .date = {__VA_ARGS__}}
+
+/* Known answers, UTC */
+static const test_case_t s_cases[] = {
+    {
+        "skipped 02:30 runs at 03:30 CEST", CET, DAYS(2, 30, ESP_SCHEDULE_DAY_ONCE), {0},
+        1711836000 /* 2024-03-30 22:00 */, ESP_OK, 1711848600 /* 2024-03-31 01:30 */
+    },
+    {
+        "repeated 02:30 runs once, in CEST", CET, DAYS(2, 30, ESP_SCHEDULE_DAY_ONCE), {0},
+        1729980000 /* 2024-10-26 22:00 */, ESP_OK, 1729989000 /* 2024-10-27 00:30 */
+    },
+    {
+        "day after the repeated 02:30", CET, DAYS(2, 30, ESP_SCHEDULE_DAY_EVERYDAY), {0},
+        1729989000 /* 2024-10-27 00:30 */, ESP_OK, 1730079000 /* 2024-10-28 01:30 */
+    },
+    {
+        "29 February, four years later", "UTC0", DATE(8, 0, .day = 29, .repeat_months = ESP_SCHEDULE_MONTH_FEBRUARY,
+                                                      .repeat_every_year = true), {0},
+        1709193600 /* 2024-02-29 08:00 */, ESP_OK, 1835424000 /* 2028-02-29 08:00 */
+    },
+    {
+        "29 February, not in 2100", "UTC0", DATE(8, 0, .day = 29, .repeat_months = ESP_SCHEDULE_MONTH_FEBRUARY,
+                                                 .repeat_every_year = true), {0},
+        4047955200 /* 2098-04-10 00:00 */, ESP_OK, 4233715200 /* 2104-02-29 08:00 */
+    },
+    {
+        "31st skips short months", "UTC0", DATE(0, 0, .day = 31, .repeat_months = TEST_ALL_MONTHS,
+                                                .repeat_every_year = true), {0},
+        1711843200 /* 2024-03-31 00:00 */, ESP_OK, 1717113600 /* 2024-05-31 00:00 */
+    },
+    {
+        "30 February never comes", "UTC0", DATE(0, 0, .day = 30, .repeat_months = ESP_SCHEDULE_MONTH_FEBRUARY,
+                                                .repeat_every_year = true), {0},
+        1704067200 /* 2024-01-01 00:00 */, ESP_ERR_NOT_FOUND, 0
+    },
+    {
+        "year set, not repeated", "UTC0", DATE(0, 0, .day = 1, .repeat_months = ESP_SCHEDULE_MONTH_JANUARY,
+                                               .year = 2024), {0},
+        1704067200 /* 2024-01-01 00:00 */, ESP_ERR_NOT_FOUND, 0
+    },
+    {
+        "validity start", "UTC0", DAYS(6, 0, ESP_SCHEDULE_DAY_EVERYDAY), {.start_time = 1704110400 /* 2024-01-01 12:00 */},
+        0, ESP_OK, 1704175200 /* 2024-01-02 06:00 */
+    },
+    {
+        "validity end", "UTC0", DAYS(6, 0, ESP_SCHEDULE_DAY_EVERYDAY), {.end_time = 1704110400 /* 2024-01-01 12:00 */},
+        1704088800 /* 2024-01-01 06:00 */, ESP_ERR_NOT_FOUND, 0
+    },
+    {
+        "hours out of range", "UTC0", DAYS(24, 0, ESP_SCHEDULE_DAY_ONCE), {0}, 0, ESP_ERR_INVALID_ARG, 0
+    },
+};
+
+static void test_cases(void)
+{
+    int failures = s_failures;
+    for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+        const test_case_t *c = &s_cases[i];
+        time_t next = 0;
+        setenv("TZ", c->tz, 1);
+        tzset();
+        esp_err_t err = esp_schedule_get_next_time(&c->trigger, &c->validity, c->after, &next);
+        if (!test_compare(c->what, &c->trigger, c->after, err, next, c->err, c->next)) {
+            continue;
+        }
+        if (s_verbose) {
+            printf("  ok %s\n", c->what);
+        }
+    }
+    printf("  %-10s %9zu checks, %d failed\n", "known", sizeof(s_cases) / sizeof(s_cases[0]), s_failures - failures);
+}
+
+int main(int argc, char **argv)
+{
+    int random_walks = 200;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:s:v")) != -1) {
+        switch (opt) {
+        case 'r':
+            random_walks = atoi(optarg);
+            break;
+        case 's':
+            s_seed = strtoul(optarg, NULL, 0) ? strtoul(optarg, NULL, 0) : 1;
+            break;
+        case 'v':
+            s_verbose = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-r <random triggers per zone>] [-s <seed>] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("Next trigger times, %d to %d and 2096 to 2104\n", TEST_FIRST_YEAR, TEST_FIRST_YEAR + TEST_YEARS - 1);
+    test_cases();
+    for (size_t z = 0; z < sizeof(s_zones) / sizeof(s_zones[0]); z++) {
+        test_zone(&s_zones[z], random_walks);
+    }
+    printf("%d checks, %d failed\n", s_checks, s_failures);
+    return s_failures ? 1 : 0;
+}
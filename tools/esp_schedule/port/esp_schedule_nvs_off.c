@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* The schedules of the host tools live in RAM only, as with esp_schedule_init(false, ...) on the device */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_schedule_internal.h"
+
+esp_err_t esp_schedule_nvs_add(esp_schedule_t *schedule)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_schedule_nvs_remove(esp_schedule_t *schedule)
+{
+    return ESP_OK;
+}
+
+esp_schedule_handle_t *esp_schedule_nvs_get_all(uint8_t *schedule_count)
+{
+    *schedule_count = 0;
+    return NULL;
+}
+
+bool esp_schedule_nvs_is_enabled(void)
+{
+    return false;
+}
+
+esp_err_t esp_schedule_nvs_init(char *nvs_partition)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_schedule_nvs_batch_begin(void)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_schedule_nvs_batch_end(void)
+{
+    return ESP_OK;
+}
@@ -0,0 +1,13 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdlib.h>
+
+#define MEM_ALLOC_EXTRAM(size)          malloc(size)
+#define MEM_CALLOC_EXTRAM(num, size)    calloc(num, size)
+#define MEM_REALLOC_EXTRAM(ptr, size)   realloc(ptr, size)
@@ -0,0 +1,23 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/* The simulated clock is set by the tools, SNTP is never started */
+
+#include <stdbool.h>
+#include "esp_idf_version.h"
+
+#define SNTP_OPMODE_POLL    0
+
+static inline bool esp_sntp_enabled(void)
+{
+    return true;
+}
+
+static inline void esp_sntp_setoperatingmode(int mode) {}
+static inline void esp_sntp_setservername(int index, const char *server) {}
+static inline void esp_sntp_init(void) {}
@@ -0,0 +1,20 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/* Forced into the schedule sources: time() reads the simulated clock, and what the host C library lacks */
+
+#include <stddef.h>
+#include <time.h>
+
+#ifndef HAVE_STRLCPY
+size_t strlcpy(char *dst, const char *src, size_t size);
+#endif
+
+time_t port_time(time_t *t);
+
+#define time(t)     port_time(t)
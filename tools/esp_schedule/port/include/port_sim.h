@@ -0,0 +1,32 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Set the wall clock, as an SNTP sync would: the tick count does not move
+ */
+void port_sim_set_time(time_t utc);
+
+/**
+ * @brief Let time pass, calling the timer callbacks each time a timer expires on the way
+ *
+ * @param ms: Milliseconds to run for
+ *
+ * @return Number of callbacks of the schedule timer
+ */
+uint32_t port_sim_run(uint64_t ms);
+
+#ifdef __cplusplus
+}
+#endif
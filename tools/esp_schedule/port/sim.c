@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/timers.h"
+#include "freertos/semphr.h"
+#include "port_sim.h"
+
+/* One simulated task runs everything: the tools and the timer callback */
+struct port_task {
+    int unused;
+};
+
+struct port_timer {
+    TimerCallbackFunction_t cb;
+    uint64_t expiry;
+    bool active;
+};
+
+struct port_semaphore {
+    int unused;
+};
+
+struct esp_timer {
+    esp_timer_cb_t cb;
+    void *arg;
+    uint64_t expiry;
+    bool active;
+};
+
+static struct port_task s_task;
+static struct port_timer s_timer;
+static struct port_semaphore s_semaphore;
+/* The delayed write of the schedule table */
+static struct esp_timer s_esp_timer;
+static uint64_t s_ticks;
+static int64_t s_wall_offset_ms;
+
+time_t port_time(time_t *t)
+{
+    int64_t wall_ms = (int64_t)s_ticks + s_wall_offset_ms;
+    time_t now = (time_t)((wall_ms >= 0) ? wall_ms / 1000 : -((-wall_ms + 999) / 1000));
+    if (t) {
+        *t = now;
+    }
+    return now;
+}
+
+void port_sim_set_time(time_t utc)
+{
+    s_wall_offset_ms = (int64_t)utc * 1000 - (int64_t)s_ticks;
+}
+
+uint32_t port_sim_run(uint64_t ms)
+{
+    uint64_t end = s_ticks + ms;
+    uint32_t calls = 0;
+    while (true) {
+        bool schedule_due = s_timer.active && s_timer.expiry <= end;
+        bool esp_timer_due = s_esp_timer.active && s_esp_timer.expiry <= end;
+        if (esp_timer_due && (!schedule_due || s_esp_timer.expiry < s_timer.expiry)) {
+            s_ticks = s_esp_timer.expiry;
+            s_esp_timer.active = false;
+            s_esp_timer.cb(s_esp_timer.arg);
+        } else if (schedule_due) {
+            s_ticks = s_timer.expiry;
+            s_timer.active = false;
+            s_timer.cb(&s_timer);
+            calls++;
+        } else {
+            break;
+        }
+    }
+    s_ticks = end;
+    return calls;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)s_ticks;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return &s_task;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    /* The simulated timer queue is never full, nothing waits on it */
+    s_ticks += ticks;
+}
+
+TaskHandle_t xTimerGetTimerDaemonTaskHandle(void)
+{
+    return &s_task;
+}
+
+TimerHandle_t xTimerCreate(const char *name, TickType_t period, UBaseType_t auto_reload, void *id,
+                           TimerCallbackFunction_t cb)
+{
+    if (s_timer.cb) {
+        /* The schedule component needs a single timer */
+        return NULL;
+    }
+    s_timer.cb = cb;
+    return &s_timer;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t wait)
+{
+    timer->expiry = s_ticks + (period ? period : 1);
+    timer->active = true;
+    return pdPASS;
+}
+
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t wait)
+{
+    timer->active = false;
+    return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    return &s_semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return &s_semaphore;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle)
+{
+    if (s_esp_timer.cb) {
+        /* The schedule table needs a single timer */
+        return ESP_ERR_NO_MEM;
+    }
+    s_esp_timer.cb = create_args->callback;
+    s_esp_timer.arg = create_args->arg;
+    *out_handle = &s_esp_timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    if (timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->expiry = s_ticks + (timeout_us + 999) / 1000;
+    timer->active = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    if (!timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = false;
+    return ESP_OK;
+}
@@ -0,0 +1,256 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_schedule.h"
+#include "port_sim.h"
+
+#define BENCH_SCHEDULES     (5000)
+#define BENCH_DAYS          (40)
+#define BENCH_START         ((time_t)1709251200)    /* 2024-03-01 00:00:00 UTC */
+#define BENCH_TZ            "CET-1CEST,M3.5.0,M10.5.0/3"
+#define BENCH_ALL_MONTHS    (0xfff)
+#define DAY_MS              (24ULL * 60 * 60 * 1000)
+
+typedef struct {
+    esp_schedule_handle_t handle;
+    esp_schedule_type_t type;
+    bool once;                  /* Triggers once only */
+    time_t expected;            /* Last next trigger time reported by the schedule */
+    uint32_t fired;
+    uint32_t early;             /* Triggered before the reported time */
+    uint32_t late;              /* Triggered after the reported time */
+} bench_schedule_t;
+
+typedef struct {
+    uint32_t fired;
+    uint32_t early;
+    uint32_t late;
+    uint32_t missed;            /* Reported time passed without a trigger, or one time schedule dropped */
+    uint32_t repeated;          /* One time schedule triggered more than once */
+} bench_result_t;
+
+static uint32_t s_seed = 1;
+
+static uint32_t bench_rand(void)
+{
+    /* xorshift32, the same schedules on every host */
+    s_seed ^= s_seed << 13;
+    s_seed ^= s_seed >> 17;
+    s_seed ^= s_seed << 5;
+    return s_seed;
+}
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void bench_trigger_cb(esp_schedule_handle_t handle, void *priv_data)
+{
+    bench_schedule_t *s = priv_data;
+    time_t now = time(NULL);
+    s->fired++;
+    s->early += (now < s->expected);
+    s->late += (now > s->expected);
+}
+
+static void bench_timestamp_cb(esp_schedule_handle_t handle, uint32_t next_timestamp, void *priv_data)
+{
+    ((bench_schedule_t *)priv_data)->expected = next_timestamp;
+}
+
+static void bench_create(bench_schedule_t *s, int index, const esp_schedule_trigger_t *trigger)
+{
+    esp_schedule_config_t config = {
+        .trigger = *trigger,
+        .trigger_cb = bench_trigger_cb,
+        .timestamp_cb = bench_timestamp_cb,
+        .priv_data = s,
+    };
+    snprintf(config.name, sizeof(config.name), "s%05d", index);
+    memset(s, 0, sizeof(*s));
+    s->type = trigger->type;
+    s->once = (ESP_SCHEDULE_TYPE_RELATIVE == trigger->type)
+              || ((ESP_SCHEDULE_TYPE_DAYS_OF_WEEK == trigger->type) && (ESP_SCHEDULE_DAY_ONCE == trigger->day.repeat_days))
+              || ((ESP_SCHEDULE_TYPE_DATE == trigger->type) && (ESP_SCHEDULE_MONTH_ONCE == trigger->date.repeat_months));
+    s->handle = esp_schedule_create(&config);
+    if (!s->handle || (ESP_OK != esp_schedule_enable(s->handle))) {
+        fprintf(stderr, "%s: create failed\n", config.name);
+        exit(1);
+    }
+}
+
+/* A mix of the schedule types as the RainMaker app creates them */
+static void bench_random_trigger(esp_schedule_trigger_t *trigger, uint32_t max_relative_s)
+{
+    uint32_t kind = bench_rand() % 10;
+
+    memset(trigger, 0, sizeof(*trigger));
+    trigger->hours = bench_rand() % 24;
+    trigger->minutes = bench_rand() % 60;
+    if (kind < 4) {
+        trigger->type = ESP_SCHEDULE_TYPE_DAYS_OF_WEEK;
+        trigger->day.repeat_days = (kind == 0) ? ESP_SCHEDULE_DAY_ONCE : (1 + bench_rand() % ESP_SCHEDULE_DAY_EVERYDAY);
+    } else if (kind < 7) {
+        trigger->type = ESP_SCHEDULE_TYPE_DATE;
+        trigger->date.day = 1 + bench_rand() % 31;
+        trigger->date.repeat_months = (kind == 4) ? ESP_SCHEDULE_MONTH_ONCE : BENCH_ALL_MONTHS;
+        trigger->date.repeat_every_year = true;
+    } else {
+        trigger->type = ESP_SCHEDULE_TYPE_RELATIVE;
+        trigger->relative_seconds = 1 + bench_rand() % max_relative_s;
+    }
+}
+
+static void bench_check(const bench_schedule_t *schedules, int count, bench_result_t *result)
+{
+    time_t now = time(NULL);
+
+    memset(result, 0, sizeof(*result));
+    for (int i = 0; i < count; i++) {
+        const bench_schedule_t *s = &schedules[i];
+        bool done = s->once && s->fired;
+        result->fired += s->fired;
+        result->early += s->early;
+        result->late += s->late;
+        result->missed += !done && s->expected && (s->expected <= now);
+        result->repeated += s->once && (s->fired > 1);
+    }
+}
+
+static bool bench_report(const char *name, const bench_result_t *r, bool late_allowed)
+{
+    bool ok = !r->early && !r->missed && !r->repeated && (late_allowed || !r->late);
+    printf("  %-26s %8" PRIu32 " fired, %" PRIu32 " early, %" PRIu32 " late, %" PRIu32 " missed, %" PRIu32
+           " repeated: %s\n", name, r->fired, r->early, r->late, r->missed, r->repeated, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static void bench_delete(bench_schedule_t *schedules, int count)
+{
+    for (int i = 0; i < count; i++) {
+        esp_schedule_delete(schedules[i].handle);
+    }
+}
+
+/* Schedules spread over weeks: every trigger on time, and the cost of the heap with many entries */
+static bool bench_steady(bench_schedule_t *schedules, int count, int days)
+{
+    esp_schedule_trigger_t trigger;
+    bench_result_t result;
+    uint32_t wakeups = 0;
+
+    printf("\n%d schedules over %d days\n", count, days);
+    double start = now_us();
+    for (int i = 0; i < count; i++) {
+        bench_random_trigger(&trigger, days * 24 * 3600);
+        bench_create(&schedules[i], i, &trigger);
+    }
+    double created = now_us();
+    for (int d = 0; d < days; d++) {
+        wakeups += port_sim_run(DAY_MS);
+    }
+    double ran = now_us();
+    bench_check(schedules, count, &result);
+    bench_delete(schedules, count);
+    double deleted = now_us();
+
+    printf("  create and enable          %8.2f us per schedule\n", (created - start) / count);
+    printf("  timer wake ups             %8" PRIu32 ", %.2f us per trigger\n", wakeups,
+           result.fired ? (ran - created) / result.fired : 0);
+    printf("  delete                     %8.2f us per schedule\n", (deleted - ran) / count);
+    return bench_report("triggers", &result, false);
+}
+
+/*
+ * A forward jump of the wall clock, as the first SNTP sync after a long power off: the schedules due in the skipped
+ * time trigger once, late, and none is dropped
+ */
+static bool bench_jump(bench_schedule_t *schedules, int count, bool notify)
+{
+    esp_schedule_trigger_t trigger;
+    bench_result_t result;
+
+    for (int i = 0; i < count; i++) {
+        bench_random_trigger(&trigger, 6 * 3600);
+        bench_create(&schedules[i], i, &trigger);
+    }
+    port_sim_run(10 * 60 * 1000);
+    port_sim_set_time(time(NULL) + 6 * 3600);
+    if (notify) {
+        esp_schedule_time_changed();
+        port_sim_run(1000);
+    } else {
+        /* Noticed at the latest when the timer wakes up next */
+        port_sim_run(3600 * 1000);
+    }
+    bench_check(schedules, count, &result);
+    bench_delete(schedules, count);
+    return bench_report(notify ? "jump, time changed call" : "jump, detected", &result, true);
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-n <schedules>] [-d <days>] [-v]\n", name);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    int count = BENCH_SCHEDULES;
+    int days = BENCH_DAYS;
+    uint8_t nvs_count;
+    bool ok = true;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:d:v")) != -1) {
+        switch (opt) {
+        case 'n':
+            count = atoi(optarg);
+            break;
+        case 'd':
+            days = atoi(optarg);
+            break;
+        case 'v':
+            port_log_level = ESP_LOG_INFO;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if ((optind != argc) || (count <= 0) || (days <= 0)) {
+        usage(argv[0]);
+    }
+
+    /* The local time zone has DST changes inside the run, unless TZ is given */
+    setenv("TZ", getenv("TZ") ? getenv("TZ") : BENCH_TZ, 1);
+    tzset();
+    port_sim_set_time(BENCH_START);
+    esp_schedule_init(false, NULL, &nvs_count);
+
+    bench_schedule_t *schedules = calloc(count, sizeof(bench_schedule_t));
+    if (!schedules) {
+        fprintf(stderr, "no mem\n");
+        return 1;
+    }
+    ok &= bench_steady(schedules, count, days);
+    printf("\nClock set 6 hours forward, %d schedules\n", count);
+    ok &= bench_jump(schedules, count, true);
+    ok &= bench_jump(schedules, count, false);
+    free(schedules);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,267 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include "esp_schedule.h"
+#include "esp_schedule_internal.h"
+#include "port_sim.h"
+
+#define BENCH_SCHEDULES     (200)
+#define BENCH_START         ((time_t)1709251200)    /* 2024-03-01 00:00:00 UTC */
+#define BENCH_TZ            "CET-1CEST,M3.5.0,M10.5.0/3"
+#define BENCH_ALL_MONTHS    (0xfff)
+#define BENCH_TABLE_KEY     "schd_table"
+#define BENCH_COUNT_KEY     "schd_count"
+/* Longer than the write delay of the schedule table */
+#define BENCH_SETTLE_MS     (1000)
+
+typedef struct {
+    esp_schedule_handle_t handle;
+    esp_schedule_trigger_t trigger;     /* As last set */
+} bench_schedule_t;
+
+static int s_failures;
+static bool s_verbose;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-56s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void bench_name(int index, char *name)
+{
+    snprintf(name, MAX_SCHEDULE_NAME_LEN + 1, "s%03d", index);
+}
+
+/* Repeating schedules only, so that none has expired at boot */
+static void bench_trigger(int index, int round, esp_schedule_trigger_t *trigger)
+{
+    memset(trigger, 0, sizeof(*trigger));
+    trigger->hours = (index + round) % 24;
+    trigger->minutes = (index * 7 + round) % 60;
+    if (index % 2) {
+        trigger->type = ESP_SCHEDULE_TYPE_DAYS_OF_WEEK;
+        trigger->day.repeat_days = 1 + index % ESP_SCHEDULE_DAY_EVERYDAY;
+    } else {
+        trigger->type = ESP_SCHEDULE_TYPE_DATE;
+        trigger->date.day = 1 + index % 31;
+        trigger->date.repeat_months = BENCH_ALL_MONTHS;
+        trigger->date.repeat_every_year = true;
+    }
+}
+
+/* Schedules as the component stored them before the table: one blob each, and their count */
+static void bench_write_legacy(int count)
+{
+    for (int i = 0; i < count; i++) {
+        esp_schedule_t schedule = { 0 };
+        bench_name(i, schedule.name);
+        bench_trigger(i, 0, &schedule.trigger);
+        nvs_set_blob(1, schedule.name, &schedule, sizeof(schedule));
+    }
+    nvs_set_u8(1, BENCH_COUNT_KEY, count);
+    nvs_commit(1);
+}
+
+static bench_schedule_t *bench_find(bench_schedule_t *schedules, int count, const char *name)
+{
+    for (int i = 0; i < count; i++) {
+        char expected[MAX_SCHEDULE_NAME_LEN + 1];
+        bench_name(i, expected);
+        if (0 == strcmp(expected, name)) {
+            return &schedules[i];
+        }
+    }
+    return NULL;
+}
+
+static bool bench_same_trigger(const esp_schedule_trigger_t *a, const esp_schedule_trigger_t *b)
+{
+    if ((a->type != b->type) || (a->hours != b->hours) || (a->minutes != b->minutes)) {
+        return false;
+    }
+    if (ESP_SCHEDULE_TYPE_DAYS_OF_WEEK == a->type) {
+        return a->day.repeat_days == b->day.repeat_days;
+    }
+    return (a->date.day == b->date.day) && (a->date.repeat_months == b->date.repeat_months)
+           && (a->date.repeat_every_year == b->date.repeat_every_year);
+}
+
+/*
+ * Read the table back, as at boot. Returns the number of schedules read, or -1 if one of them differs from what was
+ * last set. The schedules read are freed, they are copies of the running ones.
+ */
+static int bench_reload(bench_schedule_t *schedules, int count, double *load_us)
+{
+    uint8_t loaded = 0;
+    bool same = true;
+
+    double start = now_us();
+    esp_schedule_handle_t *list = esp_schedule_nvs_get_all(&loaded);
+    *load_us = now_us() - start;
+    for (int i = 0; i < loaded; i++) {
+        const esp_schedule_t *schedule = (const esp_schedule_t *)list[i];
+        const bench_schedule_t *s = bench_find(schedules, count, schedule->name);
+        same &= s && bench_same_trigger(&s->trigger, &schedule->trigger);
+        free(list[i]);
+    }
+    free(list);
+    return same ? loaded : -1;
+}
+
+static void bench_edit(bench_schedule_t *schedules, int count, int round)
+{
+    for (int i = 0; i < count; i++) {
+        esp_schedule_config_t config;
+        esp_schedule_get(schedules[i].handle, &config);
+        bench_trigger(i, round, &config.trigger);
+        schedules[i].trigger = config.trigger;
+        esp_schedule_edit(schedules[i].handle, &config);
+    }
+}
+
+static void bench(int count)
+{
+    char what[80];
+    double load_us;
+    uint8_t loaded = 0;
+
+    bench_schedule_t *schedules = calloc(count, sizeof(bench_schedule_t));
+    if (!schedules) {
+        fprintf(stderr, "no mem\n");
+        exit(1);
+    }
+
+    printf("First boot with %d schedules of the legacy format\n", count);
+    bench_write_legacy(count);
+    size_t commits = port_nvs_commits();
+    double start = now_us();
+    esp_schedule_handle_t *handles = esp_schedule_init(true, NULL, &loaded);
+    double init_us = now_us() - start;
+    for (int i = 0; i < loaded; i++) {
+        bench_schedule_t *s = bench_find(schedules, count, ((esp_schedule_t *)handles[i])->name);
+        if (s) {
+            s->handle = handles[i];
+            s->trigger = ((esp_schedule_t *)handles[i])->trigger;
+        }
+    }
+    free(handles);
+    snprintf(what, sizeof(what), "%d schedules migrated to the table", count);
+    check(loaded == count, what);
+    check(1 == port_nvs_count(), "legacy keys erased, the table is the only key");
+    printf("  migrate and start            %10.1f us, %zu commits\n", init_us, port_nvs_commits() - commits);
+
+    printf("\nBoot restore\n");
+    snprintf(what, sizeof(what), "%d schedules read back", count);
+    check(count == bench_reload(schedules, count, &load_us), what);
+    printf("  load the table               %10.1f us, %.2f us per schedule\n", load_us, load_us / count);
+
+    printf("\nImport in a batch\n");
+    commits = port_nvs_commits();
+    size_t written = port_nvs_written();
+    start = now_us();
+    check(ESP_OK == esp_schedule_batch_begin(), "batch begins");
+    bench_edit(schedules, count, 1);
+    check(commits == port_nvs_commits(), "nothing written inside the batch");
+    check(ESP_OK == esp_schedule_batch_end(), "batch ends");
+    double batch_us = now_us() - start;
+    check(commits + 1 == port_nvs_commits(), "one commit at the end of the batch");
+    snprintf(what, sizeof(what), "%d edits read back", count);
+    check(count == bench_reload(schedules, count, &load_us), what);
+    printf("  edit and commit              %10.1f us, %.2f us per schedule, %zu bytes written\n", batch_us,
+           batch_us / count, port_nvs_written() - written);
+
+    printf("\nEdits one by one, as RainMaker makes them\n");
+    commits = port_nvs_commits();
+    written = port_nvs_written();
+    start = now_us();
+    bench_edit(schedules, count, 2);
+    double edit_us = now_us() - start;
+    check(commits == port_nvs_commits(), "nothing written while the edits follow each other");
+    port_sim_run(BENCH_SETTLE_MS);
+    check(commits + 1 == port_nvs_commits(), "one commit once they stop");
+    snprintf(what, sizeof(what), "%d edits read back", count);
+    check(count == bench_reload(schedules, count, &load_us), what);
+    printf("  edit                         %10.1f us, %.2f us per schedule, %zu bytes written\n", edit_us,
+           edit_us / count, port_nvs_written() - written);
+    commits = port_nvs_commits();
+    port_sim_run(BENCH_SETTLE_MS);
+    bench_edit(schedules, count, 2);
+    port_sim_run(BENCH_SETTLE_MS);
+    check(commits == port_nvs_commits(), "edits that change nothing are not written");
+
+    printf("\nDamaged table\n");
+    size_t size = 0;
+    uint8_t *table = port_nvs_data(BENCH_TABLE_KEY, &size);
+    check(table && size, "table found");
+    if (table && size) {
+        table[size - 1] ^= 0x01;
+        check(0 == bench_reload(schedules, count, &load_us), "a flipped bit is rejected");
+        table[size - 1] ^= 0x01;
+        check(count == bench_reload(schedules, count, &load_us), "the intact table is read");
+    }
+
+    printf("\nDelete all in a batch\n");
+    commits = port_nvs_commits();
+    esp_schedule_batch_begin();
+    for (int i = 0; i < count; i++) {
+        esp_schedule_delete(schedules[i].handle);
+    }
+    esp_schedule_batch_end();
+    check(commits + 1 == port_nvs_commits(), "one commit");
+    check(0 == bench_reload(schedules, count, &load_us), "no schedule read back");
+    free(schedules);
+}
+
+int main(int argc, char **argv)
+{
+    int count = BENCH_SCHEDULES;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:v")) != -1) {
+        switch (opt) {
+        case 'n':
+            count = atoi(optarg);
+            break;
+        case 'v':
+            s_verbose = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n <schedules>] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    if ((optind != argc) || (count <= 0) || (count > UINT8_MAX)) {
+        fprintf(stderr, "usage: %s [-n <schedules>] [-v]\n", argv[0]);
+        return 2;
+    }
+
+    setenv("TZ", getenv("TZ") ? getenv("TZ") : BENCH_TZ, 1);
+    tzset();
+    port_sim_set_time(BENCH_START);
+    /* The damaged table logs errors on purpose */
+    port_log_level = s_verbose ? ESP_LOG_INFO : ESP_LOG_NONE;
+    bench(count);
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "esp_check.h"
+
+#include "fake_bus.h"
+
+#define FAKE_BUS_MAX_DEVICES        (8)
+#define FAKE_BUS_BITS_PER_BYTE      (9)     /*!< 8 data bits and ACK */
+#define FAKE_BUS_BITS_PER_START     (1)
+#define FAKE_BUS_BITS_PER_STOP      (1)
+
+typedef struct {
+    uint8_t addr;
+    uint8_t reg_ptr;
+    uint8_t regs[256];
+} fake_device_t;
+
+struct fake_bus {
+    uint32_t clk_speed_hz;
+    bool real_time;
+    size_t device_count;
+    fake_device_t devices[FAKE_BUS_MAX_DEVICES];
+};
+
+static const char *TAG = "fake_bus";
+
+static fake_device_t *fake_bus_find(fake_bus_handle_t bus, uint8_t addr)
+{
+    for (size_t i = 0; i < bus->device_count; i++) {
+        if (bus->devices[i].addr == addr) {
+            return &bus->devices[i];
+        }
+    }
+    return NULL;
+}
+
+static void fake_device_write(fake_device_t *device, const uint8_t *data, size_t size)
+{
+    if (size) {
+        device->reg_ptr = data[0];
+    }
+    for (size_t i = 1; i < size; i++) {
+        device->regs[device->reg_ptr++] = data[i];
+    }
+}
+
+static void fake_device_read(fake_device_t *device, uint8_t *data, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        data[i] = device->regs[device->reg_ptr++];
+    }
+}
+
+static esp_err_t fake_bus_transfer(void *bus_ctx, const bsp_i2c_trans_t *trans, TickType_t timeout, uint32_t *busy_us)
+{
+    fake_bus_handle_t bus = (fake_bus_handle_t)bus_ctx;
+    fake_device_t *device = fake_bus_find(bus, trans->addr);
+    uint64_t bits = FAKE_BUS_BITS_PER_START + FAKE_BUS_BITS_PER_BYTE;
+
+    if (device && trans->regs) {
+        for (size_t i = 0; i < trans->reg_count; i++) {
+            fake_device_write(device, &trans->regs[i], 1);
+            fake_device_read(device, &trans->read_buf[i], 1);
+        }
+        /* address, register, repeated start, address, data for each register */
+        bits = trans->reg_count * (2 * FAKE_BUS_BITS_PER_START + 4 * FAKE_BUS_BITS_PER_BYTE);
+    } else if (device) {
+        bits += (trans->write_size + trans->read_size) * FAKE_BUS_BITS_PER_BYTE;
+        if (trans->write_size && trans->read_size) {
+            bits += FAKE_BUS_BITS_PER_START + FAKE_BUS_BITS_PER_BYTE;
+        }
+        fake_device_write(device, trans->write_buf, trans->write_size);
+        fake_device_read(device, trans->read_buf, trans->read_size);
+    }
+    bits += FAKE_BUS_BITS_PER_STOP;
+
+    /* A missing device NACKs its address, the transaction ends right after it */
+    *busy_us = (uint32_t)(bits * 1000000 / bus->clk_speed_hz);
+    if (bus->real_time) {
+        struct timespec ts = {.tv_sec = *busy_us / 1000000, .tv_nsec = (long)(*busy_us % 1000000) * 1000};
+        nanosleep(&ts, NULL);
+    }
+    return device ? ESP_OK : ESP_FAIL;
+}
+
+const bsp_i2c_bus_ops_t fake_bus_ops = {
+    .transfer = fake_bus_transfer,
+};
+
+esp_err_t fake_bus_new(uint32_t clk_speed_hz, bool real_time, fake_bus_handle_t *ret_bus)
+{
+    ESP_RETURN_ON_FALSE(clk_speed_hz && ret_bus, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    fake_bus_handle_t bus = calloc(1, sizeof(struct fake_bus));
+    ESP_RETURN_ON_FALSE(bus, ESP_ERR_NO_MEM, TAG, "no mem for fake bus");
+    bus->clk_speed_hz = clk_speed_hz;
+    bus->real_time = real_time;
+
+    *ret_bus = bus;
+    return ESP_OK;
+}
+
+void fake_bus_del(fake_bus_handle_t bus)
+{
+    free(bus);
+}
+
+esp_err_t fake_bus_add_device(fake_bus_handle_t bus, uint8_t addr, uint8_t **regs)
+{
+    ESP_RETURN_ON_FALSE(bus && !fake_bus_find(bus, addr), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(bus->device_count < FAKE_BUS_MAX_DEVICES, ESP_ERR_NO_MEM, TAG, "too many devices");
+
+    fake_device_t *device = &bus->devices[bus->device_count++];
+    device->addr = addr;
+    if (regs) {
+        *regs = device->regs;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "bsp_i2c_service.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Fake bus for tests and throughput measurements without hardware
+ *
+ * Devices are 256 byte register files with an auto-incremented register pointer: the first written byte selects
+ * the register, the following bytes are written from there, reads continue from the register pointer.
+ * The bus time reported is the time the transfer would take on a real bus at `clk_speed_hz`.
+ */
+typedef struct fake_bus *fake_bus_handle_t;
+
+/**
+ * @brief Fake bus backend, bus_ctx is a fake_bus_handle_t
+ */
+extern const bsp_i2c_bus_ops_t fake_bus_ops;
+
+/**
+ * @brief Create a fake bus
+ *
+ * @param clk_speed_hz: Simulated clock speed
+ * @param real_time: Whether a transfer takes its bus time, so that transactions queue up as on a real bus
+ * @param ret_bus: Output fake bus handle
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t fake_bus_new(uint32_t clk_speed_hz, bool real_time, fake_bus_handle_t *ret_bus);
+
+/**
+ * @brief Delete a fake bus
+ *
+ * @param bus: Fake bus handle
+ */
+void fake_bus_del(fake_bus_handle_t bus);
+
+/**
+ * @brief Add a device to the fake bus, transactions to other addresses fail with NACK
+ *
+ * @param bus: Fake bus handle
+ * @param addr: Device address, already shifted left
+ * @param regs: Output pointer to the 256 register file of the device, may be NULL
+ *
+ * @return
+ *    - ESP_OK: Success
+ *    - ESP_ERR_INVALID_ARG: Invalid argument
+ *    - ESP_ERR_NO_MEM: Too many devices
+ */
+esp_err_t fake_bus_add_device(fake_bus_handle_t bus, uint8_t addr, uint8_t **regs);
+
+#ifdef __cplusplus
+}
+#endif
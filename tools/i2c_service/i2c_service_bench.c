@@ -0,0 +1,457 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "bsp_i2c_service.h"
+#include "fake_bus.h"
+
+#define BENCH_TRANSACTIONS      (20000)
+#define BENCH_QUEUE_DEPTH       (8)
+#define BENCH_ORDER_MAX         (32)
+/* The sensors of the BOX-3 sensor bottom */
+#define AHT20_ADDR              (0x38 << 1)
+#define AT581X_ADDR             (0x28 << 1)
+#define MISSING_ADDR            (0x50 << 1)
+/* A slow clock, so that transactions queue up behind each other on a real time bus */
+#define SLOW_CLK_HZ             (10000)
+
+typedef struct {
+    SemaphoreHandle_t done;
+    int order[BENCH_ORDER_MAX];
+    esp_err_t err[BENCH_ORDER_MAX];
+    int count;
+} order_log_t;
+
+typedef struct {
+    order_log_t *log;
+    int id;
+} order_ctx_t;
+
+typedef struct {
+    const char *name;
+    uint8_t addr;
+    const uint8_t *write_buf;
+    size_t write_size;
+    size_t read_size;
+    const uint8_t *regs;
+    size_t reg_count;
+} bench_kind_t;
+
+static int s_failures;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-56s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+static bsp_i2c_service_handle_t service_new(fake_bus_handle_t bus)
+{
+    const bsp_i2c_service_config_t config = {
+        .ops = &fake_bus_ops,
+        .bus_ctx = bus,
+        .name = "I2C Bench",
+        .queue_depth = BENCH_QUEUE_DEPTH,
+        .default_timeout_ms = 1000,
+        .task_priority = 6,
+        .task_core_id = tskNO_AFFINITY,
+    };
+    bsp_i2c_service_handle_t service = NULL;
+    if (ESP_OK != bsp_i2c_service_new(&config, &service)) {
+        fprintf(stderr, "service creation failed\n");
+        exit(1);
+    }
+    return service;
+}
+
+static void order_done(esp_err_t err, uint32_t busy_us, void *user_ctx)
+{
+    order_ctx_t *ctx = (order_ctx_t *)user_ctx;
+    order_log_t *log = ctx->log;
+
+    if (log->count < BENCH_ORDER_MAX) {
+        log->order[log->count] = ctx->id;
+        log->err[log->count] = err;
+        log->count++;
+    }
+    xSemaphoreGive(log->done);
+}
+
+static esp_err_t order_submit(bsp_i2c_service_handle_t service, order_ctx_t *ctx, bsp_i2c_trans_t *trans)
+{
+    trans->done_cb = order_done;
+    trans->user_ctx = ctx;
+    return bsp_i2c_service_submit(service, trans);
+}
+
+static void order_wait(order_log_t *log, int count)
+{
+    for (int i = 0; i < count; i++) {
+        xSemaphoreTake(log->done, portMAX_DELAY);
+    }
+}
+
+typedef struct {
+    bsp_i2c_service_handle_t service;
+    SemaphoreHandle_t done;
+    esp_err_t err;
+    esp_err_t nested_err;
+} nested_ctx_t;
+
+static esp_err_t exec_nested_transfer(void *bus_ctx, void *user_ctx)
+{
+    nested_ctx_t *ctx = (nested_ctx_t *)user_ctx;
+    bsp_i2c_trans_t trans = {
+        .addr = AHT20_ADDR,
+    };
+    /* The service task may not wait for itself */
+    ctx->nested_err = bsp_i2c_service_transfer(ctx->service, &trans);
+    return ctx->nested_err;
+}
+
+static void nested_done(esp_err_t err, uint32_t busy_us, void *user_ctx)
+{
+    nested_ctx_t *ctx = (nested_ctx_t *)user_ctx;
+    ctx->err = err;
+    xSemaphoreGive(ctx->done);
+}
+
+/* A driver configuring its device through the bus it is given */
+static esp_err_t exec_write_regs(void *bus_ctx, void *user_ctx)
+{
+    const uint8_t write[] = {0x10, 0x5a};
+    const bsp_i2c_trans_t trans = {
+        .addr = AT581X_ADDR,
+        .write_buf = write,
+        .write_size = sizeof(write),
+    };
+    uint32_t busy_us = 0;
+    return fake_bus_ops.transfer(bus_ctx, &trans, portMAX_DELAY, &busy_us);
+}
+
+static void test_transactions(void)
+{
+    fake_bus_handle_t bus = NULL;
+    uint8_t *regs = NULL;
+    uint8_t *radar_regs = NULL;
+
+    printf("Transactions\n");
+    fake_bus_new(400000, false, &bus);
+    fake_bus_add_device(bus, AHT20_ADDR, &regs);
+    fake_bus_add_device(bus, AT581X_ADDR, &radar_regs);
+    bsp_i2c_service_handle_t service = service_new(bus);
+
+    const uint8_t write[] = {0x20, 1, 2, 3, 4};
+    bsp_i2c_trans_t trans = {
+        .addr = AHT20_ADDR,
+        .write_buf = write,
+        .write_size = sizeof(write),
+    };
+    check((ESP_OK == bsp_i2c_service_transfer(service, &trans)) && (0 == memcmp(&regs[0x20], &write[1], 4)),
+          "write lands in the registers");
+
+    const uint8_t reg = 0x21;
+    uint8_t read[3] = {0};
+    trans = (bsp_i2c_trans_t) {
+        .addr = AHT20_ADDR,
+        .write_buf = &reg,
+        .write_size = 1,
+        .read_buf = read,
+        .read_size = sizeof(read),
+    };
+    check((ESP_OK == bsp_i2c_service_transfer(service, &trans)) && (0 == memcmp(read, &write[2], 3)),
+          "write then read returns the registers");
+
+    const uint8_t batch_regs[] = {0x23, 0x20, 0x22};
+    trans = (bsp_i2c_trans_t) {
+        .addr = AHT20_ADDR,
+        .regs = batch_regs,
+        .reg_count = sizeof(batch_regs),
+        .read_buf = read,
+        .read_size = sizeof(read),
+    };
+    check((ESP_OK == bsp_i2c_service_transfer(service, &trans)) && (4 == read[0]) && (1 == read[1]) && (3 == read[2]),
+          "batched register read returns each register");
+    trans.read_size = 2;
+    check(ESP_ERR_INVALID_ARG == bsp_i2c_service_transfer(service, &trans), "batched read of the wrong size rejected");
+
+    trans = (bsp_i2c_trans_t) {
+        .addr = MISSING_ADDR,
+    };
+    bsp_i2c_device_stats_t stats = {0};
+    check((ESP_OK != bsp_i2c_service_transfer(service, &trans)) &&
+          (ESP_OK == bsp_i2c_service_get_stats(service, MISSING_ADDR, &stats)) && (1 == stats.errors),
+          "missing device NACKs, counted as an error");
+
+    trans = (bsp_i2c_trans_t) {
+        .addr = AT581X_ADDR,
+        .exec = exec_write_regs,
+    };
+    check((ESP_OK == bsp_i2c_service_submit(service, &trans)), "driver call queued");
+    trans = (bsp_i2c_trans_t) {
+        .addr = AT581X_ADDR,
+    };
+    check((ESP_OK == bsp_i2c_service_transfer(service, &trans)) && (0x5a == radar_regs[0x10]),
+          "driver call run in turn");
+    nested_ctx_t nested = {
+        .service = service,
+        .done = xSemaphoreCreateBinary(),
+        .err = ESP_OK,
+    };
+    trans = (bsp_i2c_trans_t) {
+        .addr = AT581X_ADDR,
+        .exec = exec_nested_transfer,
+        .done_cb = nested_done,
+        .user_ctx = &nested,
+    };
+    check(ESP_OK == bsp_i2c_service_submit(service, &trans), "driver call waiting for a transaction queued");
+    xSemaphoreTake(nested.done, portMAX_DELAY);
+    check((ESP_ERR_INVALID_STATE == nested.nested_err) && (ESP_ERR_INVALID_STATE == nested.err),
+          "waiting from the service task fails, no deadlock");
+    check((ESP_OK == bsp_i2c_service_get_stats(service, AT581X_ADDR, &stats)) && (3 == stats.transactions) &&
+          (1 == stats.errors), "driver calls counted with their result");
+    vSemaphoreDelete(nested.done);
+
+    bsp_i2c_service_del(service);
+    fake_bus_del(bus);
+}
+
+/* High priority transactions overtake the queued low priority ones, late ones expire without touching the bus */
+static void test_queueing(void)
+{
+    fake_bus_handle_t bus = NULL;
+    order_log_t log = {.done = xSemaphoreCreateCounting(BENCH_ORDER_MAX, 0)};
+    order_ctx_t ctx[BENCH_ORDER_MAX];
+    uint8_t data[6][6];
+    bsp_i2c_device_stats_t stats;
+
+    printf("\nQueueing on a %d kHz bus\n", SLOW_CLK_HZ / 1000);
+    fake_bus_new(SLOW_CLK_HZ, true, &bus);
+    fake_bus_add_device(bus, AHT20_ADDR, NULL);
+    fake_bus_add_device(bus, AT581X_ADDR, NULL);
+    bsp_i2c_service_handle_t service = service_new(bus);
+
+    /* Six reads of 6.5 ms, then a probe */
+    for (int i = 0; i < 6; i++) {
+        ctx[i] = (order_ctx_t) {
+            .log = &log, .id = i
+        };
+        bsp_i2c_trans_t trans = {
+            .addr = AHT20_ADDR,
+            .read_buf = data[i],
+            .read_size = sizeof(data[i]),
+            .priority = BSP_I2C_PRIO_LOW,
+        };
+        order_submit(service, &ctx[i], &trans);
+    }
+    ctx[6] = (order_ctx_t) {
+        .log = &log, .id = 6
+    };
+    bsp_i2c_trans_t probe = {
+        .addr = AT581X_ADDR,
+        .priority = BSP_I2C_PRIO_HIGH,
+    };
+    order_submit(service, &ctx[6], &probe);
+    order_wait(&log, 7);
+    int probe_position = 0;
+    while ((probe_position < log.count) && (6 != log.order[probe_position])) {
+        probe_position++;
+    }
+    check(probe_position <= 1, "high priority served after the read on the bus");
+    bool in_order = true;
+    for (int i = 0, low = 0; i < log.count; i++) {
+        if (6 != log.order[i]) {
+            in_order &= (low++ == log.order[i]);
+        }
+    }
+    check(in_order, "low priority served in submission order");
+
+    /* Eight reads of 6.5 ms, each to be done within 15 ms */
+    log.count = 0;
+    for (int i = 0; i < BENCH_QUEUE_DEPTH; i++) {
+        ctx[i] = (order_ctx_t) {
+            .log = &log, .id = i
+        };
+        bsp_i2c_trans_t trans = {
+            .addr = AHT20_ADDR,
+            .read_buf = data[i % 6],
+            .read_size = sizeof(data[i % 6]),
+            .timeout_ms = 15,
+        };
+        order_submit(service, &ctx[i], &trans);
+    }
+    order_wait(&log, BENCH_QUEUE_DEPTH);
+    int expired = 0;
+    int done = 0;
+    for (int i = 0; i < log.count; i++) {
+        expired += (ESP_ERR_TIMEOUT == log.err[i]);
+        done += (ESP_OK == log.err[i]);
+    }
+    bsp_i2c_service_get_stats(service, AHT20_ADDR, &stats);
+    check((done >= 2) && (expired >= 3) && (done + expired == BENCH_QUEUE_DEPTH), "late transactions expire");
+    check((stats.timeouts == (uint32_t)expired) && (stats.transactions == 6 + (uint32_t)done),
+          "expired transactions do not reach the bus");
+
+    /* One on the bus, a full queue, then no room */
+    log.count = 0;
+    int queued = 0;
+    esp_err_t err = ESP_OK;
+    for (int i = 0; (i < BENCH_QUEUE_DEPTH + 2) && (ESP_OK == err); i++) {
+        ctx[i] = (order_ctx_t) {
+            .log = &log, .id = i
+        };
+        bsp_i2c_trans_t trans = {
+            .addr = AHT20_ADDR,
+            .read_buf = data[i % 6],
+            .read_size = sizeof(data[i % 6]),
+        };
+        err = order_submit(service, &ctx[i], &trans);
+        queued += (ESP_OK == err);
+    }
+    check(ESP_ERR_NO_MEM == err, "full queue rejects the transaction");
+
+    /* Deleting the service completes what is still queued */
+    bsp_i2c_service_del(service);
+    int cancelled = 0;
+    for (int i = 0; i < log.count; i++) {
+        cancelled += (ESP_ERR_INVALID_STATE == log.err[i]);
+    }
+    check((log.count == queued) && (cancelled >= BENCH_QUEUE_DEPTH - 1), "delete completes the queued transactions");
+    vSemaphoreDelete(log.done);
+    fake_bus_del(bus);
+}
+
+static void bench_done(esp_err_t err, uint32_t busy_us, void *user_ctx)
+{
+    xSemaphoreGive((SemaphoreHandle_t)user_ctx);
+}
+
+/*
+ * Transactions submitted back to back, at most a queue depth in flight: the host cost of the service, and the bus
+ * time each takes at the clock, which bounds the transaction rate of the bus
+ */
+static bool bench_kind(uint32_t clk_speed_hz, const bench_kind_t *kind, int count, double *bus_us)
+{
+    fake_bus_handle_t bus = NULL;
+    bsp_i2c_device_stats_t stats = {0};
+    uint8_t read[16];
+
+    fake_bus_new(clk_speed_hz, false, &bus);
+    fake_bus_add_device(bus, AHT20_ADDR, NULL);
+    fake_bus_add_device(bus, AT581X_ADDR, NULL);
+    bsp_i2c_service_handle_t service = service_new(bus);
+    SemaphoreHandle_t slots = xSemaphoreCreateCounting(BENCH_QUEUE_DEPTH, BENCH_QUEUE_DEPTH);
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < count; i++) {
+        bsp_i2c_trans_t trans = {
+            .addr = kind->addr,
+            .write_buf = kind->write_buf,
+            .write_size = kind->write_size,
+            .read_buf = kind->read_size ? read : NULL,
+            .read_size = kind->read_size,
+            .regs = kind->regs,
+            .reg_count = kind->reg_count,
+            .done_cb = bench_done,
+            .user_ctx = slots,
+        };
+        xSemaphoreTake(slots, portMAX_DELAY);
+        bsp_i2c_service_submit(service, &trans);
+    }
+    for (int i = 0; i < BENCH_QUEUE_DEPTH; i++) {
+        xSemaphoreTake(slots, portMAX_DELAY);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    bsp_i2c_service_get_stats(service, kind->addr, &stats);
+    *bus_us = (double)stats.busy_us / count;
+    printf("  %-7" PRIu32 " %-26s %8.1f %10.0f %9.2f\n", clk_speed_hz / 1000, kind->name, *bus_us,
+           1e6 / *bus_us, (double)elapsed / count);
+    bool ok = (stats.transactions == (uint32_t)count) && !stats.errors && !stats.timeouts;
+
+    vSemaphoreDelete(slots);
+    bsp_i2c_service_del(service);
+    fake_bus_del(bus);
+    return ok;
+}
+
+static void bench_throughput(int count)
+{
+    static const uint8_t measure_cmd[] = {0xAC, 0x33, 0x00};
+    static const uint8_t reg = 0x10;
+    static const uint8_t regs[] = {0x10, 0x11, 0x31, 0x32, 0x3d, 0x3e, 0x42, 0x43};
+    const bench_kind_t kinds[] = {
+        {"probe", AT581X_ADDR},
+        {"AHT20 measure command", AHT20_ADDR, measure_cmd, sizeof(measure_cmd)},
+        {"AHT20 6 byte read", AHT20_ADDR, NULL, 0, 6},
+        {"register read", AT581X_ADDR, &reg, 1, 1},
+        {"8 registers, batched", AT581X_ADDR, NULL, 0, sizeof(regs), regs, sizeof(regs)},
+    };
+    const uint32_t clocks[] = {100000, 400000};
+    bool all_ok = true;
+    bool batch_faster = true;
+
+    printf("\nThroughput, %d transactions each\n", count);
+    printf("  kHz     transaction                bus us  max rate/s   host us\n");
+    for (size_t c = 0; c < sizeof(clocks) / sizeof(clocks[0]); c++) {
+        double bus_us[sizeof(kinds) / sizeof(kinds[0])];
+        for (size_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++) {
+            all_ok &= bench_kind(clocks[c], &kinds[k], count, &bus_us[k]);
+        }
+        /* Eight single register reads against one batched read */
+        batch_faster &= (bus_us[4] < 8 * bus_us[3]);
+    }
+    check(all_ok, "every transaction done, none failed or expired");
+    check(batch_faster, "batched registers take less bus time than single reads");
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-n <transactions>] [-v]\n", name);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    int count = BENCH_TRANSACTIONS;
+    bool verbose = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:v")) != -1) {
+        switch (opt) {
+        case 'n':
+            count = atoi(optarg);
+            break;
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if ((optind != argc) || (count <= 0)) {
+        usage(argv[0]);
+    }
+
+    /* The missing device and the nested wait log errors on purpose */
+    port_log_level = verbose ? ESP_LOG_DEBUG : ESP_LOG_NONE;
+    test_transactions();
+    test_queueing();
+    bench_throughput(count);
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
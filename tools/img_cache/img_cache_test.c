@@ -0,0 +1,362 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "img_cache.h"
+#include "port_asset_pack.h"
+
+#define TEST_SIDE           (10)
+#define TEST_IMG_SIZE       (TEST_SIDE * TEST_SIDE * LV_IMG_PX_SIZE_ALPHA_BYTE)
+#define TEST_CAPACITY       (3 * TEST_IMG_SIZE + TEST_IMG_SIZE / 3)     /* Three images and a bit */
+#define TEST_QUEUE_LEN      (8)                                         /* IMG_CACHE_QUEUE_LEN of img_cache.c */
+#define TEST_DECODE_MS      (5)
+#define TEST_MAX_READY      (32)
+#define TEST_MAX_LOADS      (64)
+
+/* A call of the ready callback */
+typedef struct {
+    char name[64];
+    const lv_img_dsc_t *img;
+} ready_t;
+
+static const char *const s_names[] = {
+    "a.png", "b.png", "c.png", "g1.png", "p1.png", "p2.png", "p3.png",
+    "q0.png", "q1.png", "q2.png", "q3.png", "q4.png", "q5.png", "q6.png", "q7.png", "q8.png", "q9.png",
+};
+
+static SemaphoreHandle_t s_lock;
+static ready_t s_ready[TEST_MAX_READY];
+static size_t s_ready_num;
+static int s_failures;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-56s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+static void on_ready(const char *name, const lv_img_dsc_t *img, void *user_ctx)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_ready_num < TEST_MAX_READY) {
+        snprintf(s_ready[s_ready_num].name, sizeof(s_ready[s_ready_num].name), "%s", name);
+        s_ready[s_ready_num].img = img;
+    }
+    s_ready_num++;
+    xSemaphoreGive(s_lock);
+}
+
+static size_t ready_num(void)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    size_t num = s_ready_num;
+    xSemaphoreGive(s_lock);
+    return num;
+}
+
+static ready_t ready_get(size_t index)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    ready_t ready = s_ready[index];
+    xSemaphoreGive(s_lock);
+    return ready;
+}
+
+static img_cache_stats_t stats_get(void)
+{
+    img_cache_stats_t stats = { 0 };
+    img_cache_get_stats(&stats);
+    return stats;
+}
+
+/* Loads the cache task is done with, decoded or failed */
+static uint32_t done_num(void)
+{
+    img_cache_stats_t stats = stats_get();
+    return stats.decodes + stats.decode_failures;
+}
+
+static void wait_done(uint32_t num)
+{
+    for (int i = 0; (i < 400) && (done_num() < num); i++) {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+}
+
+static void wait_ready(size_t num)
+{
+    for (int i = 0; (i < 400) && (ready_num() < num); i++) {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+}
+
+static void wait_loads(size_t num)
+{
+    for (int i = 0; (i < 400) && (port_asset_loads(NULL, 0) < num); i++) {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+}
+
+/* The loads from `first` on are the given names, in that order */
+static bool loaded_in_order(size_t first, const char *const *names, size_t num)
+{
+    const char *loads[TEST_MAX_LOADS];
+    size_t total = port_asset_loads(loads, TEST_MAX_LOADS);
+
+    if (total != first + num) {
+        return false;
+    }
+    for (size_t i = 0; i < num; i++) {
+        if (strcmp(loads[first + i], names[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static esp_err_t get(const char *name, const lv_img_dsc_t **img)
+{
+    const lv_img_dsc_t *unused;
+    return img_cache_get(name, img ? img : &unused, on_ready, NULL);
+}
+
+/* A hit, released at once */
+static bool cached(const char *name)
+{
+    const lv_img_dsc_t *img = NULL;
+    bool hit = (ESP_OK == get(name, &img));
+    img_cache_release(hit ? img : NULL);
+    return hit;
+}
+
+static void test_hit(void)
+{
+    const lv_img_dsc_t *img = NULL;
+
+    port_asset_set_delay(TEST_DECODE_MS);
+    check(ESP_ERR_NOT_FINISHED == get("a.png", NULL), "miss queued");
+    wait_ready(1);
+    ready_t ready = ready_get(0);
+    check((1 == ready_num()) && !strcmp(ready.name, "a.png") && ready.img, "called back with the image");
+    check(ready.img && (TEST_SIDE == ready.img->header.w) && (TEST_SIDE == ready.img->header.h) &&
+          (LV_IMG_CF_TRUE_COLOR_ALPHA == ready.img->header.cf) && (TEST_IMG_SIZE == ready.img->data_size),
+          "true color image with alpha");
+    check(img_cache_decode_time_us(ready.img) >= TEST_DECODE_MS * 1000, "decode time of the image");
+    check((ESP_OK == get("a.png", &img)) && (img == ready.img), "hit, the same image");
+
+    img_cache_stats_t stats = stats_get();
+    check((1 == stats.hits) && (1 == stats.misses) && (1 == stats.decodes) && (1 == stats.images) &&
+          (TEST_IMG_SIZE == stats.used), "statistics");
+    img_cache_release(img);
+    img_cache_release(ready.img);
+    port_asset_set_delay(0);
+}
+
+/*
+ * With the decoder held on a prefetch: more prefetches, a request, and requests for a queued prefetch and for the
+ * one being decoded. The requests go first, in their order, and each image is decoded once.
+ */
+static void test_queue(void)
+{
+    static const char *const order[] = {"p1.png", "g1.png", "p3.png", "p2.png"};
+    size_t first = port_asset_loads(NULL, 0);
+    uint32_t done = done_num();
+
+    port_asset_hold(true);
+    check(ESP_OK == img_cache_prefetch("p1.png"), "prefetch");
+    wait_loads(first + 1);
+    check((ESP_OK == img_cache_prefetch("p2.png")) && (ESP_OK == img_cache_prefetch("p3.png")) &&
+          (ESP_OK == img_cache_prefetch("p2.png")), "more prefetches, one twice");
+    check(ESP_ERR_NOT_FINISHED == get("g1.png", NULL), "request while decoding");
+    check(ESP_ERR_NOT_FINISHED == get("p3.png", NULL), "request for a queued prefetch");
+    check(ESP_ERR_NOT_FINISHED == get("p1.png", NULL), "request for the prefetch being decoded");
+    port_asset_hold(false);
+    wait_done(done + 4);
+    wait_ready(4);
+
+    check(loaded_in_order(first, order, 4), "requests decoded ahead of the prefetches, once each");
+    bool in_order = (4 == ready_num());
+    for (size_t i = 0; in_order && (i < 3); i++) {
+        ready_t ready = ready_get(1 + i);
+        in_order = !strcmp(ready.name, order[i]) && ready.img;
+    }
+    check(in_order, "each request called back once, in order");
+
+    /* Three pinned images: a.png made room for the last one, nothing was left for the prefetch of p2.png */
+    img_cache_stats_t stats = stats_get();
+    check((1 == stats.evictions) && (3 == stats.images) && (3 * TEST_IMG_SIZE == stats.used) &&
+          (3 == port_asset_live()), "unpinned image evicted, the prefetch dropped");
+}
+
+static void test_pinning(void)
+{
+    check(ESP_ERR_NOT_FINISHED == get("b.png", NULL), "request with the cache full of pinned images");
+    wait_ready(5);
+    img_cache_stats_t stats = stats_get();
+    check(ready_get(4).img && (4 * TEST_IMG_SIZE == stats.used) && (stats.used > TEST_CAPACITY),
+          "image on display cached over the capacity");
+
+    /* p1.png, the least recently used of the images on display */
+    img_cache_release(ready_get(1).img);
+    stats = stats_get();
+    check((2 == stats.evictions) && (3 == stats.images) && (3 * TEST_IMG_SIZE == stats.used) &&
+          (3 == port_asset_live()), "released image evicted, back under the capacity");
+}
+
+static void test_eviction(void)
+{
+    size_t first = port_asset_loads(NULL, 0);
+    uint32_t done = done_num();
+
+    /* g1.png, p3.png and b.png */
+    for (size_t i = 2; i <= 4; i++) {
+        img_cache_release(ready_get(i).img);
+    }
+    img_cache_stats_t stats = stats_get();
+    check((2 == stats.evictions) && (3 == stats.images), "images released, nothing evicted under the capacity");
+
+    /* From the most recently used: g1.png, b.png, p3.png */
+    check(cached("g1.png"), "hit");
+    check(ESP_OK == img_cache_prefetch("c.png"), "prefetch with the cache full");
+    wait_done(done + 1);
+    stats = stats_get();
+    check((3 == stats.evictions) && (3 == stats.images) && (3 == port_asset_live()), "one image evicted for it");
+    check(cached("c.png") && cached("g1.png") && cached("b.png"),
+          "the least recently used one evicted, the others kept");
+    check((ESP_OK == img_cache_prefetch("c.png")) && (first + 1 == port_asset_loads(NULL, 0)),
+          "prefetch of a cached image does nothing");
+}
+
+static void test_failure(void)
+{
+    size_t num = ready_num();
+    uint32_t done = done_num();
+
+    check(ESP_ERR_NOT_FINISHED == get("missing.png", NULL), "request for a missing image");
+    wait_ready(num + 1);
+    check((num + 1 == ready_num()) && !ready_get(num).img, "called back without an image");
+    check(ESP_OK == img_cache_prefetch("missing.png"), "prefetch of a missing image");
+    wait_done(done + 2);
+    check(2 == stats_get().decode_failures, "failures counted");
+}
+
+static void test_full_queue(void)
+{
+    static const char *const order[] = {
+        "q0.png", "q9.png", "q1.png", "q2.png", "q3.png", "q4.png", "q5.png", "q6.png", "q7.png",
+    };
+    size_t first = port_asset_loads(NULL, 0);
+    size_t num = ready_num();
+    uint32_t done = done_num();
+    bool queued = true;
+    char name[16];
+
+    port_asset_hold(true);
+    check(ESP_OK == img_cache_prefetch("q0.png"), "prefetch");
+    wait_loads(first + 1);
+    for (int i = 1; i <= TEST_QUEUE_LEN; i++) {
+        snprintf(name, sizeof(name), "q%d.png", i);
+        queued &= (ESP_OK == img_cache_prefetch(name));
+    }
+    check(queued, "queue filled with prefetches");
+    check(ESP_ERR_NO_MEM == img_cache_prefetch("q9.png"), "one more prefetch rejected");
+    check(ESP_ERR_NOT_FINISHED == get("q9.png", NULL), "request queued in place of the last prefetch");
+    port_asset_hold(false);
+    wait_done(done + 9);
+    wait_ready(num + 1);
+    check(loaded_in_order(first, order, 9), "request decoded first, the last prefetch dropped");
+    check((num + 1 == ready_num()) && !strcmp(ready_get(num).name, "q9.png"), "request called back");
+    img_cache_release(ready_get(num).img);
+    check(port_asset_live() <= 3, "back under the capacity");
+}
+
+static void test_invalid(void)
+{
+    img_cache_config_t config = {
+        .base_path = "/spiffs",
+        .capacity = TEST_CAPACITY,
+    };
+    const lv_img_dsc_t *img = NULL;
+    char name[80];
+
+    memset(name, 'x', sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    check(ESP_ERR_INVALID_STATE == img_cache_init(&config), "initialized twice");
+    check(ESP_ERR_INVALID_ARG == img_cache_init(NULL), "no configuration");
+    check(ESP_ERR_INVALID_ARG == get(NULL, NULL), "no name");
+    check(ESP_ERR_INVALID_ARG == get(name, NULL), "name too long");
+    check(ESP_ERR_INVALID_ARG == img_cache_get("a.png", NULL, on_ready, NULL), "no image output");
+    check(ESP_ERR_INVALID_ARG == img_cache_get("a.png", &img, NULL, NULL), "no callback");
+    check(ESP_ERR_INVALID_ARG == img_cache_prefetch(NULL), "no prefetch name");
+    check(ESP_ERR_INVALID_ARG == img_cache_get_stats(NULL), "no statistics output");
+    img_cache_release(NULL);
+}
+
+int main(int argc, char **argv)
+{
+    img_cache_config_t config = {
+        .base_path = "/spiffs",
+        .capacity = TEST_CAPACITY,
+        .task_priority = 5,
+        .task_core = tskNO_AFFINITY,
+    };
+    img_cache_stats_t stats;
+    bool verbose = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    /* The missing image and the invalid arguments log on purpose */
+    port_log_level = verbose ? ESP_LOG_INFO : ESP_LOG_NONE;
+    s_lock = xSemaphoreCreateMutex();
+    for (size_t i = 0; i < sizeof(s_names) / sizeof(s_names[0]); i++) {
+        port_asset_add(s_names[i], TEST_SIDE, TEST_SIDE);
+    }
+
+    printf("Before initialization\n");
+    check(ESP_ERR_INVALID_STATE == get("a.png", NULL), "no request");
+    check(ESP_ERR_INVALID_STATE == img_cache_prefetch("a.png"), "no prefetch");
+    check(ESP_ERR_INVALID_STATE == img_cache_get_stats(&stats), "no statistics");
+    check(ESP_OK == img_cache_init(&config), "initialized");
+    printf("\nMiss and hit\n");
+    test_hit();
+    printf("\nQueueing\n");
+    test_queue();
+    printf("\nPinning\n");
+    test_pinning();
+    printf("\nEviction\n");
+    test_eviction();
+    printf("\nFailures\n");
+    test_failure();
+    printf("\nFull queue\n");
+    test_full_queue();
+    printf("\nInvalid arguments\n");
+    test_invalid();
+
+    stats = stats_get();
+    printf("\n  %-24s %6" PRIu32 "\n  %-24s %6" PRIu32 "\n  %-24s %6" PRIu32 "\n  %-24s %6" PRIu32 "\n",
+           "hits", stats.hits, "misses", stats.misses, "decodes", stats.decodes, "evictions", stats.evictions);
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
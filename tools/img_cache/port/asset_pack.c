@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "asset_pack.h"
+#include "port_asset_pack.h"
+
+#define ASSET_MAX       (32)
+#define ASSET_LOADS_MAX (128)
+
+static asset_pack_entry_t s_assets[ASSET_MAX];
+static size_t s_asset_num;
+static const char *s_loads[ASSET_LOADS_MAX];
+static size_t s_load_num;
+static size_t s_live;
+static uint32_t s_delay_ms;
+static bool s_hold;
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_released = PTHREAD_COND_INITIALIZER;
+
+void port_asset_add(const char *name, uint16_t w, uint16_t h)
+{
+    asset_pack_entry_t *entry = &s_assets[s_asset_num++];
+
+    strncpy(entry->name, name, sizeof(entry->name) - 1);
+    entry->type = ASSET_PACK_TYPE_IMAGE;
+    entry->format = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    entry->width = w;
+    entry->height = h;
+    entry->size = w * h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+}
+
+void port_asset_set_delay(uint32_t ms)
+{
+    pthread_mutex_lock(&s_lock);
+    s_delay_ms = ms;
+    pthread_mutex_unlock(&s_lock);
+}
+
+void port_asset_hold(bool hold)
+{
+    pthread_mutex_lock(&s_lock);
+    s_hold = hold;
+    pthread_cond_broadcast(&s_released);
+    pthread_mutex_unlock(&s_lock);
+}
+
+size_t port_asset_loads(const char **names, size_t max)
+{
+    pthread_mutex_lock(&s_lock);
+    size_t num = s_load_num;
+    for (size_t i = 0; names && (i < num) && (i < max); i++) {
+        names[i] = s_loads[i];
+    }
+    pthread_mutex_unlock(&s_lock);
+    return num;
+}
+
+size_t port_asset_live(void)
+{
+    pthread_mutex_lock(&s_lock);
+    size_t live = s_live;
+    pthread_mutex_unlock(&s_lock);
+    return live;
+}
+
+const asset_pack_entry_t *asset_pack_find(const char *name)
+{
+    for (size_t i = 0; i < s_asset_num; i++) {
+        if (0 == strcmp(s_assets[i].name, name)) {
+            return &s_assets[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Load an image as the real one reads it into PSRAM: the pixels filled with its index, after the delay
+ */
+esp_err_t asset_pack_image_load(const char *name, lv_img_dsc_t *img)
+{
+    const asset_pack_entry_t *entry = asset_pack_find(name);
+    if (!entry || !img) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    pthread_mutex_lock(&s_lock);
+    if (s_load_num < ASSET_LOADS_MAX) {
+        s_loads[s_load_num] = entry->name;
+    }
+    s_load_num++;
+    while (s_hold) {
+        pthread_cond_wait(&s_released, &s_lock);
+    }
+    uint32_t delay_ms = s_delay_ms;
+    pthread_mutex_unlock(&s_lock);
+
+    struct timespec ts = {
+        .tv_sec = delay_ms / 1000,
+        .tv_nsec = (long)(delay_ms % 1000) * 1000000,
+    };
+    nanosleep(&ts, NULL);
+
+    uint8_t *data = malloc(entry->size);
+    if (!data) {
+        return ESP_ERR_NO_MEM;
+    }
+    memset(data, entry - s_assets, entry->size);
+    *img = (lv_img_dsc_t) {
+        .header.cf = entry->format,
+        .header.w = entry->width,
+        .header.h = entry->height,
+        .data_size = entry->size,
+        .data = data,
+    };
+    pthread_mutex_lock(&s_lock);
+    s_live++;
+    pthread_mutex_unlock(&s_lock);
+    return ESP_OK;
+}
+
+void asset_pack_free(const void *data)
+{
+    if (data) {
+        free((void *)data);
+        pthread_mutex_lock(&s_lock);
+        s_live--;
+        pthread_mutex_unlock(&s_lock);
+    }
+}
@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* The subset of LVGL 8 image descriptors used by img_cache, for a 16 bit display without the PNG decoder */
+
+#define LV_COLOR_DEPTH              16
+#define LV_IMG_PX_SIZE_ALPHA_BYTE   3
+#define LV_USE_PNG                  0
+
+enum {
+    LV_IMG_CF_TRUE_COLOR = 4,
+    LV_IMG_CF_TRUE_COLOR_ALPHA = 5,
+};
+
+typedef struct {
+    uint32_t cf : 5;
+    uint32_t always_zero : 3;
+    uint32_t reserved : 2;
+    uint32_t w : 11;
+    uint32_t h : 11;
+} lv_img_header_t;
+
+typedef struct {
+    lv_img_header_t header;
+    uint32_t data_size;
+    const uint8_t *data;
+} lv_img_dsc_t;
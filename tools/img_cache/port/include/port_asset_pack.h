@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Control of the fake asset pack of asset_pack.c, which serves the images the test adds */
+
+/**
+ * @brief Add an image of w x h true color pixels with alpha
+ */
+void port_asset_add(const char *name, uint16_t w, uint16_t h);
+
+/**
+ * @brief Time each image takes to load
+ */
+void port_asset_set_delay(uint32_t ms);
+
+/**
+ * @brief Hold the loads from their start until called again with false
+ */
+void port_asset_hold(bool hold);
+
+/**
+ * @brief Names of the images loaded so far, in the order the loads started
+ *
+ * @return Number of loads, may be more than max
+ */
+size_t port_asset_loads(const char **names, size_t max);
+
+/**
+ * @brief Images loaded and not freed
+ */
+size_t port_asset_live(void);
+
+#ifdef __cplusplus
+}
+#endif
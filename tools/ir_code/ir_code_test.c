@@ -0,0 +1,394 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include "app_ir_code.h"
+#include "app_ir_store.h"
+#include "app_ir_tx.h"
+
+#define TEST_MAX_SYMBOLS    (600)
+#define TEST_MAX_FRAMES     (4)
+#define TEST_RANDOM_CODES   (2000)
+
+/* A command as ir_learn records it */
+typedef struct {
+    rmt_symbol_word_t symbols[TEST_MAX_FRAMES][TEST_MAX_SYMBOLS];
+    app_ir_tx_frame_t frames[TEST_MAX_FRAMES];
+    app_ir_proto_t protocols[TEST_MAX_FRAMES];
+    size_t num_frames;
+} test_command_t;
+
+static int s_failures;
+static uint32_t s_seed = 1;
+static bool s_verbose;
+
+/* The frames app_ir_store_send() hands to the transmitter */
+static test_command_t s_sent;
+
+static uint32_t test_rand(void)
+{
+    /* xorshift32, the same codes on every host */
+    s_seed ^= s_seed << 13;
+    s_seed ^= s_seed >> 17;
+    s_seed ^= s_seed << 5;
+    return s_seed;
+}
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-60s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+esp_err_t app_ir_tx_send(const app_ir_tx_frame_t *frames, size_t num_frames, TickType_t ticks_to_wait)
+{
+    memset(&s_sent, 0, sizeof(s_sent));
+    for (size_t i = 0; (i < num_frames) && (i < TEST_MAX_FRAMES); i++) {
+        memcpy(s_sent.symbols[i], frames[i].symbols, frames[i].num_symbols * sizeof(rmt_symbol_word_t));
+        s_sent.frames[i] = frames[i];
+        s_sent.frames[i].symbols = s_sent.symbols[i];
+    }
+    s_sent.num_frames = num_frames;
+    return ESP_OK;
+}
+
+/* Receiver distortion: marks up to 100 us longer, spaces as much shorter, plus a little noise */
+static void put(rmt_symbol_word_t *s, uint32_t mark, uint32_t space, int distortion)
+{
+    const int noise = (int)(test_rand() % 41) - 20;
+    s->level0 = 1;
+    s->duration0 = mark + distortion + noise;
+    s->level1 = 0;
+    s->duration1 = space ? space - distortion - noise : 0;
+}
+
+static size_t make_pulse_distance(rmt_symbol_word_t *s, uint32_t header_mark, uint32_t header_space, uint32_t bit_mark,
+                                  uint32_t zero_space, uint32_t one_space, const uint8_t *bits, size_t nbits)
+{
+    const int distortion = (int)(test_rand() % 201) - 100;
+    size_t n = 0;
+
+    put(&s[n++], header_mark, header_space, distortion);
+    for (size_t i = 0; i < nbits; i++) {
+        put(&s[n++], bit_mark, (bits[i / 8] & (1 << (i % 8))) ? one_space : zero_space, distortion);
+    }
+    put(&s[n++], bit_mark, 0, distortion);
+    return n;
+}
+
+static size_t make_nec(rmt_symbol_word_t *s, uint8_t address, uint8_t command)
+{
+    const uint8_t bits[4] = {address, (uint8_t)~address, command, (uint8_t)~command};
+    return make_pulse_distance(s, 9000, 4500, 560, 560, 1690, bits, 32);
+}
+
+/* Manchester halves of 889 us, without the space of the first start bit, which the receiver does not see */
+static size_t make_rc5(rmt_symbol_word_t *s, uint16_t value)
+{
+    uint32_t runs[28];
+    size_t num_runs = 0;
+    int level = 0;
+    size_t n = 0;
+
+    for (size_t h = 1; h < 28; h++) {
+        const int bit = (value >> (13 - h / 2)) & 1;
+        const int half = (h % 2) ? bit : !bit;
+        if (num_runs && (half == level)) {
+            runs[num_runs - 1] += 889;
+        } else {
+            runs[num_runs++] = 889;
+            level = half;
+        }
+    }
+    for (size_t i = 0; i < num_runs; i += 2) {
+        put(&s[n++], runs[i], (i + 1 < num_runs) ? runs[i + 1] : 0, 0);
+    }
+    /* A space at the end merges into the idle line */
+    s[n - 1].duration1 = 0;
+    return n;
+}
+
+/* Marks and spaces of random lengths, which no protocol matches */
+static size_t make_raw(rmt_symbol_word_t *s, size_t max)
+{
+    const size_t n = 3 + test_rand() % (max - 3);
+    for (size_t i = 0; i < n; i++) {
+        put(&s[i], 200 + test_rand() % 9000, (i + 1 < n) ? 200 + test_rand() % 9000 : 0, 0);
+    }
+    return n;
+}
+
+static void add_frame(test_command_t *cmd, size_t num_symbols, app_ir_proto_t protocol)
+{
+    app_ir_tx_frame_t *frame = &cmd->frames[cmd->num_frames];
+    frame->symbols = cmd->symbols[cmd->num_frames];
+    frame->num_symbols = num_symbols;
+    frame->gap_us = cmd->num_frames ? 5000 + test_rand() % 100000 : 0;
+    cmd->protocols[cmd->num_frames] = protocol;
+    cmd->num_frames++;
+}
+
+/* One to four frames of any protocol, as a remote sends them */
+static void make_command(test_command_t *cmd)
+{
+    uint8_t bits[512 / 8];
+
+    memset(cmd, 0, sizeof(*cmd));
+    const size_t num_frames = 1 + test_rand() % TEST_MAX_FRAMES;
+    while (cmd->num_frames < num_frames) {
+        rmt_symbol_word_t *s = cmd->symbols[cmd->num_frames];
+        switch (test_rand() % 4) {
+        case 0:
+            add_frame(cmd, make_nec(s, test_rand(), test_rand()), APP_IR_PROTO_NEC);
+            break;
+        case 1:
+            add_frame(cmd, make_rc5(s, 0x2000 | (test_rand() & 0x1fff)), APP_IR_PROTO_RC5);
+            break;
+        case 2: {
+            /* Air conditioner frames, from 8 to 512 bits, but 32, which may be NEC frames */
+            size_t nbits = 8 + test_rand() % (512 - 8 + 1);
+            nbits += (32 == nbits);
+            for (size_t i = 0; i < sizeof(bits); i++) {
+                bits[i] = test_rand();
+            }
+            /* At least one 0 and one 1, else the two spaces cannot be told apart */
+            bits[0] = (bits[0] & ~3) | 1;
+            add_frame(cmd, make_pulse_distance(s, 3000 + test_rand() % 6000, 1500 + test_rand() % 3000,
+                                               400 + test_rand() % 200, 400 + test_rand() % 200,
+                                               1200 + test_rand() % 500, bits, nbits), APP_IR_PROTO_PULSE_DISTANCE);
+            break;
+        }
+        default:
+            add_frame(cmd, make_raw(s, 200), APP_IR_PROTO_RAW);
+            break;
+        }
+    }
+}
+
+/* Same tolerance as the receiver, a mark may come out 100 us longer or shorter */
+static bool near(uint32_t value, uint32_t ref)
+{
+    const uint32_t diff = (value > ref) ? value - ref : ref - value;
+    return diff <= ref / 4 + 100;
+}
+
+/* The decoded command sends the learned one: same frames, gaps and symbols, each duration within tolerance */
+static bool same_command(const test_command_t *learned, const app_ir_tx_frame_t *frames, size_t num_frames)
+{
+    if (num_frames != learned->num_frames) {
+        return false;
+    }
+    for (size_t f = 0; f < num_frames; f++) {
+        const app_ir_tx_frame_t *a = &learned->frames[f];
+        const app_ir_tx_frame_t *b = &frames[f];
+        if ((b->num_symbols != a->num_symbols) || (f && (b->gap_us != a->gap_us))) {
+            return false;
+        }
+        for (size_t i = 0; i < a->num_symbols; i++) {
+            const rmt_symbol_word_t *x = &a->symbols[i];
+            const rmt_symbol_word_t *y = &b->symbols[i];
+            /* A learned frame ends in the idle line, whatever space the decoded one ends with */
+            const bool idle = (i + 1 == a->num_symbols) && (0 == x->duration1);
+            if ((x->level0 != y->level0) || !near(y->duration0, x->duration0) ||
+                    (!idle && !near(y->duration1, x->duration1))) {
+                return false;
+            }
+            /* Raw frames are kept as they are */
+            if ((APP_IR_PROTO_RAW == learned->protocols[f]) && (x->val != y->val)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void test_round_trip(void)
+{
+    test_command_t cmd;
+    size_t code_bytes = 0;
+    size_t symbol_bytes = 0;
+    int protocols_ok = 0, decoded_ok = 0, stable_ok = 0, truncated_ok = 0, corrupt_ok = 0;
+
+    for (int c = 0; c < TEST_RANDOM_CODES; c++) {
+        uint8_t *code = NULL;
+        size_t size = 0;
+        app_ir_tx_frame_t *frames = NULL;
+        size_t num_frames = 0;
+
+        make_command(&cmd);
+        if (ESP_OK != app_ir_code_encode(cmd.frames, cmd.num_frames, &code, &size)) {
+            continue;
+        }
+        code_bytes += size;
+        for (size_t f = 0; f < cmd.num_frames; f++) {
+            symbol_bytes += cmd.frames[f].num_symbols * sizeof(rmt_symbol_word_t);
+        }
+
+        bool protocols = true;
+        for (size_t f = 0; f < cmd.num_frames; f++) {
+            protocols &= (cmd.protocols[f] == app_ir_code_get_protocol(code, size, f, NULL));
+        }
+        protocols_ok += protocols;
+
+        if (ESP_OK == app_ir_code_decode(code, size, &frames, &num_frames)) {
+            decoded_ok += same_command(&cmd, frames, num_frames);
+
+            /* Encoding what was decoded gives the same code */
+            uint8_t *again = NULL;
+            size_t again_size = 0;
+            if (ESP_OK == app_ir_code_encode(frames, num_frames, &again, &again_size)) {
+                stable_ok += (again_size == size) && (0 == memcmp(again, code, size));
+            }
+            free(again);
+            free(frames);
+        }
+
+        /* Every truncated code is rejected */
+        bool truncated = true;
+        for (size_t len = 0; len < size; len++) {
+            frames = NULL;
+            truncated &= (ESP_OK != app_ir_code_decode(code, len, &frames, &num_frames)) && !frames;
+            app_ir_code_get_protocol(code, len, 0, NULL);
+        }
+        truncated_ok += truncated;
+
+        /* A corrupted byte is either rejected or decodes to some frames, it is never read out of bounds */
+        for (int k = 0; k < 8; k++) {
+            code[test_rand() % size] ^= 1 << (test_rand() % 8);
+            if (ESP_OK == app_ir_code_decode(code, size, &frames, &num_frames)) {
+                free(frames);
+            }
+        }
+        corrupt_ok++;
+        free(code);
+    }
+
+    char what[96];
+    printf("\n%d random commands of NEC, RC5, pulse distance and raw frames\n", TEST_RANDOM_CODES);
+    printf("  %zu bytes of codes for %zu bytes of symbols, %.1f%%\n", code_bytes, symbol_bytes,
+           100.0 * code_bytes / symbol_bytes);
+    snprintf(what, sizeof(what), "protocol recognized, %d of %d", protocols_ok, TEST_RANDOM_CODES);
+    check(protocols_ok == TEST_RANDOM_CODES, what);
+    snprintf(what, sizeof(what), "decoded frames match the learned ones, %d of %d", decoded_ok, TEST_RANDOM_CODES);
+    check(decoded_ok == TEST_RANDOM_CODES, what);
+    snprintf(what, sizeof(what), "encoding the decoded frames gives the same code, %d of %d", stable_ok,
+             TEST_RANDOM_CODES);
+    check(stable_ok == TEST_RANDOM_CODES, what);
+    snprintf(what, sizeof(what), "every truncation rejected, %d of %d", truncated_ok, TEST_RANDOM_CODES);
+    check(truncated_ok == TEST_RANDOM_CODES, what);
+    check(corrupt_ok == TEST_RANDOM_CODES, "corrupted codes decoded or rejected");
+}
+
+/* The NVS key of a command, as app_ir_store.c derives it */
+static void store_key(const char *device, const char *command, int probe, char *key)
+{
+    uint32_t hash = 2166136261u;
+    for (const char *p = device; *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+    hash = (hash ^ 0xff) * 16777619u;
+    for (const char *p = command; *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+    snprintf(key, NVS_KEY_NAME_MAX_SIZE, "%08" PRIx32 "_%d", hash, probe);
+}
+
+static struct ir_learn_sub_list_head *learned_list(test_command_t *cmd)
+{
+    static struct ir_learn_sub_list_head head;
+    static ir_learn_sub_list_t subs[TEST_MAX_FRAMES];
+
+    SLIST_INIT(&head);
+    for (size_t i = cmd->num_frames; i-- > 0;) {
+        subs[i].timediff = cmd->frames[i].gap_us;
+        subs[i].symbols.received_symbols = cmd->symbols[i];
+        subs[i].symbols.num_symbols = cmd->frames[i].num_symbols;
+        SLIST_INSERT_HEAD(&head, &subs[i], next);
+    }
+    return &head;
+}
+
+static void test_store(void)
+{
+    test_command_t cmd, cmd2;
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    const uint8_t other[] = {2, 't', 'v', 3, 'o', 'f', 'f'};
+
+    printf("\nStore\n");
+    make_command(&cmd);
+    make_command(&cmd2);
+    check(ESP_ERR_INVALID_STATE == app_ir_store_save_learned("ac", "on", learned_list(&cmd)), "save before init fails");
+    check(ESP_OK == app_ir_store_init(), "init");
+
+    check(ESP_OK == app_ir_store_save_learned("ac", "on", learned_list(&cmd)), "new command saved");
+    check(app_ir_store_exists("ac", "on") && !app_ir_store_exists("ac", "off"), "saved command found, other not");
+    check((ESP_OK == app_ir_store_send("ac", "on", 0)) && same_command(&cmd, s_sent.frames, s_sent.num_frames),
+          "sent frames match the learned ones");
+    check(ESP_OK == app_ir_store_save_learned("ac", "on", learned_list(&cmd2)), "command replaced");
+    check((1 == port_nvs_count()) && (ESP_OK == app_ir_store_send("ac", "on", 0)) &&
+          same_command(&cmd2, s_sent.frames, s_sent.num_frames), "one key, with the new frames");
+    check(ESP_ERR_NOT_FOUND == app_ir_store_send("ac", "off", 0), "unknown command not sent");
+
+    /* Other names on the first keys of the probe sequence */
+    for (int probe = 0; probe < 3; probe++) {
+        store_key("fan", "speed", probe, key);
+        nvs_set_blob(1, key, other, sizeof(other));
+    }
+    check(ESP_OK == app_ir_store_save_learned("fan", "speed", learned_list(&cmd)), "saved past three taken keys");
+    check((ESP_OK == app_ir_store_send("fan", "speed", 0)) && same_command(&cmd, s_sent.frames, s_sent.num_frames),
+          "found past three taken keys");
+    check((ESP_OK == app_ir_store_erase("fan", "speed")) && !app_ir_store_exists("fan", "speed"), "erased");
+    store_key("fan", "speed", 3, key);
+    nvs_set_blob(1, key, other, sizeof(other));
+    const size_t keys = port_nvs_count();
+    check((ESP_ERR_NO_MEM == app_ir_store_save_learned("fan", "speed", learned_list(&cmd))) &&
+          (keys == port_nvs_count()), "no free key: not saved");
+
+    /* A key of the probe sequence that cannot be read is an error, nothing is written to another key */
+    store_key("ac", "on", 0, key);
+    port_nvs_set_oversize(key);
+    check((ESP_ERR_NO_MEM == app_ir_store_save_learned("ac", "on", learned_list(&cmd))) && (keys == port_nvs_count()),
+          "lookup out of memory: error returned, not saved");
+    check(ESP_ERR_NO_MEM == app_ir_store_erase("ac", "on"), "lookup out of memory: not erased");
+    port_nvs_set_oversize(NULL);
+    check((ESP_OK == app_ir_store_send("ac", "on", 0)) && same_command(&cmd2, s_sent.frames, s_sent.num_frames),
+          "previous code kept");
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:v")) != -1) {
+        switch (opt) {
+        case 's':
+            s_seed = strtoul(optarg, NULL, 0) ? strtoul(optarg, NULL, 0) : 1;
+            break;
+        case 'v':
+            s_verbose = true;
+            port_log_level = ESP_LOG_DEBUG;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-s <seed>] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    /* Truncated codes and lookups that fail on purpose log errors */
+    port_log_level = s_verbose ? port_log_level : ESP_LOG_NONE;
+    test_round_trip();
+    test_store();
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
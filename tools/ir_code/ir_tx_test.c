@@ -0,0 +1,250 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "driver/rmt_tx.h"
+#include "app_ir_tx.h"
+
+#define TEST_MAX_SYMBOLS    (256)
+#define TEST_NEC_SYMBOLS    (34)            /* Leader, 32 bits and the stop bit */
+#define TEST_REPEAT_GAP_US  (100001)        /* More than one idle symbol can hold */
+#define TEST_MAX_HALF       (0x7fff)
+/* Margin over the time on air, for the scheduling of the host */
+#define TEST_MARGIN_US      (20000)
+
+/* A learned command: an NEC frame, then a repeat frame with the zero duration end marker of the receiver */
+typedef struct {
+    rmt_symbol_word_t nec[TEST_NEC_SYMBOLS];
+    rmt_symbol_word_t repeat[3];
+    app_ir_tx_frame_t frames[2];
+} test_command_t;
+
+static int s_failures;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-60s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+static rmt_symbol_word_t symbol(uint32_t high_us, uint32_t low_us)
+{
+    return (rmt_symbol_word_t) {
+        .level0 = 1, .duration0 = high_us, .level1 = 0, .duration1 = low_us,
+    };
+}
+
+static void command_make(test_command_t *cmd, uint32_t code)
+{
+    cmd->nec[0] = symbol(9000, 4500);
+    for (int i = 0; i < 32; i++) {
+        cmd->nec[1 + i] = symbol(560, ((code >> i) & 1) ? 1690 : 560);
+    }
+    /* The receiver ends a frame on its idle timeout, the last low half is not measured */
+    cmd->nec[33] = symbol(560, 0);
+    cmd->repeat[0] = symbol(9000, 2250);
+    cmd->repeat[1] = symbol(560, 0);
+    cmd->repeat[2] = symbol(0, 0);
+    cmd->frames[0] = (app_ir_tx_frame_t) {
+        .symbols = cmd->nec, .num_symbols = TEST_NEC_SYMBOLS,
+    };
+    cmd->frames[1] = (app_ir_tx_frame_t) {
+        .symbols = cmd->repeat, .num_symbols = 3, .gap_us = TEST_REPEAT_GAP_US,
+    };
+}
+
+/* Time on air of the frames, a missing low half lasting the 1 us it is sent for */
+static uint32_t frames_duration_us(const app_ir_tx_frame_t *frames, size_t num_frames)
+{
+    uint32_t duration_us = 0;
+
+    for (size_t f = 0; f < num_frames; f++) {
+        duration_us += (f > 0) ? frames[f].gap_us : 0;
+        for (size_t i = 0; (i < frames[f].num_symbols) && frames[f].symbols[i].duration0; i++) {
+            const rmt_symbol_word_t *symbol = &frames[f].symbols[i];
+            duration_us += symbol->duration0 + (symbol->duration1 ? symbol->duration1 : 1);
+        }
+    }
+    return duration_us;
+}
+
+static void wait_sent(uint32_t commands)
+{
+    app_ir_tx_stats_t stats;
+
+    for (int i = 0; i < 1000; i++) {
+        app_ir_tx_get_stats(&stats);
+        if (stats.commands >= commands) {
+            return;
+        }
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+}
+
+/* The symbols played: the frames, with idle symbols in the gaps */
+static bool played_as(const test_command_t *cmd, const rmt_symbol_word_t *played, size_t num)
+{
+    size_t gap_symbols = (TEST_REPEAT_GAP_US + 2 * TEST_MAX_HALF - 1) / (2 * TEST_MAX_HALF);
+    size_t p = 0;
+
+    if (num != TEST_NEC_SYMBOLS + gap_symbols + 2) {
+        return false;
+    }
+    for (size_t i = 0; i < TEST_NEC_SYMBOLS - 1; i++, p++) {
+        if (played[p].val != cmd->nec[i].val) {
+            return false;
+        }
+    }
+    p++;
+    uint32_t gap_us = 0;
+    for (size_t i = 0; i < gap_symbols; i++, p++) {
+        if (played[p].level0 || played[p].level1) {
+            return false;
+        }
+        gap_us += played[p].duration0 + played[p].duration1;
+    }
+    return (TEST_REPEAT_GAP_US == gap_us) && (played[p].val == cmd->repeat[0].val);
+}
+
+static void test_command(void)
+{
+    test_command_t *cmd = malloc(sizeof(test_command_t));
+    rmt_symbol_word_t played[TEST_MAX_SYMBOLS];
+    app_ir_tx_stats_t stats;
+    uint32_t duration_us = 0;
+    bool halves = true;
+    char what[80];
+
+    command_make(cmd, 0x20df10ef);
+    uint32_t expected_us = frames_duration_us(cmd->frames, 2);
+    check(ESP_OK == app_ir_tx_send(cmd->frames, 2, portMAX_DELAY), "NEC command with a repeat frame queued");
+    /* The transmitter copied the frames, the caller may free them at once */
+    free(cmd);
+    cmd = malloc(sizeof(test_command_t));
+    command_make(cmd, 0x20df10ef);
+    wait_sent(1);
+
+    size_t num = port_rmt_last(played, TEST_MAX_SYMBOLS, &duration_us);
+    check(played_as(cmd, played, num), "one sequence, the 100.001 ms gap as two idle symbols");
+    for (size_t i = 0; i < num; i++) {
+        halves &= played[i].duration0 && played[i].duration1;
+    }
+    check(halves, "no zero half, the whole command played");
+    snprintf(what, sizeof(what), "time on air %" PRIu32 " us, the frames and the gap", expected_us);
+    check(duration_us == expected_us, what);
+
+    app_ir_tx_get_stats(&stats);
+    check((1 == stats.commands) && (stats.last_duration_us >= expected_us) &&
+          (stats.last_duration_us < expected_us + TEST_MARGIN_US), "statistics of the command");
+    printf("  %-24s %6" PRIu32 " us\n  %-24s %6" PRIu32 " us\n", "latency", stats.last_latency_us, "on air",
+           stats.last_duration_us);
+    free(cmd);
+}
+
+static void test_learned(void)
+{
+    test_command_t cmd;
+    ir_learn_sub_list_t nodes[2];
+    struct ir_learn_sub_list_head list = SLIST_HEAD_INITIALIZER(list);
+    rmt_symbol_word_t played[TEST_MAX_SYMBOLS];
+    uint32_t duration_us = 0;
+
+    command_make(&cmd, 0x00ff30cf);
+    for (int i = 1; i >= 0; i--) {
+        nodes[i].timediff = cmd.frames[i].gap_us;
+        nodes[i].symbols.received_symbols = (rmt_symbol_word_t *)cmd.frames[i].symbols;
+        nodes[i].symbols.num_symbols = cmd.frames[i].num_symbols;
+        SLIST_INSERT_HEAD(&list, &nodes[i], next);
+    }
+    /* The first frame is not preceded by a gap, whatever ir_learn measured before it */
+    nodes[0].timediff = 123456;
+    check(ESP_OK == app_ir_tx_send_learned(&list, portMAX_DELAY), "learned command queued");
+    wait_sent(2);
+    size_t num = port_rmt_last(played, TEST_MAX_SYMBOLS, &duration_us);
+    check(played_as(&cmd, played, num) && (duration_us == frames_duration_us(cmd.frames, 2)),
+          "played as the same frames");
+}
+
+static void test_queue(void)
+{
+    test_command_t cmd;
+    app_ir_tx_stats_t before;
+    app_ir_tx_stats_t stats;
+    int timeouts = 0;
+    int queued = 0;
+
+    command_make(&cmd, 0x20df40bf);
+    app_ir_tx_get_stats(&before);
+    /* A command is on air for 180 ms, the queue fills up */
+    for (int i = 0; i < 8; i++) {
+        esp_err_t err = app_ir_tx_send(cmd.frames, 2, 0);
+        timeouts += (ESP_ERR_TIMEOUT == err);
+        queued += (ESP_OK == err);
+    }
+    app_ir_tx_get_stats(&stats);
+    check(timeouts && (timeouts + queued == 8) && (stats.dropped - before.dropped == timeouts),
+          "full queue drops the command and counts it");
+    wait_sent(before.commands + queued);
+    app_ir_tx_get_stats(&stats);
+    check(stats.commands - before.commands == queued, "queued commands all sent");
+    check(stats.max_latency_us > 2 * frames_duration_us(cmd.frames, 2), "latency of the last one in the queue");
+}
+
+static void test_invalid(void)
+{
+    test_command_t cmd;
+    app_ir_tx_frame_t empty = { 0 };
+
+    command_make(&cmd, 0);
+    check(ESP_ERR_INVALID_ARG == app_ir_tx_send(NULL, 1, 0), "no frames");
+    check(ESP_ERR_INVALID_ARG == app_ir_tx_send(cmd.frames, 0, 0), "zero frames");
+    check(ESP_ERR_INVALID_ARG == app_ir_tx_send(&empty, 1, 0), "no symbols");
+    check(ESP_ERR_INVALID_ARG == app_ir_tx_send_learned(NULL, 0), "no learned command");
+    check(ESP_ERR_INVALID_ARG == app_ir_tx_get_stats(NULL), "no statistics output");
+}
+
+int main(int argc, char **argv)
+{
+    test_command_t cmd;
+    bool verbose = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    /* The invalid arguments log errors on purpose */
+    port_log_level = verbose ? ESP_LOG_INFO : ESP_LOG_NONE;
+
+    printf("Transmitter\n");
+    command_make(&cmd, 0);
+    check(ESP_ERR_INVALID_STATE == app_ir_tx_send(cmd.frames, 2, 0), "not started");
+    check((ESP_OK == app_ir_tx_start()) && (ESP_OK == app_ir_tx_start()), "started, once");
+    printf("\nCommand\n");
+    test_command();
+    test_learned();
+    printf("\nQueue\n");
+    test_queue();
+    printf("\nInvalid arguments\n");
+    test_invalid();
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,11 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/* The IR pins of the BOX-3 sensor bottom, from the bsp_board.h of the BSP */
+#define BSP_IR_CTRL_GPIO        (44)
+#define BSP_IR_TX_GPIO          (39)
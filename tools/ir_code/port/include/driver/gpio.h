@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_bit_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The GPIO of the IR transmitter enable, which the host ignores */
+typedef enum {
+    GPIO_MODE_INPUT = 1,
+    GPIO_MODE_OUTPUT = 2,
+} gpio_mode_t;
+
+typedef struct {
+    uint64_t pin_bit_mask;
+    gpio_mode_t mode;
+    uint32_t pull_up_en;
+    uint32_t pull_down_en;
+} gpio_config_t;
+
+static inline esp_err_t gpio_config(const gpio_config_t *config)
+{
+    return ESP_OK;
+}
+
+static inline esp_err_t gpio_set_level(int gpio_num, uint32_t level)
+{
+    return ESP_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,26 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/rmt_tx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The copy encoder of the ir_learn component: the payload is an array of symbols, its size their number */
+typedef struct {
+    uint32_t resolution;
+} ir_encoder_config_t;
+
+esp_err_t ir_encoder_new(const ir_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/queue.h>
+#include "driver/rmt_tx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The learned frames of the ir_learn component */
+typedef struct {
+    rmt_symbol_word_t *received_symbols;
+    size_t num_symbols;
+} rmt_rx_done_event_data_t;
+
+typedef struct ir_learn_sub_list_t {
+    uint32_t timediff;                      /* Time since the previous frame, in us */
+    rmt_rx_done_event_data_t symbols;
+    SLIST_ENTRY(ir_learn_sub_list_t) next;
+} ir_learn_sub_list_t;
+
+SLIST_HEAD(ir_learn_sub_list_head, ir_learn_sub_list_t);
+
+#ifdef __cplusplus
+}
+#endif
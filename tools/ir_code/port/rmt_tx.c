@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "driver/rmt_tx.h"
+#include "ir_encoder.h"
+
+#define PORT_RMT_MAX_SYMBOLS    (1024)
+
+struct rmt_channel_t {
+    bool enabled;
+    const rmt_symbol_word_t *payload;   /* Read while it plays, as the RMT does */
+    size_t num_symbols;
+};
+
+struct rmt_encoder_t {
+    uint32_t resolution;
+};
+
+static struct {
+    SemaphoreHandle_t lock;
+    rmt_symbol_word_t symbols[PORT_RMT_MAX_SYMBOLS];
+    size_t num_symbols;
+    uint32_t duration_us;
+    size_t transmissions;
+} s_rmt;
+
+esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_handle_t *ret_chan)
+{
+    if (!config || !ret_chan || (1000000 != config->resolution_hz)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *ret_chan = calloc(1, sizeof(struct rmt_channel_t));
+    s_rmt.lock = s_rmt.lock ? s_rmt.lock : xSemaphoreCreateMutex();
+    return *ret_chan ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+esp_err_t rmt_apply_carrier(rmt_channel_handle_t channel, const rmt_carrier_config_t *config)
+{
+    return (channel && config) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t rmt_enable(rmt_channel_handle_t channel)
+{
+    channel->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t rmt_disable(rmt_channel_handle_t channel)
+{
+    channel->enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t rmt_del_channel(rmt_channel_handle_t channel)
+{
+    free(channel);
+    return ESP_OK;
+}
+
+esp_err_t rmt_del_encoder(rmt_encoder_handle_t encoder)
+{
+    free(encoder);
+    return ESP_OK;
+}
+
+esp_err_t ir_encoder_new(const ir_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder)
+{
+    *ret_encoder = calloc(1, sizeof(struct rmt_encoder_t));
+    if (!*ret_encoder) {
+        return ESP_ERR_NO_MEM;
+    }
+    (*ret_encoder)->resolution = config->resolution;
+    return ESP_OK;
+}
+
+esp_err_t rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_handle_t encoder, const void *payload,
+                       size_t payload_bytes, const rmt_transmit_config_t *config)
+{
+    if (!channel || !encoder || !payload || !payload_bytes || !config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!channel->enabled || channel->payload) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    channel->payload = payload;
+    channel->num_symbols = payload_bytes;
+    return ESP_OK;
+}
+
+esp_err_t rmt_tx_wait_all_done(rmt_channel_handle_t channel, int timeout_ms)
+{
+    uint32_t duration_us = 0;
+    size_t played = 0;
+
+    if (!channel->payload) {
+        return ESP_OK;
+    }
+    /* A zero duration is the end marker of the RMT, the symbols after it are not played */
+    for (; played < channel->num_symbols; played++) {
+        const rmt_symbol_word_t *symbol = &channel->payload[played];
+        duration_us += symbol->duration0;
+        if (!symbol->duration0) {
+            break;
+        }
+        duration_us += symbol->duration1;
+        if (!symbol->duration1) {
+            played++;
+            break;
+        }
+    }
+    struct timespec ts = {.tv_sec = duration_us / 1000000, .tv_nsec = (long)(duration_us % 1000000) * 1000};
+    while (nanosleep(&ts, &ts) && (EINTR == errno)) {
+    }
+
+    xSemaphoreTake(s_rmt.lock, portMAX_DELAY);
+    s_rmt.num_symbols = (played < PORT_RMT_MAX_SYMBOLS) ? played : PORT_RMT_MAX_SYMBOLS;
+    memcpy(s_rmt.symbols, channel->payload, s_rmt.num_symbols * sizeof(rmt_symbol_word_t));
+    s_rmt.duration_us = duration_us;
+    s_rmt.transmissions++;
+    xSemaphoreGive(s_rmt.lock);
+    channel->payload = NULL;
+    return ESP_OK;
+}
+
+size_t port_rmt_last(rmt_symbol_word_t *symbols, size_t max_symbols, uint32_t *duration_us)
+{
+    xSemaphoreTake(s_rmt.lock, portMAX_DELAY);
+    size_t num = (s_rmt.num_symbols < max_symbols) ? s_rmt.num_symbols : max_symbols;
+    memcpy(symbols, s_rmt.symbols, num * sizeof(rmt_symbol_word_t));
+    *duration_us = s_rmt.duration_us;
+    xSemaphoreGive(s_rmt.lock);
+    return num;
+}
+
+size_t port_rmt_transmissions(void)
+{
+    xSemaphoreTake(s_rmt.lock, portMAX_DELAY);
+    size_t transmissions = s_rmt.transmissions;
+    xSemaphoreGive(s_rmt.lock);
+    return transmissions;
+}
@@ -0,0 +1,386 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <dirent.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "music_library.h"
+
+#define BENCH_FILES             (300)
+/* Enough files over BENCH_FILES for the cache to exceed CONFIG_MUSIC_LIBRARY_CACHE_MAX_SIZE */
+#define BENCH_OVERSIZE_FILES    (500)
+#define BENCH_PATH_MAX_LEN      (256)
+/* MPEG 1 layer III, 128 kbit/s, 44.1 kHz, stereo: 417 byte frames of 1152 samples */
+#define FRAME_HEADER            "\xff\xfb\x90\x00"
+#define FRAME_SIZE              (417)
+#define FRAME_SAMPLES           (1152)
+#define FRAME_RATE_HZ           (44100)
+#define FRAME_KBPS              (128)
+
+typedef struct {
+    char title[MUSIC_LIBRARY_TEXT_MAX_LEN];
+    char artist[MUSIC_LIBRARY_TEXT_MAX_LEN];
+    uint32_t duration_ms;
+} expected_t;
+
+typedef struct {
+    char root[64];
+    char music[BENCH_PATH_MAX_LEN];
+    char cache[BENCH_PATH_MAX_LEN];
+    bool generated;                 /* Files written by the bench, else a directory given on the command line */
+    int files;
+    expected_t *expected;
+} bench_dir_t;
+
+typedef struct {
+    music_library_stats_t stats;
+    int available;                  /* Files with metadata right after creation */
+} boot_t;
+
+static int s_failures;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-56s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+static void track_name(int index, char *name, size_t size)
+{
+    snprintf(name, size, "track_%04d.mp3", index);
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static void id3v2_text_frame(FILE *fp, const char *id, const char *text)
+{
+    uint8_t header[10] = {0};
+    memcpy(header, id, 4);
+    put_be32(&header[4], strlen(text) + 1);
+    fwrite(header, 1, sizeof(header), fp);
+    fputc(0, fp);       /* ISO-8859-1 */
+    fwrite(text, 1, strlen(text), fp);
+}
+
+/*
+ * Track `index` of a generated library, `extra_frames` longer than at first:
+ * - an ID3v2.3 tag, except every fifth track which has an ID3v1 tag only
+ * - every third track is VBR, with a Xing header giving the number of frames
+ * - constant bitrate otherwise, its duration follows from the size of the audio
+ */
+static void track_write(const bench_dir_t *dir, int index, int extra_frames, expected_t *expected)
+{
+    char name[32];
+    char path[BENCH_PATH_MAX_LEN + 32];
+    uint8_t frame[FRAME_SIZE] = {0};
+    bool id3v1 = (0 == index % 5);
+    bool vbr = (0 == index % 3);
+    int frames = 40 + index % 20 + extra_frames;
+
+    track_name(index, name, sizeof(name));
+    snprintf(path, sizeof(path), "%s/%s", dir->music, name);
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        perror(path);
+        exit(1);
+    }
+
+    memset(expected, 0, sizeof(*expected));
+    /* ID3v1 holds 30 characters */
+    snprintf(expected->title, sizeof(expected->title), "Title of track %d", index);
+    snprintf(expected->artist, sizeof(expected->artist), "Artist %d", index % 17);
+    if (!id3v1) {
+        uint8_t header[10] = {'I', 'D', '3', 3, 0, 0};
+        uint32_t size = 2 * 11 + strlen(expected->title) + strlen(expected->artist);
+        /* Syncsafe */
+        header[6] = (size >> 21) & 0x7f;
+        header[7] = (size >> 14) & 0x7f;
+        header[8] = (size >> 7) & 0x7f;
+        header[9] = size & 0x7f;
+        fwrite(header, 1, sizeof(header), fp);
+        id3v2_text_frame(fp, "TIT2", expected->title);
+        id3v2_text_frame(fp, "TPE1", expected->artist);
+    }
+
+    memcpy(frame, FRAME_HEADER, 4);
+    if (vbr) {
+        /* Xing header after the 32 byte side information of a stereo MPEG 1 frame, frames and bytes */
+        uint8_t *xing = &frame[4 + 32];
+        memcpy(xing, "Xing", 4);
+        put_be32(&xing[4], 0x03);
+        put_be32(&xing[8], frames);
+        put_be32(&xing[12], frames * FRAME_SIZE);
+        fwrite(frame, 1, sizeof(frame), fp);
+        memset(xing, 0, 16);
+        expected->duration_ms = (uint64_t)frames * FRAME_SAMPLES * 1000 / FRAME_RATE_HZ;
+    } else {
+        expected->duration_ms = (uint64_t)frames * FRAME_SIZE * 8 / FRAME_KBPS;
+    }
+    for (int i = 0; i < frames; i++) {
+        frame[4] = i;
+        fwrite(frame, 1, sizeof(frame), fp);
+    }
+
+    if (id3v1) {
+        uint8_t tag[128] = {'T', 'A', 'G'};
+        memcpy(&tag[3], expected->title, strlen(expected->title));
+        memcpy(&tag[33], expected->artist, strlen(expected->artist));
+        fwrite(tag, 1, sizeof(tag), fp);
+    }
+    fclose(fp);
+}
+
+static void track_remove(const bench_dir_t *dir, int index)
+{
+    char name[32];
+    char path[BENCH_PATH_MAX_LEN + 32];
+
+    track_name(index, name, sizeof(name));
+    snprintf(path, sizeof(path), "%s/%s", dir->music, name);
+    unlink(path);
+}
+
+static void library_ready(music_library_handle_t library, void *user_ctx)
+{
+    xSemaphoreGive((SemaphoreHandle_t)user_ctx);
+}
+
+/* Create the library as the players do at boot, wait for the background indexing, then delete it */
+static void boot(const bench_dir_t *dir, boot_t *result)
+{
+    SemaphoreHandle_t ready = xSemaphoreCreateBinary();
+    music_library_handle_t library = NULL;
+    const music_library_config_t config = {
+        .path = dir->music,
+        .suffix = ".mp3",
+        .cache_path = dir->cache,
+        .task_priority = 2,
+        .task_core = tskNO_AFFINITY,
+        .ready_cb = library_ready,
+        .user_ctx = ready,
+    };
+
+    memset(result, 0, sizeof(*result));
+    if (ESP_OK != music_library_new(&config, &library)) {
+        fprintf(stderr, "library creation failed\n");
+        exit(1);
+    }
+    /* What the player list can show at once, from the cache */
+    if (dir->generated) {
+        for (int i = 0; i < dir->files; i++) {
+            char name[32];
+            music_info_t info;
+            track_name(i, name, sizeof(name));
+            result->available += (ESP_OK == music_library_get_info(library, name, &info));
+        }
+    }
+    xSemaphoreTake(ready, portMAX_DELAY);
+    music_library_get_stats(library, &result->stats);
+
+    if (dir->generated) {
+        bool same = true;
+        for (int i = 0; i < dir->files; i++) {
+            char name[32];
+            music_info_t info;
+            const expected_t *e = &dir->expected[i];
+            track_name(i, name, sizeof(name));
+            same &= (ESP_OK == music_library_get_info(library, name, &info)) && !strcmp(info.title, e->title) &&
+                    !strcmp(info.artist, e->artist) && (info.duration_ms == e->duration_ms) &&
+                    (FRAME_RATE_HZ == info.sample_rate_hz);
+        }
+        check(same, "title, artist, duration and sample rate of every track");
+    }
+    music_library_del(library);
+    vSemaphoreDelete(ready);
+}
+
+static void boot_print(const char *what, const boot_t *b)
+{
+    printf("  %-22s %5u tracks %5u cached %5u parsed, load %8" PRIu32 " us, index %8" PRIu32 " us\n", what,
+           b->stats.tracks, b->stats.cached, b->stats.parsed, b->stats.load_us, b->stats.index_us);
+}
+
+static long file_size(const char *path)
+{
+    struct stat st;
+    return (0 == stat(path, &st)) ? (long)st.st_size : -1;
+}
+
+static void bench_generated(bench_dir_t *dir)
+{
+    boot_t cold;
+    boot_t warm;
+    boot_t b;
+    char what[80];
+    int files = dir->files;
+
+    dir->expected = calloc(files + BENCH_OVERSIZE_FILES, sizeof(expected_t));
+    if (!dir->expected) {
+        fprintf(stderr, "no mem\n");
+        exit(1);
+    }
+    for (int i = 0; i < files; i++) {
+        track_write(dir, i, 0, &dir->expected[i]);
+    }
+
+    printf("Cold and warm boot, %d tracks\n", files);
+    boot(dir, &cold);
+    boot_print("cold, no cache", &cold);
+    check((files == cold.stats.parsed) && !cold.stats.cached, "first boot parses every track");
+    long cache_size = file_size(dir->cache);
+    snprintf(what, sizeof(what), "cache written, %ld bytes", cache_size);
+    check(cache_size > 0, what);
+
+    boot(dir, &warm);
+    boot_print("warm, from the cache", &warm);
+    check(files == warm.available, "every track known right after creation");
+    check((files == warm.stats.cached) && !warm.stats.parsed, "second boot parses nothing");
+    check(cache_size == file_size(dir->cache), "unchanged library not written again");
+
+    printf("\nChanged library\n");
+    /* A modified, a removed and an added track */
+    track_write(dir, 1, 5, &dir->expected[1]);
+    track_remove(dir, files - 1);
+    dir->files = files - 1;
+    boot(dir, &b);
+    dir->files = files;
+    track_write(dir, files - 1, 0, &dir->expected[files - 1]);
+    boot_print("modified and removed", &b);
+    check((1 == b.stats.parsed) && (files - 2 == b.stats.cached), "only the modified track parsed");
+    boot(dir, &b);
+    boot_print("added", &b);
+    check((1 == b.stats.parsed) && (files - 1 == b.stats.cached), "only the added track parsed");
+
+    printf("\nDamaged cache\n");
+    FILE *fp = fopen(dir->cache, "r+b");
+    if (fp) {
+        fseek(fp, -1, SEEK_END);
+        int c = fgetc(fp);
+        fseek(fp, -1, SEEK_END);
+        fputc(c ^ 0x01, fp);
+        fclose(fp);
+    }
+    boot(dir, &b);
+    boot_print("flipped bit", &b);
+    check(files == b.stats.parsed, "damaged cache rejected, every track parsed");
+    boot(dir, &b);
+    check(files == b.stats.cached, "cache written again");
+
+    printf("\nLibrary over the cache limit of %d bytes\n", CONFIG_MUSIC_LIBRARY_CACHE_MAX_SIZE);
+    for (int i = files; i < files + BENCH_OVERSIZE_FILES; i++) {
+        track_write(dir, i, 0, &dir->expected[i]);
+    }
+    dir->files = files + BENCH_OVERSIZE_FILES;
+    boot(dir, &b);
+    boot_print("grown", &b);
+    check(file_size(dir->cache) < 0, "cache not saved, the old one removed");
+    boot(dir, &b);
+    boot_print("next boot", &b);
+    check(dir->files == b.stats.parsed, "every track parsed again");
+    free(dir->expected);
+}
+
+static void bench_existing(bench_dir_t *dir)
+{
+    boot_t cold;
+    boot_t warm;
+
+    printf("Cold and warm boot, %s\n", dir->music);
+    boot(dir, &cold);
+    boot_print("cold, no cache", &cold);
+    boot(dir, &warm);
+    boot_print("warm, from the cache", &warm);
+    check(cold.stats.tracks && (cold.stats.tracks == warm.stats.cached) && !warm.stats.parsed,
+          "every track from the cache on the second boot");
+}
+
+static void remove_dir(const char *path)
+{
+    char file[BENCH_PATH_MAX_LEN + 256];
+    DIR *p_dir = opendir(path);
+    struct dirent *p_dirent;
+
+    while (p_dir && (p_dirent = readdir(p_dir)) != NULL) {
+        if (p_dirent->d_name[0] != '.') {
+            snprintf(file, sizeof(file), "%s/%s", path, p_dirent->d_name);
+            unlink(file);
+        }
+    }
+    if (p_dir) {
+        closedir(p_dir);
+    }
+    rmdir(path);
+}
+
+int main(int argc, char **argv)
+{
+    bench_dir_t dir = {0};
+    int files = BENCH_FILES;
+    const char *music = NULL;
+    bool verbose = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:d:v")) != -1) {
+        switch (opt) {
+        case 'n':
+            files = atoi(optarg);
+            break;
+        case 'd':
+            music = optarg;
+            break;
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n <files> | -d <directory>] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    if ((optind != argc) || (files < 2) || (files > 1000)) {
+        fprintf(stderr, "usage: %s [-n <files> | -d <directory>] [-v]\n", argv[0]);
+        return 2;
+    }
+
+    /* The cache goes next to the music directory, not in it, as in the examples */
+    snprintf(dir.root, sizeof(dir.root), "/tmp/music_library_bench.XXXXXX");
+    if (!mkdtemp(dir.root)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    snprintf(dir.cache, sizeof(dir.cache), "%s/music_lib.bin", dir.root);
+    /* The damaged and oversized caches log on purpose */
+    port_log_level = verbose ? ESP_LOG_INFO : ESP_LOG_NONE;
+    if (music) {
+        snprintf(dir.music, sizeof(dir.music), "%s", music);
+        bench_existing(&dir);
+    } else {
+        snprintf(dir.music, sizeof(dir.music), "%s/mp3", dir.root);
+        mkdir(dir.music, 0755);
+        dir.generated = true;
+        dir.files = files;
+        bench_generated(&dir);
+        remove_dir(dir.music);
+    }
+    remove_dir(dir.root);
+
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,583 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE     /* PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP */
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+
+/* Tasks are threads, priorities and cores are ignored */
+struct port_task {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+    char name[16];
+    struct port_task *next;         /* Threads of the tool which asked for their handle */
+    pthread_mutex_t lock;
+    pthread_cond_t notified;
+    uint32_t notify_value;
+    bool notify_pending;
+};
+
+struct port_queue {
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    uint8_t *items;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;
+    UBaseType_t count;
+};
+
+/* Mutexes are binary semaphores given once at creation, without priority inheritance */
+struct port_semaphore {
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    UBaseType_t count;
+    UBaseType_t max_count;
+    TaskHandle_t holder;            /* Recursive mutexes only */
+    UBaseType_t depth;
+    bool is_static;
+};
+
+struct port_event_group {
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    EventBits_t bits;
+};
+
+_Static_assert(sizeof(struct port_semaphore) <= sizeof(StaticSemaphore_t), "StaticSemaphore_t is too small");
+
+static __thread struct port_task *s_current;
+static struct port_task *s_adopted;
+static pthread_mutex_t s_critical_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+void port_enter_critical(void)
+{
+    pthread_mutex_lock(&s_critical_lock);
+}
+
+void port_exit_critical(void)
+{
+    pthread_mutex_unlock(&s_critical_lock);
+}
+
+static void port_cond_init(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static void port_deadline(struct timespec *ts, TickType_t ticks)
+{
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    ts->tv_sec += ticks / 1000;
+    ts->tv_nsec += (long)(ticks % 1000) * 1000000;
+    if (ts->tv_nsec >= 1000000000) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000;
+    }
+}
+
+/**
+ * @brief Wait on a condition with the lock held, false once the ticks have passed
+ */
+static bool port_wait(pthread_cond_t *cond, pthread_mutex_t *lock, TickType_t ticks, const struct timespec *deadline)
+{
+    if (0 == ticks) {
+        return false;
+    }
+    if (portMAX_DELAY == ticks) {
+        pthread_cond_wait(cond, lock);
+        return true;
+    }
+    return ETIMEDOUT != pthread_cond_timedwait(cond, lock, deadline);
+}
+
+static struct port_task *port_task_new(TaskFunction_t fn, const char *name, void *arg)
+{
+    struct port_task *task = calloc(1, sizeof(struct port_task));
+    if (NULL == task) {
+        return NULL;
+    }
+    task->fn = fn;
+    task->arg = arg;
+    snprintf(task->name, sizeof(task->name), "%s", name ? name : "");
+    pthread_mutex_init(&task->lock, NULL);
+    port_cond_init(&task->notified);
+    return task;
+}
+
+static void port_task_free(struct port_task *task)
+{
+    pthread_mutex_destroy(&task->lock);
+    pthread_cond_destroy(&task->notified);
+    free(task);
+}
+
+static void *port_task_entry(void *arg)
+{
+    s_current = arg;
+    s_current->thread = pthread_self();
+    s_current->fn(s_current->arg);
+    vTaskDelete(NULL);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *ret_task, BaseType_t core_id)
+{
+    struct port_task *task = port_task_new(fn, name, arg);
+    if (NULL == task) {
+        return pdFAIL;
+    }
+    if (ret_task) {
+        /* Set before the task runs, it may be notified by its creator at once */
+        *ret_task = task;
+    }
+    /* The task may delete itself before pthread_create() returns, its handle is not touched from here on */
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, port_task_entry, task)) {
+        port_task_free(task);
+        return pdFAIL;
+    }
+    pthread_detach(thread);
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth, void *arg, UBaseType_t priority,
+                       TaskHandle_t *ret_task)
+{
+    return xTaskCreatePinnedToCore(fn, name, stack_depth, arg, priority, ret_task, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if ((NULL == task) || (task == s_current)) {
+        struct port_task *current = s_current;
+        s_current = NULL;
+        if (current && current->fn) {
+            port_task_free(current);
+        }
+        pthread_exit(NULL);
+    }
+    /* Tasks are only deleted by others while blocked, as the firmware does with its idle tasks */
+    pthread_cancel(task->thread);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec ts = {.tv_sec = ticks / 1000, .tv_nsec = (long)(ticks % 1000) * 1000000};
+    while (nanosleep(&ts, &ts) && (EINTR == errno)) {
+    }
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (TickType_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    if (NULL == s_current) {
+        /* A thread of the tool, such as main(), keeps its handle until the process exits */
+        s_current = port_task_new(NULL, "main", NULL);
+        assert(s_current);
+        s_current->thread = pthread_self();
+        port_enter_critical();
+        s_current->next = s_adopted;
+        s_adopted = s_current;
+        port_exit_critical();
+    }
+    return s_current;
+}
+
+const char *pcTaskGetName(TaskHandle_t task)
+{
+    return (task ? task : xTaskGetCurrentTaskHandle())->name;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action)
+{
+    BaseType_t ret = pdPASS;
+
+    pthread_mutex_lock(&task->lock);
+    switch (action) {
+    case eSetBits:
+        task->notify_value |= value;
+        break;
+    case eIncrement:
+        task->notify_value++;
+        break;
+    case eSetValueWithOverwrite:
+        task->notify_value = value;
+        break;
+    case eSetValueWithoutOverwrite:
+        if (task->notify_pending) {
+            ret = pdFAIL;
+        } else {
+            task->notify_value = value;
+        }
+        break;
+    default:
+        break;
+    }
+    task->notify_pending = true;
+    pthread_cond_broadcast(&task->notified);
+    pthread_mutex_unlock(&task->lock);
+    return ret;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    return xTaskNotify(task, 0, eIncrement);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    struct port_task *task = xTaskGetCurrentTaskHandle();
+    struct timespec deadline;
+    port_deadline(&deadline, ticks_to_wait);
+
+    pthread_mutex_lock(&task->lock);
+    while (0 == task->notify_value) {
+        if (!port_wait(&task->notified, &task->lock, ticks_to_wait, &deadline)) {
+            break;
+        }
+    }
+    uint32_t value = task->notify_value;
+    if (value) {
+        task->notify_value = clear_on_exit ? 0 : value - 1;
+    }
+    task->notify_pending = false;
+    pthread_mutex_unlock(&task->lock);
+    return value;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *value,
+                           TickType_t ticks_to_wait)
+{
+    struct port_task *task = xTaskGetCurrentTaskHandle();
+    struct timespec deadline;
+    port_deadline(&deadline, ticks_to_wait);
+
+    pthread_mutex_lock(&task->lock);
+    if (!task->notify_pending) {
+        task->notify_value &= ~clear_on_entry;
+    }
+    while (!task->notify_pending) {
+        if (!port_wait(&task->notified, &task->lock, ticks_to_wait, &deadline)) {
+            break;
+        }
+    }
+    BaseType_t ret = task->notify_pending ? pdPASS : pdFAIL;
+    if (value) {
+        *value = task->notify_value;
+    }
+    if (ret) {
+        task->notify_value &= ~clear_on_exit;
+    }
+    task->notify_pending = false;
+    pthread_mutex_unlock(&task->lock);
+    return ret;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct port_queue *queue = calloc(1, sizeof(struct port_queue));
+    if (NULL == queue) {
+        return NULL;
+    }
+    queue->items = calloc(length, item_size);
+    if (NULL == queue->items) {
+        free(queue);
+        return NULL;
+    }
+    queue->length = length;
+    queue->item_size = item_size;
+    pthread_mutex_init(&queue->lock, NULL);
+    port_cond_init(&queue->changed);
+    return queue;
+}
+
+static BaseType_t port_queue_send(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait, bool front)
+{
+    struct timespec deadline;
+    port_deadline(&deadline, ticks_to_wait);
+
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == queue->length) {
+        if (!port_wait(&queue->changed, &queue->lock, ticks_to_wait, &deadline)) {
+            pthread_mutex_unlock(&queue->lock);
+            return errQUEUE_FULL;
+        }
+    }
+    UBaseType_t slot;
+    if (front) {
+        queue->head = (queue->head + queue->length - 1) % queue->length;
+        slot = queue->head;
+    } else {
+        slot = (queue->head + queue->count) % queue->length;
+    }
+    memcpy(queue->items + slot * queue->item_size, item, queue->item_size);
+    queue->count++;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait)
+{
+    return port_queue_send(queue, item, ticks_to_wait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait)
+{
+    return port_queue_send(queue, item, ticks_to_wait, true);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks_to_wait)
+{
+    struct timespec deadline;
+    port_deadline(&deadline, ticks_to_wait);
+
+    pthread_mutex_lock(&queue->lock);
+    while (0 == queue->count) {
+        if (!port_wait(&queue->changed, &queue->lock, ticks_to_wait, &deadline)) {
+            pthread_mutex_unlock(&queue->lock);
+            return pdFAIL;
+        }
+    }
+    memcpy(item, queue->items + queue->head * queue->item_size, queue->item_size);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    return pdPASS;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    queue->head = 0;
+    queue->count = 0;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    UBaseType_t count = queue->count;
+    pthread_mutex_unlock(&queue->lock);
+    return count;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    pthread_mutex_destroy(&queue->lock);
+    pthread_cond_destroy(&queue->changed);
+    free(queue->items);
+    free(queue);
+}
+
+static SemaphoreHandle_t port_semaphore_init(struct port_semaphore *semaphore, UBaseType_t max_count,
+                                             UBaseType_t initial_count)
+{
+    if (semaphore) {
+        pthread_mutex_init(&semaphore->lock, NULL);
+        port_cond_init(&semaphore->changed);
+        semaphore->max_count = max_count;
+        semaphore->count = initial_count;
+    }
+    return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return port_semaphore_init(calloc(1, sizeof(struct port_semaphore)), 1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    return xSemaphoreCreateMutex();
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return port_semaphore_init(calloc(1, sizeof(struct port_semaphore)), 1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buffer)
+{
+    struct port_semaphore *semaphore = (struct port_semaphore *)buffer;
+    memset(semaphore, 0, sizeof(struct port_semaphore));
+    semaphore->is_static = true;
+    return port_semaphore_init(semaphore, 1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    return port_semaphore_init(calloc(1, sizeof(struct port_semaphore)), max_count, initial_count);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    struct timespec deadline;
+    port_deadline(&deadline, ticks_to_wait);
+
+    pthread_mutex_lock(&semaphore->lock);
+    while (0 == semaphore->count) {
+        if (!port_wait(&semaphore->changed, &semaphore->lock, ticks_to_wait, &deadline)) {
+            pthread_mutex_unlock(&semaphore->lock);
+            return pdFALSE;
+        }
+    }
+    semaphore->count--;
+    pthread_mutex_unlock(&semaphore->lock);
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    BaseType_t ret = pdFALSE;
+
+    pthread_mutex_lock(&semaphore->lock);
+    if (semaphore->count < semaphore->max_count) {
+        semaphore->count++;
+        pthread_cond_broadcast(&semaphore->changed);
+        ret = pdTRUE;
+    }
+    pthread_mutex_unlock(&semaphore->lock);
+    return ret;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    TaskHandle_t current = xTaskGetCurrentTaskHandle();
+    if (semaphore->holder == current) {
+        semaphore->depth++;
+        return pdTRUE;
+    }
+    if (!xSemaphoreTake(semaphore, ticks_to_wait)) {
+        return pdFALSE;
+    }
+    semaphore->holder = current;
+    semaphore->depth = 1;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore)
+{
+    if (semaphore->holder != xTaskGetCurrentTaskHandle()) {
+        return pdFALSE;
+    }
+    if (--semaphore->depth) {
+        return pdTRUE;
+    }
+    semaphore->holder = NULL;
+    return xSemaphoreGive(semaphore);
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t semaphore)
+{
+    pthread_mutex_lock(&semaphore->lock);
+    UBaseType_t count = semaphore->count;
+    pthread_mutex_unlock(&semaphore->lock);
+    return count;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    pthread_mutex_destroy(&semaphore->lock);
+    pthread_cond_destroy(&semaphore->changed);
+    if (!semaphore->is_static) {
+        free(semaphore);
+    }
+}
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    struct port_event_group *group = calloc(1, sizeof(struct port_event_group));
+    if (NULL == group) {
+        return NULL;
+    }
+    pthread_mutex_init(&group->lock, NULL);
+    port_cond_init(&group->changed);
+    return group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->lock);
+    group->bits |= bits;
+    EventBits_t ret = group->bits;
+    pthread_cond_broadcast(&group->changed);
+    pthread_mutex_unlock(&group->lock);
+    return ret;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->lock);
+    EventBits_t ret = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->lock);
+    return ret;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    pthread_mutex_lock(&group->lock);
+    EventBits_t ret = group->bits;
+    pthread_mutex_unlock(&group->lock);
+    return ret;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks_to_wait)
+{
+    struct timespec deadline;
+    port_deadline(&deadline, ticks_to_wait);
+
+    pthread_mutex_lock(&group->lock);
+    while (wait_for_all ? ((group->bits & bits) != bits) : !(group->bits & bits)) {
+        if (!port_wait(&group->changed, &group->lock, ticks_to_wait, &deadline)) {
+            break;
+        }
+    }
+    EventBits_t ret = group->bits;
+    bool met = wait_for_all ? ((ret & bits) == bits) : (ret & bits);
+    if (met && clear_on_exit) {
+        group->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&group->lock);
+    return ret;
+}
+
+void vEventGroupDelete(EventGroupHandle_t group)
+{
+    pthread_mutex_destroy(&group->lock);
+    pthread_cond_destroy(&group->changed);
+    free(group);
+}
@@ -0,0 +1,25 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+/* The host memory stands for PSRAM: not a DMA target, so that the copies made for the DMA run too */
+static inline bool esp_ptr_dma_capable(const void *p)
+{
+    return false;
+}
+
+static inline bool esp_ptr_external_ram(const void *p)
+{
+    return true;
+}
+
+static inline bool esp_ptr_internal(const void *p)
+{
+    return false;
+}
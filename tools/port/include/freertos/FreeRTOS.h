@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/* FreeRTOS subset on POSIX threads for the host tools, 1 tick is 1 ms */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_bit_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t EventBits_t;
+typedef uint8_t StackType_t;
+
+typedef struct port_task *TaskHandle_t;
+typedef struct port_queue *QueueHandle_t;
+typedef struct port_semaphore *SemaphoreHandle_t;
+typedef struct port_event_group *EventGroupHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+/* Room for a semaphore, for the static create functions */
+typedef struct {
+    _Alignas(16) uint8_t storage[192];
+} StaticSemaphore_t;
+
+/* Critical sections take one process wide lock, the spinlock itself is unused */
+typedef struct {
+    int owner;
+} portMUX_TYPE;
+
+#define pdFALSE                 0
+#define pdTRUE                  1
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define errQUEUE_FULL           0
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS      1
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+#define configMAX_PRIORITIES    25
+#define tskNO_AFFINITY          0x7fffffff
+
+#define portMUX_INITIALIZER_UNLOCKED    {0}
+#define portMUX_INITIALIZE(mux)         ((mux)->owner = 0)
+#define portENTER_CRITICAL(mux)         ((void)(mux), port_enter_critical())
+#define portEXIT_CRITICAL(mux)          ((void)(mux), port_exit_critical())
+#define portENTER_CRITICAL_ISR(mux)     ((void)(mux), port_enter_critical())
+#define portEXIT_CRITICAL_ISR(mux)      ((void)(mux), port_exit_critical())
+#define portENTER_CRITICAL_SAFE(mux)    ((void)(mux), port_enter_critical())
+#define portEXIT_CRITICAL_SAFE(mux)     ((void)(mux), port_exit_critical())
+#define portYIELD_FROM_ISR(x)           ((void)(x))
+
+void port_enter_critical(void);
+void port_exit_critical(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,235 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "nvs.h"
+
+#define PORT_NVS_MAX_KEYS   (512)
+
+typedef struct {
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    nvs_type_t type;
+    uint8_t *data;
+    size_t size;
+} port_nvs_entry_t;
+
+struct port_nvs_iterator {
+    nvs_type_t type;
+    size_t index;
+};
+
+static port_nvs_entry_t s_entries[PORT_NVS_MAX_KEYS];
+static char s_oversize_key[NVS_KEY_NAME_MAX_SIZE];
+static size_t s_commits;
+static size_t s_written;
+
+static port_nvs_entry_t *port_nvs_find(const char *key)
+{
+    for (size_t i = 0; i < PORT_NVS_MAX_KEYS; i++) {
+        if (s_entries[i].data && (0 == strcmp(s_entries[i].key, key))) {
+            return &s_entries[i];
+        }
+    }
+    return NULL;
+}
+
+static esp_err_t port_nvs_set(const char *key, nvs_type_t type, const void *value, size_t length)
+{
+    if (strlen(key) >= NVS_KEY_NAME_MAX_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    port_nvs_entry_t *entry = port_nvs_find(key);
+    for (size_t i = 0; !entry && (i < PORT_NVS_MAX_KEYS); i++) {
+        entry = s_entries[i].data ? NULL : &s_entries[i];
+    }
+    if (!entry) {
+        return ESP_ERR_NO_MEM;
+    }
+    uint8_t *data = malloc(length ? length : 1);
+    if (!data) {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(data, value, length);
+    free(entry->data);
+    strcpy(entry->key, key);
+    entry->type = type;
+    entry->data = data;
+    entry->size = length;
+    s_written += length;
+    return ESP_OK;
+}
+
+esp_err_t nvs_open(const char *namespace_name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+esp_err_t nvs_open_from_partition(const char *part_name, const char *namespace_name, nvs_open_mode_t open_mode,
+                                  nvs_handle_t *out_handle)
+{
+    return nvs_open(namespace_name, open_mode, out_handle);
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+}
+
+esp_err_t nvs_get_u8(nvs_handle_t handle, const char *key, uint8_t *out_value)
+{
+    const port_nvs_entry_t *entry = port_nvs_find(key);
+    if (!entry) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (NVS_TYPE_U8 != entry->type) {
+        return ESP_ERR_NVS_TYPE_MISMATCH;
+    }
+    *out_value = entry->data[0];
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_u8(nvs_handle_t handle, const char *key, uint8_t value)
+{
+    return port_nvs_set(key, NVS_TYPE_U8, &value, sizeof(value));
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+    const port_nvs_entry_t *entry = port_nvs_find(key);
+    if (!entry) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (NVS_TYPE_BLOB != entry->type) {
+        return ESP_ERR_NVS_TYPE_MISMATCH;
+    }
+    if (0 == strcmp(key, s_oversize_key)) {
+        *length = SIZE_MAX / 2;
+        return ESP_OK;
+    }
+    if (out_value) {
+        if (*length < entry->size) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        memcpy(out_value, entry->data, entry->size);
+    }
+    *length = entry->size;
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    return port_nvs_set(key, NVS_TYPE_BLOB, value, length);
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key)
+{
+    port_nvs_entry_t *entry = port_nvs_find(key);
+    if (!entry) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    free(entry->data);
+    entry->data = NULL;
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle)
+{
+    for (size_t i = 0; i < PORT_NVS_MAX_KEYS; i++) {
+        free(s_entries[i].data);
+        s_entries[i].data = NULL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    s_commits++;
+    return ESP_OK;
+}
+
+/* Moves the iterator to the first matching entry from its index on */
+static esp_err_t port_nvs_seek(nvs_iterator_t *iterator)
+{
+    struct port_nvs_iterator *it = *iterator;
+    for (; it->index < PORT_NVS_MAX_KEYS; it->index++) {
+        const port_nvs_entry_t *entry = &s_entries[it->index];
+        if (entry->data && ((NVS_TYPE_ANY == it->type) || (entry->type == it->type))) {
+            return ESP_OK;
+        }
+    }
+    free(it);
+    *iterator = NULL;
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_entry_find(const char *part_name, const char *namespace_name, nvs_type_t type, nvs_iterator_t *output_iterator)
+{
+    struct port_nvs_iterator *it = calloc(1, sizeof(struct port_nvs_iterator));
+    if (!it) {
+        return ESP_ERR_NO_MEM;
+    }
+    it->type = type;
+    *output_iterator = it;
+    return port_nvs_seek(output_iterator);
+}
+
+esp_err_t nvs_entry_next(nvs_iterator_t *iterator)
+{
+    if (!iterator || !*iterator) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    (*iterator)->index++;
+    return port_nvs_seek(iterator);
+}
+
+esp_err_t nvs_entry_info(const nvs_iterator_t iterator, nvs_entry_info_t *out_info)
+{
+    const port_nvs_entry_t *entry = &s_entries[iterator->index];
+    memset(out_info, 0, sizeof(*out_info));
+    strcpy(out_info->key, entry->key);
+    out_info->type = entry->type;
+    return ESP_OK;
+}
+
+void nvs_release_iterator(nvs_iterator_t iterator)
+{
+    free(iterator);
+}
+
+size_t port_nvs_count(void)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < PORT_NVS_MAX_KEYS; i++) {
+        count += (NULL != s_entries[i].data);
+    }
+    return count;
+}
+
+void port_nvs_set_oversize(const char *key)
+{
+    strncpy(s_oversize_key, key ? key : "", sizeof(s_oversize_key) - 1);
+}
+
+size_t port_nvs_commits(void)
+{
+    return s_commits;
+}
+
+size_t port_nvs_written(void)
+{
+    return s_written;
+}
+
+uint8_t *port_nvs_data(const char *key, size_t *size)
+{
+    port_nvs_entry_t *entry = port_nvs_find(key);
+    if (!entry) {
+        return NULL;
+    }
+    *size = entry->size;
+    return entry->data;
+}
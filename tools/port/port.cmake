@@ -0,0 +1,30 @@
+# Shared ESP-IDF and FreeRTOS stand-ins of the host tools, see README.md
+#
+#   tools_port_add(<target> [FREERTOS] [NVS])
+#
+# Call it after the tool's own include directories, so that the stubs of a tool come before the shared ones.
+# FREERTOS adds the FreeRTOS port on POSIX threads, NVS the NVS in RAM.
+
+include(CheckSymbolExists)
+
+set(TOOLS_PORT_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+# strlcpy() is in glibc from 2.38 only
+check_symbol_exists(strlcpy string.h HAVE_STRLCPY)
+
+function(tools_port_add target)
+    cmake_parse_arguments(PORT "FREERTOS;NVS" "" "" ${ARGN})
+    target_sources(${target} PRIVATE ${TOOLS_PORT_DIR}/esp_common.c)
+    target_include_directories(${target} PRIVATE ${TOOLS_PORT_DIR}/include)
+    if(HAVE_STRLCPY)
+        target_compile_definitions(${target} PRIVATE HAVE_STRLCPY)
+    endif()
+    if(PORT_FREERTOS)
+        find_package(Threads REQUIRED)
+        target_sources(${target} PRIVATE ${TOOLS_PORT_DIR}/freertos.c)
+        target_link_libraries(${target} PRIVATE Threads::Threads)
+    endif()
+    if(PORT_NVS)
+        target_sources(${target} PRIVATE ${TOOLS_PORT_DIR}/nvs.c)
+    endif()
+endfunction()
@@ -0,0 +1,294 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "bsp_read_stream.h"
+
+/* Not a multiple of any block size, the last block is short */
+#define TEST_FILE_SIZE          (1024 * 1024 + 123)
+#define TEST_READERS            (4)
+#define TEST_CLOSE_ROUNDS       (200)
+#define TEST_CHUNK_SIZE         (1000)
+
+typedef struct {
+    const char *path;
+    const bsp_read_stream_config_t *config;
+    uint32_t seed;
+    bool ok;
+    bsp_read_stream_stats_t stats;
+    SemaphoreHandle_t done;
+} reader_t;
+
+static int s_failures;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-56s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+/* Every byte tells its offset, a read from the wrong place does not match */
+static uint8_t pattern(uint32_t seed, off_t offset)
+{
+    uint32_t x = (uint32_t)offset * 2654435761u + seed;
+    return (uint8_t)(x ^ (x >> 13));
+}
+
+static bool same(uint32_t seed, off_t offset, const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] != pattern(seed, offset + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void file_write(const char *path, uint32_t seed, size_t size)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        perror(path);
+        exit(1);
+    }
+    for (size_t i = 0; i < size; i++) {
+        fputc(pattern(seed, i), fp);
+    }
+    fclose(fp);
+}
+
+/* Read the whole stream in chunks of varying size, as a decoder does */
+static bool read_all(bsp_read_stream_handle_t stream, uint32_t seed, size_t size)
+{
+    uint8_t buf[3 * TEST_CHUNK_SIZE];
+    off_t offset = 0;
+    bool ok = true;
+
+    for (int i = 0; ; i++) {
+        size_t want = TEST_CHUNK_SIZE + (i * 37) % (2 * TEST_CHUNK_SIZE);
+        size_t n = bsp_read_stream_read(stream, buf, want);
+        ok &= same(seed, offset, buf, n);
+        offset += n;
+        if (n < want) {
+            break;
+        }
+    }
+    return ok && (offset == (off_t)size) && (bsp_read_stream_tell(stream) == (off_t)size);
+}
+
+static void test_sequential(const char *path, const bsp_read_stream_config_t *config, const char *what)
+{
+    bsp_read_stream_handle_t stream = NULL;
+    bsp_read_stream_stats_t stats;
+    char line[80];
+
+    check(ESP_OK == bsp_read_stream_open(path, config, &stream), "open");
+    int64_t start = esp_timer_get_time();
+    bool ok = read_all(stream, 1, TEST_FILE_SIZE);
+    int64_t us = esp_timer_get_time() - start;
+    bsp_read_stream_get_stats(stream, &stats);
+    size_t blocks = (TEST_FILE_SIZE + config->block_size - 1) / config->block_size;
+    snprintf(line, sizeof(line), "%s: every byte read once, in order", what);
+    check(ok && (stats.bytes_read == TEST_FILE_SIZE), line);
+    snprintf(line, sizeof(line), "%s: each block fetched once, none dropped", what);
+    check((stats.blocks_fetched == blocks) && !stats.blocks_dropped, line);
+    printf("  %-24s %5.0f MB/s, reader waited %3" PRIu32 "%% of the time\n", what,
+           (double)TEST_FILE_SIZE / (us ? us : 1), (uint32_t)(stats.stall_us * 100 / (us ? us : 1)));
+    bsp_read_stream_close(stream);
+}
+
+static void test_seek(const char *path, const bsp_read_stream_config_t *config)
+{
+    bsp_read_stream_handle_t stream = NULL;
+    bsp_read_stream_stats_t stats;
+    uint8_t buf[256];
+
+    bsp_read_stream_open(path, config, &stream);
+    size_t n = bsp_read_stream_read(stream, buf, 100);
+    bsp_read_stream_get_stats(stream, &stats);
+    uint32_t dropped = stats.blocks_dropped;
+
+    /* A decoder skipping a tag stays inside the buffered blocks */
+    check((ESP_OK == bsp_read_stream_seek(stream, 1000, SEEK_CUR)) && (1100 == bsp_read_stream_tell(stream)),
+          "seek forward inside the buffer");
+    n = bsp_read_stream_read(stream, buf, sizeof(buf));
+    bsp_read_stream_get_stats(stream, &stats);
+    check(same(1, 1100, buf, n) && (sizeof(buf) == n) && (stats.blocks_dropped == dropped), "buffered blocks kept");
+
+    check(ESP_OK == bsp_read_stream_seek(stream, TEST_FILE_SIZE / 2 + 7, SEEK_SET), "seek outside the buffer");
+    n = bsp_read_stream_read(stream, buf, sizeof(buf));
+    bsp_read_stream_get_stats(stream, &stats);
+    check(same(1, TEST_FILE_SIZE / 2 + 7, buf, n) && (sizeof(buf) == n) && (stats.blocks_dropped > dropped),
+          "data at the new position, blocks dropped");
+
+    check(ESP_OK == bsp_read_stream_seek(stream, 0, SEEK_SET), "seek back to the start");
+    n = bsp_read_stream_read(stream, buf, sizeof(buf));
+    check(same(1, 0, buf, n) && (sizeof(buf) == n), "data from the start");
+
+    check(ESP_OK == bsp_read_stream_seek(stream, -10, SEEK_END), "seek to 10 bytes before the end");
+    n = bsp_read_stream_read(stream, buf, sizeof(buf));
+    check(same(1, TEST_FILE_SIZE - 10, buf, n) && (10 == n), "the last 10 bytes, then the end");
+    check(0 == bsp_read_stream_read(stream, buf, sizeof(buf)), "nothing read at the end");
+
+    check((ESP_ERR_INVALID_ARG == bsp_read_stream_seek(stream, 1, SEEK_END)) &&
+          (ESP_ERR_INVALID_ARG == bsp_read_stream_seek(stream, -1, SEEK_SET)) &&
+          (TEST_FILE_SIZE == bsp_read_stream_tell(stream)), "seek out of the file rejected, position kept");
+    bsp_read_stream_close(stream);
+}
+
+static void reader_task(void *arg)
+{
+    reader_t *reader = (reader_t *)arg;
+    bsp_read_stream_handle_t stream = NULL;
+
+    reader->ok = (ESP_OK == bsp_read_stream_open(reader->path, reader->config, &stream)) &&
+                 read_all(stream, reader->seed, TEST_FILE_SIZE);
+    bsp_read_stream_get_stats(stream, &reader->stats);
+    bsp_read_stream_close(stream);
+    xSemaphoreGive(reader->done);
+    vTaskDelete(NULL);
+}
+
+/* Readers of different files share the storage task */
+static void test_concurrent(char paths[][64], const bsp_read_stream_config_t *config)
+{
+    reader_t readers[TEST_READERS];
+    SemaphoreHandle_t done = xSemaphoreCreateCounting(TEST_READERS, 0);
+    bool ok = true;
+
+    for (int i = 0; i < TEST_READERS; i++) {
+        readers[i] = (reader_t) {
+            .path = paths[i], .config = config, .seed = 1 + i, .done = done,
+        };
+        xTaskCreate(reader_task, "reader", 4096, &readers[i], 5, NULL);
+    }
+    for (int i = 0; i < TEST_READERS; i++) {
+        xSemaphoreTake(done, portMAX_DELAY);
+    }
+    for (int i = 0; i < TEST_READERS; i++) {
+        ok &= readers[i].ok && (readers[i].stats.bytes_read == TEST_FILE_SIZE);
+    }
+    check(ok, "concurrent readers each read their own file");
+    vSemaphoreDelete(done);
+}
+
+/* Closing right after opening, while the storage task may be fetching the first block */
+static void test_close_while_fetching(const char *path, const bsp_read_stream_config_t *config)
+{
+    bool ok = true;
+
+    for (int i = 0; i < TEST_CLOSE_ROUNDS; i++) {
+        bsp_read_stream_handle_t stream = NULL;
+        uint8_t byte;
+        ok &= (ESP_OK == bsp_read_stream_open(path, config, &stream));
+        if (i % 2) {
+            ok &= (1 == bsp_read_stream_read(stream, &byte, 1)) && (pattern(1, 0) == byte);
+        }
+        bsp_read_stream_close(stream);
+    }
+    check(ok, "close while a block is fetched");
+}
+
+static void test_fopen(const char *path)
+{
+    uint8_t buf[512];
+
+    FILE *fp = bsp_read_stream_fopen(path, NULL);
+    check(fp, "stdio stream opened");
+    if (!fp) {
+        return;
+    }
+    size_t n = fread(buf, 1, sizeof(buf), fp);
+    check(same(1, 0, buf, n) && (sizeof(buf) == n), "fread");
+    check((0 == fseek(fp, 300000, SEEK_SET)) && (300000 == ftell(fp)) && (pattern(1, 300000) == fgetc(fp)),
+          "fseek, ftell and fgetc");
+    check((0 == fseek(fp, 0, SEEK_END)) && (TEST_FILE_SIZE == ftell(fp)) && (EOF == fgetc(fp)) && feof(fp),
+          "end of file");
+    check(0 == fclose(fp), "fclose closes the stream");
+}
+
+static void test_invalid(const char *path)
+{
+    bsp_read_stream_handle_t stream = NULL;
+    bsp_read_stream_config_t config = BSP_READ_STREAM_CONFIG_DEFAULT();
+
+    check(ESP_ERR_NOT_FOUND == bsp_read_stream_open("/nonexistent/file", NULL, &stream), "missing file");
+    config.block_size = 1000;
+    check(ESP_ERR_INVALID_ARG == bsp_read_stream_open(path, &config, &stream), "block size not a multiple of 512");
+    config = (bsp_read_stream_config_t)BSP_READ_STREAM_CONFIG_DEFAULT();
+    config.block_num = 1;
+    check(ESP_ERR_INVALID_ARG == bsp_read_stream_open(path, &config, &stream), "a single block");
+    check(!bsp_read_stream_fopen("/nonexistent/file", NULL), "stdio stream of a missing file");
+}
+
+int main(int argc, char **argv)
+{
+    const bsp_read_stream_config_t default_config = BSP_READ_STREAM_CONFIG_DEFAULT();
+    const bsp_read_stream_config_t small_config = {
+        .block_size = 4096,
+        .block_num = 2,
+        .caps = MALLOC_CAP_SPIRAM,
+    };
+    char dir[] = "/tmp/read_stream_test.XXXXXX";
+    char paths[TEST_READERS][64];
+    bool verbose = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    /* The invalid arguments log errors on purpose */
+    port_log_level = verbose ? ESP_LOG_DEBUG : ESP_LOG_NONE;
+
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    for (int i = 0; i < TEST_READERS; i++) {
+        snprintf(paths[i], sizeof(paths[i]), "%s/track%d.mp3", dir, i);
+        file_write(paths[i], 1 + i, TEST_FILE_SIZE);
+    }
+
+    printf("Sequential read of %d bytes\n", TEST_FILE_SIZE);
+    test_sequential(paths[0], &default_config, "3 blocks of 32 KB");
+    test_sequential(paths[0], &small_config, "2 blocks of 4 KB");
+    printf("\nSeeks\n");
+    test_seek(paths[0], &default_config);
+    test_seek(paths[0], &small_config);
+    printf("\nShared storage task\n");
+    test_concurrent(paths, &small_config);
+    test_concurrent(paths, &default_config);
+    test_close_while_fetching(paths[0], &small_config);
+    printf("\nstdio stream\n");
+    test_fopen(paths[0]);
+    printf("\nInvalid arguments\n");
+    test_invalid(paths[0]);
+
+    for (int i = 0; i < TEST_READERS; i++) {
+        unlink(paths[i]);
+    }
+    rmdir(dir);
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+    return s_failures ? 1 : 0;
+}
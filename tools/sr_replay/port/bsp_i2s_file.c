@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "bsp_board.h"
+#include "sr_replay.h"
+
+#define I2S_BYTES_PER_SECOND    (SR_REPLAY_SAMPLE_RATE * 2 * sizeof(int16_t))
+
+static const char *TAG = "bsp_i2s_file";
+
+static FILE *s_fp = NULL;
+static bool s_realtime = false;
+static volatile bool s_done = false;
+static uint64_t s_bytes = 0;
+static int64_t s_start_us = 0;
+static int64_t s_cpu_mark = -1;
+static sr_replay_cpu_t s_cpu;
+static pthread_mutex_t s_cpu_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static bool bsp_get_sleep_mode()
+{
+    return false;
+}
+
+bsp_bottom_property_t *bsp_board_get_sensor_handle(void)
+{
+    static bsp_bottom_property_t handle = {
+        .get_sleep_mode = bsp_get_sleep_mode,
+    };
+    return &handle;
+}
+
+esp_err_t sr_replay_i2s_open(const char *path, bool realtime)
+{
+    ESP_RETURN_ON_FALSE(NULL == s_fp, ESP_ERR_INVALID_STATE, TAG, "capture already open");
+    s_fp = fopen(path, "rb");
+    ESP_RETURN_ON_FALSE(s_fp, ESP_ERR_NOT_FOUND, TAG, "open %s failed", path);
+    s_realtime = realtime;
+    return ESP_OK;
+}
+
+bool sr_replay_i2s_done(void)
+{
+    return s_done;
+}
+
+void sr_replay_i2s_get_cpu(sr_replay_cpu_t *cpu)
+{
+    pthread_mutex_lock(&s_cpu_lock);
+    *cpu = s_cpu;
+    pthread_mutex_unlock(&s_cpu_lock);
+}
+
+/**
+ * @brief Read the next chunk of the capture, the last one padded with silence
+ *
+ * Past the end of the capture the call blocks for good, the replay is over once the rest of the pipeline is idle.
+ */
+esp_err_t bsp_i2s_read(void *audio_buffer, size_t len, size_t *bytes_read, uint32_t timeout_ms)
+{
+    int64_t now = sr_replay_thread_cpu_us();
+    if (s_cpu_mark >= 0) {
+        uint32_t us = now - s_cpu_mark;
+        pthread_mutex_lock(&s_cpu_lock);
+        s_cpu.chunks++;
+        s_cpu.total_us += us;
+        s_cpu.max_us = (us > s_cpu.max_us) ? us : s_cpu.max_us;
+        pthread_mutex_unlock(&s_cpu_lock);
+    }
+
+    size_t len_read = s_fp ? fread(audio_buffer, 1, len, s_fp) : 0;
+    if (0 == len_read) {
+        s_done = true;
+        while (true) {
+            vTaskDelay(portMAX_DELAY);
+        }
+    }
+    memset((uint8_t *)audio_buffer + len_read, 0, len - len_read);
+
+    if (0 == s_bytes) {
+        s_start_us = esp_timer_get_time();
+    }
+    s_bytes += len;
+    if (s_realtime) {
+        /* A chunk is due once its last sample would have been captured */
+        int64_t due_us = s_start_us + (int64_t)(s_bytes * 1000000 / I2S_BYTES_PER_SECOND);
+        int64_t wait_us = due_us - esp_timer_get_time();
+        if (wait_us > 0) {
+            vTaskDelay(pdMS_TO_TICKS(wait_us / 1000));
+        }
+    }
+    *bytes_read = len;
+    s_cpu_mark = sr_replay_thread_cpu_us();
+    return ESP_OK;
+}
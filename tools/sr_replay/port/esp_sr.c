@@ -0,0 +1,449 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_sr_port.h"
+#include "sr_replay.h"
+
+#define AFE_FEED_CHANNELS       3       /* Two microphones and the reference, as fed by app_sr.c */
+#define AFE_BUFFER_CHUNKS       8       /* Chunks the AFE buffers between feed and fetch */
+#define MN_PHRASE_LEN_MAX       64
+
+static const char *TAG = "esp_sr_port";
+
+/**
+ * @brief The AFE: channel 0 of every fed chunk goes through a chunk ring to fetch, where the recognizer looks for the
+ * wake word. A detection is reported as WAKENET_DETECTED, then WAKENET_CHANNEL_VERIFIED on the next chunk.
+ */
+struct esp_afe_sr_data_t {
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    int16_t ring[AFE_BUFFER_CHUNKS][SR_REPLAY_CHUNK];
+    uint64_t ring_pos[AFE_BUFFER_CHUNKS];
+    uint32_t head;
+    uint32_t count;
+    uint64_t next_pos;
+    bool wakenet_enabled;
+    bool verify_pending;
+    bool fetch_waiting;
+    int16_t out[SR_REPLAY_CHUNK];
+    afe_fetch_result_t result;
+};
+
+struct model_iface_data_t {
+    int timeout_samples;
+    int listened;               /* Samples since the wake word or the last command */
+    uint64_t next_pos;
+    esp_mn_results_t results;
+};
+
+typedef struct {
+    int id;
+    char phrase[MN_PHRASE_LEN_MAX];
+} mn_command_t;
+
+static const sr_replay_recognizer_t *s_recognizer = NULL;
+static void *s_recognizer_ctx = NULL;
+
+static esp_afe_sr_data_t *s_afe = NULL;
+static bool s_realtime = false;
+static uint64_t s_fetch_pos = 0;        /* First sample of the chunk fetched last, read by the MultiNet stub */
+static uint32_t s_fed = 0;
+static uint32_t s_dropped = 0;
+static uint32_t s_waited = 0;
+static int64_t s_cpu_mark = -1;
+static sr_replay_cpu_t s_cpu;
+
+static mn_command_t s_commands[ESP_MN_MAX_PHRASE_NUM];
+static int s_command_num = 0;
+
+static sr_replay_event_t *s_events = NULL;
+static size_t s_event_num = 0;
+static size_t s_event_cap = 0;
+
+static char *s_model_names[] = {"wn9_hiesp", "wn9_hilexin", "mn6_en", "mn6_cn"};
+static srmodel_list_t s_models = {
+    .model_name = s_model_names,
+    .num = sizeof(s_model_names) / sizeof(s_model_names[0]),
+};
+
+void sr_replay_sr_set_recognizer(const sr_replay_recognizer_t *recognizer, void *ctx)
+{
+    s_recognizer = recognizer;
+    s_recognizer_ctx = ctx;
+}
+
+void sr_replay_sr_set_realtime(bool realtime)
+{
+    s_realtime = realtime;
+}
+
+int sr_replay_sr_find_command(const char *phrase)
+{
+    for (int i = 0; i < s_command_num; i++) {
+        if (0 == strcasecmp(s_commands[i].phrase, phrase)) {
+            return s_commands[i].id;
+        }
+    }
+    return -1;
+}
+
+int sr_replay_sr_command_num(void)
+{
+    return s_command_num;
+}
+
+bool sr_replay_sr_idle(void)
+{
+    if (NULL == s_afe) {
+        return false;
+    }
+    pthread_mutex_lock(&s_afe->lock);
+    bool idle = (0 == s_afe->count) && s_afe->fetch_waiting;
+    pthread_mutex_unlock(&s_afe->lock);
+    return idle;
+}
+
+uint64_t sr_replay_sr_position(void)
+{
+    pthread_mutex_lock(&s_afe->lock);
+    uint64_t pos = s_fetch_pos + SR_REPLAY_CHUNK;
+    pthread_mutex_unlock(&s_afe->lock);
+    return pos;
+}
+
+void sr_replay_sr_get_cpu(sr_replay_cpu_t *cpu)
+{
+    pthread_mutex_lock(&s_afe->lock);
+    *cpu = s_cpu;
+    pthread_mutex_unlock(&s_afe->lock);
+}
+
+void sr_replay_sr_get_feed(uint32_t *fed, uint32_t *dropped, uint32_t *waited)
+{
+    pthread_mutex_lock(&s_afe->lock);
+    *fed = s_fed;
+    *dropped = s_dropped;
+    *waited = s_waited;
+    pthread_mutex_unlock(&s_afe->lock);
+}
+
+const sr_replay_event_t *sr_replay_sr_get_events(size_t *num)
+{
+    *num = s_event_num;
+    return s_events;
+}
+
+static void sr_event_add(sr_replay_event_type_t type, int command_id, uint64_t pos)
+{
+    if (s_event_num == s_event_cap) {
+        size_t cap = s_event_cap ? (2 * s_event_cap) : 64;
+        sr_replay_event_t *events = realloc(s_events, cap * sizeof(sr_replay_event_t));
+        if (NULL == events) {
+            ESP_LOGE(TAG, "no mem for events");
+            return;
+        }
+        s_events = events;
+        s_event_cap = cap;
+    }
+    s_events[s_event_num++] = (sr_replay_event_t) {
+        .type = type,
+        .command_id = command_id,
+        .pos = pos + SR_REPLAY_CHUNK,
+        .time_us = esp_timer_get_time(),
+    };
+}
+
+srmodel_list_t *esp_srmodel_init(const char *partition_label)
+{
+    return &s_models;
+}
+
+char *esp_srmodel_filter(srmodel_list_t *models, const char *keyword1, const char *keyword2)
+{
+    for (int i = 0; models && (i < models->num); i++) {
+        if ((!keyword1 || strstr(models->model_name[i], keyword1)) &&
+                (!keyword2 || strstr(models->model_name[i], keyword2))) {
+            return models->model_name[i];
+        }
+    }
+    return NULL;
+}
+
+static esp_afe_sr_data_t *afe_create_from_config(afe_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(NULL == s_afe, NULL, TAG, "only one AFE instance");
+    esp_afe_sr_data_t *afe = calloc(1, sizeof(esp_afe_sr_data_t));
+    ESP_RETURN_ON_FALSE(afe, NULL, TAG, "no mem for AFE");
+    pthread_mutex_init(&afe->lock, NULL);
+    pthread_cond_init(&afe->changed, NULL);
+    afe->wakenet_enabled = config->wakenet_init;
+    s_afe = afe;
+    return afe;
+}
+
+static int afe_get_chunksize(esp_afe_sr_data_t *afe)
+{
+    return SR_REPLAY_CHUNK;
+}
+
+static int afe_get_channel_num(esp_afe_sr_data_t *afe)
+{
+    return 1;
+}
+
+/**
+ * @brief Queue channel 0 of a chunk for fetch
+ *
+ * A full ring blocks the feed, so a replay runs as fast as detection allows and drops nothing. In real time, like
+ * the AFE ring buffer on the device, a full ring drops the chunk.
+ */
+static int afe_feed(esp_afe_sr_data_t *afe, const int16_t *in)
+{
+    pthread_mutex_lock(&afe->lock);
+    if (AFE_BUFFER_CHUNKS == afe->count) {
+        if (s_realtime) {
+            s_dropped++;
+            afe->next_pos += SR_REPLAY_CHUNK;
+            pthread_mutex_unlock(&afe->lock);
+            ESP_LOGW(TAG, "AFE buffer full, chunk dropped");
+            return 0;
+        }
+        s_waited++;
+        while (AFE_BUFFER_CHUNKS == afe->count) {
+            pthread_cond_wait(&afe->changed, &afe->lock);
+        }
+    }
+    uint32_t tail = (afe->head + afe->count) % AFE_BUFFER_CHUNKS;
+    for (int i = 0; i < SR_REPLAY_CHUNK; i++) {
+        afe->ring[tail][i] = in[i * AFE_FEED_CHANNELS];
+    }
+    afe->ring_pos[tail] = afe->next_pos;
+    afe->next_pos += SR_REPLAY_CHUNK;
+    afe->count++;
+    s_fed++;
+    pthread_cond_broadcast(&afe->changed);
+    pthread_mutex_unlock(&afe->lock);
+    return SR_REPLAY_CHUNK;
+}
+
+static afe_fetch_result_t *afe_fetch(esp_afe_sr_data_t *afe)
+{
+    pthread_mutex_lock(&afe->lock);
+    int64_t now = sr_replay_thread_cpu_us();
+    if (s_cpu_mark >= 0) {
+        uint32_t us = now - s_cpu_mark;
+        s_cpu.chunks++;
+        s_cpu.total_us += us;
+        s_cpu.max_us = (us > s_cpu.max_us) ? us : s_cpu.max_us;
+    }
+    afe->fetch_waiting = true;
+    while (0 == afe->count) {
+        pthread_cond_wait(&afe->changed, &afe->lock);
+    }
+    afe->fetch_waiting = false;
+    memcpy(afe->out, afe->ring[afe->head], sizeof(afe->out));
+    s_fetch_pos = afe->ring_pos[afe->head];
+    afe->head = (afe->head + 1) % AFE_BUFFER_CHUNKS;
+    afe->count--;
+    bool wakenet_enabled = afe->wakenet_enabled;
+    bool verify_pending = afe->verify_pending;
+    afe->verify_pending = false;
+    pthread_cond_broadcast(&afe->changed);
+    pthread_mutex_unlock(&afe->lock);
+
+    /* CPU time from here to the next fetch is the detect task's work on this chunk */
+    s_cpu_mark = sr_replay_thread_cpu_us();
+    afe->result = (afe_fetch_result_t) {
+        .data = afe->out,
+        .data_size = sizeof(afe->out),
+        .wakeup_state = WAKENET_NO_DETECT,
+        .ret_value = ESP_OK,
+    };
+    if (verify_pending) {
+        afe->result.wakeup_state = WAKENET_CHANNEL_VERIFIED;
+    } else if (wakenet_enabled && s_recognizer->wake(s_recognizer_ctx, afe->out, SR_REPLAY_CHUNK, s_fetch_pos)) {
+        afe->result.wakeup_state = WAKENET_DETECTED;
+        afe->result.wake_word_index = 1;
+        afe->result.wakenet_model_index = 1;
+        afe->verify_pending = true;
+        sr_event_add(SR_REPLAY_EVENT_WAKE, -1, s_fetch_pos);
+    }
+    return &afe->result;
+}
+
+static int afe_set_wakenet(esp_afe_sr_data_t *afe, char *model_name)
+{
+    ESP_LOGI(TAG, "wakenet %s", model_name);
+    return 1;
+}
+
+static int afe_disable_wakenet(esp_afe_sr_data_t *afe)
+{
+    pthread_mutex_lock(&afe->lock);
+    afe->wakenet_enabled = false;
+    pthread_mutex_unlock(&afe->lock);
+    return 1;
+}
+
+static int afe_enable_wakenet(esp_afe_sr_data_t *afe)
+{
+    pthread_mutex_lock(&afe->lock);
+    afe->wakenet_enabled = true;
+    pthread_mutex_unlock(&afe->lock);
+    return 1;
+}
+
+static void afe_destroy(esp_afe_sr_data_t *afe)
+{
+    pthread_mutex_destroy(&afe->lock);
+    pthread_cond_destroy(&afe->changed);
+    free(afe);
+    s_afe = NULL;
+}
+
+const esp_afe_sr_iface_t ESP_AFE_SR_HANDLE = {
+    .create_from_config = afe_create_from_config,
+    .get_feed_chunksize = afe_get_chunksize,
+    .get_fetch_chunksize = afe_get_chunksize,
+    .get_channel_num = afe_get_channel_num,
+    .feed = afe_feed,
+    .fetch = afe_fetch,
+    .set_wakenet = afe_set_wakenet,
+    .disable_wakenet = afe_disable_wakenet,
+    .enable_wakenet = afe_enable_wakenet,
+    .destroy = afe_destroy,
+};
+
+static model_iface_data_t *mn_create(const char *model_name, int duration)
+{
+    model_iface_data_t *model = calloc(1, sizeof(model_iface_data_t));
+    ESP_RETURN_ON_FALSE(model, NULL, TAG, "no mem for %s", model_name);
+    model->timeout_samples = duration * (SR_REPLAY_SAMPLE_RATE / 1000);
+    return model;
+}
+
+static int mn_get_samp_rate(model_iface_data_t *model)
+{
+    return SR_REPLAY_SAMPLE_RATE;
+}
+
+static int mn_get_samp_chunksize(model_iface_data_t *model)
+{
+    return SR_REPLAY_CHUNK;
+}
+
+/**
+ * @brief Ask the recognizer for a command, timing out like MultiNet when none comes
+ *
+ * A chunk which does not follow the previous one starts listening anew: the wake word was detected in between.
+ */
+static esp_mn_state_t mn_detect(model_iface_data_t *model, int16_t *samples)
+{
+    uint64_t pos = s_fetch_pos;
+    if (pos != model->next_pos) {
+        model->listened = 0;
+    }
+    model->next_pos = pos + SR_REPLAY_CHUNK;
+    model->listened += SR_REPLAY_CHUNK;
+
+    int id = s_recognizer->command(s_recognizer_ctx, samples, SR_REPLAY_CHUNK, pos);
+    if (id >= 0) {
+        model->listened = 0;
+        model->results = (esp_mn_results_t) {
+            .state = ESP_MN_STATE_DETECTED,
+            .num = 1,
+            .command_id = {id},
+            .prob = {1.0f},
+        };
+        for (int i = 0; i < s_command_num; i++) {
+            if (s_commands[i].id == id) {
+                model->results.phrase_id[0] = i;
+                snprintf(model->results.string, sizeof(model->results.string), "%s", s_commands[i].phrase);
+                break;
+            }
+        }
+        sr_event_add(SR_REPLAY_EVENT_COMMAND, id, pos);
+        return ESP_MN_STATE_DETECTED;
+    }
+    if (model->listened >= model->timeout_samples) {
+        model->listened = 0;
+        model->next_pos = 0;
+        sr_event_add(SR_REPLAY_EVENT_TIMEOUT, -1, pos);
+        return ESP_MN_STATE_TIMEOUT;
+    }
+    return ESP_MN_STATE_DETECTING;
+}
+
+static esp_mn_results_t *mn_get_results(model_iface_data_t *model)
+{
+    return &model->results;
+}
+
+static void mn_destroy(model_iface_data_t *model)
+{
+    free(model);
+}
+
+static esp_mn_iface_t s_multinet = {
+    .create = mn_create,
+    .get_samp_rate = mn_get_samp_rate,
+    .get_samp_chunksize = mn_get_samp_chunksize,
+    .detect = mn_detect,
+    .get_results = mn_get_results,
+    .destroy = mn_destroy,
+};
+
+esp_mn_iface_t *esp_mn_handle_from_name(char *model_name)
+{
+    return &s_multinet;
+}
+
+esp_err_t esp_mn_commands_add(int command_id, char *phrase)
+{
+    ESP_RETURN_ON_FALSE(phrase && (strlen(phrase) < MN_PHRASE_LEN_MAX), ESP_ERR_INVALID_ARG, TAG, "invalid phrase");
+    ESP_RETURN_ON_FALSE(s_command_num < ESP_MN_MAX_PHRASE_NUM, ESP_ERR_NO_MEM, TAG, "command list full");
+    s_commands[s_command_num].id = command_id;
+    strcpy(s_commands[s_command_num].phrase, phrase);
+    s_command_num++;
+    return ESP_OK;
+}
+
+esp_err_t esp_mn_commands_clear(void)
+{
+    s_command_num = 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_mn_commands_modify(char *old_phrase, char *new_phrase)
+{
+    ESP_RETURN_ON_FALSE(new_phrase && (strlen(new_phrase) < MN_PHRASE_LEN_MAX), ESP_ERR_INVALID_ARG, TAG,
+                        "invalid phrase");
+    for (int i = 0; i < s_command_num; i++) {
+        if (0 == strcmp(s_commands[i].phrase, old_phrase)) {
+            strcpy(s_commands[i].phrase, new_phrase);
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_mn_error_t *esp_mn_commands_update(const esp_mn_iface_t *multinet, model_iface_data_t *model_data)
+{
+    return NULL;
+}
+
+void esp_mn_commands_print(void)
+{
+    for (int i = 0; i < s_command_num; i++) {
+        ESP_LOGI(TAG, "command %d: %s", s_commands[i].id, s_commands[i].phrase);
+    }
+}
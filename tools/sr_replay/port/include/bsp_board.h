@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_system.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef bool (*bsp_sys_get_sleep_mode)();
+
+typedef struct {
+    bsp_sys_get_sleep_mode get_sleep_mode;
+} bsp_bottom_property_t;
+
+/**
+ * @brief Read the capture file opened by `sr_replay_i2s_open`, see port/bsp_i2s_file.c
+ */
+esp_err_t bsp_i2s_read(void *audio_buffer, size_t len, size_t *bytes_read, uint32_t timeout_ms);
+
+bsp_bottom_property_t *bsp_board_get_sensor_handle(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/**
+ * The esp-sr interfaces used by app_sr.c, implemented on top of an sr_replay recognizer by port/esp_sr.c.
+ * Every esp-sr header app_sr.c includes resolves to this one.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ESP_WN_PREFIX           "wn"
+#define ESP_MN_PREFIX           "mn"
+#define ESP_MN_ENGLISH          "en"
+#define ESP_MN_CHINESE          "cn"
+#define ESP_MN_MAX_PHRASE_NUM   200
+#define ESP_MN_RESULT_MAX_NUM   5
+
+typedef struct {
+    char **model_name;
+    char **model_info;
+    int num;
+} srmodel_list_t;
+
+typedef enum {
+    WAKENET_NO_DETECT = 0,
+    WAKENET_CHANNEL_VERIFIED = -1,
+    WAKENET_DETECTED = 1,
+} wakenet_state_t;
+
+typedef enum {
+    ESP_MN_STATE_DETECTING = 0,
+    ESP_MN_STATE_DETECTED = 1,
+    ESP_MN_STATE_TIMEOUT = 2,
+} esp_mn_state_t;
+
+typedef struct {
+    esp_mn_state_t state;
+    int num;
+    int command_id[ESP_MN_RESULT_MAX_NUM];
+    int phrase_id[ESP_MN_RESULT_MAX_NUM];
+    float prob[ESP_MN_RESULT_MAX_NUM];
+    char string[256];
+} esp_mn_results_t;
+
+typedef struct {
+    int num;
+    int *phrases;
+} esp_mn_error_t;
+
+typedef struct model_iface_data_t model_iface_data_t;
+
+typedef struct {
+    model_iface_data_t *(*create)(const char *model_name, int duration);
+    int (*get_samp_rate)(model_iface_data_t *model);
+    int (*get_samp_chunksize)(model_iface_data_t *model);
+    esp_mn_state_t (*detect)(model_iface_data_t *model, int16_t *samples);
+    esp_mn_results_t *(*get_results)(model_iface_data_t *model);
+    void (*destroy)(model_iface_data_t *model);
+} esp_mn_iface_t;
+
+typedef struct {
+    bool aec_init;
+    bool se_init;
+    bool vad_init;
+    bool wakenet_init;
+    char *wakenet_model_name;
+} afe_config_t;
+
+#define AFE_CONFIG_DEFAULT() {      \
+    .aec_init = true,               \
+    .se_init = true,                \
+    .vad_init = true,               \
+    .wakenet_init = true,           \
+    .wakenet_model_name = NULL,     \
+}
+
+typedef struct {
+    int16_t *data;
+    int data_size;
+    wakenet_state_t wakeup_state;
+    int wake_word_index;
+    int wakenet_model_index;
+    float data_volume;
+    int trigger_channel_id;
+    int wake_word_length;
+    int ret_value;
+} afe_fetch_result_t;
+
+typedef struct esp_afe_sr_data_t esp_afe_sr_data_t;
+
+typedef struct {
+    esp_afe_sr_data_t *(*create_from_config)(afe_config_t *config);
+    int (*get_feed_chunksize)(esp_afe_sr_data_t *afe);
+    int (*get_fetch_chunksize)(esp_afe_sr_data_t *afe);
+    int (*get_channel_num)(esp_afe_sr_data_t *afe);
+    int (*feed)(esp_afe_sr_data_t *afe, const int16_t *in);
+    afe_fetch_result_t *(*fetch)(esp_afe_sr_data_t *afe);
+    int (*set_wakenet)(esp_afe_sr_data_t *afe, char *model_name);
+    int (*disable_wakenet)(esp_afe_sr_data_t *afe);
+    int (*enable_wakenet)(esp_afe_sr_data_t *afe);
+    void (*destroy)(esp_afe_sr_data_t *afe);
+} esp_afe_sr_iface_t;
+
+extern const esp_afe_sr_iface_t ESP_AFE_SR_HANDLE;
+
+srmodel_list_t *esp_srmodel_init(const char *partition_label);
+char *esp_srmodel_filter(srmodel_list_t *models, const char *keyword1, const char *keyword2);
+
+esp_mn_iface_t *esp_mn_handle_from_name(char *model_name);
+
+esp_err_t esp_mn_commands_add(int command_id, char *phrase);
+esp_err_t esp_mn_commands_clear(void);
+esp_err_t esp_mn_commands_modify(char *old_phrase, char *new_phrase);
+esp_mn_error_t *esp_mn_commands_update(const esp_mn_iface_t *multinet, model_iface_data_t *model_data);
+void esp_mn_commands_print(void);
+
+#ifdef __cplusplus
+}
+#endif
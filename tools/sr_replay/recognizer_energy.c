@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_check.h"
+#include "sr_replay.h"
+
+#define ENERGY_LEVEL_DEFAULT    1000    /* RMS of a chunk taken as speech */
+#define ENERGY_ONSET_CHUNKS     3       /* Loud chunks in a row starting an utterance */
+#define ENERGY_GAP_CHUNKS       10      /* Quiet chunks in a row ending one, 320 ms */
+
+static const char *TAG = "energy";
+
+/**
+ * @brief Utterance detector: the first utterance is the wake word, the next one a command, and so on. Commands cycle
+ * through the command list, or are always the one given.
+ */
+typedef struct {
+    int level;
+    int command_id;             /* -1 to cycle */
+    int next_command;
+    int loud;
+    int quiet;
+    bool in_utterance;
+} energy_ctx_t;
+
+static esp_err_t energy_create(const char *arg, void **ret_ctx)
+{
+    energy_ctx_t *ctx = calloc(1, sizeof(energy_ctx_t));
+    ESP_RETURN_ON_FALSE(ctx, ESP_ERR_NO_MEM, TAG, "no mem");
+    ctx->level = ENERGY_LEVEL_DEFAULT;
+    ctx->command_id = -1;
+    ctx->quiet = ENERGY_GAP_CHUNKS;
+    if (arg && (sscanf(arg, "%d,%d", &ctx->level, &ctx->command_id) < 1)) {
+        free(ctx);
+        ESP_LOGE(TAG, "bad argument '%s'", arg);
+        return ESP_ERR_INVALID_ARG;
+    }
+    *ret_ctx = ctx;
+    return ESP_OK;
+}
+
+/**
+ * @brief Whether an utterance starts with this chunk
+ */
+static bool energy_onset(energy_ctx_t *ctx, const int16_t *samples, int num)
+{
+    double sum = 0;
+    for (int i = 0; i < num; i++) {
+        sum += (double)samples[i] * samples[i];
+    }
+    bool loud = sqrt(sum / num) >= ctx->level;
+
+    ctx->loud = loud ? (ctx->loud + 1) : 0;
+    ctx->quiet = loud ? 0 : (ctx->quiet + 1);
+    if (ctx->in_utterance) {
+        ctx->in_utterance = (ctx->quiet < ENERGY_GAP_CHUNKS);
+        return false;
+    }
+    if (ctx->loud >= ENERGY_ONSET_CHUNKS) {
+        ctx->in_utterance = true;
+        return true;
+    }
+    return false;
+}
+
+static bool energy_wake(void *arg, const int16_t *samples, int num, uint64_t pos)
+{
+    return energy_onset(arg, samples, num);
+}
+
+static int energy_command(void *arg, const int16_t *samples, int num, uint64_t pos)
+{
+    energy_ctx_t *ctx = arg;
+    if (!energy_onset(ctx, samples, num)) {
+        return -1;
+    }
+    if (ctx->command_id >= 0) {
+        return ctx->command_id;
+    }
+    int command_num = sr_replay_sr_command_num();
+    return command_num ? (ctx->next_command++ % command_num) : -1;
+}
+
+static void energy_destroy(void *ctx)
+{
+    free(ctx);
+}
+
+const sr_replay_recognizer_t sr_replay_energy_recognizer = {
+    .name = "energy",
+    .help = "<rms level>[,<command id>], utterances above the level alternate between wake word and command",
+    .create = energy_create,
+    .wake = energy_wake,
+    .command = energy_command,
+    .destroy = energy_destroy,
+};
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_check.h"
+#include "sr_replay.h"
+
+#define SCRIPT_LINE_MAX         128
+
+static const char *TAG = "script";
+
+/**
+ * @brief Labels of a capture, one per line, in time order:
+ *
+ *     <seconds> wake
+ *     <seconds> cmd <command id or phrase>
+ *
+ * A label fires in the chunk holding its time when the pipeline asks for that kind of detection there, and is missed
+ * otherwise. Phrases are resolved against the command list when they fire.
+ */
+typedef struct {
+    double time;
+    bool wake;
+    int command_id;             /* -1 when given as a phrase */
+    char *phrase;
+    bool fired;
+    uint64_t fired_pos;
+} script_label_t;
+
+typedef struct {
+    script_label_t *labels;
+    size_t num;
+    size_t next;
+} script_ctx_t;
+
+static void script_destroy(void *arg)
+{
+    script_ctx_t *ctx = arg;
+    for (size_t i = 0; i < ctx->num; i++) {
+        free(ctx->labels[i].phrase);
+    }
+    free(ctx->labels);
+    free(ctx);
+}
+
+static esp_err_t script_parse(script_ctx_t *ctx, char *line, int line_num)
+{
+    char *p = line + strspn(line, " \t");
+    if (('#' == *p) || ('\0' == *p) || ('\n' == *p)) {
+        return ESP_OK;
+    }
+
+    script_label_t label = {.command_id = -1};
+    char kind[8];
+    int len = 0;
+    ESP_RETURN_ON_FALSE(2 == sscanf(p, "%lf %7s %n", &label.time, kind, &len), ESP_ERR_INVALID_ARG, TAG,
+                        "line %d: expected '<seconds> wake' or '<seconds> cmd <command>'", line_num);
+    if (0 == strcmp(kind, "wake")) {
+        label.wake = true;
+    } else {
+        ESP_RETURN_ON_FALSE(0 == strcmp(kind, "cmd"), ESP_ERR_INVALID_ARG, TAG, "line %d: unknown label %s", line_num,
+                            kind);
+        char *command = p + len;
+        command[strcspn(command, "\r\n")] = '\0';
+        ESP_RETURN_ON_FALSE(*command, ESP_ERR_INVALID_ARG, TAG, "line %d: command missing", line_num);
+        char *end;
+        long id = strtol(command, &end, 10);
+        if (('\0' == *end) && (end != command)) {
+            label.command_id = id;
+        } else {
+            label.phrase = strdup(command);
+            ESP_RETURN_ON_FALSE(label.phrase, ESP_ERR_NO_MEM, TAG, "no mem");
+        }
+    }
+    ESP_RETURN_ON_FALSE(!ctx->num || (label.time >= ctx->labels[ctx->num - 1].time), ESP_ERR_INVALID_ARG, TAG,
+                        "line %d: labels out of order", line_num);
+
+    script_label_t *labels = realloc(ctx->labels, (ctx->num + 1) * sizeof(script_label_t));
+    if (NULL == labels) {
+        free(label.phrase);
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->labels = labels;
+    ctx->labels[ctx->num++] = label;
+    return ESP_OK;
+}
+
+static esp_err_t script_create(const char *arg, void **ret_ctx)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(arg, ESP_ERR_INVALID_ARG, TAG, "label file missing");
+    FILE *fp = fopen(arg, "r");
+    ESP_RETURN_ON_FALSE(fp, ESP_ERR_NOT_FOUND, TAG, "open %s failed", arg);
+
+    script_ctx_t *ctx = calloc(1, sizeof(script_ctx_t));
+    ESP_GOTO_ON_FALSE(ctx, ESP_ERR_NO_MEM, err, TAG, "no mem");
+    char line[SCRIPT_LINE_MAX];
+    for (int line_num = 1; fgets(line, sizeof(line), fp); line_num++) {
+        ESP_GOTO_ON_ERROR(script_parse(ctx, line, line_num), err, TAG, "parse %s failed", arg);
+    }
+    fclose(fp);
+    *ret_ctx = ctx;
+    return ESP_OK;
+
+err:
+    fclose(fp);
+    if (ctx) {
+        script_destroy(ctx);
+    }
+    return ret;
+}
+
+/**
+ * @brief Fire the next label if it falls in this chunk and is of the kind asked for, skipping the missed ones
+ */
+static script_label_t *script_next(script_ctx_t *ctx, bool wake, int num, uint64_t pos)
+{
+    const double end = (double)(pos + num) / SR_REPLAY_SAMPLE_RATE;
+    while ((ctx->next < ctx->num) && (ctx->labels[ctx->next].time < end)) {
+        script_label_t *label = &ctx->labels[ctx->next++];
+        if ((label->wake == wake) && (label->time >= (double)pos / SR_REPLAY_SAMPLE_RATE)) {
+            label->fired = true;
+            label->fired_pos = pos + num;
+            return label;
+        }
+    }
+    return NULL;
+}
+
+static bool script_wake(void *arg, const int16_t *samples, int num, uint64_t pos)
+{
+    return NULL != script_next(arg, true, num, pos);
+}
+
+static int script_command(void *arg, const int16_t *samples, int num, uint64_t pos)
+{
+    script_label_t *label = script_next(arg, false, num, pos);
+    if (label && label->phrase) {
+        label->command_id = sr_replay_sr_find_command(label->phrase);
+        if (label->command_id < 0) {
+            ESP_LOGW(TAG, "'%s' is not a command", label->phrase);
+            label->fired = false;
+        }
+    }
+    return (label && label->fired) ? label->command_id : -1;
+}
+
+static void script_report(void *arg)
+{
+    script_ctx_t *ctx = arg;
+    size_t fired = 0;
+    for (size_t i = 0; i < ctx->num; i++) {
+        fired += ctx->labels[i].fired;
+    }
+    printf("labels: %zu, fired %zu, missed %zu\n", ctx->num, fired, ctx->num - fired);
+    for (size_t i = 0; i < ctx->num; i++) {
+        const script_label_t *label = &ctx->labels[i];
+        if (!label->fired) {
+            if (label->wake) {
+                printf("  missed %9.3f s wake\n", label->time);
+            } else if (label->phrase) {
+                printf("  missed %9.3f s cmd %s\n", label->time, label->phrase);
+            } else {
+                printf("  missed %9.3f s cmd %d\n", label->time, label->command_id);
+            }
+        }
+    }
+}
+
+const sr_replay_recognizer_t sr_replay_script_recognizer = {
+    .name = "script",
+    .help = "<label file>, lines of '<seconds> wake' and '<seconds> cmd <command id or phrase>'",
+    .create = script_create,
+    .wake = script_wake,
+    .command = script_command,
+    .report = script_report,
+    .destroy = script_destroy,
+};
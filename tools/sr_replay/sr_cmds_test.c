@@ -0,0 +1,393 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_mn_speech_commands.h"
+#include "app_sr.h"
+#include "app_sr_handler.h"
+#include "bsp_board.h"
+#include "settings.h"
+#include "sr_replay.h"
+
+#define TEST_EN_CMDS        (14)        /* g_default_cmd_en of app_sr.c */
+#define TEST_CN_CMDS        (22)        /* g_default_cmd_cn of app_sr.c */
+#define TEST_MAX_CMDS       (ESP_MN_MAX_PHRASE_NUM)
+#define TEST_CHUNK_MS       (SR_REPLAY_CHUNK * 1000 / SR_REPLAY_SAMPLE_RATE)
+/* The detect task swaps models before its next chunk, the margin is for the scheduling of the host */
+#define TEST_SWITCH_MAX_MS  (2 * TEST_CHUNK_MS + 100)
+
+static sys_param_t s_param = {
+    .sr_lang = SR_LANG_EN,
+};
+
+static int s_failures;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-56s %s\n", what, ok ? "ok" : "FAIL");
+    s_failures += !ok;
+}
+
+sys_param_t *settings_get_parameter(void)
+{
+    return &s_param;
+}
+
+bool get_mute_play_flag()
+{
+    return true;
+}
+
+bool sensor_ir_learn_enable(void)
+{
+    return false;
+}
+
+bool sr_echo_is_playing(void)
+{
+    return false;
+}
+
+int64_t sr_replay_thread_cpu_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static bool bsp_get_sleep_mode()
+{
+    return false;
+}
+
+bsp_bottom_property_t *bsp_board_get_sensor_handle(void)
+{
+    static bsp_bottom_property_t handle = {
+        .get_sleep_mode = bsp_get_sleep_mode,
+    };
+    return &handle;
+}
+
+/**
+ * @brief Silence at the pace of the microphones, so that the detect task keeps fetching chunks
+ */
+esp_err_t bsp_i2s_read(void *audio_buffer, size_t len, size_t *bytes_read, uint32_t timeout_ms)
+{
+    vTaskDelay(pdMS_TO_TICKS(TEST_CHUNK_MS));
+    memset(audio_buffer, 0, len);
+    *bytes_read = len;
+    return ESP_OK;
+}
+
+void sr_handler_task(void *pvParam)
+{
+    while (true) {
+        sr_result_t result;
+        app_sr_get_result(&result, portMAX_DELAY);
+    }
+}
+
+/* Nothing is ever said, the test is about the commands and the models */
+static esp_err_t silent_create(const char *arg, void **ret_ctx)
+{
+    *ret_ctx = NULL;
+    return ESP_OK;
+}
+
+static bool silent_wake(void *ctx, const int16_t *samples, int num, uint64_t pos)
+{
+    return false;
+}
+
+static int silent_command(void *ctx, const int16_t *samples, int num, uint64_t pos)
+{
+    return -1;
+}
+
+static void silent_destroy(void *ctx)
+{
+}
+
+static const sr_replay_recognizer_t s_silent_recognizer = {
+    .name = "silent",
+    .help = "none",
+    .create = silent_create,
+    .wake = silent_wake,
+    .command = silent_command,
+    .destroy = silent_destroy,
+};
+
+static sr_cmd_t command_make(sr_user_cmd_t user_cmd, sr_language_t lang, const char *str, const char *phoneme)
+{
+    sr_cmd_t cmd = {
+        .cmd = user_cmd,
+        .lang = lang,
+        .id = 99,                       /* Ignored, the table gives the id */
+    };
+    snprintf(cmd.str, sizeof(cmd.str), "%s", str);
+    snprintf(cmd.phoneme, sizeof(cmd.phoneme), "%s", phoneme);
+    return cmd;
+}
+
+/* Commands of the table, from id 0 up to the first missing one */
+static uint32_t table_num(void)
+{
+    uint32_t num = 0;
+    while (app_sr_get_cmd_from_id(num)) {
+        num++;
+    }
+    return num;
+}
+
+static bool ids_are_indexes(void)
+{
+    for (uint32_t i = 0; i < table_num(); i++) {
+        if (app_sr_get_cmd_from_id(i)->id != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_defaults(void)
+{
+    uint8_t ids[4] = {0};
+
+    check((TEST_EN_CMDS == table_num()) && ids_are_indexes(), "English commands, the id of each is its index");
+    check((TEST_EN_CMDS == sr_replay_sr_command_num()) && (6 == sr_replay_sr_find_command("Turn Blue")),
+          "same commands and ids in the MultiNet list");
+    check(0 == strcmp(app_sr_get_cmd_from_id(5)->str, "Turn Green"), "lookup by id");
+    check((2 == app_sr_search_cmd_from_user_cmd(SR_CMD_LIGHT_ON, ids, 4)) && (0 == ids[0]) && (1 == ids[1]),
+          "search by user command");
+    check(1 == app_sr_search_cmd_from_user_cmd(SR_CMD_LIGHT_ON, ids, 1), "search stops at the length of the list");
+    check((1 == app_sr_search_cmd_from_phoneme("TkN BLo", ids, 4)) && (6 == ids[0]), "search by phoneme");
+    check(0 == app_sr_search_cmd_from_phoneme("da kai dian deng", ids, 4), "no phoneme of the other language");
+}
+
+static void test_set(sr_cmd_t *many)
+{
+    sr_cmd_t cmds[3] = {
+        command_make(SR_CMD_LIGHT_ON, SR_LANG_EN, "Lights On", "LiTS nN"),
+        command_make(SR_CMD_LIGHT_OFF, SR_LANG_EN, "Lights Off", "LiTS eF"),
+        command_make(SR_CMD_PLAY, SR_LANG_EN, "Play", "PLd"),
+    };
+
+    check(ESP_OK == app_sr_set_cmds(cmds, 3), "set three commands");
+    check((3 == table_num()) && ids_are_indexes() && (0 == strcmp(app_sr_get_cmd_from_id(2)->str, "Play")),
+          "table replaced, ids given by the order");
+    check((3 == sr_replay_sr_command_num()) && (1 == sr_replay_sr_find_command("Lights Off")) &&
+          (-1 == sr_replay_sr_find_command("Turn Blue")), "MultiNet list replaced");
+
+    check(ESP_ERR_INVALID_STATE == app_sr_set_cmds(many, TEST_MAX_CMDS + 1), "more commands than the table rejected");
+    check(3 == table_num(), "table unchanged");
+    check((ESP_OK == app_sr_set_cmds(many, TEST_MAX_CMDS)) && (TEST_MAX_CMDS == table_num()) &&
+          (TEST_MAX_CMDS == sr_replay_sr_command_num()), "full table set");
+
+    cmds[1].lang = SR_LANG_CN;
+    check(ESP_ERR_INVALID_ARG == app_sr_set_cmds(cmds, 3), "command of the other language rejected");
+    cmds[1].lang = SR_LANG_EN;
+    check((ESP_OK == app_sr_set_cmds(cmds, 3)) && (3 == table_num()), "set again");
+}
+
+static void test_add(sr_cmd_t *many)
+{
+    sr_cmd_t cmds[2] = {
+        command_make(SR_CMD_NEXT, SR_LANG_EN, "Next", "NfKST"),
+        command_make(SR_CMD_PAUSE, SR_LANG_EN, "Pause", "PeZ"),
+    };
+
+    check((ESP_OK == app_sr_add_cmds(cmds, 2)) && (ESP_OK == app_sr_update_cmds()), "add two commands");
+    check((5 == table_num()) && ids_are_indexes() && (4 == sr_replay_sr_find_command("Pause")),
+          "appended after the others, in the MultiNet list");
+
+    cmds[0].lang = SR_LANG_CN;
+    check((ESP_ERR_INVALID_ARG == app_sr_add_cmds(cmds, 2)) && (5 == table_num()),
+          "command of the other language rejected, none added");
+    cmds[0].lang = SR_LANG_EN;
+
+    check(ESP_OK == app_sr_set_cmds(many, TEST_MAX_CMDS - 2), "table two commands short of full");
+    check(ESP_ERR_INVALID_SIZE == app_sr_add_cmds(many, 4), "four more do not fit");
+    check((TEST_MAX_CMDS == table_num()) && (TEST_MAX_CMDS == sr_replay_sr_command_num()) &&
+          (0 == strcmp(app_sr_get_cmd_from_id(TEST_MAX_CMDS - 1)->str, many[1].str)), "the two which fit added");
+    check(ESP_ERR_INVALID_SIZE == app_sr_add_cmd(&cmds[0]), "full table rejects one more");
+}
+
+static void test_modify(void)
+{
+    sr_cmd_t cmds[3] = {
+        command_make(SR_CMD_LIGHT_ON, SR_LANG_EN, "Lights On", "LiTS nN"),
+        command_make(SR_CMD_LIGHT_OFF, SR_LANG_EN, "Lights Off", "LiTS eF"),
+        command_make(SR_CMD_PLAY, SR_LANG_EN, "Play", "PLd"),
+    };
+    sr_cmd_t cmd = command_make(SR_CMD_SET_RED, SR_LANG_EN, "Turn Red", "TkN RfD");
+
+    app_sr_set_cmds(cmds, 3);
+    check(ESP_OK == app_sr_modify_cmd(1, &cmd), "modify a command");
+    const sr_cmd_t *it = app_sr_get_cmd_from_id(1);
+    check((1 == it->id) && (SR_CMD_SET_RED == it->cmd) && (0 == strcmp(it->str, "Turn Red")),
+          "id kept, the rest replaced");
+    check((1 == sr_replay_sr_find_command("Turn Red")) && (-1 == sr_replay_sr_find_command("Lights Off")),
+          "phrase replaced in the MultiNet list");
+    check(ESP_ERR_INVALID_ARG == app_sr_modify_cmd(3, &cmd), "id out of range rejected");
+    check(ESP_ERR_INVALID_ARG == app_sr_modify_cmd(0, NULL), "no command rejected");
+    cmd.lang = SR_LANG_CN;
+    check(ESP_ERR_INVALID_ARG == app_sr_modify_cmd(0, &cmd), "command of the other language rejected");
+}
+
+static void test_remove(void)
+{
+    sr_cmd_t cmds[4] = {
+        command_make(SR_CMD_LIGHT_ON, SR_LANG_EN, "A", "A"),
+        command_make(SR_CMD_LIGHT_OFF, SR_LANG_EN, "B", "B"),
+        command_make(SR_CMD_PLAY, SR_LANG_EN, "C", "C"),
+        command_make(SR_CMD_NEXT, SR_LANG_EN, "D", "D"),
+    };
+
+    app_sr_set_cmds(cmds, 4);
+    check(ESP_OK == app_sr_remove_cmd(1), "remove a command");
+    check((3 == table_num()) && (0 == strcmp(app_sr_get_cmd_from_id(1)->str, "C")) &&
+          (0 == strcmp(app_sr_get_cmd_from_id(2)->str, "D")), "the next ones moved down");
+    check((ESP_OK == app_sr_update_cmds()) && ids_are_indexes(), "ids renumbered by the update");
+    check(ESP_ERR_INVALID_ARG == app_sr_remove_cmd(3), "id out of range rejected");
+    check((ESP_OK == app_sr_remove_all_cmd()) && (0 == table_num()), "remove all");
+    check(NULL == app_sr_get_cmd_from_id(0), "lookup in an empty table");
+}
+
+static bool wait_switch(sr_language_t lang, sr_model_stats_t *stats)
+{
+    for (int i = 0; i < 100; i++) {
+        app_sr_get_model_stats(lang, stats);
+        if (stats->switch_us) {
+            return true;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return false;
+}
+
+static void test_language(void)
+{
+    sr_cmd_t door = command_make(SR_CMD_MAX, SR_LANG_EN, "Open the Door", "ePcN jc DeR");
+    sr_model_stats_t en;
+    sr_model_stats_t cn;
+    sr_model_stats_t stats;
+    char what[80];
+
+    check(ESP_OK == app_sr_set_cmds(&door, 1), "English command set");
+    app_sr_get_model_stats(SR_LANG_EN, &en);
+    app_sr_get_model_stats(SR_LANG_CN, &cn);
+    check(en.resident && !cn.resident, "Chinese models not loaded at start");
+
+    check(ESP_OK == app_sr_set_language(SR_LANG_CN), "switch to Chinese");
+    app_sr_get_model_stats(SR_LANG_CN, &cn);
+    check(cn.resident && (TEST_CN_CMDS == table_num()) && ids_are_indexes(), "Chinese models loaded, their commands");
+    check((TEST_CN_CMDS == sr_replay_sr_command_num()) && (0 == sr_replay_sr_find_command("da kai dian deng")),
+          "MultiNet list of the Chinese commands, by phoneme");
+    check(wait_switch(SR_LANG_CN, &cn) && (cn.switch_us < TEST_SWITCH_MAX_MS * 1000), "swapped by the detect task");
+    printf("  %-24s %6" PRIu32 " us\n  %-24s %6" PRIu32 " us\n", "load", cn.load_us, "switch", cn.switch_us);
+
+    sr_result_t result = {
+        .state = ESP_MN_STATE_DETECTED,
+        .command_id = 0,
+        .lang = SR_LANG_EN,
+    };
+    const sr_cmd_t *cmd = app_sr_get_result_cmd(&result);
+    check(cmd && (0 == strcmp(cmd->str, "Open the Door")), "result of the English model read after the switch");
+    result.command_id = 1;
+    check(NULL == app_sr_get_result_cmd(&result), "result id out of the table of its language");
+    check(ESP_ERR_INVALID_ARG == app_sr_add_cmd(&door), "English command rejected in Chinese");
+
+    check(ESP_OK == app_sr_set_language(SR_LANG_EN), "switch back to English");
+    app_sr_get_model_stats(SR_LANG_EN, &stats);
+    check(stats.load_us == en.load_us, "English models resident, not loaded again");
+    check((1 == table_num()) && (0 == sr_replay_sr_find_command("Open the Door")) &&
+          (1 == sr_replay_sr_command_num()), "English commands kept across the switches");
+    check(ESP_OK == app_sr_set_language(SR_LANG_EN), "switch to the current language");
+
+    check(ESP_OK == app_sr_set_language(SR_LANG_CN), "switch to Chinese again");
+    app_sr_get_model_stats(SR_LANG_CN, &stats);
+    snprintf(what, sizeof(what), "no load the second time, %" PRIu32 " us the first", cn.load_us);
+    check(stats.load_us == cn.load_us, what);
+    check(TEST_CN_CMDS == sr_replay_sr_command_num(), "MultiNet list back to the Chinese commands");
+}
+
+static void test_invalid(void)
+{
+    sr_model_stats_t stats;
+
+    check(ESP_ERR_INVALID_ARG == app_sr_set_language(SR_LANG_MAX), "invalid language");
+    check(ESP_ERR_INVALID_ARG == app_sr_get_model_stats(SR_LANG_MAX, &stats), "statistics of an invalid language");
+    check(ESP_ERR_INVALID_ARG == app_sr_get_model_stats(SR_LANG_EN, NULL), "no statistics output");
+    check(ESP_ERR_INVALID_ARG == app_sr_add_cmds(NULL, 1), "no commands");
+    check(NULL == app_sr_get_result_cmd(NULL), "no result");
+}
+
+int main(int argc, char **argv)
+{
+    sr_cmd_t cmd = command_make(SR_CMD_LIGHT_ON, SR_LANG_EN, "Turn On the Light", "TkN nN jc LiT");
+    sr_model_stats_t stats;
+    bool verbose = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    /* The invalid arguments log errors on purpose */
+    port_log_level = verbose ? ESP_LOG_INFO : ESP_LOG_NONE;
+
+    sr_cmd_t *many = calloc(TEST_MAX_CMDS + 1, sizeof(sr_cmd_t));
+    for (int i = 0; i <= TEST_MAX_CMDS; i++) {
+        char str[SR_CMD_STR_LEN_MAX];
+        snprintf(str, sizeof(str), "Command %d", i);
+        many[i] = command_make(SR_CMD_MAX, SR_LANG_EN, str, str);
+    }
+
+    printf("Before the start\n");
+    check(ESP_ERR_INVALID_STATE == app_sr_add_cmd(&cmd), "no command added");
+    check(ESP_ERR_INVALID_STATE == app_sr_set_language(SR_LANG_CN), "no language switch");
+    check(ESP_ERR_INVALID_STATE == app_sr_get_model_stats(SR_LANG_EN, &stats), "no statistics");
+    check(NULL == app_sr_get_cmd_from_id(0), "no lookup");
+
+    sr_replay_sr_set_recognizer(&s_silent_recognizer, NULL);
+    check(ESP_OK == app_sr_start(false), "started in English");
+    printf("\nDefault commands\n");
+    test_defaults();
+    printf("\nSet\n");
+    test_set(many);
+    printf("\nAdd\n");
+    test_add(many);
+    printf("\nModify\n");
+    test_modify();
+    printf("\nRemove\n");
+    test_remove();
+    printf("\nLanguage switch\n");
+    test_language();
+    printf("\nInvalid arguments\n");
+    test_invalid();
+    free(many);
+    printf("\n%s\n", s_failures ? "FAIL" : "ok");
+
+    /* The tasks of app_sr.c block in bsp_i2s_read and fetch, exit without app_sr_stop as sr_replay does */
+    fflush(stdout);
+    _exit(s_failures ? 1 : 0);
+}
@@ -0,0 +1,270 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "app_sr.h"
+#include "app_sr_handler.h"
+#include "settings.h"
+#include "sr_trace.h"
+#include "sr_replay.h"
+
+#define REPLAY_POLL_MS          10
+#define REPLAY_WAKE_PROMPT_MS   70      /* sr_echo_play on the device: 50 ms, the echo, then 20 ms */
+
+static const char *TAG = "sr_replay";
+
+static const sr_replay_recognizer_t *const s_recognizers[] = {
+    &sr_replay_energy_recognizer,
+    &sr_replay_script_recognizer,
+};
+
+static sys_param_t s_param = {
+    .sr_lang = SR_LANG_EN,
+};
+
+static uint32_t s_wake_ms = REPLAY_WAKE_PROMPT_MS;
+static uint32_t s_action_ms = 0;
+static bool s_realtime = false;
+static volatile uint32_t s_received = 0;
+static volatile bool s_handler_waiting = false;
+static uint32_t s_received_by_type[SR_REPLAY_EVENT_TIMEOUT + 1];
+
+sys_param_t *settings_get_parameter(void)
+{
+    return &s_param;
+}
+
+bool get_mute_play_flag()
+{
+    return true;
+}
+
+bool sensor_ir_learn_enable(void)
+{
+    return false;
+}
+
+bool sr_echo_is_playing(void)
+{
+    return false;
+}
+
+int64_t sr_replay_thread_cpu_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief Delay the handler by a span of audio, so that results queue up during it as they would on the device
+ */
+static void replay_delay(uint32_t ms)
+{
+    if (s_realtime) {
+        vTaskDelay(pdMS_TO_TICKS(ms));
+        return;
+    }
+    uint64_t until = sr_replay_sr_position() + (uint64_t)ms * SR_REPLAY_SAMPLE_RATE / 1000;
+    while ((sr_replay_sr_position() < until) && !(sr_replay_i2s_done() && sr_replay_sr_idle())) {
+        vTaskDelay(1);
+    }
+}
+
+/**
+ * @brief Stands in for the handler of app_sr_handler.c: the same queue and trace stages, with the wake prompt and the
+ * command action replaced by delays of the same length.
+ */
+void sr_handler_task(void *pvParam)
+{
+    while (true) {
+        sr_result_t result;
+        s_handler_waiting = true;
+        app_sr_get_result(&result, portMAX_DELAY);
+        s_handler_waiting = false;
+        sr_trace_end(SR_TRACE_RESULT_QUEUE, result.trace_stamp);
+
+        if (ESP_MN_STATE_TIMEOUT == result.state) {
+            s_received_by_type[SR_REPLAY_EVENT_TIMEOUT]++;
+        } else if (WAKENET_DETECTED == result.wakenet_mode) {
+            s_received_by_type[SR_REPLAY_EVENT_WAKE]++;
+            replay_delay(s_wake_ms);
+        } else if (ESP_MN_STATE_DETECTED & result.state) {
+            s_received_by_type[SR_REPLAY_EVENT_COMMAND]++;
+            const sr_cmd_t *cmd = app_sr_get_result_cmd(&result);
+            if (NULL == cmd) {
+                ESP_LOGW(TAG, "command %d not in the table", result.command_id);
+            }
+            uint32_t stamp = sr_trace_begin(SR_TRACE_ACTION);
+            replay_delay(s_action_ms);
+            sr_trace_end(SR_TRACE_ACTION, stamp);
+        }
+        s_received++;
+    }
+}
+
+static bool replay_done(void)
+{
+    sr_trace_queue_stats_t queue;
+    sr_trace_get_queue(&queue);
+    return sr_replay_i2s_done() && sr_replay_sr_idle() && s_handler_waiting && (s_received == queue.sent);
+}
+
+static void replay_print_cpu(const char *name, const sr_replay_cpu_t *cpu)
+{
+    printf("%-14s %8u %9u %9u\n", name, (unsigned)cpu->chunks,
+           (unsigned)(cpu->chunks ? cpu->total_us / cpu->chunks : 0), (unsigned)cpu->max_us);
+}
+
+static void replay_report(double wall_s, double cpu_s)
+{
+    static const char *const type_names[] = {"wake", "command", "timeout"};
+    size_t num;
+    const sr_replay_event_t *events = sr_replay_sr_get_events(&num);
+
+    printf("\ndetections\n");
+    for (size_t i = 0; i < num; i++) {
+        const sr_replay_event_t *event = &events[i];
+        printf("%9.3f s  %-8s", (double)event->pos / SR_REPLAY_SAMPLE_RATE, type_names[event->type]);
+        if (SR_REPLAY_EVENT_COMMAND == event->type) {
+            const sr_cmd_t *cmd = app_sr_get_cmd_from_id(event->command_id);
+            printf(" %d %s", event->command_id, cmd ? ((SR_LANG_EN == s_param.sr_lang) ? cmd->str : cmd->phoneme) : "?");
+        }
+        printf("\n");
+    }
+
+    uint32_t detected[SR_REPLAY_EVENT_TIMEOUT + 1] = {0};
+    for (size_t i = 0; i < num; i++) {
+        detected[events[i].type]++;
+    }
+    printf("\n%-10s %9s %9s\n", "", "detected", "handled");
+    for (int i = 0; i <= SR_REPLAY_EVENT_TIMEOUT; i++) {
+        printf("%-10s %9u %9u\n", type_names[i], (unsigned)detected[i], (unsigned)s_received_by_type[i]);
+    }
+
+    uint32_t fed, dropped, waited;
+    sr_replay_sr_get_feed(&fed, &dropped, &waited);
+    double audio_s = (double)fed * SR_REPLAY_CHUNK / SR_REPLAY_SAMPLE_RATE;
+    printf("\naudio %.3f s in %.3f s wall, %.1fx real time, %.3f s CPU\n", audio_s, wall_s,
+           wall_s > 0 ? audio_s / wall_s : 0, cpu_s);
+    printf("afe: %u chunks fed, %u dropped on a full buffer, %u feeds waited for room\n", (unsigned)fed,
+           (unsigned)dropped, (unsigned)waited);
+
+    sr_replay_cpu_t cpu;
+    printf("\n%-14s %8s %9s %9s\n", "cpu per chunk", "chunks", "avg us", "max us");
+    sr_replay_i2s_get_cpu(&cpu);
+    replay_print_cpu("feed task", &cpu);
+    sr_replay_sr_get_cpu(&cpu);
+    replay_print_cpu("detect task", &cpu);
+
+    printf("\n");
+    sr_trace_print();
+}
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [options] <capture.pcm>\n"
+           "Replays a 16 kHz 16 bit stereo capture through app_sr.c of factory_demo.\n"
+           "  -l en|cn        language, default en\n"
+           "  -r <name>       recognizer, default energy\n"
+           "  -a <arg>        recognizer argument\n"
+           "  -w <ms>         wake prompt of the handler, default %d\n"
+           "  -x <ms>         command action of the handler, default 0\n"
+           "  -t              real time: pace the capture and drop chunks on a full AFE buffer\n"
+           "  -v              verbose, repeat for debug\n"
+           "recognizers:\n", prog, REPLAY_WAKE_PROMPT_MS);
+    for (size_t i = 0; i < sizeof(s_recognizers) / sizeof(s_recognizers[0]); i++) {
+        printf("  %-8s -a %s\n", s_recognizers[i]->name, s_recognizers[i]->help);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const sr_replay_recognizer_t *recognizer = &sr_replay_energy_recognizer;
+    const char *recognizer_arg = NULL;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "l:r:a:w:x:tvh"))) {
+        switch (opt) {
+        case 'l':
+            if (0 == strcmp(optarg, "cn")) {
+                s_param.sr_lang = SR_LANG_CN;
+            } else if (0 != strcmp(optarg, "en")) {
+                usage(argv[0]);
+                return 1;
+            }
+            break;
+        case 'r':
+            recognizer = NULL;
+            for (size_t i = 0; i < sizeof(s_recognizers) / sizeof(s_recognizers[0]); i++) {
+                if (0 == strcmp(optarg, s_recognizers[i]->name)) {
+                    recognizer = s_recognizers[i];
+                }
+            }
+            if (NULL == recognizer) {
+                usage(argv[0]);
+                return 1;
+            }
+            break;
+        case 'a':
+            recognizer_arg = optarg;
+            break;
+        case 'w':
+            s_wake_ms = strtoul(optarg, NULL, 0);
+            break;
+        case 'x':
+            s_action_ms = strtoul(optarg, NULL, 0);
+            break;
+        case 't':
+            s_realtime = true;
+            break;
+        case 'v':
+            port_log_level = (port_log_level < ESP_LOG_INFO) ? ESP_LOG_INFO : ESP_LOG_DEBUG;
+            break;
+        default:
+            usage(argv[0]);
+            return ('h' == opt) ? 0 : 1;
+        }
+    }
+    if (optind + 1 != argc) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    void *ctx = NULL;
+    ESP_ERROR_CHECK(sr_replay_i2s_open(argv[optind], s_realtime));
+    ESP_ERROR_CHECK(recognizer->create(recognizer_arg, &ctx));
+    sr_replay_sr_set_recognizer(recognizer, ctx);
+    sr_replay_sr_set_realtime(s_realtime);
+
+    int64_t start_us = esp_timer_get_time();
+    ESP_ERROR_CHECK(app_sr_start(false));
+    while (!replay_done()) {
+        vTaskDelay(pdMS_TO_TICKS(REPLAY_POLL_MS));
+    }
+    double wall_s = (esp_timer_get_time() - start_us) / 1e6;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    replay_report(wall_s, ts.tv_sec + ts.tv_nsec / 1e9);
+    if (recognizer->report) {
+        printf("\n");
+        recognizer->report(ctx);
+    }
+
+    /* The tasks of app_sr.c block in bsp_i2s_read and fetch for good, exit without app_sr_stop */
+    fflush(stdout);
+    _exit(0);
+}
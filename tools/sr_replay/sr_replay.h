@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SR_REPLAY_SAMPLE_RATE   16000
+#define SR_REPLAY_CHUNK         512     /*!< Samples per AFE chunk, feed and fetch */
+
+/**
+ * @brief Recognizer behind the esp-sr stubs
+ *
+ * The AFE stub asks `wake` about every chunk while the wake word is enabled, the MultiNet stub asks `command` about
+ * every chunk while a command is awaited; each chunk goes to one of them. Chunks are mono, the first microphone channel
+ * of the capture, and `pos` is the index of their first sample. Wrap a desktop build of a real model in this interface
+ * to replay captures through it.
+ */
+typedef struct {
+    const char *name;
+    const char *help;           /*!< Meaning of the recognizer argument */
+    esp_err_t (*create)(const char *arg, void **ret_ctx);
+    bool (*wake)(void *ctx, const int16_t *samples, int num, uint64_t pos);
+    int (*command)(void *ctx, const int16_t *samples, int num, uint64_t pos);  /*!< Command id, -1 for none */
+    void (*report)(void *ctx);  /*!< Print what the recognizer knows about the run, may be NULL */
+    void (*destroy)(void *ctx);
+} sr_replay_recognizer_t;
+
+extern const sr_replay_recognizer_t sr_replay_energy_recognizer;
+extern const sr_replay_recognizer_t sr_replay_script_recognizer;
+
+typedef enum {
+    SR_REPLAY_EVENT_WAKE,
+    SR_REPLAY_EVENT_COMMAND,
+    SR_REPLAY_EVENT_TIMEOUT,
+} sr_replay_event_type_t;
+
+/**
+ * @brief A detection by the esp-sr stubs, before app_sr.c sees it
+ */
+typedef struct {
+    sr_replay_event_type_t type;
+    int command_id;
+    uint64_t pos;               /*!< End of the chunk it was detected in, samples */
+    int64_t time_us;            /*!< esp_timer time of the detection */
+} sr_replay_event_t;
+
+typedef struct {
+    uint32_t chunks;
+    uint64_t total_us;          /*!< Thread CPU time */
+    uint32_t max_us;
+} sr_replay_cpu_t;
+
+/**
+ * @brief Open a capture: 16 kHz, 16 bit, two interleaved channels, as recorded by `app_sr_start(true)`
+ *
+ * @param path: Capture file
+ * @param realtime: Deliver chunks at the sample rate instead of as fast as they are consumed
+ */
+esp_err_t sr_replay_i2s_open(const char *path, bool realtime);
+
+/**
+ * @brief The feed task is waiting for data after the end of the capture
+ */
+bool sr_replay_i2s_done(void);
+
+/**
+ * @brief Feed task CPU time per chunk, from one `bsp_i2s_read` return to the next
+ */
+void sr_replay_i2s_get_cpu(sr_replay_cpu_t *cpu);
+
+/**
+ * @brief Set the recognizer, before `app_sr_start`
+ */
+void sr_replay_sr_set_recognizer(const sr_replay_recognizer_t *recognizer, void *ctx);
+
+/**
+ * @brief Drop chunks when the AFE buffer is full, as on the device, instead of holding the feed task
+ */
+void sr_replay_sr_set_realtime(bool realtime);
+
+/**
+ * @brief Id of a command phrase of the MultiNet command list, -1 if it is not there
+ */
+int sr_replay_sr_find_command(const char *phrase);
+
+/**
+ * @brief Number of commands of the MultiNet command list
+ */
+int sr_replay_sr_command_num(void);
+
+/**
+ * @brief Every fed chunk was fetched and the detect task is back waiting in fetch
+ */
+bool sr_replay_sr_idle(void);
+
+/**
+ * @brief Samples fetched so far
+ */
+uint64_t sr_replay_sr_position(void);
+
+/**
+ * @brief Detect task CPU time per chunk, from one AFE fetch return to the next
+ */
+void sr_replay_sr_get_cpu(sr_replay_cpu_t *cpu);
+
+/**
+ * @brief Chunks fed, chunks dropped by a full AFE buffer and feeds that waited for room
+ */
+void sr_replay_sr_get_feed(uint32_t *fed, uint32_t *dropped, uint32_t *waited);
+
+/**
+ * @brief Detections so far, valid until the next detection
+ */
+const sr_replay_event_t *sr_replay_sr_get_events(size_t *num);
+
+/**
+ * @brief Thread CPU time in microseconds
+ */
+int64_t sr_replay_thread_cpu_us(void);
+
+#ifdef __cplusplus
+}
+#endif